@@ -0,0 +1,226 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: The 4 I/O ports between the 5A22 ($2140-$2143) and the SPC700 ($F4-$F7), which keep the SPC700 lazily in step with the CPU.
+ */
+
+#pragma once
+
+#include "../LSNBirdSNES.h"
+#include "../Bus/LSNBusB.h"
+#include "../CPU/LSNRicoh5A22.h"
+
+#include <cstdint>
+#include <numeric>
+
+
+namespace lsn {
+
+	/**
+	 * Class CApuPorts
+	 * \brief The 4 I/O ports between the 5A22 and the SPC700.
+	 *
+	 * Description: The 4 I/O ports between the 5A22 ($2140-$2143, mirrored through $217F) and the SPC700 ($F4-$F7).  Each direction
+	 *	has its own 4 latches.
+	 * The SPC700 runs from its own crystal, unrelated to the CPU's, and nothing it does is visible to the CPU except through these ports.
+	 *	It therefore only runs when it is observed: before each CPU access to a port, and whenever Sync() is called (at the end of each
+	 *	frame, to produce that frame's audio).  The CPU's master-clock position is converted to SPC700 master cycles by exact rational
+	 *	accumulation, so however the syncs fall, the SPC700 ends up exactly where it would have been had it been ticked in lock step.
+	 */
+	class CApuPorts {
+	public :
+		CApuPorts( const CRicoh5A22 &_rCpu ) :
+			m_rCpu( _rCpu ) {
+			SetApuClock( LSN_CS_SPC700_MASTER, LSN_CS_SPC700_MASTER_DIVISOR );
+		}
+
+
+		// == Types.
+		/**
+		 * Runs the SPC700 until its clock reaches a given master cycle.
+		 *
+		 * \param _pvParm The parameter passed to SetCatchUp().
+		 * \param _ui64Cycle The SPC700 master cycle to reach.
+		 **/
+		typedef void (LSN_FASTCALL *				PfCatchUp)( void * _pvParm, uint64_t _ui64Cycle );
+
+
+		// == Functions.
+		/**
+		 * Sets the function that runs the SPC700.  Without one, the ports only latch values.
+		 *
+		 * \param _pfFunc The function to call, or nullptr.
+		 * \param _pvParm The parameter to pass to _pfFunc.
+		 **/
+		inline void									SetCatchUp( PfCatchUp _pfFunc, void * _pvParm ) {
+			m_pfCatchUp = _pfFunc;
+			m_pvCatchUpParm = _pvParm;
+		}
+
+		/**
+		 * Sets the SPC700's clock and restarts the conversion from the CPU's current position.  The CPU's clock is taken from the CPU.
+		 *
+		 * \param _ui64MasterClock The SPC700's master-clock speed.
+		 * \param _ui64MasterDiv The SPC700's master divisor.
+		 **/
+		void										SetApuClock( uint64_t _ui64MasterClock, uint64_t _ui64MasterDiv ) {
+			// APU cycles per CPU cycle = (ApuClock / ApuDiv) / (CpuClock / CpuDiv), reduced so that the running product stays small.
+			uint64_t ui64Num = _ui64MasterClock * m_rCpu.MasterDivisor();
+			uint64_t ui64Den = _ui64MasterDiv * m_rCpu.MasterClock();
+			const uint64_t ui64Gcd = std::gcd( ui64Num, ui64Den );
+			m_ui64Num = ui64Num / ui64Gcd;
+			m_ui64Den = ui64Den / ui64Gcd;
+			m_ui64CpuCycle = m_rCpu.GetMasterCycles();
+			m_ui64Remainder = 0;
+		}
+
+		/**
+		 * Resets the ports and restarts the conversion from the CPU's current position, so it must follow the CPU's reset.  The
+		 *	SPC700's position is kept.
+		 **/
+		void										Reset() {
+			for ( size_t I = 0; I < 4; ++I ) {
+				m_ui8CpuToApu[I] = 0;
+				m_ui8ApuToCpu[I] = 0;
+			}
+			m_ui64CpuCycle = m_rCpu.GetMasterCycles();
+			m_ui64Remainder = 0;
+		}
+
+		/**
+		 * Runs the SPC700 up to the CPU's current position.
+		 **/
+		inline void									Sync() {
+			const uint64_t ui64Cpu = m_rCpu.GetMasterCycles();
+			if ( ui64Cpu <= m_ui64CpuCycle ) { return; }
+			const uint64_t ui64Scaled = (ui64Cpu - m_ui64CpuCycle) * m_ui64Num + m_ui64Remainder;
+			m_ui64CpuCycle = ui64Cpu;
+			m_ui64ApuCycle += ui64Scaled / m_ui64Den;
+			m_ui64Remainder = ui64Scaled % m_ui64Den;
+			if ( m_pfCatchUp ) {
+				m_pfCatchUp( m_pvCatchUpParm, m_ui64ApuCycle );
+			}
+		}
+
+		/**
+		 * Gets the SPC700 master cycle that the last Sync() reached.
+		 *
+		 * \return Returns the SPC700's synchronized position.
+		 **/
+		inline uint64_t								ApuCycles() const { return m_ui64ApuCycle; }
+
+		/**
+		 * Reads a port from the CPU side, after bringing the SPC700 up to date.
+		 *
+		 * \param _ui8Port The port (0-3).
+		 * \return Returns the value last written by the SPC700.
+		 **/
+		inline uint8_t								CpuRead( uint8_t _ui8Port ) {
+			Sync();
+			return m_ui8ApuToCpu[_ui8Port&3];
+		}
+
+		/**
+		 * Writes a port from the CPU side, after bringing the SPC700 up to date.
+		 *
+		 * \param _ui8Port The port (0-3).
+		 * \param _ui8Val The value to write.
+		 **/
+		inline void									CpuWrite( uint8_t _ui8Port, uint8_t _ui8Val ) {
+			Sync();
+			m_ui8CpuToApu[_ui8Port&3] = _ui8Val;
+		}
+
+		/**
+		 * Reads a port from the SPC700 side ($F4-$F7).
+		 *
+		 * \param _ui8Port The port (0-3).
+		 * \return Returns the value last written by the CPU.
+		 **/
+		inline uint8_t								ApuRead( uint8_t _ui8Port ) const { return m_ui8CpuToApu[_ui8Port&3]; }
+
+		/**
+		 * Writes a port from the SPC700 side ($F4-$F7).
+		 *
+		 * \param _ui8Port The port (0-3).
+		 * \param _ui8Val The value to write.
+		 **/
+		inline void									ApuWrite( uint8_t _ui8Port, uint8_t _ui8Val ) { m_ui8ApuToCpu[_ui8Port&3] = _ui8Val; }
+
+		/**
+		 * Clears the ports written by the CPU, as the SPC700 does when it writes bits 4 and 5 of CONTROL ($F1).
+		 *
+		 * \param _bPorts01 If true, ports 0 and 1 are cleared.
+		 * \param _bPorts23 If true, ports 2 and 3 are cleared.
+		 **/
+		inline void									ApuClearInputs( bool _bPorts01, bool _bPorts23 ) {
+			if ( _bPorts01 ) { m_ui8CpuToApu[0] = m_ui8CpuToApu[1] = 0; }
+			if ( _bPorts23 ) { m_ui8CpuToApu[2] = m_ui8CpuToApu[3] = 0; }
+		}
+
+		/**
+		 * Claims $2140-$217F on a Bus B.
+		 *
+		 * \param _bbBus The Bus B through which the CPU reaches the ports.
+		 **/
+		void										Attach( CBusB &_bbBus ) {
+			for ( uint32_t I = 0x40; I < 0x80; ++I ) {
+				_bbBus.SetRegister( uint8_t( I ), &CApuPorts::BusBRead, &CApuPorts::BusBWrite, &CApuPorts::BusBDebugRead, this );
+			}
+		}
+
+
+	protected :
+		// == Members.
+		const CRicoh5A22 &							m_rCpu;								/**< The CPU, whose position drives synchronization. */
+		PfCatchUp									m_pfCatchUp = nullptr;				/**< Runs the SPC700. */
+		void *										m_pvCatchUpParm = nullptr;			/**< The parameter passed to m_pfCatchUp. */
+		uint64_t									m_ui64Num = 1;						/**< SPC700 master cycles per m_ui64Den CPU master cycles. */
+		uint64_t									m_ui64Den = 1;						/**< CPU master cycles per m_ui64Num SPC700 master cycles. */
+		uint64_t									m_ui64CpuCycle = 0;					/**< The CPU master cycle of the last Sync(). */
+		uint64_t									m_ui64ApuCycle = 0;					/**< The SPC700 master cycle of the last Sync(). */
+		uint64_t									m_ui64Remainder = 0;				/**< The fraction of an SPC700 master cycle carried between syncs, in units of 1 / m_ui64Den. */
+		uint8_t										m_ui8CpuToApu[4] = {};				/**< Written by the CPU, read by the SPC700. */
+		uint8_t										m_ui8ApuToCpu[4] = {};				/**< Written by the SPC700, read by the CPU. */
+
+
+		// == Functions.
+		/**
+		 * The Bus B reader for $40-$7F.
+		 *
+		 * \param _pvParm0 Points to the CApuPorts.
+		 * \param _ui8Reg The register.
+		 * \param _ui8Ret Holds the read value on return.
+		 * \param _ui8OpenMask Unused; every bit is driven.
+		 **/
+		static void LSN_FASTCALL					BusBRead( void * _pvParm0, uint8_t _ui8Reg, uint8_t &_ui8Ret, uint8_t &_ui8OpenMask ) {
+			static_cast<void>(_ui8OpenMask);
+			_ui8Ret = static_cast<CApuPorts *>(_pvParm0)->CpuRead( _ui8Reg );
+		}
+
+		/**
+		 * The Bus B writer for $40-$7F.
+		 *
+		 * \param _pvParm0 Points to the CApuPorts.
+		 * \param _ui8Reg The register.
+		 * \param _ui8Val The value to write.
+		 **/
+		static void LSN_FASTCALL					BusBWrite( void * _pvParm0, uint8_t _ui8Reg, uint8_t _ui8Val ) {
+			static_cast<CApuPorts *>(_pvParm0)->CpuWrite( _ui8Reg, _ui8Val );
+		}
+
+		/**
+		 * The Bus B debug reader for $40-$7F.  Does not synchronize.
+		 *
+		 * \param _pvParm0 Points to the CApuPorts.
+		 * \param _ui8Reg The register.
+		 * \param _ui8Ret Holds the read value on return.
+		 **/
+		static void LSN_FASTCALL					BusBDebugRead( void * _pvParm0, uint8_t _ui8Reg, uint8_t &_ui8Ret ) {
+			_ui8Ret = static_cast<const CApuPorts *>(_pvParm0)->m_ui8ApuToCpu[_ui8Reg&3];
+		}
+	};
+
+}	// namespace lsn
@@ -10,9 +10,21 @@
 
 #include "../LSNBirdSNES.h"
 #include "../Foundation/LSNMacros.h"
+#include "LSNMemoryMap.h"
 
+#include <algorithm>
+#include <bit>
 #include <cassert>
 #include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+#ifdef LSN_CPU_VERIFY
+#include "../Utilities/LSNTimer.h"
+#endif	// #ifdef LSN_CPU_VERIFY
 
 
 namespace lsn {
@@ -21,40 +33,65 @@ namespace lsn {
 	 * Class CBusA
 	 * \brief The Bus A implementation.
 	 *
-	 * Description: The Bus A implementation.
+	 * Description: The Bus A implementation.  Accessors and speeds come from a CMemoryMap shared by every bus with the same
+	 *	configuration.  Changes made through the bus (SetAccessor(), SetDirectAccess(), SetRamSpeed()) copy the affected bank into a
+	 *	per-bus overlay, so a bus only pays for the banks it actually overrides.
 	 */
 	class CBusA {
 	public :
-		CBusA() {
-			BuildSpeedTable();
-			ApplyBasicMapping();
+		CBusA( std::shared_ptr<const CMemoryMap> _pmmMap = CMemoryMap::Basic() ) {
+			SetMemoryMap( std::move( _pmmMap ) );
 		}
 		~CBusA() {
 		}
 
 
+		// == Enumerations.
+		/** How the address advances through a multi-byte access. */
+		enum LSN_WRAP {
+			LSN_W_LINEAR,															/**< The full 24-bit address increments, carrying into the next bank (absolute, long, and indexed data). */
+			LSN_W_BANK,																/**< The 16-bit address wraps within the bank (program fetches, the native-mode stack and direct page). */
+			LSN_W_PAGE,																/**< The low byte wraps within the page (the emulation-mode direct page when DL is 0). */
+		};
+
+		/** Why a page's next write must be caught (the bits of m_ui8WatchedPages). */
+		enum LSN_WATCH_FLAGS : uint8_t {
+			LSN_WF_NOTIFY							= (1 << 0),						/**< Call the function set by SetPageWriteNotify(). */
+			LSN_WF_DIRTY							= (1 << 1),						/**< Mark the page in the dirty-page bitmap. */
+		};
+
+
 		// == Types.
 		/** Reader parameters. */
-		struct LSN_ACCESSFUNCPARMS {
-			void *									pvParm0;						/**< The user-supplied pointer to pass back to this function. */
-			uint32_t								ui32FullAddress;				/**< The full address being accessed. */
-			uint8_t *								pui8Data;						/**< A pointer to the default bus memory. */
-			LSN_ACCESS_SOURCE						asAccessSource;					/**< The source of the memory access (CPU vs DMA). */
-			uint16_t								ui16Address;					/**< The 16-bit address being accessed. */
-			uint8_t									ui8Bank;						/**< The bank being accessed. */
-		};
+		typedef CMemoryMap::LSN_ACCESSFUNCPARMS		LSN_ACCESSFUNCPARMS;
 
 		/** An address-reading function. */
-		typedef void (LSN_FASTCALL *				PfReadFunc)( const LSN_ACCESSFUNCPARMS &_rfpParms, uint8_t &_ui8Ret, uint8_t &_ui8OpenMask );
+		typedef CMemoryMap::PfReadFunc				PfReadFunc;
 
 		/** An address-writing function. */
-		typedef void (LSN_FASTCALL *				PfWriteFunc)( const LSN_ACCESSFUNCPARMS &_rfpParms, uint8_t _ui8Val );
+		typedef CMemoryMap::PfWriteFunc				PfWriteFunc;
 
 		/** A debug address-reading function. */
-		typedef void (LSN_FASTCALL *				PfDebugReadFunc)( const LSN_ACCESSFUNCPARMS &_rfpParms, uint8_t &_ui8Ret );
+		typedef CMemoryMap::PfDebugReadFunc			PfDebugReadFunc;
 
 		/** A debug address-writing function. */
-		typedef void (LSN_FASTCALL *				PfDebugWriteFunc)( const LSN_ACCESSFUNCPARMS &_rfpParms, uint8_t _ui8Val );
+		typedef CMemoryMap::PfDebugWriteFunc		PfDebugWriteFunc;
+
+		/** Per-page information used by every access. */
+		typedef CMemoryMap::LSN_HOT_ACCESSOR		LSN_HOT_ACCESSOR;
+
+		/** A function called when a watched page is written (or remapped). */
+		typedef void (LSN_FASTCALL *				PfPageWriteNotify)( void * _pvParm, uint16_t _ui16Page );
+
+		/** The bus state that code translated by the CPU reads and writes directly.  See JitView(). */
+		struct LSN_JIT_VIEW {
+			const LSN_HOT_ACCESSOR * const *		ppaBanks;							/**< The hot accessors of each bank. */
+			uint8_t * const *						ppui8Memory;						/**< The bus's memory pointer. */
+			uint8_t *								pui8DataBus;						/**< The data bus. */
+			const uint8_t *							pui8MemSel;							/**< The MEMSEL flag (0 or 1). */
+			const uint8_t *							pui8WatchedPages;					/**< LSN_WATCH_FLAGS for each page, indexed by LSN_HOT_ACCESSOR::uiMemory >> 8 for bus memory. */
+			uint64_t *								pui64IdleStable;					/**< Cleared by every write.  See IdleStable(). */
+		};
 
 
 		// == Functions.
@@ -72,34 +109,40 @@ namespace lsn {
 		inline uint8_t								Read( uint16_t _ui16Address, uint8_t _ui8Bank, uint8_t &_ui8Speed ) {
 			static_assert( _ui8SpeedOverride < 16, "_ui8SpeedOverride must fit in 4 bits." );
 
-			m_rfpAccessFuncParms.ui16Address = _ui16Address;
-			m_rfpAccessFuncParms.ui8Bank = _ui8Bank;
-			m_rfpAccessFuncParms.ui32FullAddress = uint32_t( _ui16Address ) | (uint32_t( _ui8Bank ) << 16);
-			m_rfpAccessFuncParms.asAccessSource = _asAccessSource;
-			uint16_t ui16SpdAddr = uint16_t( m_rfpAccessFuncParms.ui32FullAddress >> 8 );
-			uint8_t * pui8Spd;
-			if constexpr ( _ui8SpeedOverride == 0 ) {
-				pui8Spd = m_ui8Speeds + ui16SpdAddr;
-				LSN_PREFETCH_LINE( pui8Spd );
+			const uint32_t ui32FullAddress = uint32_t( _ui16Address ) | (uint32_t( _ui8Bank ) << 16);
+			uint8_t ui8Ret;
+			const LSN_HOT_ACCESSOR & haAccessor = m_phaBanks[_ui8Bank][_ui16Address>>8];
+			if LSN_LIKELY( haAccessor.ui8Flags & CMemoryMap::LSN_AF_MEMORY_READ ) {
+				// Plain memory: read it in place, with no open-bus bits.
+				ui8Ret = m_pui8Memory[haAccessor.uiMemory|uint8_t( _ui16Address )];
+				m_ui8DataBus = ui8Ret;
+			}
+			else if ( haAccessor.ui8Flags & CMemoryMap::LSN_AF_DIRECT_READ ) {
+				ui8Ret = haAccessor.pui8Direct[uint8_t( _ui16Address )];
+				m_ui8DataBus = ui8Ret;
+			}
+			else {
+				m_rfpAccessFuncParms.ui16Address = _ui16Address;
+				m_rfpAccessFuncParms.ui8Bank = _ui8Bank;
+				m_rfpAccessFuncParms.ui32FullAddress = ui32FullAddress;
+				m_rfpAccessFuncParms.asAccessSource = _asAccessSource;
+				uint8_t ui8Mask = 0xFF;
+				ui8Ret = m_ui8DataBus;
+				const LSN_READER & rReader = m_vReaders[haAccessor.ui16Reader];
+				m_rfpAccessFuncParms.pvParm0 = rReader.pvParm0;
+				m_ui64ReadStable = 0;
+				rReader.pfFunc( m_rfpAccessFuncParms, ui8Ret, ui8Mask );
+				m_ui64IdleStable = std::min( m_ui64IdleStable, m_ui64ReadStable );
+				m_ui8DataBus = (m_ui8DataBus & ~ui8Mask) | (ui8Ret & ui8Mask);
 			}
-			uint8_t ui8Mask = 0xFF;
-			uint8_t ui8Ret = m_ui8DataBus;
-			auto & aaAccessor = m_aaAccessors[ui16SpdAddr];
-			m_rfpAccessFuncParms.pvParm0 = aaAccessor.pvReaderParm0;
-			aaAccessor.pfReader( m_rfpAccessFuncParms, ui8Ret, ui8Mask );
-			m_ui8DataBus = (m_ui8DataBus & ~ui8Mask) | (ui8Ret & ui8Mask);
 			if constexpr ( _ui8SpeedOverride == 0 ) {
-				_ui8Speed = ((*pui8Spd) >> ((m_ui8MemSel /*& 1*/) << 2)) & 0b1111;
+				_ui8Speed = haAccessor.ui8Speeds[m_ui8MemSel];
 			}
 			else {
 				_ui8Speed = _ui8SpeedOverride;
 			}
 #ifdef LSN_CPU_VERIFY
-			if ( m_vReadWriteLog.size() ) {
-				m_vReadWriteLog[m_vReadWriteLog.size()-1].ui32Address = m_rfpAccessFuncParms.ui32FullAddress;
-				m_vReadWriteLog[m_vReadWriteLog.size()-1].ui8Value = ui8Ret;
-				m_vReadWriteLog[m_vReadWriteLog.size()-1].bRead = true;
-			}
+			LogAccess( ui32FullAddress, ui8Ret, true );
 #endif	// #ifdef LSN_CPU_VERIFY
 			return ui8Ret;
 		}
@@ -116,34 +159,39 @@ namespace lsn {
 		inline void									Write( uint16_t _ui16Address, uint8_t _ui8Bank, uint8_t _ui8Val, uint8_t &_ui8Speed ) {
 			static_assert( _ui8SpeedOverride < 16, "_ui8SpeedOverride must fit in 4 bits." );
 
-			m_rfpAccessFuncParms.ui16Address = _ui16Address;
-			m_rfpAccessFuncParms.ui8Bank = _ui8Bank;
-			m_rfpAccessFuncParms.ui32FullAddress = uint32_t( _ui16Address ) | (uint32_t( _ui8Bank ) << 16);
-			m_rfpAccessFuncParms.asAccessSource = _asAccessSource;
-			uint16_t ui16SpdAddr = uint16_t( m_rfpAccessFuncParms.ui32FullAddress >> 8 );
-			uint8_t * pui8Spd;
-			if constexpr ( _ui8SpeedOverride == 0 ) {
-				pui8Spd = m_ui8Speeds + ui16SpdAddr;
-				LSN_PREFETCH_LINE( pui8Spd );
+			const uint32_t ui32FullAddress = uint32_t( _ui16Address ) | (uint32_t( _ui8Bank ) << 16);
+			uint16_t ui16Watch = uint16_t( ui32FullAddress >> 8 );
+			const LSN_HOT_ACCESSOR & haAccessor = m_phaBanks[_ui8Bank][_ui16Address>>8];
+			if LSN_LIKELY( haAccessor.ui8Flags & CMemoryMap::LSN_AF_MEMORY_WRITE ) {
+				m_pui8Memory[haAccessor.uiMemory|uint8_t( _ui16Address )] = _ui8Val;
+				ui16Watch = uint16_t( haAccessor.uiMemory >> 8 );
+			}
+			else if ( haAccessor.ui8Flags & CMemoryMap::LSN_AF_DIRECT_WRITE ) {
+				haAccessor.pui8Direct[uint8_t( _ui16Address )] = _ui8Val;
+			}
+			else {
+				m_rfpAccessFuncParms.ui16Address = _ui16Address;
+				m_rfpAccessFuncParms.ui8Bank = _ui8Bank;
+				m_rfpAccessFuncParms.ui32FullAddress = ui32FullAddress;
+				m_rfpAccessFuncParms.asAccessSource = _asAccessSource;
+				const LSN_WRITER & wWriter = m_vWriters[haAccessor.ui16Writer];
+				m_rfpAccessFuncParms.pvParm0 = wWriter.pvParm0;
+				wWriter.pfFunc( m_rfpAccessFuncParms, _ui8Val );
+				ui16Watch = WatchKey( haAccessor, ui16Watch );
 			}
-			auto & aaAccessor = m_aaAccessors[ui16SpdAddr];
-			aaAccessor.pfWriter( m_rfpAccessFuncParms, _ui8Val );
 			m_ui8DataBus = _ui8Val;
+			m_ui64IdleStable = 0;
+			if LSN_UNLIKELY( m_ui8WatchedPages[ui16Watch] ) {
+				NotifyPageWrite( ui16Watch );
+			}
 			if constexpr ( _ui8SpeedOverride == 0 ) {
-				_ui8Speed = ((*pui8Spd) >> ((m_ui8MemSel /*& 1*/) << 2)) & 0b1111;
+				_ui8Speed = haAccessor.ui8Speeds[m_ui8MemSel];
 			}
 			else {
 				_ui8Speed = _ui8SpeedOverride;
 			}
 #ifdef LSN_CPU_VERIFY
-			if ( m_vReadWriteLog.size() ) {
-				/*if ( 63529 == m_rfpAccessFuncParms.ui32FullAddress ) {
-					volatile int gjhgg = 0;
-				}*/
-				m_vReadWriteLog[m_vReadWriteLog.size()-1].ui32Address = m_rfpAccessFuncParms.ui32FullAddress;
-				m_vReadWriteLog[m_vReadWriteLog.size()-1].ui8Value = _ui8Val;
-				m_vReadWriteLog[m_vReadWriteLog.size()-1].bRead = false;
-			}
+			LogAccess( ui32FullAddress, _ui8Val, false );
 #endif	// #ifdef LSN_CPU_VERIFY
 		}
 
@@ -158,33 +206,38 @@ namespace lsn {
 		inline uint8_t								ReadBank0( uint16_t _ui16Address, uint8_t &_ui8Speed ) {
 			static_assert( _ui8SpeedOverride < 16, "_ui8SpeedOverride must fit in 4 bits." );
 
-			m_rfpAccessFuncParms.ui16Address = _ui16Address;
-			m_rfpAccessFuncParms.ui8Bank = 0;
-			m_rfpAccessFuncParms.ui32FullAddress = uint32_t( _ui16Address );
-			m_rfpAccessFuncParms.asAccessSource = _asAccessSource;
-			uint16_t ui16SpdAddr = uint16_t( _ui16Address >> 8 );
-			uint8_t * pui8Spd;
-			if constexpr ( _ui8SpeedOverride == 0 ) {
-				pui8Spd = m_ui8Speeds + ui16SpdAddr;
-				LSN_PREFETCH_LINE( pui8Spd );
+			uint8_t ui8Ret;
+			const LSN_HOT_ACCESSOR & haAccessor = m_phaBanks[0][_ui16Address>>8];
+			if LSN_LIKELY( haAccessor.ui8Flags & CMemoryMap::LSN_AF_MEMORY_READ ) {
+				ui8Ret = m_pui8Memory[haAccessor.uiMemory|uint8_t( _ui16Address )];
+				m_ui8DataBus = ui8Ret;
+			}
+			else if ( haAccessor.ui8Flags & CMemoryMap::LSN_AF_DIRECT_READ ) {
+				ui8Ret = haAccessor.pui8Direct[uint8_t( _ui16Address )];
+				m_ui8DataBus = ui8Ret;
+			}
+			else {
+				m_rfpAccessFuncParms.ui16Address = _ui16Address;
+				m_rfpAccessFuncParms.ui8Bank = 0;
+				m_rfpAccessFuncParms.ui32FullAddress = uint32_t( _ui16Address );
+				m_rfpAccessFuncParms.asAccessSource = _asAccessSource;
+				uint8_t ui8Mask = 0xFF;
+				ui8Ret = m_ui8DataBus;
+				const LSN_READER & rReader = m_vReaders[haAccessor.ui16Reader];
+				m_rfpAccessFuncParms.pvParm0 = rReader.pvParm0;
+				m_ui64ReadStable = 0;
+				rReader.pfFunc( m_rfpAccessFuncParms, ui8Ret, ui8Mask );
+				m_ui64IdleStable = std::min( m_ui64IdleStable, m_ui64ReadStable );
+				m_ui8DataBus = (m_ui8DataBus & ~ui8Mask) | (ui8Ret & ui8Mask);
 			}
-			uint8_t ui8Mask = 0xFF;
-			uint8_t ui8Ret = m_ui8DataBus;
-			auto & aaAccessor = m_aaAccessors[ui16SpdAddr];
-			aaAccessor.pfReader( m_rfpAccessFuncParms, ui8Ret, ui8Mask );
-			m_ui8DataBus = (m_ui8DataBus & ~ui8Mask) | (ui8Ret & ui8Mask);
 			if constexpr ( _ui8SpeedOverride == 0 ) {
-				_ui8Speed = ((*pui8Spd) >> ((m_ui8MemSel /*& 1*/) << 2)) & 0b1111;
+				_ui8Speed = haAccessor.ui8Speeds[m_ui8MemSel];
 			}
 			else {
 				_ui8Speed = _ui8SpeedOverride;
 			}
 #ifdef LSN_CPU_VERIFY
-			if ( m_vReadWriteLog.size() ) {
-				m_vReadWriteLog[m_vReadWriteLog.size()-1].ui32Address = m_rfpAccessFuncParms.ui32FullAddress;
-				m_vReadWriteLog[m_vReadWriteLog.size()-1].ui8Value = ui8Ret;
-				m_vReadWriteLog[m_vReadWriteLog.size()-1].bRead = true;
-			}
+			LogAccess( _ui16Address, ui8Ret, true );
 #endif	// #ifdef LSN_CPU_VERIFY
 			return ui8Ret;
 		}
@@ -200,35 +253,208 @@ namespace lsn {
 		inline void									WriteBank0( uint16_t _ui16Address, uint8_t _ui8Val, uint8_t &_ui8Speed ) {
 			static_assert( _ui8SpeedOverride < 16, "_ui8SpeedOverride must fit in 4 bits." );
 
-			m_rfpAccessFuncParms.ui16Address = _ui16Address;
-			m_rfpAccessFuncParms.ui8Bank = 0;
-			m_rfpAccessFuncParms.ui32FullAddress = uint32_t( _ui16Address );
-			m_rfpAccessFuncParms.asAccessSource = _asAccessSource;
-			uint16_t ui16SpdAddr = uint16_t( _ui16Address >> 8 );
-			uint8_t * pui8Spd;
-			if constexpr ( _ui8SpeedOverride == 0 ) {
-				pui8Spd = m_ui8Speeds + ui16SpdAddr;
-				LSN_PREFETCH_LINE( pui8Spd );
+			uint16_t ui16Watch = uint16_t( _ui16Address >> 8 );
+			const LSN_HOT_ACCESSOR & haAccessor = m_phaBanks[0][ui16Watch];
+			if LSN_LIKELY( haAccessor.ui8Flags & CMemoryMap::LSN_AF_MEMORY_WRITE ) {
+				m_pui8Memory[haAccessor.uiMemory|uint8_t( _ui16Address )] = _ui8Val;
+				ui16Watch = uint16_t( haAccessor.uiMemory >> 8 );
+			}
+			else if ( haAccessor.ui8Flags & CMemoryMap::LSN_AF_DIRECT_WRITE ) {
+				haAccessor.pui8Direct[uint8_t( _ui16Address )] = _ui8Val;
+			}
+			else {
+				m_rfpAccessFuncParms.ui16Address = _ui16Address;
+				m_rfpAccessFuncParms.ui8Bank = 0;
+				m_rfpAccessFuncParms.ui32FullAddress = uint32_t( _ui16Address );
+				m_rfpAccessFuncParms.asAccessSource = _asAccessSource;
+				const LSN_WRITER & wWriter = m_vWriters[haAccessor.ui16Writer];
+				m_rfpAccessFuncParms.pvParm0 = wWriter.pvParm0;
+				wWriter.pfFunc( m_rfpAccessFuncParms, _ui8Val );
+				ui16Watch = WatchKey( haAccessor, ui16Watch );
 			}
-			auto & aaAccessor = m_aaAccessors[ui16SpdAddr];
-			aaAccessor.pfWriter( m_rfpAccessFuncParms, _ui8Val );
 			m_ui8DataBus = _ui8Val;
+			m_ui64IdleStable = 0;
+			if LSN_UNLIKELY( m_ui8WatchedPages[ui16Watch] ) {
+				NotifyPageWrite( ui16Watch );
+			}
 			if constexpr ( _ui8SpeedOverride == 0 ) {
-				_ui8Speed = ((*pui8Spd) >> ((m_ui8MemSel /*& 1*/) << 2)) & 0b1111;
+				_ui8Speed = haAccessor.ui8Speeds[m_ui8MemSel];
 			}
 			else {
 				_ui8Speed = _ui8SpeedOverride;
 			}
 #ifdef LSN_CPU_VERIFY
-			if ( m_vReadWriteLog.size() ) {
-				/*if ( 63529 == m_rfpAccessFuncParms.ui32FullAddress ) {
-					volatile int gjhgg = 0;
-				}*/
-				m_vReadWriteLog[m_vReadWriteLog.size()-1].ui32Address = m_rfpAccessFuncParms.ui32FullAddress;
-				m_vReadWriteLog[m_vReadWriteLog.size()-1].ui8Value = _ui8Val;
-				m_vReadWriteLog[m_vReadWriteLog.size()-1].bRead = false;
+			LogAccess( _ui16Address, _ui8Val, false );
+#endif	// #ifdef LSN_CPU_VERIFY
+		}
+
+		/**
+		 * Performs a 16-bit read: the low byte from the given address, then the high byte from the next address according to _wWrap.
+		 * 
+		 * \tparam _wWrap How the address of the high byte wraps.
+		 * 
+		 * \param _ui16Address The address of the low byte.
+		 * \param _ui8Bank The bank of the low byte.
+		 * \param _ui8Speed Returns the sum of the master-clock divisors of both accesses.
+		 * \return Returns the value read.
+		 **/
+		template <LSN_WRAP _wWrap = LSN_W_LINEAR, LSN_ACCESS_SOURCE _asAccessSource = LSN_AS_CPU>
+		inline uint16_t								Read16( uint16_t _ui16Address, uint8_t _ui8Bank, uint8_t &_ui8Speed ) {
+			const uint32_t ui32FullAddress = uint32_t( _ui16Address ) | (uint32_t( _ui8Bank ) << 16);
+			const LSN_HOT_ACCESSOR & haAccessor = m_phaBanks[_ui8Bank][_ui16Address>>8];
+			if LSN_LIKELY( uint8_t( _ui16Address ) != 0xFF && (haAccessor.ui8Flags & CMemoryMap::LSN_AF_MEMORY_READ) ) {
+				// Both bytes in the same plain page.
+				const uint8_t * pui8Src = m_pui8Memory + (haAccessor.uiMemory | uint8_t( _ui16Address ));
+				uint16_t ui16Ret = uint16_t( pui8Src[0] | (pui8Src[1] << 8) );
+				m_ui8DataBus = uint8_t( ui16Ret >> 8 );
+				_ui8Speed = uint8_t( haAccessor.ui8Speeds[m_ui8MemSel] << 1 );
+#ifdef LSN_CPU_VERIFY
+				LogAccess( ui32FullAddress, uint8_t( ui16Ret ), true );
+				LogAccess( ui32FullAddress + 1, uint8_t( ui16Ret >> 8 ), true );
+#endif	// #ifdef LSN_CPU_VERIFY
+				return ui16Ret;
 			}
+			uint8_t ui8Speed0, ui8Speed1;
+			const uint32_t ui32Next = NextAddress<_wWrap>( ui32FullAddress, 1 );
+			uint16_t ui16Ret = Read<_asAccessSource>( _ui16Address, _ui8Bank, ui8Speed0 );
+			ui16Ret |= uint16_t( Read<_asAccessSource>( uint16_t( ui32Next ), uint8_t( ui32Next >> 16 ), ui8Speed1 ) << 8 );
+			_ui8Speed = uint8_t( ui8Speed0 + ui8Speed1 );
+			return ui16Ret;
+		}
+
+		/**
+		 * Performs a 16-bit write: the low byte to the given address, then the high byte to the next address according to _wWrap.
+		 * 
+		 * \tparam _wWrap How the address of the high byte wraps.
+		 * 
+		 * \param _ui16Address The address of the low byte.
+		 * \param _ui8Bank The bank of the low byte.
+		 * \param _ui16Val The value to write.
+		 * \param _ui8Speed Returns the sum of the master-clock divisors of both accesses.
+		 **/
+		template <LSN_WRAP _wWrap = LSN_W_LINEAR, LSN_ACCESS_SOURCE _asAccessSource = LSN_AS_CPU>
+		inline void									Write16( uint16_t _ui16Address, uint8_t _ui8Bank, uint16_t _ui16Val, uint8_t &_ui8Speed ) {
+			const uint32_t ui32FullAddress = uint32_t( _ui16Address ) | (uint32_t( _ui8Bank ) << 16);
+			const LSN_HOT_ACCESSOR & haAccessor = m_phaBanks[_ui8Bank][_ui16Address>>8];
+			if LSN_LIKELY( uint8_t( _ui16Address ) != 0xFF && (haAccessor.ui8Flags & CMemoryMap::LSN_AF_MEMORY_WRITE) ) {
+				uint8_t * pui8Dst = m_pui8Memory + (haAccessor.uiMemory | uint8_t( _ui16Address ));
+				pui8Dst[0] = uint8_t( _ui16Val );
+				pui8Dst[1] = uint8_t( _ui16Val >> 8 );
+				m_ui8DataBus = uint8_t( _ui16Val >> 8 );
+				m_ui64IdleStable = 0;
+				const uint16_t ui16Watch = uint16_t( haAccessor.uiMemory >> 8 );
+				if LSN_UNLIKELY( m_ui8WatchedPages[ui16Watch] ) {
+					NotifyPageWrite( ui16Watch );
+				}
+				_ui8Speed = uint8_t( haAccessor.ui8Speeds[m_ui8MemSel] << 1 );
+#ifdef LSN_CPU_VERIFY
+				LogAccess( ui32FullAddress, uint8_t( _ui16Val ), false );
+				LogAccess( ui32FullAddress + 1, uint8_t( _ui16Val >> 8 ), false );
 #endif	// #ifdef LSN_CPU_VERIFY
+				return;
+			}
+			uint8_t ui8Speed0, ui8Speed1;
+			const uint32_t ui32Next = NextAddress<_wWrap>( ui32FullAddress, 1 );
+			Write<_asAccessSource>( _ui16Address, _ui8Bank, uint8_t( _ui16Val ), ui8Speed0 );
+			Write<_asAccessSource>( uint16_t( ui32Next ), uint8_t( ui32Next >> 16 ), uint8_t( _ui16Val >> 8 ), ui8Speed1 );
+			_ui8Speed = uint8_t( ui8Speed0 + ui8Speed1 );
+		}
+
+		/**
+		 * Reads a span of bytes.  Runs of plain or direct-mapped pages are copied with memcpy(); pages with side effects are read a byte
+		 *	at a time through their readers, in order.  Timing is not reported; the caller accounts for it (DMA, for example, uses its own).
+		 * 
+		 * \tparam _wWrap How the address wraps as it advances.
+		 * 
+		 * \param _ui16Address The address of the first byte.
+		 * \param _ui8Bank The bank of the first byte.
+		 * \param _pui8Dst The buffer to which to copy the bytes.
+		 * \param _sSize The number of bytes to read.
+		 **/
+		template <LSN_WRAP _wWrap = LSN_W_LINEAR, LSN_ACCESS_SOURCE _asAccessSource = LSN_AS_DMA>
+		void										ReadSpan( uint16_t _ui16Address, uint8_t _ui8Bank, uint8_t * _pui8Dst, size_t _sSize ) {
+			uint32_t ui32FullAddress = uint32_t( _ui16Address ) | (uint32_t( _ui8Bank ) << 16);
+			while ( _sSize ) {
+				const LSN_HOT_ACCESSOR & haAccessor = Hot( uint16_t( ui32FullAddress >> 8 ) );
+				size_t sRun = SpanRun<_wWrap>( ui32FullAddress, _sSize, CMemoryMap::LSN_AF_MEMORY_READ );
+				if ( haAccessor.ui8Flags & CMemoryMap::LSN_AF_MEMORY_READ ) {
+					std::memcpy( _pui8Dst, m_pui8Memory + (haAccessor.uiMemory | uint8_t( ui32FullAddress )), sRun );
+					m_ui8DataBus = _pui8Dst[sRun-1];
+				}
+				else if ( haAccessor.ui8Flags & CMemoryMap::LSN_AF_DIRECT_READ ) {
+					std::memcpy( _pui8Dst, haAccessor.pui8Direct + uint8_t( ui32FullAddress ), sRun );
+					m_ui8DataBus = _pui8Dst[sRun-1];
+				}
+				else {
+					uint8_t ui8Speed;
+					for ( size_t I = 0; I < sRun; ++I ) {
+						_pui8Dst[I] = Read<_asAccessSource>( uint16_t( ui32FullAddress + I ), _ui8Bank, ui8Speed );
+					}
+				}
+#ifdef LSN_CPU_VERIFY
+				if ( haAccessor.ui8Flags & (CMemoryMap::LSN_AF_MEMORY_READ | CMemoryMap::LSN_AF_DIRECT_READ) ) {
+					LogSpan<_wWrap>( ui32FullAddress, _pui8Dst, sRun, true );
+				}
+#endif	// #ifdef LSN_CPU_VERIFY
+				ui32FullAddress = NextAddress<_wWrap>( ui32FullAddress, sRun );
+				_ui8Bank = uint8_t( ui32FullAddress >> 16 );
+				_pui8Dst += sRun;
+				_sSize -= sRun;
+			}
+		}
+
+		/**
+		 * Writes a span of bytes.  Runs of plain or direct-mapped pages are copied with memcpy(); pages with side effects are written a
+		 *	byte at a time through their writers, in order.  Watched pages are reported as with Write().  Timing is not reported; the
+		 *	caller accounts for it.
+		 * 
+		 * \tparam _wWrap How the address wraps as it advances.
+		 * 
+		 * \param _ui16Address The address of the first byte.
+		 * \param _ui8Bank The bank of the first byte.
+		 * \param _pui8Src The bytes to write.
+		 * \param _sSize The number of bytes to write.
+		 **/
+		template <LSN_WRAP _wWrap = LSN_W_LINEAR, LSN_ACCESS_SOURCE _asAccessSource = LSN_AS_DMA>
+		void										WriteSpan( uint16_t _ui16Address, uint8_t _ui8Bank, const uint8_t * _pui8Src, size_t _sSize ) {
+			uint32_t ui32FullAddress = uint32_t( _ui16Address ) | (uint32_t( _ui8Bank ) << 16);
+			m_ui64IdleStable = 0;
+			while ( _sSize ) {
+				const LSN_HOT_ACCESSOR & haAccessor = Hot( uint16_t( ui32FullAddress >> 8 ) );
+				size_t sRun = SpanRun<_wWrap>( ui32FullAddress, _sSize, CMemoryMap::LSN_AF_MEMORY_WRITE );
+				if ( haAccessor.ui8Flags & CMemoryMap::LSN_AF_MEMORY_WRITE ) {
+					const uintptr_t uiMemory = haAccessor.uiMemory | uint8_t( ui32FullAddress );
+					std::memcpy( m_pui8Memory + uiMemory, _pui8Src, sRun );
+					m_ui8DataBus = _pui8Src[sRun-1];
+					for ( uintptr_t uiPage = uiMemory >> 8; uiPage <= (uiMemory + sRun - 1) >> 8; ++uiPage ) {
+						if LSN_UNLIKELY( m_ui8WatchedPages[uiPage] ) {
+							NotifyPageWrite( uint16_t( uiPage ) );
+						}
+					}
+				}
+				else if ( haAccessor.ui8Flags & CMemoryMap::LSN_AF_DIRECT_WRITE ) {
+					std::memcpy( haAccessor.pui8Direct + uint8_t( ui32FullAddress ), _pui8Src, sRun );
+					m_ui8DataBus = _pui8Src[sRun-1];
+					if LSN_UNLIKELY( m_ui8WatchedPages[ui32FullAddress>>8] ) {
+						NotifyPageWrite( uint16_t( ui32FullAddress >> 8 ) );
+					}
+				}
+				else {
+					uint8_t ui8Speed;
+					for ( size_t I = 0; I < sRun; ++I ) {
+						Write<_asAccessSource>( uint16_t( ui32FullAddress + I ), _ui8Bank, _pui8Src[I], ui8Speed );
+					}
+				}
+#ifdef LSN_CPU_VERIFY
+				if ( haAccessor.ui8Flags & (CMemoryMap::LSN_AF_MEMORY_WRITE | CMemoryMap::LSN_AF_DIRECT_WRITE) ) {
+					LogSpan<_wWrap>( ui32FullAddress, _pui8Src, sRun, false );
+				}
+#endif	// #ifdef LSN_CPU_VERIFY
+				ui32FullAddress = NextAddress<_wWrap>( ui32FullAddress, sRun );
+				_ui8Bank = uint8_t( ui32FullAddress >> 16 );
+				_pui8Src += sRun;
+				_sSize -= sRun;
+			}
 		}
 
 		/**
@@ -239,191 +465,359 @@ namespace lsn {
 		inline uint8_t &							DataBus() { return m_ui8DataBus; }
 
 		/**
-		 * Sets (or unsets) the MESEL flag.
+		 * Starts watching for accesses that would make the next pass of a polling loop differ from the last: any write, and any read of a
+		 *	register whose reader does not call SetReadStableUntil().  Plain memory that is not written reads the same every time.
+		 **/
+		inline void									BeginIdleWatch() { m_ui64IdleStable = UINT64_MAX; }
+
+		/**
+		 * Gets the master cycle before which every access made since BeginIdleWatch() would return the same results if repeated.
 		 * 
-		 * \param _bSet If true the flag is set, otherwise it is not.
+		 * \return Returns the master cycle at which the first of the accesses could change, or 0 if any of them was a write or cannot be
+		 *	repeated.
 		 **/
-		inline void									SetMemSel( bool _bSet ) {
-			m_ui8MemSel = _bSet ? 1 : 0;
-		}
+		inline uint64_t								IdleStable() const { return m_ui64IdleStable; }
 
 		/**
-		 * Sets the memory pointer.
+		 * Called by a register's reader to declare that reading the register again before a given master cycle returns the same value and
+		 *	has no further side effects.  Readers that do not call it are assumed to change on every read.
 		 * 
-		 * \param _pui8Ram A pointer to the memory used by the bus.
+		 * \param _ui64Cycle The first master cycle at which the register's value could differ.
 		 **/
-		inline void									SetMemory( uint8_t * _pui8Ram ) {
-			m_pui8Memory = _pui8Ram;
-			m_rfpAccessFuncParms.pui8Data = m_pui8Memory;
+		inline void									SetReadStableUntil( uint64_t _ui64Cycle ) { m_ui64ReadStable = _ui64Cycle; }
+
+		/**
+		 * Gets the master-clock divisor for an address without accessing it.
+		 * 
+		 * \param _ui16Address The address whose speed is to be returned.
+		 * \param _ui8Bank The bank of the address whose speed is to be returned.
+		 * \return Returns the master-clock divisor that an access to the given address would use.
+		 **/
+		inline uint8_t								Speed( uint16_t _ui16Address, uint8_t _ui8Bank ) const {
+			return m_phaBanks[_ui8Bank][_ui16Address>>8].ui8Speeds[m_ui8MemSel];
 		}
 
 		/**
-		 * Sets an address speed.
+		 * Gets the master-clock divisor for an address under a given MEMSEL setting without accessing it.
 		 * 
-		 * \param _ui16Address The address within the given bank whose speed is to be set.
-		 * \param _ui8Bank The bank of the address whose speed is to be set.
-		 * \param _ui8Speed0 The speed to set for MEMSEL=0.
-		 * \param _ui8Speed1 The speed to set for MEMSEL=1.  0 means to use the same value as _ui8Speed0.
+		 * \param _ui16Address The address whose speed is to be returned.
+		 * \param _ui8Bank The bank of the address whose speed is to be returned.
+		 * \param _ui8MemSel The MEMSEL flag (0 or 1).
+		 * \return Returns the master-clock divisor that an access to the given address would use with the given MEMSEL flag.
 		 **/
-		inline void									SetRamSpeed( uint16_t _ui16Address, uint8_t _ui8Bank, uint8_t _ui8Speed0, uint8_t _ui8Speed1 = 0 ) {
-			uint16_t ui16SpdAddr = (_ui16Address >> 8) | (uint16_t( _ui8Bank ) << 8);
-			uint8_t * ui8Spd = m_ui8Speeds + ui16SpdAddr;
-			if ( 0 == _ui8Speed1 ) {
-				 _ui8Speed1 = _ui8Speed0;
-			}
+		inline uint8_t								Speed( uint16_t _ui16Address, uint8_t _ui8Bank, uint8_t _ui8MemSel ) const {
+			return m_phaBanks[_ui8Bank][_ui16Address>>8].ui8Speeds[_ui8MemSel&1];
+		}
 
-			(*ui8Spd) = ((_ui8Speed1 & 0xF) << 4) | (_ui8Speed0 & 0xF);
+		/**
+		 * Gets the state that code translated by the CPU uses to read and write bus memory in place.  Such code must only touch pages
+		 *	with LSN_AF_MEMORY_READ/LSN_AF_MEMORY_WRITE, must leave writes to watched pages to Write(), and must do everything else that
+		 *	Read() and Write() do for bus memory itself (the data bus, the speed, and clearing the idle-loop stability on writes).
+		 * 
+		 * \return Returns the addresses of the bus state used by translated code.
+		 **/
+		inline LSN_JIT_VIEW							JitView() {
+			return { m_phaBanks, &m_pui8Memory, &m_ui8DataBus, &m_ui8MemSel, m_ui8WatchedPages, &m_ui64IdleStable };
 		}
 
 		/**
-		 * Fills the address-speed table using SetRamSpeed().
-		 *
-		 * The table is per 256-byte page (address >> 8) within each bank.
-		 * Low nibble  = MEMSEL=0
-		 * High nibble = MEMSEL=1 (FastROM)
-		 *
-		 * \param _ui8FastRam The fast-RAM divisor.
-		 * \param _ui8SlowRam The slow-RAM divisor.
-		 * \param _ui8XSlowRam The DMA divisor.
-		 */
-		void										BuildSpeedTable( uint16_t _ui8FastRam = LSN_CS_NTSC_CPU_DIVISOR_FAST, uint16_t _ui8SlowRam = LSN_CS_NTSC_CPU_DIVISOR_SLOW, uint16_t _ui8XSlowRam = LSN_CS_NTSC_CPU_DIVISOR_XSLOW ) {
-			assert( _ui8FastRam < 16 );
-			assert( _ui8SlowRam < 16 );
-			assert( _ui8XSlowRam < 16 );
-
-			// Default everything to Slow for both MEMSEL states.
-			//	(FastROM only affects specific regions.)
-			for ( uint32_t ui32Bank = 0; ui32Bank < 0x100; ++ui32Bank ) {
-				for ( uint32_t ui32Page = 0; ui32Page < 0x100; ++ui32Page ) {
-					SetRamSpeed( uint16_t( ui32Page << 8 ), uint8_t( ui32Bank ), uint8_t( _ui8SlowRam ) );
-				}
-			}
+		 * Determines whether a page is plain memory (bus memory or a direct host pointer), meaning that reading it has no side effects
+		 *	and its contents can only change through writes to it or to its mirrors, all of which WatchPage() catches.
+		 * 
+		 * \param _ui16Page The page to check (the full 24-bit address divided by 256).
+		 * \return Returns true if the page is read directly from memory.
+		 **/
+		inline bool									IsPlainMemory( uint16_t _ui16Page ) const {
+			return (Hot( _ui16Page ).ui8Flags & (CMemoryMap::LSN_AF_MEMORY_READ | CMemoryMap::LSN_AF_DIRECT_READ)) != 0;
+		}
 
-			// --- Banks $00-$3F and $80-$BF: page-based map ---
-			auto DoLoHiBankGroup = [&]( uint8_t _ui8BaseBank ) {
-				for ( uint32_t ui32B = 0; ui32B < 0x40; ++ui32B ) {
-					uint8_t ui8Bank = uint8_t( _ui8BaseBank + ui32B );
+		/**
+		 * Determines whether a page is read-only memory, such as cartridge ROM: read through a direct host pointer, with writes going to
+		 *	CMemoryMap::NullWrite.  Nothing the CPU does can change what it reads there while the mapping stands.
+		 * 
+		 * \param _ui16Page The page to check (the full 24-bit address divided by 256).
+		 * \return Returns true if the page is read-only memory.
+		 **/
+		inline bool									IsReadOnlyMemory( uint16_t _ui16Page ) const {
+			const LSN_HOT_ACCESSOR & haAccessor = Hot( _ui16Page );
+			return (haAccessor.ui8Flags & (CMemoryMap::LSN_AF_DIRECT_READ | CMemoryMap::LSN_AF_DIRECT_WRITE | CMemoryMap::LSN_AF_MEMORY_WRITE)) == CMemoryMap::LSN_AF_DIRECT_READ &&
+				m_vWriters[haAccessor.ui16Writer].pfFunc == &CMemoryMap::NullWrite;
+		}
 
-					// $0000-$1FFF: Slow (WRAM mirror) (already default).
+		/**
+		 * Determines whether writes to a page go straight to memory (bus memory or a direct host pointer), meaning that when they happen
+		 *	does not matter.
+		 * 
+		 * \param _ui16Page The page to check (the full 24-bit address divided by 256).
+		 * \return Returns true if the page is written directly to memory.
+		 **/
+		inline bool									IsPlainWrite( uint16_t _ui16Page ) const {
+			return (Hot( _ui16Page ).ui8Flags & (CMemoryMap::LSN_AF_MEMORY_WRITE | CMemoryMap::LSN_AF_DIRECT_WRITE)) != 0;
+		}
 
-					// $2000-$3FFF: Fast.
-					for ( uint32_t ui32Page = 0x20; ui32Page <= 0x3F; ++ui32Page ) {
-						SetRamSpeed( uint16_t( ui32Page << 8 ), ui8Bank, uint8_t( _ui8FastRam ) );
-					}
+		/**
+		 * Performs a debug read.  No side effects: the data bus, open-bus state, and read/write log are untouched.
+		 *
+		 * \param _ui16Address The address to read.
+		 * \param _ui8Bank The bank from which to read the given address.
+		 * \return Returns the value at the given address, or the current data-bus value if the address has no debug reader.
+		 **/
+		inline uint8_t								DebugRead( uint16_t _ui16Address, uint8_t _ui8Bank ) const {
+			LSN_ACCESSFUNCPARMS rfpParms = m_rfpAccessFuncParms;
+			rfpParms.ui16Address = _ui16Address;
+			rfpParms.ui8Bank = _ui8Bank;
+			rfpParms.ui32FullAddress = uint32_t( _ui16Address ) | (uint32_t( _ui8Bank ) << 16);
+			const uint16_t ui16Page = uint16_t( rfpParms.ui32FullAddress >> 8 );
+			uint8_t ui8Ret = m_ui8DataBus;
+			const LSN_HOT_ACCESSOR & haAccessor = Hot( ui16Page );
+			if ( haAccessor.ui8Flags & CMemoryMap::LSN_AF_MEMORY_READ ) {
+				return m_pui8Memory[haAccessor.uiMemory|uint8_t( _ui16Address )];
+			}
+			if ( haAccessor.ui8Flags & CMemoryMap::LSN_AF_DIRECT_READ ) {
+				return haAccessor.pui8Direct[uint8_t( _ui16Address )];
+			}
+			const LSN_COLD_ACCESSOR & caAccessor = m_pcaBanks[_ui8Bank][_ui16Address>>8];
+			if ( caAccessor.pfDebugReader ) {
+				rfpParms.pvParm0 = m_vReaders[haAccessor.ui16Reader].pvParm0;
+				caAccessor.pfDebugReader( rfpParms, ui8Ret );
+			}
+			return ui8Ret;
+		}
 
-					// $4000-$41FF: DMA/XSLOW.
-					SetRamSpeed( 0x4000, ui8Bank, uint8_t( _ui8XSlowRam ) );	// page 0x40
-					SetRamSpeed( 0x4100, ui8Bank, uint8_t( _ui8XSlowRam ) );	// page 0x41
+		/**
+		 * Gets the value last driven onto the data bus, which is what open-bus reads return.
+		 *
+		 * \return Returns the data-bus value.
+		 **/
+		inline uint8_t								DataBus() const { return m_ui8DataBus; }
 
-					// $4200-$5FFF: Fast.
-					for ( uint32_t ui32Page = 0x42; ui32Page <= 0x5F; ++ui32Page ) {
-						SetRamSpeed( uint16_t( ui32Page << 8 ), ui8Bank, uint8_t( _ui8FastRam ) );
-					}
+		/**
+		 * Drives a value onto the data bus without an access.  Used by code that fetches bytes it already knows, such as the operands
+		 *	compiled into CAotCompiler blocks.
+		 *
+		 * \param _ui8Val The value last read or written.
+		 **/
+		inline void									SetDataBus( uint8_t _ui8Val ) { m_ui8DataBus = _ui8Val; }
 
-					// $6000-$7FFF: Slow (already default).
+		/**
+		 * Sets the function to be called the next time a watched page is written or remapped.  Used by the CPU to invalidate instructions
+		 *	it has decoded from that page.
+		 * 
+		 * \param _pfFunc The function to call, or nullptr.
+		 * \param _pvParm The parameter to pass to _pfFunc.
+		 **/
+		inline void									SetPageWriteNotify( PfPageWriteNotify _pfFunc, void * _pvParm ) {
+			m_pfPageWriteNotify = _pfFunc;
+			m_pvPageWriteNotifyParm = _pvParm;
+		}
 
-					// $8000-$FFFF:
-					// - banks $00-$3F: Slow (default)
-					// - banks $80-$BF: FastROM dependent.
-					if ( _ui8BaseBank == 0x80 ) {
-						for ( uint32_t ui32Page = 0x80; ui32Page <= 0xFF; ++ui32Page ) {
-							SetRamSpeed( uint16_t( ui32Page << 8 ), ui8Bank, uint8_t( _ui8SlowRam ), uint8_t( _ui8FastRam ) );
-						}
-					}
+		/**
+		 * Watches a page.  The next write to any address in the page or in any of its mirrors (or a change to its accessor) calls the
+		 *	function set by SetPageWriteNotify() once with _ui16Page, after which the page is no longer watched.
+		 * 
+		 * \param _ui16Page The page to watch (the full 24-bit address divided by 256).
+		 **/
+		inline void									WatchPage( uint16_t _ui16Page ) {
+			// Watches are kept by the memory behind the page, so that a write through any mirror finds them.
+			const uint16_t ui16Key = WatchKey( Hot( _ui16Page ), _ui16Page );
+			m_ui8WatchedPages[ui16Key] |= LSN_WF_NOTIFY;
+			if LSN_UNLIKELY( ui16Key != _ui16Page ) {
+				for ( const auto & wmMirror : m_vWatchedMirrors ) {
+					if ( wmMirror.ui16Page == _ui16Page && wmMirror.ui16Key == ui16Key ) { return; }
 				}
-			};
+				m_vWatchedMirrors.push_back( { ui16Key, _ui16Page } );
+			}
+		}
 
-			DoLoHiBankGroup( 0x00 );
-			DoLoHiBankGroup( 0x80 );
+		/**
+		 * Enables or disables dirty-page tracking.  While enabled, the first write to a clean page (or a change to its accessor) marks it
+		 *	in a bitmap and later writes to it cost nothing extra until the bitmap is taken with TakeDirtyPages().  Pages are kept the way
+		 *	watches are: RAM and SRAM under the page of bus memory behind them (so that every mirror marks the same page), and everything
+		 *	else under its own page.  Enabling clears the bitmap.
+		 * 
+		 * \param _bEnable If true, dirty pages are tracked.
+		 **/
+		void										SetDirtyTracking( bool _bEnable ) {
+			m_bTrackDirty = _bEnable;
+			std::memset( m_ui64DirtyPages, 0, sizeof( m_ui64DirtyPages ) );
+			for ( size_t I = 0; I < std::size( m_ui8WatchedPages ); ++I ) {
+				m_ui8WatchedPages[I] = uint8_t( _bEnable ? (m_ui8WatchedPages[I] | LSN_WF_DIRTY) : (m_ui8WatchedPages[I] & ~LSN_WF_DIRTY) );
+			}
+		}
 
-			// --- Banks $40-$7D: all Slow (already default). ---
+		/**
+		 * Determines whether dirty-page tracking is enabled.
+		 * 
+		 * \return Returns true if SetDirtyTracking( true ) was called.
+		 **/
+		inline bool									IsDirtyTracking() const { return m_bTrackDirty; }
 
-			// --- Banks $7E-$7F (WRAM): all Slow (already default). ---
+		/**
+		 * Determines whether a page has been written since the bitmap was last taken.
+		 * 
+		 * \param _ui16Page The page: a page of bus memory for RAM and SRAM, otherwise the full 24-bit address divided by 256.
+		 * \return Returns true if the page is dirty.
+		 **/
+		inline bool									IsPageDirty( uint16_t _ui16Page ) const {
+			return (m_ui64DirtyPages[_ui16Page>>6] >> (_ui16Page & 63)) & 1;
+		}
 
-			// --- Banks $C0-$FF: entire bank is FastROM dependent. ---
-			for ( uint32_t ui32Bank = 0xC0; ui32Bank <= 0xFF; ++ui32Bank ) {
-				for ( uint32_t ui32Page = 0x00; ui32Page <= 0xFF; ++ui32Page ) {
-					SetRamSpeed( uint16_t( ui32Page << 8 ), uint8_t( ui32Bank ), uint8_t( _ui8SlowRam ), uint8_t( _ui8FastRam ) );
+		/**
+		 * Copies the dirty-page bitmap out and clears it in the same step, so no write falls between the query and the clear.  Bit
+		 *	(P & 63) of word (P >> 6) is set for each dirty page P (see IsPageDirty()).  The pages become clean and are tracked again.
+		 * 
+		 * \param _pui64Dst The buffer to receive the bitmap (1,024 words), or nullptr to only clear it.
+		 * \return Returns the number of dirty pages.
+		 **/
+		size_t										TakeDirtyPages( uint64_t * _pui64Dst = nullptr ) {
+			size_t sTotal = 0;
+			for ( size_t I = 0; I < std::size( m_ui64DirtyPages ); ++I ) {
+				uint64_t ui64Bits = m_ui64DirtyPages[I];
+				if ( _pui64Dst ) { _pui64Dst[I] = ui64Bits; }
+				if ( !ui64Bits ) { continue; }
+				m_ui64DirtyPages[I] = 0;
+				while ( ui64Bits ) {
+					const size_t sBit = size_t( std::countr_zero( ui64Bits ) );
+					ui64Bits &= ui64Bits - 1;
+					m_ui8WatchedPages[(I<<6)|sBit] |= LSN_WF_DIRTY;
+					++sTotal;
 				}
 			}
+			return sTotal;
 		}
 
 		/**
-		 * Sets a set of accessor functions for a given chunk of addresses.
+		 * Sets (or unsets) the MESEL flag.
 		 * 
-		 * \param _ui16Chunk The chunk whose function pointers etc. are to be set.  Each chunk is 256 bytes long, and can be indexed via the full 24-bit address divided by 256.
-		 * \param _pfReadFunc The function for reading the assigned address range.
-		 * \param _pvReadParm The readers first parameter.
-		 * \param _pfWriteFunc The function for writing the assigned address range.
-		 * \param _pvWriteParm The writers first parameter.
-		 * \param _pfDebugReadFunc The debug function for reading the assigned address range.
-		 * \param _pfDebugWriteFunc The debug function for writing the assigned address range.
+		 * \param _bSet If true the flag is set, otherwise it is not.
 		 **/
-		void										SetAccessor( uint16_t _ui16Chunk, PfReadFunc _pfReadFunc, void * _pvReadParm,
-			PfWriteFunc _pfWriteFunc, void * _pvWriteParm,
-			PfDebugReadFunc _pfDebugReadFunc, PfDebugWriteFunc _pfDebugWriteFunc ) {
-			LSN_ADDR_ACCESSOR & aaAccessMe = m_aaAccessors[_ui16Chunk];
-			aaAccessMe.pfReader = _pfReadFunc;
-			aaAccessMe.pvReaderParm0 = _pvReadParm;
-			aaAccessMe.pfWriter = _pfWriteFunc;
-			aaAccessMe.pvWriterParm0 = _pvWriteParm;
-			aaAccessMe.pfDebugReader = _pfDebugReadFunc;
-			aaAccessMe.pfDebugWriter = _pfDebugWriteFunc;
+		inline void									SetMemSel( bool _bSet ) {
+			m_ui8MemSel = _bSet ? 1 : 0;
+		}
+
+		/**
+		 * Sets the memory pointer.
+		 * 
+		 * \param _pui8Ram A pointer to the memory used by the bus.
+		 **/
+		inline void									SetMemory( uint8_t * _pui8Ram ) {
+			m_pui8Memory = _pui8Ram;
+			m_rfpAccessFuncParms.pui8Data = m_pui8Memory;
+			NotifyAllWatchedPages();
 		}
 
 		/**
-		 * Applies a basic direct-access mapping to the memory.
+		 * Sets the shared memory map, discarding every per-bus override.
+		 * 
+		 * \param _pmmMap The memory map to use.  Must not be nullptr.
 		 **/
-		void										ApplyBasicMapping() {
-#ifdef LSN_CPU_VERIFY
-			m_vReadWriteLog.clear();
-#endif	// #ifdef LSN_CPU_VERIFY
-			for ( size_t I = 0; I < 0x1000000; I += 0x100 ) {
-				SetAccessor( uint16_t( I >> 8 ), &CBusA::StdRead, nullptr, &CBusA::StdWrite, nullptr,
-					&CBusA::StdDebugRead, &CBusA::StdDebugWrite );
+		void										SetMemoryMap( std::shared_ptr<const CMemoryMap> _pmmMap ) {
+			assert( _pmmMap );
+			m_pmmMap = std::move( _pmmMap );
+			for ( size_t I = 0; I < std::size( m_pboOverlays ); ++I ) {
+				m_pboOverlays[I].reset();
+				m_phaBanks[I] = m_pmmMap->HotBank( uint8_t( I ) );
+				m_pcaBanks[I] = m_pmmMap->ColdBank( uint8_t( I ) );
 			}
+			m_vReaders = m_pmmMap->Readers();
+			m_vWriters = m_pmmMap->Writers();
+			NotifyAllWatchedPages();
 		}
 
 		/**
-		 * A default read function.
+		 * Sets the first parameter of every reader using a given function and every writer using a given function.  This lets a shared
+		 *	memory map route pages to objects that belong to this bus alone (such as its Bus B), with no overlay.  Must be called again
+		 *	after SetMemoryMap().
 		 * 
-		 * \param _rfpParms A reference to all of the parameters to be passed to this function.
-		 * \param _ui8Ret Holds the return value.
-		 * \param _ui8OpenMask Holds a mask for the return value.
+		 * \param _pfReadFunc The reader function whose parameter is to be set.
+		 * \param _pfWriteFunc The writer function whose parameter is to be set.
+		 * \param _pvParm The parameter to pass to both functions.
 		 **/
-		static void LSN_FASTCALL					StdRead( const LSN_ACCESSFUNCPARMS &_rfpParms, uint8_t &_ui8Ret, uint8_t &_ui8OpenMask ) {
-			static_cast<void>(_ui8OpenMask);
-			_ui8Ret = _rfpParms.pui8Data[_rfpParms.ui32FullAddress];
+		void										BindParm( PfReadFunc _pfReadFunc, PfWriteFunc _pfWriteFunc, void * _pvParm ) {
+			for ( auto & rReader : m_vReaders ) {
+				if ( rReader.pfFunc == _pfReadFunc ) { rReader.pvParm0 = _pvParm; }
+			}
+			for ( auto & wWriter : m_vWriters ) {
+				if ( wWriter.pfFunc == _pfWriteFunc ) { wWriter.pvParm0 = _pvParm; }
+			}
 		}
 
 		/**
-		 * A default write function.
+		 * Gets the shared memory map.
+		 * 
+		 * \return Returns the shared memory map, without any of this bus's overrides.
+		 **/
+		inline const std::shared_ptr<const CMemoryMap> &
+													MemoryMap() const { return m_pmmMap; }
+
+		/**
+		 * Gets the number of banks this bus has copied out of the shared memory map in order to override them.
 		 * 
-		 * \param _rfpParms A reference to all of the parameters to be passed to this function.
-		 * \param _ui8Val The value to write to the target address.
+		 * \return Returns the number of overridden banks.
 		 **/
-		static void LSN_FASTCALL					StdWrite( const LSN_ACCESSFUNCPARMS &_rfpParms, uint8_t _ui8Val ) {
-			_rfpParms.pui8Data[_rfpParms.ui32FullAddress] = _ui8Val;
+		inline size_t								OverriddenBanks() const {
+			size_t sRet = 0;
+			for ( size_t I = 0; I < std::size( m_pboOverlays ); ++I ) {
+				if ( m_pboOverlays[I] ) { ++sRet; }
+			}
+			return sRet;
 		}
 
 		/**
-		 * A default debug read function.
+		 * Sets an address speed.
 		 * 
-		 * \param _rfpParms A reference to all of the parameters to be passed to this function.
-		 * \param _ui8Ret Holds the return value.
+		 * \param _ui16Address The address within the given bank whose speed is to be set.
+		 * \param _ui8Bank The bank of the address whose speed is to be set.
+		 * \param _ui8Speed0 The speed to set for MEMSEL=0.
+		 * \param _ui8Speed1 The speed to set for MEMSEL=1.  0 means to use the same value as _ui8Speed0.
 		 **/
-		static void LSN_FASTCALL					StdDebugRead( const LSN_ACCESSFUNCPARMS &_rfpParms, uint8_t &_ui8Ret ) {
-			_ui8Ret = _rfpParms.pui8Data[_rfpParms.ui32FullAddress];
+		inline void									SetRamSpeed( uint16_t _ui16Address, uint8_t _ui8Bank, uint8_t _ui8Speed0, uint8_t _ui8Speed1 = 0 ) {
+			CMemoryMap::SetSpeeds( Overlay( _ui8Bank ).haHot[_ui16Address>>8], _ui8Speed0, _ui8Speed1 );
 		}
 
 		/**
-		 * A default debug write function.
+		 * Sets a set of accessor functions for a given chunk of addresses.
+		 * 
+		 * \param _ui16Chunk The chunk whose function pointers etc. are to be set.  Each chunk is 256 bytes long, and can be indexed via the full 24-bit address divided by 256.
+		 * \param _pfReadFunc The function for reading the assigned address range.
+		 * \param _pvReadParm The readers� first parameter.
+		 * \param _pfWriteFunc The function for writing the assigned address range.
+		 * \param _pvWriteParm The writers� first parameter.
+		 * \param _pfDebugReadFunc The debug function for reading the assigned address range.
+		 * \param _pfDebugWriteFunc The debug function for writing the assigned address range.
+		 **/
+		void										SetAccessor( uint16_t _ui16Chunk, PfReadFunc _pfReadFunc, void * _pvReadParm,
+			PfWriteFunc _pfWriteFunc, void * _pvWriteParm,
+			PfDebugReadFunc _pfDebugReadFunc, PfDebugWriteFunc _pfDebugWriteFunc ) {
+			NotifyRemap( _ui16Chunk );
+			LSN_BANK_OVERLAY & boOverlay = Overlay( uint8_t( _ui16Chunk >> 8 ) );
+			CMemoryMap::SetAccessor( boOverlay.haHot[uint8_t( _ui16Chunk )], boOverlay.caCold[uint8_t( _ui16Chunk )], m_vReaders, m_vWriters,
+				uint32_t( _ui16Chunk ) << 8, _pfReadFunc, _pvReadParm, _pfWriteFunc, _pvWriteParm, _pfDebugReadFunc, _pfDebugWriteFunc );
+		}
+
+		/**
+		 * Gives a chunk a direct host pointer, so that CPU and DMA reads and/or writes access host memory without calling its accessor
+		 *	functions.  Only for memory with no side effects and no open-bus bits.  Any later SetAccessor() on the chunk replaces the
+		 *	pointer, as does a nullptr here.
 		 * 
-		 * \param _rfpParms A reference to all of the parameters to be passed to this function.
-		 * \param _ui8Val The value to write to the target address.
+		 * \param _ui16Chunk The chunk whose pointer is to be set.  Each chunk is 256 bytes long, and can be indexed via the full 24-bit address divided by 256.
+		 * \param _pui8Data The chunk's 256 bytes in host memory.
+		 * \param _bRead If true, reads use _pui8Data instead of calling the chunk's reader.
+		 * \param _bWrite If true, writes use _pui8Data instead of calling the chunk's writer.
+		 **/
+		void										SetDirectAccess( uint16_t _ui16Chunk, uint8_t * _pui8Data, bool _bRead, bool _bWrite ) {
+			NotifyRemap( _ui16Chunk );
+			CMemoryMap::SetDirectAccess( Overlay( uint8_t( _ui16Chunk >> 8 ) ).haHot[uint8_t( _ui16Chunk )], uint32_t( _ui16Chunk ) << 8, _pui8Data, _bRead, _bWrite );
+		}
+
+		/**
+		 * Applies the basic mapping to the memory: every per-bus override is discarded, returning each page to the shared memory map.
 		 **/
-		static void LSN_FASTCALL					StdDebugWrite( const LSN_ACCESSFUNCPARMS &_rfpParms, uint8_t _ui8Val ) {
-			_rfpParms.pui8Data[_rfpParms.ui32FullAddress] = _ui8Val;
+		void										ApplyBasicMapping() {
+#ifdef LSN_CPU_VERIFY
+			m_vReadWriteLog.clear();
+#endif	// #ifdef LSN_CPU_VERIFY
+			SetMemoryMap( m_pmmMap );
 		}
 
 #ifdef LSN_CPU_VERIFY
@@ -443,39 +837,548 @@ namespace lsn {
 		 * \return Returns a constant reference to the read/write log.
 		 */
 		 std::vector<LSN_READ_WRITE_LOG> &			ReadWriteLog() { return m_vReadWriteLog; }
+
+		/**
+		 * Sets whether each access adds its own entry to the read/write log instead of filling in the last one.  Used to log the
+		 *	engines that do not go through the cycle loop.
+		 *
+		 * \param _bLogEveryAccess If true, every access is appended to the log.
+		 */
+		void										SetLogEveryAccess( bool _bLogEveryAccess ) { m_bLogEveryAccess = _bLogEveryAccess; }
+
+		/**
+		 * Logs an access that translated code made to bus memory without going through Read() or Write().
+		 *
+		 * \param _ui32Address The address accessed.
+		 * \param _ui8Value The value read or written.
+		 * \param _bRead True for a read.
+		 */
+		void										LogDirectAccess( uint32_t _ui32Address, uint8_t _ui8Value, bool _bRead ) { LogAccess( _ui32Address, _ui8Value, _bRead ); }
+
+		/**
+		 * Times CPU reads and writes over a fixed mix: 3 reads to each write, at pseudo-random addresses in banks $00, $80, $7E, and $C0, with
+		 *	MEMSEL toggled before each pass.  The writes land in whatever is mapped, so the memory is not preserved.
+		 *
+		 * \param _ui32Passes The number of passes over the 65,536 addresses.
+		 * \return Returns the average time per access in nanoseconds.
+		 */
+		double										BenchAccesses( uint32_t _ui32Passes ) {
+			static const uint8_t ui8Banks[] = { 0x00, 0x80, 0x7E, 0xC0 };
+			std::vector<uint32_t> vAddr( 0x10000 );
+			uint32_t ui32Seed = 1;
+			for ( auto & ui32Addr : vAddr ) {
+				ui32Seed = ui32Seed * 1103515245 + 12345;
+				ui32Addr = (uint32_t( ui8Banks[(ui32Seed>>8)&3] ) << 16) | ((ui32Seed >> 12) & 0xFFFF);
+			}
+			m_vReadWriteLog.clear();
+			const uint8_t ui8MemSel = m_ui8MemSel;
+			uint64_t ui64Sum = 0;
+			uint8_t ui8Speed;
+
+			CTimer tTimer;
+			tTimer.Start();
+			for ( uint32_t P = 0; P < _ui32Passes; ++P ) {
+				SetMemSel( (P & 1) != 0 );
+				for ( size_t I = 0; I < vAddr.size(); ++I ) {
+					if ( I & 3 ) { ui64Sum += Read( uint16_t( vAddr[I] ), uint8_t( vAddr[I] >> 16 ), ui8Speed ); }
+					else { Write( uint16_t( vAddr[I] ), uint8_t( vAddr[I] >> 16 ), uint8_t( I ), ui8Speed ); }
+					ui64Sum += ui8Speed;
+				}
+			}
+			tTimer.Stop();
+			m_ui8MemSel = ui8MemSel;
+			// Keeps the reads from being optimized away.
+			volatile uint64_t ui64Sink = ui64Sum;
+			static_cast<void>(ui64Sink);
+			return tTimer.ElapsedNanoseconds() / (double( _ui32Passes ) * double( vAddr.size() ));
+		}
+
+		/**
+		 * Checks Read16(), Write16(), ReadSpan(), and WriteSpan() against the byte-by-byte Read() and Write() calls they stand for, in
+		 *	each wrap mode: the values, the speeds, the data bus, the memory written, and the read/write log.  The addresses cover the
+		 *	middle and the end of a page, the end of a bank and of the address space, and the seams between plain memory, a page with
+		 *	its own accessor, and a page with a direct pointer.  The bus must have memory (SetMemory()), whose contents are not preserved,
+		 *	and every per-bus override (including BindParm() bindings) is discarded.
+		 *
+		 * \return Returns true if every check passes.
+		 */
+		bool										RunWideAccessTest() {
+			static const uint32_t ui32Addresses[] = {
+				0x7E1234, 0x7E12FF,													// Plain memory, within and at the end of a page.
+				0x7E1FFF, 0x7E2080, 0x7E20FF,										// Into, within, and out of a page with its own accessor.
+				0x7E2FFF, 0x7E30FF,													// Into and out of a page with a direct pointer.
+				0x7EFFFF, 0x7FFFFF, 0xFFFFFF,										// The ends of banks (the $7F:FF page has its own accessor) and of the address space.
+			};
+			const bool bLogEveryAccess = m_bLogEveryAccess;
+			std::shared_ptr<const CMemoryMap> pmmMap = m_pmmMap;
+			uint8_t ui8Direct[256] = {};
+			SetMemoryMap( CMemoryMap::Basic() );
+			for ( uint16_t ui16Page : { uint16_t( 0x7E20 ), uint16_t( 0x7FFF ) } ) {
+				SetAccessor( ui16Page, &CMemoryMap::StdRead, this, &CMemoryMap::StdWrite, this,
+					&CMemoryMap::StdDebugRead, &CMemoryMap::StdDebugWrite );
+			}
+			SetDirectAccess( 0x7E30, ui8Direct, true, true );
+			SetLogEveryAccess( true );
+
+			bool bRet = true;
+			for ( uint32_t ui32Address : ui32Addresses ) {
+				bRet = WideAccessCase<LSN_W_LINEAR>( ui32Address ) && bRet;
+				bRet = WideAccessCase<LSN_W_BANK>( ui32Address ) && bRet;
+				bRet = WideAccessCase<LSN_W_PAGE>( ui32Address ) && bRet;
+			}
+
+			m_vReadWriteLog.clear();
+			SetLogEveryAccess( bLogEveryAccess );
+			SetMemoryMap( pmmMap );
+			return bRet;
+		}
+
+		/**
+		 * Checks dirty-page tracking: writes through a WRAM mirror, to a page with a direct pointer, to a page with its own accessor,
+		 *	and through Write16() and WriteSpan() mark exactly the pages expected; TakeDirtyPages() clears the bitmap and tracks the pages
+		 *	again; and disabling tracking leaves no page watched for it.  The bus must have memory (SetMemory()), whose contents are not
+		 *	preserved, and every per-bus override (including BindParm() bindings) and the dirty-page bitmap are discarded.
+		 *
+		 * \return Returns true if every check passes.
+		 */
+		bool										RunDirtyPageTest() {
+			const bool bTrackDirty = m_bTrackDirty;
+			std::shared_ptr<const CMemoryMap> pmmMap = m_pmmMap;
+			{
+				// The first 8 kibibytes of banks $00 and $80 mirror WRAM at $7E:0000.
+				std::shared_ptr<CMemoryMap> pmmMirrored = std::make_shared<CMemoryMap>();
+				for ( uint32_t I = 0; I < 0x20; ++I ) {
+					pmmMirrored->SetMemoryMirror( uint16_t( 0x0000 | I ), 0x7E0000 | (I << 8) );
+					pmmMirrored->SetMemoryMirror( uint16_t( 0x8000 | I ), 0x7E0000 | (I << 8) );
+				}
+				SetMemoryMap( pmmMirrored );
+			}
+			uint8_t ui8Direct[256] = {};
+			SetDirectAccess( 0x0050, ui8Direct, true, true );
+			SetAccessor( 0x0021, &CMemoryMap::StdRead, this, &CMemoryMap::StdWrite, this,
+				&CMemoryMap::StdDebugRead, &CMemoryMap::StdDebugWrite );
+			SetDirtyTracking( true );
+
+			bool bRet = true;
+			uint64_t ui64Bits[std::size( m_ui64DirtyPages )];
+			// Takes the bitmap and checks that exactly the given pages are in it.
+			auto Expect = [&]( std::initializer_list<uint16_t> _ilPages, const char * _pcName ) {
+				const size_t sTotal = TakeDirtyPages( ui64Bits );
+				bool bMatch = sTotal == _ilPages.size();
+				for ( uint16_t ui16Page : _ilPages ) {
+					bMatch = ((ui64Bits[ui16Page>>6] >> (ui16Page & 63)) & 1) && bMatch;
+				}
+				for ( size_t I = 0; I < std::size( m_ui64DirtyPages ); ++I ) {
+					bMatch = m_ui64DirtyPages[I] == 0 && bMatch;
+				}
+				if ( !bMatch ) {
+					DebugA( "Dirty pages: " );
+					DebugA( _pcName );
+					DebugA( "\r\n" );
+					bRet = false;
+				}
+			};
+			uint8_t ui8Speed;
+			const uint8_t ui8Span[0x300] = {};
+
+			Expect( {}, "enabling did not start clean." );
+			Write( 0x1234, 0x00, 0x11, ui8Speed );
+			Expect( { 0x7E12 }, "a write through the $00 mirror did not mark the WRAM page." );
+			// Taking the bitmap tracks the page again.
+			Write( 0x1234, 0x80, 0x22, ui8Speed );
+			Write( 0x1256, 0x7E, 0x33, ui8Speed );
+			Write( 0x1300, 0x7E, 0x44, ui8Speed );
+			Expect( { 0x7E12, 0x7E13 }, "writes through the $80 mirror and to WRAM after a take." );
+			Expect( {}, "pages stayed dirty after a take." );
+			Write16( 0x1234, 0x00, 0x5566, ui8Speed );
+			Expect( { 0x7E12 }, "Write16() within a mirrored page." );
+			Write16( 0x12FF, 0x00, 0x7788, ui8Speed );
+			Expect( { 0x7E12, 0x7E13 }, "Write16() across mirrored pages." );
+			Write( 0x5010, 0x00, 0x99, ui8Speed );
+			Write( 0x2100, 0x00, 0xAA, ui8Speed );
+			Expect( { 0x0050, 0x0021 }, "writes to a direct page and to a page with its own accessor." );
+			WriteSpan( 0x1F80, 0x00, ui8Span, 0x100 );
+			Expect( { 0x7E1F, 0x0020 }, "WriteSpan() out of the mirror." );
+			WriteSpan( 0x20F0, 0x00, ui8Span, 0x20 );
+			WriteSpan( 0x4FF0, 0x00, ui8Span, 0x20 );
+			Expect( { 0x0020, 0x0021, 0x004F, 0x0050 }, "WriteSpan() into a page with its own accessor and a direct page." );
+			WriteSpan( 0x0000, 0x7F, ui8Span, 0x300 );
+			Expect( { 0x7F00, 0x7F01, 0x7F02 }, "WriteSpan() over plain pages." );
+
+			// Disabling clears the bitmap and unwatches every page.
+			Write( 0x1234, 0x00, 0xBB, ui8Speed );
+			SetDirtyTracking( false );
+			bool bWatched = false;
+			for ( size_t I = 0; I < std::size( m_ui8WatchedPages ); ++I ) {
+				bWatched = bWatched || (m_ui8WatchedPages[I] & LSN_WF_DIRTY);
+			}
+			if ( IsDirtyTracking() || IsPageDirty( 0x7E12 ) || bWatched ) {
+				DebugA( "Dirty pages: disabling left pages dirty or watched.\r\n" );
+				bRet = false;
+			}
+			Write( 0x1234, 0x00, 0xCC, ui8Speed );
+			WriteSpan( 0x4FF0, 0x00, ui8Span, 0x20 );
+			Expect( {}, "pages were marked with tracking disabled." );
+			SetDirtyTracking( true );
+			Write( 0x1234, 0x00, 0xDD, ui8Speed );
+			Expect( { 0x7E12 }, "re-enabling did not track." );
+
+			SetDirtyTracking( bTrackDirty );
+			SetMemoryMap( pmmMap );
+			return bRet;
+		}
 #endif	// #ifdef LSN_CPU_VERIFY
 
 
 	protected :
 		// == Types.
-		/** Per-page information. */
-		struct LSN_ADDR_ACCESSOR {
-			PfReadFunc								pfReader;							/**< The function for reading the assigned address range. */
-			void *									pvReaderParm0;						/**< The readers first parameter. */
-			PfWriteFunc								pfWriter;							/**< The function for writing the assigned address range. */
-			void *									pvWriterParm0;						/**< The writers first parameter. */
-			PfDebugReadFunc							pfDebugReader;						/**< The debug function for reading the assigned address range. */
-			PfDebugWriteFunc						pfDebugWriter;						/**< The debug function for writing the assigned address range. */
-			//uint32_t								ui32ReaderParm1;					/**< The reader's second parameter. */
-			//uint32_t								ui32WriterParm1;					/**< The writer's second parameter. */
+		/** Per-page information used only by debug accesses. */
+		typedef CMemoryMap::LSN_COLD_ACCESSOR		LSN_COLD_ACCESSOR;
+
+		/** A reader and its first parameter. */
+		typedef CMemoryMap::LSN_READER				LSN_READER;
+
+		/** A writer and its first parameter. */
+		typedef CMemoryMap::LSN_WRITER				LSN_WRITER;
+
+		/** A bank copied out of the shared memory map so that it can be overridden. 8 kibibytes on x64. */
+		struct LSN_BANK_OVERLAY {
+			LSN_HOT_ACCESSOR						haHot[256];							/**< The bank's hot accessors. */
+			LSN_COLD_ACCESSOR						caCold[256];						/**< The bank's cold accessors. */
+		};
+
+		/** A watched page whose watch is kept under the page of the memory behind it. */
+		struct LSN_WATCHED_MIRROR {
+			uint16_t								ui16Key;							/**< The page under which the watch is kept. */
+			uint16_t								ui16Page;							/**< The page passed to WatchPage(). */
 		};
 
 
 		// == Members.
-		uint8_t										m_ui8Speeds[0x10000];				/**< The speed table. 64 kibibytes. */
-		LSN_ADDR_ACCESSOR							m_aaAccessors[0x1000000>>8];		/**< An accessor per logical page. 3.0 mebibytes on x64, 1.5 on x86. */
+		const LSN_HOT_ACCESSOR *					m_phaBanks[256];					/**< The hot accessors of each bank, either in the shared map or in m_pboOverlays. */
+		const LSN_COLD_ACCESSOR *					m_pcaBanks[256];					/**< The cold accessors of each bank, either in the shared map or in m_pboOverlays. */
+		std::unique_ptr<LSN_BANK_OVERLAY>			m_pboOverlays[256];					/**< The banks this bus overrides.  Only the overridden banks are allocated. */
+		std::shared_ptr<const CMemoryMap>			m_pmmMap;							/**< The shared memory map. */
+		std::vector<LSN_READER>						m_vReaders;							/**< Every unique reader/parameter pair, indexed by LSN_HOT_ACCESSOR::ui16Reader.  Starts as a copy of the map's. */
+		std::vector<LSN_WRITER>						m_vWriters;							/**< Every unique writer/parameter pair, indexed by LSN_HOT_ACCESSOR::ui16Writer.  Starts as a copy of the map's. */
 		uint8_t *									m_pui8Memory = nullptr;				/**< A pointer to the RAM memory. 8/4 bytes */
 		LSN_ACCESSFUNCPARMS							m_rfpAccessFuncParms;				/**< Parameters to pass to read/write functions. */
 		uint8_t										m_ui8DataBus = 0;					/**< The data-bus value. 1 byte. */
-		uint8_t										m_ui8MemSel = 0;					/**< The MEMSEL flag. */
+		uint8_t										m_ui8MemSel = 0;					/**< The MEMSEL flag (0 or 1), used directly as the index into LSN_HOT_ACCESSOR::ui8Speeds. */
+		uint8_t										m_ui8WatchedPages[0x10000] = {};	/**< LSN_WATCH_FLAGS for each page whose next write must be caught, indexed by WatchKey(). 64 kibibytes. */
+		uint64_t									m_ui64DirtyPages[0x10000/64] = {};	/**< 1 bit per page written since the last TakeDirtyPages(), indexed by WatchKey(). 8 kibibytes. */
+		bool										m_bTrackDirty = false;				/**< Whether clean pages are watched with LSN_WF_DIRTY. */
+		uint64_t									m_ui64IdleStable = 0;				/**< See IdleStable(). */
+		uint64_t									m_ui64ReadStable = 0;				/**< Set by the current register reader through SetReadStableUntil(). */
+		std::vector<LSN_WATCHED_MIRROR>				m_vWatchedMirrors;					/**< Watched pages whose memory is watched under another page. */
+		PfPageWriteNotify							m_pfPageWriteNotify = nullptr;		/**< Called when a watched page is written. */
+		void *										m_pvPageWriteNotifyParm = nullptr;	/**< The parameter passed to m_pfPageWriteNotify. */
 
 #ifdef LSN_CPU_VERIFY
 		std::vector<LSN_READ_WRITE_LOG>				m_vReadWriteLog;
+		bool										m_bLogEveryAccess = false;
 #endif	// #ifdef LSN_CPU_VERIFY
 
 
 		// == Functions.
-		
+		/**
+		 * Gets the hot accessor of a page.
+		 * 
+		 * \param _ui16Page The page (the full 24-bit address divided by 256).
+		 * \return Returns the page's hot accessor.
+		 **/
+		inline const LSN_HOT_ACCESSOR &				Hot( uint16_t _ui16Page ) const {
+			return m_phaBanks[_ui16Page>>8][uint8_t( _ui16Page )];
+		}
+
+#ifdef LSN_CPU_VERIFY
+		/**
+		 * Logs an access: appends an entry to the read/write log if SetLogEveryAccess( true ) was called, otherwise fills in the last one.
+		 * 
+		 * \param _ui32Address The address accessed.
+		 * \param _ui8Value The value read or written.
+		 * \param _bRead True for a read.
+		 **/
+		inline void									LogAccess( uint32_t _ui32Address, uint8_t _ui8Value, bool _bRead ) {
+			if ( m_bLogEveryAccess ) { m_vReadWriteLog.emplace_back(); }
+			if ( m_vReadWriteLog.size() ) {
+				m_vReadWriteLog[m_vReadWriteLog.size()-1].ui32Address = _ui32Address;
+				m_vReadWriteLog[m_vReadWriteLog.size()-1].ui8Value = _ui8Value;
+				m_vReadWriteLog[m_vReadWriteLog.size()-1].bRead = _bRead;
+			}
+		}
+
+		/**
+		 * Logs each byte of a run copied by ReadSpan() or WriteSpan() as the byte-by-byte accesses would have.
+		 * 
+		 * \tparam _wWrap How the address wraps.
+		 * 
+		 * \param _ui32FullAddress The full 24-bit address of the first byte.
+		 * \param _pui8Values The bytes read or written.
+		 * \param _sSize The number of bytes.
+		 * \param _bRead True for a read.
+		 **/
+		template <LSN_WRAP _wWrap>
+		inline void									LogSpan( uint32_t _ui32FullAddress, const uint8_t * _pui8Values, size_t _sSize, bool _bRead ) {
+			for ( size_t I = 0; I < _sSize; ++I ) {
+				LogAccess( NextAddress<_wWrap>( _ui32FullAddress, I ), _pui8Values[I], _bRead );
+			}
+		}
+#endif	// #ifdef LSN_CPU_VERIFY
+
+		/**
+		 * Advances an address according to a wrap mode.
+		 * 
+		 * \tparam _wWrap How the address wraps.
+		 * 
+		 * \param _ui32FullAddress The full 24-bit address.
+		 * \param _sBytes The number of bytes by which to advance.  For LSN_W_PAGE, must not carry out of the page more than once.
+		 * \return Returns the advanced address.
+		 **/
+		template <LSN_WRAP _wWrap>
+		static inline uint32_t						NextAddress( uint32_t _ui32FullAddress, size_t _sBytes ) {
+			if constexpr ( _wWrap == LSN_W_LINEAR ) {
+				return uint32_t( _ui32FullAddress + _sBytes ) & 0xFFFFFF;
+			}
+			else if constexpr ( _wWrap == LSN_W_BANK ) {
+				return (_ui32FullAddress & 0xFF0000) | uint16_t( _ui32FullAddress + _sBytes );
+			}
+			else {
+				return (_ui32FullAddress & 0xFFFF00) | uint8_t( _ui32FullAddress + _sBytes );
+			}
+		}
+
+		/**
+		 * Gets the number of bytes from an address that a span access can handle in one step: the rest of the page, extended over the
+		 *	following pages while both the address space and the bus memory behind it are contiguous and the pages have _ui8Flag.
+		 * 
+		 * \tparam _wWrap How the address wraps.
+		 * 
+		 * \param _ui32FullAddress The full 24-bit address of the first byte.
+		 * \param _sSize The number of bytes left in the span.
+		 * \param _ui8Flag LSN_AF_MEMORY_READ or LSN_AF_MEMORY_WRITE.
+		 * \return Returns the number of bytes in the run.
+		 **/
+		template <LSN_WRAP _wWrap>
+		inline size_t								SpanRun( uint32_t _ui32FullAddress, size_t _sSize, uint8_t _ui8Flag ) const {
+			size_t sRun = std::min<size_t>( _sSize, 0x100 - (_ui32FullAddress & 0xFF) );
+			if constexpr ( _wWrap != LSN_W_PAGE ) {
+				const LSN_HOT_ACCESSOR & haFirst = Hot( uint16_t( _ui32FullAddress >> 8 ) );
+				if ( haFirst.ui8Flags & _ui8Flag ) {
+					uint32_t ui32End = uint32_t( _ui32FullAddress + sRun );
+					uintptr_t uiMemoryEnd = (haFirst.uiMemory | uint8_t( _ui32FullAddress )) + sRun;
+					while ( sRun < _sSize && ui32End < 0x1000000 && (_wWrap == LSN_W_LINEAR || (ui32End & 0xFFFF)) ) {
+						const LSN_HOT_ACCESSOR & haNext = Hot( uint16_t( ui32End >> 8 ) );
+						if ( !(haNext.ui8Flags & _ui8Flag) || haNext.uiMemory != uiMemoryEnd ) { break; }
+						size_t sAdd = std::min<size_t>( _sSize - sRun, 0x100 );
+						sRun += sAdd;
+						ui32End += uint32_t( sAdd );
+						uiMemoryEnd += sAdd;
+					}
+				}
+			}
+			return sRun;
+		}
+
+#ifdef LSN_CPU_VERIFY
+		/**
+		 * One address of RunWideAccessTest(): compares each wide access starting there with the byte accesses it stands for.
+		 * 
+		 * \tparam _wWrap How the address wraps.
+		 * 
+		 * \param _ui32FullAddress The full 24-bit address of the first byte.
+		 * \return Returns true if every check passes.
+		 **/
+		template <LSN_WRAP _wWrap>
+		bool										WideAccessCase( uint32_t _ui32FullAddress ) {
+			// The byte addresses, worked out here rather than with NextAddress() so that both are checked.
+			uint32_t ui32Seq[0x181];
+			ui32Seq[0] = _ui32FullAddress;
+			for ( size_t I = 1; I < std::size( ui32Seq ); ++I ) {
+				const uint32_t ui32Prev = ui32Seq[I-1];
+				switch ( _wWrap ) {
+					case LSN_W_LINEAR : { ui32Seq[I] = (ui32Prev + 1) & 0xFFFFFF; break; }
+					case LSN_W_BANK : { ui32Seq[I] = (ui32Prev & 0xFF0000) | ((ui32Prev + 1) & 0xFFFF); break; }
+					default : { ui32Seq[I] = (ui32Prev & 0xFFFF00) | ((ui32Prev + 1) & 0xFF); }
+				}
+			}
+			const uint16_t ui16Address = uint16_t( _ui32FullAddress );
+			const uint8_t ui8Bank = uint8_t( _ui32FullAddress >> 16 );
+			uint8_t ui8Speed, ui8Speed0, ui8Speed1;
+			auto Fill = [&]() {
+				for ( size_t I = 0; I < std::size( ui32Seq ); ++I ) {
+					Write( uint16_t( ui32Seq[I] ), uint8_t( ui32Seq[I] >> 16 ), uint8_t( ui32Seq[I] * 7 + (ui32Seq[I] >> 8) + (ui32Seq[I] >> 16) * 29 ), ui8Speed );
+				}
+				m_ui8DataBus = 0;
+				m_vReadWriteLog.clear();
+			};
+			auto Take = [&]( std::vector<LSN_READ_WRITE_LOG> &_vLog, std::vector<uint8_t> &_vMemory ) {
+				_vLog.swap( m_vReadWriteLog );
+				m_vReadWriteLog.clear();
+				_vMemory.resize( std::size( ui32Seq ) + 1 );
+				for ( size_t I = 0; I < std::size( ui32Seq ); ++I ) {
+					_vMemory[I] = DebugRead( uint16_t( ui32Seq[I] ), uint8_t( ui32Seq[I] >> 16 ) );
+				}
+				_vMemory[std::size( ui32Seq )] = m_ui8DataBus;
+			};
+			auto SameLog = []( const std::vector<LSN_READ_WRITE_LOG> &_vA, const std::vector<LSN_READ_WRITE_LOG> &_vB ) {
+				if ( _vA.size() != _vB.size() ) { return false; }
+				for ( size_t I = 0; I < _vA.size(); ++I ) {
+					if ( _vA[I].ui32Address != _vB[I].ui32Address || _vA[I].ui8Value != _vB[I].ui8Value || _vA[I].bRead != _vB[I].bRead ) { return false; }
+				}
+				return true;
+			};
+			bool bRet = true;
+			auto Check = [&]( bool _bCond, const char * _pcName ) {
+				if ( !_bCond ) {
+					char szBuffer[128];
+					std::snprintf( szBuffer, std::size( szBuffer ), "Wide access at $%.2X:%.4X (wrap %u): %s\r\n", ui8Bank, ui16Address, uint32_t( _wWrap ), _pcName );
+					DebugA( szBuffer );
+					bRet = false;
+				}
+			};
+			std::vector<LSN_READ_WRITE_LOG> vLogWide, vLogBytes;
+			std::vector<uint8_t> vMemWide, vMemBytes;
+
+			// == Read16().
+			Fill();
+			const uint16_t ui16Wide = Read16<_wWrap>( ui16Address, ui8Bank, ui8Speed );
+			Take( vLogWide, vMemWide );
+			uint16_t ui16Bytes = Read( uint16_t( ui32Seq[0] ), uint8_t( ui32Seq[0] >> 16 ), ui8Speed0 );
+			ui16Bytes |= uint16_t( Read( uint16_t( ui32Seq[1] ), uint8_t( ui32Seq[1] >> 16 ), ui8Speed1 ) << 8 );
+			Take( vLogBytes, vMemBytes );
+			Check( ui16Wide == ui16Bytes, "Read16() value." );
+			Check( ui8Speed == uint8_t( ui8Speed0 + ui8Speed1 ), "Read16() speed." );
+			Check( vMemWide == vMemBytes, "Read16() data bus." );
+			Check( SameLog( vLogWide, vLogBytes ), "Read16() log." );
+
+			// == Write16().
+			Fill();
+			Write16<_wWrap>( ui16Address, ui8Bank, 0xA55A, ui8Speed );
+			const uint8_t ui8WideSpeed = ui8Speed;
+			Take( vLogWide, vMemWide );
+			Fill();
+			Write( uint16_t( ui32Seq[0] ), uint8_t( ui32Seq[0] >> 16 ), 0x5A, ui8Speed0 );
+			Write( uint16_t( ui32Seq[1] ), uint8_t( ui32Seq[1] >> 16 ), 0xA5, ui8Speed1 );
+			Take( vLogBytes, vMemBytes );
+			Check( vMemBytes[0] == 0x5A && vMemBytes[1] == 0xA5, "Write() did not write." );
+			Check( ui8WideSpeed == uint8_t( ui8Speed0 + ui8Speed1 ), "Write16() speed." );
+			Check( vMemWide == vMemBytes, "Write16() memory or data bus." );
+			Check( SameLog( vLogWide, vLogBytes ), "Write16() log." );
+
+			// == ReadSpan() (long enough to wrap a page twice).
+			uint8_t ui8Span[std::size( ui32Seq )];
+			Fill();
+			ReadSpan<_wWrap>( ui16Address, ui8Bank, ui8Span, std::size( ui8Span ) );
+			Take( vLogWide, vMemWide );
+			bool bSame = true;
+			for ( size_t I = 0; I < std::size( ui8Span ); ++I ) {
+				bSame = Read<LSN_AS_DMA>( uint16_t( ui32Seq[I] ), uint8_t( ui32Seq[I] >> 16 ), ui8Speed ) == ui8Span[I] && bSame;
+			}
+			Take( vLogBytes, vMemBytes );
+			Check( bSame, "ReadSpan() values." );
+			Check( vMemWide == vMemBytes, "ReadSpan() data bus." );
+			Check( SameLog( vLogWide, vLogBytes ), "ReadSpan() log." );
+
+			// == WriteSpan().
+			for ( size_t I = 0; I < std::size( ui8Span ); ++I ) {
+				ui8Span[I] = uint8_t( I * 13 + 5 );
+			}
+			Fill();
+			WriteSpan<_wWrap>( ui16Address, ui8Bank, ui8Span, std::size( ui8Span ) );
+			Take( vLogWide, vMemWide );
+			Fill();
+			for ( size_t I = 0; I < std::size( ui8Span ); ++I ) {
+				Write<LSN_AS_DMA>( uint16_t( ui32Seq[I] ), uint8_t( ui32Seq[I] >> 16 ), ui8Span[I], ui8Speed );
+			}
+			Take( vLogBytes, vMemBytes );
+			Check( vMemWide == vMemBytes, "WriteSpan() memory or data bus." );
+			Check( SameLog( vLogWide, vLogBytes ), "WriteSpan() log." );
+			return bRet;
+		}
+#endif	// #ifdef LSN_CPU_VERIFY
+
+		/**
+		 * Gets the overlay of a bank, copying the bank out of the shared memory map the first time it is overridden.
+		 * 
+		 * \param _ui8Bank The bank to override.
+		 * \return Returns the bank's overlay.
+		 **/
+		LSN_BANK_OVERLAY &							Overlay( uint8_t _ui8Bank ) {
+			std::unique_ptr<LSN_BANK_OVERLAY> & pboOverlay = m_pboOverlays[_ui8Bank];
+			if LSN_UNLIKELY( !pboOverlay ) {
+				pboOverlay = std::make_unique<LSN_BANK_OVERLAY>();
+				std::copy( m_phaBanks[_ui8Bank], m_phaBanks[_ui8Bank] + 256, pboOverlay->haHot );
+				std::copy( m_pcaBanks[_ui8Bank], m_pcaBanks[_ui8Bank] + 256, pboOverlay->caCold );
+				m_phaBanks[_ui8Bank] = pboOverlay->haHot;
+				m_pcaBanks[_ui8Bank] = pboOverlay->caCold;
+			}
+			return (*pboOverlay);
+		}
+
+		/**
+		 * Gets the page under which writes to a page are watched: the page of the bus memory behind it, or the page itself if it is not
+		 *	backed by bus memory.
+		 * 
+		 * \param _haAccessor The page's hot accessor.
+		 * \param _ui16Page The page.
+		 * \return Returns the page under which to watch _ui16Page.
+		 **/
+		static inline uint16_t						WatchKey( const LSN_HOT_ACCESSOR &_haAccessor, uint16_t _ui16Page ) {
+			return (_haAccessor.ui8Flags & (CMemoryMap::LSN_AF_MEMORY_READ | CMemoryMap::LSN_AF_MEMORY_WRITE)) ? uint16_t( _haAccessor.uiMemory >> 8 ) : _ui16Page;
+		}
+
+		/**
+		 * Reports a page as written if it is watched, before its accessor changes.
+		 * 
+		 * \param _ui16Page The page about to be remapped.
+		 **/
+		inline void									NotifyRemap( uint16_t _ui16Page ) {
+			const uint16_t ui16Key = WatchKey( Hot( _ui16Page ), _ui16Page );
+			if ( m_ui8WatchedPages[ui16Key] ) {
+				NotifyPageWrite( ui16Key );
+			}
+		}
+
+		/**
+		 * Reports every watched page as written.  Used when all pages may have changed.
+		 **/
+		void										NotifyAllWatchedPages() {
+			for ( size_t I = 0; I < std::size( m_ui8WatchedPages ); ++I ) {
+				if ( m_ui8WatchedPages[I] ) {
+					NotifyPageWrite( uint16_t( I ) );
+				}
+			}
+		}
+
+		/**
+		 * Stops watching a page and reports that it has been written: marks it dirty and/or calls m_pfPageWriteNotify.
+		 * 
+		 * \param _ui16Page The page that was written.
+		 **/
+		inline void									NotifyPageWrite( uint16_t _ui16Page ) {
+			const uint8_t ui8Flags = m_ui8WatchedPages[_ui16Page];
+			m_ui8WatchedPages[_ui16Page] = 0;
+			if ( ui8Flags & LSN_WF_DIRTY ) {
+				m_ui64DirtyPages[_ui16Page>>6] |= 1ULL << (_ui16Page & 63);
+			}
+			if ( !(ui8Flags & LSN_WF_NOTIFY) ) { return; }
+			if ( m_pfPageWriteNotify ) {
+				m_pfPageWriteNotify( m_pvPageWriteNotifyParm, _ui16Page );
+			}
+			if LSN_UNLIKELY( !m_vWatchedMirrors.empty() ) {
+				for ( size_t I = m_vWatchedMirrors.size(); I--; ) {
+					if ( m_vWatchedMirrors[I].ui16Key == _ui16Page ) {
+						const uint16_t ui16Mirror = m_vWatchedMirrors[I].ui16Page;
+						m_vWatchedMirrors[I] = m_vWatchedMirrors.back();
+						m_vWatchedMirrors.pop_back();
+						if ( m_pfPageWriteNotify ) {
+							m_pfPageWriteNotify( m_pvPageWriteNotifyParm, ui16Mirror );
+						}
+					}
+				}
+			}
+		}
 
 	};
 
@@ -0,0 +1,272 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: The Bus B implementation.
+ */
+
+#pragma once
+
+#include "../LSNBirdSNES.h"
+#include "../Foundation/LSNMacros.h"
+#include "LSNBusA.h"
+#include "LSNMemoryMap.h"
+
+#include <cstdint>
+
+
+namespace lsn {
+
+	/**
+	 * Class CBusB
+	 * \brief The Bus B implementation.
+	 *
+	 * Description: The Bus B implementation.  Bus B has 256 registers ($2100-$21FF from Bus A) owned by the PPU, the APU ports, and the
+	 *	WRAM port.  Each register has its own handlers, so an access is a single indexed call.  Registers nobody has claimed read as open
+	 *	bus and ignore writes.
+	 * The CPU reaches Bus B through one Bus A reader/writer pair (see ApplyMapping() and Attach()), and DMA reaches it directly through
+	 *	Read(), Write(), and WriteSpan().
+	 */
+	class CBusB {
+	public :
+		CBusB() {
+			ResetRegisters();
+		}
+
+
+		// == Types.
+		/** A register-reading function. */
+		typedef void (LSN_FASTCALL *				PfReadFunc)( void * _pvParm0, uint8_t _ui8Reg, uint8_t &_ui8Ret, uint8_t &_ui8OpenMask );
+
+		/** A register-writing function. */
+		typedef void (LSN_FASTCALL *				PfWriteFunc)( void * _pvParm0, uint8_t _ui8Reg, uint8_t _ui8Val );
+
+		/** A register-reading function with no side effects. */
+		typedef void (LSN_FASTCALL *				PfDebugReadFunc)( void * _pvParm0, uint8_t _ui8Reg, uint8_t &_ui8Ret );
+
+		/** A function that writes a block of bytes to a register group in one call: byte I goes to _ui8Reg + _pui8Pattern[I%_ui8PatternLen]. */
+		typedef void (LSN_FASTCALL *				PfWriteSpanFunc)( void * _pvParm0, uint8_t _ui8Reg, const uint8_t * _pui8Src, size_t _sSize,
+			const uint8_t * _pui8Pattern, uint8_t _ui8PatternLen );
+
+		/** A register's handlers. */
+		struct LSN_REGISTER {
+			PfReadFunc								pfRead;								/**< The function for reading the register. */
+			PfWriteFunc								pfWrite;							/**< The function for writing the register. */
+			PfDebugReadFunc							pfDebugRead;						/**< The function for reading the register without side effects, or nullptr. */
+			PfWriteSpanFunc							pfWriteSpan;						/**< The function for writing a block to the register, or nullptr. */
+			void *									pvParm0;							/**< The first parameter passed to each function. */
+		};
+
+
+		// == Functions.
+		/**
+		 * Reads a register.
+		 *
+		 * \param _ui8Reg The register to read (the low byte of $21xx).
+		 * \param _ui8OpenBus The value floating on the bus, which supplies any bits the register does not drive.
+		 * \return Returns the value read.
+		 **/
+		inline uint8_t								Read( uint8_t _ui8Reg, uint8_t _ui8OpenBus ) {
+			const LSN_REGISTER & rRegister = m_rRegisters[_ui8Reg];
+			uint8_t ui8Ret = _ui8OpenBus;
+			uint8_t ui8Mask = 0xFF;
+			rRegister.pfRead( rRegister.pvParm0, _ui8Reg, ui8Ret, ui8Mask );
+			return uint8_t( (_ui8OpenBus & ~ui8Mask) | (ui8Ret & ui8Mask) );
+		}
+
+		/**
+		 * Writes a register.
+		 *
+		 * \param _ui8Reg The register to write (the low byte of $21xx).
+		 * \param _ui8Val The value to write.
+		 **/
+		inline void									Write( uint8_t _ui8Reg, uint8_t _ui8Val ) {
+			const LSN_REGISTER & rRegister = m_rRegisters[_ui8Reg];
+			rRegister.pfWrite( rRegister.pvParm0, _ui8Reg, _ui8Val );
+		}
+
+		/**
+		 * Writes a block of bytes to a group of registers, as DMA does: byte I goes to _ui8Reg + _pui8Pattern[I%_ui8PatternLen].  If
+		 *	every register in the group shares a span writer (VRAM, CGRAM, and OAM data ports, for example), the whole block is handed
+		 *	to it in one call; otherwise the bytes are written 1 at a time, in order.
+		 *
+		 * \param _ui8Reg The first register of the group (the low byte of $21xx).
+		 * \param _pui8Src The bytes to write.
+		 * \param _sSize The number of bytes to write.
+		 * \param _pui8Pattern The offset from _ui8Reg of each register in the group, in the order they are written.
+		 * \param _ui8PatternLen The number of entries in _pui8Pattern.  Must not be 0.
+		 **/
+		inline void									WriteSpan( uint8_t _ui8Reg, const uint8_t * _pui8Src, size_t _sSize, const uint8_t * _pui8Pattern, uint8_t _ui8PatternLen ) {
+			const LSN_REGISTER & rRegister = m_rRegisters[_ui8Reg];
+			if ( rRegister.pfWriteSpan ) {
+				bool bShared = true;
+				for ( uint8_t I = 1; I < _ui8PatternLen; ++I ) {
+					const LSN_REGISTER & rOther = m_rRegisters[uint8_t( _ui8Reg + _pui8Pattern[I] )];
+					if ( rOther.pfWriteSpan != rRegister.pfWriteSpan || rOther.pvParm0 != rRegister.pvParm0 ) {
+						bShared = false;
+						break;
+					}
+				}
+				if ( bShared ) {
+					rRegister.pfWriteSpan( rRegister.pvParm0, _ui8Reg, _pui8Src, _sSize, _pui8Pattern, _ui8PatternLen );
+					return;
+				}
+			}
+			for ( size_t I = 0, J = 0; I < _sSize; ++I ) {
+				Write( uint8_t( _ui8Reg + _pui8Pattern[J] ), _pui8Src[I] );
+				if ( ++J == _ui8PatternLen ) { J = 0; }
+			}
+		}
+
+		/**
+		 * Reads a register without side effects.
+		 *
+		 * \param _ui8Reg The register to read (the low byte of $21xx).
+		 * \param _ui8OpenBus The value returned if the register has no debug reader.
+		 * \return Returns the value read.
+		 **/
+		inline uint8_t								DebugRead( uint8_t _ui8Reg, uint8_t _ui8OpenBus ) const {
+			const LSN_REGISTER & rRegister = m_rRegisters[_ui8Reg];
+			uint8_t ui8Ret = _ui8OpenBus;
+			if ( rRegister.pfDebugRead ) {
+				rRegister.pfDebugRead( rRegister.pvParm0, _ui8Reg, ui8Ret );
+			}
+			return ui8Ret;
+		}
+
+		/**
+		 * Sets a register's handlers.
+		 *
+		 * \param _ui8Reg The register (the low byte of $21xx).
+		 * \param _pfRead The function for reading the register, or nullptr for open bus.
+		 * \param _pfWrite The function for writing the register, or nullptr to ignore writes.
+		 * \param _pfDebugRead The function for reading the register without side effects, or nullptr.
+		 * \param _pvParm0 The first parameter passed to each function.
+		 * \param _pfWriteSpan The function for writing a block to the register (see WriteSpan()), or nullptr.
+		 **/
+		void										SetRegister( uint8_t _ui8Reg, PfReadFunc _pfRead, PfWriteFunc _pfWrite, PfDebugReadFunc _pfDebugRead,
+			void * _pvParm0, PfWriteSpanFunc _pfWriteSpan = nullptr ) {
+			LSN_REGISTER & rRegister = m_rRegisters[_ui8Reg];
+			rRegister.pfRead = _pfRead ? _pfRead : &CBusB::OpenBusRead;
+			rRegister.pfWrite = _pfWrite ? _pfWrite : &CBusB::NullWrite;
+			rRegister.pfDebugRead = _pfDebugRead;
+			rRegister.pfWriteSpan = _pfWriteSpan;
+			rRegister.pvParm0 = _pvParm0;
+		}
+
+		/**
+		 * Sets every register to open bus.
+		 **/
+		void										ResetRegisters() {
+			for ( size_t I = 0; I < std::size( m_rRegisters ); ++I ) {
+				SetRegister( uint8_t( I ), nullptr, nullptr, nullptr, nullptr );
+			}
+		}
+
+		/**
+		 * Routes $2100-$21FF in banks $00-$3F and $80-$BF of a memory map to Bus B.  The map stays shareable: each Bus A that uses it
+		 *	must then be attached to its own Bus B with Attach().
+		 *
+		 * \param _mmMap The memory map to modify.
+		 **/
+		static void									ApplyMapping( CMemoryMap &_mmMap ) {
+			for ( uint32_t ui32Bank = 0; ui32Bank < 0x100; ++ui32Bank ) {
+				if ( (ui32Bank & 0x7F) >= 0x40 ) { continue; }
+				_mmMap.SetAccessor( uint16_t( (ui32Bank << 8) | 0x21 ), &CBusB::BusARead, nullptr, &CBusB::BusAWrite, nullptr,
+					&CBusB::BusADebugRead, nullptr );
+			}
+		}
+
+		/**
+		 * Attaches this Bus B to a Bus A whose memory map was set up by ApplyMapping().  Must be called again after the Bus A's memory
+		 *	map changes.
+		 *
+		 * \param _baBus The Bus A through which the CPU reaches this Bus B.
+		 **/
+		void										Attach( CBusA &_baBus ) {
+			_baBus.BindParm( &CBusB::BusARead, &CBusB::BusAWrite, this );
+		}
+
+
+	protected :
+		// == Members.
+		LSN_REGISTER								m_rRegisters[256];					/**< The handlers for each register. */
+
+
+		// == Functions.
+		/**
+		 * Reads a register that nothing drives.
+		 *
+		 * \param _pvParm0 Unused.
+		 * \param _ui8Reg Unused.
+		 * \param _ui8Ret Unused.
+		 * \param _ui8OpenMask Set to 0 so that every bit comes from the open bus.
+		 **/
+		static void LSN_FASTCALL					OpenBusRead( void * _pvParm0, uint8_t _ui8Reg, uint8_t &_ui8Ret, uint8_t &_ui8OpenMask ) {
+			static_cast<void>(_pvParm0);
+			static_cast<void>(_ui8Reg);
+			static_cast<void>(_ui8Ret);
+			_ui8OpenMask = 0;
+		}
+
+		/**
+		 * Writes a register that nothing listens to.
+		 *
+		 * \param _pvParm0 Unused.
+		 * \param _ui8Reg Unused.
+		 * \param _ui8Val Unused.
+		 **/
+		static void LSN_FASTCALL					NullWrite( void * _pvParm0, uint8_t _ui8Reg, uint8_t _ui8Val ) {
+			static_cast<void>(_pvParm0);
+			static_cast<void>(_ui8Reg);
+			static_cast<void>(_ui8Val);
+		}
+
+		/**
+		 * The Bus A reader for $21xx.  Forwards to the register's reader.
+		 *
+		 * \param _rfpParms The read parameters.  pvParm0 points to the CBusB, or is nullptr if none has been attached.
+		 * \param _ui8Ret Holds the read value on return.
+		 * \param _ui8OpenMask Holds the mask of bits driven by the register on return.
+		 **/
+		static void LSN_FASTCALL					BusARead( const CMemoryMap::LSN_ACCESSFUNCPARMS &_rfpParms, uint8_t &_ui8Ret, uint8_t &_ui8OpenMask ) {
+			CBusB * pbbThis = static_cast<CBusB *>(_rfpParms.pvParm0);
+			if LSN_UNLIKELY( !pbbThis ) {
+				_ui8OpenMask = 0;
+				return;
+			}
+			const uint8_t ui8Reg = uint8_t( _rfpParms.ui16Address );
+			const LSN_REGISTER & rRegister = pbbThis->m_rRegisters[ui8Reg];
+			rRegister.pfRead( rRegister.pvParm0, ui8Reg, _ui8Ret, _ui8OpenMask );
+		}
+
+		/**
+		 * The Bus A writer for $21xx.  Forwards to the register's writer.
+		 *
+		 * \param _rfpParms The write parameters.  pvParm0 points to the CBusB, or is nullptr if none has been attached.
+		 * \param _ui8Val The value to write.
+		 **/
+		static void LSN_FASTCALL					BusAWrite( const CMemoryMap::LSN_ACCESSFUNCPARMS &_rfpParms, uint8_t _ui8Val ) {
+			CBusB * pbbThis = static_cast<CBusB *>(_rfpParms.pvParm0);
+			if LSN_UNLIKELY( !pbbThis ) { return; }
+			const uint8_t ui8Reg = uint8_t( _rfpParms.ui16Address );
+			const LSN_REGISTER & rRegister = pbbThis->m_rRegisters[ui8Reg];
+			rRegister.pfWrite( rRegister.pvParm0, ui8Reg, _ui8Val );
+		}
+
+		/**
+		 * The Bus A debug reader for $21xx.  Forwards to the register's debug reader.
+		 *
+		 * \param _rfpParms The read parameters.  pvParm0 points to the CBusB, or is nullptr if none has been attached.
+		 * \param _ui8Ret Holds the read value on return.
+		 **/
+		static void LSN_FASTCALL					BusADebugRead( const CMemoryMap::LSN_ACCESSFUNCPARMS &_rfpParms, uint8_t &_ui8Ret ) {
+			const CBusB * pbbThis = static_cast<const CBusB *>(_rfpParms.pvParm0);
+			if ( pbbThis ) {
+				_ui8Ret = pbbThis->DebugRead( uint8_t( _rfpParms.ui16Address ), _ui8Ret );
+			}
+		}
+	};
+
+}	// namespace lsn
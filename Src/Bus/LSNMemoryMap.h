@@ -0,0 +1,476 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: A memory map (per-page accessors and speeds) that can be shared by any number of Bus A instances.
+ */
+
+#pragma once
+
+#include "../LSNBirdSNES.h"
+#include "../Foundation/LSNMacros.h"
+
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+
+namespace lsn {
+
+	/**
+	 * Class CMemoryMap
+	 * \brief A memory map (per-page accessors and speeds) that can be shared by any number of Bus A instances.
+	 *
+	 * Description: A memory map (per-page accessors and speeds) that can be shared by any number of Bus A instances.  A map is built once
+	 *	per board/cartridge configuration and then handed out as std::shared_ptr<const CMemoryMap>, after which it never changes.  Pages
+	 *	backed by plain bus memory are marked LSN_AF_MEMORY_READ/LSN_AF_MEMORY_WRITE and hold an offset rather than a pointer into any one
+	 *	instance's RAM, so each bus resolves them against its own memory.  Mirrors (of WRAM, SRAM, etc.) are pages whose offset is not their
+	 *	own address.  Per-instance changes (cheats, patches, debug hooks) go into the bus's overlay.
+	 */
+	class CMemoryMap {
+	public :
+		CMemoryMap() {
+			m_vReaders.push_back( { &CMemoryMap::StdRead, nullptr } );
+			m_vWriters.push_back( { &CMemoryMap::StdWrite, nullptr } );
+			BuildSpeedTable();
+			ApplyBasicMapping();
+		}
+
+
+		// == Enumerations.
+		/** Special accessor IDs. */
+		enum LSN_ACCESSOR_IDS : uint16_t {
+			LSN_STD_ACCESSOR						= 0,								/**< StdRead()/StdWrite() with no parameter, always at index 0 of the reader and writer tables. */
+		};
+
+		/** Flags in LSN_HOT_ACCESSOR::ui8Flags. */
+		enum LSN_ACCESSOR_FLAGS : uint8_t {
+			LSN_AF_DIRECT_READ						= (1 << 0),							/**< Reads use pui8Direct. */
+			LSN_AF_DIRECT_WRITE						= (1 << 1),							/**< Writes use pui8Direct. */
+			LSN_AF_MEMORY_READ						= (1 << 2),							/**< Reads use the bus's own memory at uiMemory. */
+			LSN_AF_MEMORY_WRITE						= (1 << 3),							/**< Writes use the bus's own memory at uiMemory. */
+		};
+
+
+		// == Types.
+		/** Reader parameters. */
+		struct LSN_ACCESSFUNCPARMS {
+			void *									pvParm0;							/**< The user-supplied pointer to pass back to this function. */
+			uint32_t								ui32FullAddress;					/**< The full address being accessed. */
+			uint8_t *								pui8Data;							/**< A pointer to the default bus memory. */
+			LSN_ACCESS_SOURCE						asAccessSource;						/**< The source of the memory access (CPU vs DMA). */
+			uint16_t								ui16Address;						/**< The 16-bit address being accessed. */
+			uint8_t									ui8Bank;							/**< The bank being accessed. */
+		};
+
+		/** An address-reading function. */
+		typedef void (LSN_FASTCALL *				PfReadFunc)( const LSN_ACCESSFUNCPARMS &_rfpParms, uint8_t &_ui8Ret, uint8_t &_ui8OpenMask );
+
+		/** An address-writing function. */
+		typedef void (LSN_FASTCALL *				PfWriteFunc)( const LSN_ACCESSFUNCPARMS &_rfpParms, uint8_t _ui8Val );
+
+		/** A debug address-reading function. */
+		typedef void (LSN_FASTCALL *				PfDebugReadFunc)( const LSN_ACCESSFUNCPARMS &_rfpParms, uint8_t &_ui8Ret );
+
+		/** A debug address-writing function. */
+		typedef void (LSN_FASTCALL *				PfDebugWriteFunc)( const LSN_ACCESSFUNCPARMS &_rfpParms, uint8_t _ui8Val );
+
+		/** Per-page information used by every access.  16 bytes, so 4 to a cache line. */
+		LSN_ALIGN_STRUCT( 16 )
+		struct LSN_HOT_ACCESSOR {
+			union {
+				uint8_t *							pui8Direct = nullptr;				/**< With LSN_AF_DIRECT_READ/LSN_AF_DIRECT_WRITE, the page's 256 bytes in host memory. */
+				uintptr_t							uiMemory;							/**< With LSN_AF_MEMORY_READ/LSN_AF_MEMORY_WRITE, the offset of the page's 256 bytes in the bus's memory. */
+			};
+			uint16_t								ui16Reader = LSN_STD_ACCESSOR;		/**< The index of the page's reader in the reader table. */
+			uint16_t								ui16Writer = LSN_STD_ACCESSOR;		/**< The index of the page's writer in the writer table. */
+			uint8_t									ui8Speeds[2] = {};					/**< The master-clock divisor for MEMSEL=0 and MEMSEL=1, indexed by the MEMSEL flag. */
+			uint8_t									ui8Flags = 0;						/**< LSN_ACCESSOR_FLAGS. */
+		} LSN_ALIGN_STRUCT_END( 16 );
+
+		/** Per-page information used only by debug accesses. */
+		struct LSN_COLD_ACCESSOR {
+			PfDebugReadFunc							pfDebugReader = nullptr;			/**< The debug function for reading the assigned address range. */
+			PfDebugWriteFunc						pfDebugWriter = nullptr;			/**< The debug function for writing the assigned address range. */
+		};
+
+		/** A reader and its first parameter. */
+		struct LSN_READER {
+			PfReadFunc								pfFunc;								/**< The function for reading. */
+			void *									pvParm0;							/**< The reader's first parameter. */
+		};
+
+		/** A writer and its first parameter. */
+		struct LSN_WRITER {
+			PfWriteFunc								pfFunc;								/**< The function for writing. */
+			void *									pvParm0;							/**< The writer's first parameter. */
+		};
+
+
+		// == Functions.
+		/**
+		 * Gets the shared map with the basic mapping (every page plain bus memory) and the NTSC speeds.  Built on first use.
+		 *
+		 * \return Returns the shared basic map.
+		 **/
+		static std::shared_ptr<const CMemoryMap>	Basic() {
+			static const std::shared_ptr<const CMemoryMap> s_pmmBasic = std::make_shared<CMemoryMap>();
+			return s_pmmBasic;
+		}
+
+		/**
+		 * Gets the 256 hot accessors of a bank.
+		 *
+		 * \param _ui8Bank The bank.
+		 * \return Returns a pointer to the bank's 256 hot accessors.
+		 **/
+		inline const LSN_HOT_ACCESSOR *				HotBank( uint8_t _ui8Bank ) const { return &m_haAccessors[uint32_t( _ui8Bank )<<8]; }
+
+		/**
+		 * Gets the 256 cold accessors of a bank.
+		 *
+		 * \param _ui8Bank The bank.
+		 * \return Returns a pointer to the bank's 256 cold accessors.
+		 **/
+		inline const LSN_COLD_ACCESSOR *			ColdBank( uint8_t _ui8Bank ) const { return &m_caAccessors[uint32_t( _ui8Bank )<<8]; }
+
+		/**
+		 * Gets the reader table.
+		 *
+		 * \return Returns the reader table, indexed by LSN_HOT_ACCESSOR::ui16Reader.
+		 **/
+		inline const std::vector<LSN_READER> &		Readers() const { return m_vReaders; }
+
+		/**
+		 * Gets the writer table.
+		 *
+		 * \return Returns the writer table, indexed by LSN_HOT_ACCESSOR::ui16Writer.
+		 **/
+		inline const std::vector<LSN_WRITER> &		Writers() const { return m_vWriters; }
+
+		/**
+		 * Sets an address speed.
+		 *
+		 * \param _ui16Address The address within the given bank whose speed is to be set.
+		 * \param _ui8Bank The bank of the address whose speed is to be set.
+		 * \param _ui8Speed0 The speed to set for MEMSEL=0.
+		 * \param _ui8Speed1 The speed to set for MEMSEL=1.  0 means to use the same value as _ui8Speed0.
+		 **/
+		inline void									SetRamSpeed( uint16_t _ui16Address, uint8_t _ui8Bank, uint8_t _ui8Speed0, uint8_t _ui8Speed1 = 0 ) {
+			SetSpeeds( m_haAccessors[(_ui16Address>>8)|(uint16_t( _ui8Bank )<<8)], _ui8Speed0, _ui8Speed1 );
+		}
+
+		/**
+		 * Fills the address-speed table using SetRamSpeed().
+		 *
+		 * The table is per 256-byte page (address >> 8) within each bank.
+		 * ui8Speeds[0] = MEMSEL=0
+		 * ui8Speeds[1] = MEMSEL=1 (FastROM)
+		 *
+		 * \param _ui8FastRam The fast-RAM divisor.
+		 * \param _ui8SlowRam The slow-RAM divisor.
+		 * \param _ui8XSlowRam The DMA divisor.
+		 */
+		void										BuildSpeedTable( uint16_t _ui8FastRam = LSN_CS_NTSC_CPU_DIVISOR_FAST, uint16_t _ui8SlowRam = LSN_CS_NTSC_CPU_DIVISOR_SLOW, uint16_t _ui8XSlowRam = LSN_CS_NTSC_CPU_DIVISOR_XSLOW ) {
+			assert( _ui8FastRam < 16 );
+			assert( _ui8SlowRam < 16 );
+			assert( _ui8XSlowRam < 16 );
+
+			// Default everything to Slow for both MEMSEL states.
+			//	(FastROM only affects specific regions.)
+			for ( uint32_t ui32Bank = 0; ui32Bank < 0x100; ++ui32Bank ) {
+				for ( uint32_t ui32Page = 0; ui32Page < 0x100; ++ui32Page ) {
+					SetRamSpeed( uint16_t( ui32Page << 8 ), uint8_t( ui32Bank ), uint8_t( _ui8SlowRam ) );
+				}
+			}
+
+			// --- Banks $00-$3F and $80-$BF: page-based map ---
+			auto DoLoHiBankGroup = [&]( uint8_t _ui8BaseBank ) {
+				for ( uint32_t ui32B = 0; ui32B < 0x40; ++ui32B ) {
+					uint8_t ui8Bank = uint8_t( _ui8BaseBank + ui32B );
+
+					// $0000-$1FFF: Slow (WRAM mirror) (already default).
+
+					// $2000-$3FFF: Fast.
+					for ( uint32_t ui32Page = 0x20; ui32Page <= 0x3F; ++ui32Page ) {
+						SetRamSpeed( uint16_t( ui32Page << 8 ), ui8Bank, uint8_t( _ui8FastRam ) );
+					}
+
+					// $4000-$41FF: DMA/XSLOW.
+					SetRamSpeed( 0x4000, ui8Bank, uint8_t( _ui8XSlowRam ) );	// page 0x40
+					SetRamSpeed( 0x4100, ui8Bank, uint8_t( _ui8XSlowRam ) );	// page 0x41
+
+					// $4200-$5FFF: Fast.
+					for ( uint32_t ui32Page = 0x42; ui32Page <= 0x5F; ++ui32Page ) {
+						SetRamSpeed( uint16_t( ui32Page << 8 ), ui8Bank, uint8_t( _ui8FastRam ) );
+					}
+
+					// $6000-$7FFF: Slow (already default).
+
+					// $8000-$FFFF:
+					// - banks $00-$3F: Slow (default)
+					// - banks $80-$BF: FastROM dependent.
+					if ( _ui8BaseBank == 0x80 ) {
+						for ( uint32_t ui32Page = 0x80; ui32Page <= 0xFF; ++ui32Page ) {
+							SetRamSpeed( uint16_t( ui32Page << 8 ), ui8Bank, uint8_t( _ui8SlowRam ), uint8_t( _ui8FastRam ) );
+						}
+					}
+				}
+			};
+
+			DoLoHiBankGroup( 0x00 );
+			DoLoHiBankGroup( 0x80 );
+
+			// --- Banks $40-$7D: all Slow (already default). ---
+
+			// --- Banks $7E-$7F (WRAM): all Slow (already default). ---
+
+			// --- Banks $C0-$FF: entire bank is FastROM dependent. ---
+			for ( uint32_t ui32Bank = 0xC0; ui32Bank <= 0xFF; ++ui32Bank ) {
+				for ( uint32_t ui32Page = 0x00; ui32Page <= 0xFF; ++ui32Page ) {
+					SetRamSpeed( uint16_t( ui32Page << 8 ), uint8_t( ui32Bank ), uint8_t( _ui8SlowRam ), uint8_t( _ui8FastRam ) );
+				}
+			}
+		}
+
+		/**
+		 * Sets a set of accessor functions for a given chunk of addresses.
+		 *
+		 * \param _ui16Chunk The chunk whose function pointers etc. are to be set.  Each chunk is 256 bytes long, and can be indexed via the full 24-bit address divided by 256.
+		 * \param _pfReadFunc The function for reading the assigned address range.
+		 * \param _pvReadParm The readers' first parameter.
+		 * \param _pfWriteFunc The function for writing the assigned address range.
+		 * \param _pvWriteParm The writers' first parameter.
+		 * \param _pfDebugReadFunc The debug function for reading the assigned address range.
+		 * \param _pfDebugWriteFunc The debug function for writing the assigned address range.
+		 **/
+		void										SetAccessor( uint16_t _ui16Chunk, PfReadFunc _pfReadFunc, void * _pvReadParm,
+			PfWriteFunc _pfWriteFunc, void * _pvWriteParm,
+			PfDebugReadFunc _pfDebugReadFunc, PfDebugWriteFunc _pfDebugWriteFunc ) {
+			SetAccessor( m_haAccessors[_ui16Chunk], m_caAccessors[_ui16Chunk], m_vReaders, m_vWriters, uint32_t( _ui16Chunk ) << 8,
+				_pfReadFunc, _pvReadParm, _pfWriteFunc, _pvWriteParm, _pfDebugReadFunc, _pfDebugWriteFunc );
+		}
+
+		/**
+		 * Maps a chunk to plain bus memory at another address, making it a mirror of that memory.  Resolved here, so a mirror costs the
+		 *	same as any other plain page.
+		 *
+		 * \param _ui16Chunk The chunk to map.  Each chunk is 256 bytes long, and can be indexed via the full 24-bit address divided by 256.
+		 * \param _ui32Target The full 24-bit address of the bus memory to which to map the chunk.  The low 8 bits are ignored.
+		 **/
+		void										SetMemoryMirror( uint16_t _ui16Chunk, uint32_t _ui32Target ) {
+			SetAccessor( m_haAccessors[_ui16Chunk], m_caAccessors[_ui16Chunk], m_vReaders, m_vWriters, _ui32Target & 0xFFFF00,
+				&CMemoryMap::StdRead, nullptr, &CMemoryMap::StdWrite, nullptr,
+				&CMemoryMap::StdDebugRead, &CMemoryMap::StdDebugWrite );
+		}
+
+		/**
+		 * Gives a chunk a direct host pointer, so that CPU and DMA reads and/or writes access host memory without calling its accessor
+		 *	functions.  Only for memory with no side effects and no open-bus bits (typically ROM, which every instance can then share).
+		 *	Any later SetAccessor() on the chunk replaces the pointer.
+		 *
+		 * \param _ui16Chunk The chunk whose pointer is to be set.  Each chunk is 256 bytes long, and can be indexed via the full 24-bit address divided by 256.
+		 * \param _pui8Data The chunk's 256 bytes in host memory.
+		 * \param _bRead If true, reads use _pui8Data instead of calling the chunk's reader.
+		 * \param _bWrite If true, writes use _pui8Data instead of calling the chunk's writer.
+		 **/
+		void										SetDirectAccess( uint16_t _ui16Chunk, uint8_t * _pui8Data, bool _bRead, bool _bWrite ) {
+			SetDirectAccess( m_haAccessors[_ui16Chunk], uint32_t( _ui16Chunk ) << 8, _pui8Data, _bRead, _bWrite );
+		}
+
+		/**
+		 * Applies a basic direct-access mapping to the memory.
+		 **/
+		void										ApplyBasicMapping() {
+			for ( size_t I = 0; I < 0x1000000; I += 0x100 ) {
+				SetAccessor( uint16_t( I >> 8 ), &CMemoryMap::StdRead, nullptr, &CMemoryMap::StdWrite, nullptr,
+					&CMemoryMap::StdDebugRead, &CMemoryMap::StdDebugWrite );
+			}
+		}
+
+		/**
+		 * Sets the 2 MEMSEL speeds of a page.
+		 *
+		 * \param _haHot The page's hot accessor.
+		 * \param _ui8Speed0 The speed for MEMSEL=0.
+		 * \param _ui8Speed1 The speed for MEMSEL=1.  0 means to use the same value as _ui8Speed0.
+		 **/
+		static inline void							SetSpeeds( LSN_HOT_ACCESSOR &_haHot, uint8_t _ui8Speed0, uint8_t _ui8Speed1 ) {
+			if ( 0 == _ui8Speed1 ) {
+				 _ui8Speed1 = _ui8Speed0;
+			}
+			_haHot.ui8Speeds[0] = _ui8Speed0;
+			_haHot.ui8Speeds[1] = _ui8Speed1;
+		}
+
+		/**
+		 * Sets the accessor functions of a page in a given set of tables.
+		 *
+		 * \param _haHot The page's hot accessor.
+		 * \param _caCold The page's cold accessor.
+		 * \param _vReaders The reader table to which _haHot.ui16Reader refers.
+		 * \param _vWriters The writer table to which _haHot.ui16Writer refers.
+		 * \param _ui32Memory The offset in bus memory used when the reader or writer is StdRead()/StdWrite().
+		 * \param _pfReadFunc The function for reading the page.
+		 * \param _pvReadParm The reader's first parameter.
+		 * \param _pfWriteFunc The function for writing the page.
+		 * \param _pvWriteParm The writer's first parameter.
+		 * \param _pfDebugReadFunc The debug function for reading the page.
+		 * \param _pfDebugWriteFunc The debug function for writing the page.
+		 **/
+		static void									SetAccessor( LSN_HOT_ACCESSOR &_haHot, LSN_COLD_ACCESSOR &_caCold,
+			std::vector<LSN_READER> &_vReaders, std::vector<LSN_WRITER> &_vWriters, uint32_t _ui32Memory,
+			PfReadFunc _pfReadFunc, void * _pvReadParm,
+			PfWriteFunc _pfWriteFunc, void * _pvWriteParm,
+			PfDebugReadFunc _pfDebugReadFunc, PfDebugWriteFunc _pfDebugWriteFunc ) {
+			_haHot.ui16Reader = ReaderId( _vReaders, _pfReadFunc, _pvReadParm );
+			_haHot.ui16Writer = WriterId( _vWriters, _pfWriteFunc, _pvWriteParm );
+			SetMemoryFlags( _haHot, _ui32Memory );
+			_caCold.pfDebugReader = _pfDebugReadFunc;
+			_caCold.pfDebugWriter = _pfDebugWriteFunc;
+		}
+
+		/**
+		 * Gives a page a direct host pointer.  Accesses not enabled by _bRead/_bWrite fall back to the page's reader or writer.  With a
+		 *	nullptr, the page goes back to its reader and writer, with StdRead()/StdWrite() at _ui32Memory.
+		 *
+		 * \param _haHot The page's hot accessor.
+		 * \param _ui32Memory The offset in bus memory used when _pui8Data is nullptr.
+		 * \param _pui8Data The page's 256 bytes in host memory.
+		 * \param _bRead If true, reads use _pui8Data instead of calling the page's reader.
+		 * \param _bWrite If true, writes use _pui8Data instead of calling the page's writer.
+		 **/
+		static void									SetDirectAccess( LSN_HOT_ACCESSOR &_haHot, uint32_t _ui32Memory, uint8_t * _pui8Data, bool _bRead, bool _bWrite ) {
+			if ( !_pui8Data ) {
+				SetMemoryFlags( _haHot, _ui32Memory );
+				return;
+			}
+			_haHot.pui8Direct = _pui8Data;
+			_haHot.ui8Flags = uint8_t( (_bRead ? LSN_AF_DIRECT_READ : 0) | (_bWrite ? LSN_AF_DIRECT_WRITE : 0) );
+		}
+
+		/**
+		 * Sets a page's offset in bus memory and enables it for whichever of StdRead()/StdWrite() the page uses.
+		 *
+		 * \param _haHot The page's hot accessor.
+		 * \param _ui32Memory The offset of the page's 256 bytes in bus memory.
+		 **/
+		static void									SetMemoryFlags( LSN_HOT_ACCESSOR &_haHot, uint32_t _ui32Memory ) {
+			_haHot.uiMemory = _ui32Memory;
+			_haHot.ui8Flags = uint8_t( (_haHot.ui16Reader == LSN_STD_ACCESSOR ? LSN_AF_MEMORY_READ : 0) |
+				(_haHot.ui16Writer == LSN_STD_ACCESSOR ? LSN_AF_MEMORY_WRITE : 0) );
+		}
+
+		/**
+		 * Gets the index of a reader/parameter pair in a reader table, adding it if it is not already there.
+		 *
+		 * \param _vReaders The reader table.
+		 * \param _pfFunc The reader.
+		 * \param _pvParm0 The reader's first parameter.
+		 * \return Returns the index of the pair.
+		 **/
+		static uint16_t								ReaderId( std::vector<LSN_READER> &_vReaders, PfReadFunc _pfFunc, void * _pvParm0 ) {
+			// Searched from the back, since a mapper usually sets many chunks to the pair it just added.
+			for ( size_t I = _vReaders.size(); I--; ) {
+				if ( _vReaders[I].pfFunc == _pfFunc && _vReaders[I].pvParm0 == _pvParm0 ) { return uint16_t( I ); }
+			}
+			assert( _vReaders.size() <= 0xFFFF );
+			_vReaders.push_back( { _pfFunc, _pvParm0 } );
+			return uint16_t( _vReaders.size() - 1 );
+		}
+
+		/**
+		 * Gets the index of a writer/parameter pair in a writer table, adding it if it is not already there.
+		 *
+		 * \param _vWriters The writer table.
+		 * \param _pfFunc The writer.
+		 * \param _pvParm0 The writer's first parameter.
+		 * \return Returns the index of the pair.
+		 **/
+		static uint16_t								WriterId( std::vector<LSN_WRITER> &_vWriters, PfWriteFunc _pfFunc, void * _pvParm0 ) {
+			for ( size_t I = _vWriters.size(); I--; ) {
+				if ( _vWriters[I].pfFunc == _pfFunc && _vWriters[I].pvParm0 == _pvParm0 ) { return uint16_t( I ); }
+			}
+			assert( _vWriters.size() <= 0xFFFF );
+			_vWriters.push_back( { _pfFunc, _pvParm0 } );
+			return uint16_t( _vWriters.size() - 1 );
+		}
+
+		/**
+		 * A default read function.
+		 *
+		 * \param _rfpParms A reference to all of the parameters to be passed to this function.
+		 * \param _ui8Ret Holds the return value.
+		 * \param _ui8OpenMask Holds a mask for the return value.
+		 **/
+		static void LSN_FASTCALL					StdRead( const LSN_ACCESSFUNCPARMS &_rfpParms, uint8_t &_ui8Ret, uint8_t &_ui8OpenMask ) {
+			static_cast<void>(_ui8OpenMask);
+			_ui8Ret = _rfpParms.pui8Data[_rfpParms.ui32FullAddress];
+		}
+
+		/**
+		 * A default write function.
+		 *
+		 * \param _rfpParms A reference to all of the parameters to be passed to this function.
+		 * \param _ui8Val The value to write to the target address.
+		 **/
+		static void LSN_FASTCALL					StdWrite( const LSN_ACCESSFUNCPARMS &_rfpParms, uint8_t _ui8Val ) {
+			_rfpParms.pui8Data[_rfpParms.ui32FullAddress] = _ui8Val;
+		}
+
+		/**
+		 * A read function for unmapped addresses.  Every bit is open bus.
+		 *
+		 * \param _rfpParms A reference to all of the parameters to be passed to this function.
+		 * \param _ui8Ret Holds the return value.
+		 * \param _ui8OpenMask Holds a mask for the return value.
+		 **/
+		static void LSN_FASTCALL					OpenBusRead( const LSN_ACCESSFUNCPARMS &_rfpParms, uint8_t &_ui8Ret, uint8_t &_ui8OpenMask ) {
+			static_cast<void>(_rfpParms);
+			static_cast<void>(_ui8Ret);
+			_ui8OpenMask = 0;
+		}
+
+		/**
+		 * A write function for unmapped and read-only addresses.  The write is ignored.
+		 *
+		 * \param _rfpParms A reference to all of the parameters to be passed to this function.
+		 * \param _ui8Val The value to write to the target address.
+		 **/
+		static void LSN_FASTCALL					NullWrite( const LSN_ACCESSFUNCPARMS &_rfpParms, uint8_t _ui8Val ) {
+			static_cast<void>(_rfpParms);
+			static_cast<void>(_ui8Val);
+		}
+
+		/**
+		 * A default debug read function.
+		 *
+		 * \param _rfpParms A reference to all of the parameters to be passed to this function.
+		 * \param _ui8Ret Holds the return value.
+		 **/
+		static void LSN_FASTCALL					StdDebugRead( const LSN_ACCESSFUNCPARMS &_rfpParms, uint8_t &_ui8Ret ) {
+			_ui8Ret = _rfpParms.pui8Data[_rfpParms.ui32FullAddress];
+		}
+
+		/**
+		 * A default debug write function.
+		 *
+		 * \param _rfpParms A reference to all of the parameters to be passed to this function.
+		 * \param _ui8Val The value to write to the target address.
+		 **/
+		static void LSN_FASTCALL					StdDebugWrite( const LSN_ACCESSFUNCPARMS &_rfpParms, uint8_t _ui8Val ) {
+			_rfpParms.pui8Data[_rfpParms.ui32FullAddress] = _ui8Val;
+		}
+
+
+	protected :
+		// == Members.
+		LSN_HOT_ACCESSOR							m_haAccessors[0x1000000>>8];		/**< The hot accessor per logical page, including its speed. 1 mebibyte. */
+		LSN_COLD_ACCESSOR							m_caAccessors[0x1000000>>8];		/**< The debug accessors per logical page. 1.0 mebibyte on x64, 0.5 on x86. */
+		std::vector<LSN_READER>						m_vReaders;							/**< Every unique reader/parameter pair, indexed by LSN_HOT_ACCESSOR::ui16Reader. */
+		std::vector<LSN_WRITER>						m_vWriters;							/**< Every unique writer/parameter pair, indexed by LSN_HOT_ACCESSOR::ui16Writer. */
+	};
+
+}	// namespace lsn
@@ -0,0 +1,695 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: Statically recompiles the code reachable in a ROM image into C++ blocks for CRicoh5A22::RunAot().
+ */
+
+#include "LSNAotCompiler.h"
+#include "../Files/LSNStdFile.h"
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+
+
+namespace lsn {
+
+	CAotCompiler::CAotCompiler( const CBusA &_baBus ) :
+		m_baBus( _baBus ) {
+	}
+
+	// == Functions.
+	/**
+	 * Adds an entry point.
+	 *
+	 * \param _ui32Addr The PB:PC of the entry point.
+	 * \param _sTable The instruction table (CRicoh5A22::LSN_INSTR_TABLES) the CPU will be using there.
+	 **/
+	void CAotCompiler::AddEntry( uint32_t _ui32Addr, size_t _sTable ) {
+		const uint64_t ui64Key = (uint64_t( _sTable ) << 24) | (_ui32Addr & 0xFFFFFF);
+		if ( m_sSeen.insert( ui64Key ).second ) {
+			m_vQueue.push_back( ui64Key );
+		}
+	}
+
+	/**
+	 * Adds the reset and interrupt vectors as entry points.  The emulation-mode vectors use the emulation-mode table and the native
+	 *	vectors use all 4 native tables, since M and X are not known on entry.
+	 **/
+	void CAotCompiler::AddVectors() {
+		static const uint16_t ui16Emulation[] = {
+			CRicoh5A22::LSN_V_RESET_E, CRicoh5A22::LSN_V_NMI_E, CRicoh5A22::LSN_V_IRQ_BRK_E, CRicoh5A22::LSN_V_COP_E, CRicoh5A22::LSN_V_ABORT_E,
+		};
+		static const uint16_t ui16Native[] = {
+			CRicoh5A22::LSN_V_NMI, CRicoh5A22::LSN_V_IRQ, CRicoh5A22::LSN_V_BRK, CRicoh5A22::LSN_V_COP, CRicoh5A22::LSN_V_ABORT,
+		};
+		for ( size_t I = 0; I < std::size( ui16Emulation ); ++I ) {
+			AddEntry( ReadVector( ui16Emulation[I] ), CRicoh5A22::LSN_IT_EMULATION );
+		}
+		for ( size_t I = 0; I < std::size( ui16Native ); ++I ) {
+			for ( size_t J = CRicoh5A22::LSN_IT_M16_X16; J <= CRicoh5A22::LSN_IT_M8_X8; ++J ) {
+				AddEntry( ReadVector( ui16Native[I] ), J );
+			}
+		}
+	}
+
+	/**
+	 * Walks all code reachable from the entry points, building the blocks.
+	 **/
+	void CAotCompiler::Walk() {
+		while ( m_vQueue.size() ) {
+			uint64_t ui64Key = m_vQueue.back();
+			m_vQueue.pop_back();
+			WalkBlock( ui64Key );
+		}
+	}
+
+	/**
+	 * Generates the C++ source for the blocks found by Walk().
+	 *
+	 * \param _sNamespace The namespace into which to put the generated code.
+	 * \param _pcGuard If not nullptr, the macro that must be defined for the generated code to be compiled.
+	 * \param _pcHeader The path by which the generated code includes LSNRicoh5A22.h.
+	 * \return Returns the C++ source.
+	 **/
+	std::string CAotCompiler::Generate( const std::string &_sNamespace, const char * _pcGuard, const char * _pcHeader ) const {
+		char szBuffer[256];
+		std::string sOut;
+		sOut += "/**\n"
+			" * Generated by lsn::CAotCompiler.  Do not edit; regenerate whenever the CPU core changes.\n"
+			" */\n\n"
+			"#include \"" + std::string( _pcHeader ) + "\"\n\n";
+		if ( _pcGuard ) { sOut += std::string( "#ifdef " ) + _pcGuard + "\n\n"; }
+		// The blocks are specializations of CRicoh5A22::AotBlock(), told apart from those of other generated files by a tag type.
+		sOut += "\nnamespace " + _sNamespace + " {\n\n"
+			"\t/** Keeps these blocks apart from those generated into other files. */\n"
+			"\tstruct LSN_AOT_TAG;\n\n"
+			"}\t// namespace " + _sNamespace + "\n\n"
+			"namespace lsn {\n\n";
+		for ( auto I = m_mBlocks.begin(); I != m_mBlocks.end(); ++I ) {
+			GenerateBlock( I->first, I->second, _sNamespace, sOut );
+		}
+		sOut += "}\t// namespace lsn\n\n";
+
+		sOut += "namespace " + _sNamespace + " {\n\n";
+		sOut += "\t/** Every generated block. */\n"
+			"\tstatic const lsn::CRicoh5A22::LSN_AOT_BLOCK g_abBlocks[] = {\n";
+		for ( auto I = m_mBlocks.begin(); I != m_mBlocks.end(); ++I ) {
+			std::snprintf( szBuffer, std::size( szBuffer ), "\t\t{ 0x%.6X, %u, 0x%.2X, &lsn::CRicoh5A22::AotBlock<LSN_AOT_TAG, 0x%.8" PRIX64 "ULL> },\n",
+				uint32_t( I->first & 0xFFFFFF ), uint32_t( I->first >> 24 ), I->second.vInstrs[0].ui8Op, I->first );
+			sOut += szBuffer;
+		}
+		if ( m_mBlocks.empty() ) {
+			sOut += "\t\t{ 0, 0, 0, nullptr },\n";
+		}
+		sOut += "\t};\n\n";
+
+		std::snprintf( szBuffer, std::size( szBuffer ), "0x%.16" PRIX64 "ULL", CRicoh5A22::HandlerSignature() );
+		sOut += "\t/**\n"
+			"\t * Registers the generated blocks with a CPU for use by RunAot().\n"
+			"\t *\n"
+			"\t * \\param _cCpu The CPU.\n"
+			"\t * \\return Returns false if the CPU core does not match the one that generated this file.\n"
+			"\t **/\n"
+			"\tbool Register( lsn::CRicoh5A22 &_cCpu ) {\n";
+		sOut += "\t\treturn _cCpu.SetAotBlocks( g_abBlocks, " + std::to_string( m_mBlocks.size() ) + ", " + szBuffer + " );\n"
+			"\t}\n\n";
+		sOut += "}\t// namespace " + _sNamespace + "\n";
+		if ( _pcGuard ) { sOut += std::string( "\n#endif\t// #ifdef " ) + _pcGuard + "\n"; }
+		return sOut;
+	}
+
+	/**
+	 * Generates the C++ source for the blocks found by Walk() and saves it to a file.
+	 *
+	 * \param _pFile The path of the file to create.
+	 * \param _sNamespace The namespace into which to put the generated code.
+	 * \param _pcGuard If not nullptr, the macro that must be defined for the generated code to be compiled.
+	 * \param _pcHeader The path by which the generated code includes LSNRicoh5A22.h.
+	 * \return Returns an error code indicating the result of the operation.
+	 **/
+	LSN_ERRORS CAotCompiler::Save( const std::filesystem::path &_pFile, const std::string &_sNamespace, const char * _pcGuard, const char * _pcHeader ) const {
+		std::string sSrc = Generate( _sNamespace, _pcGuard, _pcHeader );
+		CStdFile sfFile;
+		LSN_ERRORS eRet = sfFile.Create( _pFile );
+		if ( eRet != LSN_E_SUCCESS ) { return eRet; }
+		return sfFile.WriteToFile( reinterpret_cast<const uint8_t *>(sSrc.data()), sSrc.size() );
+	}
+
+	/**
+	 * Reads a 16-bit vector from bank 0.
+	 *
+	 * \param _ui16Addr The address of the vector.
+	 * \return Returns the address stored in the vector.
+	 **/
+	uint16_t CAotCompiler::ReadVector( uint16_t _ui16Addr ) const {
+		return uint16_t( m_baBus.DebugRead( _ui16Addr, 0 ) | (m_baBus.DebugRead( uint16_t( _ui16Addr + 1 ), 0 ) << 8) );
+	}
+
+	/**
+	 * Gets the size of an instruction.
+	 *
+	 * \param _sTable The instruction table.
+	 * \param _ui8Op The opcode.
+	 * \return Returns the size of the instruction in bytes.
+	 **/
+	uint8_t CAotCompiler::InstrSize( size_t _sTable, uint8_t _ui8Op ) {
+		return CRicoh5A22::InstrInfo( _ui8Op ).ui8Size[_sTable];
+	}
+
+	/**
+	 * Builds the block starting at the given key, queuing its successors.
+	 *
+	 * \param _ui64Key The block's (table << 24) | PB:PC.
+	 **/
+	void CAotCompiler::WalkBlock( uint64_t _ui64Key ) {
+		const size_t sTable = size_t( _ui64Key >> 24 );
+		const uint8_t ui8Pb = uint8_t( _ui64Key >> 16 );
+		uint16_t ui16Pc = uint16_t( _ui64Key );
+		LSN_BLOCK bBlock;
+		for ( size_t N = 0; N < LSN_L_MAX_BLOCK_INSTR; ++N ) {
+			// Only plain memory can be assumed to hold the same code at run time.
+			if ( !m_baBus.IsPlainMemory( uint16_t( (uint32_t( ui8Pb ) << 8) | (ui16Pc >> 8) ) ) ) { break; }
+			const uint8_t ui8Op = m_baBus.DebugRead( ui16Pc, ui8Pb );
+			if ( !CRicoh5A22::InstrCycleLen( sTable, ui8Op ) ) { break; }
+			LSN_BLOCK_INSTR biInstr = { (uint32_t( ui8Pb ) << 16) | ui16Pc, ui8Op, {}, true };
+			const uint8_t ui8Size = InstrSize( sTable, ui8Op );
+			for ( uint8_t I = 0; I < std::size( biInstr.ui8Operand ); ++I ) {
+				const uint16_t ui16Addr = uint16_t( ui16Pc + 1 + I );
+				biInstr.ui8Operand[I] = m_baBus.DebugRead( ui16Addr, ui8Pb );
+				if ( I + 1 < ui8Size && !m_baBus.IsReadOnlyMemory( uint16_t( (uint32_t( ui8Pb ) << 8) | (ui16Addr >> 8) ) ) ) { biInstr.bConstant = false; }
+			}
+			bBlock.vInstrs.push_back( biInstr );
+
+			const CRicoh5A22::LSN_INSTR & iInstr = CRicoh5A22::InstrInfo( ui8Op );
+			const uint16_t ui16Next = uint16_t( ui16Pc + ui8Size );
+			const uint16_t ui16Operand = uint16_t( biInstr.ui8Operand[0] | (biInstr.ui8Operand[1] << 8) );
+			const uint8_t ui8Bank = biInstr.ui8Operand[2];
+			if ( iInstr.iInstruction == CRicoh5A22::LSN_I_BRK || iInstr.iInstruction == CRicoh5A22::LSN_I_COP ) {
+				// BRK and COP do not change M or X, and always run from bank 0.
+				const bool bEmu = sTable == CRicoh5A22::LSN_IT_EMULATION;
+				const bool bCop = iInstr.iInstruction == CRicoh5A22::LSN_I_COP;
+				AddEntry( ReadVector( bCop ? (bEmu ? CRicoh5A22::LSN_V_COP_E : CRicoh5A22::LSN_V_COP) :
+					(bEmu ? CRicoh5A22::LSN_V_IRQ_BRK_E : CRicoh5A22::LSN_V_BRK) ), sTable );
+				break;
+			}
+			if ( iInstr.amAddrMode == CRicoh5A22::LSN_AM_RELATIVE ) {
+				AddEntry( (uint32_t( ui8Pb ) << 16) | uint16_t( ui16Next + int8_t( ui16Operand ) ), sTable );
+				AddEntry( (uint32_t( ui8Pb ) << 16) | ui16Next, sTable );
+				break;
+			}
+			if ( iInstr.iInstruction == CRicoh5A22::LSN_I_BRL ) {
+				AddEntry( (uint32_t( ui8Pb ) << 16) | uint16_t( ui16Next + int16_t( ui16Operand ) ), sTable );
+				break;
+			}
+			if ( iInstr.iInstruction == CRicoh5A22::LSN_I_JMP || iInstr.iInstruction == CRicoh5A22::LSN_I_JSR ||
+				iInstr.iInstruction == CRicoh5A22::LSN_I_JML || iInstr.iInstruction == CRicoh5A22::LSN_I_JSL ) {
+				// Indirect jumps are resolved at run time by the interpreter.
+				if ( iInstr.amAddrMode == CRicoh5A22::LSN_AM_ABSOLUTE ) {
+					AddEntry( (uint32_t( ui8Pb ) << 16) | ui16Operand, sTable );
+				}
+				else if ( iInstr.amAddrMode == CRicoh5A22::LSN_AM_ABSOLUTE_LONG ) {
+					AddEntry( (uint32_t( ui8Bank ) << 16) | ui16Operand, sTable );
+				}
+				if ( iInstr.iInstruction == CRicoh5A22::LSN_I_JSR || iInstr.iInstruction == CRicoh5A22::LSN_I_JSL ) {
+					AddEntry( (uint32_t( ui8Pb ) << 16) | ui16Next, sTable );
+				}
+				break;
+			}
+			if ( iInstr.iInstruction == CRicoh5A22::LSN_I_WAI || iInstr.iInstruction == CRicoh5A22::LSN_I_MVN || iInstr.iInstruction == CRicoh5A22::LSN_I_MVP ) {
+				// Execution resumes after WAI once the CPU wakes, and after MVN/MVP once A wraps, which only the interpreter can wait for.
+				AddEntry( (uint32_t( ui8Pb ) << 16) | ui16Next, sTable );
+				break;
+			}
+			if ( iInstr.iInstruction == CRicoh5A22::LSN_I_REP || iInstr.iInstruction == CRicoh5A22::LSN_I_SEP ) {
+				// The new M and X follow from the operand.  Emulation mode keeps both set.
+				size_t sNext = sTable;
+				if ( sTable != CRicoh5A22::LSN_IT_EMULATION ) {
+					bool bM8 = sTable == CRicoh5A22::LSN_IT_M8_X16 || sTable == CRicoh5A22::LSN_IT_M8_X8;
+					bool bX8 = sTable == CRicoh5A22::LSN_IT_M16_X8 || sTable == CRicoh5A22::LSN_IT_M8_X8;
+					const bool bSet = iInstr.iInstruction == CRicoh5A22::LSN_I_SEP;
+					if ( ui16Operand & CRicoh5A22::M() ) { bM8 = bSet; }
+					if ( ui16Operand & CRicoh5A22::X() ) { bX8 = bSet; }
+					sNext = bM8 ? (bX8 ? CRicoh5A22::LSN_IT_M8_X8 : CRicoh5A22::LSN_IT_M8_X16) : (bX8 ? CRicoh5A22::LSN_IT_M16_X8 : CRicoh5A22::LSN_IT_M16_X16);
+				}
+				AddEntry( (uint32_t( ui8Pb ) << 16) | ui16Next, sNext );
+				break;
+			}
+			// Returns, STP, and the other instructions that change E, M, or X end the block without a known successor.
+			if ( CRicoh5A22::EndsBlock( iInstr.iInstruction ) ) { break; }
+			ui16Pc = ui16Next;
+		}
+		if ( bBlock.vInstrs.size() ) {
+			m_mBlocks[_ui64Key] = std::move( bBlock );
+		}
+	}
+
+	/**
+	 * Appends the C++ source of a block.
+	 *
+	 * \param _ui64Key The block's (table << 24) | PB:PC.
+	 * \param _bBlock The block.
+	 * \param _sNamespace The namespace holding the generated file's LSN_AOT_TAG.
+	 * \param _sOut The string to which to append the source.
+	 **/
+	void CAotCompiler::GenerateBlock( uint64_t _ui64Key, const LSN_BLOCK &_bBlock, const std::string &_sNamespace, std::string &_sOut ) {
+		const size_t sTable = size_t( _ui64Key >> 24 );
+		char szBuffer[256];
+		std::snprintf( szBuffer, std::size( szBuffer ), "\t/** $%.2X:%.4X, table %u. */\n"
+			"\ttemplate <>\n",
+			uint32_t( (_ui64Key >> 16) & 0xFF ), uint32_t( _ui64Key & 0xFFFF ), uint32_t( sTable ) );
+		_sOut += szBuffer;
+		std::snprintf( szBuffer, std::size( szBuffer ), "::LSN_AOT_TAG, 0x%.8" PRIX64 "ULL>( CRicoh5A22 * _pcThis ) {\n", _ui64Key );
+		_sOut += "\tvoid CRicoh5A22::AotBlock<" + _sNamespace + szBuffer;
+		// Blocks run entirely natively need neither the cycle index nor the exit.
+		bool bPhi1 = false, bPhi2 = false;
+		std::string sBody;
+
+		for ( size_t N = 0; N < _bBlock.vInstrs.size(); ++N ) {
+			const uint8_t ui8Op = _bBlock.vInstrs[N].ui8Op;
+			const uint16_t * pui16Cycles = CRicoh5A22::InstrCycles( sTable, ui8Op );
+			const size_t sLen = CRicoh5A22::InstrCycleLen( sTable, ui8Op );
+			std::snprintf( szBuffer, std::size( szBuffer ), "\t\t// $%.2X:%.4X: $%.2X.\n",
+				_bBlock.vInstrs[N].ui32Addr >> 16, _bBlock.vInstrs[N].ui32Addr & 0xFFFF, ui8Op );
+			sBody += szBuffer;
+			bool bGuarded = false;
+			const bool bNative = GenerateNative( sTable, _bBlock.vInstrs[N], N, bGuarded, sBody );
+
+			// Only the targets of skips need labels.  Native code without checks replaces the cycle functions entirely.
+			std::vector<bool> vLabel( sLen + 1 );
+			for ( size_t I = 5; I < sLen; I += 2 ) { vLabel[I] = true; }
+			vLabel[sLen] = bNative && bGuarded;
+			for ( size_t I = 1; I < ((bNative && !bGuarded) ? 1 : sLen); ++I ) {
+				if ( vLabel[I] ) {
+					std::snprintf( szBuffer, std::size( szBuffer ), "\tI%u_%u :\n", uint32_t( N ), uint32_t( I ) );
+					sBody += szBuffer;
+				}
+				if ( I & 1 ) {
+					bPhi1 = true;
+					std::snprintf( szBuffer, std::size( szBuffer ), "\t\tif ( BlockPhi1( _pcThis, %u ) != %u ) { goto Finish; }\n",
+						pui16Cycles[I], uint32_t( (I == sLen - 1) ? 0 : (I + 1) ) );
+					sBody += szBuffer;
+				}
+				else {
+					bPhi2 = true;
+					std::snprintf( szBuffer, std::size( szBuffer ), "\t\tui32Idx = BlockPhi2( _pcThis, %u );\n", pui16Cycles[I] );
+					sBody += szBuffer;
+					for ( size_t J = I + 3; J < sLen; J += 2 ) {
+						std::snprintf( szBuffer, std::size( szBuffer ), "\t\tif ( ui32Idx == %u ) { goto I%u_%u; }\n",
+							uint32_t( J ), uint32_t( N ), uint32_t( J ) );
+						sBody += szBuffer;
+					}
+					std::snprintf( szBuffer, std::size( szBuffer ), "\t\tif ( ui32Idx != %u ) { return; }\n", uint32_t( I + 1 ) );
+					sBody += szBuffer;
+				}
+			}
+
+			if ( vLabel[sLen] ) {
+				std::snprintf( szBuffer, std::size( szBuffer ), "\tI%u_%u :\n", uint32_t( N ), uint32_t( sLen ) );
+				sBody += szBuffer;
+			}
+			if ( N + 1 < _bBlock.vInstrs.size() ) {
+				const uint64_t ui64Expected = (uint64_t( sTable ) << 32) | (uint64_t( _bBlock.vInstrs[N+1].ui8Op ) << 24) | _bBlock.vInstrs[N+1].ui32Addr;
+				std::snprintf( szBuffer, std::size( szBuffer ), "\t\tif ( !BlockFetch( _pcThis, 0, 0x%.10" PRIX64 "ULL ) ) { return; }\n", ui64Expected );
+			}
+			else {
+				std::snprintf( szBuffer, std::size( szBuffer ), "\t\tBlockFetch( _pcThis, 0, UINT64_MAX );\n\t\treturn;\n" );
+			}
+			sBody += szBuffer;
+		}
+		if ( bPhi2 ) { _sOut += "\t\tuint32_t ui32Idx;\n"; }
+		_sOut += sBody;
+		if ( bPhi1 ) {
+			_sOut += "\tFinish :\n"
+				"\t\tBlockFinishCycle( _pcThis );\n";
+		}
+		_sOut += "\t}\n\n";
+	}
+
+	/**
+	 * Appends the C++ that runs an instruction natively.  If it has run-time checks (decimal mode, page mappings), it goes to the
+	 *	instruction's end label, I<instruction>_<cycle count>, on success, and otherwise falls through to the instruction's cycle functions.
+	 *
+	 * \param _sTable The instruction table.
+	 * \param _biInstr The instruction.
+	 * \param _sIndex The index of the instruction in its block.
+	 * \param _bGuarded Set to true if the code can fall through to the instruction's cycle functions.
+	 * \param _sOut The string to which to append the source.
+	 * \return Returns true if the instruction can run natively, otherwise nothing is appended.
+	 **/
+	bool CAotCompiler::GenerateNative( size_t _sTable, const LSN_BLOCK_INSTR &_biInstr, size_t _sIndex, bool &_bGuarded, std::string &_sOut ) {
+		CRicoh5A22::LSN_NATIVE_INSTR niInstr;
+		if ( !_biInstr.bConstant || !CRicoh5A22::NativeInstr( _sTable, _biInstr.ui8Op, niInstr ) ) { return false; }
+		const uint16_t ui16Operand = uint16_t( _biInstr.ui8Operand[0] | (_biInstr.ui8Operand[1] << 8) );
+		// A 16-bit access whose high byte is on the next page (or bank) is left to the cycle functions.
+		if ( niInstr.nmMode == CRicoh5A22::LSN_NM_ABSOLUTE && niInstr.bWide && uint8_t( ui16Operand ) == 0xFF ) { return false; }
+
+		const bool bData = niInstr.nmMode == CRicoh5A22::LSN_NM_ABSOLUTE || niInstr.nmMode == CRicoh5A22::LSN_NM_DIRECT;
+		const bool bRead = niInstr.noOp != CRicoh5A22::LSN_NO_STORE;
+		const uint8_t ui8Pb = uint8_t( _biInstr.ui32Addr >> 16 );
+		const uint16_t ui16Pc = uint16_t( _biInstr.ui32Addr );
+		const uint32_t ui32Mask = niInstr.bWide ? 0xFFFF : 0xFF;
+		const uint32_t ui32Top = niInstr.bWide ? 0x8000 : 0x80;
+		const char * pcType = niInstr.bWide ? "uint16_t" : "uint8_t";
+		static const char * pcRegs[2][4] = {
+			{ "_pcThis->m_fsState.rRegs.ui8A[0]", "_pcThis->m_fsState.rRegs.ui8X[0]", "_pcThis->m_fsState.rRegs.ui8Y[0]", "0" },
+			{ "_pcThis->m_fsState.rRegs.ui16A", "_pcThis->m_fsState.rRegs.ui16X", "_pcThis->m_fsState.rRegs.ui16Y", "0" },
+		};
+		const char * pcReg = pcRegs[niInstr.bWide][niInstr.nrReg];
+		const char * pcA = pcRegs[niInstr.bWide][CRicoh5A22::LSN_NR_A];
+
+		// == Guards.  Nothing has been changed yet when any of them fail.
+		std::string sGuard;
+		std::string sPre;
+		auto aGuard = [&]( const std::string &_sCheck ) { sGuard += (sGuard.empty() ? "" : " && ") + _sCheck; };
+		char szBuffer[256];
+		if ( niInstr.noOp == CRicoh5A22::LSN_NO_ADC || niInstr.noOp == CRicoh5A22::LSN_NO_SBC ) {
+			aGuard( "!(_pcThis->m_fsState.rRegs.ui8Status & D())" );
+		}
+		std::string sAddr, sAddr1, sBank;
+		if ( niInstr.nmMode == CRicoh5A22::LSN_NM_ABSOLUTE ) {
+			std::snprintf( szBuffer, std::size( szBuffer ), "0x%.4X", ui16Operand );
+			sAddr = szBuffer;
+			std::snprintf( szBuffer, std::size( szBuffer ), "0x%.4X", uint16_t( ui16Operand + 1 ) );
+			sAddr1 = szBuffer;
+			sBank = "_pcThis->m_fsState.ui8Bank";
+			std::snprintf( szBuffer, std::size( szBuffer ), "_pcThis->m_baBusA.%s( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x%.2X ) )",
+				bRead ? "IsPlainMemory" : "IsPlainWrite", ui16Operand >> 8 );
+			aGuard( szBuffer );
+		}
+		else if ( niInstr.nmMode == CRicoh5A22::LSN_NM_DIRECT ) {
+			// D + dp in bank 0.  In emulation mode that is also DH:dp when D.l is 0.
+			std::snprintf( szBuffer, std::size( szBuffer ), "\t\t\tconst uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x%.2X );\n",
+				_biInstr.ui8Operand[0] );
+			sPre = szBuffer;
+			sAddr = "ui16Addr";
+			sAddr1 = "uint16_t( ui16Addr + 1 )";
+			sBank = "0";
+			if ( niInstr.bWide ) { aGuard( "uint8_t( ui16Addr ) != 0xFF" ); }
+			aGuard( std::string( "_pcThis->m_baBusA." ) + (bRead ? "IsPlainMemory" : "IsPlainWrite") + "( uint16_t( ui16Addr >> 8 ) )" );
+		}
+		_bGuarded = !sGuard.empty();
+
+		// == The body, indented inside the guard if there is one.
+		std::string sBody;
+		const char * pcIndent = _bGuarded ? "\t\t\t\t" : "\t\t\t";
+		auto aLine = [&]( const char * _pcFormat, auto... _tArgs ) {
+			std::snprintf( szBuffer, std::size( szBuffer ), _pcFormat, _tArgs... );
+			sBody += std::string( pcIndent ) + szBuffer + "\n";
+		};
+
+		// Timing: the operand fetches, the data accesses, and the idle cycle of the direct-page modes when D.l is not 0.
+		uint32_t ui32Cycles = 1;
+		if ( niInstr.nmMode == CRicoh5A22::LSN_NM_IMPLIED ) {
+			aLine( "uint8_t ui8Speed = _pcThis->m_ui8FastDiv;" );
+			aLine( "uint64_t ui64Ticks = ui8Speed;" );
+		}
+		else {
+			ui32Cycles = niInstr.ui8OperandSize;
+			for ( uint8_t I = 0; I < niInstr.ui8OperandSize; ++I ) {
+				aLine( I ? "ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x%.4X, 0x%.2X ));" : "uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x%.4X, 0x%.2X );",
+					uint16_t( ui16Pc + 1 + I ), ui8Pb );
+				if ( !I ) { aLine( "uint64_t ui64Ticks = ui8Speed;" ); }
+			}
+		}
+		sBody += "#ifdef LSN_CPU_VERIFY\n";
+		for ( uint8_t I = 0; I < niInstr.ui8OperandSize; ++I ) {
+			aLine( "BlockLogFetch( _pcThis, 0x%.8XULL );", (uint32_t( _biInstr.ui8Operand[I] ) << 24) | (uint32_t( ui8Pb ) << 16) | uint16_t( ui16Pc + 1 + I ) );
+		}
+		sBody += "#endif\t// #ifdef LSN_CPU_VERIFY\n";
+
+		// The addressing mode's own state, the operand, and the data bus, which holds the last byte read or written.
+		if ( niInstr.nmMode == CRicoh5A22::LSN_NM_IMMEDIATE ) {
+			aLine( "const uint16_t ui16Val = 0x%.4X;", niInstr.bWide ? ui16Operand : _biInstr.ui8Operand[0] );
+			aLine( "_pcThis->m_fsState.ui16Operand = ui16Val;" );
+			aLine( "_pcThis->m_baBusA.SetDataBus( 0x%.2X );", _biInstr.ui8Operand[niInstr.ui8OperandSize-1] );
+		}
+		else if ( bData ) {
+			if ( niInstr.nmMode == CRicoh5A22::LSN_NM_ABSOLUTE ) {
+				aLine( "_pcThis->m_fsState.ui16Address = %s;", sAddr.c_str() );
+				aLine( "_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;" );
+			}
+			else {
+				aLine( "_pcThis->m_fsState.ui16Address = ui16Addr;" );
+				aLine( "_pcThis->m_fsState.ui16Pointer = 0x%.2X;", _biInstr.ui8Operand[0] );
+				aLine( "if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {" );
+				aLine( "\tui64Ticks += _pcThis->m_ui8FastDiv;" );
+				aLine( "\t++_pcThis->m_ui64BlockCycles;" );
+				aLine( "}" );
+			}
+			if ( bRead ) {
+				aLine( "%suint16_t ui16Val = _pcThis->m_baBusA.Read( %s, %s, ui8Speed );", niInstr.bWide ? "" : "const ", sAddr.c_str(), sBank.c_str() );
+				aLine( "ui64Ticks += ui8Speed;" );
+				if ( niInstr.bWide ) {
+					aLine( "ui16Val |= uint16_t( _pcThis->m_baBusA.Read( %s, %s, ui8Speed ) << 8 );", sAddr1.c_str(), sBank.c_str() );
+					aLine( "ui64Ticks += ui8Speed;" );
+				}
+				aLine( "_pcThis->m_fsState.ui16Operand = ui16Val;" );
+			}
+			else {
+				// Stores write the whole register to the operand, then as many bytes as the width to memory.
+				aLine( "const uint16_t ui16Val = %s;", pcRegs[1][niInstr.nrReg] );
+				aLine( "_pcThis->m_fsState.ui16Operand = ui16Val;" );
+				aLine( "_pcThis->m_baBusA.Write( %s, %s, uint8_t( ui16Val ), ui8Speed );", sAddr.c_str(), sBank.c_str() );
+				aLine( "ui64Ticks += ui8Speed;" );
+				if ( niInstr.bWide ) {
+					aLine( "_pcThis->m_baBusA.Write( %s, %s, uint8_t( ui16Val >> 8 ), ui8Speed );", sAddr1.c_str(), sBank.c_str() );
+					aLine( "ui64Ticks += ui8Speed;" );
+				}
+			}
+			ui32Cycles += niInstr.bWide ? 2 : 1;
+		}
+
+		// == The operation.  The result is in ui32R, from which N and Z are taken.
+		uint8_t ui8Flags = 0;
+		std::string sCarry, sOverflow;
+		switch ( niInstr.noOp ) {
+			case CRicoh5A22::LSN_NO_LOAD : {
+				aLine( "const uint32_t ui32R = ui16Val;" );
+				aLine( "%s = %s( ui32R );", pcReg, pcType );
+				ui8Flags = CRicoh5A22::N() | CRicoh5A22::Z();
+				break;
+			}
+			case CRicoh5A22::LSN_NO_OR : {}			LSN_FALLTHROUGH
+			case CRicoh5A22::LSN_NO_AND : {}		LSN_FALLTHROUGH
+			case CRicoh5A22::LSN_NO_EOR : {
+				static const char cOps[] = { '|', '&', '^' };
+				aLine( "const uint32_t ui32R = uint32_t( %s ) %c ui16Val;", pcA, cOps[niInstr.noOp-CRicoh5A22::LSN_NO_OR] );
+				aLine( "%s = %s( ui32R );", pcA, pcType );
+				ui8Flags = CRicoh5A22::N() | CRicoh5A22::Z();
+				break;
+			}
+			case CRicoh5A22::LSN_NO_ADC : {}		LSN_FALLTHROUGH
+			case CRicoh5A22::LSN_NO_SBC : {
+				// SBC is ADC of the complement.
+				if ( niInstr.noOp == CRicoh5A22::LSN_NO_SBC ) { aLine( "const uint32_t ui32V = ui16Val ^ 0x%X;", ui32Mask ); }
+				else { aLine( "const uint32_t ui32V = ui16Val;" ); }
+				aLine( "const uint32_t ui32A = %s;", pcA );
+				aLine( "const uint32_t ui32R = ui32A + ui32V + (_pcThis->m_fsState.rRegs.ui8Status & C());" );
+				aLine( "%s = %s( ui32R );", pcA, pcType );
+				std::snprintf( szBuffer, std::size( szBuffer ), "(ui32R > 0x%X ? C() : 0)", ui32Mask );
+				sCarry = szBuffer;
+				std::snprintf( szBuffer, std::size( szBuffer ), "((~(ui32A ^ ui32V) & (ui32A ^ ui32R) & 0x%X) ? V() : 0)", ui32Top );
+				sOverflow = szBuffer;
+				ui8Flags = CRicoh5A22::N() | CRicoh5A22::Z() | CRicoh5A22::C() | CRicoh5A22::V();
+				break;
+			}
+			case CRicoh5A22::LSN_NO_CMP : {
+				aLine( "const uint32_t ui32R = uint32_t( %s ) - ui16Val;", pcReg );
+				std::snprintf( szBuffer, std::size( szBuffer ), "(ui32R <= 0x%X ? C() : 0)", ui32Mask );
+				sCarry = szBuffer;
+				ui8Flags = CRicoh5A22::N() | CRicoh5A22::Z() | CRicoh5A22::C();
+				break;
+			}
+			case CRicoh5A22::LSN_NO_BIT : {
+				// Z from A & operand.  From memory, N and V are the top 2 bits of the operand.
+				aLine( "const uint32_t ui32R = uint32_t( %s ) & ui16Val;", pcA );
+				ui8Flags = CRicoh5A22::Z();
+				if ( bData ) {
+					std::snprintf( szBuffer, std::size( szBuffer ), "((ui16Val & 0x%X) ? V() : 0)", ui32Top >> 1 );
+					sOverflow = szBuffer;
+					ui8Flags |= CRicoh5A22::N() | CRicoh5A22::V();
+				}
+				break;
+			}
+			case CRicoh5A22::LSN_NO_INC : {}		LSN_FALLTHROUGH
+			case CRicoh5A22::LSN_NO_DEC : {
+				aLine( "const uint32_t ui32R = uint32_t( %s ) %c 1;", pcReg, niInstr.noOp == CRicoh5A22::LSN_NO_INC ? '+' : '-' );
+				aLine( "%s = %s( ui32R );", pcReg, pcType );
+				ui8Flags = CRicoh5A22::N() | CRicoh5A22::Z();
+				break;
+			}
+			case CRicoh5A22::LSN_NO_ASL : {}		LSN_FALLTHROUGH
+			case CRicoh5A22::LSN_NO_ROL : {
+				aLine( niInstr.noOp == CRicoh5A22::LSN_NO_ASL ? "const uint32_t ui32R = uint32_t( %s ) << 1;" :
+					"const uint32_t ui32R = (uint32_t( %s ) << 1) | (_pcThis->m_fsState.rRegs.ui8Status & C());", pcA );
+				aLine( "%s = %s( ui32R );", pcA, pcType );
+				std::snprintf( szBuffer, std::size( szBuffer ), "(ui32R > 0x%X ? C() : 0)", ui32Mask );
+				sCarry = szBuffer;
+				ui8Flags = CRicoh5A22::N() | CRicoh5A22::Z() | CRicoh5A22::C();
+				break;
+			}
+			case CRicoh5A22::LSN_NO_LSR : {}		LSN_FALLTHROUGH
+			case CRicoh5A22::LSN_NO_ROR : {
+				aLine( "const uint32_t ui32A = %s;", pcA );
+				if ( niInstr.noOp == CRicoh5A22::LSN_NO_LSR ) { aLine( "const uint32_t ui32R = ui32A >> 1;" ); }
+				else { aLine( "const uint32_t ui32R = (ui32A >> 1) | ((_pcThis->m_fsState.rRegs.ui8Status & C()) ? 0x%X : 0);", ui32Top ); }
+				aLine( "%s = %s( ui32R );", pcA, pcType );
+				sCarry = "(ui32A & C())";
+				ui8Flags = CRicoh5A22::N() | CRicoh5A22::Z() | CRicoh5A22::C();
+				break;
+			}
+			case CRicoh5A22::LSN_NO_TRANSFER : {
+				aLine( "const uint32_t ui32R = %s;", pcRegs[niInstr.bWide][niInstr.nrSrc] );
+				aLine( "%s = %s( ui32R );", pcReg, pcType );
+				ui8Flags = CRicoh5A22::N() | CRicoh5A22::Z();
+				break;
+			}
+			case CRicoh5A22::LSN_NO_SET_FLAG : {
+				aLine( "_pcThis->m_fsState.rRegs.ui8Status |= 0x%.2X;", niInstr.ui8Flag );
+				break;
+			}
+			case CRicoh5A22::LSN_NO_CLEAR_FLAG : {
+				aLine( "_pcThis->m_fsState.rRegs.ui8Status &= 0x%.2X;", uint8_t( ~niInstr.ui8Flag ) );
+				break;
+			}
+			default : {}
+		}
+		if ( ui8Flags ) {
+			std::string sFlags;
+			if ( ui8Flags & CRicoh5A22::N() ) {
+				std::snprintf( szBuffer, std::size( szBuffer ), " | ((%s & 0x%X) ? N() : 0)", niInstr.noOp == CRicoh5A22::LSN_NO_BIT ? "ui16Val" : "ui32R", ui32Top );
+				sFlags += szBuffer;
+			}
+			if ( ui8Flags & CRicoh5A22::Z() ) {
+				std::snprintf( szBuffer, std::size( szBuffer ), " | ((ui32R & 0x%X) ? 0 : Z())", ui32Mask );
+				sFlags += szBuffer;
+			}
+			if ( ui8Flags & CRicoh5A22::C() ) { sFlags += " | " + sCarry; }
+			if ( ui8Flags & CRicoh5A22::V() ) { sFlags += " | " + sOverflow; }
+			aLine( "_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x%.2X)%s );", uint8_t( ~ui8Flags ), sFlags.c_str() );
+		}
+
+		// == The end of the instruction, as left by BeginInst().
+		aLine( "_pcThis->m_ui64MasterCycles += ui64Ticks;" );
+		aLine( "_pcThis->m_ui64BlockCycles += %u;", ui32Cycles );
+		aLine( "_pcThis->m_ui8Speed = ui8Speed;" );
+		aLine( "_pcThis->AotEndInstr( 0x%.4X );", uint16_t( ui16Pc + 1 + niInstr.ui8OperandSize ) );
+
+		_sOut += "\t\t{\n" + sPre;
+		if ( _bGuarded ) {
+			_sOut += "\t\t\tif ( " + sGuard + " ) {\n" + sBody;
+			std::snprintf( szBuffer, std::size( szBuffer ), "\t\t\t\tgoto I%u_%u;\n", uint32_t( _sIndex ),
+				uint32_t( CRicoh5A22::InstrCycleLen( _sTable, _biInstr.ui8Op ) ) );
+			_sOut += szBuffer;
+			_sOut += "\t\t\t}\n";
+		}
+		else { _sOut += sBody; }
+		_sOut += "\t\t}\n";
+		return true;
+	}
+
+#ifdef LSN_CPU_VERIFY
+	/**
+	 * Checks the instruction sizes used to walk code: the immediate forms that follow M or X, and the rest, in every instruction table,
+	 *	and that Walk() takes REP and SEP into account when sizing the instructions after them.
+	 *
+	 * \return Returns true if every size is right.
+	 **/
+	bool CAotCompiler::RunInstrSizeTest() {
+		bool bRet = true;
+		auto aFail = [&]( const char * _pcWhat, uint32_t _ui32Which ) {
+			char szBuffer[128];
+			std::snprintf( szBuffer, std::size( szBuffer ), "INSTR SIZE Failure: %s ($%.4X)\r\n\r\n", _pcWhat, _ui32Which );
+			lsn::DebugA( szBuffer );
+			bRet = false;
+		};
+
+		// == The sizes, as (table << 8) | opcode on failure.
+		static const uint8_t ui8ImmM[] = { 0x09, 0x29, 0x49, 0x69, 0x89, 0xA9, 0xC9, 0xE9 };
+		static const uint8_t ui8ImmX[] = { 0xA0, 0xA2, 0xC0, 0xE0 };
+		static const uint8_t ui8Imm8[] = { 0x00, 0x02, 0x42, 0xC2, 0xE2 };					// BRK, COP, WDM, REP, SEP.
+		static const uint8_t ui8Other[][2] = {
+			{ 0xEA, 1 }, { 0xA5, 2 }, { 0xAD, 3 }, { 0xAF, 4 }, { 0x80, 2 }, { 0x82, 3 }, { 0x54, 3 },
+		};
+		for ( size_t T = 0; T < CRicoh5A22::LSN_IT_TOTAL; ++T ) {
+			const bool bM16 = T == CRicoh5A22::LSN_IT_M16_X16 || T == CRicoh5A22::LSN_IT_M16_X8;
+			const bool bX16 = T == CRicoh5A22::LSN_IT_M16_X16 || T == CRicoh5A22::LSN_IT_M8_X16;
+			for ( uint8_t ui8Op : ui8ImmM ) {
+				if ( InstrSize( T, ui8Op ) != (bM16 ? 3 : 2) ) { aFail( "Immediate Not Sized by M", uint32_t( (T << 8) | ui8Op ) ); }
+			}
+			for ( uint8_t ui8Op : ui8ImmX ) {
+				if ( InstrSize( T, ui8Op ) != (bX16 ? 3 : 2) ) { aFail( "Immediate Not Sized by X", uint32_t( (T << 8) | ui8Op ) ); }
+			}
+			for ( uint8_t ui8Op : ui8Imm8 ) {
+				if ( InstrSize( T, ui8Op ) != 2 ) { aFail( "Immediate Not 1 Byte", uint32_t( (T << 8) | ui8Op ) ); }
+			}
+			for ( size_t I = 0; I < std::size( ui8Other ); ++I ) {
+				if ( InstrSize( T, ui8Other[I][0] ) != ui8Other[I][1] ) { aFail( "Size Wrong", uint32_t( (T << 8) | ui8Other[I][0] ) ); }
+			}
+		}
+
+		// == Walk(), as (table << 16) | PC on failure.
+		// $8000 (8-bit A and X/Y): REP #$20 / LDA #$1234 / RTS.  $8010 (8-bit A, 16-bit X/Y): SEP #$10 / LDX #$12 / LDA #$34 / RTS.
+		//	$8020 (emulation): REP #$30 / LDA #$12 / LDY #$34 / RTS.
+		uint8_t ui8Code[256] = {};
+		static const uint8_t ui8Prog0[] = { 0xC2, 0x20, 0xA9, 0x34, 0x12, 0x60 };
+		static const uint8_t ui8Prog1[] = { 0xE2, 0x10, 0xA2, 0x12, 0xA9, 0x34, 0x60 };
+		static const uint8_t ui8Prog2[] = { 0xC2, 0x30, 0xA9, 0x12, 0xA0, 0x34, 0x60 };
+		std::memcpy( ui8Code + 0x00, ui8Prog0, sizeof( ui8Prog0 ) );
+		std::memcpy( ui8Code + 0x10, ui8Prog1, sizeof( ui8Prog1 ) );
+		std::memcpy( ui8Code + 0x20, ui8Prog2, sizeof( ui8Prog2 ) );
+		std::unique_ptr<CBusA> pbBus = std::make_unique<CBusA>();
+		pbBus->ApplyBasicMapping();
+		pbBus->SetAccessor( 0x0080, &CMemoryMap::OpenBusRead, nullptr, &CMemoryMap::NullWrite, nullptr, nullptr, &CMemoryMap::NullWrite );
+		pbBus->SetDirectAccess( 0x0080, ui8Code, true, false );
+
+		CAotCompiler acCompiler( (*pbBus) );
+		acCompiler.AddEntry( 0x008000, CRicoh5A22::LSN_IT_M8_X8 );
+		acCompiler.AddEntry( 0x008010, CRicoh5A22::LSN_IT_M8_X16 );
+		acCompiler.AddEntry( 0x008020, CRicoh5A22::LSN_IT_EMULATION );
+		acCompiler.Walk();
+		// Each block after the REP or SEP: its table, its address, and the address of its RTS.
+		static const uint16_t ui16Expected[][3] = {
+			{ CRicoh5A22::LSN_IT_M16_X8, 0x8002, 0x8005 },
+			{ CRicoh5A22::LSN_IT_M8_X8, 0x8012, 0x8016 },
+			{ CRicoh5A22::LSN_IT_EMULATION, 0x8022, 0x8026 },
+		};
+		for ( size_t I = 0; I < std::size( ui16Expected ); ++I ) {
+			const uint32_t ui32Which = (uint32_t( ui16Expected[I][0] ) << 16) | ui16Expected[I][1];
+			auto aBlock = acCompiler.m_mBlocks.find( (uint64_t( ui16Expected[I][0] ) << 24) | ui16Expected[I][1] );
+			if ( aBlock == acCompiler.m_mBlocks.end() ) { aFail( "Walk Missed the Table Change", ui32Which ); continue; }
+			const std::vector<LSN_BLOCK_INSTR> & vInstrs = aBlock->second.vInstrs;
+			if ( vInstrs.back().ui8Op != 0x60 || vInstrs.back().ui32Addr != ui16Expected[I][2] ) { aFail( "Walk Sized an Immediate Wrong", ui32Which ); }
+		}
+		return bRet;
+	}
+
+	/**
+	 * Generates the blocks of the program mapped by CRicoh5A22::MapAotFixture() into LSNAotFixture.cpp, which CRicoh5A22::RunAotTest()
+	 *	and CRicoh5A22::RunIdleLoopTest() use.  Must be run again whenever the CPU core changes.
+	 *
+	 * \param _pFile The path of the file to create.
+	 * \return Returns an error code indicating the result of the operation.
+	 **/
+	LSN_ERRORS CAotCompiler::SaveFixture( const std::filesystem::path &_pFile ) {
+		std::unique_ptr<CBusA> pbBus = std::make_unique<CBusA>();
+		std::vector<uint8_t> vRam( 0x1000000 );
+		pbBus->SetMemory( vRam.data() );
+		pbBus->ApplyBasicMapping();
+		CRicoh5A22::MapAotFixture( (*pbBus) );
+
+		CAotCompiler acCompiler( (*pbBus) );
+		std::vector<uint64_t> vEntries = CRicoh5A22::AotFixtureEntries();
+		for ( size_t I = 0; I < vEntries.size(); ++I ) {
+			acCompiler.AddEntry( uint32_t( vEntries[I] & 0xFFFFFF ), size_t( vEntries[I] >> 24 ) );
+		}
+		acCompiler.Walk();
+		return acCompiler.Save( _pFile, "lsn::aotfixture", "LSN_CPU_VERIFY", "LSNRicoh5A22.h" );
+	}
+#endif	// #ifdef LSN_CPU_VERIFY
+
+}	// namespace lsn
@@ -0,0 +1,191 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: Statically recompiles the code reachable in a ROM image into C++ blocks for CRicoh5A22::RunAot().
+ */
+
+
+#pragma once
+
+#include "../LSNBirdSNES.h"
+#include "../Bus/LSNBusA.h"
+#include "LSNRicoh5A22.h"
+
+#include <filesystem>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+
+namespace lsn {
+
+	/**
+	 * Class CAotCompiler
+	 * \brief Statically recompiles the code reachable in a ROM image into C++ blocks for CRicoh5A22::RunAot().
+	 *
+	 * Description: Statically recompiles the code reachable in a ROM image into C++ blocks for CRicoh5A22::RunAot().  Code is walked from
+	 *	the interrupt vectors (and any added entry points), following fall-through and static branch/jump targets.  Each block becomes a
+	 *	specialization of CRicoh5A22::AotBlock().  Instructions that CRicoh5A22::NativeInstr() decodes, and whose operands are in read-only
+	 *	memory (so that they can be compiled in), become C++ that does the operation directly and accounts for its cycles at once; the
+	 *	rest, and those whose run-time checks fail (decimal mode, 16-bit accesses ending on a page's last byte, accesses to memory with
+	 *	side effects), call the CPU's cycle functions in order, exactly as the interpreter would.  Anything dynamic (indirect jumps,
+	 *	returns, unimplemented opcodes, non-plain pages) ends the block, and the interpreter takes over from there.
+	 * The generated file registers its blocks with Register( CRicoh5A22 & ), which fails if the CPU core has changed since the file was
+	 *	generated.
+	 */
+	class CAotCompiler {
+	public :
+		CAotCompiler( const CBusA &_baBus );
+
+
+		// == Functions.
+		/**
+		 * Adds an entry point.
+		 *
+		 * \param _ui32Addr The PB:PC of the entry point.
+		 * \param _sTable The instruction table (CRicoh5A22::LSN_INSTR_TABLES) the CPU will be using there.
+		 **/
+		void												AddEntry( uint32_t _ui32Addr, size_t _sTable );
+
+		/**
+		 * Adds the reset and interrupt vectors as entry points.  The emulation-mode vectors use the emulation-mode table and the native
+		 *	vectors use all 4 native tables, since M and X are not known on entry.
+		 **/
+		void												AddVectors();
+
+		/**
+		 * Walks all code reachable from the entry points, building the blocks.
+		 **/
+		void												Walk();
+
+		/**
+		 * Gets the number of blocks found by Walk().
+		 *
+		 * \return Returns the number of blocks.
+		 **/
+		inline size_t										TotalBlocks() const { return m_mBlocks.size(); }
+
+		/**
+		 * Generates the C++ source for the blocks found by Walk().
+		 *
+		 * \param _sNamespace The namespace into which to put the generated code.
+		 * \param _pcGuard If not nullptr, the macro that must be defined for the generated code to be compiled.
+		 * \param _pcHeader The path by which the generated code includes LSNRicoh5A22.h.
+		 * \return Returns the C++ source.
+		 **/
+		std::string											Generate( const std::string &_sNamespace, const char * _pcGuard = nullptr, const char * _pcHeader = "CPU/LSNRicoh5A22.h" ) const;
+
+		/**
+		 * Generates the C++ source for the blocks found by Walk() and saves it to a file.
+		 *
+		 * \param _pFile The path of the file to create.
+		 * \param _sNamespace The namespace into which to put the generated code.
+		 * \param _pcGuard If not nullptr, the macro that must be defined for the generated code to be compiled.
+		 * \param _pcHeader The path by which the generated code includes LSNRicoh5A22.h.
+		 * \return Returns an error code indicating the result of the operation.
+		 **/
+		LSN_ERRORS											Save( const std::filesystem::path &_pFile, const std::string &_sNamespace, const char * _pcGuard = nullptr, const char * _pcHeader = "CPU/LSNRicoh5A22.h" ) const;
+
+#ifdef LSN_CPU_VERIFY
+		/**
+		 * Checks the instruction sizes used to walk code: the immediate forms that follow M or X, and the rest, in every instruction table,
+		 *	and that Walk() takes REP and SEP into account when sizing the instructions after them.
+		 *
+		 * \return Returns true if every size is right.
+		 **/
+		static bool											RunInstrSizeTest();
+
+		/**
+		 * Generates the blocks of the program mapped by CRicoh5A22::MapAotFixture() into LSNAotFixture.cpp, which CRicoh5A22::RunAotTest()
+		 *	and CRicoh5A22::RunIdleLoopTest() use.  Must be run again whenever the CPU core changes.
+		 *
+		 * \param _pFile The path of the file to create.
+		 * \return Returns an error code indicating the result of the operation.
+		 **/
+		static LSN_ERRORS									SaveFixture( const std::filesystem::path &_pFile );
+#endif	// #ifdef LSN_CPU_VERIFY
+
+
+	protected :
+		// == Enumerations.
+		/** Limits. */
+		enum LSN_LIMITS {
+			LSN_L_MAX_BLOCK_INSTR							= 256,							/**< The maximum number of instructions in a block. */
+		};
+
+
+		// == Types.
+		/** An instruction inside a block. */
+		struct LSN_BLOCK_INSTR {
+			uint32_t										ui32Addr;						/**< The PB:PC of the instruction. */
+			uint8_t											ui8Op;							/**< The opcode. */
+			uint8_t											ui8Operand[3];					/**< The bytes after the opcode. */
+			bool											bConstant;						/**< The operand bytes are in read-only memory, so they can be compiled in. */
+		};
+
+		/** A block. */
+		struct LSN_BLOCK {
+			std::vector<LSN_BLOCK_INSTR>					vInstrs;						/**< The instructions, in order. */
+		};
+
+
+		// == Members.
+		const CBusA &										m_baBus;						/**< The bus from which to read the code. */
+		std::vector<uint64_t>								m_vQueue;						/**< Entry points waiting to be walked, as (table << 24) | PB:PC. */
+		std::set<uint64_t>									m_sSeen;						/**< Every entry point ever queued. */
+		std::map<uint64_t, LSN_BLOCK>						m_mBlocks;						/**< The blocks, keyed by (table << 24) | PB:PC. */
+
+
+		// == Functions.
+		/**
+		 * Reads a 16-bit vector from bank 0.
+		 *
+		 * \param _ui16Addr The address of the vector.
+		 * \return Returns the address stored in the vector.
+		 **/
+		uint16_t											ReadVector( uint16_t _ui16Addr ) const;
+
+		/**
+		 * Gets the size of an instruction.
+		 *
+		 * \param _sTable The instruction table.
+		 * \param _ui8Op The opcode.
+		 * \return Returns the size of the instruction in bytes.
+		 **/
+		static uint8_t										InstrSize( size_t _sTable, uint8_t _ui8Op );
+
+		/**
+		 * Builds the block starting at the given key, queuing its successors.
+		 *
+		 * \param _ui64Key The block's (table << 24) | PB:PC.
+		 **/
+		void												WalkBlock( uint64_t _ui64Key );
+
+		/**
+		 * Appends the C++ source of a block.
+		 *
+		 * \param _ui64Key The block's (table << 24) | PB:PC.
+		 * \param _bBlock The block.
+		 * \param _sNamespace The namespace holding the generated file's LSN_AOT_TAG.
+		 * \param _sOut The string to which to append the source.
+		 **/
+		static void											GenerateBlock( uint64_t _ui64Key, const LSN_BLOCK &_bBlock, const std::string &_sNamespace, std::string &_sOut );
+
+		/**
+		 * Appends the C++ that runs an instruction natively.  If it has run-time checks (decimal mode, page mappings), it goes to the
+		 *	instruction's end label, I<instruction>_<cycle count>, on success, and otherwise falls through to the instruction's cycle functions.
+		 *
+		 * \param _sTable The instruction table.
+		 * \param _biInstr The instruction.
+		 * \param _sIndex The index of the instruction in its block.
+		 * \param _bGuarded Set to true if the code can fall through to the instruction's cycle functions.
+		 * \param _sOut The string to which to append the source.
+		 * \return Returns true if the instruction can run natively, otherwise nothing is appended.
+		 **/
+		static bool											GenerateNative( size_t _sTable, const LSN_BLOCK_INSTR &_biInstr, size_t _sIndex, bool &_bGuarded, std::string &_sOut );
+	};
+
+}	// namespace lsn
@@ -0,0 +1,12912 @@
+/**
+ * Generated by lsn::CAotCompiler.  Do not edit; regenerate whenever the CPU core changes.
+ */
+
+#include "LSNRicoh5A22.h"
+
+#ifdef LSN_CPU_VERIFY
+
+
+namespace lsn::aotfixture {
+
+	/** Keeps these blocks apart from those generated into other files. */
+	struct LSN_AOT_TAG;
+
+}	// namespace lsn::aotfixture
+
+namespace lsn {
+
+	/** $00:801A, table 0. */
+	template <>
+	void CRicoh5A22::AotBlock<lsn::aotfixture::LSN_AOT_TAG, 0x0000801AULL>( CRicoh5A22 * _pcThis ) {
+		uint32_t ui32Idx;
+		// $00:801A: $A9.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x801B, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+			ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x801C, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0x0100801BULL );
+			BlockLogFetch( _pcThis, 0x0000801CULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x0001;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0x00 );
+			const uint32_t ui32R = ui16Val;
+			_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 2;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x801D );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x005B00801DULL ) ) { return; }
+		// $00:801D: $5B.
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 137 ) != 0 ) { goto Finish; }
+		if ( !BlockFetch( _pcThis, 0, 0x002000801EULL ) ) { return; }
+		// $00:801E: $20.
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I2_5; }
+		if ( ui32Idx == 7 ) { goto I2_7; }
+		if ( ui32Idx == 9 ) { goto I2_9; }
+		if ( ui32Idx == 11 ) { goto I2_11; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 62 );
+		if ( ui32Idx == 7 ) { goto I2_7; }
+		if ( ui32Idx == 9 ) { goto I2_9; }
+		if ( ui32Idx == 11 ) { goto I2_11; }
+		if ( ui32Idx != 5 ) { return; }
+	I2_5 :
+		if ( BlockPhi1( _pcThis, 24 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 9 ) { goto I2_9; }
+		if ( ui32Idx == 11 ) { goto I2_11; }
+		if ( ui32Idx != 7 ) { return; }
+	I2_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 84 );
+		if ( ui32Idx == 11 ) { goto I2_11; }
+		if ( ui32Idx != 9 ) { return; }
+	I2_9 :
+		if ( BlockPhi1( _pcThis, 24 ) != 10 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 85 );
+		if ( ui32Idx != 11 ) { return; }
+	I2_11 :
+		if ( BlockPhi1( _pcThis, 86 ) != 0 ) { goto Finish; }
+		BlockFetch( _pcThis, 0, UINT64_MAX );
+		return;
+	Finish :
+		BlockFinishCycle( _pcThis );
+	}
+
+	/** $00:8021, table 0. */
+	template <>
+	void CRicoh5A22::AotBlock<lsn::aotfixture::LSN_AOT_TAG, 0x00008021ULL>( CRicoh5A22 * _pcThis ) {
+		uint32_t ui32Idx;
+		// $00:8021: $E2.
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 4 );
+		if ( ui32Idx == 5 ) { goto I0_5; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx != 5 ) { return; }
+	I0_5 :
+		if ( BlockPhi1( _pcThis, 235 ) != 0 ) { goto Finish; }
+		BlockFetch( _pcThis, 0, UINT64_MAX );
+		return;
+	Finish :
+		BlockFinishCycle( _pcThis );
+	}
+
+	/** $00:8028, table 0. */
+	template <>
+	void CRicoh5A22::AotBlock<lsn::aotfixture::LSN_AOT_TAG, 0x00008028ULL>( CRicoh5A22 * _pcThis ) {
+		uint32_t ui32Idx;
+		// $00:8028: $E2.
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 4 );
+		if ( ui32Idx == 5 ) { goto I0_5; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx != 5 ) { return; }
+	I0_5 :
+		if ( BlockPhi1( _pcThis, 235 ) != 0 ) { goto Finish; }
+		BlockFetch( _pcThis, 0, UINT64_MAX );
+		return;
+	Finish :
+		BlockFinishCycle( _pcThis );
+	}
+
+	/** $00:8300, table 0. */
+	template <>
+	void CRicoh5A22::AotBlock<lsn::aotfixture::LSN_AOT_TAG, 0x00008300ULL>( CRicoh5A22 * _pcThis ) {
+		uint32_t ui32Idx;
+		// $00:8300: $A9.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8301, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+			ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8302, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0x5A008301ULL );
+			BlockLogFetch( _pcThis, 0xA5008302ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0xA55A;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0xA5 );
+			const uint32_t ui32R = ui16Val;
+			_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 2;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8303 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x0085008303ULL ) ) { return; }
+		// $00:8303: $85.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x20 );
+			if ( uint8_t( ui16Addr ) != 0xFF && _pcThis->m_baBusA.IsPlainWrite( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8304, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x20008304ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x20;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16A;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( ui16Addr, 0, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_baBusA.Write( uint16_t( ui16Addr + 1 ), 0, uint8_t( ui16Val >> 8 ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8305 );
+				goto I1_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 123 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I1_5; }
+		if ( ui32Idx == 7 ) { goto I1_7; }
+		if ( ui32Idx == 9 ) { goto I1_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I1_7; }
+		if ( ui32Idx == 9 ) { goto I1_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I1_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 39 );
+		if ( ui32Idx == 9 ) { goto I1_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I1_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 38 );
+		if ( ui32Idx != 9 ) { return; }
+	I1_9 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I1_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x00A9008305ULL ) ) { return; }
+		// $00:8305: $A9.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8306, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+			ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8307, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0xC3008306ULL );
+			BlockLogFetch( _pcThis, 0x3C008307ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x3CC3;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0x3C );
+			const uint32_t ui32R = ui16Val;
+			_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 2;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8308 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x008D008308ULL ) ) { return; }
+		// $00:8308: $8D.
+		{
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8309, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x830A, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x00008309ULL );
+				BlockLogFetch( _pcThis, 0x0300830AULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0300;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16A;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( 0x0300, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_baBusA.Write( 0x0301, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val >> 8 ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 4;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x830B );
+				goto I3_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 123 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I3_5; }
+		if ( ui32Idx == 7 ) { goto I3_7; }
+		if ( ui32Idx == 9 ) { goto I3_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I3_7; }
+		if ( ui32Idx == 9 ) { goto I3_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I3_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 61 );
+		if ( ui32Idx == 9 ) { goto I3_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I3_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 60 );
+		if ( ui32Idx != 9 ) { return; }
+	I3_9 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I3_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x00A200830BULL ) ) { return; }
+		// $00:830B: $A2.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x830C, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+			ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x830D, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0x8100830CULL );
+			BlockLogFetch( _pcThis, 0x7F00830DULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x7F81;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0x7F );
+			const uint32_t ui32R = ui16Val;
+			_pcThis->m_fsState.rRegs.ui16X = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 2;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x830E );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x008600830EULL ) ) { return; }
+		// $00:830E: $86.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x22 );
+			if ( uint8_t( ui16Addr ) != 0xFF && _pcThis->m_baBusA.IsPlainWrite( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x830F, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x2200830FULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x22;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16X;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( ui16Addr, 0, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_baBusA.Write( uint16_t( ui16Addr + 1 ), 0, uint8_t( ui16Val >> 8 ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8310 );
+				goto I5_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 171 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I5_5; }
+		if ( ui32Idx == 7 ) { goto I5_7; }
+		if ( ui32Idx == 9 ) { goto I5_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I5_7; }
+		if ( ui32Idx == 9 ) { goto I5_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I5_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 39 );
+		if ( ui32Idx == 9 ) { goto I5_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I5_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 38 );
+		if ( ui32Idx != 9 ) { return; }
+	I5_9 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I5_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x00A0008310ULL ) ) { return; }
+		// $00:8310: $A0.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8311, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+			ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8312, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0x7F008311ULL );
+			BlockLogFetch( _pcThis, 0x80008312ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x807F;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0x80 );
+			const uint32_t ui32R = ui16Val;
+			_pcThis->m_fsState.rRegs.ui16Y = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 2;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8313 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x008C008313ULL ) ) { return; }
+		// $00:8313: $8C.
+		{
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8314, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8315, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x02008314ULL );
+				BlockLogFetch( _pcThis, 0x03008315ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0302;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16Y;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( 0x0302, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_baBusA.Write( 0x0303, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val >> 8 ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 4;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8316 );
+				goto I7_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 136 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I7_5; }
+		if ( ui32Idx == 7 ) { goto I7_7; }
+		if ( ui32Idx == 9 ) { goto I7_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I7_7; }
+		if ( ui32Idx == 9 ) { goto I7_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I7_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 61 );
+		if ( ui32Idx == 9 ) { goto I7_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I7_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 60 );
+		if ( ui32Idx != 9 ) { return; }
+	I7_9 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I7_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x0064008316ULL ) ) { return; }
+		// $00:8316: $64.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x24 );
+			if ( uint8_t( ui16Addr ) != 0xFF && _pcThis->m_baBusA.IsPlainWrite( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8317, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x24008317ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x24;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = 0;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( ui16Addr, 0, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_baBusA.Write( uint16_t( ui16Addr + 1 ), 0, uint8_t( ui16Val >> 8 ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8318 );
+				goto I8_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 145 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I8_5; }
+		if ( ui32Idx == 7 ) { goto I8_7; }
+		if ( ui32Idx == 9 ) { goto I8_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I8_7; }
+		if ( ui32Idx == 9 ) { goto I8_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I8_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 39 );
+		if ( ui32Idx == 9 ) { goto I8_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I8_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 38 );
+		if ( ui32Idx != 9 ) { return; }
+	I8_9 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I8_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x009C008318ULL ) ) { return; }
+		// $00:8318: $9C.
+		{
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8319, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x831A, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x04008319ULL );
+				BlockLogFetch( _pcThis, 0x0300831AULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0304;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = 0;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( 0x0304, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_baBusA.Write( 0x0305, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val >> 8 ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 4;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x831B );
+				goto I9_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 145 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I9_5; }
+		if ( ui32Idx == 7 ) { goto I9_7; }
+		if ( ui32Idx == 9 ) { goto I9_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I9_7; }
+		if ( ui32Idx == 9 ) { goto I9_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I9_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 61 );
+		if ( ui32Idx == 9 ) { goto I9_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I9_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 60 );
+		if ( ui32Idx != 9 ) { return; }
+	I9_9 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I9_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x001800831BULL ) ) { return; }
+		// $00:831B: $18.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			_pcThis->m_fsState.rRegs.ui8Status &= 0xFE;
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x831C );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x006900831CULL ) ) { return; }
+		// $00:831C: $69.
+		{
+			if ( !(_pcThis->m_fsState.rRegs.ui8Status & D()) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x831D, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x831E, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0xF000831DULL );
+				BlockLogFetch( _pcThis, 0x7000831EULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				const uint16_t ui16Val = 0x70F0;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.SetDataBus( 0x70 );
+				const uint32_t ui32V = ui16Val;
+				const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui16A;
+				const uint32_t ui32R = ui32A + ui32V + (_pcThis->m_fsState.rRegs.ui8Status & C());
+				_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3C) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) | (ui32R > 0xFFFF ? C() : 0) | ((~(ui32A ^ ui32V) & (ui32A ^ ui32R) & 0x8000) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x831F );
+				goto I11_6;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 4 );
+		if ( ui32Idx == 5 ) { goto I11_5; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 50 );
+		if ( ui32Idx != 5 ) { return; }
+	I11_5 :
+		if ( BlockPhi1( _pcThis, 151 ) != 0 ) { goto Finish; }
+	I11_6 :
+		if ( !BlockFetch( _pcThis, 0, 0x006500831FULL ) ) { return; }
+		// $00:831F: $65.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x20 );
+			if ( !(_pcThis->m_fsState.rRegs.ui8Status & D()) && uint8_t( ui16Addr ) != 0xFF && _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8320, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x20008320ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x20;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( uint16_t( ui16Addr + 1 ), 0, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32V = ui16Val;
+				const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui16A;
+				const uint32_t ui32R = ui32A + ui32V + (_pcThis->m_fsState.rRegs.ui8Status & C());
+				_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3C) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) | (ui32R > 0xFFFF ? C() : 0) | ((~(ui32A ^ ui32V) & (ui32A ^ ui32R) & 0x8000) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8321 );
+				goto I12_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I12_5; }
+		if ( ui32Idx == 7 ) { goto I12_7; }
+		if ( ui32Idx == 9 ) { goto I12_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I12_7; }
+		if ( ui32Idx == 9 ) { goto I12_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I12_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx == 9 ) { goto I12_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I12_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 35 );
+		if ( ui32Idx != 9 ) { return; }
+	I12_9 :
+		if ( BlockPhi1( _pcThis, 142 ) != 0 ) { goto Finish; }
+	I12_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x006D008321ULL ) ) { return; }
+		// $00:8321: $6D.
+		{
+			if ( !(_pcThis->m_fsState.rRegs.ui8Status & D()) && _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8322, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8323, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x00008322ULL );
+				BlockLogFetch( _pcThis, 0x03008323ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0300;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0300, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( 0x0301, _pcThis->m_fsState.ui8Bank, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32V = ui16Val;
+				const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui16A;
+				const uint32_t ui32R = ui32A + ui32V + (_pcThis->m_fsState.rRegs.ui8Status & C());
+				_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3C) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) | (ui32R > 0xFFFF ? C() : 0) | ((~(ui32A ^ ui32V) & (ui32A ^ ui32R) & 0x8000) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 4;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8324 );
+				goto I13_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I13_5; }
+		if ( ui32Idx == 7 ) { goto I13_7; }
+		if ( ui32Idx == 9 ) { goto I13_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I13_7; }
+		if ( ui32Idx == 9 ) { goto I13_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I13_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx == 9 ) { goto I13_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I13_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 28 );
+		if ( ui32Idx != 9 ) { return; }
+	I13_9 :
+		if ( BlockPhi1( _pcThis, 142 ) != 0 ) { goto Finish; }
+	I13_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x0038008324ULL ) ) { return; }
+		// $00:8324: $38.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			_pcThis->m_fsState.rRegs.ui8Status |= 0x01;
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8325 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x00E9008325ULL ) ) { return; }
+		// $00:8325: $E9.
+		{
+			if ( !(_pcThis->m_fsState.rRegs.ui8Status & D()) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8326, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8327, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x11008326ULL );
+				BlockLogFetch( _pcThis, 0x80008327ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				const uint16_t ui16Val = 0x8011;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.SetDataBus( 0x80 );
+				const uint32_t ui32V = ui16Val ^ 0xFFFF;
+				const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui16A;
+				const uint32_t ui32R = ui32A + ui32V + (_pcThis->m_fsState.rRegs.ui8Status & C());
+				_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3C) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) | (ui32R > 0xFFFF ? C() : 0) | ((~(ui32A ^ ui32V) & (ui32A ^ ui32R) & 0x8000) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8328 );
+				goto I15_6;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 4 );
+		if ( ui32Idx == 5 ) { goto I15_5; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 50 );
+		if ( ui32Idx != 5 ) { return; }
+	I15_5 :
+		if ( BlockPhi1( _pcThis, 242 ) != 0 ) { goto Finish; }
+	I15_6 :
+		if ( !BlockFetch( _pcThis, 0, 0x00E5008328ULL ) ) { return; }
+		// $00:8328: $E5.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x22 );
+			if ( !(_pcThis->m_fsState.rRegs.ui8Status & D()) && uint8_t( ui16Addr ) != 0xFF && _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8329, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x22008329ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x22;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( uint16_t( ui16Addr + 1 ), 0, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32V = ui16Val ^ 0xFFFF;
+				const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui16A;
+				const uint32_t ui32R = ui32A + ui32V + (_pcThis->m_fsState.rRegs.ui8Status & C());
+				_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3C) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) | (ui32R > 0xFFFF ? C() : 0) | ((~(ui32A ^ ui32V) & (ui32A ^ ui32R) & 0x8000) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x832A );
+				goto I16_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I16_5; }
+		if ( ui32Idx == 7 ) { goto I16_7; }
+		if ( ui32Idx == 9 ) { goto I16_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I16_7; }
+		if ( ui32Idx == 9 ) { goto I16_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I16_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx == 9 ) { goto I16_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I16_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 35 );
+		if ( ui32Idx != 9 ) { return; }
+	I16_9 :
+		if ( BlockPhi1( _pcThis, 233 ) != 0 ) { goto Finish; }
+	I16_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x00ED00832AULL ) ) { return; }
+		// $00:832A: $ED.
+		{
+			if ( !(_pcThis->m_fsState.rRegs.ui8Status & D()) && _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x832B, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x832C, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x0200832BULL );
+				BlockLogFetch( _pcThis, 0x0300832CULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0302;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0302, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( 0x0303, _pcThis->m_fsState.ui8Bank, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32V = ui16Val ^ 0xFFFF;
+				const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui16A;
+				const uint32_t ui32R = ui32A + ui32V + (_pcThis->m_fsState.rRegs.ui8Status & C());
+				_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3C) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) | (ui32R > 0xFFFF ? C() : 0) | ((~(ui32A ^ ui32V) & (ui32A ^ ui32R) & 0x8000) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 4;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x832D );
+				goto I17_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I17_5; }
+		if ( ui32Idx == 7 ) { goto I17_7; }
+		if ( ui32Idx == 9 ) { goto I17_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I17_7; }
+		if ( ui32Idx == 9 ) { goto I17_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I17_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx == 9 ) { goto I17_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I17_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 28 );
+		if ( ui32Idx != 9 ) { return; }
+	I17_9 :
+		if ( BlockPhi1( _pcThis, 233 ) != 0 ) { goto Finish; }
+	I17_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x008500832DULL ) ) { return; }
+		// $00:832D: $85.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x26 );
+			if ( uint8_t( ui16Addr ) != 0xFF && _pcThis->m_baBusA.IsPlainWrite( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x832E, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x2600832EULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x26;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16A;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( ui16Addr, 0, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_baBusA.Write( uint16_t( ui16Addr + 1 ), 0, uint8_t( ui16Val >> 8 ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x832F );
+				goto I18_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 123 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I18_5; }
+		if ( ui32Idx == 7 ) { goto I18_7; }
+		if ( ui32Idx == 9 ) { goto I18_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I18_7; }
+		if ( ui32Idx == 9 ) { goto I18_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I18_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 39 );
+		if ( ui32Idx == 9 ) { goto I18_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I18_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 38 );
+		if ( ui32Idx != 9 ) { return; }
+	I18_9 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I18_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x000900832FULL ) ) { return; }
+		// $00:832F: $09.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8330, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+			ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8331, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0x0F008330ULL );
+			BlockLogFetch( _pcThis, 0x00008331ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x000F;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0x00 );
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16A ) | ui16Val;
+			_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 2;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8332 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x0005008332ULL ) ) { return; }
+		// $00:8332: $05.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x20 );
+			if ( uint8_t( ui16Addr ) != 0xFF && _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8333, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x20008333ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x20;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( uint16_t( ui16Addr + 1 ), 0, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16A ) | ui16Val;
+				_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8334 );
+				goto I20_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I20_5; }
+		if ( ui32Idx == 7 ) { goto I20_7; }
+		if ( ui32Idx == 9 ) { goto I20_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I20_7; }
+		if ( ui32Idx == 9 ) { goto I20_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I20_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx == 9 ) { goto I20_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I20_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 35 );
+		if ( ui32Idx != 9 ) { return; }
+	I20_9 :
+		if ( BlockPhi1( _pcThis, 29 ) != 0 ) { goto Finish; }
+	I20_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x0029008334ULL ) ) { return; }
+		// $00:8334: $29.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8335, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+			ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8336, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0xF3008335ULL );
+			BlockLogFetch( _pcThis, 0xF3008336ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0xF3F3;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0xF3 );
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16A ) & ui16Val;
+			_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 2;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8337 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x002D008337ULL ) ) { return; }
+		// $00:8337: $2D.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8338, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8339, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x00008338ULL );
+				BlockLogFetch( _pcThis, 0x03008339ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0300;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0300, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( 0x0301, _pcThis->m_fsState.ui8Bank, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16A ) & ui16Val;
+				_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 4;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x833A );
+				goto I22_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I22_5; }
+		if ( ui32Idx == 7 ) { goto I22_7; }
+		if ( ui32Idx == 9 ) { goto I22_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I22_7; }
+		if ( ui32Idx == 9 ) { goto I22_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I22_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx == 9 ) { goto I22_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I22_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 28 );
+		if ( ui32Idx != 9 ) { return; }
+	I22_9 :
+		if ( BlockPhi1( _pcThis, 87 ) != 0 ) { goto Finish; }
+	I22_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x004900833AULL ) ) { return; }
+		// $00:833A: $49.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x833B, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+			ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x833C, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0xFF00833BULL );
+			BlockLogFetch( _pcThis, 0xFF00833CULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0xFFFF;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0xFF );
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16A ) ^ ui16Val;
+			_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 2;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x833D );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x004500833DULL ) ) { return; }
+		// $00:833D: $45.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x22 );
+			if ( uint8_t( ui16Addr ) != 0xFF && _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x833E, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x2200833EULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x22;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( uint16_t( ui16Addr + 1 ), 0, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16A ) ^ ui16Val;
+				_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x833F );
+				goto I24_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I24_5; }
+		if ( ui32Idx == 7 ) { goto I24_7; }
+		if ( ui32Idx == 9 ) { goto I24_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I24_7; }
+		if ( ui32Idx == 9 ) { goto I24_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I24_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx == 9 ) { goto I24_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I24_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 35 );
+		if ( ui32Idx != 9 ) { return; }
+	I24_9 :
+		if ( BlockPhi1( _pcThis, 115 ) != 0 ) { goto Finish; }
+	I24_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x008D00833FULL ) ) { return; }
+		// $00:833F: $8D.
+		{
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8340, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8341, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x06008340ULL );
+				BlockLogFetch( _pcThis, 0x03008341ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0306;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16A;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( 0x0306, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_baBusA.Write( 0x0307, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val >> 8 ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 4;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8342 );
+				goto I25_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 123 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I25_5; }
+		if ( ui32Idx == 7 ) { goto I25_7; }
+		if ( ui32Idx == 9 ) { goto I25_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I25_7; }
+		if ( ui32Idx == 9 ) { goto I25_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I25_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 61 );
+		if ( ui32Idx == 9 ) { goto I25_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I25_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 60 );
+		if ( ui32Idx != 9 ) { return; }
+	I25_9 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I25_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x00C9008342ULL ) ) { return; }
+		// $00:8342: $C9.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8343, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+			ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8344, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0x10008343ULL );
+			BlockLogFetch( _pcThis, 0x00008344ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x0010;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0x00 );
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16A ) - ui16Val;
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) | (ui32R <= 0xFFFF ? C() : 0) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 2;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8345 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x00C5008345ULL ) ) { return; }
+		// $00:8345: $C5.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x20 );
+			if ( uint8_t( ui16Addr ) != 0xFF && _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8346, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x20008346ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x20;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( uint16_t( ui16Addr + 1 ), 0, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16A ) - ui16Val;
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) | (ui32R <= 0xFFFF ? C() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8347 );
+				goto I27_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I27_5; }
+		if ( ui32Idx == 7 ) { goto I27_7; }
+		if ( ui32Idx == 9 ) { goto I27_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I27_7; }
+		if ( ui32Idx == 9 ) { goto I27_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I27_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx == 9 ) { goto I27_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I27_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 35 );
+		if ( ui32Idx != 9 ) { return; }
+	I27_9 :
+		if ( BlockPhi1( _pcThis, 211 ) != 0 ) { goto Finish; }
+	I27_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x00CD008347ULL ) ) { return; }
+		// $00:8347: $CD.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8348, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8349, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x00008348ULL );
+				BlockLogFetch( _pcThis, 0x03008349ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0300;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0300, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( 0x0301, _pcThis->m_fsState.ui8Bank, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16A ) - ui16Val;
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) | (ui32R <= 0xFFFF ? C() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 4;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x834A );
+				goto I28_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I28_5; }
+		if ( ui32Idx == 7 ) { goto I28_7; }
+		if ( ui32Idx == 9 ) { goto I28_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I28_7; }
+		if ( ui32Idx == 9 ) { goto I28_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I28_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx == 9 ) { goto I28_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I28_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 28 );
+		if ( ui32Idx != 9 ) { return; }
+	I28_9 :
+		if ( BlockPhi1( _pcThis, 211 ) != 0 ) { goto Finish; }
+	I28_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x00E000834AULL ) ) { return; }
+		// $00:834A: $E0.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x834B, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+			ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x834C, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0x8100834BULL );
+			BlockLogFetch( _pcThis, 0x7F00834CULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x7F81;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0x7F );
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16X ) - ui16Val;
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) | (ui32R <= 0xFFFF ? C() : 0) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 2;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x834D );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x00E400834DULL ) ) { return; }
+		// $00:834D: $E4.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x22 );
+			if ( uint8_t( ui16Addr ) != 0xFF && _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x834E, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x2200834EULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x22;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( uint16_t( ui16Addr + 1 ), 0, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16X ) - ui16Val;
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) | (ui32R <= 0xFFFF ? C() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x834F );
+				goto I30_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I30_5; }
+		if ( ui32Idx == 7 ) { goto I30_7; }
+		if ( ui32Idx == 9 ) { goto I30_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I30_7; }
+		if ( ui32Idx == 9 ) { goto I30_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I30_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx == 9 ) { goto I30_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I30_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 35 );
+		if ( ui32Idx != 9 ) { return; }
+	I30_9 :
+		if ( BlockPhi1( _pcThis, 236 ) != 0 ) { goto Finish; }
+	I30_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x00EC00834FULL ) ) { return; }
+		// $00:834F: $EC.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8350, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8351, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x00008350ULL );
+				BlockLogFetch( _pcThis, 0x03008351ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0300;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0300, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( 0x0301, _pcThis->m_fsState.ui8Bank, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16X ) - ui16Val;
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) | (ui32R <= 0xFFFF ? C() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 4;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8352 );
+				goto I31_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I31_5; }
+		if ( ui32Idx == 7 ) { goto I31_7; }
+		if ( ui32Idx == 9 ) { goto I31_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I31_7; }
+		if ( ui32Idx == 9 ) { goto I31_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I31_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx == 9 ) { goto I31_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I31_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 28 );
+		if ( ui32Idx != 9 ) { return; }
+	I31_9 :
+		if ( BlockPhi1( _pcThis, 236 ) != 0 ) { goto Finish; }
+	I31_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x00C0008352ULL ) ) { return; }
+		// $00:8352: $C0.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8353, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+			ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8354, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0x80008353ULL );
+			BlockLogFetch( _pcThis, 0x00008354ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x0080;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0x00 );
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16Y ) - ui16Val;
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) | (ui32R <= 0xFFFF ? C() : 0) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 2;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8355 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x00CC008355ULL ) ) { return; }
+		// $00:8355: $CC.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8356, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8357, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x02008356ULL );
+				BlockLogFetch( _pcThis, 0x03008357ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0302;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0302, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( 0x0303, _pcThis->m_fsState.ui8Bank, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16Y ) - ui16Val;
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) | (ui32R <= 0xFFFF ? C() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 4;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8358 );
+				goto I33_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I33_5; }
+		if ( ui32Idx == 7 ) { goto I33_7; }
+		if ( ui32Idx == 9 ) { goto I33_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I33_7; }
+		if ( ui32Idx == 9 ) { goto I33_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I33_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx == 9 ) { goto I33_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I33_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 28 );
+		if ( ui32Idx != 9 ) { return; }
+	I33_9 :
+		if ( BlockPhi1( _pcThis, 214 ) != 0 ) { goto Finish; }
+	I33_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x00C4008358ULL ) ) { return; }
+		// $00:8358: $C4.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x20 );
+			if ( uint8_t( ui16Addr ) != 0xFF && _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8359, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x20008359ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x20;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( uint16_t( ui16Addr + 1 ), 0, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16Y ) - ui16Val;
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) | (ui32R <= 0xFFFF ? C() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x835A );
+				goto I34_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I34_5; }
+		if ( ui32Idx == 7 ) { goto I34_7; }
+		if ( ui32Idx == 9 ) { goto I34_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I34_7; }
+		if ( ui32Idx == 9 ) { goto I34_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I34_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx == 9 ) { goto I34_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I34_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 35 );
+		if ( ui32Idx != 9 ) { return; }
+	I34_9 :
+		if ( BlockPhi1( _pcThis, 214 ) != 0 ) { goto Finish; }
+	I34_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x008900835AULL ) ) { return; }
+		// $00:835A: $89.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x835B, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+			ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x835C, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0x4000835BULL );
+			BlockLogFetch( _pcThis, 0x4000835CULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x4040;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0x40 );
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16A ) & ui16Val;
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0xFD) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 2;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x835D );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x002400835DULL ) ) { return; }
+		// $00:835D: $24.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x20 );
+			if ( uint8_t( ui16Addr ) != 0xFF && _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x835E, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x2000835EULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x20;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( uint16_t( ui16Addr + 1 ), 0, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16A ) & ui16Val;
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3D) | ((ui16Val & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) | ((ui16Val & 0x4000) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x835F );
+				goto I36_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I36_5; }
+		if ( ui32Idx == 7 ) { goto I36_7; }
+		if ( ui32Idx == 9 ) { goto I36_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I36_7; }
+		if ( ui32Idx == 9 ) { goto I36_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I36_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx == 9 ) { goto I36_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I36_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 35 );
+		if ( ui32Idx != 9 ) { return; }
+	I36_9 :
+		if ( BlockPhi1( _pcThis, 93 ) != 0 ) { goto Finish; }
+	I36_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x002C00835FULL ) ) { return; }
+		// $00:835F: $2C.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8360, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8361, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x00008360ULL );
+				BlockLogFetch( _pcThis, 0x03008361ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0300;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0300, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( 0x0301, _pcThis->m_fsState.ui8Bank, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16A ) & ui16Val;
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3D) | ((ui16Val & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) | ((ui16Val & 0x4000) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 4;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8362 );
+				goto I37_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I37_5; }
+		if ( ui32Idx == 7 ) { goto I37_7; }
+		if ( ui32Idx == 9 ) { goto I37_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I37_7; }
+		if ( ui32Idx == 9 ) { goto I37_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I37_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx == 9 ) { goto I37_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I37_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 28 );
+		if ( ui32Idx != 9 ) { return; }
+	I37_9 :
+		if ( BlockPhi1( _pcThis, 93 ) != 0 ) { goto Finish; }
+	I37_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x001A008362ULL ) ) { return; }
+		// $00:8362: $1A.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16A ) + 1;
+			_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8363 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x003A008363ULL ) ) { return; }
+		// $00:8363: $3A.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16A ) - 1;
+			_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8364 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x00E8008364ULL ) ) { return; }
+		// $00:8364: $E8.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16X ) + 1;
+			_pcThis->m_fsState.rRegs.ui16X = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8365 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x00C8008365ULL ) ) { return; }
+		// $00:8365: $C8.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16Y ) + 1;
+			_pcThis->m_fsState.rRegs.ui16Y = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8366 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x00CA008366ULL ) ) { return; }
+		// $00:8366: $CA.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16X ) - 1;
+			_pcThis->m_fsState.rRegs.ui16X = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8367 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x0088008367ULL ) ) { return; }
+		// $00:8367: $88.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16Y ) - 1;
+			_pcThis->m_fsState.rRegs.ui16Y = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8368 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x000A008368ULL ) ) { return; }
+		// $00:8368: $0A.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16A ) << 1;
+			_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) | (ui32R > 0xFFFF ? C() : 0) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8369 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x002A008369ULL ) ) { return; }
+		// $00:8369: $2A.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = (uint32_t( _pcThis->m_fsState.rRegs.ui16A ) << 1) | (_pcThis->m_fsState.rRegs.ui8Status & C());
+			_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) | (ui32R > 0xFFFF ? C() : 0) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x836A );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x004A00836AULL ) ) { return; }
+		// $00:836A: $4A.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui16A;
+			const uint32_t ui32R = ui32A >> 1;
+			_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) | (ui32A & C()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x836B );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x006A00836BULL ) ) { return; }
+		// $00:836B: $6A.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui16A;
+			const uint32_t ui32R = (ui32A >> 1) | ((_pcThis->m_fsState.rRegs.ui8Status & C()) ? 0x8000 : 0);
+			_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) | (ui32A & C()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x836C );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x00B800836CULL ) ) { return; }
+		// $00:836C: $B8.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			_pcThis->m_fsState.rRegs.ui8Status &= 0xBF;
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x836D );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x00AA00836DULL ) ) { return; }
+		// $00:836D: $AA.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = _pcThis->m_fsState.rRegs.ui16A;
+			_pcThis->m_fsState.rRegs.ui16X = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x836E );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x00A800836EULL ) ) { return; }
+		// $00:836E: $A8.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = _pcThis->m_fsState.rRegs.ui16A;
+			_pcThis->m_fsState.rRegs.ui16Y = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x836F );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x008A00836FULL ) ) { return; }
+		// $00:836F: $8A.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = _pcThis->m_fsState.rRegs.ui16X;
+			_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8370 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x0098008370ULL ) ) { return; }
+		// $00:8370: $98.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = _pcThis->m_fsState.rRegs.ui16Y;
+			_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8371 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x009B008371ULL ) ) { return; }
+		// $00:8371: $9B.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = _pcThis->m_fsState.rRegs.ui16X;
+			_pcThis->m_fsState.rRegs.ui16Y = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8372 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x00BB008372ULL ) ) { return; }
+		// $00:8372: $BB.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = _pcThis->m_fsState.rRegs.ui16Y;
+			_pcThis->m_fsState.rRegs.ui16X = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8373 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x0085008373ULL ) ) { return; }
+		// $00:8373: $85.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x28 );
+			if ( uint8_t( ui16Addr ) != 0xFF && _pcThis->m_baBusA.IsPlainWrite( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8374, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x28008374ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x28;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16A;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( ui16Addr, 0, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_baBusA.Write( uint16_t( ui16Addr + 1 ), 0, uint8_t( ui16Val >> 8 ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8375 );
+				goto I55_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 123 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I55_5; }
+		if ( ui32Idx == 7 ) { goto I55_7; }
+		if ( ui32Idx == 9 ) { goto I55_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I55_7; }
+		if ( ui32Idx == 9 ) { goto I55_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I55_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 39 );
+		if ( ui32Idx == 9 ) { goto I55_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I55_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 38 );
+		if ( ui32Idx != 9 ) { return; }
+	I55_9 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I55_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x00A5008375ULL ) ) { return; }
+		// $00:8375: $A5.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x20 );
+			if ( uint8_t( ui16Addr ) != 0xFF && _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8376, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x20008376ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x20;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( uint16_t( ui16Addr + 1 ), 0, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = ui16Val;
+				_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8377 );
+				goto I56_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I56_5; }
+		if ( ui32Idx == 7 ) { goto I56_7; }
+		if ( ui32Idx == 9 ) { goto I56_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I56_7; }
+		if ( ui32Idx == 9 ) { goto I56_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I56_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx == 9 ) { goto I56_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I56_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 35 );
+		if ( ui32Idx != 9 ) { return; }
+	I56_9 :
+		if ( BlockPhi1( _pcThis, 188 ) != 0 ) { goto Finish; }
+	I56_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x00AE008377ULL ) ) { return; }
+		// $00:8377: $AE.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8378, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8379, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x00008378ULL );
+				BlockLogFetch( _pcThis, 0x03008379ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0300;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0300, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( 0x0301, _pcThis->m_fsState.ui8Bank, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = ui16Val;
+				_pcThis->m_fsState.rRegs.ui16X = uint16_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 4;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x837A );
+				goto I57_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I57_5; }
+		if ( ui32Idx == 7 ) { goto I57_7; }
+		if ( ui32Idx == 9 ) { goto I57_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I57_7; }
+		if ( ui32Idx == 9 ) { goto I57_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I57_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx == 9 ) { goto I57_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I57_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 28 );
+		if ( ui32Idx != 9 ) { return; }
+	I57_9 :
+		if ( BlockPhi1( _pcThis, 194 ) != 0 ) { goto Finish; }
+	I57_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x00A400837AULL ) ) { return; }
+		// $00:837A: $A4.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x22 );
+			if ( uint8_t( ui16Addr ) != 0xFF && _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x837B, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x2200837BULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x22;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( uint16_t( ui16Addr + 1 ), 0, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = ui16Val;
+				_pcThis->m_fsState.rRegs.ui16Y = uint16_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x837C );
+				goto I58_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I58_5; }
+		if ( ui32Idx == 7 ) { goto I58_7; }
+		if ( ui32Idx == 9 ) { goto I58_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I58_7; }
+		if ( ui32Idx == 9 ) { goto I58_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I58_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx == 9 ) { goto I58_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I58_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 35 );
+		if ( ui32Idx != 9 ) { return; }
+	I58_9 :
+		if ( BlockPhi1( _pcThis, 192 ) != 0 ) { goto Finish; }
+	I58_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x00AD00837CULL ) ) { return; }
+		// $00:837C: $AD.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x837D, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x837E, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x0200837DULL );
+				BlockLogFetch( _pcThis, 0x0300837EULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0302;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0302, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( 0x0303, _pcThis->m_fsState.ui8Bank, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = ui16Val;
+				_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 4;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x837F );
+				goto I59_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I59_5; }
+		if ( ui32Idx == 7 ) { goto I59_7; }
+		if ( ui32Idx == 9 ) { goto I59_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I59_7; }
+		if ( ui32Idx == 9 ) { goto I59_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I59_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx == 9 ) { goto I59_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I59_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 28 );
+		if ( ui32Idx != 9 ) { return; }
+	I59_9 :
+		if ( BlockPhi1( _pcThis, 188 ) != 0 ) { goto Finish; }
+	I59_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x00A600837FULL ) ) { return; }
+		// $00:837F: $A6.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x24 );
+			if ( uint8_t( ui16Addr ) != 0xFF && _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8380, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x24008380ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x24;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( uint16_t( ui16Addr + 1 ), 0, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = ui16Val;
+				_pcThis->m_fsState.rRegs.ui16X = uint16_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8381 );
+				goto I60_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I60_5; }
+		if ( ui32Idx == 7 ) { goto I60_7; }
+		if ( ui32Idx == 9 ) { goto I60_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I60_7; }
+		if ( ui32Idx == 9 ) { goto I60_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I60_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx == 9 ) { goto I60_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I60_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 35 );
+		if ( ui32Idx != 9 ) { return; }
+	I60_9 :
+		if ( BlockPhi1( _pcThis, 194 ) != 0 ) { goto Finish; }
+	I60_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x00AC008381ULL ) ) { return; }
+		// $00:8381: $AC.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8382, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8383, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x04008382ULL );
+				BlockLogFetch( _pcThis, 0x03008383ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0304;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0304, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( 0x0305, _pcThis->m_fsState.ui8Bank, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = ui16Val;
+				_pcThis->m_fsState.rRegs.ui16Y = uint16_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 4;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8384 );
+				goto I61_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I61_5; }
+		if ( ui32Idx == 7 ) { goto I61_7; }
+		if ( ui32Idx == 9 ) { goto I61_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I61_7; }
+		if ( ui32Idx == 9 ) { goto I61_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I61_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx == 9 ) { goto I61_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I61_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 28 );
+		if ( ui32Idx != 9 ) { return; }
+	I61_9 :
+		if ( BlockPhi1( _pcThis, 192 ) != 0 ) { goto Finish; }
+	I61_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x0085008384ULL ) ) { return; }
+		// $00:8384: $85.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x2A );
+			if ( uint8_t( ui16Addr ) != 0xFF && _pcThis->m_baBusA.IsPlainWrite( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8385, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x2A008385ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x2A;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16A;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( ui16Addr, 0, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_baBusA.Write( uint16_t( ui16Addr + 1 ), 0, uint8_t( ui16Val >> 8 ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8386 );
+				goto I62_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 123 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I62_5; }
+		if ( ui32Idx == 7 ) { goto I62_7; }
+		if ( ui32Idx == 9 ) { goto I62_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I62_7; }
+		if ( ui32Idx == 9 ) { goto I62_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I62_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 39 );
+		if ( ui32Idx == 9 ) { goto I62_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I62_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 38 );
+		if ( ui32Idx != 9 ) { return; }
+	I62_9 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I62_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x008E008386ULL ) ) { return; }
+		// $00:8386: $8E.
+		{
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8387, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8388, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x08008387ULL );
+				BlockLogFetch( _pcThis, 0x03008388ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0308;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16X;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( 0x0308, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_baBusA.Write( 0x0309, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val >> 8 ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 4;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8389 );
+				goto I63_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 171 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I63_5; }
+		if ( ui32Idx == 7 ) { goto I63_7; }
+		if ( ui32Idx == 9 ) { goto I63_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I63_7; }
+		if ( ui32Idx == 9 ) { goto I63_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I63_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 61 );
+		if ( ui32Idx == 9 ) { goto I63_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I63_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 60 );
+		if ( ui32Idx != 9 ) { return; }
+	I63_9 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I63_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x0084008389ULL ) ) { return; }
+		// $00:8389: $84.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x2C );
+			if ( uint8_t( ui16Addr ) != 0xFF && _pcThis->m_baBusA.IsPlainWrite( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x838A, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x2C00838AULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x2C;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16Y;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( ui16Addr, 0, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_baBusA.Write( uint16_t( ui16Addr + 1 ), 0, uint8_t( ui16Val >> 8 ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x838B );
+				goto I64_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 136 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I64_5; }
+		if ( ui32Idx == 7 ) { goto I64_7; }
+		if ( ui32Idx == 9 ) { goto I64_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I64_7; }
+		if ( ui32Idx == 9 ) { goto I64_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I64_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 39 );
+		if ( ui32Idx == 9 ) { goto I64_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I64_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 38 );
+		if ( ui32Idx != 9 ) { return; }
+	I64_9 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I64_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x008D00838BULL ) ) { return; }
+		// $00:838B: $8D.
+		{
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x838C, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x838D, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x0A00838CULL );
+				BlockLogFetch( _pcThis, 0x0300838DULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x030A;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16A;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( 0x030A, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_baBusA.Write( 0x030B, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val >> 8 ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 4;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x838E );
+				goto I65_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 123 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I65_5; }
+		if ( ui32Idx == 7 ) { goto I65_7; }
+		if ( ui32Idx == 9 ) { goto I65_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I65_7; }
+		if ( ui32Idx == 9 ) { goto I65_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I65_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 61 );
+		if ( ui32Idx == 9 ) { goto I65_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I65_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 60 );
+		if ( ui32Idx != 9 ) { return; }
+	I65_9 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I65_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x00EA00838EULL ) ) { return; }
+		// $00:838E: $EA.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x838F );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x00F800838FULL ) ) { return; }
+		// $00:838F: $F8.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			_pcThis->m_fsState.rRegs.ui8Status |= 0x08;
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8390 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x0069008390ULL ) ) { return; }
+		// $00:8390: $69.
+		{
+			if ( !(_pcThis->m_fsState.rRegs.ui8Status & D()) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8391, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8392, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x19008391ULL );
+				BlockLogFetch( _pcThis, 0x19008392ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				const uint16_t ui16Val = 0x1919;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.SetDataBus( 0x19 );
+				const uint32_t ui32V = ui16Val;
+				const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui16A;
+				const uint32_t ui32R = ui32A + ui32V + (_pcThis->m_fsState.rRegs.ui8Status & C());
+				_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3C) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) | (ui32R > 0xFFFF ? C() : 0) | ((~(ui32A ^ ui32V) & (ui32A ^ ui32R) & 0x8000) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8393 );
+				goto I68_6;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 4 );
+		if ( ui32Idx == 5 ) { goto I68_5; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 50 );
+		if ( ui32Idx != 5 ) { return; }
+	I68_5 :
+		if ( BlockPhi1( _pcThis, 151 ) != 0 ) { goto Finish; }
+	I68_6 :
+		if ( !BlockFetch( _pcThis, 0, 0x00E5008393ULL ) ) { return; }
+		// $00:8393: $E5.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x20 );
+			if ( !(_pcThis->m_fsState.rRegs.ui8Status & D()) && uint8_t( ui16Addr ) != 0xFF && _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8394, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x20008394ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x20;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( uint16_t( ui16Addr + 1 ), 0, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32V = ui16Val ^ 0xFFFF;
+				const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui16A;
+				const uint32_t ui32R = ui32A + ui32V + (_pcThis->m_fsState.rRegs.ui8Status & C());
+				_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3C) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) | (ui32R > 0xFFFF ? C() : 0) | ((~(ui32A ^ ui32V) & (ui32A ^ ui32R) & 0x8000) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8395 );
+				goto I69_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I69_5; }
+		if ( ui32Idx == 7 ) { goto I69_7; }
+		if ( ui32Idx == 9 ) { goto I69_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I69_7; }
+		if ( ui32Idx == 9 ) { goto I69_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I69_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx == 9 ) { goto I69_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I69_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 35 );
+		if ( ui32Idx != 9 ) { return; }
+	I69_9 :
+		if ( BlockPhi1( _pcThis, 233 ) != 0 ) { goto Finish; }
+	I69_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x00D8008395ULL ) ) { return; }
+		// $00:8395: $D8.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			_pcThis->m_fsState.rRegs.ui8Status &= 0xF7;
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8396 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x00A5008396ULL ) ) { return; }
+		// $00:8396: $A5.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0xFE );
+			if ( uint8_t( ui16Addr ) != 0xFF && _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8397, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0xFE008397ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0xFE;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( uint16_t( ui16Addr + 1 ), 0, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = ui16Val;
+				_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8398 );
+				goto I71_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I71_5; }
+		if ( ui32Idx == 7 ) { goto I71_7; }
+		if ( ui32Idx == 9 ) { goto I71_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I71_7; }
+		if ( ui32Idx == 9 ) { goto I71_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I71_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx == 9 ) { goto I71_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I71_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 35 );
+		if ( ui32Idx != 9 ) { return; }
+	I71_9 :
+		if ( BlockPhi1( _pcThis, 188 ) != 0 ) { goto Finish; }
+	I71_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x00AD008398ULL ) ) { return; }
+		// $00:8398: $AD.
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I72_5; }
+		if ( ui32Idx == 7 ) { goto I72_7; }
+		if ( ui32Idx == 9 ) { goto I72_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I72_7; }
+		if ( ui32Idx == 9 ) { goto I72_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I72_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx == 9 ) { goto I72_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I72_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 28 );
+		if ( ui32Idx != 9 ) { return; }
+	I72_9 :
+		if ( BlockPhi1( _pcThis, 188 ) != 0 ) { goto Finish; }
+		if ( !BlockFetch( _pcThis, 0, 0x00AD00839BULL ) ) { return; }
+		// $00:839B: $AD.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x8F ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x839C, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x839D, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x8000839CULL );
+				BlockLogFetch( _pcThis, 0x8F00839DULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x8F80;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x8F80, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( 0x8F81, _pcThis->m_fsState.ui8Bank, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = ui16Val;
+				_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 4;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x839E );
+				goto I73_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I73_5; }
+		if ( ui32Idx == 7 ) { goto I73_7; }
+		if ( ui32Idx == 9 ) { goto I73_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I73_7; }
+		if ( ui32Idx == 9 ) { goto I73_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I73_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx == 9 ) { goto I73_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I73_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 28 );
+		if ( ui32Idx != 9 ) { return; }
+	I73_9 :
+		if ( BlockPhi1( _pcThis, 188 ) != 0 ) { goto Finish; }
+	I73_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x008D00839EULL ) ) { return; }
+		// $00:839E: $8D.
+		{
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x8F ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x839F, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x83A0, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x8000839FULL );
+				BlockLogFetch( _pcThis, 0x8F0083A0ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x8F80;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16A;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( 0x8F80, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_baBusA.Write( 0x8F81, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val >> 8 ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 4;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x83A1 );
+				goto I74_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 123 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I74_5; }
+		if ( ui32Idx == 7 ) { goto I74_7; }
+		if ( ui32Idx == 9 ) { goto I74_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I74_7; }
+		if ( ui32Idx == 9 ) { goto I74_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I74_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 61 );
+		if ( ui32Idx == 9 ) { goto I74_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I74_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 60 );
+		if ( ui32Idx != 9 ) { return; }
+	I74_9 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I74_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x00600083A1ULL ) ) { return; }
+		// $00:83A1: $60.
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 5 ) { goto I75_5; }
+		if ( ui32Idx == 7 ) { goto I75_7; }
+		if ( ui32Idx == 9 ) { goto I75_9; }
+		if ( ui32Idx == 11 ) { goto I75_11; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 24 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I75_7; }
+		if ( ui32Idx == 9 ) { goto I75_9; }
+		if ( ui32Idx == 11 ) { goto I75_11; }
+		if ( ui32Idx != 5 ) { return; }
+	I75_5 :
+		if ( BlockPhi1( _pcThis, 24 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 139 );
+		if ( ui32Idx == 9 ) { goto I75_9; }
+		if ( ui32Idx == 11 ) { goto I75_11; }
+		if ( ui32Idx != 7 ) { return; }
+	I75_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 140 );
+		if ( ui32Idx == 11 ) { goto I75_11; }
+		if ( ui32Idx != 9 ) { return; }
+	I75_9 :
+		if ( BlockPhi1( _pcThis, 24 ) != 10 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx != 11 ) { return; }
+	I75_11 :
+		if ( BlockPhi1( _pcThis, 141 ) != 0 ) { goto Finish; }
+		BlockFetch( _pcThis, 0, UINT64_MAX );
+		return;
+	Finish :
+		BlockFinishCycle( _pcThis );
+	}
+
+	/** $00:802A, table 1. */
+	template <>
+	void CRicoh5A22::AotBlock<lsn::aotfixture::LSN_AOT_TAG, 0x0100802AULL>( CRicoh5A22 * _pcThis ) {
+		uint32_t ui32Idx;
+		// $00:802A: $20.
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I0_5; }
+		if ( ui32Idx == 7 ) { goto I0_7; }
+		if ( ui32Idx == 9 ) { goto I0_9; }
+		if ( ui32Idx == 11 ) { goto I0_11; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 62 );
+		if ( ui32Idx == 7 ) { goto I0_7; }
+		if ( ui32Idx == 9 ) { goto I0_9; }
+		if ( ui32Idx == 11 ) { goto I0_11; }
+		if ( ui32Idx != 5 ) { return; }
+	I0_5 :
+		if ( BlockPhi1( _pcThis, 24 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 9 ) { goto I0_9; }
+		if ( ui32Idx == 11 ) { goto I0_11; }
+		if ( ui32Idx != 7 ) { return; }
+	I0_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 84 );
+		if ( ui32Idx == 11 ) { goto I0_11; }
+		if ( ui32Idx != 9 ) { return; }
+	I0_9 :
+		if ( BlockPhi1( _pcThis, 24 ) != 10 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 85 );
+		if ( ui32Idx != 11 ) { return; }
+	I0_11 :
+		if ( BlockPhi1( _pcThis, 86 ) != 0 ) { goto Finish; }
+		BlockFetch( _pcThis, 0, UINT64_MAX );
+		return;
+	Finish :
+		BlockFinishCycle( _pcThis );
+	}
+
+	/** $00:802D, table 1. */
+	template <>
+	void CRicoh5A22::AotBlock<lsn::aotfixture::LSN_AOT_TAG, 0x0100802DULL>( CRicoh5A22 * _pcThis ) {
+		uint32_t ui32Idx;
+		// $00:802D: $80.
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 169 );
+		if ( ui32Idx == 5 ) { goto I0_5; }
+		if ( ui32Idx == 7 ) { goto I0_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 24 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I0_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I0_5 :
+		if ( BlockPhi1( _pcThis, 24 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx != 7 ) { return; }
+	I0_7 :
+		if ( BlockPhi1( _pcThis, 65 ) != 0 ) { goto Finish; }
+		BlockFetch( _pcThis, 0, UINT64_MAX );
+		return;
+	Finish :
+		BlockFinishCycle( _pcThis );
+	}
+
+	/** $00:802F, table 1. */
+	template <>
+	void CRicoh5A22::AotBlock<lsn::aotfixture::LSN_AOT_TAG, 0x0100802FULL>( CRicoh5A22 * _pcThis ) {
+		uint32_t ui32Idx;
+		// $00:802F: $DB.
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 5 ) { goto I0_5; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 24 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 229 );
+		if ( ui32Idx != 5 ) { return; }
+	I0_5 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+		BlockFetch( _pcThis, 0, UINT64_MAX );
+		return;
+	Finish :
+		BlockFinishCycle( _pcThis );
+	}
+
+	/** $00:8500, table 1. */
+	template <>
+	void CRicoh5A22::AotBlock<lsn::aotfixture::LSN_AOT_TAG, 0x01008500ULL>( CRicoh5A22 * _pcThis ) {
+		uint32_t ui32Idx;
+		// $00:8500: $A9.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8501, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+			ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8502, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0x5A008501ULL );
+			BlockLogFetch( _pcThis, 0xA5008502ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0xA55A;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0xA5 );
+			const uint32_t ui32R = ui16Val;
+			_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 2;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8503 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x0185008503ULL ) ) { return; }
+		// $00:8503: $85.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x20 );
+			if ( uint8_t( ui16Addr ) != 0xFF && _pcThis->m_baBusA.IsPlainWrite( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8504, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x20008504ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x20;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16A;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( ui16Addr, 0, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_baBusA.Write( uint16_t( ui16Addr + 1 ), 0, uint8_t( ui16Val >> 8 ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8505 );
+				goto I1_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 123 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I1_5; }
+		if ( ui32Idx == 7 ) { goto I1_7; }
+		if ( ui32Idx == 9 ) { goto I1_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I1_7; }
+		if ( ui32Idx == 9 ) { goto I1_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I1_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 39 );
+		if ( ui32Idx == 9 ) { goto I1_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I1_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 38 );
+		if ( ui32Idx != 9 ) { return; }
+	I1_9 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I1_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x01A9008505ULL ) ) { return; }
+		// $00:8505: $A9.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8506, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+			ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8507, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0xC3008506ULL );
+			BlockLogFetch( _pcThis, 0x3C008507ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x3CC3;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0x3C );
+			const uint32_t ui32R = ui16Val;
+			_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 2;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8508 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x018D008508ULL ) ) { return; }
+		// $00:8508: $8D.
+		{
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8509, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x850A, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x00008509ULL );
+				BlockLogFetch( _pcThis, 0x0300850AULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0300;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16A;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( 0x0300, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_baBusA.Write( 0x0301, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val >> 8 ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 4;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x850B );
+				goto I3_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 123 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I3_5; }
+		if ( ui32Idx == 7 ) { goto I3_7; }
+		if ( ui32Idx == 9 ) { goto I3_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I3_7; }
+		if ( ui32Idx == 9 ) { goto I3_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I3_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 61 );
+		if ( ui32Idx == 9 ) { goto I3_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I3_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 60 );
+		if ( ui32Idx != 9 ) { return; }
+	I3_9 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I3_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x01A200850BULL ) ) { return; }
+		// $00:850B: $A2.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x850C, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0x8100850CULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x0081;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0x81 );
+			const uint32_t ui32R = ui16Val;
+			_pcThis->m_fsState.rRegs.ui8X[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x850D );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x018600850DULL ) ) { return; }
+		// $00:850D: $86.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x22 );
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x850E, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x2200850EULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x22;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16X;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( ui16Addr, 0, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x850F );
+				goto I5_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 171 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I5_5; }
+		if ( ui32Idx == 7 ) { goto I5_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I5_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I5_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 39 );
+		if ( ui32Idx != 7 ) { return; }
+	I5_7 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I5_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x01A000850FULL ) ) { return; }
+		// $00:850F: $A0.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8510, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0x7F008510ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x007F;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0x7F );
+			const uint32_t ui32R = ui16Val;
+			_pcThis->m_fsState.rRegs.ui8Y[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8511 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x018C008511ULL ) ) { return; }
+		// $00:8511: $8C.
+		{
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8512, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8513, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x02008512ULL );
+				BlockLogFetch( _pcThis, 0x03008513ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0302;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16Y;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( 0x0302, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8514 );
+				goto I7_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 136 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I7_5; }
+		if ( ui32Idx == 7 ) { goto I7_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I7_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I7_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 61 );
+		if ( ui32Idx != 7 ) { return; }
+	I7_7 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I7_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x0164008514ULL ) ) { return; }
+		// $00:8514: $64.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x24 );
+			if ( uint8_t( ui16Addr ) != 0xFF && _pcThis->m_baBusA.IsPlainWrite( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8515, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x24008515ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x24;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = 0;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( ui16Addr, 0, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_baBusA.Write( uint16_t( ui16Addr + 1 ), 0, uint8_t( ui16Val >> 8 ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8516 );
+				goto I8_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 145 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I8_5; }
+		if ( ui32Idx == 7 ) { goto I8_7; }
+		if ( ui32Idx == 9 ) { goto I8_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I8_7; }
+		if ( ui32Idx == 9 ) { goto I8_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I8_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 39 );
+		if ( ui32Idx == 9 ) { goto I8_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I8_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 38 );
+		if ( ui32Idx != 9 ) { return; }
+	I8_9 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I8_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x019C008516ULL ) ) { return; }
+		// $00:8516: $9C.
+		{
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8517, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8518, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x04008517ULL );
+				BlockLogFetch( _pcThis, 0x03008518ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0304;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = 0;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( 0x0304, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_baBusA.Write( 0x0305, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val >> 8 ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 4;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8519 );
+				goto I9_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 145 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I9_5; }
+		if ( ui32Idx == 7 ) { goto I9_7; }
+		if ( ui32Idx == 9 ) { goto I9_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I9_7; }
+		if ( ui32Idx == 9 ) { goto I9_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I9_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 61 );
+		if ( ui32Idx == 9 ) { goto I9_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I9_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 60 );
+		if ( ui32Idx != 9 ) { return; }
+	I9_9 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I9_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x0118008519ULL ) ) { return; }
+		// $00:8519: $18.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			_pcThis->m_fsState.rRegs.ui8Status &= 0xFE;
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x851A );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x016900851AULL ) ) { return; }
+		// $00:851A: $69.
+		{
+			if ( !(_pcThis->m_fsState.rRegs.ui8Status & D()) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x851B, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x851C, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0xF000851BULL );
+				BlockLogFetch( _pcThis, 0x7000851CULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				const uint16_t ui16Val = 0x70F0;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.SetDataBus( 0x70 );
+				const uint32_t ui32V = ui16Val;
+				const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui16A;
+				const uint32_t ui32R = ui32A + ui32V + (_pcThis->m_fsState.rRegs.ui8Status & C());
+				_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3C) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) | (ui32R > 0xFFFF ? C() : 0) | ((~(ui32A ^ ui32V) & (ui32A ^ ui32R) & 0x8000) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x851D );
+				goto I11_6;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 4 );
+		if ( ui32Idx == 5 ) { goto I11_5; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 50 );
+		if ( ui32Idx != 5 ) { return; }
+	I11_5 :
+		if ( BlockPhi1( _pcThis, 151 ) != 0 ) { goto Finish; }
+	I11_6 :
+		if ( !BlockFetch( _pcThis, 0, 0x016500851DULL ) ) { return; }
+		// $00:851D: $65.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x20 );
+			if ( !(_pcThis->m_fsState.rRegs.ui8Status & D()) && uint8_t( ui16Addr ) != 0xFF && _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x851E, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x2000851EULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x20;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( uint16_t( ui16Addr + 1 ), 0, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32V = ui16Val;
+				const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui16A;
+				const uint32_t ui32R = ui32A + ui32V + (_pcThis->m_fsState.rRegs.ui8Status & C());
+				_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3C) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) | (ui32R > 0xFFFF ? C() : 0) | ((~(ui32A ^ ui32V) & (ui32A ^ ui32R) & 0x8000) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x851F );
+				goto I12_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I12_5; }
+		if ( ui32Idx == 7 ) { goto I12_7; }
+		if ( ui32Idx == 9 ) { goto I12_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I12_7; }
+		if ( ui32Idx == 9 ) { goto I12_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I12_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx == 9 ) { goto I12_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I12_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 35 );
+		if ( ui32Idx != 9 ) { return; }
+	I12_9 :
+		if ( BlockPhi1( _pcThis, 142 ) != 0 ) { goto Finish; }
+	I12_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x016D00851FULL ) ) { return; }
+		// $00:851F: $6D.
+		{
+			if ( !(_pcThis->m_fsState.rRegs.ui8Status & D()) && _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8520, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8521, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x00008520ULL );
+				BlockLogFetch( _pcThis, 0x03008521ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0300;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0300, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( 0x0301, _pcThis->m_fsState.ui8Bank, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32V = ui16Val;
+				const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui16A;
+				const uint32_t ui32R = ui32A + ui32V + (_pcThis->m_fsState.rRegs.ui8Status & C());
+				_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3C) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) | (ui32R > 0xFFFF ? C() : 0) | ((~(ui32A ^ ui32V) & (ui32A ^ ui32R) & 0x8000) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 4;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8522 );
+				goto I13_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I13_5; }
+		if ( ui32Idx == 7 ) { goto I13_7; }
+		if ( ui32Idx == 9 ) { goto I13_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I13_7; }
+		if ( ui32Idx == 9 ) { goto I13_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I13_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx == 9 ) { goto I13_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I13_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 28 );
+		if ( ui32Idx != 9 ) { return; }
+	I13_9 :
+		if ( BlockPhi1( _pcThis, 142 ) != 0 ) { goto Finish; }
+	I13_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x0138008522ULL ) ) { return; }
+		// $00:8522: $38.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			_pcThis->m_fsState.rRegs.ui8Status |= 0x01;
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8523 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x01E9008523ULL ) ) { return; }
+		// $00:8523: $E9.
+		{
+			if ( !(_pcThis->m_fsState.rRegs.ui8Status & D()) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8524, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8525, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x11008524ULL );
+				BlockLogFetch( _pcThis, 0x80008525ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				const uint16_t ui16Val = 0x8011;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.SetDataBus( 0x80 );
+				const uint32_t ui32V = ui16Val ^ 0xFFFF;
+				const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui16A;
+				const uint32_t ui32R = ui32A + ui32V + (_pcThis->m_fsState.rRegs.ui8Status & C());
+				_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3C) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) | (ui32R > 0xFFFF ? C() : 0) | ((~(ui32A ^ ui32V) & (ui32A ^ ui32R) & 0x8000) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8526 );
+				goto I15_6;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 4 );
+		if ( ui32Idx == 5 ) { goto I15_5; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 50 );
+		if ( ui32Idx != 5 ) { return; }
+	I15_5 :
+		if ( BlockPhi1( _pcThis, 242 ) != 0 ) { goto Finish; }
+	I15_6 :
+		if ( !BlockFetch( _pcThis, 0, 0x01E5008526ULL ) ) { return; }
+		// $00:8526: $E5.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x22 );
+			if ( !(_pcThis->m_fsState.rRegs.ui8Status & D()) && uint8_t( ui16Addr ) != 0xFF && _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8527, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x22008527ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x22;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( uint16_t( ui16Addr + 1 ), 0, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32V = ui16Val ^ 0xFFFF;
+				const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui16A;
+				const uint32_t ui32R = ui32A + ui32V + (_pcThis->m_fsState.rRegs.ui8Status & C());
+				_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3C) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) | (ui32R > 0xFFFF ? C() : 0) | ((~(ui32A ^ ui32V) & (ui32A ^ ui32R) & 0x8000) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8528 );
+				goto I16_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I16_5; }
+		if ( ui32Idx == 7 ) { goto I16_7; }
+		if ( ui32Idx == 9 ) { goto I16_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I16_7; }
+		if ( ui32Idx == 9 ) { goto I16_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I16_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx == 9 ) { goto I16_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I16_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 35 );
+		if ( ui32Idx != 9 ) { return; }
+	I16_9 :
+		if ( BlockPhi1( _pcThis, 233 ) != 0 ) { goto Finish; }
+	I16_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x01ED008528ULL ) ) { return; }
+		// $00:8528: $ED.
+		{
+			if ( !(_pcThis->m_fsState.rRegs.ui8Status & D()) && _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8529, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x852A, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x02008529ULL );
+				BlockLogFetch( _pcThis, 0x0300852AULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0302;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0302, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( 0x0303, _pcThis->m_fsState.ui8Bank, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32V = ui16Val ^ 0xFFFF;
+				const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui16A;
+				const uint32_t ui32R = ui32A + ui32V + (_pcThis->m_fsState.rRegs.ui8Status & C());
+				_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3C) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) | (ui32R > 0xFFFF ? C() : 0) | ((~(ui32A ^ ui32V) & (ui32A ^ ui32R) & 0x8000) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 4;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x852B );
+				goto I17_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I17_5; }
+		if ( ui32Idx == 7 ) { goto I17_7; }
+		if ( ui32Idx == 9 ) { goto I17_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I17_7; }
+		if ( ui32Idx == 9 ) { goto I17_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I17_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx == 9 ) { goto I17_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I17_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 28 );
+		if ( ui32Idx != 9 ) { return; }
+	I17_9 :
+		if ( BlockPhi1( _pcThis, 233 ) != 0 ) { goto Finish; }
+	I17_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x018500852BULL ) ) { return; }
+		// $00:852B: $85.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x26 );
+			if ( uint8_t( ui16Addr ) != 0xFF && _pcThis->m_baBusA.IsPlainWrite( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x852C, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x2600852CULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x26;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16A;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( ui16Addr, 0, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_baBusA.Write( uint16_t( ui16Addr + 1 ), 0, uint8_t( ui16Val >> 8 ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x852D );
+				goto I18_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 123 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I18_5; }
+		if ( ui32Idx == 7 ) { goto I18_7; }
+		if ( ui32Idx == 9 ) { goto I18_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I18_7; }
+		if ( ui32Idx == 9 ) { goto I18_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I18_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 39 );
+		if ( ui32Idx == 9 ) { goto I18_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I18_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 38 );
+		if ( ui32Idx != 9 ) { return; }
+	I18_9 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I18_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x010900852DULL ) ) { return; }
+		// $00:852D: $09.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x852E, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+			ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x852F, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0x0F00852EULL );
+			BlockLogFetch( _pcThis, 0x0000852FULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x000F;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0x00 );
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16A ) | ui16Val;
+			_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 2;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8530 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x0105008530ULL ) ) { return; }
+		// $00:8530: $05.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x20 );
+			if ( uint8_t( ui16Addr ) != 0xFF && _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8531, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x20008531ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x20;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( uint16_t( ui16Addr + 1 ), 0, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16A ) | ui16Val;
+				_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8532 );
+				goto I20_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I20_5; }
+		if ( ui32Idx == 7 ) { goto I20_7; }
+		if ( ui32Idx == 9 ) { goto I20_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I20_7; }
+		if ( ui32Idx == 9 ) { goto I20_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I20_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx == 9 ) { goto I20_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I20_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 35 );
+		if ( ui32Idx != 9 ) { return; }
+	I20_9 :
+		if ( BlockPhi1( _pcThis, 29 ) != 0 ) { goto Finish; }
+	I20_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x0129008532ULL ) ) { return; }
+		// $00:8532: $29.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8533, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+			ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8534, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0xF3008533ULL );
+			BlockLogFetch( _pcThis, 0xF3008534ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0xF3F3;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0xF3 );
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16A ) & ui16Val;
+			_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 2;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8535 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x012D008535ULL ) ) { return; }
+		// $00:8535: $2D.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8536, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8537, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x00008536ULL );
+				BlockLogFetch( _pcThis, 0x03008537ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0300;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0300, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( 0x0301, _pcThis->m_fsState.ui8Bank, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16A ) & ui16Val;
+				_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 4;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8538 );
+				goto I22_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I22_5; }
+		if ( ui32Idx == 7 ) { goto I22_7; }
+		if ( ui32Idx == 9 ) { goto I22_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I22_7; }
+		if ( ui32Idx == 9 ) { goto I22_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I22_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx == 9 ) { goto I22_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I22_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 28 );
+		if ( ui32Idx != 9 ) { return; }
+	I22_9 :
+		if ( BlockPhi1( _pcThis, 87 ) != 0 ) { goto Finish; }
+	I22_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x0149008538ULL ) ) { return; }
+		// $00:8538: $49.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8539, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+			ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x853A, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0xFF008539ULL );
+			BlockLogFetch( _pcThis, 0xFF00853AULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0xFFFF;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0xFF );
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16A ) ^ ui16Val;
+			_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 2;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x853B );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x014500853BULL ) ) { return; }
+		// $00:853B: $45.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x22 );
+			if ( uint8_t( ui16Addr ) != 0xFF && _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x853C, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x2200853CULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x22;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( uint16_t( ui16Addr + 1 ), 0, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16A ) ^ ui16Val;
+				_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x853D );
+				goto I24_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I24_5; }
+		if ( ui32Idx == 7 ) { goto I24_7; }
+		if ( ui32Idx == 9 ) { goto I24_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I24_7; }
+		if ( ui32Idx == 9 ) { goto I24_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I24_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx == 9 ) { goto I24_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I24_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 35 );
+		if ( ui32Idx != 9 ) { return; }
+	I24_9 :
+		if ( BlockPhi1( _pcThis, 115 ) != 0 ) { goto Finish; }
+	I24_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x018D00853DULL ) ) { return; }
+		// $00:853D: $8D.
+		{
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x853E, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x853F, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x0600853EULL );
+				BlockLogFetch( _pcThis, 0x0300853FULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0306;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16A;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( 0x0306, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_baBusA.Write( 0x0307, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val >> 8 ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 4;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8540 );
+				goto I25_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 123 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I25_5; }
+		if ( ui32Idx == 7 ) { goto I25_7; }
+		if ( ui32Idx == 9 ) { goto I25_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I25_7; }
+		if ( ui32Idx == 9 ) { goto I25_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I25_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 61 );
+		if ( ui32Idx == 9 ) { goto I25_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I25_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 60 );
+		if ( ui32Idx != 9 ) { return; }
+	I25_9 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I25_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x01C9008540ULL ) ) { return; }
+		// $00:8540: $C9.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8541, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+			ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8542, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0x10008541ULL );
+			BlockLogFetch( _pcThis, 0x00008542ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x0010;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0x00 );
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16A ) - ui16Val;
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) | (ui32R <= 0xFFFF ? C() : 0) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 2;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8543 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x01C5008543ULL ) ) { return; }
+		// $00:8543: $C5.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x20 );
+			if ( uint8_t( ui16Addr ) != 0xFF && _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8544, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x20008544ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x20;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( uint16_t( ui16Addr + 1 ), 0, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16A ) - ui16Val;
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) | (ui32R <= 0xFFFF ? C() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8545 );
+				goto I27_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I27_5; }
+		if ( ui32Idx == 7 ) { goto I27_7; }
+		if ( ui32Idx == 9 ) { goto I27_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I27_7; }
+		if ( ui32Idx == 9 ) { goto I27_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I27_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx == 9 ) { goto I27_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I27_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 35 );
+		if ( ui32Idx != 9 ) { return; }
+	I27_9 :
+		if ( BlockPhi1( _pcThis, 211 ) != 0 ) { goto Finish; }
+	I27_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x01CD008545ULL ) ) { return; }
+		// $00:8545: $CD.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8546, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8547, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x00008546ULL );
+				BlockLogFetch( _pcThis, 0x03008547ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0300;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0300, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( 0x0301, _pcThis->m_fsState.ui8Bank, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16A ) - ui16Val;
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) | (ui32R <= 0xFFFF ? C() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 4;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8548 );
+				goto I28_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I28_5; }
+		if ( ui32Idx == 7 ) { goto I28_7; }
+		if ( ui32Idx == 9 ) { goto I28_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I28_7; }
+		if ( ui32Idx == 9 ) { goto I28_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I28_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx == 9 ) { goto I28_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I28_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 28 );
+		if ( ui32Idx != 9 ) { return; }
+	I28_9 :
+		if ( BlockPhi1( _pcThis, 211 ) != 0 ) { goto Finish; }
+	I28_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x01E0008548ULL ) ) { return; }
+		// $00:8548: $E0.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8549, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0x81008549ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x0081;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0x81 );
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8X[0] ) - ui16Val;
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R <= 0xFF ? C() : 0) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x854A );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x01E400854AULL ) ) { return; }
+		// $00:854A: $E4.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x22 );
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x854B, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x2200854BULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x22;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8X[0] ) - ui16Val;
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R <= 0xFF ? C() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x854C );
+				goto I30_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I30_5; }
+		if ( ui32Idx == 7 ) { goto I30_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I30_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I30_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx != 7 ) { return; }
+	I30_7 :
+		if ( BlockPhi1( _pcThis, 237 ) != 0 ) { goto Finish; }
+	I30_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x01EC00854CULL ) ) { return; }
+		// $00:854C: $EC.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x854D, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x854E, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x0000854DULL );
+				BlockLogFetch( _pcThis, 0x0300854EULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0300;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0300, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8X[0] ) - ui16Val;
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R <= 0xFF ? C() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x854F );
+				goto I31_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I31_5; }
+		if ( ui32Idx == 7 ) { goto I31_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I31_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I31_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx != 7 ) { return; }
+	I31_7 :
+		if ( BlockPhi1( _pcThis, 237 ) != 0 ) { goto Finish; }
+	I31_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x01C000854FULL ) ) { return; }
+		// $00:854F: $C0.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8550, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0x80008550ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x0080;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0x80 );
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8Y[0] ) - ui16Val;
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R <= 0xFF ? C() : 0) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8551 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x01CC008551ULL ) ) { return; }
+		// $00:8551: $CC.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8552, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8553, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x02008552ULL );
+				BlockLogFetch( _pcThis, 0x03008553ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0302;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0302, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8Y[0] ) - ui16Val;
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R <= 0xFF ? C() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8554 );
+				goto I33_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I33_5; }
+		if ( ui32Idx == 7 ) { goto I33_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I33_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I33_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx != 7 ) { return; }
+	I33_7 :
+		if ( BlockPhi1( _pcThis, 215 ) != 0 ) { goto Finish; }
+	I33_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x01C4008554ULL ) ) { return; }
+		// $00:8554: $C4.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x20 );
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8555, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x20008555ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x20;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8Y[0] ) - ui16Val;
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R <= 0xFF ? C() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8556 );
+				goto I34_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I34_5; }
+		if ( ui32Idx == 7 ) { goto I34_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I34_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I34_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx != 7 ) { return; }
+	I34_7 :
+		if ( BlockPhi1( _pcThis, 215 ) != 0 ) { goto Finish; }
+	I34_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x0189008556ULL ) ) { return; }
+		// $00:8556: $89.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8557, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+			ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8558, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0x40008557ULL );
+			BlockLogFetch( _pcThis, 0x40008558ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x4040;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0x40 );
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16A ) & ui16Val;
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0xFD) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 2;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8559 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x0124008559ULL ) ) { return; }
+		// $00:8559: $24.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x20 );
+			if ( uint8_t( ui16Addr ) != 0xFF && _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x855A, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x2000855AULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x20;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( uint16_t( ui16Addr + 1 ), 0, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16A ) & ui16Val;
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3D) | ((ui16Val & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) | ((ui16Val & 0x4000) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x855B );
+				goto I36_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I36_5; }
+		if ( ui32Idx == 7 ) { goto I36_7; }
+		if ( ui32Idx == 9 ) { goto I36_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I36_7; }
+		if ( ui32Idx == 9 ) { goto I36_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I36_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx == 9 ) { goto I36_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I36_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 35 );
+		if ( ui32Idx != 9 ) { return; }
+	I36_9 :
+		if ( BlockPhi1( _pcThis, 93 ) != 0 ) { goto Finish; }
+	I36_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x012C00855BULL ) ) { return; }
+		// $00:855B: $2C.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x855C, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x855D, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x0000855CULL );
+				BlockLogFetch( _pcThis, 0x0300855DULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0300;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0300, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( 0x0301, _pcThis->m_fsState.ui8Bank, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16A ) & ui16Val;
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3D) | ((ui16Val & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) | ((ui16Val & 0x4000) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 4;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x855E );
+				goto I37_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I37_5; }
+		if ( ui32Idx == 7 ) { goto I37_7; }
+		if ( ui32Idx == 9 ) { goto I37_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I37_7; }
+		if ( ui32Idx == 9 ) { goto I37_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I37_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx == 9 ) { goto I37_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I37_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 28 );
+		if ( ui32Idx != 9 ) { return; }
+	I37_9 :
+		if ( BlockPhi1( _pcThis, 93 ) != 0 ) { goto Finish; }
+	I37_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x011A00855EULL ) ) { return; }
+		// $00:855E: $1A.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16A ) + 1;
+			_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x855F );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x013A00855FULL ) ) { return; }
+		// $00:855F: $3A.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16A ) - 1;
+			_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8560 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x01E8008560ULL ) ) { return; }
+		// $00:8560: $E8.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8X[0] ) + 1;
+			_pcThis->m_fsState.rRegs.ui8X[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8561 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x01C8008561ULL ) ) { return; }
+		// $00:8561: $C8.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8Y[0] ) + 1;
+			_pcThis->m_fsState.rRegs.ui8Y[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8562 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x01CA008562ULL ) ) { return; }
+		// $00:8562: $CA.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8X[0] ) - 1;
+			_pcThis->m_fsState.rRegs.ui8X[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8563 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x0188008563ULL ) ) { return; }
+		// $00:8563: $88.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8Y[0] ) - 1;
+			_pcThis->m_fsState.rRegs.ui8Y[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8564 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x010A008564ULL ) ) { return; }
+		// $00:8564: $0A.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16A ) << 1;
+			_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) | (ui32R > 0xFFFF ? C() : 0) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8565 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x012A008565ULL ) ) { return; }
+		// $00:8565: $2A.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = (uint32_t( _pcThis->m_fsState.rRegs.ui16A ) << 1) | (_pcThis->m_fsState.rRegs.ui8Status & C());
+			_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) | (ui32R > 0xFFFF ? C() : 0) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8566 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x014A008566ULL ) ) { return; }
+		// $00:8566: $4A.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui16A;
+			const uint32_t ui32R = ui32A >> 1;
+			_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) | (ui32A & C()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8567 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x016A008567ULL ) ) { return; }
+		// $00:8567: $6A.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui16A;
+			const uint32_t ui32R = (ui32A >> 1) | ((_pcThis->m_fsState.rRegs.ui8Status & C()) ? 0x8000 : 0);
+			_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) | (ui32A & C()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8568 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x01B8008568ULL ) ) { return; }
+		// $00:8568: $B8.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			_pcThis->m_fsState.rRegs.ui8Status &= 0xBF;
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8569 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x01AA008569ULL ) ) { return; }
+		// $00:8569: $AA.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = _pcThis->m_fsState.rRegs.ui8A[0];
+			_pcThis->m_fsState.rRegs.ui8X[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x856A );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x01A800856AULL ) ) { return; }
+		// $00:856A: $A8.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = _pcThis->m_fsState.rRegs.ui8A[0];
+			_pcThis->m_fsState.rRegs.ui8Y[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x856B );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x018A00856BULL ) ) { return; }
+		// $00:856B: $8A.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = _pcThis->m_fsState.rRegs.ui16X;
+			_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x856C );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x019800856CULL ) ) { return; }
+		// $00:856C: $98.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = _pcThis->m_fsState.rRegs.ui16Y;
+			_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x856D );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x019B00856DULL ) ) { return; }
+		// $00:856D: $9B.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = _pcThis->m_fsState.rRegs.ui8X[0];
+			_pcThis->m_fsState.rRegs.ui8Y[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x856E );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x01BB00856EULL ) ) { return; }
+		// $00:856E: $BB.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = _pcThis->m_fsState.rRegs.ui8Y[0];
+			_pcThis->m_fsState.rRegs.ui8X[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x856F );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x018500856FULL ) ) { return; }
+		// $00:856F: $85.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x28 );
+			if ( uint8_t( ui16Addr ) != 0xFF && _pcThis->m_baBusA.IsPlainWrite( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8570, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x28008570ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x28;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16A;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( ui16Addr, 0, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_baBusA.Write( uint16_t( ui16Addr + 1 ), 0, uint8_t( ui16Val >> 8 ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8571 );
+				goto I55_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 123 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I55_5; }
+		if ( ui32Idx == 7 ) { goto I55_7; }
+		if ( ui32Idx == 9 ) { goto I55_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I55_7; }
+		if ( ui32Idx == 9 ) { goto I55_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I55_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 39 );
+		if ( ui32Idx == 9 ) { goto I55_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I55_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 38 );
+		if ( ui32Idx != 9 ) { return; }
+	I55_9 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I55_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x01A5008571ULL ) ) { return; }
+		// $00:8571: $A5.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x20 );
+			if ( uint8_t( ui16Addr ) != 0xFF && _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8572, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x20008572ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x20;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( uint16_t( ui16Addr + 1 ), 0, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = ui16Val;
+				_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8573 );
+				goto I56_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I56_5; }
+		if ( ui32Idx == 7 ) { goto I56_7; }
+		if ( ui32Idx == 9 ) { goto I56_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I56_7; }
+		if ( ui32Idx == 9 ) { goto I56_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I56_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx == 9 ) { goto I56_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I56_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 35 );
+		if ( ui32Idx != 9 ) { return; }
+	I56_9 :
+		if ( BlockPhi1( _pcThis, 188 ) != 0 ) { goto Finish; }
+	I56_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x01AE008573ULL ) ) { return; }
+		// $00:8573: $AE.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8574, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8575, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x00008574ULL );
+				BlockLogFetch( _pcThis, 0x03008575ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0300;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0300, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = ui16Val;
+				_pcThis->m_fsState.rRegs.ui8X[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8576 );
+				goto I57_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I57_5; }
+		if ( ui32Idx == 7 ) { goto I57_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I57_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I57_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx != 7 ) { return; }
+	I57_7 :
+		if ( BlockPhi1( _pcThis, 195 ) != 0 ) { goto Finish; }
+	I57_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x01A4008576ULL ) ) { return; }
+		// $00:8576: $A4.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x22 );
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8577, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x22008577ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x22;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = ui16Val;
+				_pcThis->m_fsState.rRegs.ui8Y[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8578 );
+				goto I58_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I58_5; }
+		if ( ui32Idx == 7 ) { goto I58_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I58_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I58_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx != 7 ) { return; }
+	I58_7 :
+		if ( BlockPhi1( _pcThis, 193 ) != 0 ) { goto Finish; }
+	I58_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x01AD008578ULL ) ) { return; }
+		// $00:8578: $AD.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8579, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x857A, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x02008579ULL );
+				BlockLogFetch( _pcThis, 0x0300857AULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0302;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0302, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( 0x0303, _pcThis->m_fsState.ui8Bank, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = ui16Val;
+				_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 4;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x857B );
+				goto I59_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I59_5; }
+		if ( ui32Idx == 7 ) { goto I59_7; }
+		if ( ui32Idx == 9 ) { goto I59_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I59_7; }
+		if ( ui32Idx == 9 ) { goto I59_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I59_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx == 9 ) { goto I59_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I59_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 28 );
+		if ( ui32Idx != 9 ) { return; }
+	I59_9 :
+		if ( BlockPhi1( _pcThis, 188 ) != 0 ) { goto Finish; }
+	I59_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x01A600857BULL ) ) { return; }
+		// $00:857B: $A6.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x24 );
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x857C, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x2400857CULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x24;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = ui16Val;
+				_pcThis->m_fsState.rRegs.ui8X[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x857D );
+				goto I60_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I60_5; }
+		if ( ui32Idx == 7 ) { goto I60_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I60_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I60_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx != 7 ) { return; }
+	I60_7 :
+		if ( BlockPhi1( _pcThis, 195 ) != 0 ) { goto Finish; }
+	I60_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x01AC00857DULL ) ) { return; }
+		// $00:857D: $AC.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x857E, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x857F, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x0400857EULL );
+				BlockLogFetch( _pcThis, 0x0300857FULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0304;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0304, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = ui16Val;
+				_pcThis->m_fsState.rRegs.ui8Y[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8580 );
+				goto I61_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I61_5; }
+		if ( ui32Idx == 7 ) { goto I61_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I61_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I61_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx != 7 ) { return; }
+	I61_7 :
+		if ( BlockPhi1( _pcThis, 193 ) != 0 ) { goto Finish; }
+	I61_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x0185008580ULL ) ) { return; }
+		// $00:8580: $85.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x2A );
+			if ( uint8_t( ui16Addr ) != 0xFF && _pcThis->m_baBusA.IsPlainWrite( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8581, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x2A008581ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x2A;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16A;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( ui16Addr, 0, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_baBusA.Write( uint16_t( ui16Addr + 1 ), 0, uint8_t( ui16Val >> 8 ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8582 );
+				goto I62_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 123 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I62_5; }
+		if ( ui32Idx == 7 ) { goto I62_7; }
+		if ( ui32Idx == 9 ) { goto I62_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I62_7; }
+		if ( ui32Idx == 9 ) { goto I62_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I62_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 39 );
+		if ( ui32Idx == 9 ) { goto I62_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I62_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 38 );
+		if ( ui32Idx != 9 ) { return; }
+	I62_9 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I62_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x018E008582ULL ) ) { return; }
+		// $00:8582: $8E.
+		{
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8583, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8584, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x08008583ULL );
+				BlockLogFetch( _pcThis, 0x03008584ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0308;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16X;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( 0x0308, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8585 );
+				goto I63_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 171 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I63_5; }
+		if ( ui32Idx == 7 ) { goto I63_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I63_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I63_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 61 );
+		if ( ui32Idx != 7 ) { return; }
+	I63_7 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I63_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x0184008585ULL ) ) { return; }
+		// $00:8585: $84.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x2C );
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8586, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x2C008586ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x2C;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16Y;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( ui16Addr, 0, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8587 );
+				goto I64_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 136 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I64_5; }
+		if ( ui32Idx == 7 ) { goto I64_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I64_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I64_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 39 );
+		if ( ui32Idx != 7 ) { return; }
+	I64_7 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I64_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x018D008587ULL ) ) { return; }
+		// $00:8587: $8D.
+		{
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8588, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8589, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x0A008588ULL );
+				BlockLogFetch( _pcThis, 0x03008589ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x030A;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16A;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( 0x030A, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_baBusA.Write( 0x030B, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val >> 8 ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 4;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x858A );
+				goto I65_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 123 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I65_5; }
+		if ( ui32Idx == 7 ) { goto I65_7; }
+		if ( ui32Idx == 9 ) { goto I65_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I65_7; }
+		if ( ui32Idx == 9 ) { goto I65_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I65_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 61 );
+		if ( ui32Idx == 9 ) { goto I65_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I65_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 60 );
+		if ( ui32Idx != 9 ) { return; }
+	I65_9 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I65_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x01EA00858AULL ) ) { return; }
+		// $00:858A: $EA.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x858B );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x01F800858BULL ) ) { return; }
+		// $00:858B: $F8.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			_pcThis->m_fsState.rRegs.ui8Status |= 0x08;
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x858C );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x016900858CULL ) ) { return; }
+		// $00:858C: $69.
+		{
+			if ( !(_pcThis->m_fsState.rRegs.ui8Status & D()) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x858D, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x858E, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x1900858DULL );
+				BlockLogFetch( _pcThis, 0x1900858EULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				const uint16_t ui16Val = 0x1919;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.SetDataBus( 0x19 );
+				const uint32_t ui32V = ui16Val;
+				const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui16A;
+				const uint32_t ui32R = ui32A + ui32V + (_pcThis->m_fsState.rRegs.ui8Status & C());
+				_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3C) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) | (ui32R > 0xFFFF ? C() : 0) | ((~(ui32A ^ ui32V) & (ui32A ^ ui32R) & 0x8000) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x858F );
+				goto I68_6;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 4 );
+		if ( ui32Idx == 5 ) { goto I68_5; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 50 );
+		if ( ui32Idx != 5 ) { return; }
+	I68_5 :
+		if ( BlockPhi1( _pcThis, 151 ) != 0 ) { goto Finish; }
+	I68_6 :
+		if ( !BlockFetch( _pcThis, 0, 0x01E500858FULL ) ) { return; }
+		// $00:858F: $E5.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x20 );
+			if ( !(_pcThis->m_fsState.rRegs.ui8Status & D()) && uint8_t( ui16Addr ) != 0xFF && _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8590, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x20008590ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x20;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( uint16_t( ui16Addr + 1 ), 0, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32V = ui16Val ^ 0xFFFF;
+				const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui16A;
+				const uint32_t ui32R = ui32A + ui32V + (_pcThis->m_fsState.rRegs.ui8Status & C());
+				_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3C) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) | (ui32R > 0xFFFF ? C() : 0) | ((~(ui32A ^ ui32V) & (ui32A ^ ui32R) & 0x8000) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8591 );
+				goto I69_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I69_5; }
+		if ( ui32Idx == 7 ) { goto I69_7; }
+		if ( ui32Idx == 9 ) { goto I69_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I69_7; }
+		if ( ui32Idx == 9 ) { goto I69_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I69_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx == 9 ) { goto I69_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I69_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 35 );
+		if ( ui32Idx != 9 ) { return; }
+	I69_9 :
+		if ( BlockPhi1( _pcThis, 233 ) != 0 ) { goto Finish; }
+	I69_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x01D8008591ULL ) ) { return; }
+		// $00:8591: $D8.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			_pcThis->m_fsState.rRegs.ui8Status &= 0xF7;
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8592 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x01A5008592ULL ) ) { return; }
+		// $00:8592: $A5.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0xFE );
+			if ( uint8_t( ui16Addr ) != 0xFF && _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8593, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0xFE008593ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0xFE;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( uint16_t( ui16Addr + 1 ), 0, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = ui16Val;
+				_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8594 );
+				goto I71_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I71_5; }
+		if ( ui32Idx == 7 ) { goto I71_7; }
+		if ( ui32Idx == 9 ) { goto I71_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I71_7; }
+		if ( ui32Idx == 9 ) { goto I71_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I71_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx == 9 ) { goto I71_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I71_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 35 );
+		if ( ui32Idx != 9 ) { return; }
+	I71_9 :
+		if ( BlockPhi1( _pcThis, 188 ) != 0 ) { goto Finish; }
+	I71_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x01AD008594ULL ) ) { return; }
+		// $00:8594: $AD.
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I72_5; }
+		if ( ui32Idx == 7 ) { goto I72_7; }
+		if ( ui32Idx == 9 ) { goto I72_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I72_7; }
+		if ( ui32Idx == 9 ) { goto I72_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I72_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx == 9 ) { goto I72_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I72_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 28 );
+		if ( ui32Idx != 9 ) { return; }
+	I72_9 :
+		if ( BlockPhi1( _pcThis, 188 ) != 0 ) { goto Finish; }
+		if ( !BlockFetch( _pcThis, 0, 0x01AD008597ULL ) ) { return; }
+		// $00:8597: $AD.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x8F ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8598, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8599, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x80008598ULL );
+				BlockLogFetch( _pcThis, 0x8F008599ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x8F80;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x8F80, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( 0x8F81, _pcThis->m_fsState.ui8Bank, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = ui16Val;
+				_pcThis->m_fsState.rRegs.ui16A = uint16_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 4;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x859A );
+				goto I73_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I73_5; }
+		if ( ui32Idx == 7 ) { goto I73_7; }
+		if ( ui32Idx == 9 ) { goto I73_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I73_7; }
+		if ( ui32Idx == 9 ) { goto I73_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I73_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx == 9 ) { goto I73_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I73_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 28 );
+		if ( ui32Idx != 9 ) { return; }
+	I73_9 :
+		if ( BlockPhi1( _pcThis, 188 ) != 0 ) { goto Finish; }
+	I73_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x018D00859AULL ) ) { return; }
+		// $00:859A: $8D.
+		{
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x8F ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x859B, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x859C, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x8000859BULL );
+				BlockLogFetch( _pcThis, 0x8F00859CULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x8F80;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16A;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( 0x8F80, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_baBusA.Write( 0x8F81, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val >> 8 ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 4;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x859D );
+				goto I74_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 123 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I74_5; }
+		if ( ui32Idx == 7 ) { goto I74_7; }
+		if ( ui32Idx == 9 ) { goto I74_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I74_7; }
+		if ( ui32Idx == 9 ) { goto I74_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I74_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 61 );
+		if ( ui32Idx == 9 ) { goto I74_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I74_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 60 );
+		if ( ui32Idx != 9 ) { return; }
+	I74_9 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I74_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x016000859DULL ) ) { return; }
+		// $00:859D: $60.
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 5 ) { goto I75_5; }
+		if ( ui32Idx == 7 ) { goto I75_7; }
+		if ( ui32Idx == 9 ) { goto I75_9; }
+		if ( ui32Idx == 11 ) { goto I75_11; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 24 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I75_7; }
+		if ( ui32Idx == 9 ) { goto I75_9; }
+		if ( ui32Idx == 11 ) { goto I75_11; }
+		if ( ui32Idx != 5 ) { return; }
+	I75_5 :
+		if ( BlockPhi1( _pcThis, 24 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 139 );
+		if ( ui32Idx == 9 ) { goto I75_9; }
+		if ( ui32Idx == 11 ) { goto I75_11; }
+		if ( ui32Idx != 7 ) { return; }
+	I75_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 140 );
+		if ( ui32Idx == 11 ) { goto I75_11; }
+		if ( ui32Idx != 9 ) { return; }
+	I75_9 :
+		if ( BlockPhi1( _pcThis, 24 ) != 10 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx != 11 ) { return; }
+	I75_11 :
+		if ( BlockPhi1( _pcThis, 141 ) != 0 ) { goto Finish; }
+		BlockFetch( _pcThis, 0, UINT64_MAX );
+		return;
+	Finish :
+		BlockFinishCycle( _pcThis );
+	}
+
+	/** $00:8023, table 2. */
+	template <>
+	void CRicoh5A22::AotBlock<lsn::aotfixture::LSN_AOT_TAG, 0x02008023ULL>( CRicoh5A22 * _pcThis ) {
+		uint32_t ui32Idx;
+		// $00:8023: $20.
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I0_5; }
+		if ( ui32Idx == 7 ) { goto I0_7; }
+		if ( ui32Idx == 9 ) { goto I0_9; }
+		if ( ui32Idx == 11 ) { goto I0_11; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 62 );
+		if ( ui32Idx == 7 ) { goto I0_7; }
+		if ( ui32Idx == 9 ) { goto I0_9; }
+		if ( ui32Idx == 11 ) { goto I0_11; }
+		if ( ui32Idx != 5 ) { return; }
+	I0_5 :
+		if ( BlockPhi1( _pcThis, 24 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 9 ) { goto I0_9; }
+		if ( ui32Idx == 11 ) { goto I0_11; }
+		if ( ui32Idx != 7 ) { return; }
+	I0_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 84 );
+		if ( ui32Idx == 11 ) { goto I0_11; }
+		if ( ui32Idx != 9 ) { return; }
+	I0_9 :
+		if ( BlockPhi1( _pcThis, 24 ) != 10 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 85 );
+		if ( ui32Idx != 11 ) { return; }
+	I0_11 :
+		if ( BlockPhi1( _pcThis, 86 ) != 0 ) { goto Finish; }
+		BlockFetch( _pcThis, 0, UINT64_MAX );
+		return;
+	Finish :
+		BlockFinishCycle( _pcThis );
+	}
+
+	/** $00:8026, table 2. */
+	template <>
+	void CRicoh5A22::AotBlock<lsn::aotfixture::LSN_AOT_TAG, 0x02008026ULL>( CRicoh5A22 * _pcThis ) {
+		uint32_t ui32Idx;
+		// $00:8026: $C2.
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 4 );
+		if ( ui32Idx == 5 ) { goto I0_5; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx != 5 ) { return; }
+	I0_5 :
+		if ( BlockPhi1( _pcThis, 213 ) != 0 ) { goto Finish; }
+		BlockFetch( _pcThis, 0, UINT64_MAX );
+		return;
+	Finish :
+		BlockFinishCycle( _pcThis );
+	}
+
+	/** $00:8400, table 2. */
+	template <>
+	void CRicoh5A22::AotBlock<lsn::aotfixture::LSN_AOT_TAG, 0x02008400ULL>( CRicoh5A22 * _pcThis ) {
+		uint32_t ui32Idx;
+		// $00:8400: $A9.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8401, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0x5A008401ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x005A;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0x5A );
+			const uint32_t ui32R = ui16Val;
+			_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8402 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x0285008402ULL ) ) { return; }
+		// $00:8402: $85.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x20 );
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8403, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x20008403ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x20;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16A;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( ui16Addr, 0, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8404 );
+				goto I1_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 123 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I1_5; }
+		if ( ui32Idx == 7 ) { goto I1_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I1_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I1_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 39 );
+		if ( ui32Idx != 7 ) { return; }
+	I1_7 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I1_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x02A9008404ULL ) ) { return; }
+		// $00:8404: $A9.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8405, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0xC3008405ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x00C3;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0xC3 );
+			const uint32_t ui32R = ui16Val;
+			_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8406 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x028D008406ULL ) ) { return; }
+		// $00:8406: $8D.
+		{
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8407, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8408, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x00008407ULL );
+				BlockLogFetch( _pcThis, 0x03008408ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0300;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16A;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( 0x0300, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8409 );
+				goto I3_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 123 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I3_5; }
+		if ( ui32Idx == 7 ) { goto I3_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I3_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I3_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 61 );
+		if ( ui32Idx != 7 ) { return; }
+	I3_7 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I3_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x02A2008409ULL ) ) { return; }
+		// $00:8409: $A2.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x840A, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+			ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x840B, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0x8100840AULL );
+			BlockLogFetch( _pcThis, 0x7F00840BULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x7F81;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0x7F );
+			const uint32_t ui32R = ui16Val;
+			_pcThis->m_fsState.rRegs.ui16X = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 2;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x840C );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x028600840CULL ) ) { return; }
+		// $00:840C: $86.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x22 );
+			if ( uint8_t( ui16Addr ) != 0xFF && _pcThis->m_baBusA.IsPlainWrite( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x840D, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x2200840DULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x22;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16X;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( ui16Addr, 0, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_baBusA.Write( uint16_t( ui16Addr + 1 ), 0, uint8_t( ui16Val >> 8 ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x840E );
+				goto I5_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 171 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I5_5; }
+		if ( ui32Idx == 7 ) { goto I5_7; }
+		if ( ui32Idx == 9 ) { goto I5_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I5_7; }
+		if ( ui32Idx == 9 ) { goto I5_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I5_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 39 );
+		if ( ui32Idx == 9 ) { goto I5_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I5_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 38 );
+		if ( ui32Idx != 9 ) { return; }
+	I5_9 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I5_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x02A000840EULL ) ) { return; }
+		// $00:840E: $A0.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x840F, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+			ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8410, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0x7F00840FULL );
+			BlockLogFetch( _pcThis, 0x80008410ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x807F;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0x80 );
+			const uint32_t ui32R = ui16Val;
+			_pcThis->m_fsState.rRegs.ui16Y = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 2;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8411 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x028C008411ULL ) ) { return; }
+		// $00:8411: $8C.
+		{
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8412, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8413, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x02008412ULL );
+				BlockLogFetch( _pcThis, 0x03008413ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0302;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16Y;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( 0x0302, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_baBusA.Write( 0x0303, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val >> 8 ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 4;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8414 );
+				goto I7_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 136 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I7_5; }
+		if ( ui32Idx == 7 ) { goto I7_7; }
+		if ( ui32Idx == 9 ) { goto I7_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I7_7; }
+		if ( ui32Idx == 9 ) { goto I7_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I7_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 61 );
+		if ( ui32Idx == 9 ) { goto I7_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I7_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 60 );
+		if ( ui32Idx != 9 ) { return; }
+	I7_9 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I7_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x0264008414ULL ) ) { return; }
+		// $00:8414: $64.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x24 );
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8415, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x24008415ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x24;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = 0;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( ui16Addr, 0, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8416 );
+				goto I8_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 145 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I8_5; }
+		if ( ui32Idx == 7 ) { goto I8_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I8_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I8_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 39 );
+		if ( ui32Idx != 7 ) { return; }
+	I8_7 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I8_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x029C008416ULL ) ) { return; }
+		// $00:8416: $9C.
+		{
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8417, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8418, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x04008417ULL );
+				BlockLogFetch( _pcThis, 0x03008418ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0304;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = 0;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( 0x0304, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8419 );
+				goto I9_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 145 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I9_5; }
+		if ( ui32Idx == 7 ) { goto I9_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I9_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I9_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 61 );
+		if ( ui32Idx != 7 ) { return; }
+	I9_7 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I9_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x0218008419ULL ) ) { return; }
+		// $00:8419: $18.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			_pcThis->m_fsState.rRegs.ui8Status &= 0xFE;
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x841A );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x026900841AULL ) ) { return; }
+		// $00:841A: $69.
+		{
+			if ( !(_pcThis->m_fsState.rRegs.ui8Status & D()) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x841B, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0xF000841BULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				const uint16_t ui16Val = 0x00F0;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.SetDataBus( 0xF0 );
+				const uint32_t ui32V = ui16Val;
+				const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui8A[0];
+				const uint32_t ui32R = ui32A + ui32V + (_pcThis->m_fsState.rRegs.ui8Status & C());
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R > 0xFF ? C() : 0) | ((~(ui32A ^ ui32V) & (ui32A ^ ui32R) & 0x80) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 1;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x841C );
+				goto I11_4;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 4 );
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 152 ) != 0 ) { goto Finish; }
+	I11_4 :
+		if ( !BlockFetch( _pcThis, 0, 0x026500841CULL ) ) { return; }
+		// $00:841C: $65.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x20 );
+			if ( !(_pcThis->m_fsState.rRegs.ui8Status & D()) && _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x841D, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x2000841DULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x20;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32V = ui16Val;
+				const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui8A[0];
+				const uint32_t ui32R = ui32A + ui32V + (_pcThis->m_fsState.rRegs.ui8Status & C());
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R > 0xFF ? C() : 0) | ((~(ui32A ^ ui32V) & (ui32A ^ ui32R) & 0x80) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x841E );
+				goto I12_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I12_5; }
+		if ( ui32Idx == 7 ) { goto I12_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I12_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I12_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx != 7 ) { return; }
+	I12_7 :
+		if ( BlockPhi1( _pcThis, 143 ) != 0 ) { goto Finish; }
+	I12_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x026D00841EULL ) ) { return; }
+		// $00:841E: $6D.
+		{
+			if ( !(_pcThis->m_fsState.rRegs.ui8Status & D()) && _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x841F, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8420, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x0000841FULL );
+				BlockLogFetch( _pcThis, 0x03008420ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0300;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0300, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32V = ui16Val;
+				const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui8A[0];
+				const uint32_t ui32R = ui32A + ui32V + (_pcThis->m_fsState.rRegs.ui8Status & C());
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R > 0xFF ? C() : 0) | ((~(ui32A ^ ui32V) & (ui32A ^ ui32R) & 0x80) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8421 );
+				goto I13_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I13_5; }
+		if ( ui32Idx == 7 ) { goto I13_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I13_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I13_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx != 7 ) { return; }
+	I13_7 :
+		if ( BlockPhi1( _pcThis, 143 ) != 0 ) { goto Finish; }
+	I13_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x0238008421ULL ) ) { return; }
+		// $00:8421: $38.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			_pcThis->m_fsState.rRegs.ui8Status |= 0x01;
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8422 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x02E9008422ULL ) ) { return; }
+		// $00:8422: $E9.
+		{
+			if ( !(_pcThis->m_fsState.rRegs.ui8Status & D()) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8423, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x11008423ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				const uint16_t ui16Val = 0x0011;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.SetDataBus( 0x11 );
+				const uint32_t ui32V = ui16Val ^ 0xFF;
+				const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui8A[0];
+				const uint32_t ui32R = ui32A + ui32V + (_pcThis->m_fsState.rRegs.ui8Status & C());
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R > 0xFF ? C() : 0) | ((~(ui32A ^ ui32V) & (ui32A ^ ui32R) & 0x80) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 1;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8424 );
+				goto I15_4;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 4 );
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 243 ) != 0 ) { goto Finish; }
+	I15_4 :
+		if ( !BlockFetch( _pcThis, 0, 0x02E5008424ULL ) ) { return; }
+		// $00:8424: $E5.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x22 );
+			if ( !(_pcThis->m_fsState.rRegs.ui8Status & D()) && _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8425, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x22008425ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x22;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32V = ui16Val ^ 0xFF;
+				const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui8A[0];
+				const uint32_t ui32R = ui32A + ui32V + (_pcThis->m_fsState.rRegs.ui8Status & C());
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R > 0xFF ? C() : 0) | ((~(ui32A ^ ui32V) & (ui32A ^ ui32R) & 0x80) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8426 );
+				goto I16_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I16_5; }
+		if ( ui32Idx == 7 ) { goto I16_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I16_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I16_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx != 7 ) { return; }
+	I16_7 :
+		if ( BlockPhi1( _pcThis, 234 ) != 0 ) { goto Finish; }
+	I16_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x02ED008426ULL ) ) { return; }
+		// $00:8426: $ED.
+		{
+			if ( !(_pcThis->m_fsState.rRegs.ui8Status & D()) && _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8427, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8428, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x02008427ULL );
+				BlockLogFetch( _pcThis, 0x03008428ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0302;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0302, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32V = ui16Val ^ 0xFF;
+				const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui8A[0];
+				const uint32_t ui32R = ui32A + ui32V + (_pcThis->m_fsState.rRegs.ui8Status & C());
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R > 0xFF ? C() : 0) | ((~(ui32A ^ ui32V) & (ui32A ^ ui32R) & 0x80) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8429 );
+				goto I17_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I17_5; }
+		if ( ui32Idx == 7 ) { goto I17_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I17_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I17_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx != 7 ) { return; }
+	I17_7 :
+		if ( BlockPhi1( _pcThis, 234 ) != 0 ) { goto Finish; }
+	I17_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x0285008429ULL ) ) { return; }
+		// $00:8429: $85.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x26 );
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x842A, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x2600842AULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x26;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16A;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( ui16Addr, 0, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x842B );
+				goto I18_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 123 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I18_5; }
+		if ( ui32Idx == 7 ) { goto I18_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I18_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I18_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 39 );
+		if ( ui32Idx != 7 ) { return; }
+	I18_7 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I18_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x020900842BULL ) ) { return; }
+		// $00:842B: $09.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x842C, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0x0F00842CULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x000F;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0x0F );
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) | ui16Val;
+			_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x842D );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x020500842DULL ) ) { return; }
+		// $00:842D: $05.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x20 );
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x842E, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x2000842EULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x20;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) | ui16Val;
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x842F );
+				goto I20_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I20_5; }
+		if ( ui32Idx == 7 ) { goto I20_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I20_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I20_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx != 7 ) { return; }
+	I20_7 :
+		if ( BlockPhi1( _pcThis, 30 ) != 0 ) { goto Finish; }
+	I20_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x022900842FULL ) ) { return; }
+		// $00:842F: $29.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8430, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0xF3008430ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x00F3;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0xF3 );
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) & ui16Val;
+			_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8431 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x022D008431ULL ) ) { return; }
+		// $00:8431: $2D.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8432, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8433, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x00008432ULL );
+				BlockLogFetch( _pcThis, 0x03008433ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0300;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0300, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) & ui16Val;
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8434 );
+				goto I22_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I22_5; }
+		if ( ui32Idx == 7 ) { goto I22_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I22_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I22_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx != 7 ) { return; }
+	I22_7 :
+		if ( BlockPhi1( _pcThis, 88 ) != 0 ) { goto Finish; }
+	I22_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x0249008434ULL ) ) { return; }
+		// $00:8434: $49.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8435, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0xFF008435ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x00FF;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0xFF );
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) ^ ui16Val;
+			_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8436 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x0245008436ULL ) ) { return; }
+		// $00:8436: $45.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x22 );
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8437, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x22008437ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x22;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) ^ ui16Val;
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8438 );
+				goto I24_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I24_5; }
+		if ( ui32Idx == 7 ) { goto I24_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I24_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I24_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx != 7 ) { return; }
+	I24_7 :
+		if ( BlockPhi1( _pcThis, 116 ) != 0 ) { goto Finish; }
+	I24_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x028D008438ULL ) ) { return; }
+		// $00:8438: $8D.
+		{
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8439, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x843A, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x06008439ULL );
+				BlockLogFetch( _pcThis, 0x0300843AULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0306;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16A;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( 0x0306, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x843B );
+				goto I25_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 123 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I25_5; }
+		if ( ui32Idx == 7 ) { goto I25_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I25_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I25_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 61 );
+		if ( ui32Idx != 7 ) { return; }
+	I25_7 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I25_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x02C900843BULL ) ) { return; }
+		// $00:843B: $C9.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x843C, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0x1000843CULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x0010;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0x10 );
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) - ui16Val;
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R <= 0xFF ? C() : 0) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x843D );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x02C500843DULL ) ) { return; }
+		// $00:843D: $C5.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x20 );
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x843E, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x2000843EULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x20;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) - ui16Val;
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R <= 0xFF ? C() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x843F );
+				goto I27_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I27_5; }
+		if ( ui32Idx == 7 ) { goto I27_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I27_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I27_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx != 7 ) { return; }
+	I27_7 :
+		if ( BlockPhi1( _pcThis, 212 ) != 0 ) { goto Finish; }
+	I27_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x02CD00843FULL ) ) { return; }
+		// $00:843F: $CD.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8440, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8441, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x00008440ULL );
+				BlockLogFetch( _pcThis, 0x03008441ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0300;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0300, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) - ui16Val;
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R <= 0xFF ? C() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8442 );
+				goto I28_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I28_5; }
+		if ( ui32Idx == 7 ) { goto I28_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I28_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I28_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx != 7 ) { return; }
+	I28_7 :
+		if ( BlockPhi1( _pcThis, 212 ) != 0 ) { goto Finish; }
+	I28_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x02E0008442ULL ) ) { return; }
+		// $00:8442: $E0.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8443, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+			ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8444, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0x81008443ULL );
+			BlockLogFetch( _pcThis, 0x7F008444ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x7F81;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0x7F );
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16X ) - ui16Val;
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) | (ui32R <= 0xFFFF ? C() : 0) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 2;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8445 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x02E4008445ULL ) ) { return; }
+		// $00:8445: $E4.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x22 );
+			if ( uint8_t( ui16Addr ) != 0xFF && _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8446, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x22008446ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x22;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( uint16_t( ui16Addr + 1 ), 0, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16X ) - ui16Val;
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) | (ui32R <= 0xFFFF ? C() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8447 );
+				goto I30_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I30_5; }
+		if ( ui32Idx == 7 ) { goto I30_7; }
+		if ( ui32Idx == 9 ) { goto I30_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I30_7; }
+		if ( ui32Idx == 9 ) { goto I30_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I30_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx == 9 ) { goto I30_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I30_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 35 );
+		if ( ui32Idx != 9 ) { return; }
+	I30_9 :
+		if ( BlockPhi1( _pcThis, 236 ) != 0 ) { goto Finish; }
+	I30_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x02EC008447ULL ) ) { return; }
+		// $00:8447: $EC.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8448, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8449, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x00008448ULL );
+				BlockLogFetch( _pcThis, 0x03008449ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0300;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0300, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( 0x0301, _pcThis->m_fsState.ui8Bank, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16X ) - ui16Val;
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) | (ui32R <= 0xFFFF ? C() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 4;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x844A );
+				goto I31_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I31_5; }
+		if ( ui32Idx == 7 ) { goto I31_7; }
+		if ( ui32Idx == 9 ) { goto I31_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I31_7; }
+		if ( ui32Idx == 9 ) { goto I31_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I31_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx == 9 ) { goto I31_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I31_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 28 );
+		if ( ui32Idx != 9 ) { return; }
+	I31_9 :
+		if ( BlockPhi1( _pcThis, 236 ) != 0 ) { goto Finish; }
+	I31_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x02C000844AULL ) ) { return; }
+		// $00:844A: $C0.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x844B, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+			ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x844C, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0x8000844BULL );
+			BlockLogFetch( _pcThis, 0x0000844CULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x0080;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0x00 );
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16Y ) - ui16Val;
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) | (ui32R <= 0xFFFF ? C() : 0) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 2;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x844D );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x02CC00844DULL ) ) { return; }
+		// $00:844D: $CC.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x844E, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x844F, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x0200844EULL );
+				BlockLogFetch( _pcThis, 0x0300844FULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0302;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0302, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( 0x0303, _pcThis->m_fsState.ui8Bank, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16Y ) - ui16Val;
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) | (ui32R <= 0xFFFF ? C() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 4;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8450 );
+				goto I33_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I33_5; }
+		if ( ui32Idx == 7 ) { goto I33_7; }
+		if ( ui32Idx == 9 ) { goto I33_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I33_7; }
+		if ( ui32Idx == 9 ) { goto I33_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I33_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx == 9 ) { goto I33_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I33_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 28 );
+		if ( ui32Idx != 9 ) { return; }
+	I33_9 :
+		if ( BlockPhi1( _pcThis, 214 ) != 0 ) { goto Finish; }
+	I33_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x02C4008450ULL ) ) { return; }
+		// $00:8450: $C4.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x20 );
+			if ( uint8_t( ui16Addr ) != 0xFF && _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8451, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x20008451ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x20;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( uint16_t( ui16Addr + 1 ), 0, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16Y ) - ui16Val;
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) | (ui32R <= 0xFFFF ? C() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8452 );
+				goto I34_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I34_5; }
+		if ( ui32Idx == 7 ) { goto I34_7; }
+		if ( ui32Idx == 9 ) { goto I34_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I34_7; }
+		if ( ui32Idx == 9 ) { goto I34_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I34_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx == 9 ) { goto I34_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I34_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 35 );
+		if ( ui32Idx != 9 ) { return; }
+	I34_9 :
+		if ( BlockPhi1( _pcThis, 214 ) != 0 ) { goto Finish; }
+	I34_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x0289008452ULL ) ) { return; }
+		// $00:8452: $89.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8453, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0x40008453ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x0040;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0x40 );
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) & ui16Val;
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0xFD) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8454 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x0224008454ULL ) ) { return; }
+		// $00:8454: $24.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x20 );
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8455, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x20008455ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x20;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) & ui16Val;
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3D) | ((ui16Val & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | ((ui16Val & 0x40) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8456 );
+				goto I36_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I36_5; }
+		if ( ui32Idx == 7 ) { goto I36_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I36_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I36_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx != 7 ) { return; }
+	I36_7 :
+		if ( BlockPhi1( _pcThis, 94 ) != 0 ) { goto Finish; }
+	I36_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x022C008456ULL ) ) { return; }
+		// $00:8456: $2C.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8457, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8458, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x00008457ULL );
+				BlockLogFetch( _pcThis, 0x03008458ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0300;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0300, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) & ui16Val;
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3D) | ((ui16Val & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | ((ui16Val & 0x40) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8459 );
+				goto I37_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I37_5; }
+		if ( ui32Idx == 7 ) { goto I37_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I37_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I37_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx != 7 ) { return; }
+	I37_7 :
+		if ( BlockPhi1( _pcThis, 94 ) != 0 ) { goto Finish; }
+	I37_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x021A008459ULL ) ) { return; }
+		// $00:8459: $1A.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) + 1;
+			_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x845A );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x023A00845AULL ) ) { return; }
+		// $00:845A: $3A.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) - 1;
+			_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x845B );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x02E800845BULL ) ) { return; }
+		// $00:845B: $E8.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16X ) + 1;
+			_pcThis->m_fsState.rRegs.ui16X = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x845C );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x02C800845CULL ) ) { return; }
+		// $00:845C: $C8.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16Y ) + 1;
+			_pcThis->m_fsState.rRegs.ui16Y = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x845D );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x02CA00845DULL ) ) { return; }
+		// $00:845D: $CA.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16X ) - 1;
+			_pcThis->m_fsState.rRegs.ui16X = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x845E );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x028800845EULL ) ) { return; }
+		// $00:845E: $88.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui16Y ) - 1;
+			_pcThis->m_fsState.rRegs.ui16Y = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x845F );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x020A00845FULL ) ) { return; }
+		// $00:845F: $0A.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) << 1;
+			_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R > 0xFF ? C() : 0) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8460 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x022A008460ULL ) ) { return; }
+		// $00:8460: $2A.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = (uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) << 1) | (_pcThis->m_fsState.rRegs.ui8Status & C());
+			_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R > 0xFF ? C() : 0) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8461 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x024A008461ULL ) ) { return; }
+		// $00:8461: $4A.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui8A[0];
+			const uint32_t ui32R = ui32A >> 1;
+			_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32A & C()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8462 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x026A008462ULL ) ) { return; }
+		// $00:8462: $6A.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui8A[0];
+			const uint32_t ui32R = (ui32A >> 1) | ((_pcThis->m_fsState.rRegs.ui8Status & C()) ? 0x80 : 0);
+			_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32A & C()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8463 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x02B8008463ULL ) ) { return; }
+		// $00:8463: $B8.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			_pcThis->m_fsState.rRegs.ui8Status &= 0xBF;
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8464 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x02AA008464ULL ) ) { return; }
+		// $00:8464: $AA.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = _pcThis->m_fsState.rRegs.ui16A;
+			_pcThis->m_fsState.rRegs.ui16X = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8465 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x02A8008465ULL ) ) { return; }
+		// $00:8465: $A8.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = _pcThis->m_fsState.rRegs.ui16A;
+			_pcThis->m_fsState.rRegs.ui16Y = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8466 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x028A008466ULL ) ) { return; }
+		// $00:8466: $8A.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = _pcThis->m_fsState.rRegs.ui8X[0];
+			_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8467 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x0298008467ULL ) ) { return; }
+		// $00:8467: $98.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = _pcThis->m_fsState.rRegs.ui8Y[0];
+			_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8468 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x029B008468ULL ) ) { return; }
+		// $00:8468: $9B.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = _pcThis->m_fsState.rRegs.ui16X;
+			_pcThis->m_fsState.rRegs.ui16Y = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8469 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x02BB008469ULL ) ) { return; }
+		// $00:8469: $BB.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = _pcThis->m_fsState.rRegs.ui16Y;
+			_pcThis->m_fsState.rRegs.ui16X = uint16_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x846A );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x028500846AULL ) ) { return; }
+		// $00:846A: $85.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x28 );
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x846B, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x2800846BULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x28;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16A;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( ui16Addr, 0, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x846C );
+				goto I55_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 123 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I55_5; }
+		if ( ui32Idx == 7 ) { goto I55_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I55_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I55_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 39 );
+		if ( ui32Idx != 7 ) { return; }
+	I55_7 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I55_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x02A500846CULL ) ) { return; }
+		// $00:846C: $A5.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x20 );
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x846D, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x2000846DULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x20;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = ui16Val;
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x846E );
+				goto I56_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I56_5; }
+		if ( ui32Idx == 7 ) { goto I56_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I56_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I56_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx != 7 ) { return; }
+	I56_7 :
+		if ( BlockPhi1( _pcThis, 189 ) != 0 ) { goto Finish; }
+	I56_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x02AE00846EULL ) ) { return; }
+		// $00:846E: $AE.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x846F, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8470, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x0000846FULL );
+				BlockLogFetch( _pcThis, 0x03008470ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0300;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0300, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( 0x0301, _pcThis->m_fsState.ui8Bank, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = ui16Val;
+				_pcThis->m_fsState.rRegs.ui16X = uint16_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 4;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8471 );
+				goto I57_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I57_5; }
+		if ( ui32Idx == 7 ) { goto I57_7; }
+		if ( ui32Idx == 9 ) { goto I57_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I57_7; }
+		if ( ui32Idx == 9 ) { goto I57_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I57_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx == 9 ) { goto I57_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I57_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 28 );
+		if ( ui32Idx != 9 ) { return; }
+	I57_9 :
+		if ( BlockPhi1( _pcThis, 194 ) != 0 ) { goto Finish; }
+	I57_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x02A4008471ULL ) ) { return; }
+		// $00:8471: $A4.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x22 );
+			if ( uint8_t( ui16Addr ) != 0xFF && _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8472, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x22008472ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x22;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( uint16_t( ui16Addr + 1 ), 0, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = ui16Val;
+				_pcThis->m_fsState.rRegs.ui16Y = uint16_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8473 );
+				goto I58_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I58_5; }
+		if ( ui32Idx == 7 ) { goto I58_7; }
+		if ( ui32Idx == 9 ) { goto I58_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I58_7; }
+		if ( ui32Idx == 9 ) { goto I58_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I58_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx == 9 ) { goto I58_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I58_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 35 );
+		if ( ui32Idx != 9 ) { return; }
+	I58_9 :
+		if ( BlockPhi1( _pcThis, 192 ) != 0 ) { goto Finish; }
+	I58_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x02AD008473ULL ) ) { return; }
+		// $00:8473: $AD.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8474, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8475, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x02008474ULL );
+				BlockLogFetch( _pcThis, 0x03008475ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0302;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0302, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = ui16Val;
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8476 );
+				goto I59_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I59_5; }
+		if ( ui32Idx == 7 ) { goto I59_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I59_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I59_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx != 7 ) { return; }
+	I59_7 :
+		if ( BlockPhi1( _pcThis, 189 ) != 0 ) { goto Finish; }
+	I59_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x02A6008476ULL ) ) { return; }
+		// $00:8476: $A6.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x24 );
+			if ( uint8_t( ui16Addr ) != 0xFF && _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8477, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x24008477ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x24;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( uint16_t( ui16Addr + 1 ), 0, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = ui16Val;
+				_pcThis->m_fsState.rRegs.ui16X = uint16_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8478 );
+				goto I60_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I60_5; }
+		if ( ui32Idx == 7 ) { goto I60_7; }
+		if ( ui32Idx == 9 ) { goto I60_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I60_7; }
+		if ( ui32Idx == 9 ) { goto I60_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I60_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx == 9 ) { goto I60_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I60_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 35 );
+		if ( ui32Idx != 9 ) { return; }
+	I60_9 :
+		if ( BlockPhi1( _pcThis, 194 ) != 0 ) { goto Finish; }
+	I60_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x02AC008478ULL ) ) { return; }
+		// $00:8478: $AC.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8479, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x847A, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x04008479ULL );
+				BlockLogFetch( _pcThis, 0x0300847AULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0304;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0304, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				ui16Val |= uint16_t( _pcThis->m_baBusA.Read( 0x0305, _pcThis->m_fsState.ui8Bank, ui8Speed ) << 8 );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = ui16Val;
+				_pcThis->m_fsState.rRegs.ui16Y = uint16_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x8000) ? N() : 0) | ((ui32R & 0xFFFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 4;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x847B );
+				goto I61_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I61_5; }
+		if ( ui32Idx == 7 ) { goto I61_7; }
+		if ( ui32Idx == 9 ) { goto I61_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I61_7; }
+		if ( ui32Idx == 9 ) { goto I61_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I61_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx == 9 ) { goto I61_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I61_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 28 );
+		if ( ui32Idx != 9 ) { return; }
+	I61_9 :
+		if ( BlockPhi1( _pcThis, 192 ) != 0 ) { goto Finish; }
+	I61_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x028500847BULL ) ) { return; }
+		// $00:847B: $85.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x2A );
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x847C, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x2A00847CULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x2A;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16A;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( ui16Addr, 0, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x847D );
+				goto I62_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 123 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I62_5; }
+		if ( ui32Idx == 7 ) { goto I62_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I62_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I62_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 39 );
+		if ( ui32Idx != 7 ) { return; }
+	I62_7 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I62_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x028E00847DULL ) ) { return; }
+		// $00:847D: $8E.
+		{
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x847E, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x847F, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x0800847EULL );
+				BlockLogFetch( _pcThis, 0x0300847FULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0308;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16X;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( 0x0308, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_baBusA.Write( 0x0309, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val >> 8 ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 4;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8480 );
+				goto I63_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 171 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I63_5; }
+		if ( ui32Idx == 7 ) { goto I63_7; }
+		if ( ui32Idx == 9 ) { goto I63_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I63_7; }
+		if ( ui32Idx == 9 ) { goto I63_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I63_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 61 );
+		if ( ui32Idx == 9 ) { goto I63_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I63_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 60 );
+		if ( ui32Idx != 9 ) { return; }
+	I63_9 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I63_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x0284008480ULL ) ) { return; }
+		// $00:8480: $84.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x2C );
+			if ( uint8_t( ui16Addr ) != 0xFF && _pcThis->m_baBusA.IsPlainWrite( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8481, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x2C008481ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x2C;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16Y;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( ui16Addr, 0, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_baBusA.Write( uint16_t( ui16Addr + 1 ), 0, uint8_t( ui16Val >> 8 ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8482 );
+				goto I64_10;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 136 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I64_5; }
+		if ( ui32Idx == 7 ) { goto I64_7; }
+		if ( ui32Idx == 9 ) { goto I64_9; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I64_7; }
+		if ( ui32Idx == 9 ) { goto I64_9; }
+		if ( ui32Idx != 5 ) { return; }
+	I64_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 39 );
+		if ( ui32Idx == 9 ) { goto I64_9; }
+		if ( ui32Idx != 7 ) { return; }
+	I64_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 38 );
+		if ( ui32Idx != 9 ) { return; }
+	I64_9 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I64_10 :
+		if ( !BlockFetch( _pcThis, 0, 0x028D008482ULL ) ) { return; }
+		// $00:8482: $8D.
+		{
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8483, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8484, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x0A008483ULL );
+				BlockLogFetch( _pcThis, 0x03008484ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x030A;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16A;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( 0x030A, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8485 );
+				goto I65_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 123 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I65_5; }
+		if ( ui32Idx == 7 ) { goto I65_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I65_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I65_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 61 );
+		if ( ui32Idx != 7 ) { return; }
+	I65_7 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I65_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x02EA008485ULL ) ) { return; }
+		// $00:8485: $EA.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8486 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x02F8008486ULL ) ) { return; }
+		// $00:8486: $F8.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			_pcThis->m_fsState.rRegs.ui8Status |= 0x08;
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8487 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x0269008487ULL ) ) { return; }
+		// $00:8487: $69.
+		{
+			if ( !(_pcThis->m_fsState.rRegs.ui8Status & D()) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8488, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x19008488ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				const uint16_t ui16Val = 0x0019;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.SetDataBus( 0x19 );
+				const uint32_t ui32V = ui16Val;
+				const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui8A[0];
+				const uint32_t ui32R = ui32A + ui32V + (_pcThis->m_fsState.rRegs.ui8Status & C());
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R > 0xFF ? C() : 0) | ((~(ui32A ^ ui32V) & (ui32A ^ ui32R) & 0x80) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 1;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8489 );
+				goto I68_4;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 4 );
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 152 ) != 0 ) { goto Finish; }
+	I68_4 :
+		if ( !BlockFetch( _pcThis, 0, 0x02E5008489ULL ) ) { return; }
+		// $00:8489: $E5.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x20 );
+			if ( !(_pcThis->m_fsState.rRegs.ui8Status & D()) && _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x848A, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x2000848AULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x20;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32V = ui16Val ^ 0xFF;
+				const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui8A[0];
+				const uint32_t ui32R = ui32A + ui32V + (_pcThis->m_fsState.rRegs.ui8Status & C());
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R > 0xFF ? C() : 0) | ((~(ui32A ^ ui32V) & (ui32A ^ ui32R) & 0x80) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x848B );
+				goto I69_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I69_5; }
+		if ( ui32Idx == 7 ) { goto I69_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I69_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I69_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx != 7 ) { return; }
+	I69_7 :
+		if ( BlockPhi1( _pcThis, 234 ) != 0 ) { goto Finish; }
+	I69_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x02D800848BULL ) ) { return; }
+		// $00:848B: $D8.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			_pcThis->m_fsState.rRegs.ui8Status &= 0xF7;
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x848C );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x02A500848CULL ) ) { return; }
+		// $00:848C: $A5.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0xFE );
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x848D, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0xFE00848DULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0xFE;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = ui16Val;
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x848E );
+				goto I71_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I71_5; }
+		if ( ui32Idx == 7 ) { goto I71_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I71_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I71_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx != 7 ) { return; }
+	I71_7 :
+		if ( BlockPhi1( _pcThis, 189 ) != 0 ) { goto Finish; }
+	I71_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x02AD00848EULL ) ) { return; }
+		// $00:848E: $AD.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x848F, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8490, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0xFF00848FULL );
+				BlockLogFetch( _pcThis, 0x03008490ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x03FF;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x03FF, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = ui16Val;
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8491 );
+				goto I72_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I72_5; }
+		if ( ui32Idx == 7 ) { goto I72_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I72_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I72_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx != 7 ) { return; }
+	I72_7 :
+		if ( BlockPhi1( _pcThis, 189 ) != 0 ) { goto Finish; }
+	I72_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x02AD008491ULL ) ) { return; }
+		// $00:8491: $AD.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x8F ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8492, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8493, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x80008492ULL );
+				BlockLogFetch( _pcThis, 0x8F008493ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x8F80;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x8F80, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = ui16Val;
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8494 );
+				goto I73_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I73_5; }
+		if ( ui32Idx == 7 ) { goto I73_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I73_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I73_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx != 7 ) { return; }
+	I73_7 :
+		if ( BlockPhi1( _pcThis, 189 ) != 0 ) { goto Finish; }
+	I73_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x028D008494ULL ) ) { return; }
+		// $00:8494: $8D.
+		{
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x8F ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8495, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8496, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x80008495ULL );
+				BlockLogFetch( _pcThis, 0x8F008496ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x8F80;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16A;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( 0x8F80, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8497 );
+				goto I74_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 123 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I74_5; }
+		if ( ui32Idx == 7 ) { goto I74_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I74_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I74_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 61 );
+		if ( ui32Idx != 7 ) { return; }
+	I74_7 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I74_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x0260008497ULL ) ) { return; }
+		// $00:8497: $60.
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 5 ) { goto I75_5; }
+		if ( ui32Idx == 7 ) { goto I75_7; }
+		if ( ui32Idx == 9 ) { goto I75_9; }
+		if ( ui32Idx == 11 ) { goto I75_11; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 24 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I75_7; }
+		if ( ui32Idx == 9 ) { goto I75_9; }
+		if ( ui32Idx == 11 ) { goto I75_11; }
+		if ( ui32Idx != 5 ) { return; }
+	I75_5 :
+		if ( BlockPhi1( _pcThis, 24 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 139 );
+		if ( ui32Idx == 9 ) { goto I75_9; }
+		if ( ui32Idx == 11 ) { goto I75_11; }
+		if ( ui32Idx != 7 ) { return; }
+	I75_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 140 );
+		if ( ui32Idx == 11 ) { goto I75_11; }
+		if ( ui32Idx != 9 ) { return; }
+	I75_9 :
+		if ( BlockPhi1( _pcThis, 24 ) != 10 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx != 11 ) { return; }
+	I75_11 :
+		if ( BlockPhi1( _pcThis, 141 ) != 0 ) { goto Finish; }
+		BlockFetch( _pcThis, 0, UINT64_MAX );
+		return;
+	Finish :
+		BlockFinishCycle( _pcThis );
+	}
+
+	/** $00:8015, table 3. */
+	template <>
+	void CRicoh5A22::AotBlock<lsn::aotfixture::LSN_AOT_TAG, 0x03008015ULL>( CRicoh5A22 * _pcThis ) {
+		uint32_t ui32Idx;
+		// $00:8015: $20.
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I0_5; }
+		if ( ui32Idx == 7 ) { goto I0_7; }
+		if ( ui32Idx == 9 ) { goto I0_9; }
+		if ( ui32Idx == 11 ) { goto I0_11; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 62 );
+		if ( ui32Idx == 7 ) { goto I0_7; }
+		if ( ui32Idx == 9 ) { goto I0_9; }
+		if ( ui32Idx == 11 ) { goto I0_11; }
+		if ( ui32Idx != 5 ) { return; }
+	I0_5 :
+		if ( BlockPhi1( _pcThis, 24 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 9 ) { goto I0_9; }
+		if ( ui32Idx == 11 ) { goto I0_11; }
+		if ( ui32Idx != 7 ) { return; }
+	I0_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 84 );
+		if ( ui32Idx == 11 ) { goto I0_11; }
+		if ( ui32Idx != 9 ) { return; }
+	I0_9 :
+		if ( BlockPhi1( _pcThis, 24 ) != 10 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 85 );
+		if ( ui32Idx != 11 ) { return; }
+	I0_11 :
+		if ( BlockPhi1( _pcThis, 86 ) != 0 ) { goto Finish; }
+		BlockFetch( _pcThis, 0, UINT64_MAX );
+		return;
+	Finish :
+		BlockFinishCycle( _pcThis );
+	}
+
+	/** $00:8018, table 3. */
+	template <>
+	void CRicoh5A22::AotBlock<lsn::aotfixture::LSN_AOT_TAG, 0x03008018ULL>( CRicoh5A22 * _pcThis ) {
+		uint32_t ui32Idx;
+		// $00:8018: $C2.
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 4 );
+		if ( ui32Idx == 5 ) { goto I0_5; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx != 5 ) { return; }
+	I0_5 :
+		if ( BlockPhi1( _pcThis, 213 ) != 0 ) { goto Finish; }
+		BlockFetch( _pcThis, 0, UINT64_MAX );
+		return;
+	Finish :
+		BlockFinishCycle( _pcThis );
+	}
+
+	/** $00:8200, table 3. */
+	template <>
+	void CRicoh5A22::AotBlock<lsn::aotfixture::LSN_AOT_TAG, 0x03008200ULL>( CRicoh5A22 * _pcThis ) {
+		uint32_t ui32Idx;
+		// $00:8200: $A9.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8201, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0x5A008201ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x005A;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0x5A );
+			const uint32_t ui32R = ui16Val;
+			_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8202 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x0385008202ULL ) ) { return; }
+		// $00:8202: $85.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x20 );
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8203, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x20008203ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x20;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16A;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( ui16Addr, 0, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8204 );
+				goto I1_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 123 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I1_5; }
+		if ( ui32Idx == 7 ) { goto I1_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I1_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I1_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 39 );
+		if ( ui32Idx != 7 ) { return; }
+	I1_7 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I1_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x03A9008204ULL ) ) { return; }
+		// $00:8204: $A9.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8205, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0xC3008205ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x00C3;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0xC3 );
+			const uint32_t ui32R = ui16Val;
+			_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8206 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x038D008206ULL ) ) { return; }
+		// $00:8206: $8D.
+		{
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8207, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8208, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x00008207ULL );
+				BlockLogFetch( _pcThis, 0x03008208ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0300;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16A;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( 0x0300, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8209 );
+				goto I3_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 123 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I3_5; }
+		if ( ui32Idx == 7 ) { goto I3_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I3_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I3_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 61 );
+		if ( ui32Idx != 7 ) { return; }
+	I3_7 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I3_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x03A2008209ULL ) ) { return; }
+		// $00:8209: $A2.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x820A, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0x8100820AULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x0081;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0x81 );
+			const uint32_t ui32R = ui16Val;
+			_pcThis->m_fsState.rRegs.ui8X[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x820B );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x038600820BULL ) ) { return; }
+		// $00:820B: $86.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x22 );
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x820C, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x2200820CULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x22;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16X;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( ui16Addr, 0, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x820D );
+				goto I5_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 171 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I5_5; }
+		if ( ui32Idx == 7 ) { goto I5_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I5_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I5_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 39 );
+		if ( ui32Idx != 7 ) { return; }
+	I5_7 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I5_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x03A000820DULL ) ) { return; }
+		// $00:820D: $A0.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x820E, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0x7F00820EULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x007F;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0x7F );
+			const uint32_t ui32R = ui16Val;
+			_pcThis->m_fsState.rRegs.ui8Y[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x820F );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x038C00820FULL ) ) { return; }
+		// $00:820F: $8C.
+		{
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8210, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8211, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x02008210ULL );
+				BlockLogFetch( _pcThis, 0x03008211ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0302;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16Y;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( 0x0302, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8212 );
+				goto I7_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 136 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I7_5; }
+		if ( ui32Idx == 7 ) { goto I7_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I7_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I7_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 61 );
+		if ( ui32Idx != 7 ) { return; }
+	I7_7 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I7_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x0364008212ULL ) ) { return; }
+		// $00:8212: $64.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x24 );
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8213, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x24008213ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x24;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = 0;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( ui16Addr, 0, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8214 );
+				goto I8_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 145 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I8_5; }
+		if ( ui32Idx == 7 ) { goto I8_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I8_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I8_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 39 );
+		if ( ui32Idx != 7 ) { return; }
+	I8_7 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I8_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x039C008214ULL ) ) { return; }
+		// $00:8214: $9C.
+		{
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8215, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8216, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x04008215ULL );
+				BlockLogFetch( _pcThis, 0x03008216ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0304;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = 0;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( 0x0304, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8217 );
+				goto I9_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 145 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I9_5; }
+		if ( ui32Idx == 7 ) { goto I9_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I9_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I9_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 61 );
+		if ( ui32Idx != 7 ) { return; }
+	I9_7 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I9_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x0318008217ULL ) ) { return; }
+		// $00:8217: $18.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			_pcThis->m_fsState.rRegs.ui8Status &= 0xFE;
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8218 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x0369008218ULL ) ) { return; }
+		// $00:8218: $69.
+		{
+			if ( !(_pcThis->m_fsState.rRegs.ui8Status & D()) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8219, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0xF0008219ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				const uint16_t ui16Val = 0x00F0;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.SetDataBus( 0xF0 );
+				const uint32_t ui32V = ui16Val;
+				const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui8A[0];
+				const uint32_t ui32R = ui32A + ui32V + (_pcThis->m_fsState.rRegs.ui8Status & C());
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R > 0xFF ? C() : 0) | ((~(ui32A ^ ui32V) & (ui32A ^ ui32R) & 0x80) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 1;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x821A );
+				goto I11_4;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 4 );
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 152 ) != 0 ) { goto Finish; }
+	I11_4 :
+		if ( !BlockFetch( _pcThis, 0, 0x036500821AULL ) ) { return; }
+		// $00:821A: $65.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x20 );
+			if ( !(_pcThis->m_fsState.rRegs.ui8Status & D()) && _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x821B, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x2000821BULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x20;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32V = ui16Val;
+				const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui8A[0];
+				const uint32_t ui32R = ui32A + ui32V + (_pcThis->m_fsState.rRegs.ui8Status & C());
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R > 0xFF ? C() : 0) | ((~(ui32A ^ ui32V) & (ui32A ^ ui32R) & 0x80) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x821C );
+				goto I12_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I12_5; }
+		if ( ui32Idx == 7 ) { goto I12_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I12_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I12_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx != 7 ) { return; }
+	I12_7 :
+		if ( BlockPhi1( _pcThis, 143 ) != 0 ) { goto Finish; }
+	I12_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x036D00821CULL ) ) { return; }
+		// $00:821C: $6D.
+		{
+			if ( !(_pcThis->m_fsState.rRegs.ui8Status & D()) && _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x821D, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x821E, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x0000821DULL );
+				BlockLogFetch( _pcThis, 0x0300821EULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0300;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0300, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32V = ui16Val;
+				const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui8A[0];
+				const uint32_t ui32R = ui32A + ui32V + (_pcThis->m_fsState.rRegs.ui8Status & C());
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R > 0xFF ? C() : 0) | ((~(ui32A ^ ui32V) & (ui32A ^ ui32R) & 0x80) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x821F );
+				goto I13_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I13_5; }
+		if ( ui32Idx == 7 ) { goto I13_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I13_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I13_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx != 7 ) { return; }
+	I13_7 :
+		if ( BlockPhi1( _pcThis, 143 ) != 0 ) { goto Finish; }
+	I13_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x033800821FULL ) ) { return; }
+		// $00:821F: $38.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			_pcThis->m_fsState.rRegs.ui8Status |= 0x01;
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8220 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x03E9008220ULL ) ) { return; }
+		// $00:8220: $E9.
+		{
+			if ( !(_pcThis->m_fsState.rRegs.ui8Status & D()) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8221, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x11008221ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				const uint16_t ui16Val = 0x0011;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.SetDataBus( 0x11 );
+				const uint32_t ui32V = ui16Val ^ 0xFF;
+				const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui8A[0];
+				const uint32_t ui32R = ui32A + ui32V + (_pcThis->m_fsState.rRegs.ui8Status & C());
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R > 0xFF ? C() : 0) | ((~(ui32A ^ ui32V) & (ui32A ^ ui32R) & 0x80) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 1;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8222 );
+				goto I15_4;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 4 );
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 243 ) != 0 ) { goto Finish; }
+	I15_4 :
+		if ( !BlockFetch( _pcThis, 0, 0x03E5008222ULL ) ) { return; }
+		// $00:8222: $E5.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x22 );
+			if ( !(_pcThis->m_fsState.rRegs.ui8Status & D()) && _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8223, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x22008223ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x22;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32V = ui16Val ^ 0xFF;
+				const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui8A[0];
+				const uint32_t ui32R = ui32A + ui32V + (_pcThis->m_fsState.rRegs.ui8Status & C());
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R > 0xFF ? C() : 0) | ((~(ui32A ^ ui32V) & (ui32A ^ ui32R) & 0x80) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8224 );
+				goto I16_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I16_5; }
+		if ( ui32Idx == 7 ) { goto I16_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I16_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I16_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx != 7 ) { return; }
+	I16_7 :
+		if ( BlockPhi1( _pcThis, 234 ) != 0 ) { goto Finish; }
+	I16_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x03ED008224ULL ) ) { return; }
+		// $00:8224: $ED.
+		{
+			if ( !(_pcThis->m_fsState.rRegs.ui8Status & D()) && _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8225, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8226, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x02008225ULL );
+				BlockLogFetch( _pcThis, 0x03008226ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0302;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0302, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32V = ui16Val ^ 0xFF;
+				const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui8A[0];
+				const uint32_t ui32R = ui32A + ui32V + (_pcThis->m_fsState.rRegs.ui8Status & C());
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R > 0xFF ? C() : 0) | ((~(ui32A ^ ui32V) & (ui32A ^ ui32R) & 0x80) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8227 );
+				goto I17_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I17_5; }
+		if ( ui32Idx == 7 ) { goto I17_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I17_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I17_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx != 7 ) { return; }
+	I17_7 :
+		if ( BlockPhi1( _pcThis, 234 ) != 0 ) { goto Finish; }
+	I17_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x0385008227ULL ) ) { return; }
+		// $00:8227: $85.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x26 );
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8228, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x26008228ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x26;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16A;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( ui16Addr, 0, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8229 );
+				goto I18_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 123 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I18_5; }
+		if ( ui32Idx == 7 ) { goto I18_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I18_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I18_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 39 );
+		if ( ui32Idx != 7 ) { return; }
+	I18_7 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I18_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x0309008229ULL ) ) { return; }
+		// $00:8229: $09.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x822A, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0x0F00822AULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x000F;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0x0F );
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) | ui16Val;
+			_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x822B );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x030500822BULL ) ) { return; }
+		// $00:822B: $05.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x20 );
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x822C, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x2000822CULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x20;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) | ui16Val;
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x822D );
+				goto I20_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I20_5; }
+		if ( ui32Idx == 7 ) { goto I20_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I20_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I20_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx != 7 ) { return; }
+	I20_7 :
+		if ( BlockPhi1( _pcThis, 30 ) != 0 ) { goto Finish; }
+	I20_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x032900822DULL ) ) { return; }
+		// $00:822D: $29.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x822E, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0xF300822EULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x00F3;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0xF3 );
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) & ui16Val;
+			_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x822F );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x032D00822FULL ) ) { return; }
+		// $00:822F: $2D.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8230, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8231, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x00008230ULL );
+				BlockLogFetch( _pcThis, 0x03008231ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0300;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0300, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) & ui16Val;
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8232 );
+				goto I22_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I22_5; }
+		if ( ui32Idx == 7 ) { goto I22_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I22_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I22_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx != 7 ) { return; }
+	I22_7 :
+		if ( BlockPhi1( _pcThis, 88 ) != 0 ) { goto Finish; }
+	I22_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x0349008232ULL ) ) { return; }
+		// $00:8232: $49.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8233, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0xFF008233ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x00FF;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0xFF );
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) ^ ui16Val;
+			_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8234 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x0345008234ULL ) ) { return; }
+		// $00:8234: $45.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x22 );
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8235, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x22008235ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x22;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) ^ ui16Val;
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8236 );
+				goto I24_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I24_5; }
+		if ( ui32Idx == 7 ) { goto I24_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I24_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I24_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx != 7 ) { return; }
+	I24_7 :
+		if ( BlockPhi1( _pcThis, 116 ) != 0 ) { goto Finish; }
+	I24_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x038D008236ULL ) ) { return; }
+		// $00:8236: $8D.
+		{
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8237, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8238, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x06008237ULL );
+				BlockLogFetch( _pcThis, 0x03008238ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0306;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16A;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( 0x0306, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8239 );
+				goto I25_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 123 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I25_5; }
+		if ( ui32Idx == 7 ) { goto I25_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I25_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I25_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 61 );
+		if ( ui32Idx != 7 ) { return; }
+	I25_7 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I25_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x03C9008239ULL ) ) { return; }
+		// $00:8239: $C9.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x823A, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0x1000823AULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x0010;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0x10 );
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) - ui16Val;
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R <= 0xFF ? C() : 0) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x823B );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x03C500823BULL ) ) { return; }
+		// $00:823B: $C5.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x20 );
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x823C, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x2000823CULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x20;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) - ui16Val;
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R <= 0xFF ? C() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x823D );
+				goto I27_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I27_5; }
+		if ( ui32Idx == 7 ) { goto I27_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I27_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I27_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx != 7 ) { return; }
+	I27_7 :
+		if ( BlockPhi1( _pcThis, 212 ) != 0 ) { goto Finish; }
+	I27_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x03CD00823DULL ) ) { return; }
+		// $00:823D: $CD.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x823E, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x823F, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x0000823EULL );
+				BlockLogFetch( _pcThis, 0x0300823FULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0300;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0300, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) - ui16Val;
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R <= 0xFF ? C() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8240 );
+				goto I28_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I28_5; }
+		if ( ui32Idx == 7 ) { goto I28_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I28_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I28_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx != 7 ) { return; }
+	I28_7 :
+		if ( BlockPhi1( _pcThis, 212 ) != 0 ) { goto Finish; }
+	I28_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x03E0008240ULL ) ) { return; }
+		// $00:8240: $E0.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8241, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0x81008241ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x0081;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0x81 );
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8X[0] ) - ui16Val;
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R <= 0xFF ? C() : 0) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8242 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x03E4008242ULL ) ) { return; }
+		// $00:8242: $E4.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x22 );
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8243, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x22008243ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x22;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8X[0] ) - ui16Val;
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R <= 0xFF ? C() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8244 );
+				goto I30_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I30_5; }
+		if ( ui32Idx == 7 ) { goto I30_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I30_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I30_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx != 7 ) { return; }
+	I30_7 :
+		if ( BlockPhi1( _pcThis, 237 ) != 0 ) { goto Finish; }
+	I30_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x03EC008244ULL ) ) { return; }
+		// $00:8244: $EC.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8245, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8246, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x00008245ULL );
+				BlockLogFetch( _pcThis, 0x03008246ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0300;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0300, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8X[0] ) - ui16Val;
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R <= 0xFF ? C() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8247 );
+				goto I31_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I31_5; }
+		if ( ui32Idx == 7 ) { goto I31_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I31_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I31_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx != 7 ) { return; }
+	I31_7 :
+		if ( BlockPhi1( _pcThis, 237 ) != 0 ) { goto Finish; }
+	I31_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x03C0008247ULL ) ) { return; }
+		// $00:8247: $C0.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8248, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0x80008248ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x0080;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0x80 );
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8Y[0] ) - ui16Val;
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R <= 0xFF ? C() : 0) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8249 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x03CC008249ULL ) ) { return; }
+		// $00:8249: $CC.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x824A, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x824B, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x0200824AULL );
+				BlockLogFetch( _pcThis, 0x0300824BULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0302;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0302, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8Y[0] ) - ui16Val;
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R <= 0xFF ? C() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x824C );
+				goto I33_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I33_5; }
+		if ( ui32Idx == 7 ) { goto I33_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I33_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I33_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx != 7 ) { return; }
+	I33_7 :
+		if ( BlockPhi1( _pcThis, 215 ) != 0 ) { goto Finish; }
+	I33_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x03C400824CULL ) ) { return; }
+		// $00:824C: $C4.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x20 );
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x824D, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x2000824DULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x20;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8Y[0] ) - ui16Val;
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R <= 0xFF ? C() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x824E );
+				goto I34_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I34_5; }
+		if ( ui32Idx == 7 ) { goto I34_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I34_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I34_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx != 7 ) { return; }
+	I34_7 :
+		if ( BlockPhi1( _pcThis, 215 ) != 0 ) { goto Finish; }
+	I34_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x038900824EULL ) ) { return; }
+		// $00:824E: $89.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x824F, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0x4000824FULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x0040;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0x40 );
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) & ui16Val;
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0xFD) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8250 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x0324008250ULL ) ) { return; }
+		// $00:8250: $24.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x20 );
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8251, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x20008251ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x20;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) & ui16Val;
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3D) | ((ui16Val & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | ((ui16Val & 0x40) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8252 );
+				goto I36_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I36_5; }
+		if ( ui32Idx == 7 ) { goto I36_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I36_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I36_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx != 7 ) { return; }
+	I36_7 :
+		if ( BlockPhi1( _pcThis, 94 ) != 0 ) { goto Finish; }
+	I36_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x032C008252ULL ) ) { return; }
+		// $00:8252: $2C.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8253, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8254, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x00008253ULL );
+				BlockLogFetch( _pcThis, 0x03008254ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0300;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0300, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) & ui16Val;
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3D) | ((ui16Val & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | ((ui16Val & 0x40) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8255 );
+				goto I37_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I37_5; }
+		if ( ui32Idx == 7 ) { goto I37_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I37_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I37_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx != 7 ) { return; }
+	I37_7 :
+		if ( BlockPhi1( _pcThis, 94 ) != 0 ) { goto Finish; }
+	I37_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x031A008255ULL ) ) { return; }
+		// $00:8255: $1A.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) + 1;
+			_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8256 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x033A008256ULL ) ) { return; }
+		// $00:8256: $3A.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) - 1;
+			_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8257 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x03E8008257ULL ) ) { return; }
+		// $00:8257: $E8.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8X[0] ) + 1;
+			_pcThis->m_fsState.rRegs.ui8X[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8258 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x03C8008258ULL ) ) { return; }
+		// $00:8258: $C8.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8Y[0] ) + 1;
+			_pcThis->m_fsState.rRegs.ui8Y[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8259 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x03CA008259ULL ) ) { return; }
+		// $00:8259: $CA.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8X[0] ) - 1;
+			_pcThis->m_fsState.rRegs.ui8X[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x825A );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x038800825AULL ) ) { return; }
+		// $00:825A: $88.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8Y[0] ) - 1;
+			_pcThis->m_fsState.rRegs.ui8Y[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x825B );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x030A00825BULL ) ) { return; }
+		// $00:825B: $0A.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) << 1;
+			_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R > 0xFF ? C() : 0) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x825C );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x032A00825CULL ) ) { return; }
+		// $00:825C: $2A.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = (uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) << 1) | (_pcThis->m_fsState.rRegs.ui8Status & C());
+			_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R > 0xFF ? C() : 0) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x825D );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x034A00825DULL ) ) { return; }
+		// $00:825D: $4A.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui8A[0];
+			const uint32_t ui32R = ui32A >> 1;
+			_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32A & C()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x825E );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x036A00825EULL ) ) { return; }
+		// $00:825E: $6A.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui8A[0];
+			const uint32_t ui32R = (ui32A >> 1) | ((_pcThis->m_fsState.rRegs.ui8Status & C()) ? 0x80 : 0);
+			_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32A & C()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x825F );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x03B800825FULL ) ) { return; }
+		// $00:825F: $B8.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			_pcThis->m_fsState.rRegs.ui8Status &= 0xBF;
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8260 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x03AA008260ULL ) ) { return; }
+		// $00:8260: $AA.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = _pcThis->m_fsState.rRegs.ui8A[0];
+			_pcThis->m_fsState.rRegs.ui8X[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8261 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x03A8008261ULL ) ) { return; }
+		// $00:8261: $A8.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = _pcThis->m_fsState.rRegs.ui8A[0];
+			_pcThis->m_fsState.rRegs.ui8Y[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8262 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x038A008262ULL ) ) { return; }
+		// $00:8262: $8A.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = _pcThis->m_fsState.rRegs.ui8X[0];
+			_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8263 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x0398008263ULL ) ) { return; }
+		// $00:8263: $98.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = _pcThis->m_fsState.rRegs.ui8Y[0];
+			_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8264 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x039B008264ULL ) ) { return; }
+		// $00:8264: $9B.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = _pcThis->m_fsState.rRegs.ui8X[0];
+			_pcThis->m_fsState.rRegs.ui8Y[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8265 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x03BB008265ULL ) ) { return; }
+		// $00:8265: $BB.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = _pcThis->m_fsState.rRegs.ui8Y[0];
+			_pcThis->m_fsState.rRegs.ui8X[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8266 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x0385008266ULL ) ) { return; }
+		// $00:8266: $85.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x28 );
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8267, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x28008267ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x28;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16A;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( ui16Addr, 0, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8268 );
+				goto I55_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 123 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I55_5; }
+		if ( ui32Idx == 7 ) { goto I55_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I55_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I55_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 39 );
+		if ( ui32Idx != 7 ) { return; }
+	I55_7 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I55_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x03A5008268ULL ) ) { return; }
+		// $00:8268: $A5.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x20 );
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8269, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x20008269ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x20;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = ui16Val;
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x826A );
+				goto I56_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I56_5; }
+		if ( ui32Idx == 7 ) { goto I56_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I56_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I56_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx != 7 ) { return; }
+	I56_7 :
+		if ( BlockPhi1( _pcThis, 189 ) != 0 ) { goto Finish; }
+	I56_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x03AE00826AULL ) ) { return; }
+		// $00:826A: $AE.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x826B, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x826C, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x0000826BULL );
+				BlockLogFetch( _pcThis, 0x0300826CULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0300;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0300, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = ui16Val;
+				_pcThis->m_fsState.rRegs.ui8X[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x826D );
+				goto I57_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I57_5; }
+		if ( ui32Idx == 7 ) { goto I57_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I57_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I57_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx != 7 ) { return; }
+	I57_7 :
+		if ( BlockPhi1( _pcThis, 195 ) != 0 ) { goto Finish; }
+	I57_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x03A400826DULL ) ) { return; }
+		// $00:826D: $A4.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x22 );
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x826E, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x2200826EULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x22;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = ui16Val;
+				_pcThis->m_fsState.rRegs.ui8Y[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x826F );
+				goto I58_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I58_5; }
+		if ( ui32Idx == 7 ) { goto I58_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I58_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I58_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx != 7 ) { return; }
+	I58_7 :
+		if ( BlockPhi1( _pcThis, 193 ) != 0 ) { goto Finish; }
+	I58_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x03AD00826FULL ) ) { return; }
+		// $00:826F: $AD.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8270, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8271, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x02008270ULL );
+				BlockLogFetch( _pcThis, 0x03008271ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0302;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0302, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = ui16Val;
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8272 );
+				goto I59_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I59_5; }
+		if ( ui32Idx == 7 ) { goto I59_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I59_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I59_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx != 7 ) { return; }
+	I59_7 :
+		if ( BlockPhi1( _pcThis, 189 ) != 0 ) { goto Finish; }
+	I59_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x03A6008272ULL ) ) { return; }
+		// $00:8272: $A6.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x24 );
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8273, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x24008273ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x24;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = ui16Val;
+				_pcThis->m_fsState.rRegs.ui8X[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8274 );
+				goto I60_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I60_5; }
+		if ( ui32Idx == 7 ) { goto I60_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I60_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I60_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx != 7 ) { return; }
+	I60_7 :
+		if ( BlockPhi1( _pcThis, 195 ) != 0 ) { goto Finish; }
+	I60_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x03AC008274ULL ) ) { return; }
+		// $00:8274: $AC.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8275, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8276, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x04008275ULL );
+				BlockLogFetch( _pcThis, 0x03008276ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0304;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0304, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = ui16Val;
+				_pcThis->m_fsState.rRegs.ui8Y[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8277 );
+				goto I61_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I61_5; }
+		if ( ui32Idx == 7 ) { goto I61_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I61_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I61_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx != 7 ) { return; }
+	I61_7 :
+		if ( BlockPhi1( _pcThis, 193 ) != 0 ) { goto Finish; }
+	I61_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x0385008277ULL ) ) { return; }
+		// $00:8277: $85.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x2A );
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8278, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x2A008278ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x2A;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16A;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( ui16Addr, 0, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8279 );
+				goto I62_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 123 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I62_5; }
+		if ( ui32Idx == 7 ) { goto I62_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I62_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I62_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 39 );
+		if ( ui32Idx != 7 ) { return; }
+	I62_7 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I62_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x038E008279ULL ) ) { return; }
+		// $00:8279: $8E.
+		{
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x827A, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x827B, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x0800827AULL );
+				BlockLogFetch( _pcThis, 0x0300827BULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0308;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16X;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( 0x0308, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x827C );
+				goto I63_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 171 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I63_5; }
+		if ( ui32Idx == 7 ) { goto I63_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I63_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I63_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 61 );
+		if ( ui32Idx != 7 ) { return; }
+	I63_7 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I63_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x038400827CULL ) ) { return; }
+		// $00:827C: $84.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x2C );
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x827D, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x2C00827DULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x2C;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16Y;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( ui16Addr, 0, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x827E );
+				goto I64_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 136 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I64_5; }
+		if ( ui32Idx == 7 ) { goto I64_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I64_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I64_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 39 );
+		if ( ui32Idx != 7 ) { return; }
+	I64_7 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I64_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x038D00827EULL ) ) { return; }
+		// $00:827E: $8D.
+		{
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x827F, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8280, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x0A00827FULL );
+				BlockLogFetch( _pcThis, 0x03008280ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x030A;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16A;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( 0x030A, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8281 );
+				goto I65_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 123 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I65_5; }
+		if ( ui32Idx == 7 ) { goto I65_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I65_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I65_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 61 );
+		if ( ui32Idx != 7 ) { return; }
+	I65_7 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I65_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x03EA008281ULL ) ) { return; }
+		// $00:8281: $EA.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8282 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x03F8008282ULL ) ) { return; }
+		// $00:8282: $F8.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			_pcThis->m_fsState.rRegs.ui8Status |= 0x08;
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8283 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x0369008283ULL ) ) { return; }
+		// $00:8283: $69.
+		{
+			if ( !(_pcThis->m_fsState.rRegs.ui8Status & D()) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8284, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x19008284ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				const uint16_t ui16Val = 0x0019;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.SetDataBus( 0x19 );
+				const uint32_t ui32V = ui16Val;
+				const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui8A[0];
+				const uint32_t ui32R = ui32A + ui32V + (_pcThis->m_fsState.rRegs.ui8Status & C());
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R > 0xFF ? C() : 0) | ((~(ui32A ^ ui32V) & (ui32A ^ ui32R) & 0x80) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 1;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8285 );
+				goto I68_4;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 4 );
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 152 ) != 0 ) { goto Finish; }
+	I68_4 :
+		if ( !BlockFetch( _pcThis, 0, 0x03E5008285ULL ) ) { return; }
+		// $00:8285: $E5.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x20 );
+			if ( !(_pcThis->m_fsState.rRegs.ui8Status & D()) && _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8286, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x20008286ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x20;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32V = ui16Val ^ 0xFF;
+				const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui8A[0];
+				const uint32_t ui32R = ui32A + ui32V + (_pcThis->m_fsState.rRegs.ui8Status & C());
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R > 0xFF ? C() : 0) | ((~(ui32A ^ ui32V) & (ui32A ^ ui32R) & 0x80) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8287 );
+				goto I69_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I69_5; }
+		if ( ui32Idx == 7 ) { goto I69_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I69_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I69_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx != 7 ) { return; }
+	I69_7 :
+		if ( BlockPhi1( _pcThis, 234 ) != 0 ) { goto Finish; }
+	I69_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x03D8008287ULL ) ) { return; }
+		// $00:8287: $D8.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			_pcThis->m_fsState.rRegs.ui8Status &= 0xF7;
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8288 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x03A5008288ULL ) ) { return; }
+		// $00:8288: $A5.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0xFE );
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8289, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0xFE008289ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0xFE;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = ui16Val;
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x828A );
+				goto I71_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I71_5; }
+		if ( ui32Idx == 7 ) { goto I71_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I71_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I71_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx != 7 ) { return; }
+	I71_7 :
+		if ( BlockPhi1( _pcThis, 189 ) != 0 ) { goto Finish; }
+	I71_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x03AD00828AULL ) ) { return; }
+		// $00:828A: $AD.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x828B, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x828C, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0xFF00828BULL );
+				BlockLogFetch( _pcThis, 0x0300828CULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x03FF;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x03FF, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = ui16Val;
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x828D );
+				goto I72_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I72_5; }
+		if ( ui32Idx == 7 ) { goto I72_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I72_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I72_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx != 7 ) { return; }
+	I72_7 :
+		if ( BlockPhi1( _pcThis, 189 ) != 0 ) { goto Finish; }
+	I72_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x03AD00828DULL ) ) { return; }
+		// $00:828D: $AD.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x8F ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x828E, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x828F, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x8000828EULL );
+				BlockLogFetch( _pcThis, 0x8F00828FULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x8F80;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x8F80, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = ui16Val;
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8290 );
+				goto I73_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I73_5; }
+		if ( ui32Idx == 7 ) { goto I73_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I73_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I73_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx != 7 ) { return; }
+	I73_7 :
+		if ( BlockPhi1( _pcThis, 189 ) != 0 ) { goto Finish; }
+	I73_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x038D008290ULL ) ) { return; }
+		// $00:8290: $8D.
+		{
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x8F ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8291, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8292, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x80008291ULL );
+				BlockLogFetch( _pcThis, 0x8F008292ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x8F80;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16A;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( 0x8F80, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8293 );
+				goto I74_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 123 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I74_5; }
+		if ( ui32Idx == 7 ) { goto I74_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I74_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I74_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 61 );
+		if ( ui32Idx != 7 ) { return; }
+	I74_7 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I74_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x0360008293ULL ) ) { return; }
+		// $00:8293: $60.
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 5 ) { goto I75_5; }
+		if ( ui32Idx == 7 ) { goto I75_7; }
+		if ( ui32Idx == 9 ) { goto I75_9; }
+		if ( ui32Idx == 11 ) { goto I75_11; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 24 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I75_7; }
+		if ( ui32Idx == 9 ) { goto I75_9; }
+		if ( ui32Idx == 11 ) { goto I75_11; }
+		if ( ui32Idx != 5 ) { return; }
+	I75_5 :
+		if ( BlockPhi1( _pcThis, 24 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 139 );
+		if ( ui32Idx == 9 ) { goto I75_9; }
+		if ( ui32Idx == 11 ) { goto I75_11; }
+		if ( ui32Idx != 7 ) { return; }
+	I75_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 140 );
+		if ( ui32Idx == 11 ) { goto I75_11; }
+		if ( ui32Idx != 9 ) { return; }
+	I75_9 :
+		if ( BlockPhi1( _pcThis, 24 ) != 10 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx != 11 ) { return; }
+	I75_11 :
+		if ( BlockPhi1( _pcThis, 141 ) != 0 ) { goto Finish; }
+		BlockFetch( _pcThis, 0, UINT64_MAX );
+		return;
+	Finish :
+		BlockFinishCycle( _pcThis );
+	}
+
+	/** $00:8000, table 4. */
+	template <>
+	void CRicoh5A22::AotBlock<lsn::aotfixture::LSN_AOT_TAG, 0x04008000ULL>( CRicoh5A22 * _pcThis ) {
+		uint32_t ui32Idx;
+		// $00:8000: $A1.
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I0_5; }
+		if ( ui32Idx == 7 ) { goto I0_7; }
+		if ( ui32Idx == 9 ) { goto I0_9; }
+		if ( ui32Idx == 11 ) { goto I0_11; }
+		if ( ui32Idx == 13 ) { goto I0_13; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I0_7; }
+		if ( ui32Idx == 9 ) { goto I0_9; }
+		if ( ui32Idx == 11 ) { goto I0_11; }
+		if ( ui32Idx == 13 ) { goto I0_13; }
+		if ( ui32Idx != 5 ) { return; }
+	I0_5 :
+		if ( BlockPhi1( _pcThis, 23 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 9 ) { goto I0_9; }
+		if ( ui32Idx == 11 ) { goto I0_11; }
+		if ( ui32Idx == 13 ) { goto I0_13; }
+		if ( ui32Idx != 7 ) { return; }
+	I0_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 25 );
+		if ( ui32Idx == 11 ) { goto I0_11; }
+		if ( ui32Idx == 13 ) { goto I0_13; }
+		if ( ui32Idx != 9 ) { return; }
+	I0_9 :
+		if ( BlockPhi1( _pcThis, 24 ) != 10 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 26 );
+		if ( ui32Idx == 13 ) { goto I0_13; }
+		if ( ui32Idx != 11 ) { return; }
+	I0_11 :
+		if ( BlockPhi1( _pcThis, 24 ) != 12 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx != 13 ) { return; }
+	I0_13 :
+		if ( BlockPhi1( _pcThis, 189 ) != 0 ) { goto Finish; }
+		if ( !BlockFetch( _pcThis, 0, 0x04F0008002ULL ) ) { return; }
+		// $00:8002: $F0.
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 245 );
+		if ( ui32Idx == 5 ) { goto I1_5; }
+		if ( ui32Idx == 7 ) { goto I1_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 24 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I1_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I1_5 :
+		if ( BlockPhi1( _pcThis, 24 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx != 7 ) { return; }
+	I1_7 :
+		if ( BlockPhi1( _pcThis, 65 ) != 0 ) { goto Finish; }
+		BlockFetch( _pcThis, 0, UINT64_MAX );
+		return;
+	Finish :
+		BlockFinishCycle( _pcThis );
+	}
+
+	/** $00:8004, table 4. */
+	template <>
+	void CRicoh5A22::AotBlock<lsn::aotfixture::LSN_AOT_TAG, 0x04008004ULL>( CRicoh5A22 * _pcThis ) {
+		uint32_t ui32Idx;
+		// $00:8004: $80.
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 169 );
+		if ( ui32Idx == 5 ) { goto I0_5; }
+		if ( ui32Idx == 7 ) { goto I0_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 24 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I0_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I0_5 :
+		if ( BlockPhi1( _pcThis, 24 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx != 7 ) { return; }
+	I0_7 :
+		if ( BlockPhi1( _pcThis, 65 ) != 0 ) { goto Finish; }
+		BlockFetch( _pcThis, 0, UINT64_MAX );
+		return;
+	Finish :
+		BlockFinishCycle( _pcThis );
+	}
+
+	/** $00:8006, table 4. */
+	template <>
+	void CRicoh5A22::AotBlock<lsn::aotfixture::LSN_AOT_TAG, 0x04008006ULL>( CRicoh5A22 * _pcThis ) {
+		uint32_t ui32Idx;
+		// $00:8006: $DB.
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 5 ) { goto I0_5; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 24 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 229 );
+		if ( ui32Idx != 5 ) { return; }
+	I0_5 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+		BlockFetch( _pcThis, 0, UINT64_MAX );
+		return;
+	Finish :
+		BlockFinishCycle( _pcThis );
+	}
+
+	/** $00:8010, table 4. */
+	template <>
+	void CRicoh5A22::AotBlock<lsn::aotfixture::LSN_AOT_TAG, 0x04008010ULL>( CRicoh5A22 * _pcThis ) {
+		uint32_t ui32Idx;
+		// $00:8010: $20.
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I0_5; }
+		if ( ui32Idx == 7 ) { goto I0_7; }
+		if ( ui32Idx == 9 ) { goto I0_9; }
+		if ( ui32Idx == 11 ) { goto I0_11; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 62 );
+		if ( ui32Idx == 7 ) { goto I0_7; }
+		if ( ui32Idx == 9 ) { goto I0_9; }
+		if ( ui32Idx == 11 ) { goto I0_11; }
+		if ( ui32Idx != 5 ) { return; }
+	I0_5 :
+		if ( BlockPhi1( _pcThis, 24 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 9 ) { goto I0_9; }
+		if ( ui32Idx == 11 ) { goto I0_11; }
+		if ( ui32Idx != 7 ) { return; }
+	I0_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 84 );
+		if ( ui32Idx == 11 ) { goto I0_11; }
+		if ( ui32Idx != 9 ) { return; }
+	I0_9 :
+		if ( BlockPhi1( _pcThis, 24 ) != 10 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 85 );
+		if ( ui32Idx != 11 ) { return; }
+	I0_11 :
+		if ( BlockPhi1( _pcThis, 86 ) != 0 ) { goto Finish; }
+		BlockFetch( _pcThis, 0, UINT64_MAX );
+		return;
+	Finish :
+		BlockFinishCycle( _pcThis );
+	}
+
+	/** $00:8013, table 4. */
+	template <>
+	void CRicoh5A22::AotBlock<lsn::aotfixture::LSN_AOT_TAG, 0x04008013ULL>( CRicoh5A22 * _pcThis ) {
+		uint32_t ui32Idx;
+		// $00:8013: $18.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			_pcThis->m_fsState.rRegs.ui8Status &= 0xFE;
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8014 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x04FB008014ULL ) ) { return; }
+		// $00:8014: $FB.
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 249 ) != 0 ) { goto Finish; }
+		BlockFetch( _pcThis, 0, UINT64_MAX );
+		return;
+	Finish :
+		BlockFinishCycle( _pcThis );
+	}
+
+	/** $00:8100, table 4. */
+	template <>
+	void CRicoh5A22::AotBlock<lsn::aotfixture::LSN_AOT_TAG, 0x04008100ULL>( CRicoh5A22 * _pcThis ) {
+		uint32_t ui32Idx;
+		// $00:8100: $A9.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8101, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0x5A008101ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x005A;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0x5A );
+			const uint32_t ui32R = ui16Val;
+			_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8102 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x0485008102ULL ) ) { return; }
+		// $00:8102: $85.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x20 );
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8103, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x20008103ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x20;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16A;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( ui16Addr, 0, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8104 );
+				goto I1_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 123 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I1_5; }
+		if ( ui32Idx == 7 ) { goto I1_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I1_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I1_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 39 );
+		if ( ui32Idx != 7 ) { return; }
+	I1_7 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I1_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x04A9008104ULL ) ) { return; }
+		// $00:8104: $A9.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8105, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0xC3008105ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x00C3;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0xC3 );
+			const uint32_t ui32R = ui16Val;
+			_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8106 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x048D008106ULL ) ) { return; }
+		// $00:8106: $8D.
+		{
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8107, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8108, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x00008107ULL );
+				BlockLogFetch( _pcThis, 0x03008108ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0300;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16A;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( 0x0300, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8109 );
+				goto I3_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 123 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I3_5; }
+		if ( ui32Idx == 7 ) { goto I3_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I3_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I3_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 61 );
+		if ( ui32Idx != 7 ) { return; }
+	I3_7 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I3_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x04A2008109ULL ) ) { return; }
+		// $00:8109: $A2.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x810A, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0x8100810AULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x0081;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0x81 );
+			const uint32_t ui32R = ui16Val;
+			_pcThis->m_fsState.rRegs.ui8X[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x810B );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x048600810BULL ) ) { return; }
+		// $00:810B: $86.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x22 );
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x810C, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x2200810CULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x22;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16X;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( ui16Addr, 0, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x810D );
+				goto I5_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 171 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I5_5; }
+		if ( ui32Idx == 7 ) { goto I5_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I5_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I5_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 39 );
+		if ( ui32Idx != 7 ) { return; }
+	I5_7 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I5_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x04A000810DULL ) ) { return; }
+		// $00:810D: $A0.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x810E, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0x7F00810EULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x007F;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0x7F );
+			const uint32_t ui32R = ui16Val;
+			_pcThis->m_fsState.rRegs.ui8Y[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x810F );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x048C00810FULL ) ) { return; }
+		// $00:810F: $8C.
+		{
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8110, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8111, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x02008110ULL );
+				BlockLogFetch( _pcThis, 0x03008111ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0302;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16Y;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( 0x0302, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8112 );
+				goto I7_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 136 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I7_5; }
+		if ( ui32Idx == 7 ) { goto I7_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I7_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I7_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 61 );
+		if ( ui32Idx != 7 ) { return; }
+	I7_7 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I7_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x0464008112ULL ) ) { return; }
+		// $00:8112: $64.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x24 );
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8113, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x24008113ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x24;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = 0;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( ui16Addr, 0, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8114 );
+				goto I8_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 145 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I8_5; }
+		if ( ui32Idx == 7 ) { goto I8_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I8_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I8_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 39 );
+		if ( ui32Idx != 7 ) { return; }
+	I8_7 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I8_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x049C008114ULL ) ) { return; }
+		// $00:8114: $9C.
+		{
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8115, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8116, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x04008115ULL );
+				BlockLogFetch( _pcThis, 0x03008116ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0304;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = 0;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( 0x0304, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8117 );
+				goto I9_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 145 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I9_5; }
+		if ( ui32Idx == 7 ) { goto I9_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I9_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I9_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 61 );
+		if ( ui32Idx != 7 ) { return; }
+	I9_7 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I9_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x0418008117ULL ) ) { return; }
+		// $00:8117: $18.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			_pcThis->m_fsState.rRegs.ui8Status &= 0xFE;
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8118 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x0469008118ULL ) ) { return; }
+		// $00:8118: $69.
+		{
+			if ( !(_pcThis->m_fsState.rRegs.ui8Status & D()) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8119, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0xF0008119ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				const uint16_t ui16Val = 0x00F0;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.SetDataBus( 0xF0 );
+				const uint32_t ui32V = ui16Val;
+				const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui8A[0];
+				const uint32_t ui32R = ui32A + ui32V + (_pcThis->m_fsState.rRegs.ui8Status & C());
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R > 0xFF ? C() : 0) | ((~(ui32A ^ ui32V) & (ui32A ^ ui32R) & 0x80) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 1;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x811A );
+				goto I11_4;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 4 );
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 152 ) != 0 ) { goto Finish; }
+	I11_4 :
+		if ( !BlockFetch( _pcThis, 0, 0x046500811AULL ) ) { return; }
+		// $00:811A: $65.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x20 );
+			if ( !(_pcThis->m_fsState.rRegs.ui8Status & D()) && _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x811B, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x2000811BULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x20;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32V = ui16Val;
+				const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui8A[0];
+				const uint32_t ui32R = ui32A + ui32V + (_pcThis->m_fsState.rRegs.ui8Status & C());
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R > 0xFF ? C() : 0) | ((~(ui32A ^ ui32V) & (ui32A ^ ui32R) & 0x80) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x811C );
+				goto I12_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I12_5; }
+		if ( ui32Idx == 7 ) { goto I12_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I12_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I12_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx != 7 ) { return; }
+	I12_7 :
+		if ( BlockPhi1( _pcThis, 143 ) != 0 ) { goto Finish; }
+	I12_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x046D00811CULL ) ) { return; }
+		// $00:811C: $6D.
+		{
+			if ( !(_pcThis->m_fsState.rRegs.ui8Status & D()) && _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x811D, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x811E, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x0000811DULL );
+				BlockLogFetch( _pcThis, 0x0300811EULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0300;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0300, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32V = ui16Val;
+				const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui8A[0];
+				const uint32_t ui32R = ui32A + ui32V + (_pcThis->m_fsState.rRegs.ui8Status & C());
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R > 0xFF ? C() : 0) | ((~(ui32A ^ ui32V) & (ui32A ^ ui32R) & 0x80) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x811F );
+				goto I13_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I13_5; }
+		if ( ui32Idx == 7 ) { goto I13_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I13_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I13_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx != 7 ) { return; }
+	I13_7 :
+		if ( BlockPhi1( _pcThis, 143 ) != 0 ) { goto Finish; }
+	I13_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x043800811FULL ) ) { return; }
+		// $00:811F: $38.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			_pcThis->m_fsState.rRegs.ui8Status |= 0x01;
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8120 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x04E9008120ULL ) ) { return; }
+		// $00:8120: $E9.
+		{
+			if ( !(_pcThis->m_fsState.rRegs.ui8Status & D()) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8121, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x11008121ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				const uint16_t ui16Val = 0x0011;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.SetDataBus( 0x11 );
+				const uint32_t ui32V = ui16Val ^ 0xFF;
+				const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui8A[0];
+				const uint32_t ui32R = ui32A + ui32V + (_pcThis->m_fsState.rRegs.ui8Status & C());
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R > 0xFF ? C() : 0) | ((~(ui32A ^ ui32V) & (ui32A ^ ui32R) & 0x80) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 1;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8122 );
+				goto I15_4;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 4 );
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 243 ) != 0 ) { goto Finish; }
+	I15_4 :
+		if ( !BlockFetch( _pcThis, 0, 0x04E5008122ULL ) ) { return; }
+		// $00:8122: $E5.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x22 );
+			if ( !(_pcThis->m_fsState.rRegs.ui8Status & D()) && _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8123, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x22008123ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x22;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32V = ui16Val ^ 0xFF;
+				const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui8A[0];
+				const uint32_t ui32R = ui32A + ui32V + (_pcThis->m_fsState.rRegs.ui8Status & C());
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R > 0xFF ? C() : 0) | ((~(ui32A ^ ui32V) & (ui32A ^ ui32R) & 0x80) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8124 );
+				goto I16_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I16_5; }
+		if ( ui32Idx == 7 ) { goto I16_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I16_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I16_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx != 7 ) { return; }
+	I16_7 :
+		if ( BlockPhi1( _pcThis, 234 ) != 0 ) { goto Finish; }
+	I16_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x04ED008124ULL ) ) { return; }
+		// $00:8124: $ED.
+		{
+			if ( !(_pcThis->m_fsState.rRegs.ui8Status & D()) && _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8125, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8126, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x02008125ULL );
+				BlockLogFetch( _pcThis, 0x03008126ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0302;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0302, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32V = ui16Val ^ 0xFF;
+				const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui8A[0];
+				const uint32_t ui32R = ui32A + ui32V + (_pcThis->m_fsState.rRegs.ui8Status & C());
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R > 0xFF ? C() : 0) | ((~(ui32A ^ ui32V) & (ui32A ^ ui32R) & 0x80) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8127 );
+				goto I17_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I17_5; }
+		if ( ui32Idx == 7 ) { goto I17_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I17_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I17_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx != 7 ) { return; }
+	I17_7 :
+		if ( BlockPhi1( _pcThis, 234 ) != 0 ) { goto Finish; }
+	I17_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x0485008127ULL ) ) { return; }
+		// $00:8127: $85.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x26 );
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8128, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x26008128ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x26;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16A;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( ui16Addr, 0, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8129 );
+				goto I18_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 123 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I18_5; }
+		if ( ui32Idx == 7 ) { goto I18_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I18_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I18_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 39 );
+		if ( ui32Idx != 7 ) { return; }
+	I18_7 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I18_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x0409008129ULL ) ) { return; }
+		// $00:8129: $09.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x812A, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0x0F00812AULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x000F;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0x0F );
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) | ui16Val;
+			_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x812B );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x040500812BULL ) ) { return; }
+		// $00:812B: $05.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x20 );
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x812C, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x2000812CULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x20;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) | ui16Val;
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x812D );
+				goto I20_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I20_5; }
+		if ( ui32Idx == 7 ) { goto I20_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I20_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I20_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx != 7 ) { return; }
+	I20_7 :
+		if ( BlockPhi1( _pcThis, 30 ) != 0 ) { goto Finish; }
+	I20_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x042900812DULL ) ) { return; }
+		// $00:812D: $29.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x812E, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0xF300812EULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x00F3;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0xF3 );
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) & ui16Val;
+			_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x812F );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x042D00812FULL ) ) { return; }
+		// $00:812F: $2D.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8130, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8131, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x00008130ULL );
+				BlockLogFetch( _pcThis, 0x03008131ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0300;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0300, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) & ui16Val;
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8132 );
+				goto I22_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I22_5; }
+		if ( ui32Idx == 7 ) { goto I22_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I22_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I22_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx != 7 ) { return; }
+	I22_7 :
+		if ( BlockPhi1( _pcThis, 88 ) != 0 ) { goto Finish; }
+	I22_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x0449008132ULL ) ) { return; }
+		// $00:8132: $49.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8133, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0xFF008133ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x00FF;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0xFF );
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) ^ ui16Val;
+			_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8134 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x0445008134ULL ) ) { return; }
+		// $00:8134: $45.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x22 );
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8135, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x22008135ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x22;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) ^ ui16Val;
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8136 );
+				goto I24_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I24_5; }
+		if ( ui32Idx == 7 ) { goto I24_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I24_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I24_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx != 7 ) { return; }
+	I24_7 :
+		if ( BlockPhi1( _pcThis, 116 ) != 0 ) { goto Finish; }
+	I24_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x048D008136ULL ) ) { return; }
+		// $00:8136: $8D.
+		{
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8137, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8138, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x06008137ULL );
+				BlockLogFetch( _pcThis, 0x03008138ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0306;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16A;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( 0x0306, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8139 );
+				goto I25_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 123 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I25_5; }
+		if ( ui32Idx == 7 ) { goto I25_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I25_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I25_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 61 );
+		if ( ui32Idx != 7 ) { return; }
+	I25_7 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I25_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x04C9008139ULL ) ) { return; }
+		// $00:8139: $C9.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x813A, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0x1000813AULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x0010;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0x10 );
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) - ui16Val;
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R <= 0xFF ? C() : 0) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x813B );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x04C500813BULL ) ) { return; }
+		// $00:813B: $C5.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x20 );
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x813C, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x2000813CULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x20;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) - ui16Val;
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R <= 0xFF ? C() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x813D );
+				goto I27_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I27_5; }
+		if ( ui32Idx == 7 ) { goto I27_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I27_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I27_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx != 7 ) { return; }
+	I27_7 :
+		if ( BlockPhi1( _pcThis, 212 ) != 0 ) { goto Finish; }
+	I27_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x04CD00813DULL ) ) { return; }
+		// $00:813D: $CD.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x813E, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x813F, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x0000813EULL );
+				BlockLogFetch( _pcThis, 0x0300813FULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0300;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0300, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) - ui16Val;
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R <= 0xFF ? C() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8140 );
+				goto I28_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I28_5; }
+		if ( ui32Idx == 7 ) { goto I28_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I28_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I28_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx != 7 ) { return; }
+	I28_7 :
+		if ( BlockPhi1( _pcThis, 212 ) != 0 ) { goto Finish; }
+	I28_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x04E0008140ULL ) ) { return; }
+		// $00:8140: $E0.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8141, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0x81008141ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x0081;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0x81 );
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8X[0] ) - ui16Val;
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R <= 0xFF ? C() : 0) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8142 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x04E4008142ULL ) ) { return; }
+		// $00:8142: $E4.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x22 );
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8143, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x22008143ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x22;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8X[0] ) - ui16Val;
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R <= 0xFF ? C() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8144 );
+				goto I30_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I30_5; }
+		if ( ui32Idx == 7 ) { goto I30_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I30_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I30_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx != 7 ) { return; }
+	I30_7 :
+		if ( BlockPhi1( _pcThis, 237 ) != 0 ) { goto Finish; }
+	I30_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x04EC008144ULL ) ) { return; }
+		// $00:8144: $EC.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8145, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8146, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x00008145ULL );
+				BlockLogFetch( _pcThis, 0x03008146ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0300;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0300, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8X[0] ) - ui16Val;
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R <= 0xFF ? C() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8147 );
+				goto I31_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I31_5; }
+		if ( ui32Idx == 7 ) { goto I31_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I31_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I31_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx != 7 ) { return; }
+	I31_7 :
+		if ( BlockPhi1( _pcThis, 237 ) != 0 ) { goto Finish; }
+	I31_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x04C0008147ULL ) ) { return; }
+		// $00:8147: $C0.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8148, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0x80008148ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x0080;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0x80 );
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8Y[0] ) - ui16Val;
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R <= 0xFF ? C() : 0) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8149 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x04CC008149ULL ) ) { return; }
+		// $00:8149: $CC.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x814A, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x814B, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x0200814AULL );
+				BlockLogFetch( _pcThis, 0x0300814BULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0302;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0302, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8Y[0] ) - ui16Val;
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R <= 0xFF ? C() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x814C );
+				goto I33_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I33_5; }
+		if ( ui32Idx == 7 ) { goto I33_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I33_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I33_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx != 7 ) { return; }
+	I33_7 :
+		if ( BlockPhi1( _pcThis, 215 ) != 0 ) { goto Finish; }
+	I33_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x04C400814CULL ) ) { return; }
+		// $00:814C: $C4.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x20 );
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x814D, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x2000814DULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x20;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8Y[0] ) - ui16Val;
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R <= 0xFF ? C() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x814E );
+				goto I34_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I34_5; }
+		if ( ui32Idx == 7 ) { goto I34_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I34_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I34_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx != 7 ) { return; }
+	I34_7 :
+		if ( BlockPhi1( _pcThis, 215 ) != 0 ) { goto Finish; }
+	I34_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x048900814EULL ) ) { return; }
+		// $00:814E: $89.
+		{
+			uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x814F, 0x00 );
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+			BlockLogFetch( _pcThis, 0x4000814FULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint16_t ui16Val = 0x0040;
+			_pcThis->m_fsState.ui16Operand = ui16Val;
+			_pcThis->m_baBusA.SetDataBus( 0x40 );
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) & ui16Val;
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0xFD) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8150 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x0424008150ULL ) ) { return; }
+		// $00:8150: $24.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x20 );
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8151, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x20008151ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x20;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) & ui16Val;
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3D) | ((ui16Val & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | ((ui16Val & 0x40) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8152 );
+				goto I36_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I36_5; }
+		if ( ui32Idx == 7 ) { goto I36_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I36_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I36_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx != 7 ) { return; }
+	I36_7 :
+		if ( BlockPhi1( _pcThis, 94 ) != 0 ) { goto Finish; }
+	I36_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x042C008152ULL ) ) { return; }
+		// $00:8152: $2C.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8153, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8154, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x00008153ULL );
+				BlockLogFetch( _pcThis, 0x03008154ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0300;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0300, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) & ui16Val;
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3D) | ((ui16Val & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | ((ui16Val & 0x40) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8155 );
+				goto I37_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I37_5; }
+		if ( ui32Idx == 7 ) { goto I37_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I37_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I37_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx != 7 ) { return; }
+	I37_7 :
+		if ( BlockPhi1( _pcThis, 94 ) != 0 ) { goto Finish; }
+	I37_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x041A008155ULL ) ) { return; }
+		// $00:8155: $1A.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) + 1;
+			_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8156 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x043A008156ULL ) ) { return; }
+		// $00:8156: $3A.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) - 1;
+			_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8157 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x04E8008157ULL ) ) { return; }
+		// $00:8157: $E8.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8X[0] ) + 1;
+			_pcThis->m_fsState.rRegs.ui8X[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8158 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x04C8008158ULL ) ) { return; }
+		// $00:8158: $C8.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8Y[0] ) + 1;
+			_pcThis->m_fsState.rRegs.ui8Y[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8159 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x04CA008159ULL ) ) { return; }
+		// $00:8159: $CA.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8X[0] ) - 1;
+			_pcThis->m_fsState.rRegs.ui8X[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x815A );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x048800815AULL ) ) { return; }
+		// $00:815A: $88.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8Y[0] ) - 1;
+			_pcThis->m_fsState.rRegs.ui8Y[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x815B );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x040A00815BULL ) ) { return; }
+		// $00:815B: $0A.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) << 1;
+			_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R > 0xFF ? C() : 0) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x815C );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x042A00815CULL ) ) { return; }
+		// $00:815C: $2A.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = (uint32_t( _pcThis->m_fsState.rRegs.ui8A[0] ) << 1) | (_pcThis->m_fsState.rRegs.ui8Status & C());
+			_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R > 0xFF ? C() : 0) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x815D );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x044A00815DULL ) ) { return; }
+		// $00:815D: $4A.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui8A[0];
+			const uint32_t ui32R = ui32A >> 1;
+			_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32A & C()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x815E );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x046A00815EULL ) ) { return; }
+		// $00:815E: $6A.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui8A[0];
+			const uint32_t ui32R = (ui32A >> 1) | ((_pcThis->m_fsState.rRegs.ui8Status & C()) ? 0x80 : 0);
+			_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32A & C()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x815F );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x04B800815FULL ) ) { return; }
+		// $00:815F: $B8.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			_pcThis->m_fsState.rRegs.ui8Status &= 0xBF;
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8160 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x04AA008160ULL ) ) { return; }
+		// $00:8160: $AA.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = _pcThis->m_fsState.rRegs.ui8A[0];
+			_pcThis->m_fsState.rRegs.ui8X[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8161 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x04A8008161ULL ) ) { return; }
+		// $00:8161: $A8.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = _pcThis->m_fsState.rRegs.ui8A[0];
+			_pcThis->m_fsState.rRegs.ui8Y[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8162 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x048A008162ULL ) ) { return; }
+		// $00:8162: $8A.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = _pcThis->m_fsState.rRegs.ui8X[0];
+			_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8163 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x0498008163ULL ) ) { return; }
+		// $00:8163: $98.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = _pcThis->m_fsState.rRegs.ui8Y[0];
+			_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8164 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x049B008164ULL ) ) { return; }
+		// $00:8164: $9B.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = _pcThis->m_fsState.rRegs.ui8X[0];
+			_pcThis->m_fsState.rRegs.ui8Y[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8165 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x04BB008165ULL ) ) { return; }
+		// $00:8165: $BB.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			const uint32_t ui32R = _pcThis->m_fsState.rRegs.ui8Y[0];
+			_pcThis->m_fsState.rRegs.ui8X[0] = uint8_t( ui32R );
+			_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8166 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x0485008166ULL ) ) { return; }
+		// $00:8166: $85.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x28 );
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8167, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x28008167ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x28;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16A;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( ui16Addr, 0, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8168 );
+				goto I55_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 123 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I55_5; }
+		if ( ui32Idx == 7 ) { goto I55_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I55_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I55_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 39 );
+		if ( ui32Idx != 7 ) { return; }
+	I55_7 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I55_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x04A5008168ULL ) ) { return; }
+		// $00:8168: $A5.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x20 );
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8169, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x20008169ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x20;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = ui16Val;
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x816A );
+				goto I56_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I56_5; }
+		if ( ui32Idx == 7 ) { goto I56_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I56_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I56_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx != 7 ) { return; }
+	I56_7 :
+		if ( BlockPhi1( _pcThis, 189 ) != 0 ) { goto Finish; }
+	I56_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x04AE00816AULL ) ) { return; }
+		// $00:816A: $AE.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x816B, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x816C, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x0000816BULL );
+				BlockLogFetch( _pcThis, 0x0300816CULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0300;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0300, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = ui16Val;
+				_pcThis->m_fsState.rRegs.ui8X[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x816D );
+				goto I57_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I57_5; }
+		if ( ui32Idx == 7 ) { goto I57_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I57_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I57_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx != 7 ) { return; }
+	I57_7 :
+		if ( BlockPhi1( _pcThis, 195 ) != 0 ) { goto Finish; }
+	I57_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x04A400816DULL ) ) { return; }
+		// $00:816D: $A4.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x22 );
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x816E, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x2200816EULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x22;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = ui16Val;
+				_pcThis->m_fsState.rRegs.ui8Y[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x816F );
+				goto I58_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I58_5; }
+		if ( ui32Idx == 7 ) { goto I58_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I58_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I58_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx != 7 ) { return; }
+	I58_7 :
+		if ( BlockPhi1( _pcThis, 193 ) != 0 ) { goto Finish; }
+	I58_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x04AD00816FULL ) ) { return; }
+		// $00:816F: $AD.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8170, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8171, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x02008170ULL );
+				BlockLogFetch( _pcThis, 0x03008171ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0302;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0302, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = ui16Val;
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8172 );
+				goto I59_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I59_5; }
+		if ( ui32Idx == 7 ) { goto I59_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I59_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I59_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx != 7 ) { return; }
+	I59_7 :
+		if ( BlockPhi1( _pcThis, 189 ) != 0 ) { goto Finish; }
+	I59_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x04A6008172ULL ) ) { return; }
+		// $00:8172: $A6.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x24 );
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8173, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x24008173ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x24;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = ui16Val;
+				_pcThis->m_fsState.rRegs.ui8X[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8174 );
+				goto I60_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I60_5; }
+		if ( ui32Idx == 7 ) { goto I60_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I60_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I60_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx != 7 ) { return; }
+	I60_7 :
+		if ( BlockPhi1( _pcThis, 195 ) != 0 ) { goto Finish; }
+	I60_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x04AC008174ULL ) ) { return; }
+		// $00:8174: $AC.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8175, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8176, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x04008175ULL );
+				BlockLogFetch( _pcThis, 0x03008176ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0304;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x0304, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = ui16Val;
+				_pcThis->m_fsState.rRegs.ui8Y[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8177 );
+				goto I61_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I61_5; }
+		if ( ui32Idx == 7 ) { goto I61_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I61_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I61_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx != 7 ) { return; }
+	I61_7 :
+		if ( BlockPhi1( _pcThis, 193 ) != 0 ) { goto Finish; }
+	I61_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x0485008177ULL ) ) { return; }
+		// $00:8177: $85.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x2A );
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8178, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x2A008178ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x2A;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16A;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( ui16Addr, 0, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8179 );
+				goto I62_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 123 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I62_5; }
+		if ( ui32Idx == 7 ) { goto I62_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I62_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I62_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 39 );
+		if ( ui32Idx != 7 ) { return; }
+	I62_7 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I62_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x048E008179ULL ) ) { return; }
+		// $00:8179: $8E.
+		{
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x817A, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x817B, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x0800817AULL );
+				BlockLogFetch( _pcThis, 0x0300817BULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x0308;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16X;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( 0x0308, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x817C );
+				goto I63_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 171 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I63_5; }
+		if ( ui32Idx == 7 ) { goto I63_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I63_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I63_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 61 );
+		if ( ui32Idx != 7 ) { return; }
+	I63_7 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I63_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x048400817CULL ) ) { return; }
+		// $00:817C: $84.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x2C );
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x817D, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x2C00817DULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x2C;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16Y;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( ui16Addr, 0, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x817E );
+				goto I64_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 136 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I64_5; }
+		if ( ui32Idx == 7 ) { goto I64_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I64_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I64_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 39 );
+		if ( ui32Idx != 7 ) { return; }
+	I64_7 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I64_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x048D00817EULL ) ) { return; }
+		// $00:817E: $8D.
+		{
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x817F, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8180, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x0A00817FULL );
+				BlockLogFetch( _pcThis, 0x03008180ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x030A;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16A;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( 0x030A, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8181 );
+				goto I65_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 123 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I65_5; }
+		if ( ui32Idx == 7 ) { goto I65_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I65_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I65_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 61 );
+		if ( ui32Idx != 7 ) { return; }
+	I65_7 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I65_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x04EA008181ULL ) ) { return; }
+		// $00:8181: $EA.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8182 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x04F8008182ULL ) ) { return; }
+		// $00:8182: $F8.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			_pcThis->m_fsState.rRegs.ui8Status |= 0x08;
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8183 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x0469008183ULL ) ) { return; }
+		// $00:8183: $69.
+		{
+			if ( !(_pcThis->m_fsState.rRegs.ui8Status & D()) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8184, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x19008184ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				const uint16_t ui16Val = 0x0019;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.SetDataBus( 0x19 );
+				const uint32_t ui32V = ui16Val;
+				const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui8A[0];
+				const uint32_t ui32R = ui32A + ui32V + (_pcThis->m_fsState.rRegs.ui8Status & C());
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R > 0xFF ? C() : 0) | ((~(ui32A ^ ui32V) & (ui32A ^ ui32R) & 0x80) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 1;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8185 );
+				goto I68_4;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 4 );
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 152 ) != 0 ) { goto Finish; }
+	I68_4 :
+		if ( !BlockFetch( _pcThis, 0, 0x04E5008185ULL ) ) { return; }
+		// $00:8185: $E5.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0x20 );
+			if ( !(_pcThis->m_fsState.rRegs.ui8Status & D()) && _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8186, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x20008186ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0x20;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32V = ui16Val ^ 0xFF;
+				const uint32_t ui32A = _pcThis->m_fsState.rRegs.ui8A[0];
+				const uint32_t ui32R = ui32A + ui32V + (_pcThis->m_fsState.rRegs.ui8Status & C());
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x3C) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) | (ui32R > 0xFF ? C() : 0) | ((~(ui32A ^ ui32V) & (ui32A ^ ui32R) & 0x80) ? V() : 0) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8187 );
+				goto I69_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I69_5; }
+		if ( ui32Idx == 7 ) { goto I69_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I69_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I69_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx != 7 ) { return; }
+	I69_7 :
+		if ( BlockPhi1( _pcThis, 234 ) != 0 ) { goto Finish; }
+	I69_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x04D8008187ULL ) ) { return; }
+		// $00:8187: $D8.
+		{
+			uint8_t ui8Speed = _pcThis->m_ui8FastDiv;
+			uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+#endif	// #ifdef LSN_CPU_VERIFY
+			_pcThis->m_fsState.rRegs.ui8Status &= 0xF7;
+			_pcThis->m_ui64MasterCycles += ui64Ticks;
+			_pcThis->m_ui64BlockCycles += 1;
+			_pcThis->m_ui8Speed = ui8Speed;
+			_pcThis->AotEndInstr( 0x8188 );
+		}
+		if ( !BlockFetch( _pcThis, 0, 0x04A5008188ULL ) ) { return; }
+		// $00:8188: $A5.
+		{
+			const uint16_t ui16Addr = uint16_t( _pcThis->m_fsState.rRegs.ui16D + 0xFE );
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( ui16Addr >> 8 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8189, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0xFE008189ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = ui16Addr;
+				_pcThis->m_fsState.ui16Pointer = 0xFE;
+				if ( _pcThis->m_fsState.rRegs.ui8D[0] ) {
+					ui64Ticks += _pcThis->m_ui8FastDiv;
+					++_pcThis->m_ui64BlockCycles;
+				}
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( ui16Addr, 0, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = ui16Val;
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 2;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x818A );
+				goto I71_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 20 );
+		if ( ui32Idx == 5 ) { goto I71_5; }
+		if ( ui32Idx == 7 ) { goto I71_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 21 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I71_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I71_5 :
+		if ( BlockPhi1( _pcThis, 36 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 34 );
+		if ( ui32Idx != 7 ) { return; }
+	I71_7 :
+		if ( BlockPhi1( _pcThis, 189 ) != 0 ) { goto Finish; }
+	I71_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x04AD00818AULL ) ) { return; }
+		// $00:818A: $AD.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x03 ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x818B, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x818C, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0xFF00818BULL );
+				BlockLogFetch( _pcThis, 0x0300818CULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x03FF;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x03FF, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = ui16Val;
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x818D );
+				goto I72_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I72_5; }
+		if ( ui32Idx == 7 ) { goto I72_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I72_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I72_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx != 7 ) { return; }
+	I72_7 :
+		if ( BlockPhi1( _pcThis, 189 ) != 0 ) { goto Finish; }
+	I72_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x04AD00818DULL ) ) { return; }
+		// $00:818D: $AD.
+		{
+			if ( _pcThis->m_baBusA.IsPlainMemory( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x8F ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x818E, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x818F, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x8000818EULL );
+				BlockLogFetch( _pcThis, 0x8F00818FULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x8F80;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_baBusA.Read( 0x8F80, _pcThis->m_fsState.ui8Bank, ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				const uint32_t ui32R = ui16Val;
+				_pcThis->m_fsState.rRegs.ui8A[0] = uint8_t( ui32R );
+				_pcThis->m_fsState.rRegs.ui8Status = uint8_t( (_pcThis->m_fsState.rRegs.ui8Status & 0x7D) | ((ui32R & 0x80) ? N() : 0) | ((ui32R & 0xFF) ? 0 : Z()) );
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8190 );
+				goto I73_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I73_5; }
+		if ( ui32Idx == 7 ) { goto I73_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I73_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I73_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 27 );
+		if ( ui32Idx != 7 ) { return; }
+	I73_7 :
+		if ( BlockPhi1( _pcThis, 189 ) != 0 ) { goto Finish; }
+	I73_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x048D008190ULL ) ) { return; }
+		// $00:8190: $8D.
+		{
+			if ( _pcThis->m_baBusA.IsPlainWrite( uint16_t( (_pcThis->m_fsState.rRegs.ui8Db << 8) | 0x8F ) ) ) {
+				uint8_t ui8Speed = _pcThis->m_baBusA.Speed( 0x8191, 0x00 );
+				uint64_t ui64Ticks = ui8Speed;
+				ui64Ticks += (ui8Speed = _pcThis->m_baBusA.Speed( 0x8192, 0x00 ));
+#ifdef LSN_CPU_VERIFY
+				BlockLogFetch( _pcThis, 0x80008191ULL );
+				BlockLogFetch( _pcThis, 0x8F008192ULL );
+#endif	// #ifdef LSN_CPU_VERIFY
+				_pcThis->m_fsState.ui16Address = 0x8F80;
+				_pcThis->m_fsState.ui8Bank = _pcThis->m_fsState.rRegs.ui8Db;
+				const uint16_t ui16Val = _pcThis->m_fsState.rRegs.ui16A;
+				_pcThis->m_fsState.ui16Operand = ui16Val;
+				_pcThis->m_baBusA.Write( 0x8F80, _pcThis->m_fsState.ui8Bank, uint8_t( ui16Val ), ui8Speed );
+				ui64Ticks += ui8Speed;
+				_pcThis->m_ui64MasterCycles += ui64Ticks;
+				_pcThis->m_ui64BlockCycles += 3;
+				_pcThis->m_ui8Speed = ui8Speed;
+				_pcThis->AotEndInstr( 0x8193 );
+				goto I74_8;
+			}
+		}
+		if ( BlockPhi1( _pcThis, 123 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 58 );
+		if ( ui32Idx == 5 ) { goto I74_5; }
+		if ( ui32Idx == 7 ) { goto I74_7; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 3 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 59 );
+		if ( ui32Idx == 7 ) { goto I74_7; }
+		if ( ui32Idx != 5 ) { return; }
+	I74_5 :
+		if ( BlockPhi1( _pcThis, 21 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 61 );
+		if ( ui32Idx != 7 ) { return; }
+	I74_7 :
+		if ( BlockPhi1( _pcThis, 40 ) != 0 ) { goto Finish; }
+	I74_8 :
+		if ( !BlockFetch( _pcThis, 0, 0x0460008193ULL ) ) { return; }
+		// $00:8193: $60.
+		if ( BlockPhi1( _pcThis, 3 ) != 2 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 5 ) { goto I75_5; }
+		if ( ui32Idx == 7 ) { goto I75_7; }
+		if ( ui32Idx == 9 ) { goto I75_9; }
+		if ( ui32Idx == 11 ) { goto I75_11; }
+		if ( ui32Idx != 3 ) { return; }
+		if ( BlockPhi1( _pcThis, 24 ) != 4 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx == 7 ) { goto I75_7; }
+		if ( ui32Idx == 9 ) { goto I75_9; }
+		if ( ui32Idx == 11 ) { goto I75_11; }
+		if ( ui32Idx != 5 ) { return; }
+	I75_5 :
+		if ( BlockPhi1( _pcThis, 24 ) != 6 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 139 );
+		if ( ui32Idx == 9 ) { goto I75_9; }
+		if ( ui32Idx == 11 ) { goto I75_11; }
+		if ( ui32Idx != 7 ) { return; }
+	I75_7 :
+		if ( BlockPhi1( _pcThis, 24 ) != 8 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 140 );
+		if ( ui32Idx == 11 ) { goto I75_11; }
+		if ( ui32Idx != 9 ) { return; }
+	I75_9 :
+		if ( BlockPhi1( _pcThis, 24 ) != 10 ) { goto Finish; }
+		ui32Idx = BlockPhi2( _pcThis, 22 );
+		if ( ui32Idx != 11 ) { return; }
+	I75_11 :
+		if ( BlockPhi1( _pcThis, 141 ) != 0 ) { goto Finish; }
+		BlockFetch( _pcThis, 0, UINT64_MAX );
+		return;
+	Finish :
+		BlockFinishCycle( _pcThis );
+	}
+
+}	// namespace lsn
+
+namespace lsn::aotfixture {
+
+	/** Every generated block. */
+	static const lsn::CRicoh5A22::LSN_AOT_BLOCK g_abBlocks[] = {
+		{ 0x00801A, 0, 0xA9, &lsn::CRicoh5A22::AotBlock<LSN_AOT_TAG, 0x0000801AULL> },
+		{ 0x008021, 0, 0xE2, &lsn::CRicoh5A22::AotBlock<LSN_AOT_TAG, 0x00008021ULL> },
+		{ 0x008028, 0, 0xE2, &lsn::CRicoh5A22::AotBlock<LSN_AOT_TAG, 0x00008028ULL> },
+		{ 0x008300, 0, 0xA9, &lsn::CRicoh5A22::AotBlock<LSN_AOT_TAG, 0x00008300ULL> },
+		{ 0x00802A, 1, 0x20, &lsn::CRicoh5A22::AotBlock<LSN_AOT_TAG, 0x0100802AULL> },
+		{ 0x00802D, 1, 0x80, &lsn::CRicoh5A22::AotBlock<LSN_AOT_TAG, 0x0100802DULL> },
+		{ 0x00802F, 1, 0xDB, &lsn::CRicoh5A22::AotBlock<LSN_AOT_TAG, 0x0100802FULL> },
+		{ 0x008500, 1, 0xA9, &lsn::CRicoh5A22::AotBlock<LSN_AOT_TAG, 0x01008500ULL> },
+		{ 0x008023, 2, 0x20, &lsn::CRicoh5A22::AotBlock<LSN_AOT_TAG, 0x02008023ULL> },
+		{ 0x008026, 2, 0xC2, &lsn::CRicoh5A22::AotBlock<LSN_AOT_TAG, 0x02008026ULL> },
+		{ 0x008400, 2, 0xA9, &lsn::CRicoh5A22::AotBlock<LSN_AOT_TAG, 0x02008400ULL> },
+		{ 0x008015, 3, 0x20, &lsn::CRicoh5A22::AotBlock<LSN_AOT_TAG, 0x03008015ULL> },
+		{ 0x008018, 3, 0xC2, &lsn::CRicoh5A22::AotBlock<LSN_AOT_TAG, 0x03008018ULL> },
+		{ 0x008200, 3, 0xA9, &lsn::CRicoh5A22::AotBlock<LSN_AOT_TAG, 0x03008200ULL> },
+		{ 0x008000, 4, 0xA1, &lsn::CRicoh5A22::AotBlock<LSN_AOT_TAG, 0x04008000ULL> },
+		{ 0x008004, 4, 0x80, &lsn::CRicoh5A22::AotBlock<LSN_AOT_TAG, 0x04008004ULL> },
+		{ 0x008006, 4, 0xDB, &lsn::CRicoh5A22::AotBlock<LSN_AOT_TAG, 0x04008006ULL> },
+		{ 0x008010, 4, 0x20, &lsn::CRicoh5A22::AotBlock<LSN_AOT_TAG, 0x04008010ULL> },
+		{ 0x008013, 4, 0x18, &lsn::CRicoh5A22::AotBlock<LSN_AOT_TAG, 0x04008013ULL> },
+		{ 0x008100, 4, 0xA9, &lsn::CRicoh5A22::AotBlock<LSN_AOT_TAG, 0x04008100ULL> },
+	};
+
+	/**
+	 * Registers the generated blocks with a CPU for use by RunAot().
+	 *
+	 * \param _cCpu The CPU.
+	 * \return Returns false if the CPU core does not match the one that generated this file.
+	 **/
+	bool Register( lsn::CRicoh5A22 &_cCpu ) {
+		return _cCpu.SetAotBlocks( g_abBlocks, 20, 0x6B081FBF4E27547DULL );
+	}
+
+}	// namespace lsn::aotfixture
+
+#endif	// #ifdef LSN_CPU_VERIFY
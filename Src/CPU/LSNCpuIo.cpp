@@ -0,0 +1,419 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: The 5A22's internal I/O page ($4200-$42FF): the NMI/IRQ timers, MEMSEL, and the DMA enables.
+ */
+
+
+#include "LSNCpuIo.h"
+
+#include <algorithm>
+
+
+namespace lsn {
+
+	// == Functions.
+	/**
+	 * Resets the registers to their power-on state and starts a frame at the CPU's current master cycle.
+	 **/
+	void CCpuIo::Reset() {
+		const uint64_t ui64Now = m_rCpu.GetMasterCycles();
+		m_ui64FrameOrigin = ui64Now;
+		m_ui64NmiAck = ui64Now;
+		m_ui16HTime = 0x1FF;
+		m_ui16VTime = 0x1FF;
+		m_ui8NmiTimEn = 0;
+		m_bTimeUp = false;
+		m_rCpu.SetIrqLine( false );
+		Reschedule( ui64Now );
+	}
+
+	/**
+	 * Sets the number of scanlines per frame (LSN_T_NTSC_LINES or LSN_T_PAL_LINES).
+	 *
+	 * \param _ui16Lines The number of scanlines.
+	 **/
+	void CCpuIo::SetLinesPerFrame( uint16_t _ui16Lines ) {
+		// The current frame keeps its start; only its length changes.
+		const uint64_t ui64Now = m_rCpu.GetMasterCycles();
+		m_ui64FrameOrigin = FrameStart( ui64Now );
+		m_ui16Lines = _ui16Lines;
+		Reschedule( ui64Now );
+	}
+
+	/**
+	 * Sets overscan mode (SETINI bit 2), which moves the start of vertical blank from line 225 to line 240.
+	 *
+	 * \param _bOverscan If true, overscan is enabled.
+	 **/
+	void CCpuIo::SetOverscan( bool _bOverscan ) {
+		m_ui16VblankLine = _bOverscan ? LSN_T_VBLANK_LINE_OVERSCAN : LSN_T_VBLANK_LINE;
+		Reschedule( m_rCpu.GetMasterCycles() );
+	}
+
+	/**
+	 * Runs any pending general DMA and any HDMA whose time has come, raises every NMI and IRQ whose time has come, and registers the
+	 *	next ones with the CPU.  Called whenever the CPU stops on an LSN_EV_DMA, LSN_EV_HDMA, LSN_EV_NMI, or LSN_EV_IRQ deadline.
+	 *	Calling it at any other time does no harm.
+	 **/
+	void CCpuIo::Service() {
+		RunDueHdma( m_rCpu.GetMasterCycles() );
+		// Always called, since it also clears the DMA deadline.
+		if ( m_dDma.RunDma() ) {
+			RunDueHdma( m_rCpu.GetMasterCycles() );
+		}
+
+		const uint64_t ui64Now = m_rCpu.GetMasterCycles();
+		if ( ui64Now >= m_ui64NextNmi ) {
+			m_rCpu.SignalNmi();
+		}
+		if ( ui64Now >= m_ui64NextIrq ) {
+			// Several matches missed during a long stall collapse into 1, as they would on the level-triggered line.
+			m_bTimeUp = true;
+			m_rCpu.SetIrqLine( true );
+		}
+		Reschedule( ui64Now + 1 );
+	}
+
+	/**
+	 * Reads a register.  Reading RDNMI or TIMEUP acknowledges it.
+	 *
+	 * \param _ui8Reg The register (the low byte of $42xx).
+	 * \param _ui8OpenBus The value of the data bus.
+	 * \param _ui8OpenMask Holds the mask of bits driven by the register on return.
+	 * \return Returns the register's value.
+	 **/
+	uint8_t CCpuIo::ReadRegister( uint8_t _ui8Reg, uint8_t _ui8OpenBus, uint8_t &_ui8OpenMask ) {
+		switch ( _ui8Reg ) {
+			case 0x10 : {
+				// RDNMI.
+				const uint64_t ui64Now = m_rCpu.GetMasterCycles();
+				const uint8_t ui8Ret = DebugReadRegister( _ui8Reg, _ui8OpenBus );
+				m_ui64NmiAck = ui64Now;
+				_ui8OpenMask = 0x8F;
+				// A read that finds the flag clear acknowledges nothing, and the flag stays clear until the next vertical blank.
+				if ( !(ui8Ret & 0x80) ) { m_baBusA.SetReadStableUntil( NextVblank( ui64Now + 1 ) ); }
+				return ui8Ret;
+			}
+			case 0x11 : {
+				// TIMEUP.
+				const uint8_t ui8Ret = DebugReadRegister( _ui8Reg, _ui8OpenBus );
+				if ( m_bTimeUp ) {
+					m_bTimeUp = false;
+					m_rCpu.SetIrqLine( false );
+				}
+				else { m_baBusA.SetReadStableUntil( m_ui64NextIrq ); }
+				_ui8OpenMask = 0x80;
+				return ui8Ret;
+			}
+			case 0x12 : {
+				// HVBJOY.
+				_ui8OpenMask = 0xC1;
+				m_baBusA.SetReadStableUntil( NextHvbjoyChange( m_rCpu.GetMasterCycles() ) );
+				return DebugReadRegister( _ui8Reg, _ui8OpenBus );
+			}
+			default : {
+				_ui8OpenMask = 0;
+				return _ui8OpenBus;
+			}
+		}
+	}
+
+	/**
+	 * Reads a register without side effects.
+	 *
+	 * \param _ui8Reg The register (the low byte of $42xx).
+	 * \param _ui8OpenBus The value of the data bus.
+	 * \return Returns the register's value.
+	 **/
+	uint8_t CCpuIo::DebugReadRegister( uint8_t _ui8Reg, uint8_t _ui8OpenBus ) const {
+		const uint64_t ui64Now = m_rCpu.GetMasterCycles();
+		switch ( _ui8Reg ) {
+			case 0x10 : {
+				// Bits 0-3 are the 5A22 version (2).
+				return uint8_t( (NmiFlag( ui64Now ) ? 0x80 : 0x00) | 0x02 | (_ui8OpenBus & 0x70) );
+			}
+			case 0x11 : {
+				return uint8_t( (m_bTimeUp ? 0x80 : 0x00) | (_ui8OpenBus & 0x7F) );
+			}
+			case 0x12 : {
+				const uint64_t ui64InFrame = (ui64Now < m_ui64FrameOrigin) ? 0 : (ui64Now - m_ui64FrameOrigin) % FrameLength();
+				const uint64_t ui64Line = ui64InFrame / LSN_T_MASTER_PER_LINE;
+				const uint64_t ui64H = ui64InFrame % LSN_T_MASTER_PER_LINE;
+				// Bit 0 (automatic joypad reading in progress) stays clear until automatic reading is emulated.
+				return uint8_t( ((ui64Line >= m_ui16VblankLine) ? 0x80 : 0x00) |
+					((ui64H >= LSN_T_HBLANK_START || ui64H < LSN_T_HBLANK_END) ? 0x40 : 0x00) |
+					(_ui8OpenBus & 0x3E) );
+			}
+			default : { return _ui8OpenBus; }
+		}
+	}
+
+	/**
+	 * Writes a register.
+	 *
+	 * \param _ui8Reg The register (the low byte of $42xx).
+	 * \param _ui8Val The value to write.
+	 **/
+	void CCpuIo::WriteRegister( uint8_t _ui8Reg, uint8_t _ui8Val ) {
+		const uint64_t ui64Now = m_rCpu.GetMasterCycles();
+		switch ( _ui8Reg ) {
+			case 0x00 : {
+				// NMITIMEN.
+				const uint8_t ui8Old = m_ui8NmiTimEn;
+				m_ui8NmiTimEn = _ui8Val;
+				uint64_t ui64From = ui64Now;
+				if ( (_ui8Val & LSN_NMITIMEN_NMI) && !(ui8Old & LSN_NMITIMEN_NMI) && NmiFlag( ui64Now ) ) {
+					// Enabling NMI during vertical blank while RDNMI is still set triggers it at once.
+					m_rCpu.SignalNmi();
+					ui64From = ui64Now + 1;
+				}
+				if ( !(_ui8Val & (LSN_NMITIMEN_H_IRQ | LSN_NMITIMEN_V_IRQ)) && m_bTimeUp ) {
+					m_bTimeUp = false;
+					m_rCpu.SetIrqLine( false );
+				}
+				Reschedule( ui64From );
+				break;
+			}
+			case 0x07 : {
+				m_ui16HTime = uint16_t( (m_ui16HTime & 0x100) | _ui8Val );
+				Reschedule( ui64Now );
+				break;
+			}
+			case 0x08 : {
+				m_ui16HTime = uint16_t( (m_ui16HTime & 0x0FF) | ((_ui8Val & 1) << 8) );
+				Reschedule( ui64Now );
+				break;
+			}
+			case 0x09 : {
+				m_ui16VTime = uint16_t( (m_ui16VTime & 0x100) | _ui8Val );
+				Reschedule( ui64Now );
+				break;
+			}
+			case 0x0A : {
+				m_ui16VTime = uint16_t( (m_ui16VTime & 0x0FF) | ((_ui8Val & 1) << 8) );
+				Reschedule( ui64Now );
+				break;
+			}
+			case 0x0B : {
+				m_dDma.WriteMdmaEn( _ui8Val );
+				break;
+			}
+			case 0x0C : {
+				m_dDma.WriteHdmaEn( _ui8Val );
+				Reschedule( ui64Now );
+				break;
+			}
+			case 0x0D : {
+				m_baBusA.SetMemSel( (_ui8Val & 1) != 0 );
+				break;
+			}
+		}
+	}
+
+	/**
+	 * Routes $4200-$42FF in banks $00-$3F and $80-$BF of a memory map to the I/O registers.  Each Bus A that uses the map must then be
+	 *	attached with Attach().
+	 *
+	 * \param _mmMap The memory map to modify.
+	 **/
+	void CCpuIo::ApplyMapping( CMemoryMap &_mmMap ) {
+		for ( uint32_t ui32Bank = 0; ui32Bank < 0x100; ++ui32Bank ) {
+			if ( (ui32Bank & 0x7F) >= 0x40 ) { continue; }
+			_mmMap.SetAccessor( uint16_t( (ui32Bank << 8) | 0x42 ), &CCpuIo::BusARead, nullptr, &CCpuIo::BusAWrite, nullptr,
+				&CCpuIo::BusADebugRead, nullptr );
+		}
+	}
+
+	/**
+	 * Determines whether RDNMI's flag is set at a given master cycle: it is set from the start of vertical blank to the end of the
+	 *	frame, unless RDNMI was read since it was set.
+	 *
+	 * \param _ui64Cycle The master cycle.
+	 * \return Returns true if the RDNMI flag is set at _ui64Cycle.
+	 **/
+	bool CCpuIo::NmiFlag( uint64_t _ui64Cycle ) const {
+		if ( _ui64Cycle < m_ui64FrameOrigin ) { return false; }
+		const uint64_t ui64Vblank = FrameStart( _ui64Cycle ) + uint64_t( m_ui16VblankLine ) * LSN_T_MASTER_PER_LINE + LSN_T_NMI_DELAY;
+		return _ui64Cycle >= ui64Vblank && m_ui64NmiAck < ui64Vblank;
+	}
+
+	/**
+	 * Finds the first NMI at or after a given master cycle, whether or not NMI is enabled.
+	 *
+	 * \param _ui64Cycle The master cycle from which to search.
+	 * \return Returns the master cycle at which the next vertical blank sets RDNMI.
+	 **/
+	uint64_t CCpuIo::NextVblank( uint64_t _ui64Cycle ) const {
+		uint64_t ui64Vblank = FrameStart( _ui64Cycle ) + uint64_t( m_ui16VblankLine ) * LSN_T_MASTER_PER_LINE + LSN_T_NMI_DELAY;
+		if ( ui64Vblank < _ui64Cycle ) { ui64Vblank += FrameLength(); }
+		return ui64Vblank;
+	}
+
+	/**
+	 * Finds the first master cycle after a given one at which HVBJOY's H-blank or V-blank flag changes.
+	 *
+	 * \param _ui64Cycle The master cycle from which to search.
+	 * \return Returns the master cycle at which HVBJOY next reads differently.
+	 **/
+	uint64_t CCpuIo::NextHvbjoyChange( uint64_t _ui64Cycle ) const {
+		if ( _ui64Cycle < m_ui64FrameOrigin ) { return m_ui64FrameOrigin; }
+		const uint64_t ui64Frame = FrameStart( _ui64Cycle );
+		const uint64_t ui64Line = (_ui64Cycle - ui64Frame) / LSN_T_MASTER_PER_LINE;
+		const uint64_t ui64LineStart = ui64Frame + ui64Line * LSN_T_MASTER_PER_LINE;
+		const uint64_t ui64H = _ui64Cycle - ui64LineStart;
+		uint64_t ui64Next;
+		if ( ui64H < LSN_T_HBLANK_END ) { ui64Next = ui64LineStart + LSN_T_HBLANK_END; }
+		else if ( ui64H < LSN_T_HBLANK_START ) { ui64Next = ui64LineStart + LSN_T_HBLANK_START; }
+		else { ui64Next = ui64LineStart + LSN_T_MASTER_PER_LINE + LSN_T_HBLANK_END; }
+
+		// V-blank sets at the start of its first line and clears at the start of the next frame.
+		const uint64_t ui64Vblank = (ui64Line < m_ui16VblankLine) ?
+			ui64Frame + uint64_t( m_ui16VblankLine ) * LSN_T_MASTER_PER_LINE :
+			ui64Frame + FrameLength();
+		return std::min( ui64Next, ui64Vblank );
+	}
+
+	/**
+	 * Finds the first H/V-timer IRQ at or after a given master cycle.
+	 *
+	 * \param _ui64Cycle The master cycle from which to search.
+	 * \return Returns the master cycle of the next IRQ, or UINT64_MAX if the current NMITIMEN, HTIME, and VTIME never raise one.
+	 **/
+	uint64_t CCpuIo::NextIrq( uint64_t _ui64Cycle ) const {
+		const uint64_t ui64H = uint64_t( m_ui16HTime ) * LSN_T_MASTER_PER_DOT + LSN_T_IRQ_DELAY;
+		switch ( m_ui8NmiTimEn & (LSN_NMITIMEN_H_IRQ | LSN_NMITIMEN_V_IRQ) ) {
+			case LSN_NMITIMEN_H_IRQ : {
+				// Once per line.
+				if ( m_ui16HTime >= LSN_T_DOTS_PER_LINE ) { return UINT64_MAX; }
+				const uint64_t ui64Rel = (_ui64Cycle < m_ui64FrameOrigin) ? 0 : _ui64Cycle - m_ui64FrameOrigin;
+				const uint64_t ui64Line = (ui64Rel > ui64H) ? (ui64Rel - ui64H + LSN_T_MASTER_PER_LINE - 1) / LSN_T_MASTER_PER_LINE : 0;
+				return m_ui64FrameOrigin + ui64Line * LSN_T_MASTER_PER_LINE + ui64H;
+			}
+			case LSN_NMITIMEN_V_IRQ : {}		LSN_FALLTHROUGH
+			case LSN_NMITIMEN_H_IRQ | LSN_NMITIMEN_V_IRQ : {
+				// Once per frame; V alone matches at the start of the line.
+				if ( m_ui16VTime >= m_ui16Lines ) { return UINT64_MAX; }
+				uint64_t ui64Offset = uint64_t( m_ui16VTime ) * LSN_T_MASTER_PER_LINE;
+				if ( m_ui8NmiTimEn & LSN_NMITIMEN_H_IRQ ) {
+					if ( m_ui16HTime >= LSN_T_DOTS_PER_LINE ) { return UINT64_MAX; }
+					ui64Offset += ui64H;
+				}
+				else {
+					ui64Offset += LSN_T_IRQ_DELAY;
+				}
+				uint64_t ui64Irq = FrameStart( _ui64Cycle ) + ui64Offset;
+				if ( ui64Irq < _ui64Cycle ) { ui64Irq += FrameLength(); }
+				return ui64Irq;
+			}
+			default : { return UINT64_MAX; }
+		}
+	}
+
+	/**
+	 * Finds the first HDMA initialization or transfer at or after a given master cycle.  Frame initializations are only considered
+	 *	while HDMAEN is non-zero and scanline transfers only while a channel is still running (CDma::HdmaActive()).
+	 *
+	 * \param _ui64Cycle The master cycle from which to search.
+	 * \param _bInit Holds true on return if the HDMA found is a frame initialization.
+	 * \return Returns the master cycle of the next HDMA, or UINT64_MAX if there is nothing to do.
+	 **/
+	uint64_t CCpuIo::NextHdma( uint64_t _ui64Cycle, bool &_bInit ) const {
+		_bInit = false;
+		const bool bInit = m_dDma.HdmaEnabled() != 0;
+		const bool bLines = m_dDma.HdmaActive();
+		if ( !bInit && !bLines ) { return UINT64_MAX; }
+
+		const uint64_t ui64Cycle = std::max( _ui64Cycle, m_ui64FrameOrigin );
+		const uint64_t ui64Frame = FrameStart( ui64Cycle );
+		uint64_t ui64Next = UINT64_MAX;
+		if ( bInit ) {
+			ui64Next = ui64Frame + LSN_T_HDMA_INIT;
+			if ( ui64Next < ui64Cycle ) { ui64Next += FrameLength(); }
+			_bInit = true;
+		}
+		if ( bLines ) {
+			// The first transfer point at or after the cycle, unless vertical blank comes first.
+			const uint64_t ui64Rel = ui64Cycle - ui64Frame;
+			const uint64_t ui64Line = (ui64Rel > LSN_T_HDMA_LINE) ? (ui64Rel - LSN_T_HDMA_LINE + LSN_T_MASTER_PER_LINE - 1) / LSN_T_MASTER_PER_LINE : 0;
+			const uint64_t ui64Transfer = ui64Frame + ui64Line * LSN_T_MASTER_PER_LINE + LSN_T_HDMA_LINE;
+			if ( ui64Line < m_ui16VblankLine && ui64Transfer < ui64Next ) {
+				ui64Next = ui64Transfer;
+				_bInit = false;
+			}
+		}
+		return ui64Next;
+	}
+
+	/**
+	 * Runs every HDMA initialization and transfer due at or before a given master cycle, in order.  Points passed while the CPU was
+	 *	halted (by general DMA, for example) run late rather than being lost, so the tables stay in step with the scanlines.
+	 *
+	 * \param _ui64Cycle The master cycle.
+	 **/
+	void CCpuIo::RunDueHdma( uint64_t _ui64Cycle ) {
+		while ( m_ui64NextHdma <= _ui64Cycle ) {
+			if ( m_bHdmaInit ) { m_dDma.InitHdma(); }
+			else { m_dDma.RunHdma(); }
+			m_ui64NextHdma = NextHdma( m_ui64NextHdma + 1, m_bHdmaInit );
+		}
+	}
+
+	/**
+	 * Recomputes every deadline from a given master cycle and registers them with the CPU.
+	 *
+	 * \param _ui64Cycle The master cycle from which to search.
+	 **/
+	void CCpuIo::Reschedule( uint64_t _ui64Cycle ) {
+		m_ui64NextNmi = (m_ui8NmiTimEn & LSN_NMITIMEN_NMI) ? NextVblank( _ui64Cycle ) : UINT64_MAX;
+		m_ui64NextIrq = NextIrq( _ui64Cycle );
+		m_ui64NextHdma = NextHdma( _ui64Cycle, m_bHdmaInit );
+		m_rCpu.SetEventDeadline( CRicoh5A22::LSN_EV_NMI, m_ui64NextNmi );
+		m_rCpu.SetEventDeadline( CRicoh5A22::LSN_EV_IRQ, m_ui64NextIrq );
+		m_rCpu.SetEventDeadline( CRicoh5A22::LSN_EV_HDMA, m_ui64NextHdma );
+	}
+
+	/**
+	 * The Bus A reader for $42xx.
+	 *
+	 * \param _rfpParms The read parameters.  pvParm0 points to the CCpuIo, or is nullptr if none has been attached.
+	 * \param _ui8Ret Holds the read value on return.
+	 * \param _ui8OpenMask Holds the mask of bits driven by the register on return.
+	 **/
+	void LSN_FASTCALL CCpuIo::BusARead( const CMemoryMap::LSN_ACCESSFUNCPARMS &_rfpParms, uint8_t &_ui8Ret, uint8_t &_ui8OpenMask ) {
+		CCpuIo * pciThis = static_cast<CCpuIo *>(_rfpParms.pvParm0);
+		if LSN_UNLIKELY( !pciThis ) {
+			_ui8OpenMask = 0;
+			return;
+		}
+		_ui8Ret = pciThis->ReadRegister( uint8_t( _rfpParms.ui16Address ), _ui8Ret, _ui8OpenMask );
+	}
+
+	/**
+	 * The Bus A writer for $42xx.
+	 *
+	 * \param _rfpParms The write parameters.  pvParm0 points to the CCpuIo, or is nullptr if none has been attached.
+	 * \param _ui8Val The value to write.
+	 **/
+	void LSN_FASTCALL CCpuIo::BusAWrite( const CMemoryMap::LSN_ACCESSFUNCPARMS &_rfpParms, uint8_t _ui8Val ) {
+		CCpuIo * pciThis = static_cast<CCpuIo *>(_rfpParms.pvParm0);
+		if LSN_UNLIKELY( !pciThis ) { return; }
+		pciThis->WriteRegister( uint8_t( _rfpParms.ui16Address ), _ui8Val );
+	}
+
+	/**
+	 * The Bus A debug reader for $42xx.
+	 *
+	 * \param _rfpParms The read parameters.  pvParm0 points to the CCpuIo, or is nullptr if none has been attached.
+	 * \param _ui8Ret Holds the read value on return.
+	 **/
+	void LSN_FASTCALL CCpuIo::BusADebugRead( const CMemoryMap::LSN_ACCESSFUNCPARMS &_rfpParms, uint8_t &_ui8Ret ) {
+		const CCpuIo * pciThis = static_cast<const CCpuIo *>(_rfpParms.pvParm0);
+		if ( pciThis ) {
+			_ui8Ret = pciThis->DebugReadRegister( uint8_t( _rfpParms.ui16Address ), _ui8Ret );
+		}
+	}
+
+}	// namespace lsn
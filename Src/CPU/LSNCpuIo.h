@@ -0,0 +1,264 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: The 5A22's internal I/O page ($4200-$42FF): the NMI/IRQ timers, MEMSEL, and the DMA enables.
+ */
+
+#pragma once
+
+#include "../LSNBirdSNES.h"
+#include "../Bus/LSNBusA.h"
+#include "../Bus/LSNMemoryMap.h"
+#include "LSNDma.h"
+#include "LSNRicoh5A22.h"
+
+#include <cstdint>
+
+
+namespace lsn {
+
+	/**
+	 * Class CCpuIo
+	 * \brief The 5A22's internal I/O page.
+	 *
+	 * Description: The 5A22's internal I/O page ($4200-$42FF): the NMI/IRQ timers, MEMSEL, and the DMA enables.  The H/V counters are not
+	 *	stepped dot by dot.  Every line lasts LSN_T_MASTER_PER_LINE master cycles, so the position of the beam is a function of the CPU's
+	 *	master clock, and the time of the next NMI (the start of vertical blank) and of the next H/V-timer IRQ can be computed outright
+	 *	whenever NMITIMEN, HTIME, or VTIME changes.  They are registered as the CPU's CRicoh5A22::LSN_EV_NMI and LSN_EV_IRQ deadlines;
+	 *	the CPU stops at the first cycle boundary at or past a deadline and whoever is running it calls Service().  HDMA's frame
+	 *	initialization and per-scanline transfers are scheduled the same way (as LSN_EV_HDMA), and Service() also runs any general DMA
+	 *	started through $420B, so Service() is the only call needed at any deadline.  RDNMI and HVBJOY are likewise computed from the
+	 *	clock when read.
+	 */
+	class CCpuIo {
+	public :
+		CCpuIo( CRicoh5A22 &_rCpu, CBusA &_baBusA, CDma &_dDma ) :
+			m_rCpu( _rCpu ),
+			m_baBusA( _baBusA ),
+			m_dDma( _dDma ) {
+		}
+
+
+		// == Enumerations.
+		/** Frame timing, in master cycles. */
+		enum LSN_TIMING : uint32_t {
+			LSN_T_MASTER_PER_LINE						= 1364,								/**< Master cycles per scanline (340 dots of 4 cycles, with 2 dots of 6 cycles). */
+			LSN_T_MASTER_PER_DOT						= 4,								/**< Master cycles per dot, for converting HTIME. */
+			LSN_T_DOTS_PER_LINE							= 340,								/**< HTIME values at or above this never match. */
+			LSN_T_NTSC_LINES							= 262,								/**< Scanlines per NTSC frame. */
+			LSN_T_PAL_LINES								= 312,								/**< Scanlines per PAL frame. */
+			LSN_T_VBLANK_LINE							= 225,								/**< The first vertical-blank line. */
+			LSN_T_VBLANK_LINE_OVERSCAN					= 240,								/**< The first vertical-blank line in overscan mode. */
+			LSN_T_NMI_DELAY								= 2,								/**< RDNMI sets (and NMI is signalled) this long into the first vertical-blank line. */
+			LSN_T_IRQ_DELAY								= 14,								/**< TIMEUP sets (and IRQ is asserted) this long after the counters match. */
+			LSN_T_HBLANK_START							= 274 * LSN_T_MASTER_PER_DOT,		/**< HVBJOY's H-blank flag is set from here to the end of the line... */
+			LSN_T_HBLANK_END							= 1 * LSN_T_MASTER_PER_DOT,			/**< ...and from the start of the line to here. */
+			LSN_T_HDMA_INIT								= 6 * LSN_T_MASTER_PER_DOT,			/**< HDMA is initialized this far into the first line of each frame. */
+			LSN_T_HDMA_LINE								= 278 * LSN_T_MASTER_PER_DOT,		/**< HDMA transfers this far into each line before vertical blank. */
+		};
+
+		/** NMITIMEN ($4200) bits. */
+		enum LSN_NMITIMEN : uint8_t {
+			LSN_NMITIMEN_JOYPAD							= 0x01,								/**< Automatic joypad reading. */
+			LSN_NMITIMEN_H_IRQ							= 0x10,								/**< IRQ when the H counter matches HTIME. */
+			LSN_NMITIMEN_V_IRQ							= 0x20,								/**< IRQ when the V counter matches VTIME (both, with LSN_NMITIMEN_H_IRQ). */
+			LSN_NMITIMEN_NMI							= 0x80,								/**< NMI at the start of vertical blank. */
+		};
+
+
+		// == Functions.
+		/**
+		 * Resets the registers to their power-on state and starts a frame at the CPU's current master cycle.
+		 **/
+		void											Reset();
+
+		/**
+		 * Sets the number of scanlines per frame (LSN_T_NTSC_LINES or LSN_T_PAL_LINES).
+		 *
+		 * \param _ui16Lines The number of scanlines.
+		 **/
+		void											SetLinesPerFrame( uint16_t _ui16Lines );
+
+		/**
+		 * Sets overscan mode (SETINI bit 2), which moves the start of vertical blank from line 225 to line 240.
+		 *
+		 * \param _bOverscan If true, overscan is enabled.
+		 **/
+		void											SetOverscan( bool _bOverscan );
+
+		/**
+		 * Runs any pending general DMA and any HDMA whose time has come, raises every NMI and IRQ whose time has come, and registers the
+		 *	next ones with the CPU.  Called whenever the CPU stops on an LSN_EV_DMA, LSN_EV_HDMA, LSN_EV_NMI, or LSN_EV_IRQ deadline.
+		 *	Calling it at any other time does no harm.
+		 **/
+		void											Service();
+
+		/**
+		 * Reads a register.  Reading RDNMI or TIMEUP acknowledges it.
+		 *
+		 * \param _ui8Reg The register (the low byte of $42xx).
+		 * \param _ui8OpenBus The value of the data bus.
+		 * \param _ui8OpenMask Holds the mask of bits driven by the register on return.
+		 * \return Returns the register's value.
+		 **/
+		uint8_t											ReadRegister( uint8_t _ui8Reg, uint8_t _ui8OpenBus, uint8_t &_ui8OpenMask );
+
+		/**
+		 * Reads a register without side effects.
+		 *
+		 * \param _ui8Reg The register (the low byte of $42xx).
+		 * \param _ui8OpenBus The value of the data bus.
+		 * \return Returns the register's value.
+		 **/
+		uint8_t											DebugReadRegister( uint8_t _ui8Reg, uint8_t _ui8OpenBus ) const;
+
+		/**
+		 * Writes a register.
+		 *
+		 * \param _ui8Reg The register (the low byte of $42xx).
+		 * \param _ui8Val The value to write.
+		 **/
+		void											WriteRegister( uint8_t _ui8Reg, uint8_t _ui8Val );
+
+		/**
+		 * Gets the master cycle at which the frame containing a given master cycle started.
+		 *
+		 * \param _ui64Cycle The master cycle.
+		 * \return Returns the start of the frame containing _ui64Cycle.
+		 **/
+		inline uint64_t									FrameStart( uint64_t _ui64Cycle ) const {
+			if ( _ui64Cycle < m_ui64FrameOrigin ) { return m_ui64FrameOrigin; }
+			return _ui64Cycle - (_ui64Cycle - m_ui64FrameOrigin) % FrameLength();
+		}
+
+		/**
+		 * Gets the length of a frame.
+		 *
+		 * \return Returns the number of master cycles per frame.
+		 **/
+		inline uint64_t									FrameLength() const { return uint64_t( m_ui16Lines ) * LSN_T_MASTER_PER_LINE; }
+
+		/**
+		 * Routes $4200-$42FF in banks $00-$3F and $80-$BF of a memory map to the I/O registers.  Each Bus A that uses the map must then be
+		 *	attached with Attach().
+		 *
+		 * \param _mmMap The memory map to modify.
+		 **/
+		static void										ApplyMapping( CMemoryMap &_mmMap );
+
+		/**
+		 * Attaches the I/O registers to the Bus A passed to the constructor, whose memory map was set up by ApplyMapping().  Must be
+		 *	called again after the Bus A's memory map changes.
+		 **/
+		void											Attach() {
+			m_baBusA.BindParm( &CCpuIo::BusARead, &CCpuIo::BusAWrite, this );
+		}
+
+
+	protected :
+		// == Members.
+		CRicoh5A22 &									m_rCpu;								/**< The CPU, whose master clock is the beam position. */
+		CBusA &											m_baBusA;							/**< The A bus. */
+		CDma &											m_dDma;								/**< The DMA channels, started by $420B and $420C. */
+		uint64_t										m_ui64FrameOrigin = 0;				/**< The master cycle at which some frame started. */
+		uint64_t										m_ui64NmiAck = 0;					/**< The master cycle at which RDNMI was last read. */
+		uint64_t										m_ui64NextNmi = UINT64_MAX;			/**< The master cycle of the next NMI, or UINT64_MAX. */
+		uint64_t										m_ui64NextIrq = UINT64_MAX;			/**< The master cycle of the next H/V-timer IRQ, or UINT64_MAX. */
+		uint64_t										m_ui64NextHdma = UINT64_MAX;		/**< The master cycle of the next HDMA initialization or transfer, or UINT64_MAX. */
+		uint16_t										m_ui16Lines = LSN_T_NTSC_LINES;		/**< Scanlines per frame. */
+		uint16_t										m_ui16VblankLine = LSN_T_VBLANK_LINE;	/**< The first vertical-blank line. */
+		uint16_t										m_ui16HTime = 0x1FF;				/**< HTIME ($4207-$4208). */
+		uint16_t										m_ui16VTime = 0x1FF;				/**< VTIME ($4209-$420A). */
+		uint8_t											m_ui8NmiTimEn = 0;					/**< NMITIMEN ($4200). */
+		bool											m_bTimeUp = false;					/**< TIMEUP ($4211) bit 7. */
+		bool											m_bHdmaInit = false;				/**< m_ui64NextHdma is a frame initialization rather than a scanline transfer. */
+
+
+		// == Functions.
+		/**
+		 * Determines whether RDNMI's flag is set at a given master cycle: it is set from the start of vertical blank to the end of the
+		 *	frame, unless RDNMI was read since it was set.
+		 *
+		 * \param _ui64Cycle The master cycle.
+		 * \return Returns true if the RDNMI flag is set at _ui64Cycle.
+		 **/
+		bool											NmiFlag( uint64_t _ui64Cycle ) const;
+
+		/**
+		 * Finds the first NMI at or after a given master cycle, whether or not NMI is enabled.
+		 *
+		 * \param _ui64Cycle The master cycle from which to search.
+		 * \return Returns the master cycle at which the next vertical blank sets RDNMI.
+		 **/
+		uint64_t										NextVblank( uint64_t _ui64Cycle ) const;
+
+		/**
+		 * Finds the first master cycle after a given one at which HVBJOY's H-blank or V-blank flag changes.
+		 *
+		 * \param _ui64Cycle The master cycle from which to search.
+		 * \return Returns the master cycle at which HVBJOY next reads differently.
+		 **/
+		uint64_t										NextHvbjoyChange( uint64_t _ui64Cycle ) const;
+
+		/**
+		 * Finds the first H/V-timer IRQ at or after a given master cycle.
+		 *
+		 * \param _ui64Cycle The master cycle from which to search.
+		 * \return Returns the master cycle of the next IRQ, or UINT64_MAX if the current NMITIMEN, HTIME, and VTIME never raise one.
+		 **/
+		uint64_t										NextIrq( uint64_t _ui64Cycle ) const;
+
+		/**
+		 * Finds the first HDMA initialization or transfer at or after a given master cycle.  Frame initializations are only considered
+		 *	while HDMAEN is non-zero and scanline transfers only while a channel is still running (CDma::HdmaActive()).
+		 *
+		 * \param _ui64Cycle The master cycle from which to search.
+		 * \param _bInit Holds true on return if the HDMA found is a frame initialization.
+		 * \return Returns the master cycle of the next HDMA, or UINT64_MAX if there is nothing to do.
+		 **/
+		uint64_t										NextHdma( uint64_t _ui64Cycle, bool &_bInit ) const;
+
+		/**
+		 * Runs every HDMA initialization and transfer due at or before a given master cycle, in order.  Points passed while the CPU was
+		 *	halted (by general DMA, for example) run late rather than being lost, so the tables stay in step with the scanlines.
+		 *
+		 * \param _ui64Cycle The master cycle.
+		 **/
+		void											RunDueHdma( uint64_t _ui64Cycle );
+
+		/**
+		 * Recomputes every deadline from a given master cycle and registers them with the CPU.
+		 *
+		 * \param _ui64Cycle The master cycle from which to search.
+		 **/
+		void											Reschedule( uint64_t _ui64Cycle );
+
+		/**
+		 * The Bus A reader for $42xx.
+		 *
+		 * \param _rfpParms The read parameters.  pvParm0 points to the CCpuIo, or is nullptr if none has been attached.
+		 * \param _ui8Ret Holds the read value on return.
+		 * \param _ui8OpenMask Holds the mask of bits driven by the register on return.
+		 **/
+		static void LSN_FASTCALL						BusARead( const CMemoryMap::LSN_ACCESSFUNCPARMS &_rfpParms, uint8_t &_ui8Ret, uint8_t &_ui8OpenMask );
+
+		/**
+		 * The Bus A writer for $42xx.
+		 *
+		 * \param _rfpParms The write parameters.  pvParm0 points to the CCpuIo, or is nullptr if none has been attached.
+		 * \param _ui8Val The value to write.
+		 **/
+		static void LSN_FASTCALL						BusAWrite( const CMemoryMap::LSN_ACCESSFUNCPARMS &_rfpParms, uint8_t _ui8Val );
+
+		/**
+		 * The Bus A debug reader for $42xx.
+		 *
+		 * \param _rfpParms The read parameters.  pvParm0 points to the CCpuIo, or is nullptr if none has been attached.
+		 * \param _ui8Ret Holds the read value on return.
+		 **/
+		static void LSN_FASTCALL						BusADebugRead( const CMemoryMap::LSN_ACCESSFUNCPARMS &_rfpParms, uint8_t &_ui8Ret );
+	};
+
+}	// namespace lsn
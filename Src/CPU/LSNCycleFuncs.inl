@@ -1,79 +1,1124 @@
-#define LSN_INDIRECT_X_R( NAME, FUNC )												{ {	&CRicoh5A22::FetchPointerAndIncPc_Phi2, &CRicoh5A22::AddXAndDAndPointerToAddressAndIncPc, &CRicoh5A22::SkipOnDL_Phi2, &CRicoh5A22::FixPointerHigh, &CRicoh5A22::Null_Phi2, &CRicoh5A22::ReadPointerToAddressLow, &CRicoh5A22::ReadPointerToAddressLow_Phi2, &CRicoh5A22::Null_Read, &CRicoh5A22::ReadPointerToAddressHigh_Phi2, &CRicoh5A22::Null_Read, &CRicoh5A22::ReadAddressAndBankToOperandLow_SkipIfM_Phi2, &CRicoh5A22::Null_Read, &CRicoh5A22::ReadAddressAndBankToOperandHigh_Phi2, &CRicoh5A22::FUNC, &CRicoh5A22::PrefetchNextOp }, {	&CRicoh5A22::FetchPointerAndIncPc_Phi2, &CRicoh5A22::AddXAndDAndPointerToAddressAndIncPc, &CRicoh5A22::SkipOnDL_Phi2, &CRicoh5A22::FixPointerHigh, &CRicoh5A22::Null_Phi2, &CRicoh5A22::ReadPointerToAddressLow, &CRicoh5A22::ReadPointerToAddressLow_Phi2, &CRicoh5A22::Null_Read, &CRicoh5A22::ReadPointerToAddressHigh_Phi2, &CRicoh5A22::Null_Read, &CRicoh5A22::ReadAddressAndBankToOperandLow_SkipIfM_Phi2, &CRicoh5A22::Null_Read, &CRicoh5A22::ReadAddressAndBankToOperandHigh_Phi2, &CRicoh5A22::FUNC, &CRicoh5A22::PrefetchNextOp }, }, 8, 7, LSN_AM_INDIRECT_X, 2, 2, LSN_I_ ## NAME
-
-CRicoh5A22::LSN_INSTR CRicoh5A22::m_iInstructionSet[256] = {								/**< The instruction set. */
-	/** 00-07 */
-	{	// 00
-		{
-			{
-				/* BeginInst() */															&CRicoh5A22::Fetch_Opcode_IncPc_Phi2,
-				&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Fetch_Operand_IncPc_Phi2,
-				&CRicoh5A22::Null_RorW<true>,												&CRicoh5A22::PushPb_Phi2<0>,
-				&CRicoh5A22::Null_RorW<true>,												&CRicoh5A22::Push_Pc_H_Phi2<-1>,
-				&CRicoh5A22::Null_RorW,														&CRicoh5A22::Push_Pc_L_Phi2<-2>,
-				&CRicoh5A22::SelectBrkVectors<false>,										&CRicoh5A22::Push_S_Phi2<-3>,
-				&CRicoh5A22::Null<LSN_R, false, true>,										&CRicoh5A22::CopyVectorToPc_L_Phi2,
-				&CRicoh5A22::SetBrkFlags,													&CRicoh5A22::CopyVectorToPc_H_Phi2<false>,
-				&CRicoh5A22::Brk_BeginInst
-			},
-			{
-				/* BeginInst() */															&CRicoh5A22::Fetch_Opcode_IncPc_Phi2,
-				&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Fetch_Operand_IncPc_Phi2,
-				&CRicoh5A22::Null_RorW<true>,												&CRicoh5A22::Push_Pc_H_Phi2<0>,
-				&CRicoh5A22::Null_RorW,														&CRicoh5A22::Push_Pc_L_Phi2<-1>,
-				&CRicoh5A22::SelectBrkVectors<false>,										&CRicoh5A22::Push_S_Phi2<-2>,
-				&CRicoh5A22::Null<LSN_R, false, true>,										&CRicoh5A22::CopyVectorToPc_L_Phi2,
-				&CRicoh5A22::SetBrkFlags,													&CRicoh5A22::CopyVectorToPc_H_Phi2<false>,
-				&CRicoh5A22::Brk_BeginInst
-			},
-		},
-		8, 7, LSN_AM_IMPLIED, 2, 2, LSN_I_BRK,
-	},
-
-	{
-		{	// 01
-			{
-				/* BeginInst() */															&CRicoh5A22::Fetch_Opcode_IncPc_Phi2,
-				&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Fetch_PtrOrAddr_IncPc_Phi2<LSN_TO_P>,
-				&CRicoh5A22::Add_X_D_PtrOrAddr_To_AddrOrPtr_IncPc<LSN_TO_A>,				&CRicoh5A22::SkipOnDL_Phi2,
-				&CRicoh5A22::Fix_PtrOrAddr_From_AddrOrPtr_High<LSN_TO_A>,					&CRicoh5A22::Null_Phi2,
-				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::ReadBank0_PtrOrAddr_To_AddrOrPtr_Low_Phi2<LSN_TO_P>,
-				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::ReadBank0_PtrOrAddr_To_AddrOrPtr_High_Phi2<LSN_TO_P>,
-				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Read_PtrOrAddr_And_Bank_To_OperandLow_SkipIfM_Phi2<LSN_FROM_P>,
-				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Read_PtrOrAddr_And_Bank_To_OperandHigh_Phi2<LSN_FROM_P>,
-				&CRicoh5A22::Ora,
-				/* BeginInst() */															/*&CRicoh5A22::FetchPointerAndIncPc_Phi2,
-				&CRicoh5A22::AddXAndDAndPointerToAddressAndIncPc,							&CRicoh5A22::SkipOnDL_Phi2,
-				&CRicoh5A22::FixPointerHigh,												&CRicoh5A22::Null_Phi2,
-				&CRicoh5A22::ReadPointerToAddressLow,										&CRicoh5A22::ReadPointerToAddressLow_Phi2,
-				&CRicoh5A22::Null_Read,														&CRicoh5A22::ReadPointerToAddressHigh_Phi2,
-				&CRicoh5A22::Null_Read,														&CRicoh5A22::ReadAddressAndBankToOperandLow_SkipIfM_Phi2,
-				&CRicoh5A22::Null_Read,														&CRicoh5A22::ReadAddressAndBankToOperandHigh_Phi2,
-				&CRicoh5A22::Ora_BeginInst,*/
-			},
-			{
-				/* BeginInst() */															&CRicoh5A22::Fetch_Opcode_IncPc_Phi2,
-				&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Fetch_PtrOrAddr_IncPc_Phi2<LSN_TO_P>,
-				&CRicoh5A22::Add_X_D_PtrOrAddr_To_AddrOrPtr_IncPc<LSN_TO_A>,				&CRicoh5A22::SkipOnDL_Phi2,
-				&CRicoh5A22::Fix_PtrOrAddr_From_AddrOrPtr_High<LSN_TO_A>,					&CRicoh5A22::Null_Phi2,
-				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::ReadBank0_PtrOrAddr_To_AddrOrPtr_Low_Phi2<LSN_TO_P>,
-				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::ReadBank0_PtrOrAddr_To_AddrOrPtr_High_Phi2<LSN_TO_P>,
-				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Read_PtrOrAddr_And_Bank_To_OperandLow_SkipIfM_Phi2<LSN_FROM_P>,
-				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Read_PtrOrAddr_And_Bank_To_OperandHigh_Phi2<LSN_FROM_P>,
-				&CRicoh5A22::Ora,
-				/* BeginInst() */															/*&CRicoh5A22::FetchPointerAndIncPc_Phi2,
-				&CRicoh5A22::AddXAndDAndPointerToAddressAndIncPc,							&CRicoh5A22::SkipOnDL_Phi2,
-				&CRicoh5A22::FixPointerHigh,												&CRicoh5A22::Null_Phi2,
-				&CRicoh5A22::ReadPointerToAddressLow,										&CRicoh5A22::ReadPointerToAddressLow_Phi2,
-				&CRicoh5A22::Null_Read,														&CRicoh5A22::ReadPointerToAddressHigh_Phi2,
-				&CRicoh5A22::Null_Read,														&CRicoh5A22::ReadAddressAndBankToOperandLow_SkipIfM_Phi2,
-				&CRicoh5A22::Null_Read,														&CRicoh5A22::ReadAddressAndBankToOperandHigh_Phi2,
-				&CRicoh5A22::Ora_BeginInst,*/
-			},
-		},
-		8, 7, LSN_AM_INDIRECT_X, 2, 2, LSN_I_ORA
-	}
-
-	/*	{	// 01
-		LSN_INDIRECT_X_R( ORA, Ora )
-	},*/
-};
\ No newline at end of file
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: The 65C816 instruction set, generated at compile time.  Instructions are decoded from their opcodes (aaabbbcc) so that every
+ *	instruction sharing an addressing mode is built from the same cycle functions and differs only in its operation.  Each instruction is
+ *	generated once per LSN_INSTR_TABLES variant, with the M/X widths baked into the cycle lists.
+ */
+
+
+/**
+ * Creates an instruction with no cycle functions.  Add them with SetCycles() or AddCycles().
+ *
+ * \param _ui8CyclesN Total cycles in native mode.
+ * \param _ui8CyclesE Total cycles in emulation mode.
+ * \param _amAddrMode The addressing mode.
+ * \param _ui8SizeN The size of the instruction in native mode.
+ * \param _ui8SizeE The size of the instruction in emulation mode.
+ * \param _iInstruction The instruction.
+ * \return Returns the fully constructed instruction.
+ **/
+constexpr CRicoh5A22::LSN_INSTR CRicoh5A22::MakeInstr( uint8_t _ui8CyclesN, uint8_t _ui8CyclesE, LSN_ADDRESSING_MODES _amAddrMode, uint8_t _ui8SizeN, uint8_t _ui8SizeE, LSN_INSTRUCTIONS _iInstruction ) {
+	LSN_INSTR iRet {};
+	iRet.ui8TotalCyclesN = _ui8CyclesN;
+	iRet.ui8TotalCyclesE = _ui8CyclesE;
+	iRet.amAddrMode = _amAddrMode;
+	for ( size_t I = 0; I < LSN_IT_TOTAL; ++I ) {
+		iRet.ui8Size[I] = (I == LSN_IT_EMULATION) ? _ui8SizeE : _ui8SizeN;
+	}
+	iRet.iInstruction = _iInstruction;
+	return iRet;
+}
+
+/**
+ * Sets the cycle functions of an instruction for the given table variants.
+ *
+ * \param _iInstr The instruction to modify.
+ * \param _ilTables The table variants to which to assign the cycle functions.
+ * \param _ilCycles The cycle functions, in order.
+ **/
+constexpr void CRicoh5A22::SetCycles( LSN_INSTR &_iInstr, std::initializer_list<LSN_INSTR_TABLES> _ilTables, std::initializer_list<PfCycle> _ilCycles ) {
+	for ( auto itTable : _ilTables ) {
+		size_t sIdx = 0;
+		for ( auto pfThis : _ilCycles ) { _iInstr.pfHandler[itTable][sIdx++] = pfThis; }
+	}
+}
+
+/**
+ * Appends cycle functions to one table variant of an instruction.
+ *
+ * \param _iInstr The instruction to modify.
+ * \param _sTable The table variant (an LSN_INSTR_TABLES value).
+ * \param _sIdx The index at which to start.
+ * \param _ilCycles The cycle functions, in order.
+ * \return Returns the index after the last added function.
+ **/
+constexpr size_t CRicoh5A22::AddCycles( LSN_INSTR &_iInstr, size_t _sTable, size_t _sIdx, std::initializer_list<PfCycle> _ilCycles ) {
+	for ( auto pfThis : _ilCycles ) { _iInstr.pfHandler[_sTable][_sIdx++] = pfThis; }
+	return _sIdx;
+}
+
+/**
+ * Determines whether an operand is 8 bits wide in a table variant.
+ *
+ * \param _owWidth The width of the operand.
+ * \param _sTable The table variant (an LSN_INSTR_TABLES value).
+ * \return Returns true if the operand is 8 bits wide.
+ **/
+constexpr bool CRicoh5A22::Is8Bit( LSN_OPERAND_WIDTH _owWidth, size_t _sTable ) {
+	switch ( _owWidth ) {
+		case LSN_OW_8 : { return true; }
+		case LSN_OW_16 : { return false; }
+		case LSN_OW_M : { return _sTable == LSN_IT_M8_X16 || _sTable == LSN_IT_M8_X8 || _sTable == LSN_IT_EMULATION; }
+		case LSN_OW_X : { return _sTable == LSN_IT_M16_X8 || _sTable == LSN_IT_M8_X8 || _sTable == LSN_IT_EMULATION; }
+	}
+	return true;
+}
+
+/**
+ * Creates BRK or COP.
+ *
+ * \param _bCop If true, COP is created.
+ * \return Returns the instruction.
+ **/
+constexpr CRicoh5A22::LSN_INSTR CRicoh5A22::Inst_Brk( bool _bCop ) {
+	LSN_INSTR iRet = MakeInstr( 8, 7, LSN_AM_IMPLIED, 2, 2, _bCop ? LSN_I_COP : LSN_I_BRK );
+	const PfCycle pfSelect = _bCop ? &CRicoh5A22::SelectBrkVectors<false, true> : &CRicoh5A22::SelectBrkVectors<false, false>;
+	SetCycles( iRet, { LSN_IT_M16_X16, LSN_IT_M16_X8, LSN_IT_M8_X16, LSN_IT_M8_X8 }, {
+		/* BeginInst() */															&CRicoh5A22::Fetch_Opcode_IncPc_Phi2,
+		&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Fetch_Phi2<LSN_RT_OPERAND_LOW>,
+		&CRicoh5A22::Null_RorW<true>,												&CRicoh5A22::PushPb_Phi2<0>,
+		&CRicoh5A22::Null_RorW<true>,												&CRicoh5A22::Push_Pc_H_Phi2<-1>,
+		&CRicoh5A22::Null_RorW,														&CRicoh5A22::Push_Pc_L_Phi2<-2>,
+		pfSelect,																	&CRicoh5A22::Push_S_Phi2<-3>,
+		&CRicoh5A22::Null<LSN_R, false, true>,										&CRicoh5A22::CopyVectorToPc_L_Phi2,
+		&CRicoh5A22::SetBrkFlags,													&CRicoh5A22::CopyVectorToPc_H_Phi2<false>,
+		&CRicoh5A22::Brk_BeginInst
+	} );
+	SetCycles( iRet, { LSN_IT_EMULATION }, {
+		/* BeginInst() */															&CRicoh5A22::Fetch_Opcode_IncPc_Phi2,
+		&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Fetch_Phi2<LSN_RT_OPERAND_LOW>,
+		&CRicoh5A22::Null_RorW<true>,												&CRicoh5A22::Push_Pc_H_Phi2<0>,
+		&CRicoh5A22::Null_RorW,														&CRicoh5A22::Push_Pc_L_Phi2<-1>,
+		pfSelect,																	&CRicoh5A22::Push_S_Phi2<-2>,
+		&CRicoh5A22::Null<LSN_R, false, true>,										&CRicoh5A22::CopyVectorToPc_L_Phi2,
+		&CRicoh5A22::SetBrkFlags,													&CRicoh5A22::CopyVectorToPc_H_Phi2<false>,
+		&CRicoh5A22::Brk_BeginInst
+	} );
+	return iRet;
+}
+
+/**
+ * Creates BRL.
+ *
+ * \return Returns BRL.
+ **/
+constexpr CRicoh5A22::LSN_INSTR CRicoh5A22::Inst_Brl() {
+	LSN_INSTR iRet = MakeInstr( 4, 4, LSN_AM_RELATIVE_LONG, 3, 3, LSN_I_BRL );
+	SetCycles( iRet, { LSN_IT_M16_X16, LSN_IT_M16_X8, LSN_IT_M8_X16, LSN_IT_M8_X8, LSN_IT_EMULATION }, {
+		/* BeginInst() */															&CRicoh5A22::Fetch_Opcode_IncPc_Phi2,
+		&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Fetch_Phi2<LSN_RT_ADDRESS_LOW>,
+		&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Fetch_Phi2<LSN_RT_ADDRESS_HIGH>,
+		&CRicoh5A22::Null<LSN_N, true>,												&CRicoh5A22::Null_Phi2,
+		&CRicoh5A22::Brl
+	} );
+	return iRet;
+}
+
+/**
+ * Creates the instruction used for any opcode that GenerateInstruction() does not decode.  Every opcode is decoded, so it is never
+ *	reached; it stops the clock exactly like STP rather than leaving an empty table entry.
+ *
+ * \return Returns the instruction.
+ **/
+constexpr CRicoh5A22::LSN_INSTR CRicoh5A22::Inst_Jam() {
+	LSN_INSTR iRet = MakeInstr( 3, 3, LSN_AM_IMPLIED, 1, 1, LSN_I_JAM );
+	SetCycles( iRet, { LSN_IT_M16_X16, LSN_IT_M16_X8, LSN_IT_M8_X16, LSN_IT_M8_X8, LSN_IT_EMULATION }, {
+		/* BeginInst() */															&CRicoh5A22::Fetch_Opcode_IncPc_Phi2,
+		&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Null_Phi2,
+		&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Halt_Phi2<LSN_H_STP>,
+		&CRicoh5A22::Null<LSN_N, false, false, true>
+	} );
+	return iRet;
+}
+
+/**
+ * Creates JMP or JML.
+ *
+ * \param _iInstruction LSN_I_JMP or LSN_I_JML.
+ * \param _amAddrMode LSN_AM_ABSOLUTE, LSN_AM_ABSOLUTE_LONG, LSN_AM_INDIRECT, LSN_AM_ABSOLUTE_INDEXED_INDIRECT, or
+ *	LSN_AM_ABSOLUTE_INDIRECT_LONG.
+ * \return Returns the instruction.
+ **/
+constexpr CRicoh5A22::LSN_INSTR CRicoh5A22::Inst_Jmp( LSN_INSTRUCTIONS _iInstruction, LSN_ADDRESSING_MODES _amAddrMode ) {
+	switch ( _amAddrMode ) {
+		case LSN_AM_ABSOLUTE_LONG : {
+			LSN_INSTR iRet = MakeInstr( 4, 4, _amAddrMode, 4, 4, _iInstruction );
+			SetCycles( iRet, { LSN_IT_M16_X16, LSN_IT_M16_X8, LSN_IT_M8_X16, LSN_IT_M8_X8, LSN_IT_EMULATION }, {
+				/* BeginInst() */															&CRicoh5A22::Fetch_Opcode_IncPc_Phi2,
+				&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Fetch_Phi2<LSN_RT_ADDRESS_LOW>,
+				&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Fetch_Phi2<LSN_RT_ADDRESS_HIGH>,
+				&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Fetch_Phi2<LSN_RT_BANK>,
+				&CRicoh5A22::Jml<>
+			} );
+			return iRet;
+		}
+		case LSN_AM_INDIRECT : {
+			LSN_INSTR iRet = MakeInstr( 5, 5, _amAddrMode, 3, 3, _iInstruction );
+			SetCycles( iRet, { LSN_IT_M16_X16, LSN_IT_M16_X8, LSN_IT_M8_X16, LSN_IT_M8_X8, LSN_IT_EMULATION }, {
+				/* BeginInst() */															&CRicoh5A22::Fetch_Opcode_IncPc_Phi2,
+				&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Fetch_Phi2<LSN_RT_POINTER_LOW>,
+				&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Fetch_Phi2<LSN_RT_POINTER_HIGH>,
+				&CRicoh5A22::Null<LSN_N, true>,												&CRicoh5A22::Read_Bank0_Phi2<LSN_RT_ADDRESS_LOW, 0>,
+				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Read_Bank0_Phi2<LSN_RT_ADDRESS_HIGH, 1>,
+				&CRicoh5A22::Jmp<>
+			} );
+			return iRet;
+		}
+		case LSN_AM_ABSOLUTE_INDEXED_INDIRECT : {
+			LSN_INSTR iRet = MakeInstr( 6, 6, _amAddrMode, 3, 3, _iInstruction );
+			SetCycles( iRet, { LSN_IT_M16_X16, LSN_IT_M16_X8, LSN_IT_M8_X16, LSN_IT_M8_X8, LSN_IT_EMULATION }, {
+				/* BeginInst() */															&CRicoh5A22::Fetch_Opcode_IncPc_Phi2,
+				&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Fetch_Phi2<LSN_RT_POINTER_LOW>,
+				&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Fetch_Phi2<LSN_RT_POINTER_HIGH>,
+				&CRicoh5A22::Add_Index_To_Pointer<LSN_RS_X>,								&CRicoh5A22::Null_Phi2,
+				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Read_Program_Phi2<LSN_RT_ADDRESS_LOW, 0>,
+				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Read_Program_Phi2<LSN_RT_ADDRESS_HIGH, 1>,
+				&CRicoh5A22::Jmp<>
+			} );
+			return iRet;
+		}
+		case LSN_AM_ABSOLUTE_INDIRECT_LONG : {
+			LSN_INSTR iRet = MakeInstr( 6, 6, _amAddrMode, 3, 3, _iInstruction );
+			SetCycles( iRet, { LSN_IT_M16_X16, LSN_IT_M16_X8, LSN_IT_M8_X16, LSN_IT_M8_X8, LSN_IT_EMULATION }, {
+				/* BeginInst() */															&CRicoh5A22::Fetch_Opcode_IncPc_Phi2,
+				&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Fetch_Phi2<LSN_RT_POINTER_LOW>,
+				&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Fetch_Phi2<LSN_RT_POINTER_HIGH>,
+				&CRicoh5A22::Null<LSN_N, true>,												&CRicoh5A22::Read_Bank0_Phi2<LSN_RT_ADDRESS_LOW, 0>,
+				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Read_Bank0_Phi2<LSN_RT_ADDRESS_HIGH, 1>,
+				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Read_Bank0_Phi2<LSN_RT_BANK, 2>,
+				&CRicoh5A22::Jml<>
+			} );
+			return iRet;
+		}
+		default : {
+			LSN_INSTR iRet = MakeInstr( 3, 3, LSN_AM_ABSOLUTE, 3, 3, _iInstruction );
+			SetCycles( iRet, { LSN_IT_M16_X16, LSN_IT_M16_X8, LSN_IT_M8_X16, LSN_IT_M8_X8, LSN_IT_EMULATION }, {
+				/* BeginInst() */															&CRicoh5A22::Fetch_Opcode_IncPc_Phi2,
+				&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Fetch_Phi2<LSN_RT_ADDRESS_LOW>,
+				&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Fetch_Phi2<LSN_RT_ADDRESS_HIGH>,
+				&CRicoh5A22::Jmp<>
+			} );
+			return iRet;
+		}
+	}
+}
+
+/**
+ * Creates JSR or JSL.
+ *
+ * \param _amAddrMode LSN_AM_ABSOLUTE or LSN_AM_ABSOLUTE_INDEXED_INDIRECT for JSR, LSN_AM_ABSOLUTE_LONG for JSL.
+ * \return Returns the instruction.
+ **/
+constexpr CRicoh5A22::LSN_INSTR CRicoh5A22::Inst_Jsr( LSN_ADDRESSING_MODES _amAddrMode ) {
+	switch ( _amAddrMode ) {
+		case LSN_AM_ABSOLUTE_LONG : {
+			// Pushes PB, then the address of the last byte of the instruction.  The pushes never wrap inside page 1.
+			LSN_INSTR iRet = MakeInstr( 8, 8, _amAddrMode, 4, 4, LSN_I_JSL );
+			SetCycles( iRet, { LSN_IT_M16_X16, LSN_IT_M16_X8, LSN_IT_M8_X16, LSN_IT_M8_X8, LSN_IT_EMULATION }, {
+				/* BeginInst() */															&CRicoh5A22::Fetch_Opcode_IncPc_Phi2,
+				&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Fetch_Phi2<LSN_RT_ADDRESS_LOW>,
+				&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Fetch_Phi2<LSN_RT_ADDRESS_HIGH>,
+				&CRicoh5A22::Null<LSN_N, true>,												&CRicoh5A22::Push_Phi2<LSN_RS_PB, false, 0, true>,
+				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Null_Phi2,
+				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Fetch_Phi2<LSN_RT_BANK>,
+				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Push_Phi2<LSN_RS_PC, true, -1, true>,
+				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Push_Phi2<LSN_RS_PC, false, -2, true>,
+				&CRicoh5A22::Jml<true>
+			} );
+			return iRet;
+		}
+		case LSN_AM_ABSOLUTE_INDEXED_INDIRECT : {
+			LSN_INSTR iRet = MakeInstr( 8, 8, _amAddrMode, 3, 3, LSN_I_JSR );
+			SetCycles( iRet, { LSN_IT_M16_X16, LSN_IT_M16_X8, LSN_IT_M8_X16, LSN_IT_M8_X8, LSN_IT_EMULATION }, {
+				/* BeginInst() */															&CRicoh5A22::Fetch_Opcode_IncPc_Phi2,
+				&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Fetch_Phi2<LSN_RT_POINTER_LOW>,
+				&CRicoh5A22::Null<LSN_N, true>,												&CRicoh5A22::Push_Phi2<LSN_RS_PC, true, 0, true>,
+				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Push_Phi2<LSN_RS_PC, false, -1, true>,
+				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Fetch_Phi2<LSN_RT_POINTER_HIGH>,
+				&CRicoh5A22::Add_Index_To_Pointer<LSN_RS_X>,								&CRicoh5A22::Null_Phi2,
+				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Read_Program_Phi2<LSN_RT_ADDRESS_LOW, 0>,
+				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Read_Program_Phi2<LSN_RT_ADDRESS_HIGH, 1>,
+				&CRicoh5A22::Jmp<true>
+			} );
+			return iRet;
+		}
+		default : {
+			// Pushes the address of the last byte of the instruction.
+			LSN_INSTR iRet = MakeInstr( 6, 6, LSN_AM_ABSOLUTE, 3, 3, LSN_I_JSR );
+			SetCycles( iRet, { LSN_IT_M16_X16, LSN_IT_M16_X8, LSN_IT_M8_X16, LSN_IT_M8_X8, LSN_IT_EMULATION }, {
+				/* BeginInst() */															&CRicoh5A22::Fetch_Opcode_IncPc_Phi2,
+				&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Fetch_Phi2<LSN_RT_ADDRESS_LOW>,
+				&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Fetch_Phi2<LSN_RT_ADDRESS_HIGH>,
+				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Null_Phi2,
+				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Push_Phi2<LSN_RS_PC, true, 0>,
+				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Push_Phi2<LSN_RS_PC, false, -1>,
+				&CRicoh5A22::Jmp<true>
+			} );
+			return iRet;
+		}
+	}
+}
+
+/**
+ * Creates MVN or MVP.  Each pass moves 1 byte and, until A wraps, moves PC back to the opcode so that the instruction runs again.
+ *
+ * \param _bMvn If true, MVN is created, otherwise MVP.
+ * \return Returns the instruction.
+ **/
+constexpr CRicoh5A22::LSN_INSTR CRicoh5A22::Inst_Move( bool _bMvn ) {
+	LSN_INSTR iRet = MakeInstr( 7, 7, LSN_AM_BLOCK_MOVE, 3, 3, _bMvn ? LSN_I_MVN : LSN_I_MVP );
+	for ( size_t I = 0; I < LSN_IT_TOTAL; ++I ) {
+		const bool b8Bit = Is8Bit( LSN_OW_X, I );
+		const PfCycle pfMove = _bMvn ?
+			(b8Bit ? &CRicoh5A22::Move<true, 1> : &CRicoh5A22::Move<false, 1>) :
+			(b8Bit ? &CRicoh5A22::Move<true, -1> : &CRicoh5A22::Move<false, -1>);
+		AddCycles( iRet, I, 0, {
+			/* BeginInst() */															&CRicoh5A22::Fetch_Opcode_IncPc_Phi2,
+			&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Fetch_Phi2<LSN_RT_BANK>,
+			&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Fetch_Phi2<LSN_RT_POINTER_LOW>,
+			&CRicoh5A22::Move_Source,													&CRicoh5A22::Read_Data_Phi2<false, false>,
+			&CRicoh5A22::Move_Destination,												&CRicoh5A22::Write_Data_Phi2<false, false>,
+			pfMove,																		&CRicoh5A22::Null_Phi2,
+			&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Null_Phi2,
+			&CRicoh5A22::Null<LSN_N, false, false, true>
+		} );
+	}
+	return iRet;
+}
+
+/**
+ * Creates PEA, PEI, or PER.
+ *
+ * \param _iInstruction LSN_I_PEA, LSN_I_PEI, or LSN_I_PER.
+ * \return Returns the instruction.
+ **/
+constexpr CRicoh5A22::LSN_INSTR CRicoh5A22::Inst_PushEffective( LSN_INSTRUCTIONS _iInstruction ) {
+	// The pushes never wrap inside page 1.
+	switch ( _iInstruction ) {
+		case LSN_I_PEI : {
+			LSN_INSTR iRet = MakeInstr( 6, 6, LSN_AM_DIRECT_PAGE_INDIRECT, 2, 2, _iInstruction );
+			SetCycles( iRet, { LSN_IT_M16_X16, LSN_IT_M16_X8, LSN_IT_M8_X16, LSN_IT_M8_X8, LSN_IT_EMULATION }, {
+				/* BeginInst() */															&CRicoh5A22::Fetch_Opcode_IncPc_Phi2,
+				&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Fetch_Phi2<LSN_RT_POINTER_LOW, true>,
+				&CRicoh5A22::Null<LSN_N, true>,												&CRicoh5A22::Null_Phi2,
+				&CRicoh5A22::Null<LSN_N, true>,												&CRicoh5A22::Read_Direct_Phi2<LSN_RT_OPERAND_LOW, 0, true>,
+				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Read_Direct_Phi2<LSN_RT_OPERAND_HIGH, 1, true>,
+				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Push_Phi2<LSN_RS_OPERAND, true, 0, true>,
+				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Push_Phi2<LSN_RS_OPERAND, false, -1, true>,
+				&CRicoh5A22::Null<LSN_N, false, true, true>
+			} );
+			return iRet;
+		}
+		case LSN_I_PER : {
+			LSN_INSTR iRet = MakeInstr( 6, 6, LSN_AM_RELATIVE_LONG, 3, 3, _iInstruction );
+			SetCycles( iRet, { LSN_IT_M16_X16, LSN_IT_M16_X8, LSN_IT_M8_X16, LSN_IT_M8_X8, LSN_IT_EMULATION }, {
+				/* BeginInst() */															&CRicoh5A22::Fetch_Opcode_IncPc_Phi2,
+				&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Fetch_Phi2<LSN_RT_OPERAND_LOW>,
+				&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Fetch_Phi2<LSN_RT_OPERAND_HIGH>,
+				&CRicoh5A22::Add_Pc_To_Operand_IncPc,										&CRicoh5A22::Null_Phi2,
+				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Push_Phi2<LSN_RS_OPERAND, true, 0, true>,
+				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Push_Phi2<LSN_RS_OPERAND, false, -1, true>,
+				&CRicoh5A22::Null<LSN_N, false, true, true>
+			} );
+			return iRet;
+		}
+		default : {
+			LSN_INSTR iRet = MakeInstr( 5, 5, LSN_AM_ABSOLUTE, 3, 3, LSN_I_PEA );
+			SetCycles( iRet, { LSN_IT_M16_X16, LSN_IT_M16_X8, LSN_IT_M8_X16, LSN_IT_M8_X8, LSN_IT_EMULATION }, {
+				/* BeginInst() */															&CRicoh5A22::Fetch_Opcode_IncPc_Phi2,
+				&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Fetch_Phi2<LSN_RT_OPERAND_LOW>,
+				&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Fetch_Phi2<LSN_RT_OPERAND_HIGH>,
+				&CRicoh5A22::Null<LSN_N, true>,												&CRicoh5A22::Push_Phi2<LSN_RS_OPERAND, true, 0, true>,
+				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Push_Phi2<LSN_RS_OPERAND, false, -1, true>,
+				&CRicoh5A22::Null<LSN_N, false, true, true>
+			} );
+			return iRet;
+		}
+	}
+}
+
+/**
+ * Creates REP or SEP.
+ *
+ * \param _pfOp The operation (Rep() or Sep()), called on the PHI1 of the next instruction's first cycle with the mask in m_fsState.ui16Operand.
+ * \param _iInstruction The instruction.
+ * \return Returns the instruction.
+ **/
+constexpr CRicoh5A22::LSN_INSTR CRicoh5A22::Inst_RepSep( PfCycle _pfOp, LSN_INSTRUCTIONS _iInstruction ) {
+	LSN_INSTR iRet = MakeInstr( 3, 3, LSN_AM_IMMEDIATE, 2, 2, _iInstruction );
+	SetCycles( iRet, { LSN_IT_M16_X16, LSN_IT_M16_X8, LSN_IT_M8_X16, LSN_IT_M8_X8, LSN_IT_EMULATION }, {
+		/* BeginInst() */															&CRicoh5A22::Fetch_Opcode_IncPc_Phi2,
+		&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Fetch_Phi2<LSN_RT_OPERAND_LOW>,
+		&CRicoh5A22::Null<LSN_N, true>,												&CRicoh5A22::Null_Phi2,
+		_pfOp
+	} );
+	return iRet;
+}
+
+/**
+ * Creates RTI, RTL, or RTS.
+ *
+ * \param _iInstruction LSN_I_RTI, LSN_I_RTL, or LSN_I_RTS.
+ * \return Returns the instruction.
+ **/
+constexpr CRicoh5A22::LSN_INSTR CRicoh5A22::Inst_Return( LSN_INSTRUCTIONS _iInstruction ) {
+	switch ( _iInstruction ) {
+		case LSN_I_RTI : {
+			// Native mode also pulls PB.
+			LSN_INSTR iRet = MakeInstr( 7, 6, LSN_AM_STACK, 1, 1, _iInstruction );
+			SetCycles( iRet, { LSN_IT_M16_X16, LSN_IT_M16_X8, LSN_IT_M8_X16, LSN_IT_M8_X8 }, {
+				/* BeginInst() */															&CRicoh5A22::Fetch_Opcode_IncPc_Phi2,
+				&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Null_Phi2,
+				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Null_Phi2,
+				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Pull_Phi2<LSN_RT_OPERAND_LOW, 1>,
+				&CRicoh5A22::SetStatusFromOperand,											&CRicoh5A22::Pull_Phi2<LSN_RT_ADDRESS_LOW, 2>,
+				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Pull_Phi2<LSN_RT_ADDRESS_HIGH, 3>,
+				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Pull_Phi2<LSN_RT_BANK, 4>,
+				&CRicoh5A22::Jml<true>
+			} );
+			SetCycles( iRet, { LSN_IT_EMULATION }, {
+				/* BeginInst() */															&CRicoh5A22::Fetch_Opcode_IncPc_Phi2,
+				&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Null_Phi2,
+				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Null_Phi2,
+				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Pull_Phi2<LSN_RT_OPERAND_LOW, 1>,
+				&CRicoh5A22::SetStatusFromOperand,											&CRicoh5A22::Pull_Phi2<LSN_RT_ADDRESS_LOW, 2>,
+				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Pull_Phi2<LSN_RT_ADDRESS_HIGH, 3>,
+				&CRicoh5A22::Jmp<true>
+			} );
+			return iRet;
+		}
+		case LSN_I_RTL : {
+			// The pulls never wrap inside page 1.
+			LSN_INSTR iRet = MakeInstr( 6, 6, LSN_AM_STACK, 1, 1, _iInstruction );
+			SetCycles( iRet, { LSN_IT_M16_X16, LSN_IT_M16_X8, LSN_IT_M8_X16, LSN_IT_M8_X8, LSN_IT_EMULATION }, {
+				/* BeginInst() */															&CRicoh5A22::Fetch_Opcode_IncPc_Phi2,
+				&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Null_Phi2,
+				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Null_Phi2,
+				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Pull_Phi2<LSN_RT_ADDRESS_LOW, 1, true>,
+				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Pull_Phi2<LSN_RT_ADDRESS_HIGH, 2, true>,
+				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Pull_Phi2<LSN_RT_BANK, 3, true>,
+				&CRicoh5A22::Rtl
+			} );
+			return iRet;
+		}
+		default : {
+			LSN_INSTR iRet = MakeInstr( 6, 6, LSN_AM_STACK, 1, 1, LSN_I_RTS );
+			SetCycles( iRet, { LSN_IT_M16_X16, LSN_IT_M16_X8, LSN_IT_M8_X16, LSN_IT_M8_X8, LSN_IT_EMULATION }, {
+				/* BeginInst() */															&CRicoh5A22::Fetch_Opcode_IncPc_Phi2,
+				&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Null_Phi2,
+				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Null_Phi2,
+				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Pull_Phi2<LSN_RT_ADDRESS_LOW, 1>,
+				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Pull_Phi2<LSN_RT_ADDRESS_HIGH, 2>,
+				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Null_Phi2,
+				&CRicoh5A22::Rts
+			} );
+			return iRet;
+		}
+	}
+}
+
+/**
+ * Creates STP.
+ *
+ * \return Returns STP.
+ **/
+constexpr CRicoh5A22::LSN_INSTR CRicoh5A22::Inst_Stp() {
+	LSN_INSTR iRet = MakeInstr( 3, 3, LSN_AM_IMPLIED, 1, 1, LSN_I_STP );
+	SetCycles( iRet, { LSN_IT_M16_X16, LSN_IT_M16_X8, LSN_IT_M8_X16, LSN_IT_M8_X8, LSN_IT_EMULATION }, {
+		/* BeginInst() */															&CRicoh5A22::Fetch_Opcode_IncPc_Phi2,
+		&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Null_Phi2,
+		&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Halt_Phi2<LSN_H_STP>,
+		&CRicoh5A22::Null<LSN_N, false, false, true>
+	} );
+	return iRet;
+}
+
+/**
+ * Creates WAI.
+ *
+ * \return Returns WAI.
+ **/
+constexpr CRicoh5A22::LSN_INSTR CRicoh5A22::Inst_Wai() {
+	LSN_INSTR iRet = MakeInstr( 3, 3, LSN_AM_IMPLIED, 1, 1, LSN_I_WAI );
+	SetCycles( iRet, { LSN_IT_M16_X16, LSN_IT_M16_X8, LSN_IT_M8_X16, LSN_IT_M8_X8, LSN_IT_EMULATION }, {
+		/* BeginInst() */															&CRicoh5A22::Fetch_Opcode_IncPc_Phi2,
+		&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Null_Phi2,
+		&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Halt_Phi2<LSN_H_WAI>,
+		&CRicoh5A22::Null<LSN_N, false, false, true>
+	} );
+	return iRet;
+}
+
+/**
+ * Creates WDM (a 2-byte no-op).
+ *
+ * \return Returns WDM.
+ **/
+constexpr CRicoh5A22::LSN_INSTR CRicoh5A22::Inst_Wdm() {
+	LSN_INSTR iRet = MakeInstr( 2, 2, LSN_AM_IMMEDIATE, 2, 2, LSN_I_WDM );
+	SetCycles( iRet, { LSN_IT_M16_X16, LSN_IT_M16_X8, LSN_IT_M8_X16, LSN_IT_M8_X8, LSN_IT_EMULATION }, {
+		/* BeginInst() */															&CRicoh5A22::Fetch_Opcode_IncPc_Phi2,
+		&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Fetch_Phi2<LSN_RT_OPERAND_LOW>,
+		&CRicoh5A22::Null<LSN_N, true, false, true>
+	} );
+	return iRet;
+}
+
+/**
+ * Creates XBA.
+ *
+ * \return Returns XBA.
+ **/
+constexpr CRicoh5A22::LSN_INSTR CRicoh5A22::Inst_Xba() {
+	LSN_INSTR iRet = MakeInstr( 3, 3, LSN_AM_IMPLIED, 1, 1, LSN_I_XBA );
+	SetCycles( iRet, { LSN_IT_M16_X16, LSN_IT_M16_X8, LSN_IT_M8_X16, LSN_IT_M8_X8, LSN_IT_EMULATION }, {
+		/* BeginInst() */															&CRicoh5A22::Fetch_Opcode_IncPc_Phi2,
+		&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Null_Phi2,
+		&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Null_Phi2,
+		&CRicoh5A22::Xba
+	} );
+	return iRet;
+}
+
+
+/**
+ * Creates an instruction that reads, writes, or modifies memory through any of the memory addressing modes.  Every mode shares the same
+ *	data cycles: M or X selects 1 or 2 data bytes, and a read-modify-write adds an idle cycle (a dummy write of the unmodified value in
+ *	emulation mode) before writing back, high byte first.
+ *
+ * \param _amAddrMode The addressing mode.
+ * \param _atAccess The type of access.
+ * \param _owWidth The width of the data.
+ * \param _pfOp8 The 8-bit operation.  For reads and read-modify-writes it runs on the PHI1 after the data is read (reads: the next
+ *	instruction's first cycle).  For writes it is the PHI1 of the second cycle and copies the register to m_fsState.ui16Operand.
+ * \param _pfOp16 The 16-bit operation.
+ * \param _iInstruction The instruction.
+ * \return Returns the instruction.
+ **/
+constexpr CRicoh5A22::LSN_INSTR CRicoh5A22::AddrMode_Access( LSN_ADDRESSING_MODES _amAddrMode, LSN_ACCESS_TYPE _atAccess, LSN_OPERAND_WIDTH _owWidth, PfCycle _pfOp8, PfCycle _pfOp16, LSN_INSTRUCTIONS _iInstruction ) {
+	LSN_INSTR iRet = MakeInstr( 0, 0, _amAddrMode, 2, 2, _iInstruction );
+	const bool bRead = _atAccess == LSN_AT_READ;
+	bool bBank0 = false;					// Direct page and stack relative data never leave bank 0.
+	bool bDl = false;						// The direct-page penalty cycle is only taken when D.l != 0.
+	bool bIndexed = false;					// Reads with 8-bit index registers skip the indexing cycle if no page is crossed.
+	for ( size_t I = 0; I < LSN_IT_TOTAL; ++I ) {
+		const bool b8Bit = Is8Bit( _owWidth, I );
+		const bool bSkip = bRead && Is8Bit( LSN_OW_X, I );
+		const PfCycle pfOp = b8Bit ? _pfOp8 : _pfOp16;
+		size_t sIdx = AddCycles( iRet, I, 0, {
+			/* BeginInst() */															&CRicoh5A22::Fetch_Opcode_IncPc_Phi2,
+			(_atAccess == LSN_AT_WRITE) ? pfOp : &CRicoh5A22::Null<LSN_R, true>,
+		} );
+		switch ( _amAddrMode ) {
+			case LSN_AM_DIRECT_PAGE : {
+				sIdx = AddCycles( iRet, I, sIdx, {
+																								&CRicoh5A22::Fetch_Phi2<LSN_RT_POINTER_LOW, true>,
+					&CRicoh5A22::Null<LSN_N, true>,												&CRicoh5A22::Null_Phi2,
+					&CRicoh5A22::Direct_To_Address<LSN_RS_NONE>,
+				} );
+				bBank0 = bDl = true;
+				break;
+			}
+			case LSN_AM_DIRECT_PAGE_INDEXED_X : {
+				sIdx = AddCycles( iRet, I, sIdx, {
+																								&CRicoh5A22::Fetch_Phi2<LSN_RT_POINTER_LOW, true>,
+					&CRicoh5A22::Null<LSN_N, true>,												&CRicoh5A22::Null_Phi2,
+					&CRicoh5A22::Direct_To_Address<LSN_RS_X>,									&CRicoh5A22::Null_Phi2,
+					&CRicoh5A22::Null<LSN_N>,
+				} );
+				bBank0 = bDl = true;
+				break;
+			}
+			case LSN_AM_DIRECT_PAGE_INDEXED_Y : {
+				sIdx = AddCycles( iRet, I, sIdx, {
+																								&CRicoh5A22::Fetch_Phi2<LSN_RT_POINTER_LOW, true>,
+					&CRicoh5A22::Null<LSN_N, true>,												&CRicoh5A22::Null_Phi2,
+					&CRicoh5A22::Direct_To_Address<LSN_RS_Y>,									&CRicoh5A22::Null_Phi2,
+					&CRicoh5A22::Null<LSN_N>,
+				} );
+				bBank0 = bDl = true;
+				break;
+			}
+			case LSN_AM_DIRECT_PAGE_INDIRECT : {
+				sIdx = AddCycles( iRet, I, sIdx, {
+																								&CRicoh5A22::Fetch_Phi2<LSN_RT_POINTER_LOW, true>,
+					&CRicoh5A22::Null<LSN_N, true>,												&CRicoh5A22::Null_Phi2,
+					&CRicoh5A22::Null<LSN_N, true>,												&CRicoh5A22::Read_Direct_Phi2<LSN_RT_ADDRESS_LOW, 0>,
+					&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Read_Direct_AddressHigh_Phi2<LSN_RS_NONE, false>,
+					&CRicoh5A22::Null<LSN_N>,
+				} );
+				bDl = true;
+				break;
+			}
+			case LSN_AM_INDIRECT_X : {
+				sIdx = AddCycles( iRet, I, sIdx, {
+																								&CRicoh5A22::Fetch_Phi2<LSN_RT_POINTER_LOW, true>,
+					&CRicoh5A22::Null<LSN_N, true>,												&CRicoh5A22::Null_Phi2,
+					&CRicoh5A22::Add_Index_To_Pointer<LSN_RS_X>,								&CRicoh5A22::Null_Phi2,
+					&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Read_Direct_Phi2<LSN_RT_ADDRESS_LOW, 0>,
+					&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Read_Direct_AddressHigh_Phi2<LSN_RS_NONE, false>,
+					&CRicoh5A22::Null<LSN_N>,
+				} );
+				bDl = true;
+				break;
+			}
+			case LSN_AM_DIRECT_PAGE_INDIRECT_INDEXED_Y : {
+				sIdx = AddCycles( iRet, I, sIdx, {
+																								&CRicoh5A22::Fetch_Phi2<LSN_RT_POINTER_LOW, true>,
+					&CRicoh5A22::Null<LSN_N, true>,												&CRicoh5A22::Null_Phi2,
+					&CRicoh5A22::Null<LSN_N, true>,												&CRicoh5A22::Read_Direct_Phi2<LSN_RT_ADDRESS_LOW, 0>,
+					&CRicoh5A22::Null<LSN_N>,													bSkip ? &CRicoh5A22::Read_Direct_AddressHigh_Phi2<LSN_RS_Y, true> : &CRicoh5A22::Read_Direct_AddressHigh_Phi2<LSN_RS_Y, false>,
+					&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Null_Phi2,
+					&CRicoh5A22::Null<LSN_N>,
+				} );
+				bDl = bIndexed = true;
+				break;
+			}
+			case LSN_AM_DIRECT_PAGE_INDIRECT_LONG : {}	LSN_FALLTHROUGH
+			case LSN_AM_DIRECT_PAGE_INDIRECT_LONG_INDEXED_Y : {
+				sIdx = AddCycles( iRet, I, sIdx, {
+																								&CRicoh5A22::Fetch_Phi2<LSN_RT_POINTER_LOW, true>,
+					&CRicoh5A22::Null<LSN_N, true>,												&CRicoh5A22::Null_Phi2,
+					&CRicoh5A22::Null<LSN_N, true>,												&CRicoh5A22::Read_Direct_Phi2<LSN_RT_ADDRESS_LOW, 0, true>,
+					&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Read_Direct_Phi2<LSN_RT_ADDRESS_HIGH, 1, true>,
+					&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Read_Direct_Phi2<LSN_RT_BANK, 2, true>,
+					(_amAddrMode == LSN_AM_DIRECT_PAGE_INDIRECT_LONG) ? &CRicoh5A22::Null<LSN_N> : &CRicoh5A22::Add_Index_To_Address<LSN_RS_Y, false, false>,
+				} );
+				bDl = true;
+				break;
+			}
+			case LSN_AM_STACK_RELATIVE : {
+				sIdx = AddCycles( iRet, I, sIdx, {
+																								&CRicoh5A22::Fetch_Phi2<LSN_RT_POINTER_LOW>,
+					&CRicoh5A22::Stack_To_Address,												&CRicoh5A22::Null_Phi2,
+					&CRicoh5A22::Null<LSN_N>,
+				} );
+				bBank0 = true;
+				break;
+			}
+			case LSN_AM_STACK_RELATIVE_INDIRECT_INDEXED_Y : {
+				sIdx = AddCycles( iRet, I, sIdx, {
+																								&CRicoh5A22::Fetch_Phi2<LSN_RT_POINTER_LOW>,
+					&CRicoh5A22::Null<LSN_N, true>,												&CRicoh5A22::Null_Phi2,
+					&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Read_Stack_Phi2<LSN_RT_ADDRESS_LOW, 0>,
+					&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Read_Stack_Phi2<LSN_RT_ADDRESS_HIGH, 1>,
+					&CRicoh5A22::Add_Index_To_Address<LSN_RS_Y, true, false>,					&CRicoh5A22::Null_Phi2,
+					&CRicoh5A22::Null<LSN_N>,
+				} );
+				break;
+			}
+			case LSN_AM_ABSOLUTE_X : {}	LSN_FALLTHROUGH
+			case LSN_AM_ABSOLUTE_Y : {
+				const bool bX = _amAddrMode == LSN_AM_ABSOLUTE_X;
+				sIdx = AddCycles( iRet, I, sIdx, {
+																								&CRicoh5A22::Fetch_Phi2<LSN_RT_ADDRESS_LOW>,
+					&CRicoh5A22::Null<LSN_R, true>,												bX ?
+						(bSkip ? &CRicoh5A22::Fetch_AddressHigh_Phi2<LSN_RS_X, true> : &CRicoh5A22::Fetch_AddressHigh_Phi2<LSN_RS_X, false>) :
+						(bSkip ? &CRicoh5A22::Fetch_AddressHigh_Phi2<LSN_RS_Y, true> : &CRicoh5A22::Fetch_AddressHigh_Phi2<LSN_RS_Y, false>),
+					&CRicoh5A22::Null<LSN_N, true>,												&CRicoh5A22::Null_Phi2,
+					&CRicoh5A22::Null<LSN_N, true>,
+				} );
+				iRet.ui8Size[I] = 3;
+				bIndexed = true;
+				break;
+			}
+			case LSN_AM_ABSOLUTE_LONG : {}	LSN_FALLTHROUGH
+			case LSN_AM_ABSOLUTE_LONG_X : {
+				sIdx = AddCycles( iRet, I, sIdx, {
+																								&CRicoh5A22::Fetch_Phi2<LSN_RT_ADDRESS_LOW>,
+					&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Fetch_Phi2<LSN_RT_ADDRESS_HIGH>,
+					&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Fetch_Phi2<LSN_RT_BANK>,
+					(_amAddrMode == LSN_AM_ABSOLUTE_LONG) ? &CRicoh5A22::Null<LSN_N, true> : &CRicoh5A22::Add_Index_To_Address<LSN_RS_X, false, true>,
+				} );
+				iRet.ui8Size[I] = 4;
+				break;
+			}
+			default : {
+				// LSN_AM_ABSOLUTE.
+				sIdx = AddCycles( iRet, I, sIdx, {
+																								&CRicoh5A22::Fetch_Phi2<LSN_RT_ADDRESS_LOW>,
+					&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Fetch_AddressHigh_Phi2<LSN_RS_NONE, false>,
+					&CRicoh5A22::Null<LSN_N, true>,
+				} );
+				iRet.ui8Size[I] = 3;
+			}
+		}
+
+		const PfCycle pfRead0 = bBank0 ? &CRicoh5A22::Read_Data_Phi2<false, true> : &CRicoh5A22::Read_Data_Phi2<false, false>;
+		const PfCycle pfRead1 = bBank0 ? &CRicoh5A22::Read_Data_Phi2<true, true> : &CRicoh5A22::Read_Data_Phi2<true, false>;
+		const PfCycle pfWrite0 = bBank0 ? &CRicoh5A22::Write_Data_Phi2<false, true> : &CRicoh5A22::Write_Data_Phi2<false, false>;
+		const PfCycle pfWrite1 = bBank0 ? &CRicoh5A22::Write_Data_Phi2<true, true> : &CRicoh5A22::Write_Data_Phi2<true, false>;
+		switch ( _atAccess ) {
+			case LSN_AT_READ : {
+				if ( b8Bit ) {
+					sIdx = AddCycles( iRet, I, sIdx, {
+																									pfRead0,
+						pfOp
+					} );
+				}
+				else {
+					sIdx = AddCycles( iRet, I, sIdx, {
+																									pfRead0,
+						&CRicoh5A22::Null<LSN_N>,													pfRead1,
+						pfOp
+					} );
+				}
+				break;
+			}
+			case LSN_AT_WRITE : {
+				if ( b8Bit ) {
+					sIdx = AddCycles( iRet, I, sIdx, {
+																									pfWrite0,
+						&CRicoh5A22::Null<LSN_N, false, false, true>
+					} );
+				}
+				else {
+					sIdx = AddCycles( iRet, I, sIdx, {
+																									pfWrite0,
+						&CRicoh5A22::Null<LSN_N>,													pfWrite1,
+						&CRicoh5A22::Null<LSN_N, false, false, true>
+					} );
+				}
+				break;
+			}
+			case LSN_AT_RMW : {
+				if ( b8Bit ) {
+					// Emulation mode writes the unmodified value back where native mode idles.
+					sIdx = AddCycles( iRet, I, sIdx, {
+																									pfRead0,
+						&CRicoh5A22::Null<LSN_N>,													(I == LSN_IT_EMULATION) ? pfWrite0 : &CRicoh5A22::Null_Phi2,
+						pfOp,																		pfWrite0,
+						&CRicoh5A22::Null<LSN_N, false, false, true>
+					} );
+				}
+				else {
+					sIdx = AddCycles( iRet, I, sIdx, {
+																									pfRead0,
+						&CRicoh5A22::Null<LSN_N>,													pfRead1,
+						&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Null_Phi2,
+						pfOp,																		pfWrite1,
+						&CRicoh5A22::Null<LSN_N>,													pfWrite0,
+						&CRicoh5A22::Null<LSN_N, false, false, true>
+					} );
+				}
+				break;
+			}
+		}
+
+		// Each cycle is a PHI2/PHI1 pair after the final BeginInst() entry.  The optional cycles are not counted.
+		const uint8_t ui8Cycles = uint8_t( sIdx / 2 - (bDl ? 1 : 0) - ((bIndexed && bSkip) ? 1 : 0) );
+		if ( I == LSN_IT_M16_X16 ) { iRet.ui8TotalCyclesN = ui8Cycles; }
+		else if ( I == LSN_IT_EMULATION ) { iRet.ui8TotalCyclesE = ui8Cycles; }
+	}
+	return iRet;
+}
+
+/**
+ * Creates an instruction using the Immediate addressing mode.  16-bit operands add a byte to the instruction.
+ *
+ * \param _pfOp8 The 8-bit operation, called on the PHI1 of the next instruction's first cycle with the immediate in m_fsState.ui16Operand.
+ * \param _pfOp16 The 16-bit operation, called on the PHI1 of the next instruction's first cycle with the immediate in m_fsState.ui16Operand.
+ * \param _owWidth The width of the immediate.
+ * \param _iInstruction The instruction.
+ * \return Returns the instruction.
+ **/
+constexpr CRicoh5A22::LSN_INSTR CRicoh5A22::AddrMode_Immediate( PfCycle _pfOp8, PfCycle _pfOp16, LSN_OPERAND_WIDTH _owWidth, LSN_INSTRUCTIONS _iInstruction ) {
+	LSN_INSTR iRet = MakeInstr( Is8Bit( _owWidth, LSN_IT_M16_X16 ) ? 2 : 3, 2, LSN_AM_IMMEDIATE, 2, 2, _iInstruction );
+	for ( size_t I = 0; I < LSN_IT_TOTAL; ++I ) {
+		if ( Is8Bit( _owWidth, I ) ) {
+			AddCycles( iRet, I, 0, {
+				/* BeginInst() */															&CRicoh5A22::Fetch_Opcode_IncPc_Phi2,
+				&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Fetch_Phi2<LSN_RT_OPERAND_LOW>,
+				_pfOp8
+			} );
+		}
+		else {
+			AddCycles( iRet, I, 0, {
+				/* BeginInst() */															&CRicoh5A22::Fetch_Opcode_IncPc_Phi2,
+				&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Fetch_Phi2<LSN_RT_OPERAND_LOW>,
+				&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Fetch_Phi2<LSN_RT_OPERAND_HIGH>,
+				_pfOp16
+			} );
+			++iRet.ui8Size[I];
+		}
+	}
+	return iRet;
+}
+
+/**
+ * Creates a 2-cycle instruction using the Implied addressing mode.
+ *
+ * \param _pfOp The operation, called on the PHI1 of the next instruction's first cycle.
+ * \param _iInstruction The instruction.
+ * \return Returns the instruction.
+ **/
+constexpr CRicoh5A22::LSN_INSTR CRicoh5A22::AddrMode_Implied( PfCycle _pfOp, LSN_INSTRUCTIONS _iInstruction ) {
+	LSN_INSTR iRet = MakeInstr( 2, 2, LSN_AM_IMPLIED, 1, 1, _iInstruction );
+	SetCycles( iRet, { LSN_IT_M16_X16, LSN_IT_M16_X8, LSN_IT_M8_X16, LSN_IT_M8_X8, LSN_IT_EMULATION }, {
+		/* BeginInst() */															&CRicoh5A22::Fetch_Opcode_IncPc_Phi2,
+		&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Null_Phi2,
+		_pfOp
+	} );
+	return iRet;
+}
+
+/**
+ * Creates a 2-cycle instruction using the Implied addressing mode whose operation depends on M or X.
+ *
+ * \param _pfOp8 The 8-bit operation, called on the PHI1 of the next instruction's first cycle.
+ * \param _pfOp16 The 16-bit operation, called on the PHI1 of the next instruction's first cycle.
+ * \param _owWidth The width of the operation.
+ * \param _iInstruction The instruction.
+ * \return Returns the instruction.
+ **/
+constexpr CRicoh5A22::LSN_INSTR CRicoh5A22::AddrMode_Implied( PfCycle _pfOp8, PfCycle _pfOp16, LSN_OPERAND_WIDTH _owWidth, LSN_INSTRUCTIONS _iInstruction ) {
+	LSN_INSTR iRet = MakeInstr( 2, 2, (_iInstruction == LSN_I_ASL || _iInstruction == LSN_I_LSR || _iInstruction == LSN_I_ROL || _iInstruction == LSN_I_ROR ||
+		_iInstruction == LSN_I_INC || _iInstruction == LSN_I_DEC) ? LSN_AM_ACCUMULATOR : LSN_AM_IMPLIED, 1, 1, _iInstruction );
+	for ( size_t I = 0; I < LSN_IT_TOTAL; ++I ) {
+		AddCycles( iRet, I, 0, {
+			/* BeginInst() */															&CRicoh5A22::Fetch_Opcode_IncPc_Phi2,
+			&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Null_Phi2,
+			Is8Bit( _owWidth, I ) ? _pfOp8 : _pfOp16
+		} );
+	}
+	return iRet;
+}
+
+/**
+ * Creates a pull instruction (PLA, PLB, PLD, PLP, PLX, PLY).
+ *
+ * \param _pfOp8 The 8-bit operation, called on the PHI1 of the next instruction's first cycle with the pulled value in m_fsState.ui16Operand.
+ *	It must update S.
+ * \param _pfOp16 The 16-bit operation.
+ * \param _owWidth The width of the pulled value.
+ * \param _bNative If true, the pulls do not wrap inside page 1 in emulation mode.
+ * \param _iInstruction The instruction.
+ * \return Returns the instruction.
+ **/
+constexpr CRicoh5A22::LSN_INSTR CRicoh5A22::AddrMode_Pull( PfCycle _pfOp8, PfCycle _pfOp16, LSN_OPERAND_WIDTH _owWidth, bool _bNative, LSN_INSTRUCTIONS _iInstruction ) {
+	LSN_INSTR iRet = MakeInstr( Is8Bit( _owWidth, LSN_IT_M16_X16 ) ? 4 : 5, 4, LSN_AM_STACK, 1, 1, _iInstruction );
+	for ( size_t I = 0; I < LSN_IT_TOTAL; ++I ) {
+		if ( Is8Bit( _owWidth, I ) ) {
+			AddCycles( iRet, I, 0, {
+				/* BeginInst() */															&CRicoh5A22::Fetch_Opcode_IncPc_Phi2,
+				&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Null_Phi2,
+				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Null_Phi2,
+				&CRicoh5A22::Null<LSN_N>,													_bNative ? &CRicoh5A22::Pull_Phi2<LSN_RT_OPERAND_LOW, 1, true> : &CRicoh5A22::Pull_Phi2<LSN_RT_OPERAND_LOW, 1>,
+				_pfOp8
+			} );
+		}
+		else {
+			AddCycles( iRet, I, 0, {
+				/* BeginInst() */															&CRicoh5A22::Fetch_Opcode_IncPc_Phi2,
+				&CRicoh5A22::Null<LSN_R, true>,												&CRicoh5A22::Null_Phi2,
+				&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Null_Phi2,
+				&CRicoh5A22::Null<LSN_N>,													_bNative ? &CRicoh5A22::Pull_Phi2<LSN_RT_OPERAND_LOW, 1, true> : &CRicoh5A22::Pull_Phi2<LSN_RT_OPERAND_LOW, 1>,
+				&CRicoh5A22::Null<LSN_N>,													_bNative ? &CRicoh5A22::Pull_Phi2<LSN_RT_OPERAND_HIGH, 2, true> : &CRicoh5A22::Pull_Phi2<LSN_RT_OPERAND_HIGH, 2>,
+				_pfOp16
+			} );
+		}
+	}
+	return iRet;
+}
+
+/**
+ * Creates a push instruction (PHA, PHB, PHD, PHK, PHP, PHX, PHY).
+ *
+ * \param _pfCopy The PHI1 that copies the register to m_fsState.ui16Operand.
+ * \param _owWidth The width of the pushed value.
+ * \param _bNative If true, the pushes do not wrap inside page 1 in emulation mode.
+ * \param _iInstruction The instruction.
+ * \return Returns the instruction.
+ **/
+constexpr CRicoh5A22::LSN_INSTR CRicoh5A22::AddrMode_Push( PfCycle _pfCopy, LSN_OPERAND_WIDTH _owWidth, bool _bNative, LSN_INSTRUCTIONS _iInstruction ) {
+	LSN_INSTR iRet = MakeInstr( Is8Bit( _owWidth, LSN_IT_M16_X16 ) ? 3 : 4, 3, LSN_AM_STACK, 1, 1, _iInstruction );
+	for ( size_t I = 0; I < LSN_IT_TOTAL; ++I ) {
+		if ( Is8Bit( _owWidth, I ) ) {
+			AddCycles( iRet, I, 0, {
+				/* BeginInst() */															&CRicoh5A22::Fetch_Opcode_IncPc_Phi2,
+				_pfCopy,																	&CRicoh5A22::Null_Phi2,
+				&CRicoh5A22::Null<LSN_N>,													_bNative ? &CRicoh5A22::Push_Phi2<LSN_RS_OPERAND, false, 0, true> : &CRicoh5A22::Push_Phi2<LSN_RS_OPERAND, false, 0>,
+				&CRicoh5A22::Null<LSN_N, false, true, true>
+			} );
+		}
+		else {
+			AddCycles( iRet, I, 0, {
+				/* BeginInst() */															&CRicoh5A22::Fetch_Opcode_IncPc_Phi2,
+				_pfCopy,																	&CRicoh5A22::Null_Phi2,
+				&CRicoh5A22::Null<LSN_N>,													_bNative ? &CRicoh5A22::Push_Phi2<LSN_RS_OPERAND, true, 0, true> : &CRicoh5A22::Push_Phi2<LSN_RS_OPERAND, true, 0>,
+				&CRicoh5A22::Null<LSN_N>,													_bNative ? &CRicoh5A22::Push_Phi2<LSN_RS_OPERAND, false, -1, true> : &CRicoh5A22::Push_Phi2<LSN_RS_OPERAND, false, -1>,
+				&CRicoh5A22::Null<LSN_N, false, true, true>
+			} );
+		}
+	}
+	return iRet;
+}
+
+/**
+ * Creates a branch instruction using the Relative addressing mode.  A taken branch adds a cycle, and in emulation mode crossing a page
+ *	adds another.  Cycles are removed by Branch_Phi2(), so the untaken branch skips both.
+ *
+ * \param _pfBranch The Branch_Phi2() specialization that reads the offset and decides the branch.
+ * \param _iInstruction The instruction.
+ * \return Returns the instruction.
+ **/
+constexpr CRicoh5A22::LSN_INSTR CRicoh5A22::AddrMode_Relative( PfCycle _pfBranch, LSN_INSTRUCTIONS _iInstruction ) {
+	// BRA is always taken, so its extra cycle is not optional.
+	const uint8_t ui8Cycles = (_iInstruction == LSN_I_BRA) ? 3 : 2;
+	LSN_INSTR iRet = MakeInstr( ui8Cycles, ui8Cycles, LSN_AM_RELATIVE, 2, 2, _iInstruction );
+	SetCycles( iRet, { LSN_IT_M16_X16, LSN_IT_M16_X8, LSN_IT_M8_X16, LSN_IT_M8_X8, LSN_IT_EMULATION }, {
+		/* BeginInst() */															&CRicoh5A22::Fetch_Opcode_IncPc_Phi2,
+		&CRicoh5A22::Null<LSN_R, true>,												_pfBranch,
+		&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Null_Phi2,
+		&CRicoh5A22::Null<LSN_N>,													&CRicoh5A22::Null_Phi2,
+		&CRicoh5A22::Null<LSN_N, true, false, true>
+	} );
+	return iRet;
+}
+
+
+/**
+ * Generates a single instruction given its opcode.  Opcodes are decoded the way the 65C816 lays them out (aaabbbcc), so that every
+ *	instruction sharing an addressing mode gets the exact same cycle functions, differing only in the operation.
+ *
+ * \param _ui8Op The opcode.
+ * \return Returns the instruction for the given opcode.
+ **/
+constexpr CRicoh5A22::LSN_INSTR CRicoh5A22::GenerateInstruction( uint8_t _ui8Op ) {
+	const uint8_t ui8Aaa = uint8_t( _ui8Op >> 5 );
+	const uint8_t ui8Bbb = uint8_t( (_ui8Op >> 2) & 0x7 );
+	const uint8_t ui8Cc = uint8_t( _ui8Op & 0x3 );
+
+	switch ( _ui8Op ) {
+		// Control.
+		case 0x00 : { return Inst_Brk( false ); }
+		case 0x02 : { return Inst_Brk( true ); }
+		case 0x20 : { return Inst_Jsr( LSN_AM_ABSOLUTE ); }
+		case 0x22 : { return Inst_Jsr( LSN_AM_ABSOLUTE_LONG ); }
+		case 0x40 : { return Inst_Return( LSN_I_RTI ); }
+		case 0x42 : { return Inst_Wdm(); }
+		case 0x44 : { return Inst_Move( false ); }
+		case 0x4C : { return Inst_Jmp( LSN_I_JMP, LSN_AM_ABSOLUTE ); }
+		case 0x54 : { return Inst_Move( true ); }
+		case 0x5C : { return Inst_Jmp( LSN_I_JML, LSN_AM_ABSOLUTE_LONG ); }
+		case 0x60 : { return Inst_Return( LSN_I_RTS ); }
+		case 0x62 : { return Inst_PushEffective( LSN_I_PER ); }
+		case 0x6B : { return Inst_Return( LSN_I_RTL ); }
+		case 0x6C : { return Inst_Jmp( LSN_I_JMP, LSN_AM_INDIRECT ); }
+		case 0x7C : { return Inst_Jmp( LSN_I_JMP, LSN_AM_ABSOLUTE_INDEXED_INDIRECT ); }
+		case 0x80 : { return AddrMode_Relative( &CRicoh5A22::Branch_Phi2<0, false>, LSN_I_BRA ); }
+		case 0x82 : { return Inst_Brl(); }
+		case 0xC2 : { return Inst_RepSep( &CRicoh5A22::Rep, LSN_I_REP ); }
+		case 0xCB : { return Inst_Wai(); }
+		case 0xD4 : { return Inst_PushEffective( LSN_I_PEI ); }
+		case 0xDB : { return Inst_Stp(); }
+		case 0xDC : { return Inst_Jmp( LSN_I_JML, LSN_AM_ABSOLUTE_INDIRECT_LONG ); }
+		case 0xE2 : { return Inst_RepSep( &CRicoh5A22::Sep, LSN_I_SEP ); }
+		case 0xEB : { return Inst_Xba(); }
+		case 0xF4 : { return Inst_PushEffective( LSN_I_PEA ); }
+		case 0xFC : { return Inst_Jsr( LSN_AM_ABSOLUTE_INDEXED_INDIRECT ); }
+
+		// Flags.
+		case 0x18 : { return AddrMode_Implied( &CRicoh5A22::SetFlag<C(), false>, LSN_I_CLC ); }
+		case 0x38 : { return AddrMode_Implied( &CRicoh5A22::SetFlag<C(), true>, LSN_I_SEC ); }
+		case 0x58 : { return AddrMode_Implied( &CRicoh5A22::SetFlag<I(), false>, LSN_I_CLI ); }
+		case 0x78 : { return AddrMode_Implied( &CRicoh5A22::SetFlag<I(), true>, LSN_I_SEI ); }
+		case 0xB8 : { return AddrMode_Implied( &CRicoh5A22::SetFlag<V(), false>, LSN_I_CLV ); }
+		case 0xD8 : { return AddrMode_Implied( &CRicoh5A22::SetFlag<D(), false>, LSN_I_CLD ); }
+		case 0xF8 : { return AddrMode_Implied( &CRicoh5A22::SetFlag<D(), true>, LSN_I_SED ); }
+		case 0xFB : { return AddrMode_Implied( &CRicoh5A22::Xce, LSN_I_XCE ); }
+		case 0xEA : { return AddrMode_Implied( &CRicoh5A22::Null<LSN_N, false, false, true>, LSN_I_NOP ); }
+
+		// Stack.
+		case 0x08 : { return AddrMode_Push( &CRicoh5A22::Copy_To_Operand_IncPc<LSN_RS_P>, LSN_OW_8, false, LSN_I_PHP ); }
+		case 0x0B : { return AddrMode_Push( &CRicoh5A22::Copy_To_Operand_IncPc<LSN_RS_D>, LSN_OW_16, true, LSN_I_PHD ); }
+		case 0x48 : { return AddrMode_Push( &CRicoh5A22::Copy_To_Operand_IncPc<LSN_RS_A>, LSN_OW_M, false, LSN_I_PHA ); }
+		case 0x4B : { return AddrMode_Push( &CRicoh5A22::Copy_To_Operand_IncPc<LSN_RS_PB>, LSN_OW_8, false, LSN_I_PHK ); }
+		case 0x5A : { return AddrMode_Push( &CRicoh5A22::Copy_To_Operand_IncPc<LSN_RS_Y>, LSN_OW_X, false, LSN_I_PHY ); }
+		case 0x8B : { return AddrMode_Push( &CRicoh5A22::Copy_To_Operand_IncPc<LSN_RS_DB>, LSN_OW_8, false, LSN_I_PHB ); }
+		case 0xDA : { return AddrMode_Push( &CRicoh5A22::Copy_To_Operand_IncPc<LSN_RS_X>, LSN_OW_X, false, LSN_I_PHX ); }
+		case 0x28 : { return AddrMode_Pull( &CRicoh5A22::Plp, &CRicoh5A22::Plp, LSN_OW_8, false, LSN_I_PLP ); }
+		case 0x2B : { return AddrMode_Pull( &CRicoh5A22::Pld, &CRicoh5A22::Pld, LSN_OW_16, true, LSN_I_PLD ); }
+		case 0x68 : { return AddrMode_Pull( &CRicoh5A22::Lda<true, false, true>, &CRicoh5A22::Lda<false, false, true>, LSN_OW_M, false, LSN_I_PLA ); }
+		case 0x7A : { return AddrMode_Pull( &CRicoh5A22::Ldy<true, false, true>, &CRicoh5A22::Ldy<false, false, true>, LSN_OW_X, false, LSN_I_PLY ); }
+		case 0xAB : { return AddrMode_Pull( &CRicoh5A22::Plb, &CRicoh5A22::Plb, LSN_OW_8, true, LSN_I_PLB ); }
+		case 0xFA : { return AddrMode_Pull( &CRicoh5A22::Ldx<true, false, true>, &CRicoh5A22::Ldx<false, false, true>, LSN_OW_X, false, LSN_I_PLX ); }
+
+		// Transfers.  Copies to X and Y follow X, copies to A follow M, and D and S are always copied in full.
+		case 0x1B : { return AddrMode_Implied( &CRicoh5A22::Transfer<LSN_RS_A, LSN_RS_S, false>, LSN_I_TCS ); }
+		case 0x3B : { return AddrMode_Implied( &CRicoh5A22::Transfer<LSN_RS_S, LSN_RS_A, false>, LSN_I_TSC ); }
+		case 0x5B : { return AddrMode_Implied( &CRicoh5A22::Transfer<LSN_RS_A, LSN_RS_D, false>, LSN_I_TCD ); }
+		case 0x7B : { return AddrMode_Implied( &CRicoh5A22::Transfer<LSN_RS_D, LSN_RS_A, false>, LSN_I_TDC ); }
+		case 0x8A : { return AddrMode_Implied( &CRicoh5A22::Transfer<LSN_RS_X, LSN_RS_A, true>, &CRicoh5A22::Transfer<LSN_RS_X, LSN_RS_A, false>, LSN_OW_M, LSN_I_TXA ); }
+		case 0x98 : { return AddrMode_Implied( &CRicoh5A22::Transfer<LSN_RS_Y, LSN_RS_A, true>, &CRicoh5A22::Transfer<LSN_RS_Y, LSN_RS_A, false>, LSN_OW_M, LSN_I_TYA ); }
+		case 0x9A : { return AddrMode_Implied( &CRicoh5A22::Transfer<LSN_RS_X, LSN_RS_S, false>, LSN_I_TXS ); }
+		case 0x9B : { return AddrMode_Implied( &CRicoh5A22::Transfer<LSN_RS_X, LSN_RS_Y, true>, &CRicoh5A22::Transfer<LSN_RS_X, LSN_RS_Y, false>, LSN_OW_X, LSN_I_TXY ); }
+		case 0xA8 : { return AddrMode_Implied( &CRicoh5A22::Transfer<LSN_RS_A, LSN_RS_Y, true>, &CRicoh5A22::Transfer<LSN_RS_A, LSN_RS_Y, false>, LSN_OW_X, LSN_I_TAY ); }
+		case 0xAA : { return AddrMode_Implied( &CRicoh5A22::Transfer<LSN_RS_A, LSN_RS_X, true>, &CRicoh5A22::Transfer<LSN_RS_A, LSN_RS_X, false>, LSN_OW_X, LSN_I_TAX ); }
+		case 0xBA : { return AddrMode_Implied( &CRicoh5A22::Transfer<LSN_RS_S, LSN_RS_X, true>, &CRicoh5A22::Transfer<LSN_RS_S, LSN_RS_X, false>, LSN_OW_X, LSN_I_TSX ); }
+		case 0xBB : { return AddrMode_Implied( &CRicoh5A22::Transfer<LSN_RS_Y, LSN_RS_X, true>, &CRicoh5A22::Transfer<LSN_RS_Y, LSN_RS_X, false>, LSN_OW_X, LSN_I_TYX ); }
+
+		// Register increments and decrements.
+		case 0x1A : { return AddrMode_Implied( &CRicoh5A22::Inc<LSN_RS_A, true>, &CRicoh5A22::Inc<LSN_RS_A, false>, LSN_OW_M, LSN_I_INC ); }
+		case 0x3A : { return AddrMode_Implied( &CRicoh5A22::Dec<LSN_RS_A, true>, &CRicoh5A22::Dec<LSN_RS_A, false>, LSN_OW_M, LSN_I_DEC ); }
+		case 0x88 : { return AddrMode_Implied( &CRicoh5A22::Dec<LSN_RS_Y, true>, &CRicoh5A22::Dec<LSN_RS_Y, false>, LSN_OW_X, LSN_I_DEY ); }
+		case 0xC8 : { return AddrMode_Implied( &CRicoh5A22::Inc<LSN_RS_Y, true>, &CRicoh5A22::Inc<LSN_RS_Y, false>, LSN_OW_X, LSN_I_INY ); }
+		case 0xCA : { return AddrMode_Implied( &CRicoh5A22::Dec<LSN_RS_X, true>, &CRicoh5A22::Dec<LSN_RS_X, false>, LSN_OW_X, LSN_I_DEX ); }
+		case 0xE8 : { return AddrMode_Implied( &CRicoh5A22::Inc<LSN_RS_X, true>, &CRicoh5A22::Inc<LSN_RS_X, false>, LSN_OW_X, LSN_I_INX ); }
+
+		// BIT, TSB, TRB, and STZ.
+		case 0x04 : { return AddrMode_Access( LSN_AM_DIRECT_PAGE, LSN_AT_RMW, LSN_OW_M, &CRicoh5A22::Tsb<true>, &CRicoh5A22::Tsb<false>, LSN_I_TSB ); }
+		case 0x0C : { return AddrMode_Access( LSN_AM_ABSOLUTE, LSN_AT_RMW, LSN_OW_M, &CRicoh5A22::Tsb<true>, &CRicoh5A22::Tsb<false>, LSN_I_TSB ); }
+		case 0x14 : { return AddrMode_Access( LSN_AM_DIRECT_PAGE, LSN_AT_RMW, LSN_OW_M, &CRicoh5A22::Trb<true>, &CRicoh5A22::Trb<false>, LSN_I_TRB ); }
+		case 0x1C : { return AddrMode_Access( LSN_AM_ABSOLUTE, LSN_AT_RMW, LSN_OW_M, &CRicoh5A22::Trb<true>, &CRicoh5A22::Trb<false>, LSN_I_TRB ); }
+		case 0x24 : { return AddrMode_Access( LSN_AM_DIRECT_PAGE, LSN_AT_READ, LSN_OW_M, &CRicoh5A22::Bit<true>, &CRicoh5A22::Bit<false>, LSN_I_BIT ); }
+		case 0x2C : { return AddrMode_Access( LSN_AM_ABSOLUTE, LSN_AT_READ, LSN_OW_M, &CRicoh5A22::Bit<true>, &CRicoh5A22::Bit<false>, LSN_I_BIT ); }
+		case 0x34 : { return AddrMode_Access( LSN_AM_DIRECT_PAGE_INDEXED_X, LSN_AT_READ, LSN_OW_M, &CRicoh5A22::Bit<true>, &CRicoh5A22::Bit<false>, LSN_I_BIT ); }
+		case 0x3C : { return AddrMode_Access( LSN_AM_ABSOLUTE_X, LSN_AT_READ, LSN_OW_M, &CRicoh5A22::Bit<true>, &CRicoh5A22::Bit<false>, LSN_I_BIT ); }
+		case 0x89 : { return AddrMode_Immediate( &CRicoh5A22::Bit<true, true, true>, &CRicoh5A22::Bit<false, true, true>, LSN_OW_M, LSN_I_BIT ); }
+		case 0x64 : { return AddrMode_Access( LSN_AM_DIRECT_PAGE, LSN_AT_WRITE, LSN_OW_M, &CRicoh5A22::Copy_To_Operand_IncPc<LSN_RS_ZERO>, &CRicoh5A22::Copy_To_Operand_IncPc<LSN_RS_ZERO>, LSN_I_STZ ); }
+		case 0x74 : { return AddrMode_Access( LSN_AM_DIRECT_PAGE_INDEXED_X, LSN_AT_WRITE, LSN_OW_M, &CRicoh5A22::Copy_To_Operand_IncPc<LSN_RS_ZERO>, &CRicoh5A22::Copy_To_Operand_IncPc<LSN_RS_ZERO>, LSN_I_STZ ); }
+		case 0x9C : { return AddrMode_Access( LSN_AM_ABSOLUTE, LSN_AT_WRITE, LSN_OW_M, &CRicoh5A22::Copy_To_Operand_IncPc<LSN_RS_ZERO>, &CRicoh5A22::Copy_To_Operand_IncPc<LSN_RS_ZERO>, LSN_I_STZ ); }
+		case 0x9E : { return AddrMode_Access( LSN_AM_ABSOLUTE_X, LSN_AT_WRITE, LSN_OW_M, &CRicoh5A22::Copy_To_Operand_IncPc<LSN_RS_ZERO>, &CRicoh5A22::Copy_To_Operand_IncPc<LSN_RS_ZERO>, LSN_I_STZ ); }
+
+		// X and Y loads, stores, and compares.
+		case 0xA0 : { return AddrMode_Immediate( &CRicoh5A22::Ldy<true, true>, &CRicoh5A22::Ldy<false, true>, LSN_OW_X, LSN_I_LDY ); }
+		case 0xA2 : { return AddrMode_Immediate( &CRicoh5A22::Ldx<true, true>, &CRicoh5A22::Ldx<false, true>, LSN_OW_X, LSN_I_LDX ); }
+		case 0xC0 : { return AddrMode_Immediate( &CRicoh5A22::Cpy<true, true>, &CRicoh5A22::Cpy<false, true>, LSN_OW_X, LSN_I_CPY ); }
+		case 0xE0 : { return AddrMode_Immediate( &CRicoh5A22::Cpx<true, true>, &CRicoh5A22::Cpx<false, true>, LSN_OW_X, LSN_I_CPX ); }
+		case 0x84 : { return AddrMode_Access( LSN_AM_DIRECT_PAGE, LSN_AT_WRITE, LSN_OW_X, &CRicoh5A22::Copy_To_Operand_IncPc<LSN_RS_Y>, &CRicoh5A22::Copy_To_Operand_IncPc<LSN_RS_Y>, LSN_I_STY ); }
+		case 0x8C : { return AddrMode_Access( LSN_AM_ABSOLUTE, LSN_AT_WRITE, LSN_OW_X, &CRicoh5A22::Copy_To_Operand_IncPc<LSN_RS_Y>, &CRicoh5A22::Copy_To_Operand_IncPc<LSN_RS_Y>, LSN_I_STY ); }
+		case 0x94 : { return AddrMode_Access( LSN_AM_DIRECT_PAGE_INDEXED_X, LSN_AT_WRITE, LSN_OW_X, &CRicoh5A22::Copy_To_Operand_IncPc<LSN_RS_Y>, &CRicoh5A22::Copy_To_Operand_IncPc<LSN_RS_Y>, LSN_I_STY ); }
+		case 0x86 : { return AddrMode_Access( LSN_AM_DIRECT_PAGE, LSN_AT_WRITE, LSN_OW_X, &CRicoh5A22::Copy_To_Operand_IncPc<LSN_RS_X>, &CRicoh5A22::Copy_To_Operand_IncPc<LSN_RS_X>, LSN_I_STX ); }
+		case 0x8E : { return AddrMode_Access( LSN_AM_ABSOLUTE, LSN_AT_WRITE, LSN_OW_X, &CRicoh5A22::Copy_To_Operand_IncPc<LSN_RS_X>, &CRicoh5A22::Copy_To_Operand_IncPc<LSN_RS_X>, LSN_I_STX ); }
+		case 0x96 : { return AddrMode_Access( LSN_AM_DIRECT_PAGE_INDEXED_Y, LSN_AT_WRITE, LSN_OW_X, &CRicoh5A22::Copy_To_Operand_IncPc<LSN_RS_X>, &CRicoh5A22::Copy_To_Operand_IncPc<LSN_RS_X>, LSN_I_STX ); }
+		case 0xA4 : { return AddrMode_Access( LSN_AM_DIRECT_PAGE, LSN_AT_READ, LSN_OW_X, &CRicoh5A22::Ldy<true>, &CRicoh5A22::Ldy<false>, LSN_I_LDY ); }
+		case 0xAC : { return AddrMode_Access( LSN_AM_ABSOLUTE, LSN_AT_READ, LSN_OW_X, &CRicoh5A22::Ldy<true>, &CRicoh5A22::Ldy<false>, LSN_I_LDY ); }
+		case 0xB4 : { return AddrMode_Access( LSN_AM_DIRECT_PAGE_INDEXED_X, LSN_AT_READ, LSN_OW_X, &CRicoh5A22::Ldy<true>, &CRicoh5A22::Ldy<false>, LSN_I_LDY ); }
+		case 0xBC : { return AddrMode_Access( LSN_AM_ABSOLUTE_X, LSN_AT_READ, LSN_OW_X, &CRicoh5A22::Ldy<true>, &CRicoh5A22::Ldy<false>, LSN_I_LDY ); }
+		case 0xA6 : { return AddrMode_Access( LSN_AM_DIRECT_PAGE, LSN_AT_READ, LSN_OW_X, &CRicoh5A22::Ldx<true>, &CRicoh5A22::Ldx<false>, LSN_I_LDX ); }
+		case 0xAE : { return AddrMode_Access( LSN_AM_ABSOLUTE, LSN_AT_READ, LSN_OW_X, &CRicoh5A22::Ldx<true>, &CRicoh5A22::Ldx<false>, LSN_I_LDX ); }
+		case 0xB6 : { return AddrMode_Access( LSN_AM_DIRECT_PAGE_INDEXED_Y, LSN_AT_READ, LSN_OW_X, &CRicoh5A22::Ldx<true>, &CRicoh5A22::Ldx<false>, LSN_I_LDX ); }
+		case 0xBE : { return AddrMode_Access( LSN_AM_ABSOLUTE_Y, LSN_AT_READ, LSN_OW_X, &CRicoh5A22::Ldx<true>, &CRicoh5A22::Ldx<false>, LSN_I_LDX ); }
+		case 0xC4 : { return AddrMode_Access( LSN_AM_DIRECT_PAGE, LSN_AT_READ, LSN_OW_X, &CRicoh5A22::Cpy<true>, &CRicoh5A22::Cpy<false>, LSN_I_CPY ); }
+		case 0xCC : { return AddrMode_Access( LSN_AM_ABSOLUTE, LSN_AT_READ, LSN_OW_X, &CRicoh5A22::Cpy<true>, &CRicoh5A22::Cpy<false>, LSN_I_CPY ); }
+		case 0xE4 : { return AddrMode_Access( LSN_AM_DIRECT_PAGE, LSN_AT_READ, LSN_OW_X, &CRicoh5A22::Cpx<true>, &CRicoh5A22::Cpx<false>, LSN_I_CPX ); }
+		case 0xEC : { return AddrMode_Access( LSN_AM_ABSOLUTE, LSN_AT_READ, LSN_OW_X, &CRicoh5A22::Cpx<true>, &CRicoh5A22::Cpx<false>, LSN_I_CPX ); }
+	}
+
+	if ( ui8Cc == 0x0 && ui8Bbb == 0x4 ) {
+		// Branches (xxy10000): xx selects N, V, C, or Z, and y is the state on which to branch.
+		switch ( ui8Aaa ) {
+			case 0x0 : { return AddrMode_Relative( &CRicoh5A22::Branch_Phi2<N(), false>, LSN_I_BPL ); }
+			case 0x1 : { return AddrMode_Relative( &CRicoh5A22::Branch_Phi2<N(), true>, LSN_I_BMI ); }
+			case 0x2 : { return AddrMode_Relative( &CRicoh5A22::Branch_Phi2<V(), false>, LSN_I_BVC ); }
+			case 0x3 : { return AddrMode_Relative( &CRicoh5A22::Branch_Phi2<V(), true>, LSN_I_BVS ); }
+			case 0x4 : { return AddrMode_Relative( &CRicoh5A22::Branch_Phi2<C(), false>, LSN_I_BCC ); }
+			case 0x5 : { return AddrMode_Relative( &CRicoh5A22::Branch_Phi2<C(), true>, LSN_I_BCS ); }
+			case 0x6 : { return AddrMode_Relative( &CRicoh5A22::Branch_Phi2<Z(), false>, LSN_I_BNE ); }
+			case 0x7 : { return AddrMode_Relative( &CRicoh5A22::Branch_Phi2<Z(), true>, LSN_I_BEQ ); }
+		}
+	}
+
+	if ( ui8Cc == 0x1 || ui8Cc == 0x3 || (ui8Cc == 0x2 && ui8Bbb == 0x4) ) {
+		// Group 1: ORA, AND, EOR, ADC, STA, LDA, CMP, SBC.  cc=01 holds the 6502 modes, cc=11 the 65C816 long and stack-relative modes,
+		//	and aaa10010 the (Direct) mode.
+		LSN_ADDRESSING_MODES amMode = LSN_AM_DIRECT_PAGE_INDIRECT;
+		if ( ui8Cc == 0x1 ) {
+			constexpr LSN_ADDRESSING_MODES amModes[] = {
+				LSN_AM_INDIRECT_X, LSN_AM_DIRECT_PAGE, LSN_AM_IMMEDIATE, LSN_AM_ABSOLUTE,
+				LSN_AM_DIRECT_PAGE_INDIRECT_INDEXED_Y, LSN_AM_DIRECT_PAGE_INDEXED_X, LSN_AM_ABSOLUTE_Y, LSN_AM_ABSOLUTE_X,
+			};
+			amMode = amModes[ui8Bbb];
+		}
+		else if ( ui8Cc == 0x3 ) {
+			constexpr LSN_ADDRESSING_MODES amModes[] = {
+				LSN_AM_STACK_RELATIVE, LSN_AM_DIRECT_PAGE_INDIRECT_LONG, LSN_AM_IMPLIED, LSN_AM_ABSOLUTE_LONG,
+				LSN_AM_STACK_RELATIVE_INDIRECT_INDEXED_Y, LSN_AM_DIRECT_PAGE_INDIRECT_LONG_INDEXED_Y, LSN_AM_IMPLIED, LSN_AM_ABSOLUTE_LONG_X,
+			};
+			amMode = amModes[ui8Bbb];
+		}
+
+		if ( ui8Aaa == 0x4 ) {
+			return AddrMode_Access( amMode, LSN_AT_WRITE, LSN_OW_M, &CRicoh5A22::Copy_To_Operand_IncPc<LSN_RS_A>, &CRicoh5A22::Copy_To_Operand_IncPc<LSN_RS_A>, LSN_I_STA );
+		}
+
+		PfCycle pfOp8 = nullptr, pfOp16 = nullptr;
+		PfCycle pfImm8 = nullptr, pfImm16 = nullptr;
+		LSN_INSTRUCTIONS iInstr = LSN_I_ORA;
+		switch ( ui8Aaa ) {
+#define LSN_GROUP1( OP, INSTR )	pfOp8 = &CRicoh5A22::OP<true>; pfOp16 = &CRicoh5A22::OP<false>; pfImm8 = &CRicoh5A22::OP<true, true>; pfImm16 = &CRicoh5A22::OP<false, true>; iInstr = INSTR
+			case 0x0 : { LSN_GROUP1( Ora, LSN_I_ORA ); break; }
+			case 0x1 : { LSN_GROUP1( And, LSN_I_AND ); break; }
+			case 0x2 : { LSN_GROUP1( Eor, LSN_I_EOR ); break; }
+			case 0x3 : { LSN_GROUP1( Adc, LSN_I_ADC ); break; }
+			case 0x5 : { LSN_GROUP1( Lda, LSN_I_LDA ); break; }
+			case 0x6 : { LSN_GROUP1( Cmp, LSN_I_CMP ); break; }
+			case 0x7 : { LSN_GROUP1( Sbc, LSN_I_SBC ); break; }
+#undef LSN_GROUP1
+		}
+		if ( amMode == LSN_AM_IMMEDIATE ) {
+			return AddrMode_Immediate( pfImm8, pfImm16, LSN_OW_M, iInstr );
+		}
+		return AddrMode_Access( amMode, LSN_AT_READ, LSN_OW_M, pfOp8, pfOp16, iInstr );
+	}
+
+	if ( ui8Cc == 0x2 ) {
+		// Group 2 shifts and increments: ASL, ROL, LSR, ROR, DEC, INC.
+		constexpr LSN_INSTRUCTIONS iInstrs[] = { LSN_I_ASL, LSN_I_ROL, LSN_I_LSR, LSN_I_ROR, LSN_I_JAM, LSN_I_JAM, LSN_I_DEC, LSN_I_INC };
+		PfCycle pfOp8 = nullptr, pfOp16 = nullptr;
+		PfCycle pfA8 = nullptr, pfA16 = nullptr;
+		switch ( ui8Aaa ) {
+#define LSN_GROUP2( OP )		pfOp8 = &CRicoh5A22::OP<LSN_RS_OPERAND, true>; pfOp16 = &CRicoh5A22::OP<LSN_RS_OPERAND, false>; pfA8 = &CRicoh5A22::OP<LSN_RS_A, true>; pfA16 = &CRicoh5A22::OP<LSN_RS_A, false>
+			case 0x0 : { LSN_GROUP2( Asl ); break; }
+			case 0x1 : { LSN_GROUP2( Rol ); break; }
+			case 0x2 : { LSN_GROUP2( Lsr ); break; }
+			case 0x3 : { LSN_GROUP2( Ror ); break; }
+			case 0x6 : { LSN_GROUP2( Dec ); break; }
+			case 0x7 : { LSN_GROUP2( Inc ); break; }
+#undef LSN_GROUP2
+		}
+		if ( pfOp8 ) {
+			switch ( ui8Bbb ) {
+				case 0x1 : { return AddrMode_Access( LSN_AM_DIRECT_PAGE, LSN_AT_RMW, LSN_OW_M, pfOp8, pfOp16, iInstrs[ui8Aaa] ); }
+				case 0x2 : {
+					if ( ui8Aaa < 0x4 ) { return AddrMode_Implied( pfA8, pfA16, LSN_OW_M, iInstrs[ui8Aaa] ); }
+					break;
+				}
+				case 0x3 : { return AddrMode_Access( LSN_AM_ABSOLUTE, LSN_AT_RMW, LSN_OW_M, pfOp8, pfOp16, iInstrs[ui8Aaa] ); }
+				case 0x5 : { return AddrMode_Access( LSN_AM_DIRECT_PAGE_INDEXED_X, LSN_AT_RMW, LSN_OW_M, pfOp8, pfOp16, iInstrs[ui8Aaa] ); }
+				case 0x7 : { return AddrMode_Access( LSN_AM_ABSOLUTE_X, LSN_AT_RMW, LSN_OW_M, pfOp8, pfOp16, iInstrs[ui8Aaa] ); }
+			}
+		}
+	}
+
+	return Inst_Jam();
+}
+
+/**
+ * Generates the full instruction set.
+ *
+ * \return Returns all 256 instructions.
+ **/
+constexpr std::array<CRicoh5A22::LSN_INSTR, 256> CRicoh5A22::GenerateInstructionSet() {
+	std::array<LSN_INSTR, 256> aRet {};
+	for ( size_t I = 0; I < aRet.size(); ++I ) {
+		aRet[I] = GenerateInstruction( uint8_t( I ) );
+	}
+	return aRet;
+}
+
+constinit const std::array<CRicoh5A22::LSN_INSTR, 256> CRicoh5A22::m_iInstructionSet = CRicoh5A22::GenerateInstructionSet();		/**< The instruction set. */
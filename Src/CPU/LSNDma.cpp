@@ -0,0 +1,361 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: The 5A22's 8 DMA/HDMA channels ($420B, $420C, and $4300-$437F).
+ */
+
+
+#include "LSNDma.h"
+
+#include <algorithm>
+#include <cstring>
+
+
+namespace lsn {
+
+	// == Members.
+	/** The B-bus register offsets written by each transfer mode. */
+	const uint8_t CDma::m_ui8Patterns[8][4] = {
+		{ 0, 0, 0, 0 },								// 0: 1 register.
+		{ 0, 1, 0, 1 },								// 1: 2 registers.
+		{ 0, 0, 0, 0 },								// 2: 1 register, written twice.
+		{ 0, 0, 1, 1 },								// 3: 2 registers, each written twice.
+		{ 0, 1, 2, 3 },								// 4: 4 registers.
+		{ 0, 1, 0, 1 },								// 5: 2 registers, alternating.
+		{ 0, 0, 0, 0 },								// 6: Same as 2.
+		{ 0, 0, 1, 1 },								// 7: Same as 3.
+	};
+
+	/** The number of bytes in each transfer mode's unit (the number of bytes each HDMA scanline transfers). */
+	const uint8_t CDma::m_ui8PatternLengths[8] = { 1, 2, 2, 4, 4, 4, 2, 4 };
+
+	// == Functions.
+	/**
+	 * Resets the channels to their power-on state.
+	 **/
+	void CDma::Reset() {
+		for ( size_t I = 0; I < std::size( m_cChannels ); ++I ) {
+			m_cChannels[I] = LSN_CHANNEL();
+		}
+		m_ui8DmaPending = 0;
+		m_ui8HdmaEnabled = 0;
+		m_rCpu.ClearEventDeadline( CRicoh5A22::LSN_EV_DMA );
+	}
+
+	/**
+	 * Reads a channel register.
+	 *
+	 * \param _ui8Reg The register (the low byte of $43xx).
+	 * \param _ui8OpenBus The value returned by registers that do not exist.
+	 * \return Returns the register's value.
+	 **/
+	uint8_t CDma::ReadRegister( uint8_t _ui8Reg, uint8_t _ui8OpenBus ) const {
+		if ( _ui8Reg >= 0x80 ) { return _ui8OpenBus; }
+		const LSN_CHANNEL & cChannel = m_cChannels[_ui8Reg>>4];
+		switch ( _ui8Reg & 0x0F ) {
+			case 0x0 : { return cChannel.ui8Params; }
+			case 0x1 : { return cChannel.ui8BAddress; }
+			case 0x2 : { return uint8_t( cChannel.ui16AAddress ); }
+			case 0x3 : { return uint8_t( cChannel.ui16AAddress >> 8 ); }
+			case 0x4 : { return cChannel.ui8ABank; }
+			case 0x5 : { return uint8_t( cChannel.ui16Count ); }
+			case 0x6 : { return uint8_t( cChannel.ui16Count >> 8 ); }
+			case 0x7 : { return cChannel.ui8IndirectBank; }
+			case 0x8 : { return uint8_t( cChannel.ui16TableAddress ); }
+			case 0x9 : { return uint8_t( cChannel.ui16TableAddress >> 8 ); }
+			case 0xA : { return cChannel.ui8LineCounter; }
+			case 0xB : {}			LSN_FALLTHROUGH
+			case 0xF : { return cChannel.ui8Unused; }
+			default : { return _ui8OpenBus; }
+		}
+	}
+
+	/**
+	 * Writes a channel register.
+	 *
+	 * \param _ui8Reg The register (the low byte of $43xx).
+	 * \param _ui8Val The value to write.
+	 **/
+	void CDma::WriteRegister( uint8_t _ui8Reg, uint8_t _ui8Val ) {
+		if ( _ui8Reg >= 0x80 ) { return; }
+		LSN_CHANNEL & cChannel = m_cChannels[_ui8Reg>>4];
+		switch ( _ui8Reg & 0x0F ) {
+			case 0x0 : { cChannel.ui8Params = _ui8Val; break; }
+			case 0x1 : { cChannel.ui8BAddress = _ui8Val; break; }
+			case 0x2 : { cChannel.ui16AAddress = uint16_t( (cChannel.ui16AAddress & 0xFF00) | _ui8Val ); break; }
+			case 0x3 : { cChannel.ui16AAddress = uint16_t( (cChannel.ui16AAddress & 0x00FF) | (_ui8Val << 8) ); break; }
+			case 0x4 : { cChannel.ui8ABank = _ui8Val; break; }
+			case 0x5 : { cChannel.ui16Count = uint16_t( (cChannel.ui16Count & 0xFF00) | _ui8Val ); break; }
+			case 0x6 : { cChannel.ui16Count = uint16_t( (cChannel.ui16Count & 0x00FF) | (_ui8Val << 8) ); break; }
+			case 0x7 : { cChannel.ui8IndirectBank = _ui8Val; break; }
+			case 0x8 : { cChannel.ui16TableAddress = uint16_t( (cChannel.ui16TableAddress & 0xFF00) | _ui8Val ); break; }
+			case 0x9 : { cChannel.ui16TableAddress = uint16_t( (cChannel.ui16TableAddress & 0x00FF) | (_ui8Val << 8) ); break; }
+			case 0xA : { cChannel.ui8LineCounter = _ui8Val; break; }
+			case 0xB : {}			LSN_FALLTHROUGH
+			case 0xF : { cChannel.ui8Unused = _ui8Val; break; }
+			default : {}
+		}
+	}
+
+	/**
+	 * Writes MDMAEN ($420B), starting general DMA on the given channels at the end of the current CPU cycle.
+	 *
+	 * \param _ui8Val The channels to run, 1 bit per channel.
+	 **/
+	void CDma::WriteMdmaEn( uint8_t _ui8Val ) {
+		m_ui8DmaPending = _ui8Val;
+		if ( m_ui8DmaPending ) {
+			// The CPU stops at the end of the cycle doing this write.
+			m_rCpu.SetEventDeadline( CRicoh5A22::LSN_EV_DMA, m_rCpu.GetMasterCycles() );
+		}
+	}
+
+	/**
+	 * Runs every pending general-DMA channel in order and halts the CPU for the time taken: the start waits for the next multiple of
+	 *	LSN_DT_CLOCK (not at all if already on one), then LSN_DT_OVERHEAD, LSN_DT_PER_CHANNEL per channel, and LSN_DT_PER_BYTE per
+	 *	byte.  Called when the CPU stops at its LSN_EV_DMA deadline.
+	 *
+	 * \return Returns the number of master cycles for which the CPU was halted.
+	 **/
+	uint64_t CDma::RunDma() {
+		m_rCpu.ClearEventDeadline( CRicoh5A22::LSN_EV_DMA );
+		if ( !m_ui8DmaPending ) { return 0; }
+
+		const uint64_t ui64Start = m_rCpu.GetMasterCycles();
+		// A start that is already on the DMA clock does not wait a whole extra period.
+		const uint64_t ui64Align = (LSN_DT_CLOCK - (ui64Start & (LSN_DT_CLOCK - 1))) & (LSN_DT_CLOCK - 1);
+		uint64_t ui64Cycles = ui64Align + LSN_DT_OVERHEAD;
+		for ( size_t I = 0; I < std::size( m_cChannels ); ++I ) {
+			if ( m_ui8DmaPending & (1 << I) ) {
+				ui64Cycles += LSN_DT_PER_CHANNEL + uint64_t( TransferChannel( m_cChannels[I] ) ) * LSN_DT_PER_BYTE;
+			}
+		}
+		m_ui8DmaPending = 0;
+		return m_rCpu.Stall( ui64Cycles );
+	}
+
+	/**
+	 * Starts HDMA for a frame: loads the first line counter (and indirect address) of each channel enabled in HDMAEN.  Called at the
+	 *	start of each frame.
+	 *
+	 * \return Returns the number of master cycles for which the CPU was halted.
+	 **/
+	uint64_t CDma::InitHdma() {
+		for ( size_t I = 0; I < std::size( m_cChannels ); ++I ) {
+			m_cChannels[I].bDoTransfer = false;
+			m_cChannels[I].bTerminated = true;
+		}
+		if ( !m_ui8HdmaEnabled ) { return 0; }
+
+		uint64_t ui64Cycles = LSN_DT_HDMA_OVERHEAD;
+		for ( size_t I = 0; I < std::size( m_cChannels ); ++I ) {
+			if ( m_ui8HdmaEnabled & (1 << I) ) {
+				LSN_CHANNEL & cChannel = m_cChannels[I];
+				cChannel.ui16TableAddress = cChannel.ui16AAddress;
+				cChannel.bTerminated = false;
+				ui64Cycles += LoadHdmaEntry( cChannel );
+			}
+		}
+		return m_rCpu.Stall( ui64Cycles );
+	}
+
+	/**
+	 * Runs 1 scanline of HDMA on each enabled channel whose table has not ended.  Called at the start of each visible scanline's
+	 *	horizontal blank.
+	 *
+	 * \return Returns the number of master cycles for which the CPU was halted.
+	 **/
+	uint64_t CDma::RunHdma() {
+		uint8_t ui8Active = 0;
+		for ( size_t I = 0; I < std::size( m_cChannels ); ++I ) {
+			if ( (m_ui8HdmaEnabled & (1 << I)) && !m_cChannels[I].bTerminated ) { ui8Active |= uint8_t( 1 << I ); }
+		}
+		if ( !ui8Active ) { return 0; }
+
+		uint64_t ui64Cycles = LSN_DT_HDMA_OVERHEAD;
+		for ( size_t I = 0; I < std::size( m_cChannels ); ++I ) {
+			if ( ui8Active & (1 << I) ) {
+				LSN_CHANNEL & cChannel = m_cChannels[I];
+				ui64Cycles += LSN_DT_PER_CHANNEL;
+				if ( cChannel.bDoTransfer ) {
+					ui64Cycles += uint64_t( TransferHdmaUnit( cChannel ) ) * LSN_DT_PER_BYTE;
+				}
+			}
+		}
+		for ( size_t I = 0; I < std::size( m_cChannels ); ++I ) {
+			if ( ui8Active & (1 << I) ) {
+				LSN_CHANNEL & cChannel = m_cChannels[I];
+				--cChannel.ui8LineCounter;
+				// Bit 7 is the repeat flag: transfer on every line of the entry instead of only its first.
+				cChannel.bDoTransfer = (cChannel.ui8LineCounter & 0x80) != 0;
+				if ( (cChannel.ui8LineCounter & 0x7F) == 0 ) {
+					ui64Cycles += LoadHdmaEntry( cChannel );
+				}
+			}
+		}
+		return m_rCpu.Stall( ui64Cycles );
+	}
+
+	/**
+	 * Runs 1 channel's general DMA to completion.
+	 *
+	 * \param _cChannel The channel.
+	 * \return Returns the number of bytes transferred.
+	 **/
+	uint32_t CDma::TransferChannel( LSN_CHANNEL &_cChannel ) {
+		const uint32_t ui32Size = _cChannel.ui16Count ? _cChannel.ui16Count : 0x10000;
+		const uint8_t ui8Mode = _cChannel.ui8Params & LSN_DMAP_MODE_MASK;
+		const uint8_t * pui8Pattern = m_ui8Patterns[ui8Mode];
+		const uint8_t ui8PatternLen = m_ui8PatternLengths[ui8Mode];
+		const int32_t i32Step = (_cChannel.ui8Params & LSN_DMAP_FIXED) ? 0 :
+			((_cChannel.ui8Params & LSN_DMAP_DECREMENT) ? -1 : 1);
+		_cChannel.ui16Count = 0;
+
+		if ( !(_cChannel.ui8Params & LSN_DMAP_B_TO_A) && i32Step >= 0 && CanCopyBlock( _cChannel, ui32Size ) ) {
+			if ( i32Step == 0 ) {
+				std::memset( m_ui8Buffer, ReadA( _cChannel.ui8ABank, _cChannel.ui16AAddress ), ui32Size );
+			}
+			else {
+				m_baBusA.ReadSpan<CBusA::LSN_W_BANK>( _cChannel.ui16AAddress, _cChannel.ui8ABank, m_ui8Buffer, ui32Size );
+				_cChannel.ui16AAddress = uint16_t( _cChannel.ui16AAddress + ui32Size );
+			}
+			m_bbBusB.WriteSpan( _cChannel.ui8BAddress, m_ui8Buffer, ui32Size, pui8Pattern, ui8PatternLen );
+			return ui32Size;
+		}
+
+		for ( uint32_t I = 0; I < ui32Size; ++I ) {
+			const uint8_t ui8Reg = uint8_t( _cChannel.ui8BAddress + pui8Pattern[I&(ui8PatternLen-1)] );
+			if ( _cChannel.ui8Params & LSN_DMAP_B_TO_A ) {
+				WriteA( _cChannel.ui8ABank, _cChannel.ui16AAddress, m_bbBusB.Read( ui8Reg, m_baBusA.DataBus() ) );
+			}
+			else {
+				m_bbBusB.Write( ui8Reg, ReadA( _cChannel.ui8ABank, _cChannel.ui16AAddress ) );
+			}
+			_cChannel.ui16AAddress = uint16_t( _cChannel.ui16AAddress + i32Step );
+		}
+		return ui32Size;
+	}
+
+	/**
+	 * Determines whether a general DMA can be done as a block copy: every A-bus page it touches is plain memory.
+	 *
+	 * \param _cChannel The channel.
+	 * \param _ui32Size The number of bytes to transfer.
+	 * \return Returns true if the block copy can be used.
+	 **/
+	bool CDma::CanCopyBlock( const LSN_CHANNEL &_cChannel, uint32_t _ui32Size ) const {
+		const uint32_t ui32Bytes = (_cChannel.ui8Params & LSN_DMAP_FIXED) ? 1 : _ui32Size;
+		// The address wraps within the bank, so at most 256 pages are touched.
+		const uint32_t ui32Pages = std::min<uint32_t>( ((_cChannel.ui16AAddress & 0xFF) + ui32Bytes + 0xFF) >> 8, 0x100 );
+		for ( uint32_t I = 0; I < ui32Pages; ++I ) {
+			const uint8_t ui8Page = uint8_t( (_cChannel.ui16AAddress >> 8) + I );
+			if ( !IsABusReachable( _cChannel.ui8ABank, uint16_t( ui8Page << 8 ) ) ) { return false; }
+			if ( !m_baBusA.IsPlainMemory( uint16_t( (_cChannel.ui8ABank << 8) | ui8Page ) ) ) { return false; }
+		}
+		return true;
+	}
+
+	/**
+	 * Transfers 1 HDMA unit for a channel.
+	 *
+	 * \param _cChannel The channel.
+	 * \return Returns the number of bytes transferred.
+	 **/
+	uint32_t CDma::TransferHdmaUnit( LSN_CHANNEL &_cChannel ) {
+		const uint8_t ui8Mode = _cChannel.ui8Params & LSN_DMAP_MODE_MASK;
+		const uint8_t * pui8Pattern = m_ui8Patterns[ui8Mode];
+		const uint8_t ui8PatternLen = m_ui8PatternLengths[ui8Mode];
+		const bool bIndirect = (_cChannel.ui8Params & LSN_DMAP_INDIRECT) != 0;
+		const uint8_t ui8Bank = bIndirect ? _cChannel.ui8IndirectBank : _cChannel.ui8ABank;
+		uint16_t & ui16Address = bIndirect ? _cChannel.ui16Count : _cChannel.ui16TableAddress;
+		for ( uint8_t I = 0; I < ui8PatternLen; ++I ) {
+			const uint8_t ui8Reg = uint8_t( _cChannel.ui8BAddress + pui8Pattern[I] );
+			if ( _cChannel.ui8Params & LSN_DMAP_B_TO_A ) {
+				WriteA( ui8Bank, ui16Address, m_bbBusB.Read( ui8Reg, m_baBusA.DataBus() ) );
+			}
+			else {
+				m_bbBusB.Write( ui8Reg, ReadA( ui8Bank, ui16Address ) );
+			}
+			++ui16Address;
+		}
+		return ui8PatternLen;
+	}
+
+	/**
+	 * Loads a channel's next HDMA line counter (and indirect address) from its table.
+	 *
+	 * \param _cChannel The channel.
+	 * \return Returns the number of master cycles taken.
+	 **/
+	uint32_t CDma::LoadHdmaEntry( LSN_CHANNEL &_cChannel ) {
+		uint32_t ui32Cycles = LSN_DT_PER_BYTE;
+		_cChannel.ui8LineCounter = ReadA( _cChannel.ui8ABank, _cChannel.ui16TableAddress++ );
+		if ( _cChannel.ui8Params & LSN_DMAP_INDIRECT ) {
+			const uint8_t ui8Lo = ReadA( _cChannel.ui8ABank, _cChannel.ui16TableAddress++ );
+			const uint8_t ui8Hi = ReadA( _cChannel.ui8ABank, _cChannel.ui16TableAddress++ );
+			_cChannel.ui16Count = uint16_t( ui8Lo | (ui8Hi << 8) );
+			ui32Cycles += 2 * LSN_DT_PER_BYTE;
+		}
+		_cChannel.bDoTransfer = true;
+		_cChannel.bTerminated = _cChannel.ui8LineCounter == 0;
+		return ui32Cycles;
+	}
+
+	/**
+	 * Routes $4300-$43FF in banks $00-$3F and $80-$BF of a memory map to the DMA registers.  $420B and $420C reach WriteMdmaEn()
+	 *	and WriteHdmaEn() through CCpuIo.  Each Bus A that uses the map must then be attached with Attach().
+	 *
+	 * \param _mmMap The memory map to modify.
+	 **/
+	void CDma::ApplyMapping( CMemoryMap &_mmMap ) {
+		for ( uint32_t ui32Bank = 0; ui32Bank < 0x100; ++ui32Bank ) {
+			if ( (ui32Bank & 0x7F) >= 0x40 ) { continue; }
+			_mmMap.SetAccessor( uint16_t( (ui32Bank << 8) | 0x43 ), &CDma::BusARead, nullptr, &CDma::BusAWrite, nullptr,
+				&CDma::BusADebugRead, nullptr );
+		}
+	}
+
+	/**
+	 * The Bus A reader for $43xx.
+	 *
+	 * \param _rfpParms The read parameters.  pvParm0 points to the CDma, or is nullptr if none has been attached.
+	 * \param _ui8Ret Holds the read value on return.
+	 * \param _ui8OpenMask Holds the mask of bits driven by the register on return.
+	 **/
+	void LSN_FASTCALL CDma::BusARead( const CMemoryMap::LSN_ACCESSFUNCPARMS &_rfpParms, uint8_t &_ui8Ret, uint8_t &_ui8OpenMask ) {
+		const CDma * pdThis = static_cast<const CDma *>(_rfpParms.pvParm0);
+		if LSN_UNLIKELY( !pdThis || (_rfpParms.ui16Address & 0xFF) >= 0x80 ) {
+			_ui8OpenMask = 0;
+			return;
+		}
+		_ui8Ret = pdThis->ReadRegister( uint8_t( _rfpParms.ui16Address ), _ui8Ret );
+	}
+
+	/**
+	 * The Bus A writer for $43xx.
+	 *
+	 * \param _rfpParms The write parameters.  pvParm0 points to the CDma, or is nullptr if none has been attached.
+	 * \param _ui8Val The value to write.
+	 **/
+	void LSN_FASTCALL CDma::BusAWrite( const CMemoryMap::LSN_ACCESSFUNCPARMS &_rfpParms, uint8_t _ui8Val ) {
+		CDma * pdThis = static_cast<CDma *>(_rfpParms.pvParm0);
+		if LSN_UNLIKELY( !pdThis ) { return; }
+		pdThis->WriteRegister( uint8_t( _rfpParms.ui16Address ), _ui8Val );
+	}
+
+	/**
+	 * The Bus A debug reader for $43xx.
+	 *
+	 * \param _rfpParms The read parameters.  pvParm0 points to the CDma, or is nullptr if none has been attached.
+	 * \param _ui8Ret Holds the read value on return.
+	 **/
+	void LSN_FASTCALL CDma::BusADebugRead( const CMemoryMap::LSN_ACCESSFUNCPARMS &_rfpParms, uint8_t &_ui8Ret ) {
+		const CDma * pdThis = static_cast<const CDma *>(_rfpParms.pvParm0);
+		if ( pdThis ) {
+			_ui8Ret = pdThis->ReadRegister( uint8_t( _rfpParms.ui16Address ), _ui8Ret );
+		}
+	}
+
+}	// namespace lsn
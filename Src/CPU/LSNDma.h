@@ -0,0 +1,311 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: The 5A22's 8 DMA/HDMA channels ($420B, $420C, and $4300-$437F).
+ */
+
+#pragma once
+
+#include "../LSNBirdSNES.h"
+#include "../Bus/LSNBusA.h"
+#include "../Bus/LSNBusB.h"
+#include "../Bus/LSNMemoryMap.h"
+#include "LSNRicoh5A22.h"
+
+#include <cstdint>
+
+
+namespace lsn {
+
+	/**
+	 * Class CDma
+	 * \brief The 5A22's 8 DMA/HDMA channels.
+	 *
+	 * Description: The 5A22's 8 DMA/HDMA channels ($420B, $420C, and $4300-$437F).  General DMA starts once the CPU finishes the cycle
+	 *	that writes $420B, so a write to $420B only registers a CRicoh5A22::LSN_EV_DMA deadline at the CPU's current time; the CPU stops at
+	 *	that cycle boundary and whoever is running it calls RunDma(), which performs every pending transfer and then stalls the CPU for
+	 *	exactly as long as the transfers took.  InitHdma() and RunHdma() are called the same way at the start of each frame and each
+	 *	visible scanline.
+	 * A general DMA from A-bus memory to a group of B-bus ports that accept spans (see CBusB::WriteSpan()) is done as 1 block copy; any
+	 *	other transfer goes 1 byte at a time through the buses.  Both paths take the same number of cycles.
+	 */
+	class CDma {
+	public :
+		CDma( CRicoh5A22 &_rCpu, CBusA &_baBusA, CBusB &_bbBusB ) :
+			m_rCpu( _rCpu ),
+			m_baBusA( _baBusA ),
+			m_bbBusB( _bbBusB ) {
+		}
+
+
+		// == Enumerations.
+		/** DMAPx ($43x0) bits. */
+		enum LSN_DMAP : uint8_t {
+			LSN_DMAP_MODE_MASK							= 0x07,								/**< The transfer mode (the B-bus register pattern). */
+			LSN_DMAP_FIXED								= 0x08,								/**< The A-bus address does not change. */
+			LSN_DMAP_DECREMENT							= 0x10,								/**< The A-bus address decrements instead of incrementing. */
+			LSN_DMAP_INDIRECT							= 0x40,								/**< HDMA: the table holds pointers to the data instead of the data. */
+			LSN_DMAP_B_TO_A								= 0x80,								/**< Transfer from the B bus to the A bus. */
+		};
+
+		/** Transfer timing, in master cycles. */
+		enum LSN_DMA_TIMING : uint32_t {
+			LSN_DT_CLOCK								= 8,								/**< General DMA starts on a multiple of this. */
+			LSN_DT_OVERHEAD								= 8,								/**< General DMA's fixed start-up cost, after the alignment. */
+			LSN_DT_PER_CHANNEL							= 8,								/**< The cost of each channel that runs. */
+			LSN_DT_PER_BYTE								= 8,								/**< The cost of each byte transferred (including HDMA table reads). */
+			LSN_DT_HDMA_OVERHEAD						= 18,								/**< HDMA's fixed cost per frame initialization or scanline. */
+		};
+
+
+		// == Types.
+		/** A channel's registers and HDMA state. */
+		struct LSN_CHANNEL {
+			uint8_t										ui8Params = 0xFF;					/**< DMAPx ($43x0). */
+			uint8_t										ui8BAddress = 0xFF;					/**< BBADx ($43x1): the B-bus register. */
+			uint16_t									ui16AAddress = 0xFFFF;				/**< A1TxL/A1TxH ($43x2-$43x3): the A-bus address (or HDMA table start). */
+			uint8_t										ui8ABank = 0xFF;					/**< A1Bx ($43x4): the A-bus bank (or HDMA table bank). */
+			uint16_t									ui16Count = 0xFFFF;					/**< DASxL/DASxH ($43x5-$43x6): the DMA byte count (or HDMA indirect address). */
+			uint8_t										ui8IndirectBank = 0xFF;				/**< DASBx ($43x7): the HDMA indirect bank. */
+			uint16_t									ui16TableAddress = 0xFFFF;			/**< A2AxL/A2AxH ($43x8-$43x9): the HDMA table address. */
+			uint8_t										ui8LineCounter = 0xFF;				/**< NTRLx ($43xA): the HDMA line counter. */
+			uint8_t										ui8Unused = 0xFF;					/**< UNUSEDx ($43xB/$43xF): read/write with no effect. */
+			bool										bDoTransfer = false;				/**< HDMA: transfer on the next scanline. */
+			bool										bTerminated = true;					/**< HDMA: the table has ended for this frame. */
+		};
+
+
+		// == Functions.
+		/**
+		 * Resets the channels to their power-on state.
+		 **/
+		void											Reset();
+
+		/**
+		 * Reads a channel register.
+		 *
+		 * \param _ui8Reg The register (the low byte of $43xx).
+		 * \param _ui8OpenBus The value returned by registers that do not exist.
+		 * \return Returns the register's value.
+		 **/
+		uint8_t											ReadRegister( uint8_t _ui8Reg, uint8_t _ui8OpenBus ) const;
+
+		/**
+		 * Writes a channel register.
+		 *
+		 * \param _ui8Reg The register (the low byte of $43xx).
+		 * \param _ui8Val The value to write.
+		 **/
+		void											WriteRegister( uint8_t _ui8Reg, uint8_t _ui8Val );
+
+		/**
+		 * Writes MDMAEN ($420B), starting general DMA on the given channels at the end of the current CPU cycle.
+		 *
+		 * \param _ui8Val The channels to run, 1 bit per channel.
+		 **/
+		void											WriteMdmaEn( uint8_t _ui8Val );
+
+		/**
+		 * Writes HDMAEN ($420C).
+		 *
+		 * \param _ui8Val The channels to use for HDMA, 1 bit per channel.
+		 **/
+		inline void										WriteHdmaEn( uint8_t _ui8Val ) { m_ui8HdmaEnabled = _ui8Val; }
+
+		/**
+		 * Gets HDMAEN ($420C).
+		 *
+		 * \return Returns the channels used for HDMA, 1 bit per channel.
+		 **/
+		inline uint8_t									HdmaEnabled() const { return m_ui8HdmaEnabled; }
+
+		/**
+		 * Determines whether RunHdma() has anything to do: some channel enabled in HDMAEN has not reached the end of its table.
+		 *
+		 * \return Returns true if any HDMA channel is still running this frame.
+		 **/
+		inline bool										HdmaActive() const {
+			for ( size_t I = 0; I < std::size( m_cChannels ); ++I ) {
+				if ( (m_ui8HdmaEnabled & (1 << I)) && !m_cChannels[I].bTerminated ) { return true; }
+			}
+			return false;
+		}
+
+		/**
+		 * Gets the channels waiting for general DMA.
+		 *
+		 * \return Returns the channels written to MDMAEN that have not yet run, 1 bit per channel.
+		 **/
+		inline uint8_t									PendingDma() const { return m_ui8DmaPending; }
+
+		/**
+		 * Runs every pending general-DMA channel in order and halts the CPU for the time taken: the start waits for the next multiple of
+		 *	LSN_DT_CLOCK (not at all if already on one), then LSN_DT_OVERHEAD, LSN_DT_PER_CHANNEL per channel, and LSN_DT_PER_BYTE per
+		 *	byte.  Called when the CPU stops at its LSN_EV_DMA deadline.
+		 *
+		 * \return Returns the number of master cycles for which the CPU was halted.
+		 **/
+		uint64_t										RunDma();
+
+		/**
+		 * Starts HDMA for a frame: loads the first line counter (and indirect address) of each channel enabled in HDMAEN.  Called at the
+		 *	start of each frame.
+		 *
+		 * \return Returns the number of master cycles for which the CPU was halted.
+		 **/
+		uint64_t										InitHdma();
+
+		/**
+		 * Runs 1 scanline of HDMA on each enabled channel whose table has not ended.  Called at the start of each visible scanline's
+		 *	horizontal blank.
+		 *
+		 * \return Returns the number of master cycles for which the CPU was halted.
+		 **/
+		uint64_t										RunHdma();
+
+		/**
+		 * Gets a channel.
+		 *
+		 * \param _sIdx The channel index (0-7).
+		 * \return Returns the channel.
+		 **/
+		inline const LSN_CHANNEL &						Channel( size_t _sIdx ) const { return m_cChannels[_sIdx]; }
+
+		/**
+		 * Routes $4300-$43FF in banks $00-$3F and $80-$BF of a memory map to the DMA registers.  $420B and $420C reach WriteMdmaEn()
+		 *	and WriteHdmaEn() through CCpuIo.  Each Bus A that uses the map must then be attached with Attach().
+		 *
+		 * \param _mmMap The memory map to modify.
+		 **/
+		static void										ApplyMapping( CMemoryMap &_mmMap );
+
+		/**
+		 * Attaches the DMA registers to the Bus A passed to the constructor, whose memory map was set up by ApplyMapping().  Must be
+		 *	called again after the Bus A's memory map changes.
+		 **/
+		void											Attach() {
+			m_baBusA.BindParm( &CDma::BusARead, &CDma::BusAWrite, this );
+		}
+
+
+	protected :
+		// == Members.
+		CRicoh5A22 &									m_rCpu;								/**< The CPU halted by transfers. */
+		CBusA &											m_baBusA;							/**< The A bus. */
+		CBusB &											m_bbBusB;							/**< The B bus. */
+		LSN_CHANNEL										m_cChannels[8];						/**< The channels. */
+		uint8_t											m_ui8DmaPending = 0;				/**< The channels waiting for general DMA. */
+		uint8_t											m_ui8HdmaEnabled = 0;				/**< HDMAEN. */
+		uint8_t											m_ui8Buffer[0x10000];				/**< The staging buffer for block transfers. */
+
+		/** The B-bus register offsets written by each transfer mode. */
+		static const uint8_t							m_ui8Patterns[8][4];
+
+		/** The number of bytes in each transfer mode's unit (the number of bytes each HDMA scanline transfers). */
+		static const uint8_t							m_ui8PatternLengths[8];
+
+
+		// == Functions.
+		/**
+		 * Runs 1 channel's general DMA to completion.
+		 *
+		 * \param _cChannel The channel.
+		 * \return Returns the number of bytes transferred.
+		 **/
+		uint32_t										TransferChannel( LSN_CHANNEL &_cChannel );
+
+		/**
+		 * Determines whether a general DMA can be done as a block copy: every A-bus page it touches is plain memory.
+		 *
+		 * \param _cChannel The channel.
+		 * \param _ui32Size The number of bytes to transfer.
+		 * \return Returns true if the block copy can be used.
+		 **/
+		bool											CanCopyBlock( const LSN_CHANNEL &_cChannel, uint32_t _ui32Size ) const;
+
+		/**
+		 * Transfers 1 HDMA unit for a channel.
+		 *
+		 * \param _cChannel The channel.
+		 * \return Returns the number of bytes transferred.
+		 **/
+		uint32_t										TransferHdmaUnit( LSN_CHANNEL &_cChannel );
+
+		/**
+		 * Loads a channel's next HDMA line counter (and indirect address) from its table.
+		 *
+		 * \param _cChannel The channel.
+		 * \return Returns the number of master cycles taken.
+		 **/
+		uint32_t										LoadHdmaEntry( LSN_CHANNEL &_cChannel );
+
+		/**
+		 * Reads a byte from the A bus for DMA.  The A bus cannot reach the B bus or the DMA registers, which read as open bus.
+		 *
+		 * \param _ui8Bank The bank.
+		 * \param _ui16Address The address within the bank.
+		 * \return Returns the byte read.
+		 **/
+		inline uint8_t									ReadA( uint8_t _ui8Bank, uint16_t _ui16Address ) {
+			if LSN_UNLIKELY( !IsABusReachable( _ui8Bank, _ui16Address ) ) { return m_baBusA.DataBus(); }
+			uint8_t ui8Speed;
+			return m_baBusA.Read<LSN_AS_DMA>( _ui16Address, _ui8Bank, ui8Speed );
+		}
+
+		/**
+		 * Writes a byte to the A bus for DMA.  Writes to the B bus or the DMA registers are ignored.
+		 *
+		 * \param _ui8Bank The bank.
+		 * \param _ui16Address The address within the bank.
+		 * \param _ui8Val The value to write.
+		 **/
+		inline void										WriteA( uint8_t _ui8Bank, uint16_t _ui16Address, uint8_t _ui8Val ) {
+			if LSN_UNLIKELY( !IsABusReachable( _ui8Bank, _ui16Address ) ) { return; }
+			uint8_t ui8Speed;
+			m_baBusA.Write<LSN_AS_DMA>( _ui16Address, _ui8Bank, _ui8Val, ui8Speed );
+		}
+
+		/**
+		 * Determines whether DMA's A-bus side can reach an address.  $2100-$21FF, $4200-$421F, and $4300-$437F in banks $00-$3F and
+		 *	$80-$BF cannot be reached.
+		 *
+		 * \param _ui8Bank The bank.
+		 * \param _ui16Address The address within the bank.
+		 * \return Returns true if the address can be reached.
+		 **/
+		static inline bool								IsABusReachable( uint8_t _ui8Bank, uint16_t _ui16Address ) {
+			if ( _ui8Bank & 0x40 ) { return true; }
+			return !((_ui16Address >= 0x2100 && _ui16Address < 0x2200) ||
+				(_ui16Address >= 0x4200 && _ui16Address < 0x4220) ||
+				(_ui16Address >= 0x4300 && _ui16Address < 0x4380));
+		}
+
+		/**
+		 * The Bus A reader for $43xx.
+		 *
+		 * \param _rfpParms The read parameters.  pvParm0 points to the CDma, or is nullptr if none has been attached.
+		 * \param _ui8Ret Holds the read value on return.
+		 * \param _ui8OpenMask Holds the mask of bits driven by the register on return.
+		 **/
+		static void LSN_FASTCALL						BusARead( const CMemoryMap::LSN_ACCESSFUNCPARMS &_rfpParms, uint8_t &_ui8Ret, uint8_t &_ui8OpenMask );
+
+		/**
+		 * The Bus A writer for $43xx.
+		 *
+		 * \param _rfpParms The write parameters.  pvParm0 points to the CDma, or is nullptr if none has been attached.
+		 * \param _ui8Val The value to write.
+		 **/
+		static void LSN_FASTCALL						BusAWrite( const CMemoryMap::LSN_ACCESSFUNCPARMS &_rfpParms, uint8_t _ui8Val );
+
+		/**
+		 * The Bus A debug reader for $43xx.
+		 *
+		 * \param _rfpParms The read parameters.  pvParm0 points to the CDma, or is nullptr if none has been attached.
+		 * \param _ui8Ret Holds the read value on return.
+		 **/
+		static void LSN_FASTCALL						BusADebugRead( const CMemoryMap::LSN_ACCESSFUNCPARMS &_rfpParms, uint8_t &_ui8Ret );
+	};
+
+}	// namespace lsn
@@ -0,0 +1,595 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: A minimal x86-64 code emitter and executable-memory arena for the 5A22 dynamic recompiler.
+ */
+
+#include "LSNJitX64.h"
+
+#if LSN_JIT_X64_SUPPORTED
+
+#include <algorithm>
+#include <cstring>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <unistd.h>
+#endif	// #ifndef _WIN32
+
+
+namespace lsn {
+
+	CJitX64::CJitX64() {
+	}
+	CJitX64::~CJitX64() {
+		Free();
+	}
+
+	// == Functions.
+	/**
+	 * Allocates the executable arena.  Any previously allocated arena is freed.
+	 *
+	 * \param _sSize The size of the arena in bytes.
+	 * \return Returns true if the arena was allocated.
+	 **/
+	bool CJitX64::Init( size_t _sSize ) {
+		Free();
+		// The arena is never writable and executable at once: finished code is flipped to read/execute, and only the page being emitted
+		//	into (and the unused rest of the arena) is read/write.
+#ifdef _WIN32
+		SYSTEM_INFO siInfo;
+		::GetSystemInfo( &siInfo );
+		m_sPageSize = siInfo.dwPageSize;
+		void * pvMem = ::VirtualAlloc( NULL, _sSize, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE );
+		if ( !pvMem ) { return false; }
+#else
+		m_sPageSize = size_t( ::sysconf( _SC_PAGESIZE ) );
+		int iFlags = MAP_PRIVATE | MAP_ANONYMOUS;
+#ifdef __APPLE__
+		iFlags |= MAP_JIT;
+#endif	// #ifdef __APPLE__
+		void * pvMem = ::mmap( nullptr, _sSize, PROT_READ | PROT_WRITE, iFlags, -1, 0 );
+		if ( pvMem == MAP_FAILED ) { return false; }
+#endif	// #ifdef _WIN32
+		m_pui8Code = static_cast<uint8_t *>(pvMem);
+		m_sSize = _sSize;
+#ifdef _WIN32
+		// Every function has the same prologue and keeps the same frame until its epilogue, so one entry covering the whole arena lets
+		//	exceptions (and debuggers) unwind through translated code.
+		static const uint8_t ui8UnwindInfo[] = {
+			0x01,										// Version 1, no flags.
+			0x05,										// Size of prologue.
+			0x02,										// Count of codes.
+			0x00,										// No frame register.
+			0x05, 0x32,									// After SUB RSP, 32: UWOP_ALLOC_SMALL, (32 / 8) - 1.
+			0x01, 0x30,									// After PUSH RBX: UWOP_PUSH_NONVOL, RBX.
+		};
+		std::memcpy( m_pui8Code, ui8UnwindInfo, sizeof( ui8UnwindInfo ) );
+		m_rfFunctionTable.BeginAddress = DWORD( LSN_CODE_START );
+		m_rfFunctionTable.EndAddress = DWORD( m_sSize );
+		m_rfFunctionTable.UnwindData = 0;
+		if ( !::RtlAddFunctionTable( &m_rfFunctionTable, 1, reinterpret_cast<DWORD64>(m_pui8Code) ) ) {
+			Free();
+			return false;
+		}
+#endif	// #ifdef _WIN32
+		Reset();
+		return true;
+	}
+
+	/**
+	 * Frees the executable arena.
+	 **/
+	void CJitX64::Free() {
+		if ( m_pui8Code ) {
+#ifdef _WIN32
+			::RtlDeleteFunctionTable( &m_rfFunctionTable );
+			::VirtualFree( m_pui8Code, 0, MEM_RELEASE );
+#else
+			::munmap( m_pui8Code, m_sSize );
+#endif	// #ifdef _WIN32
+			m_pui8Code = nullptr;
+		}
+		m_sSize = 0;
+		Reset();
+	}
+
+	/**
+	 * Discards all emitted code, keeping the arena.  Every pointer previously returned by EndFunction() becomes invalid.
+	 **/
+	void CJitX64::Reset() {
+		if ( Valid() ) { Protect( 0, m_sUsed, false ); }
+		m_sUsed = m_sCur = LSN_CODE_START;
+		m_vLabels.clear();
+		m_vFixups.clear();
+		m_bOverflow = false;
+	}
+
+	/**
+	 * Begins a new function and emits its prologue.
+	 **/
+	void CJitX64::BeginFunction() {
+		m_sCur = m_sUsed;
+		m_vLabels.clear();
+		m_vFixups.clear();
+		m_bOverflow = !Valid();
+		m_lExit = NewLabel();
+		// The last finished function may share its page with this one.
+		if ( !m_bOverflow && !Protect( m_sUsed, m_sUsed, false ) ) { m_bOverflow = true; }
+
+		// On entry RSP is 8 off a 16-byte boundary.  Pushing RBX re-aligns it, and the 32 bytes are the Win64 shadow space (harmless on System V).
+		Emit8( 0x53 );									// PUSH RBX
+		Emit8( 0x48 ); Emit8( 0x83 ); Emit8( 0xEC ); Emit8( 0x20 );	// SUB RSP, 32
+#ifdef _WIN32
+		Emit8( 0x48 ); Emit8( 0x89 ); Emit8( 0xCB );	// MOV RBX, RCX
+#else
+		Emit8( 0x48 ); Emit8( 0x89 ); Emit8( 0xFB );	// MOV RBX, RDI
+#endif	// #ifdef _WIN32
+	}
+
+	/**
+	 * Binds the exit label, emits the epilogue, and resolves all jumps.
+	 *
+	 * \return Returns the entry point of the function, or nullptr if the arena overflowed (in which case nothing is kept).
+	 **/
+	CJitX64::PfFunc CJitX64::EndFunction() {
+		Bind( m_lExit );
+		Emit8( 0x48 ); Emit8( 0x83 ); Emit8( 0xC4 ); Emit8( 0x20 );	// ADD RSP, 32
+		Emit8( 0x5B );									// POP RBX
+		Emit8( 0xC3 );									// RET
+		if ( m_bOverflow ) {
+			if ( Valid() ) { Protect( m_sUsed, m_sUsed, true ); }
+			return nullptr;
+		}
+
+		for ( size_t I = 0; I < m_vFixups.size(); ++I ) {
+			size_t sTarget = m_vLabels[m_vFixups[I].lLabel];
+			if ( sTarget == SIZE_MAX ) {
+				Protect( m_sUsed, m_sUsed, true );
+				return nullptr;
+			}
+			int32_t i32Rel = int32_t( int64_t( sTarget ) - int64_t( m_vFixups[I].sPos + 4 ) );
+			for ( size_t J = 0; J < 4; ++J ) {
+				m_pui8Code[m_vFixups[I].sPos+J] = uint8_t( uint32_t( i32Rel ) >> (J * 8) );
+			}
+		}
+
+		PfFunc pfRet = reinterpret_cast<PfFunc>(m_pui8Code + m_sUsed);
+		if ( !Protect( m_sUsed, m_sCur, true ) ) { return nullptr; }
+		// Keep functions 16-byte aligned.
+		m_sUsed = std::min( (m_sCur + 15) & ~size_t( 15 ), m_sSize );
+		return pfRet;
+	}
+
+	/**
+	 * Creates a new unbound label.
+	 *
+	 * \return Returns the new label.
+	 **/
+	CJitX64::Label CJitX64::NewLabel() {
+		m_vLabels.push_back( SIZE_MAX );
+		return m_vLabels.size() - 1;
+	}
+
+	/**
+	 * Binds a label to the current position.
+	 *
+	 * \param _lLabel The label to bind.
+	 **/
+	void CJitX64::Bind( Label _lLabel ) {
+		m_vLabels[_lLabel] = m_sCur;
+	}
+
+	/**
+	 * Emits a call to _pvFunc( _pvThis, _ui64Arg1, _ui64Arg2 ).  The return value is left in EAX.
+	 *
+	 * \param _pvFunc The function to call.
+	 * \param _ui64Arg1 The second parameter.
+	 * \param _ui64Arg2 The third parameter.
+	 **/
+	void CJitX64::Call( const void * _pvFunc, uint64_t _ui64Arg1, uint64_t _ui64Arg2 ) {
+#ifdef _WIN32
+		Emit8( 0x48 ); Emit8( 0x89 ); Emit8( 0xD9 );	// MOV RCX, RBX
+		Emit8( 0x48 ); Emit8( 0xBA ); Emit64( _ui64Arg1 );	// MOV RDX, imm64
+		Emit8( 0x49 ); Emit8( 0xB8 ); Emit64( _ui64Arg2 );	// MOV R8, imm64
+#else
+		Emit8( 0x48 ); Emit8( 0x89 ); Emit8( 0xDF );	// MOV RDI, RBX
+		Emit8( 0x48 ); Emit8( 0xBE ); Emit64( _ui64Arg1 );	// MOV RSI, imm64
+		Emit8( 0x48 ); Emit8( 0xBA ); Emit64( _ui64Arg2 );	// MOV RDX, imm64
+#endif	// #ifdef _WIN32
+		Emit8( 0x48 ); Emit8( 0xB8 ); Emit64( reinterpret_cast<uint64_t>(_pvFunc) );	// MOV RAX, imm64
+		Emit8( 0xFF ); Emit8( 0xD0 );					// CALL RAX
+	}
+
+	/**
+	 * Emits CMP EAX, _ui32Val followed by JE _lLabel.
+	 *
+	 * \param _ui32Val The value to which to compare EAX.
+	 * \param _lLabel The label to which to jump if EAX == _ui32Val.
+	 **/
+	void CJitX64::CmpEaxJe( uint32_t _ui32Val, Label _lLabel ) {
+		Emit8( 0x3D ); Emit32( _ui32Val );				// CMP EAX, imm32
+		Emit8( 0x0F ); Emit8( 0x84 ); EmitRel32( _lLabel );	// JE rel32
+	}
+
+	/**
+	 * Emits CMP EAX, _ui32Val followed by JNE _lLabel.
+	 *
+	 * \param _ui32Val The value to which to compare EAX.
+	 * \param _lLabel The label to which to jump if EAX != _ui32Val.
+	 **/
+	void CJitX64::CmpEaxJne( uint32_t _ui32Val, Label _lLabel ) {
+		Emit8( 0x3D ); Emit32( _ui32Val );				// CMP EAX, imm32
+		Emit8( 0x0F ); Emit8( 0x85 ); EmitRel32( _lLabel );	// JNE rel32
+	}
+
+	/**
+	 * Emits TEST EAX, EAX followed by JZ _lLabel.
+	 *
+	 * \param _lLabel The label to which to jump if EAX is 0.
+	 **/
+	void CJitX64::TestEaxJz( Label _lLabel ) {
+		Emit8( 0x85 ); Emit8( 0xC0 );					// TEST EAX, EAX
+		Emit8( 0x0F ); Emit8( 0x84 ); EmitRel32( _lLabel );	// JZ rel32
+	}
+
+	/**
+	 * Emits JMP _lLabel.
+	 *
+	 * \param _lLabel The label to which to jump.
+	 **/
+	void CJitX64::Jmp( Label _lLabel ) {
+		Emit8( 0xE9 ); EmitRel32( _lLabel );			// JMP rel32
+	}
+
+	/**
+	 * Emits Jcc _lLabel.
+	 *
+	 * \param _cCond The condition on which to jump.
+	 * \param _lLabel The label to which to jump.
+	 **/
+	void CJitX64::Jcc( LSN_COND _cCond, Label _lLabel ) {
+		Emit8( 0x0F ); Emit8( uint8_t( 0x80 | _cCond ) ); EmitRel32( _lLabel );	// Jcc rel32
+	}
+
+	/**
+	 * Emits MOV _rDst, _ui64Val, using the short form if the value fits in 32 bits.
+	 *
+	 * \param _rDst The 64-bit register to load.
+	 * \param _ui64Val The value to load.
+	 **/
+	void CJitX64::MovImm( LSN_REG _rDst, uint64_t _ui64Val ) {
+		if ( _ui64Val <= 0xFFFFFFFFULL ) {
+			// Writing the 32-bit register clears the upper half.
+			if ( _rDst & 8 ) { Emit8( 0x41 ); }
+			Emit8( uint8_t( 0xB8 | (_rDst & 7) ) ); Emit32( uint32_t( _ui64Val ) );	// MOV r32, imm32
+		}
+		else {
+			Emit8( uint8_t( 0x48 | ((_rDst >> 3) & 1) ) );
+			Emit8( uint8_t( 0xB8 | (_rDst & 7) ) ); Emit64( _ui64Val );				// MOV r64, imm64
+		}
+	}
+
+	/**
+	 * Emits MOV _rDst, _rSrc.
+	 *
+	 * \param _sSize The size of the registers.
+	 * \param _rDst The register to write.
+	 * \param _rSrc The register to copy.
+	 **/
+	void CJitX64::Mov( LSN_SIZE _sSize, LSN_REG _rDst, LSN_REG _rSrc ) {
+		EmitPrefixes( _sSize, _rSrc, _rDst, LSN_R_NONE, false );
+		Emit8( _sSize == LSN_S_8 ? 0x88 : 0x89 );
+		Emit8( uint8_t( 0xC0 | ((_rSrc & 7) << 3) | (_rDst & 7) ) );
+	}
+
+	/**
+	 * Loads a register from memory.  Bytes and words are zero-extended (MOVZX).
+	 *
+	 * \param _rDst The register to load.
+	 * \param _sSize The size of the value in memory.
+	 * \param _mSrc The memory to read.
+	 **/
+	void CJitX64::Load( LSN_REG _rDst, LSN_SIZE _sSize, const LSN_MEM &_mSrc ) {
+		if ( _sSize == LSN_S_8 || _sSize == LSN_S_16 ) {
+			// MOVZX r32, r/m8 or r/m16.  The prefixes are those of a 32-bit operation.
+			EmitPrefixes( LSN_S_32, _rDst, _mSrc.rBase, _mSrc.rIndex, true );
+			Emit8( 0x0F ); Emit8( _sSize == LSN_S_8 ? 0xB6 : 0xB7 );
+		}
+		else {
+			EmitPrefixes( _sSize, _rDst, _mSrc.rBase, _mSrc.rIndex, true );
+			Emit8( 0x8B );
+		}
+		EmitModRm( _rDst, _mSrc );
+	}
+
+	/**
+	 * Stores a register to memory.
+	 *
+	 * \param _mDst The memory to write.
+	 * \param _sSize The size of the value.
+	 * \param _rSrc The register to store.
+	 **/
+	void CJitX64::Store( const LSN_MEM &_mDst, LSN_SIZE _sSize, LSN_REG _rSrc ) {
+		EmitPrefixes( _sSize, _rSrc, _mDst.rBase, _mDst.rIndex, true );
+		Emit8( _sSize == LSN_S_8 ? 0x88 : 0x89 );
+		EmitModRm( _rSrc, _mDst );
+	}
+
+	/**
+	 * Stores a constant to memory.  Quadwords take a sign-extended 32-bit value.
+	 *
+	 * \param _mDst The memory to write.
+	 * \param _sSize The size of the value.
+	 * \param _ui32Val The value to store.
+	 **/
+	void CJitX64::StoreImm( const LSN_MEM &_mDst, LSN_SIZE _sSize, uint32_t _ui32Val ) {
+		EmitPrefixes( _sSize, 0, _mDst.rBase, _mDst.rIndex, true );
+		Emit8( _sSize == LSN_S_8 ? 0xC6 : 0xC7 );
+		EmitModRm( 0, _mDst );
+		EmitImm( _sSize, _ui32Val );
+	}
+
+	/**
+	 * Emits _aOp _rDst, _rSrc.
+	 *
+	 * \param _aOp The operation.
+	 * \param _sSize The size of the operands.
+	 * \param _rDst The register to update (only compared by LSN_ALU_CMP).
+	 * \param _rSrc The source register.
+	 **/
+	void CJitX64::Alu( LSN_ALU _aOp, LSN_SIZE _sSize, LSN_REG _rDst, LSN_REG _rSrc ) {
+		EmitPrefixes( _sSize, _rSrc, _rDst, LSN_R_NONE, false );
+		Emit8( uint8_t( (_aOp << 3) | (_sSize == LSN_S_8 ? 0x00 : 0x01) ) );
+		Emit8( uint8_t( 0xC0 | ((_rSrc & 7) << 3) | (_rDst & 7) ) );
+	}
+
+	/**
+	 * Emits _aOp _rDst, _i32Val.
+	 *
+	 * \param _aOp The operation.
+	 * \param _sSize The size of the operands.
+	 * \param _rDst The register to update (only compared by LSN_ALU_CMP).
+	 * \param _i32Val The constant, which is sign-extended for quadwords.
+	 **/
+	void CJitX64::AluImm( LSN_ALU _aOp, LSN_SIZE _sSize, LSN_REG _rDst, int32_t _i32Val ) {
+		EmitPrefixes( _sSize, _aOp, _rDst, LSN_R_NONE, false );
+		if ( _sSize == LSN_S_8 ) {
+			Emit8( 0x80 ); Emit8( uint8_t( 0xC0 | (_aOp << 3) | (_rDst & 7) ) ); Emit8( uint8_t( _i32Val ) );
+		}
+		else if ( _i32Val >= -128 && _i32Val <= 127 ) {
+			Emit8( 0x83 ); Emit8( uint8_t( 0xC0 | (_aOp << 3) | (_rDst & 7) ) ); Emit8( uint8_t( _i32Val ) );
+		}
+		else {
+			Emit8( 0x81 ); Emit8( uint8_t( 0xC0 | (_aOp << 3) | (_rDst & 7) ) ); EmitImm( _sSize, uint32_t( _i32Val ) );
+		}
+	}
+
+	/**
+	 * Emits _aOp _rDst, [_mSrc].
+	 *
+	 * \param _aOp The operation.
+	 * \param _sSize The size of the operands.
+	 * \param _rDst The register to update (only compared by LSN_ALU_CMP).
+	 * \param _mSrc The memory operand.
+	 **/
+	void CJitX64::AluLoad( LSN_ALU _aOp, LSN_SIZE _sSize, LSN_REG _rDst, const LSN_MEM &_mSrc ) {
+		EmitPrefixes( _sSize, _rDst, _mSrc.rBase, _mSrc.rIndex, true );
+		Emit8( uint8_t( (_aOp << 3) | (_sSize == LSN_S_8 ? 0x02 : 0x03) ) );
+		EmitModRm( _rDst, _mSrc );
+	}
+
+	/**
+	 * Emits _aOp [_mDst], _rSrc.
+	 *
+	 * \param _aOp The operation.
+	 * \param _sSize The size of the operands.
+	 * \param _mDst The memory to update (only compared by LSN_ALU_CMP).
+	 * \param _rSrc The source register.
+	 **/
+	void CJitX64::AluStore( LSN_ALU _aOp, LSN_SIZE _sSize, const LSN_MEM &_mDst, LSN_REG _rSrc ) {
+		EmitPrefixes( _sSize, _rSrc, _mDst.rBase, _mDst.rIndex, true );
+		Emit8( uint8_t( (_aOp << 3) | (_sSize == LSN_S_8 ? 0x00 : 0x01) ) );
+		EmitModRm( _rSrc, _mDst );
+	}
+
+	/**
+	 * Emits _aOp [_mDst], _i32Val.
+	 *
+	 * \param _aOp The operation.
+	 * \param _sSize The size of the operands.
+	 * \param _mDst The memory to update (only compared by LSN_ALU_CMP).
+	 * \param _i32Val The constant, which is sign-extended for quadwords.
+	 **/
+	void CJitX64::AluStoreImm( LSN_ALU _aOp, LSN_SIZE _sSize, const LSN_MEM &_mDst, int32_t _i32Val ) {
+		EmitPrefixes( _sSize, _aOp, _mDst.rBase, _mDst.rIndex, true );
+		if ( _sSize == LSN_S_8 ) {
+			Emit8( 0x80 ); EmitModRm( _aOp, _mDst ); Emit8( uint8_t( _i32Val ) );
+		}
+		else if ( _i32Val >= -128 && _i32Val <= 127 ) {
+			Emit8( 0x83 ); EmitModRm( _aOp, _mDst ); Emit8( uint8_t( _i32Val ) );
+		}
+		else {
+			Emit8( 0x81 ); EmitModRm( _aOp, _mDst ); EmitImm( _sSize, uint32_t( _i32Val ) );
+		}
+	}
+
+	/**
+	 * Emits TEST _rA, _rB.
+	 *
+	 * \param _sSize The size of the registers.
+	 * \param _rA The first register.
+	 * \param _rB The second register.
+	 **/
+	void CJitX64::Test( LSN_SIZE _sSize, LSN_REG _rA, LSN_REG _rB ) {
+		EmitPrefixes( _sSize, _rB, _rA, LSN_R_NONE, false );
+		Emit8( _sSize == LSN_S_8 ? 0x84 : 0x85 );
+		Emit8( uint8_t( 0xC0 | ((_rB & 7) << 3) | (_rA & 7) ) );
+	}
+
+	/**
+	 * Emits TEST [_mMem], _ui32Val.
+	 *
+	 * \param _sSize The size of the operands.
+	 * \param _mMem The memory to test.
+	 * \param _ui32Val The mask.
+	 **/
+	void CJitX64::TestImm( LSN_SIZE _sSize, const LSN_MEM &_mMem, uint32_t _ui32Val ) {
+		EmitPrefixes( _sSize, 0, _mMem.rBase, _mMem.rIndex, true );
+		Emit8( _sSize == LSN_S_8 ? 0xF6 : 0xF7 );
+		EmitModRm( 0, _mMem );
+		EmitImm( _sSize, _ui32Val );
+	}
+
+	/**
+	 * Emits a shift or rotate of a register by a constant.
+	 *
+	 * \param _sOp The shift.
+	 * \param _sSize The size of the register.
+	 * \param _rReg The register to shift.
+	 * \param _ui8Amount The number of bits by which to shift.
+	 **/
+	void CJitX64::Shift( LSN_SHIFT _sOp, LSN_SIZE _sSize, LSN_REG _rReg, uint8_t _ui8Amount ) {
+		EmitPrefixes( _sSize, _sOp, _rReg, LSN_R_NONE, false );
+		const uint8_t ui8Wide = _sSize == LSN_S_8 ? 0x00 : 0x01;
+		if ( _ui8Amount == 1 ) {
+			Emit8( uint8_t( 0xD0 | ui8Wide ) ); Emit8( uint8_t( 0xC0 | (_sOp << 3) | (_rReg & 7) ) );
+		}
+		else {
+			Emit8( uint8_t( 0xC0 | ui8Wide ) ); Emit8( uint8_t( 0xC0 | (_sOp << 3) | (_rReg & 7) ) ); Emit8( _ui8Amount );
+		}
+	}
+
+	/**
+	 * Emits IMUL _rReg, _rReg, _i32Val on 32-bit registers.
+	 *
+	 * \param _rReg The register to multiply.
+	 * \param _i32Val The constant by which to multiply.
+	 **/
+	void CJitX64::Imul( LSN_REG _rReg, int32_t _i32Val ) {
+		EmitPrefixes( LSN_S_32, _rReg, _rReg, LSN_R_NONE, false );
+		Emit8( 0x69 ); Emit8( uint8_t( 0xC0 | ((_rReg & 7) << 3) | (_rReg & 7) ) ); Emit32( uint32_t( _i32Val ) );
+	}
+
+	/**
+	 * Emits SETcc on the low byte of a register.
+	 *
+	 * \param _cCond The condition to store.
+	 * \param _rDst The register whose low byte is set to 1 if the condition holds, otherwise 0.
+	 **/
+	void CJitX64::SetCc( LSN_COND _cCond, LSN_REG _rDst ) {
+		EmitPrefixes( LSN_S_8, 0, _rDst, LSN_R_NONE, false );
+		Emit8( 0x0F ); Emit8( uint8_t( 0x90 | _cCond ) ); Emit8( uint8_t( 0xC0 | (_rDst & 7) ) );
+	}
+
+	/**
+	 * Makes the pages holding a range of the arena either read/execute or read/write.  The range is widened to whole pages.
+	 *
+	 * \param _sFrom The offset of the first byte in the range.
+	 * \param _sTo The offset just past the last byte in the range.  If equal to _sFrom, the page holding _sFrom is changed.
+	 * \param _bExecutable If true, the pages become read/execute, otherwise read/write.
+	 * \return Returns true if the pages were changed.
+	 **/
+	bool CJitX64::Protect( size_t _sFrom, size_t _sTo, bool _bExecutable ) {
+		const size_t sStart = _sFrom & ~(m_sPageSize - 1);
+		const size_t sEnd = std::min( (std::max( _sTo, _sFrom + 1 ) + m_sPageSize - 1) & ~(m_sPageSize - 1), m_sSize );
+		if ( sStart >= sEnd ) { return true; }
+#ifdef _WIN32
+		DWORD dwOld;
+		if ( !::VirtualProtect( m_pui8Code + sStart, sEnd - sStart, _bExecutable ? PAGE_EXECUTE_READ : PAGE_READWRITE, &dwOld ) ) { return false; }
+		if ( _bExecutable ) { ::FlushInstructionCache( ::GetCurrentProcess(), m_pui8Code + sStart, sEnd - sStart ); }
+		return true;
+#else
+		return ::mprotect( m_pui8Code + sStart, sEnd - sStart, _bExecutable ? (PROT_READ | PROT_EXEC) : (PROT_READ | PROT_WRITE) ) == 0;
+#endif	// #ifdef _WIN32
+	}
+
+	/**
+	 * Emits a 32-bit placeholder to be patched with the distance to a label.
+	 *
+	 * \param _lLabel The target label.
+	 **/
+	void CJitX64::EmitRel32( Label _lLabel ) {
+		m_vFixups.push_back( { m_sCur, _lLabel } );
+		Emit32( 0 );
+	}
+
+	/**
+	 * Emits the operand-size prefix and REX prefix for an instruction.
+	 *
+	 * \param _sSize The operand size.
+	 * \param _ui8Reg The ModRM reg field (a register or an opcode extension).
+	 * \param _ui8Rm The register in the ModRM r/m field, or the base register of a memory operand.
+	 * \param _ui8Index The index register of a memory operand, or LSN_R_NONE.
+	 * \param _bMem If true, the r/m field is a memory operand.
+	 **/
+	void CJitX64::EmitPrefixes( LSN_SIZE _sSize, uint8_t _ui8Reg, uint8_t _ui8Rm, uint8_t _ui8Index, bool _bMem ) {
+		if ( _sSize == LSN_S_16 ) { Emit8( 0x66 ); }
+		uint8_t ui8Rex = 0;
+		if ( _sSize == LSN_S_64 ) { ui8Rex |= 0x48; }
+		if ( _ui8Reg & 8 ) { ui8Rex |= 0x44; }
+		if ( _ui8Index != LSN_R_NONE && (_ui8Index & 8) ) { ui8Rex |= 0x42; }
+		if ( _ui8Rm & 8 ) { ui8Rex |= 0x41; }
+		// Without a REX prefix byte registers 4-7 are AH-BH.  Those are never wanted, so an opcode extension of 4-7 in the reg field
+		//	getting a REX prefix is harmless.
+		if ( _sSize == LSN_S_8 && ((_ui8Reg & 7) >= 4 || (!_bMem && (_ui8Rm & 7) >= 4)) ) { ui8Rex |= 0x40; }
+		if ( ui8Rex ) { Emit8( ui8Rex ); }
+	}
+
+	/**
+	 * Emits the ModRM byte (and SIB byte and displacement) for a memory operand.
+	 *
+	 * \param _ui8Reg The ModRM reg field (a register or an opcode extension).
+	 * \param _mMem The memory operand.
+	 **/
+	void CJitX64::EmitModRm( uint8_t _ui8Reg, const LSN_MEM &_mMem ) {
+		const uint8_t ui8Reg = uint8_t( (_ui8Reg & 7) << 3 );
+		const uint8_t ui8Base = uint8_t( _mMem.rBase & 7 );
+		// [RBP]/[R13] with no displacement encodes RIP-relative addressing, so those always take a displacement.
+		uint8_t ui8Mod;
+		if ( _mMem.i32Disp == 0 && ui8Base != 5 ) { ui8Mod = 0x00; }
+		else if ( _mMem.i32Disp >= -128 && _mMem.i32Disp <= 127 ) { ui8Mod = 0x40; }
+		else { ui8Mod = 0x80; }
+
+		if ( _mMem.rIndex != LSN_R_NONE || ui8Base == 4 ) {
+			// A SIB byte is needed for an index and for [RSP]/[R12].  An index of 4 (without REX.X) means no index.
+			uint8_t ui8Scale = 0;
+			while ( (1U << ui8Scale) < _mMem.ui8Scale ) { ++ui8Scale; }
+			const uint8_t ui8Index = _mMem.rIndex != LSN_R_NONE ? uint8_t( _mMem.rIndex & 7 ) : 4;
+			Emit8( uint8_t( ui8Mod | ui8Reg | 4 ) );
+			Emit8( uint8_t( (ui8Scale << 6) | (ui8Index << 3) | ui8Base ) );
+		}
+		else {
+			Emit8( uint8_t( ui8Mod | ui8Reg | ui8Base ) );
+		}
+		if ( ui8Mod == 0x40 ) { Emit8( uint8_t( _mMem.i32Disp ) ); }
+		else if ( ui8Mod == 0x80 ) { Emit32( uint32_t( _mMem.i32Disp ) ); }
+	}
+
+	/**
+	 * Emits an immediate of a given operand size (at most 32 bits).
+	 *
+	 * \param _sSize The operand size.
+	 * \param _ui32Val The immediate.
+	 **/
+	void CJitX64::EmitImm( LSN_SIZE _sSize, uint32_t _ui32Val ) {
+		switch ( _sSize ) {
+			case LSN_S_8 : {
+				Emit8( uint8_t( _ui32Val ) );
+				break;
+			}
+			case LSN_S_16 : {
+				Emit8( uint8_t( _ui32Val ) ); Emit8( uint8_t( _ui32Val >> 8 ) );
+				break;
+			}
+			default : {
+				Emit32( _ui32Val );
+			}
+		}
+	}
+
+}	// namespace lsn
+
+#endif	// #if LSN_JIT_X64_SUPPORTED
@@ -0,0 +1,502 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: A minimal x86-64 code emitter and executable-memory arena for the 5A22 dynamic recompiler.
+ */
+
+
+#pragma once
+
+#include "../LSNBirdSNES.h"
+#include "../Foundation/LSNMacros.h"
+
+#include <cstdint>
+#include <vector>
+
+#if defined( _M_X64 ) || defined( __x86_64__ )
+#define LSN_JIT_X64_SUPPORTED											1
+#else
+#define LSN_JIT_X64_SUPPORTED											0
+#endif	// #if defined( _M_X64 ) || defined( __x86_64__ )
+
+
+#if LSN_JIT_X64_SUPPORTED
+
+namespace lsn {
+
+	/**
+	 * Class CJitX64
+	 * \brief A minimal x86-64 code emitter and executable-memory arena for the 5A22 dynamic recompiler.
+	 *
+	 * Description: A minimal x86-64 code emitter and executable-memory arena for the 5A22 dynamic recompiler.  Emits functions of the form
+	 *	void Func( void * _pvThis ), inside which _pvThis is kept in RBX and passed as the first parameter of every emitted call.  Only the
+	 *	handful of instructions needed by the recompiler are supported, using only the registers that are volatile in both ABIs (RAX, RCX, RDX, and R8-R11) as scratch between calls.  Code is appended to a single arena that is only ever discarded as a whole.
+	 *	No page of the arena is ever writable and executable at once: each function is emitted into read/write pages that are then made
+	 *	read/execute.
+	 */
+	class CJitX64 {
+	public :
+		CJitX64();
+		~CJitX64();
+
+
+		// == Enumerations.
+		/** General-purpose registers, by their encoding.  RBX holds _pvThis and must not be changed. */
+		enum LSN_REG : uint8_t {
+			LSN_R_AX													= 0,																				/**< RAX/EAX/AX/AL. */
+			LSN_R_CX													= 1,																				/**< RCX/ECX/CX/CL. */
+			LSN_R_DX													= 2,																				/**< RDX/EDX/DX/DL. */
+			LSN_R_BX													= 3,																				/**< RBX (_pvThis). */
+			LSN_R_R8													= 8,																				/**< R8/R8D/R8W/R8B. */
+			LSN_R_R9													= 9,																				/**< R9/R9D/R9W/R9B. */
+			LSN_R_R10													= 10,																				/**< R10/R10D/R10W/R10B. */
+			LSN_R_R11													= 11,																				/**< R11/R11D/R11W/R11B. */
+			LSN_R_NONE													= 0xFF,																				/**< No register (no index in an LSN_MEM). */
+		};
+
+		/** Operand sizes, in bytes. */
+		enum LSN_SIZE : uint8_t {
+			LSN_S_8														= 1,																				/**< Byte. */
+			LSN_S_16													= 2,																				/**< Word. */
+			LSN_S_32													= 4,																				/**< Doubleword.  Writing a 32-bit register clears its upper half. */
+			LSN_S_64													= 8,																				/**< Quadword. */
+		};
+
+		/** Two-operand ALU operations, by their ModRM reg field in the 0x80 group. */
+		enum LSN_ALU : uint8_t {
+			LSN_ALU_ADD													= 0,																				/**< ADD. */
+			LSN_ALU_OR													= 1,																				/**< OR. */
+			LSN_ALU_ADC													= 2,																				/**< ADC. */
+			LSN_ALU_SBB													= 3,																				/**< SBB. */
+			LSN_ALU_AND													= 4,																				/**< AND. */
+			LSN_ALU_SUB													= 5,																				/**< SUB. */
+			LSN_ALU_XOR													= 6,																				/**< XOR. */
+			LSN_ALU_CMP													= 7,																				/**< CMP. */
+		};
+
+		/** Shifts and rotates, by their ModRM reg field in the 0xC0 group. */
+		enum LSN_SHIFT : uint8_t {
+			LSN_SH_ROL													= 0,																				/**< ROL. */
+			LSN_SH_ROR													= 1,																				/**< ROR. */
+			LSN_SH_RCL													= 2,																				/**< RCL (CF rotates in). */
+			LSN_SH_RCR													= 3,																				/**< RCR (CF rotates in). */
+			LSN_SH_SHL													= 4,																				/**< SHL. */
+			LSN_SH_SHR													= 5,																				/**< SHR. */
+		};
+
+		/** Condition codes for Jcc() and SetCc(). */
+		enum LSN_COND : uint8_t {
+			LSN_C_O														= 0x0,																				/**< Overflow. */
+			LSN_C_B														= 0x2,																				/**< Carry (below). */
+			LSN_C_AE													= 0x3,																				/**< No carry (above or equal). */
+			LSN_C_E														= 0x4,																				/**< Zero (equal). */
+			LSN_C_NE													= 0x5,																				/**< Not zero (not equal). */
+			LSN_C_S														= 0x8,																				/**< Sign. */
+		};
+
+
+		// == Types.
+		/** A label (an index into the label table). */
+		typedef size_t													Label;
+
+		/** A memory operand: [rBase + rIndex * ui8Scale + i32Disp]. */
+		struct LSN_MEM {
+			LSN_REG														rBase;																				/**< The base register. */
+			int32_t														i32Disp = 0;																		/**< The displacement. */
+			LSN_REG														rIndex = LSN_R_NONE;																/**< The index register, or LSN_R_NONE. */
+			uint8_t														ui8Scale = 1;																		/**< The index scale (1, 2, 4, or 8). */
+		};
+
+		/** An emitted function. */
+		typedef void (*													PfFunc)( void * _pvThis );
+
+
+		// == Functions.
+		/**
+		 * Allocates the executable arena.  Any previously allocated arena is freed.
+		 *
+		 * \param _sSize The size of the arena in bytes.
+		 * \return Returns true if the arena was allocated.
+		 **/
+		bool															Init( size_t _sSize );
+
+		/**
+		 * Frees the executable arena.
+		 **/
+		void															Free();
+
+		/**
+		 * Discards all emitted code, keeping the arena.  Every pointer previously returned by EndFunction() becomes invalid.
+		 **/
+		void															Reset();
+
+		/**
+		 * Determines whether the arena has been allocated.
+		 *
+		 * \return Returns true if Init() succeeded.
+		 **/
+		inline bool														Valid() const { return m_pui8Code != nullptr; }
+
+		/**
+		 * Gets the number of unused bytes left in the arena.
+		 *
+		 * \return Returns the number of bytes that can still be emitted.
+		 **/
+		inline size_t													Remaining() const { return m_sSize - m_sUsed; }
+
+		/**
+		 * Begins a new function and emits its prologue.
+		 **/
+		void															BeginFunction();
+
+		/**
+		 * Binds the exit label, emits the epilogue, and resolves all jumps.
+		 *
+		 * \return Returns the entry point of the function, or nullptr if the arena overflowed (in which case nothing is kept).
+		 **/
+		PfFunc															EndFunction();
+
+		/**
+		 * Creates a new unbound label.
+		 *
+		 * \return Returns the new label.
+		 **/
+		Label															NewLabel();
+
+		/**
+		 * Binds a label to the current position.
+		 *
+		 * \param _lLabel The label to bind.
+		 **/
+		void															Bind( Label _lLabel );
+
+		/**
+		 * Gets the label that jumps to the function's epilogue.
+		 *
+		 * \return Returns the exit label.
+		 **/
+		inline Label													ExitLabel() const { return m_lExit; }
+
+		/**
+		 * Emits a call to _pvFunc( _pvThis, _ui64Arg1, _ui64Arg2 ).  The return value is left in EAX.
+		 *
+		 * \param _pvFunc The function to call.
+		 * \param _ui64Arg1 The second parameter.
+		 * \param _ui64Arg2 The third parameter.
+		 **/
+		void															Call( const void * _pvFunc, uint64_t _ui64Arg1, uint64_t _ui64Arg2 = 0 );
+
+		/**
+		 * Emits CMP EAX, _ui32Val followed by JE _lLabel.
+		 *
+		 * \param _ui32Val The value to which to compare EAX.
+		 * \param _lLabel The label to which to jump if EAX == _ui32Val.
+		 **/
+		void															CmpEaxJe( uint32_t _ui32Val, Label _lLabel );
+
+		/**
+		 * Emits CMP EAX, _ui32Val followed by JNE _lLabel.
+		 *
+		 * \param _ui32Val The value to which to compare EAX.
+		 * \param _lLabel The label to which to jump if EAX != _ui32Val.
+		 **/
+		void															CmpEaxJne( uint32_t _ui32Val, Label _lLabel );
+
+		/**
+		 * Emits TEST EAX, EAX followed by JZ _lLabel.
+		 *
+		 * \param _lLabel The label to which to jump if EAX is 0.
+		 **/
+		void															TestEaxJz( Label _lLabel );
+
+		/**
+		 * Emits JMP _lLabel.
+		 *
+		 * \param _lLabel The label to which to jump.
+		 **/
+		void															Jmp( Label _lLabel );
+
+		/**
+		 * Emits Jcc _lLabel.
+		 *
+		 * \param _cCond The condition on which to jump.
+		 * \param _lLabel The label to which to jump.
+		 **/
+		void															Jcc( LSN_COND _cCond, Label _lLabel );
+
+		/**
+		 * Emits MOV _rDst, _ui64Val, using the short form if the value fits in 32 bits.
+		 *
+		 * \param _rDst The 64-bit register to load.
+		 * \param _ui64Val The value to load.
+		 **/
+		void															MovImm( LSN_REG _rDst, uint64_t _ui64Val );
+
+		/**
+		 * Emits MOV _rDst, _rSrc.
+		 *
+		 * \param _sSize The size of the registers.
+		 * \param _rDst The register to write.
+		 * \param _rSrc The register to copy.
+		 **/
+		void															Mov( LSN_SIZE _sSize, LSN_REG _rDst, LSN_REG _rSrc );
+
+		/**
+		 * Loads a register from memory.  Bytes and words are zero-extended (MOVZX).
+		 *
+		 * \param _rDst The register to load.
+		 * \param _sSize The size of the value in memory.
+		 * \param _mSrc The memory to read.
+		 **/
+		void															Load( LSN_REG _rDst, LSN_SIZE _sSize, const LSN_MEM &_mSrc );
+
+		/**
+		 * Stores a register to memory.
+		 *
+		 * \param _mDst The memory to write.
+		 * \param _sSize The size of the value.
+		 * \param _rSrc The register to store.
+		 **/
+		void															Store( const LSN_MEM &_mDst, LSN_SIZE _sSize, LSN_REG _rSrc );
+
+		/**
+		 * Stores a constant to memory.  Quadwords take a sign-extended 32-bit value.
+		 *
+		 * \param _mDst The memory to write.
+		 * \param _sSize The size of the value.
+		 * \param _ui32Val The value to store.
+		 **/
+		void															StoreImm( const LSN_MEM &_mDst, LSN_SIZE _sSize, uint32_t _ui32Val );
+
+		/**
+		 * Emits _aOp _rDst, _rSrc.
+		 *
+		 * \param _aOp The operation.
+		 * \param _sSize The size of the operands.
+		 * \param _rDst The register to update (only compared by LSN_ALU_CMP).
+		 * \param _rSrc The source register.
+		 **/
+		void															Alu( LSN_ALU _aOp, LSN_SIZE _sSize, LSN_REG _rDst, LSN_REG _rSrc );
+
+		/**
+		 * Emits _aOp _rDst, _i32Val.
+		 *
+		 * \param _aOp The operation.
+		 * \param _sSize The size of the operands.
+		 * \param _rDst The register to update (only compared by LSN_ALU_CMP).
+		 * \param _i32Val The constant, which is sign-extended for quadwords.
+		 **/
+		void															AluImm( LSN_ALU _aOp, LSN_SIZE _sSize, LSN_REG _rDst, int32_t _i32Val );
+
+		/**
+		 * Emits _aOp _rDst, [_mSrc].
+		 *
+		 * \param _aOp The operation.
+		 * \param _sSize The size of the operands.
+		 * \param _rDst The register to update (only compared by LSN_ALU_CMP).
+		 * \param _mSrc The memory operand.
+		 **/
+		void															AluLoad( LSN_ALU _aOp, LSN_SIZE _sSize, LSN_REG _rDst, const LSN_MEM &_mSrc );
+
+		/**
+		 * Emits _aOp [_mDst], _rSrc.
+		 *
+		 * \param _aOp The operation.
+		 * \param _sSize The size of the operands.
+		 * \param _mDst The memory to update (only compared by LSN_ALU_CMP).
+		 * \param _rSrc The source register.
+		 **/
+		void															AluStore( LSN_ALU _aOp, LSN_SIZE _sSize, const LSN_MEM &_mDst, LSN_REG _rSrc );
+
+		/**
+		 * Emits _aOp [_mDst], _i32Val.
+		 *
+		 * \param _aOp The operation.
+		 * \param _sSize The size of the operands.
+		 * \param _mDst The memory to update (only compared by LSN_ALU_CMP).
+		 * \param _i32Val The constant, which is sign-extended for quadwords.
+		 **/
+		void															AluStoreImm( LSN_ALU _aOp, LSN_SIZE _sSize, const LSN_MEM &_mDst, int32_t _i32Val );
+
+		/**
+		 * Emits TEST _rA, _rB.
+		 *
+		 * \param _sSize The size of the registers.
+		 * \param _rA The first register.
+		 * \param _rB The second register.
+		 **/
+		void															Test( LSN_SIZE _sSize, LSN_REG _rA, LSN_REG _rB );
+
+		/**
+		 * Emits TEST [_mMem], _ui32Val.
+		 *
+		 * \param _sSize The size of the operands.
+		 * \param _mMem The memory to test.
+		 * \param _ui32Val The mask.
+		 **/
+		void															TestImm( LSN_SIZE _sSize, const LSN_MEM &_mMem, uint32_t _ui32Val );
+
+		/**
+		 * Emits a shift or rotate of a register by a constant.
+		 *
+		 * \param _sOp The shift.
+		 * \param _sSize The size of the register.
+		 * \param _rReg The register to shift.
+		 * \param _ui8Amount The number of bits by which to shift.
+		 **/
+		void															Shift( LSN_SHIFT _sOp, LSN_SIZE _sSize, LSN_REG _rReg, uint8_t _ui8Amount );
+
+		/**
+		 * Emits IMUL _rReg, _rReg, _i32Val on 32-bit registers.
+		 *
+		 * \param _rReg The register to multiply.
+		 * \param _i32Val The constant by which to multiply.
+		 **/
+		void															Imul( LSN_REG _rReg, int32_t _i32Val );
+
+		/**
+		 * Emits SETcc on the low byte of a register.
+		 *
+		 * \param _cCond The condition to store.
+		 * \param _rDst The register whose low byte is set to 1 if the condition holds, otherwise 0.
+		 **/
+		void															SetCc( LSN_COND _cCond, LSN_REG _rDst );
+
+		/**
+		 * Emits CMC (complements CF).
+		 **/
+		inline void														Cmc() { Emit8( 0xF5 ); }
+
+		/**
+		 * Creates a memory operand.
+		 *
+		 * \param _rBase The base register.
+		 * \param _i32Disp The displacement.
+		 * \param _rIndex The index register, or LSN_R_NONE.
+		 * \param _ui8Scale The index scale (1, 2, 4, or 8).
+		 * \return Returns the memory operand.
+		 **/
+		static inline LSN_MEM											Mem( LSN_REG _rBase, int32_t _i32Disp = 0, LSN_REG _rIndex = LSN_R_NONE, uint8_t _ui8Scale = 1 ) {
+			LSN_MEM mRet;
+			mRet.rBase = _rBase;
+			mRet.i32Disp = _i32Disp;
+			mRet.rIndex = _rIndex;
+			mRet.ui8Scale = _ui8Scale;
+			return mRet;
+		}
+
+
+	protected :
+		// == Enumerations.
+		/** Arena layout. */
+		enum LSN_ARENA : size_t {
+#ifdef _WIN32
+			LSN_CODE_START												= 16,																			/**< The offset of the first function.  The unwind information shared by every function comes first. */
+#else
+			LSN_CODE_START												= 0,																			/**< The offset of the first function. */
+#endif	// #ifdef _WIN32
+		};
+
+
+		// == Types.
+		/** A 32-bit relative jump to patch once its label is bound. */
+		struct LSN_FIXUP {
+			size_t														sPos;																			/**< The offset of the rel32 inside the arena. */
+			Label														lLabel;																			/**< The target label. */
+		};
+
+
+		// == Members.
+		uint8_t *														m_pui8Code = nullptr;															/**< The executable arena. */
+		size_t															m_sSize = 0;																	/**< The size of the arena. */
+		size_t															m_sPageSize = 4096;																/**< The size of a page, the granularity of Protect(). */
+		size_t															m_sUsed = 0;																	/**< The number of bytes of the arena holding finished functions. */
+		size_t															m_sCur = 0;																		/**< The write position inside the function being emitted. */
+		std::vector<size_t>												m_vLabels;																		/**< The arena offset of each label, or SIZE_MAX if unbound. */
+		std::vector<LSN_FIXUP>											m_vFixups;																		/**< Jumps waiting for their labels. */
+		Label															m_lExit = 0;																	/**< The label of the epilogue. */
+		bool															m_bOverflow = false;															/**< Set if the function being emitted did not fit. */
+#ifdef _WIN32
+		RUNTIME_FUNCTION												m_rfFunctionTable = {};															/**< The unwind entry registered for the whole arena. */
+#endif	// #ifdef _WIN32
+
+
+		// == Functions.
+		/**
+		 * Emits a byte.
+		 *
+		 * \param _ui8Val The byte to emit.
+		 **/
+		inline void														Emit8( uint8_t _ui8Val ) {
+			if LSN_UNLIKELY( m_sCur >= m_sSize ) { m_bOverflow = true; return; }
+			m_pui8Code[m_sCur++] = _ui8Val;
+		}
+
+		/**
+		 * Emits a 32-bit value.
+		 *
+		 * \param _ui32Val The value to emit.
+		 **/
+		inline void														Emit32( uint32_t _ui32Val ) {
+			for ( size_t I = 0; I < 4; ++I ) { Emit8( uint8_t( _ui32Val >> (I * 8) ) ); }
+		}
+
+		/**
+		 * Emits a 64-bit value.
+		 *
+		 * \param _ui64Val The value to emit.
+		 **/
+		inline void														Emit64( uint64_t _ui64Val ) {
+			for ( size_t I = 0; I < 8; ++I ) { Emit8( uint8_t( _ui64Val >> (I * 8) ) ); }
+		}
+
+		/**
+		 * Emits a 32-bit placeholder to be patched with the distance to a label.
+		 *
+		 * \param _lLabel The target label.
+		 **/
+		void															EmitRel32( Label _lLabel );
+
+		/**
+		 * Emits the operand-size prefix and REX prefix for an instruction.
+		 *
+		 * \param _sSize The operand size.
+		 * \param _ui8Reg The ModRM reg field (a register or an opcode extension).
+		 * \param _ui8Rm The register in the ModRM r/m field, or the base register of a memory operand.
+		 * \param _ui8Index The index register of a memory operand, or LSN_R_NONE.
+		 * \param _bMem If true, the r/m field is a memory operand.
+		 **/
+		void															EmitPrefixes( LSN_SIZE _sSize, uint8_t _ui8Reg, uint8_t _ui8Rm, uint8_t _ui8Index, bool _bMem );
+
+		/**
+		 * Emits the ModRM byte (and SIB byte and displacement) for a memory operand.
+		 *
+		 * \param _ui8Reg The ModRM reg field (a register or an opcode extension).
+		 * \param _mMem The memory operand.
+		 **/
+		void															EmitModRm( uint8_t _ui8Reg, const LSN_MEM &_mMem );
+
+		/**
+		 * Emits an immediate of a given operand size (at most 32 bits).
+		 *
+		 * \param _sSize The operand size.
+		 * \param _ui32Val The immediate.
+		 **/
+		void															EmitImm( LSN_SIZE _sSize, uint32_t _ui32Val );
+
+		/**
+		 * Makes the pages holding a range of the arena either read/execute or read/write.  The range is widened to whole pages.
+		 *
+		 * \param _sFrom The offset of the first byte in the range.
+		 * \param _sTo The offset just past the last byte in the range.  If equal to _sFrom, the page holding _sFrom is changed.
+		 * \param _bExecutable If true, the pages become read/execute, otherwise read/write.
+		 * \return Returns true if the pages were changed.
+		 **/
+		bool															Protect( size_t _sFrom, size_t _sTo, bool _bExecutable );
+	};
+
+}	// namespace lsn
+
+#endif	// #if LSN_JIT_X64_SUPPORTED
@@ -9,33 +9,1171 @@
 #include "LSNRicoh5A22.h"
 
 
+#ifdef LSN_CPU_VERIFY
+namespace lsn::aotfixture {
+
+	/**
+	 * Registers the blocks that CAotCompiler generated into LSNAotFixture.cpp from MapAotFixture()'s program.
+	 *
+	 * \param _cCpu The CPU.
+	 * \return Returns false if the CPU core does not match the one that generated LSNAotFixture.cpp.
+	 **/
+	bool											Register( lsn::CRicoh5A22 &_cCpu );
+
+}	// namespace lsn::aotfixture
+#endif	// #ifdef LSN_CPU_VERIFY
+
 namespace lsn {
 
 	// == Members.
 #include "LSNCycleFuncs.inl"
 
+	CRicoh5A22::PfCycle CRicoh5A22::m_pfHandlers[LSN_M_MAX_HANDLERS] = { nullptr };						/**< Every unique cycle function used by m_iInstructionSet, each stored once. */
+	uint16_t CRicoh5A22::m_ui16InstructionSet[LSN_IT_TOTAL][256][LSN_M_MAX_INSTR_CYCLE_COUNT*2] = {};		/**< m_iInstructionSet[].pfHandler as indices into m_pfHandlers, one table per LSN_INSTR_TABLES. */
+	uint8_t CRicoh5A22::m_ui8FusedIdle[LSN_IT_TOTAL][256][LSN_M_MAX_INSTR_CYCLE_COUNT*2] = {};				/**< Parallel to m_ui16InstructionSet: LSN_FUSED_IDLE runs of bus-idle half-cycles that StepInstructionFast() and translated blocks skip in one step. */
+	uint16_t CRicoh5A22::m_ui16NextInstruction[1] = {};														/**< The "instruction" that runs between instructions. */
+	uint16_t CRicoh5A22::m_ui16FetchOpcode[1] = {};															/**< The first PHI2 of every instruction. */
+	size_t CRicoh5A22::m_sTotalHandlers = 1;																/**< The number of used entries in m_pfHandlers. */
+	const bool CRicoh5A22::m_bCompactTablesBuilt = CRicoh5A22::BuildCompactTables();						/**< Builds the compact tables during static initialization. */
+
 	CRicoh5A22::CRicoh5A22( CBusA &_bBusA ) :
 		m_baBusA( _bBusA ) {
+		SetMasterClock( LSN_CS_NTSC_MASTER, LSN_CS_NTSC_MASTER_DIVISOR );
+		m_baBusA.SetPageWriteNotify( &CRicoh5A22::PageWritten, this );
 	}
 	CRicoh5A22::~CRicoh5A22() {
+		m_baBusA.SetPageWriteNotify( nullptr, nullptr );
 	}
 
 	// == Functions.
 	/**
-	 * Performs a single PHI1 update.
-	 */
-	void CRicoh5A22::Tick() {
-		(this->*m_pfTickFunc)();
+	 * Runs up to _ui64Cycles full CPU cycles inside the CPU, stopping early only when the master clock reaches the next registered event deadline.
+	 *	Each cycle advances the master clock by its bus-speed divisor and increments the CPU cycle count.
+	 * 
+	 * \param _ui64Cycles The maximum number of CPU cycles to run.
+	 * \return Returns the number of CPU cycles actually run.
+	 **/
+	uint64_t CRicoh5A22::RunCycles( uint64_t _ui64Cycles ) {
+		uint64_t ui64Run = 0;
+		// Deadlines can be registered by bus accesses inside the loop, so m_ui64NextEvent is re-read every cycle.
+		while ( ui64Run < _ui64Cycles && m_ui64MasterCycles < m_ui64NextEvent ) {
+			Tick();
+			TickPhi2();
+			m_ui64MasterCycles += m_ui8Speed;
+			++ui64Run;
+		}
+		m_ui64CycleCount += ui64Run;
+		return ui64Run;
+	}
+
+	/**
+	 * Runs full CPU cycles until the master clock reaches _ui64MasterClock or the next registered event deadline, whichever comes first.
+	 *	The last cycle may end past the target, since cycles are never split.
+	 * 
+	 * \param _ui64MasterClock The master-clock value at which to stop.
+	 * \return Returns the number of CPU cycles actually run.
+	 **/
+	uint64_t CRicoh5A22::RunUntilMasterClock( uint64_t _ui64MasterClock ) {
+		uint64_t ui64Run = 0;
+		while ( m_ui64MasterCycles < _ui64MasterClock && m_ui64MasterCycles < m_ui64NextEvent ) {
+			Tick();
+			TickPhi2();
+			m_ui64MasterCycles += m_ui8Speed;
+			++ui64Run;
+		}
+		m_ui64CycleCount += ui64Run;
+		return ui64Run;
+	}
+
+	/**
+	 * The fast (instruction-granular) engine.  Runs whole instructions until the master clock reaches _ui64MasterClock or the next registered
+	 *	event deadline.  Each instruction runs from its first to its last cycle with only a deadline check after each cycle, with the master
+	 *	clock still advanced by each cycle's bus-speed divisor.  Whenever an event deadline (or pending IRQ/NMI/reset, or RDY) falls within the
+	 *	worst-case length of the next instruction, that instruction is instead run by the micro-cycle core, which stops exactly at the deadline.
+	 *	Both engines share m_fsState, so calls to RunInstructions(), RunCycles(), and RunUntilMasterClock() can be freely mixed.
+	 * Deadlines (including those registered by an instruction's own bus accesses) stop the CPU on the same cycle as RunUntilMasterClock()
+	 *	would, but _ui64MasterClock can be overshot by up to one instruction.
+	 * 
+	 * \param _ui64MasterClock The master-clock value at which to stop.
+	 * \return Returns the number of CPU cycles actually run.
+	 **/
+	uint64_t CRicoh5A22::RunInstructions( uint64_t _ui64MasterClock ) {
+		const uint64_t ui64Window = uint64_t( LSN_M_MAX_INSTR_CYCLE_COUNT ) * m_ui8XSlowDiv;
+		uint64_t ui64Run = 0;
+		ForgetIdleLoop();
+		while ( m_ui64MasterCycles < _ui64MasterClock && m_ui64MasterCycles < m_ui64NextEvent ) {
+			if LSN_UNLIKELY( !CanRunFast( ui64Window ) ) {
+				// Micro-cycle core: up to the end of the instruction, stopping exactly at the deadline.
+				if ( m_ui8Halt != LSN_H_NONE ) { RunHalted( _ui64MasterClock, ui64Run ); }
+				else { StepInstructionMicro( ui64Run ); }
+				ForgetIdleLoop();
+			}
+			else {
+				// Fast path: the whole instruction in one go.
+				const uint32_t ui32From = ProgramAddress();
+				StepInstructionFast( ui64Run );
+				CheckIdleLoop( ui32From, _ui64MasterClock, ui64Run );
+			}
+		}
+		m_ui64CycleCount += ui64Run;
+		return ui64Run;
+	}
+
+#if LSN_CPU_JIT
+	/**
+	 * The recompiling engine.  Behaves exactly like RunInstructions(), except that once an instruction address on a plain-memory page has
+	 *	been reached LSN_M_JIT_HOT_COUNT times, the block of instructions starting there is translated into x86-64 code and run from then on.
+	 *	Simple loads, stores, ALU operations, and flag/register instructions whose data lives on plain-memory pages are emitted as native
+	 *	x86-64; the rest call the instruction table's cycle functions directly (and skip runs of idle half-cycles in one call, as
+	 *	RunInstructions() does).  Either way every bus access happens in the same order and with the same speed as in the interpreter.
+	 *	Blocks are dropped as soon as a page holding any of their opcodes is written or remapped.
+	 * Falls back to RunInstructions() if executable memory cannot be allocated.
+	 * 
+	 * \param _ui64MasterClock The master-clock value at which to stop.
+	 * \return Returns the number of CPU cycles actually run.
+	 **/
+	uint64_t CRicoh5A22::RunJit( uint64_t _ui64MasterClock ) {
+		if LSN_UNLIKELY( !m_jJit.Valid() ) {
+			if ( !m_jJit.Init( LSN_M_JIT_ARENA_SIZE ) ) { return RunInstructions( _ui64MasterClock ); }
+		}
+		const uint64_t ui64Window = uint64_t( LSN_M_MAX_INSTR_CYCLE_COUNT ) * m_ui8XSlowDiv;
+		uint64_t ui64Run = 0;
+		m_ui64BlockLimit = _ui64MasterClock;
+		m_ui64BlockCycles = 0;
+		ForgetIdleLoop();
+		while ( m_ui64MasterCycles < _ui64MasterClock && m_ui64MasterCycles < m_ui64NextEvent ) {
+			// No translated code is running here, so blocks invalidated by the last one can finally be freed.
+			m_vJitRetired.clear();
+			if LSN_UNLIKELY( !CanRunFast( ui64Window ) ) {
+				if ( m_ui8Halt != LSN_H_NONE ) { RunHalted( _ui64MasterClock, ui64Run ); }
+				else { StepInstructionMicro( ui64Run ); }
+				ForgetIdleLoop();
+				continue;
+			}
+			const uint32_t ui32From = ProgramAddress();
+			LSN_JIT_BLOCK * pjbBlock = JitBlock();
+			if ( pjbBlock ) {
+				// Always returns on a cycle boundary, which is mid-instruction if an event deadline was reached.
+				pjbBlock->pfCode( this );
+			}
+			else {
+				StepInstructionFast( ui64Run );
+			}
+			CheckIdleLoop( ui32From, _ui64MasterClock, ui64Run );
+		}
+		m_vJitRetired.clear();
+		ui64Run += m_ui64BlockCycles;
+		m_ui64CycleCount += ui64Run;
+		return ui64Run;
+	}
+
+	/**
+	 * Discards every translated block.  Must not be called from inside a bus access.
+	 **/
+	void CRicoh5A22::FlushJit() {
+		m_umJitBlocks.clear();
+		m_umJitPages.clear();
+		m_vJitRetired.clear();
+		m_jJit.Reset();
+	}
+#endif	// #if LSN_CPU_JIT
+
+	/**
+	 * Statically recompiled (ahead-of-time) engine.  Behaves exactly like RunInstructions(), except that whenever the current instruction
+	 *	starts one of the blocks registered with SetAotBlocks(), that block's generated code is run instead.  The instructions that
+	 *	NativeInstr() decodes are compiled into the blocks as C++, with operands read from ROM at generation time; the rest call the
+	 *	cycle functions.
+	 * 
+	 * \param _ui64MasterClock The master-clock value at which to stop.
+	 * \return Returns the number of CPU cycles actually run.
+	 **/
+	uint64_t CRicoh5A22::RunAot( uint64_t _ui64MasterClock ) {
+		const uint64_t ui64Window = uint64_t( LSN_M_MAX_INSTR_CYCLE_COUNT ) * m_ui8XSlowDiv;
+		uint64_t ui64Run = 0;
+		m_ui64BlockLimit = _ui64MasterClock;
+		m_ui64BlockCycles = 0;
+		ForgetIdleLoop();
+		while ( m_ui64MasterCycles < _ui64MasterClock && m_ui64MasterCycles < m_ui64NextEvent ) {
+			if LSN_UNLIKELY( !CanRunFast( ui64Window ) ) {
+				if ( m_ui8Halt != LSN_H_NONE ) { RunHalted( _ui64MasterClock, ui64Run ); }
+				else { StepInstructionMicro( ui64Run ); }
+				ForgetIdleLoop();
+				continue;
+			}
+			const uint32_t ui32Addr = ProgramAddress();
+			auto aFound = m_umAotBlocks.find( (uint64_t( InstrTableIndex() ) << 24) | ui32Addr );
+			// The code was generated from a ROM image; if something else is there now, interpret it.
+			if ( aFound != m_umAotBlocks.end() && aFound->second->ui8Op == uint8_t( m_fsState.ui16OpCode ) ) {
+				aFound->second->pfBlock( this );
+			}
+			else {
+				StepInstructionFast( ui64Run );
+			}
+			CheckIdleLoop( ui32Addr, _ui64MasterClock, ui64Run );
+		}
+		ui64Run += m_ui64BlockCycles;
+		m_ui64CycleCount += ui64Run;
+		return ui64Run;
+	}
+
+	/**
+	 * Registers the blocks generated by CAotCompiler for use by RunAot().  Replaces any previously registered blocks.
+	 * 
+	 * \param _pabBlocks The blocks.  Must remain valid for as long as they are registered.
+	 * \param _sTotal The number of blocks in _pabBlocks.
+	 * \param _ui64Signature The HandlerSignature() of the CPU core that generated the blocks.
+	 * \return Returns false (and registers nothing) if _ui64Signature does not match this CPU core, in which case the generated code
+	 *	must be regenerated.
+	 **/
+	bool CRicoh5A22::SetAotBlocks( const LSN_AOT_BLOCK * _pabBlocks, size_t _sTotal, uint64_t _ui64Signature ) {
+		m_umAotBlocks.clear();
+		if ( _ui64Signature != HandlerSignature() ) { return false; }
+		for ( size_t I = 0; I < _sTotal; ++I ) {
+			m_umAotBlocks[(uint64_t( _pabBlocks[I].ui8Table ) << 24) | _pabBlocks[I].ui32Addr] = &_pabBlocks[I];
+		}
+		return true;
+	}
+
+	/**
+	 * Performs the given number of full cycles (PHI1 followed by PHI2) in a single loop.  Equivalent to calling Tick() and TickPhi2()
+	 *	_ui64Cycles times, but without leaving the CPU between half-cycles.
+	 * 
+	 * \param _ui64Cycles The number of full cycles to perform.
+	 **/
+	void CRicoh5A22::TickCycles( uint64_t _ui64Cycles ) {
+		while ( _ui64Cycles-- ) {
+#if LSN_CPU_THREADED_DISPATCH
+			(this->*m_pfHandlers[m_fsState.pui16CurInstruction[m_fsState.ui8FuncIndex]])();
+			(this->*m_pfHandlers[m_fsState.pui16CurInstruction[m_fsState.ui8FuncIndex]])();
+#else
+			(this->*m_pfTickFunc)();
+			(this->*m_pfTickFunc)();
+#endif	// #if LSN_CPU_THREADED_DISPATCH
+		}
+	}
+
+	/**
+	 * Builds m_pfHandlers and m_ui16InstructionSet from m_iInstructionSet.  Each member-function pointer is 16 bytes on the Itanium ABI (and
+	 *	at least 8 with MSVC), so m_iInstructionSet itself is far too large to keep hot in the cache.  The CPU instead executes from
+	 *	m_ui16InstructionSet, which stores 2-byte indices into the deduplicated m_pfHandlers.
+	 * 
+	 * \return Returns true.
+	 **/
+	bool CRicoh5A22::BuildCompactTables() {
+		m_ui16NextInstruction[0] = HandlerIndex( &CRicoh5A22::Tick_NextInstructionStd );
+		m_ui16FetchOpcode[0] = HandlerIndex( &CRicoh5A22::Fetch_Opcode_IncPc_Phi2 );
+		for ( size_t I = 0; I < std::size( m_iInstructionSet ); ++I ) {
+			for ( size_t J = 0; J < std::size( m_iInstructionSet[I].pfHandler ); ++J ) {
+				for ( size_t K = 0; K < std::size( m_iInstructionSet[I].pfHandler[J] ); ++K ) {
+					m_ui16InstructionSet[J][I][K] = HandlerIndex( m_iInstructionSet[I].pfHandler[J][K] );
+				}
+			}
+		}
+		BuildFusedIdle();
+		return true;
+	}
+
+	/**
+	 * Builds m_ui8FusedIdle from m_ui16InstructionSet.  A half-cycle is idle if its function only advances ui8FuncIndex, optionally
+	 *	applying LSN_UPDATE_PC/LSN_UPDATE_S (the Null() family on PHI1 and Null_Phi2() on PHI2), and each index records how many idle
+	 *	half-cycles start there.
+	 **/
+	void CRicoh5A22::BuildFusedIdle() {
+		// The read/write type of a PHI1 only feeds LSN_INSTR_START_PHI1(), which does nothing, and Null_RorW() differs from Null() only in
+		//	that type.  Variants that call BeginInst() end the instruction and are never idle.
+		struct LSN_IDLE_FUNC {
+			PfCycle														pfFunc;
+			uint8_t														ui8Flags;
+		};
+		static const LSN_IDLE_FUNC ifIdle[] = {
+			{ &CRicoh5A22::Null<LSN_N, false, false>,					0 },
+			{ &CRicoh5A22::Null<LSN_N, true, false>,					LSN_FI_UPDATE_PC },
+			{ &CRicoh5A22::Null<LSN_N, false, true>,					LSN_FI_UPDATE_S },
+			{ &CRicoh5A22::Null<LSN_N, true, true>,						LSN_FI_UPDATE_PC | LSN_FI_UPDATE_S },
+			{ &CRicoh5A22::Null<LSN_R, false, false>,					0 },
+			{ &CRicoh5A22::Null<LSN_R, true, false>,					LSN_FI_UPDATE_PC },
+			{ &CRicoh5A22::Null<LSN_R, false, true>,					LSN_FI_UPDATE_S },
+			{ &CRicoh5A22::Null<LSN_R, true, true>,						LSN_FI_UPDATE_PC | LSN_FI_UPDATE_S },
+			{ &CRicoh5A22::Null<LSN_W, false, false>,					0 },
+			{ &CRicoh5A22::Null<LSN_W, true, false>,					LSN_FI_UPDATE_PC },
+			{ &CRicoh5A22::Null<LSN_W, false, true>,					LSN_FI_UPDATE_S },
+			{ &CRicoh5A22::Null<LSN_W, true, true>,						LSN_FI_UPDATE_PC | LSN_FI_UPDATE_S },
+			{ &CRicoh5A22::Null_RorW<false, false>,						0 },
+			{ &CRicoh5A22::Null_RorW<true, false>,						LSN_FI_UPDATE_PC },
+			{ &CRicoh5A22::Null_RorW<false, true>,						LSN_FI_UPDATE_S },
+			{ &CRicoh5A22::Null_RorW<true, true>,						LSN_FI_UPDATE_PC | LSN_FI_UPDATE_S },
+		};
+		// Flags per handler index, with 0x80 marking idle handlers.  Only handlers already in use have an index.
+		uint8_t ui8Idle[LSN_M_MAX_HANDLERS][2] = {};
+		for ( size_t I = 0; I < std::size( ifIdle ); ++I ) {
+			for ( size_t J = 1; J < m_sTotalHandlers; ++J ) {
+				if ( m_pfHandlers[J] == ifIdle[I].pfFunc ) { ui8Idle[J][1] = uint8_t( 0x80 | ifIdle[I].ui8Flags ); }
+			}
+		}
+		for ( size_t J = 1; J < m_sTotalHandlers; ++J ) {
+			if ( m_pfHandlers[J] == &CRicoh5A22::Null_Phi2 ) { ui8Idle[J][0] = 0x80; }
+		}
+
+		for ( size_t T = 0; T < LSN_IT_TOTAL; ++T ) {
+			for ( size_t O = 0; O < 256; ++O ) {
+				const uint16_t * pui16Cycles = m_ui16InstructionSet[T][O];
+				uint8_t * pui8Fused = m_ui8FusedIdle[T][O];
+				// Index 0 is the opcode fetch, which the fast path never reads from here.  Walk backwards so each run knows its length.
+				uint8_t ui8Halves = 0, ui8Flags = 0;
+				for ( size_t I = LSN_M_MAX_INSTR_CYCLE_COUNT * 2; --I > 0; ) {
+					const uint8_t ui8This = ui8Idle[pui16Cycles[I]][I&1];
+					if ( ui8This ) {
+						++ui8Halves;
+						ui8Flags |= ui8This & (LSN_FI_UPDATE_PC | LSN_FI_UPDATE_S);
+						pui8Fused[I] = uint8_t( ui8Halves | ui8Flags );
+					}
+					else {
+						ui8Halves = ui8Flags = 0;
+						pui8Fused[I] = 0;
+					}
+				}
+			}
+		}
+	}
+
+	/**
+	 * Called by Bus A when a page from which instructions were decoded is written or remapped.  Removes that page's entries from m_diDecodeCache
+	 *	and drops the translated blocks holding opcodes from it.
+	 * 
+	 * \param _pvParm The CRicoh5A22 object.
+	 * \param _ui16Page The page that was written (the full 24-bit address divided by 256).
+	 **/
+	void LSN_FASTCALL CRicoh5A22::PageWritten( void * _pvParm, uint16_t _ui16Page ) {
+		CRicoh5A22 * pcThis = static_cast<CRicoh5A22 *>(_pvParm);
+		// A page maps to 256 consecutive entries.
+		LSN_DECODED_INSTR * pdiEntry = &pcThis->m_diDecodeCache[(uint32_t( _ui16Page ) << 8) & (LSN_M_DECODE_CACHE_SIZE - 1)];
+		for ( size_t I = 0; I < 256; ++I ) {
+			if ( (pdiEntry[I].ui32Addr >> 8) == _ui16Page ) {
+				pdiEntry[I].ui32Addr = UINT32_MAX;
+			}
+		}
+#if LSN_CPU_JIT
+		pcThis->JitInvalidatePage( _ui16Page );
+#endif	// #if LSN_CPU_JIT
+	}
+
+	/**
+	 * Gets the index of a cycle function in m_pfHandlers, adding it if it is not already there.
+	 * 
+	 * \param _pfFunc The function to find or add.
+	 * \return Returns the index of _pfFunc inside m_pfHandlers.
+	 **/
+	uint16_t CRicoh5A22::HandlerIndex( PfCycle _pfFunc ) {
+		if ( nullptr == _pfFunc ) { return 0; }
+		for ( size_t I = 1; I < m_sTotalHandlers; ++I ) {
+			if ( m_pfHandlers[I] == _pfFunc ) { return uint16_t( I ); }
+		}
+		assert( m_sTotalHandlers < LSN_M_MAX_HANDLERS );
+		m_pfHandlers[m_sTotalHandlers] = _pfFunc;
+		return uint16_t( m_sTotalHandlers++ );
+	}
+
+	/**
+	 * Gets a signature of the compact instruction tables.  Generated code refers to cycle functions by their indices in m_pfHandlers, so it
+	 *	can only be run by a CPU core with the same signature.
+	 * 
+	 * \return Returns a hash of m_ui16InstructionSet.
+	 **/
+	uint64_t CRicoh5A22::HandlerSignature() {
+		// FNV-1a.
+		uint64_t ui64Hash = 0xCBF29CE484222325ULL;
+		const uint16_t * pui16Src = &m_ui16InstructionSet[0][0][0];
+		for ( size_t I = 0; I < sizeof( m_ui16InstructionSet ) / sizeof( uint16_t ); ++I ) {
+			ui64Hash = (ui64Hash ^ pui16Src[I]) * 0x100000001B3ULL;
+		}
+		return (ui64Hash ^ m_sTotalHandlers) * 0x100000001B3ULL;
+	}
+
+	/**
+	 * Gets the number of entries an instruction uses in its cycle list, or 0 if it is not implemented.
+	 * 
+	 * \param _sTable The instruction table (an LSN_INSTR_TABLES value).
+	 * \param _ui8Op The opcode.
+	 * \return Returns the length of the cycle list, always ending with the PHI1 that calls BeginInst().
+	 **/
+	size_t CRicoh5A22::InstrCycleLen( size_t _sTable, uint8_t _ui8Op ) {
+		// Unimplemented opcodes get Inst_Jam(), which is left to the interpreter.
+		if ( m_iInstructionSet[_ui8Op].iInstruction == LSN_I_JAM ) { return 0; }
+		const uint16_t * pui16Cycles = m_ui16InstructionSet[_sTable][_ui8Op];
+		size_t sLen = LSN_M_MAX_INSTR_CYCLE_COUNT * 2;
+		while ( sLen && !pui16Cycles[sLen-1] ) { --sLen; }
+		return (sLen >= 2 && (sLen & 1) == 0) ? sLen : 0;
+	}
+
+	/**
+	 * Determines whether an instruction ends a straight-line run of code: it transfers control somewhere other than the next
+	 *	instruction, may repeat itself, stops the clock, or changes the instruction table (E, M, or X).
+	 * 
+	 * \param _iInstruction The instruction.
+	 * \return Returns true if translated code must not assume that the next instruction in memory runs next.
+	 **/
+	bool CRicoh5A22::EndsBlock( LSN_INSTRUCTIONS _iInstruction ) {
+		switch ( _iInstruction ) {
+			case LSN_I_BRK : {}	LSN_FALLTHROUGH
+			case LSN_I_BRL : {}	LSN_FALLTHROUGH
+			case LSN_I_COP : {}	LSN_FALLTHROUGH
+			case LSN_I_JML : {}	LSN_FALLTHROUGH
+			case LSN_I_JMP : {}	LSN_FALLTHROUGH
+			case LSN_I_JSL : {}	LSN_FALLTHROUGH
+			case LSN_I_JSR : {}	LSN_FALLTHROUGH
+			case LSN_I_MVN : {}	LSN_FALLTHROUGH
+			case LSN_I_MVP : {}	LSN_FALLTHROUGH
+			case LSN_I_PLP : {}	LSN_FALLTHROUGH
+			case LSN_I_REP : {}	LSN_FALLTHROUGH
+			case LSN_I_RTI : {}	LSN_FALLTHROUGH
+			case LSN_I_RTL : {}	LSN_FALLTHROUGH
+			case LSN_I_RTS : {}	LSN_FALLTHROUGH
+			case LSN_I_SEP : {}	LSN_FALLTHROUGH
+			case LSN_I_STP : {}	LSN_FALLTHROUGH
+			case LSN_I_WAI : {}	LSN_FALLTHROUGH
+			case LSN_I_XCE : { return true; }
+			default : { return false; }
+		}
+	}
+
+	/**
+	 * Decodes an instruction that RunJit() and CAotCompiler can run natively: the simple loads, stores, ALU operations, flag operations,
+	 *	and transfers with no operand or with an immediate, absolute, or direct-page operand.
+	 * 
+	 * \param _sTable The instruction table (an LSN_INSTR_TABLES value).
+	 * \param _ui8Op The opcode.
+	 * \param _niInstr Filled with the decoded instruction.
+	 * \return Returns true if the instruction can run natively.
+	 **/
+	bool CRicoh5A22::NativeInstr( size_t _sTable, uint8_t _ui8Op, LSN_NATIVE_INSTR &_niInstr ) {
+		_niInstr.nmMode = LSN_NM_IMPLIED;
+		_niInstr.nrReg = LSN_NR_A;
+		_niInstr.nrSrc = LSN_NR_A;
+		_niInstr.ui8Flag = 0;
+		switch ( _ui8Op ) {
+			case 0x18 : { _niInstr.noOp = LSN_NO_CLEAR_FLAG; _niInstr.ui8Flag = C(); break; }
+			case 0x38 : { _niInstr.noOp = LSN_NO_SET_FLAG; _niInstr.ui8Flag = C(); break; }
+			case 0xD8 : { _niInstr.noOp = LSN_NO_CLEAR_FLAG; _niInstr.ui8Flag = D(); break; }
+			case 0xF8 : { _niInstr.noOp = LSN_NO_SET_FLAG; _niInstr.ui8Flag = D(); break; }
+			case 0xB8 : { _niInstr.noOp = LSN_NO_CLEAR_FLAG; _niInstr.ui8Flag = V(); break; }
+			case 0xEA : { _niInstr.noOp = LSN_NO_NOP; break; }
+			case 0xE8 : { _niInstr.noOp = LSN_NO_INC; _niInstr.nrReg = LSN_NR_X; break; }
+			case 0xC8 : { _niInstr.noOp = LSN_NO_INC; _niInstr.nrReg = LSN_NR_Y; break; }
+			case 0xCA : { _niInstr.noOp = LSN_NO_DEC; _niInstr.nrReg = LSN_NR_X; break; }
+			case 0x88 : { _niInstr.noOp = LSN_NO_DEC; _niInstr.nrReg = LSN_NR_Y; break; }
+			case 0x1A : { _niInstr.noOp = LSN_NO_INC; break; }
+			case 0x3A : { _niInstr.noOp = LSN_NO_DEC; break; }
+			case 0x0A : { _niInstr.noOp = LSN_NO_ASL; break; }
+			case 0x4A : { _niInstr.noOp = LSN_NO_LSR; break; }
+			case 0x2A : { _niInstr.noOp = LSN_NO_ROL; break; }
+			case 0x6A : { _niInstr.noOp = LSN_NO_ROR; break; }
+			case 0xAA : { _niInstr.noOp = LSN_NO_TRANSFER; _niInstr.nrReg = LSN_NR_X; break; }
+			case 0xA8 : { _niInstr.noOp = LSN_NO_TRANSFER; _niInstr.nrReg = LSN_NR_Y; break; }
+			case 0x8A : { _niInstr.noOp = LSN_NO_TRANSFER; _niInstr.nrSrc = LSN_NR_X; break; }
+			case 0x98 : { _niInstr.noOp = LSN_NO_TRANSFER; _niInstr.nrSrc = LSN_NR_Y; break; }
+			case 0x9B : { _niInstr.noOp = LSN_NO_TRANSFER; _niInstr.nrReg = LSN_NR_Y; _niInstr.nrSrc = LSN_NR_X; break; }
+			case 0xBB : { _niInstr.noOp = LSN_NO_TRANSFER; _niInstr.nrReg = LSN_NR_X; _niInstr.nrSrc = LSN_NR_Y; break; }
+			case 0x09 : { _niInstr.noOp = LSN_NO_OR; _niInstr.nmMode = LSN_NM_IMMEDIATE; break; }
+			case 0x0D : { _niInstr.noOp = LSN_NO_OR; _niInstr.nmMode = LSN_NM_ABSOLUTE; break; }
+			case 0x05 : { _niInstr.noOp = LSN_NO_OR; _niInstr.nmMode = LSN_NM_DIRECT; break; }
+			case 0x29 : { _niInstr.noOp = LSN_NO_AND; _niInstr.nmMode = LSN_NM_IMMEDIATE; break; }
+			case 0x2D : { _niInstr.noOp = LSN_NO_AND; _niInstr.nmMode = LSN_NM_ABSOLUTE; break; }
+			case 0x25 : { _niInstr.noOp = LSN_NO_AND; _niInstr.nmMode = LSN_NM_DIRECT; break; }
+			case 0x49 : { _niInstr.noOp = LSN_NO_EOR; _niInstr.nmMode = LSN_NM_IMMEDIATE; break; }
+			case 0x4D : { _niInstr.noOp = LSN_NO_EOR; _niInstr.nmMode = LSN_NM_ABSOLUTE; break; }
+			case 0x45 : { _niInstr.noOp = LSN_NO_EOR; _niInstr.nmMode = LSN_NM_DIRECT; break; }
+			case 0x69 : { _niInstr.noOp = LSN_NO_ADC; _niInstr.nmMode = LSN_NM_IMMEDIATE; break; }
+			case 0x6D : { _niInstr.noOp = LSN_NO_ADC; _niInstr.nmMode = LSN_NM_ABSOLUTE; break; }
+			case 0x65 : { _niInstr.noOp = LSN_NO_ADC; _niInstr.nmMode = LSN_NM_DIRECT; break; }
+			case 0xE9 : { _niInstr.noOp = LSN_NO_SBC; _niInstr.nmMode = LSN_NM_IMMEDIATE; break; }
+			case 0xED : { _niInstr.noOp = LSN_NO_SBC; _niInstr.nmMode = LSN_NM_ABSOLUTE; break; }
+			case 0xE5 : { _niInstr.noOp = LSN_NO_SBC; _niInstr.nmMode = LSN_NM_DIRECT; break; }
+			case 0xC9 : { _niInstr.noOp = LSN_NO_CMP; _niInstr.nmMode = LSN_NM_IMMEDIATE; break; }
+			case 0xCD : { _niInstr.noOp = LSN_NO_CMP; _niInstr.nmMode = LSN_NM_ABSOLUTE; break; }
+			case 0xC5 : { _niInstr.noOp = LSN_NO_CMP; _niInstr.nmMode = LSN_NM_DIRECT; break; }
+			case 0xE0 : { _niInstr.noOp = LSN_NO_CMP; _niInstr.nmMode = LSN_NM_IMMEDIATE; _niInstr.nrReg = LSN_NR_X; break; }
+			case 0xEC : { _niInstr.noOp = LSN_NO_CMP; _niInstr.nmMode = LSN_NM_ABSOLUTE; _niInstr.nrReg = LSN_NR_X; break; }
+			case 0xE4 : { _niInstr.noOp = LSN_NO_CMP; _niInstr.nmMode = LSN_NM_DIRECT; _niInstr.nrReg = LSN_NR_X; break; }
+			case 0xC0 : { _niInstr.noOp = LSN_NO_CMP; _niInstr.nmMode = LSN_NM_IMMEDIATE; _niInstr.nrReg = LSN_NR_Y; break; }
+			case 0xCC : { _niInstr.noOp = LSN_NO_CMP; _niInstr.nmMode = LSN_NM_ABSOLUTE; _niInstr.nrReg = LSN_NR_Y; break; }
+			case 0xC4 : { _niInstr.noOp = LSN_NO_CMP; _niInstr.nmMode = LSN_NM_DIRECT; _niInstr.nrReg = LSN_NR_Y; break; }
+			case 0x89 : { _niInstr.noOp = LSN_NO_BIT; _niInstr.nmMode = LSN_NM_IMMEDIATE; break; }
+			case 0x2C : { _niInstr.noOp = LSN_NO_BIT; _niInstr.nmMode = LSN_NM_ABSOLUTE; break; }
+			case 0x24 : { _niInstr.noOp = LSN_NO_BIT; _niInstr.nmMode = LSN_NM_DIRECT; break; }
+			case 0xA9 : { _niInstr.noOp = LSN_NO_LOAD; _niInstr.nmMode = LSN_NM_IMMEDIATE; break; }
+			case 0xAD : { _niInstr.noOp = LSN_NO_LOAD; _niInstr.nmMode = LSN_NM_ABSOLUTE; break; }
+			case 0xA5 : { _niInstr.noOp = LSN_NO_LOAD; _niInstr.nmMode = LSN_NM_DIRECT; break; }
+			case 0xA2 : { _niInstr.noOp = LSN_NO_LOAD; _niInstr.nmMode = LSN_NM_IMMEDIATE; _niInstr.nrReg = LSN_NR_X; break; }
+			case 0xAE : { _niInstr.noOp = LSN_NO_LOAD; _niInstr.nmMode = LSN_NM_ABSOLUTE; _niInstr.nrReg = LSN_NR_X; break; }
+			case 0xA6 : { _niInstr.noOp = LSN_NO_LOAD; _niInstr.nmMode = LSN_NM_DIRECT; _niInstr.nrReg = LSN_NR_X; break; }
+			case 0xA0 : { _niInstr.noOp = LSN_NO_LOAD; _niInstr.nmMode = LSN_NM_IMMEDIATE; _niInstr.nrReg = LSN_NR_Y; break; }
+			case 0xAC : { _niInstr.noOp = LSN_NO_LOAD; _niInstr.nmMode = LSN_NM_ABSOLUTE; _niInstr.nrReg = LSN_NR_Y; break; }
+			case 0xA4 : { _niInstr.noOp = LSN_NO_LOAD; _niInstr.nmMode = LSN_NM_DIRECT; _niInstr.nrReg = LSN_NR_Y; break; }
+			case 0x8D : { _niInstr.noOp = LSN_NO_STORE; _niInstr.nmMode = LSN_NM_ABSOLUTE; break; }
+			case 0x85 : { _niInstr.noOp = LSN_NO_STORE; _niInstr.nmMode = LSN_NM_DIRECT; break; }
+			case 0x8E : { _niInstr.noOp = LSN_NO_STORE; _niInstr.nmMode = LSN_NM_ABSOLUTE; _niInstr.nrReg = LSN_NR_X; break; }
+			case 0x86 : { _niInstr.noOp = LSN_NO_STORE; _niInstr.nmMode = LSN_NM_DIRECT; _niInstr.nrReg = LSN_NR_X; break; }
+			case 0x8C : { _niInstr.noOp = LSN_NO_STORE; _niInstr.nmMode = LSN_NM_ABSOLUTE; _niInstr.nrReg = LSN_NR_Y; break; }
+			case 0x84 : { _niInstr.noOp = LSN_NO_STORE; _niInstr.nmMode = LSN_NM_DIRECT; _niInstr.nrReg = LSN_NR_Y; break; }
+			case 0x9C : { _niInstr.noOp = LSN_NO_STORE; _niInstr.nmMode = LSN_NM_ABSOLUTE; _niInstr.nrReg = LSN_NR_ZERO; break; }
+			case 0x64 : { _niInstr.noOp = LSN_NO_STORE; _niInstr.nmMode = LSN_NM_DIRECT; _niInstr.nrReg = LSN_NR_ZERO; break; }
+			default : { return false; }
+		}
+
+		// The width follows the register written (or compared or stored), so transfers go by their destination.
+		const bool bM16 = _sTable < LSN_IT_M8_X16;
+		const bool bX16 = _sTable == LSN_IT_M16_X16 || _sTable == LSN_IT_M8_X16;
+		_niInstr.bWide = (_niInstr.nrReg == LSN_NR_X || _niInstr.nrReg == LSN_NR_Y) ? bX16 : bM16;
+		static const uint8_t ui8OperandSizes[] = { 0, 0, 2, 1 };
+		_niInstr.ui8OperandSize = _niInstr.nmMode == LSN_NM_IMMEDIATE ? (_niInstr.bWide ? 2 : 1) : ui8OperandSizes[_niInstr.nmMode];
+		return m_iInstructionSet[_ui8Op].ui8Size[_sTable] == _niInstr.ui8OperandSize + 1;
+	}
+
+	/**
+	 * Runs a PHI1 cycle function.  Used by translated and generated blocks.
+	 * 
+	 * \param _pcThis The CPU.
+	 * \param _ui64Handler The index of the function in m_pfHandlers.
+	 * \return Returns the resulting m_fsState.ui8FuncIndex.
+	 **/
+	uint32_t CRicoh5A22::BlockPhi1( CRicoh5A22 * _pcThis, uint64_t _ui64Handler ) {
+		(_pcThis->*m_pfHandlers[_ui64Handler])();
+		return _pcThis->m_fsState.ui8FuncIndex;
+	}
+
+	/**
+	 * Runs a PHI2 cycle function and accounts for the cycle.  Used by translated and generated blocks.
+	 * 
+	 * \param _pcThis The CPU.
+	 * \param _ui64Handler The index of the function in m_pfHandlers.
+	 * \return Returns the resulting m_fsState.ui8FuncIndex, or UINT32_MAX once the next event deadline has been reached.
+	 **/
+	uint32_t CRicoh5A22::BlockPhi2( CRicoh5A22 * _pcThis, uint64_t _ui64Handler ) {
+		(_pcThis->*m_pfHandlers[_ui64Handler])();
+		_pcThis->m_ui64MasterCycles += _pcThis->m_ui8Speed;
+		++_pcThis->m_ui64BlockCycles;
+		// A deadline reached here (possibly registered by this very access) makes the block exit on this cycle boundary.
+		if LSN_UNLIKELY( _pcThis->m_ui64MasterCycles >= _pcThis->m_ui64NextEvent ) { return UINT32_MAX; }
+		return _pcThis->m_fsState.ui8FuncIndex;
+	}
+
+	/**
+	 * Runs a run of idle half-cycles through RunFusedIdle() and accounts for its cycles.  Used by translated blocks.
+	 * 
+	 * \param _pcThis The CPU.
+	 * \param _ui64Fused The run's m_ui8FusedIdle entry.
+	 * \return Returns the resulting m_fsState.ui8FuncIndex, or UINT32_MAX if the run would reach the next event deadline, in which case
+	 *	only the current cycle is finished.
+	 **/
+	uint32_t CRicoh5A22::BlockFusedIdle( CRicoh5A22 * _pcThis, uint64_t _ui64Fused ) {
+		if LSN_LIKELY( _pcThis->RunFusedIdle( uint8_t( _ui64Fused ), _pcThis->m_ui64BlockCycles ) ) { return _pcThis->m_fsState.ui8FuncIndex; }
+		// Leave the rest of the run to the micro-cycle core, which stops exactly at the deadline.
+		if ( !(_pcThis->m_fsState.ui8FuncIndex & 1) ) { BlockFinishCycle( _pcThis ); }
+		return UINT32_MAX;
+	}
+
+	/**
+	 * Used by translated and generated blocks when a PHI1 did not go where expected: runs the matching PHI2 through the instruction table
+	 *	so that the block exits on a cycle boundary.
+	 * 
+	 * \param _pcThis The CPU.
+	 * \return Returns 0.
+	 **/
+	uint32_t CRicoh5A22::BlockFinishCycle( CRicoh5A22 * _pcThis ) {
+		_pcThis->TickPhi2();
+		_pcThis->m_ui64MasterCycles += _pcThis->m_ui8Speed;
+		++_pcThis->m_ui64BlockCycles;
+		return 0;
+	}
+
+	/**
+	 * Used by translated and generated blocks at the end of each instruction to fetch the next opcode and decide whether to keep going.
+	 * 
+	 * \param _pcThis The CPU.
+	 * \param _ui64Valid The address of a bool that must still be true for the block to continue, or 0.
+	 * \param _ui64Expected (table << 32) | (opcode << 24) | PB:PC of the next instruction in the block, or UINT64_MAX if the block ends here.
+	 * \return Returns non-zero if the next instruction in the block can be run.
+	 **/
+	uint32_t CRicoh5A22::BlockFetch( CRicoh5A22 * _pcThis, uint64_t _ui64Valid, uint64_t _ui64Expected ) {
+		if LSN_UNLIKELY( _pcThis->m_bInterruptPending && _pcThis->PollInterrupts() ) {
+			// The fetch turns into an interrupt; leave it to the interpreter.
+			_pcThis->Fetch_Opcode_IncPc_Phi2();
+			_pcThis->m_ui64MasterCycles += _pcThis->m_ui8Speed;
+			++_pcThis->m_ui64BlockCycles;
+			return 0;
+		}
+		_pcThis->Fetch_Opcode_IncPc_Cached_Phi2();
+		_pcThis->m_ui64MasterCycles += _pcThis->m_ui8Speed;
+		++_pcThis->m_ui64BlockCycles;
+
+		const uint64_t ui64Actual = (uint64_t( _pcThis->InstrTableIndex() ) << 32) | (uint64_t( uint8_t( _pcThis->m_fsState.ui16OpCode ) ) << 24) |
+			(uint64_t( _pcThis->m_fsState.rRegs.ui8Pb ) << 16) | _pcThis->m_fsState.rRegs.ui16Pc;
+		return ((!_ui64Valid || (*reinterpret_cast<const bool *>(_ui64Valid))) && ui64Actual == _ui64Expected &&
+			_pcThis->m_ui64MasterCycles < _pcThis->m_ui64BlockLimit &&
+			_pcThis->CanRunFast( uint64_t( LSN_M_MAX_INSTR_CYCLE_COUNT ) * _pcThis->m_ui8XSlowDiv )) ? 1 : 0;
 	}
 
+#if LSN_CPU_JIT
 	/**
-	 * Performs a single PHI2 update.
+	 * Gets the translated block starting at the current instruction, counting the hit and translating the block once it is hot.
+	 * 
+	 * \return Returns the block to run, or nullptr if the instruction is to be interpreted.
 	 **/
-	void CRicoh5A22::TickPhi2() {
-		(this->*m_pfTickFunc)();
+	CRicoh5A22::LSN_JIT_BLOCK * CRicoh5A22::JitBlock() {
+		const uint32_t ui32Addr = (uint32_t( m_fsState.rRegs.ui8Pb ) << 16) | m_fsState.rRegs.ui16Pc;
+		const uint64_t ui64Key = (uint64_t( InstrTableIndex() ) << 24) | ui32Addr;
+		LSN_JIT_BLOCK * pjbBlock;
+		auto aFound = m_umJitBlocks.find( ui64Key );
+		if LSN_LIKELY( aFound != m_umJitBlocks.end() ) {
+			pjbBlock = aFound->second.get();
+			if LSN_LIKELY( pjbBlock->pfCode ) { return (pjbBlock->ui8Op == uint8_t( m_fsState.ui16OpCode )) ? pjbBlock : nullptr; }
+		}
+		else {
+			// MMIO and other special pages are always interpreted.
+			const uint16_t ui16Page = uint16_t( ui32Addr >> 8 );
+			if ( !m_baBusA.IsPlainMemory( ui16Page ) ) { return nullptr; }
+			pjbBlock = (m_umJitBlocks[ui64Key] = std::make_unique<LSN_JIT_BLOCK>()).get();
+			// Forget the hit count (and any failure) if the page changes.
+			m_umJitPages[ui16Page].push_back( ui64Key );
+			m_baBusA.WatchPage( ui16Page );
+		}
+
+		if ( pjbBlock->bUntranslatable || ++pjbBlock->ui32Hits < LSN_M_JIT_HOT_COUNT ) { return nullptr; }
+		if LSN_UNLIKELY( m_jJit.Remaining() < LSN_M_JIT_ARENA_RESERVE ) {
+			// pjbBlock is gone after this; it will be counted again from scratch.
+			FlushJit();
+			return nullptr;
+		}
+		pjbBlock->ui8Op = uint8_t( m_fsState.ui16OpCode );
+		pjbBlock->pfCode = JitTranslate( ui64Key, pjbBlock );
+		if ( !pjbBlock->pfCode ) {
+			pjbBlock->bUntranslatable = true;
+			return nullptr;
+		}
+		return pjbBlock;
 	}
 
+	/**
+	 * Translates the block of instructions that starts at the current instruction.
+	 * 
+	 * \param _ui64Key The key of the block ((table << 24) | PB:PC).
+	 * \param _pjbBlock The block being translated, whose bValid is passed to BlockFetch() so that it can stop once the block is invalidated.
+	 * \return Returns the translated code, or nullptr if nothing could be translated.
+	 **/
+	CJitX64::PfFunc CRicoh5A22::JitTranslate( uint64_t _ui64Key, LSN_JIT_BLOCK * _pjbBlock ) {
+		const size_t sTable = size_t( _ui64Key >> 24 );
+		uint8_t ui8Pb = uint8_t( _ui64Key >> 16 );
+		uint16_t ui16Pc = uint16_t( _ui64Key );
+		// The opcode was fetched by the cycle that just ran.
+		uint8_t ui8Op = uint8_t( m_fsState.ui16OpCode );
+		size_t sLen = InstrCycleLen( sTable, ui8Op );
+		if ( !sLen ) { return nullptr; }
+
+		m_jJit.BeginFunction();
+		const CJitX64::Label lExit = m_jJit.ExitLabel();
+		const CJitX64::Label lFinish = m_jJit.NewLabel();
+		for ( size_t N = 0; N < LSN_M_JIT_MAX_BLOCK_INSTR; ++N ) {
+			// Every instruction starts right after its opcode fetch (index 1) and ends with the PHI1 that calls BeginInst() (back to index 0).
+			const uint16_t * pui16Cycles = m_ui16InstructionSet[sTable][ui8Op];
+			const uint8_t * pui8Fused = m_ui8FusedIdle[sTable][ui8Op];
+			CJitX64::Label lCycles[LSN_M_MAX_INSTR_CYCLE_COUNT*2+1];
+			for ( size_t I = 1; I <= sLen; ++I ) { lCycles[I] = m_jJit.NewLabel(); }
+			// Simple instructions run natively, falling back to the cycle functions (lCycles[1]) when their data access is not plain memory.
+			if ( JitNative( sTable, ui8Op, ui8Pb, ui16Pc, _ui64Key, lCycles[1] ) ) { m_jJit.Jmp( lCycles[sLen] ); }
+			for ( size_t I = 1; I < sLen; ++I ) {
+				if ( pui8Fused[I] ) {
+					// A run of idle half-cycles is a single call.  Skips can land on any PHI1 inside it, so those get the rest of the run.
+					if ( pui8Fused[I-1] && !(I & 1) ) { continue; }
+					const size_t sNext = I + (pui8Fused[I] & LSN_FI_HALVES_MASK);
+					m_jJit.Bind( lCycles[I] );
+					m_jJit.Call( reinterpret_cast<const void *>(&CRicoh5A22::BlockFusedIdle), pui8Fused[I] );
+					m_jJit.CmpEaxJne( uint32_t( sNext ), lExit );
+					m_jJit.Jmp( lCycles[sNext] );
+					continue;
+				}
+				m_jJit.Bind( lCycles[I] );
+				if ( I & 1 ) {
+					// PHI1.  These only ever step to the next function, but a mismatch would leave the CPU between half-cycles.
+					m_jJit.Call( reinterpret_cast<const void *>(&CRicoh5A22::BlockPhi1), pui16Cycles[I] );
+					m_jJit.CmpEaxJne( (I == sLen - 1) ? 0 : uint32_t( I + 1 ), lFinish );
+				}
+				else {
+					// PHI2.  Skips (D.l == 0, no index page cross, Branch_Phi2(), etc.) jump over whole cycles to a later PHI1.
+					m_jJit.Call( reinterpret_cast<const void *>(&CRicoh5A22::BlockPhi2), pui16Cycles[I] );
+					for ( size_t J = I + 3; J < sLen; J += 2 ) {
+						m_jJit.CmpEaxJe( uint32_t( J ), lCycles[J] );
+					}
+					m_jJit.CmpEaxJne( uint32_t( I + 1 ), lExit );
+				}
+			}
+			m_jJit.Bind( lCycles[sLen] );
+
+			// Decide whether the block continues with the instruction that should follow.
+			const LSN_INSTR & iInstr = m_iInstructionSet[ui8Op];
+			ui16Pc = uint16_t( ui16Pc + iInstr.ui8Size[sTable] );
+			const uint16_t ui16Page = uint16_t( (uint32_t( ui8Pb ) << 8) | (ui16Pc >> 8) );
+			uint64_t ui64Expected = UINT64_MAX;
+			if ( !EndsBlock( iInstr.iInstruction ) && N + 1 < LSN_M_JIT_MAX_BLOCK_INSTR && m_baBusA.IsPlainMemory( ui16Page ) ) {
+				ui8Op = m_baBusA.DebugRead( ui16Pc, ui8Pb );
+				sLen = InstrCycleLen( sTable, ui8Op );
+				if ( sLen ) {
+					ui64Expected = (uint64_t( sTable ) << 32) | (uint64_t( ui8Op ) << 24) | (uint64_t( ui8Pb ) << 16) | ui16Pc;
+					m_umJitPages[ui16Page].push_back( _ui64Key );
+					m_baBusA.WatchPage( ui16Page );
+				}
+			}
+			m_jJit.Call( reinterpret_cast<const void *>(&CRicoh5A22::BlockFetch), reinterpret_cast<uint64_t>(&_pjbBlock->bValid), ui64Expected );
+			if ( ui64Expected == UINT64_MAX ) { break; }
+			m_jJit.TestEaxJz( lExit );
+		}
+		m_jJit.Jmp( lExit );
+
+		m_jJit.Bind( lFinish );
+		m_jJit.Call( reinterpret_cast<const void *>(&CRicoh5A22::BlockFinishCycle), 0 );
+		return m_jJit.EndFunction();
+	}
+
+	/**
+	 * Emits an instruction as native x86-64 code, if it is one of the simple loads, stores, ALU operations, flag operations, or transfers
+	 *	that can run without the cycle functions.  The native code picks up right after the opcode fetch and leaves the CPU exactly as
+	 *	the cycle functions would at the end of the instruction.  Before any side effect it checks that each data access lands in plain
+	 *	memory (and that stores do not hit a watched page) and that ADC/SBC are in binary mode, and jumps to _lSlow otherwise.
+	 * 
+	 * \param _sTable The instruction table (an LSN_INSTR_TABLES value).
+	 * \param _ui8Op The opcode.
+	 * \param _ui8Pb The bank of the instruction.
+	 * \param _ui16Pc The address of the opcode.
+	 * \param _ui64Key The key of the block, registered with each extra page holding the instruction's operand.
+	 * \param _lSlow The label of the instruction's cycle-by-cycle translation.
+	 * \return Returns true if native code was emitted, in which case it falls through when done.
+	 **/
+	bool CRicoh5A22::JitNative( size_t _sTable, uint8_t _ui8Op, uint8_t _ui8Pb, uint16_t _ui16Pc, uint64_t _ui64Key, CJitX64::Label _lSlow ) {
+#if LSN_CPU_THREADED_DISPATCH
+		typedef CJitX64 J;
+		auto aOff = [this]( const void * _pvMember ) {
+			return int32_t( reinterpret_cast<const uint8_t *>(_pvMember) - reinterpret_cast<const uint8_t *>(this) );
+		};
+		const int32_t i32A = aOff( &m_fsState.rRegs.ui16A );
+		const int32_t i32X = aOff( &m_fsState.rRegs.ui16X );
+		const int32_t i32Y = aOff( &m_fsState.rRegs.ui16Y );
+
+		LSN_NATIVE_INSTR niInstr;
+		if ( !NativeInstr( _sTable, _ui8Op, niInstr ) ) { return false; }
+		const LSN_NATIVE_OPS noOp = niInstr.noOp;
+		const LSN_NATIVE_MODES nmMode = niInstr.nmMode;
+		const bool bWide = niInstr.bWide;
+		const uint8_t ui8OperandSize = niInstr.ui8OperandSize;
+		// i32Reg is the register operated on (-1 for STZ), i32Src the source of a transfer.
+		const int32_t i32Regs[] = { i32A, i32X, i32Y, -1 };
+		const int32_t i32Reg = i32Regs[niInstr.nrReg], i32Src = i32Regs[niInstr.nrSrc];
+		const J::LSN_SIZE sWidth = bWide ? J::LSN_S_16 : J::LSN_S_8;
+		const bool bData = nmMode == LSN_NM_ABSOLUTE || nmMode == LSN_NM_DIRECT;
+		const bool bRead = noOp != LSN_NO_STORE;
+		const uint8_t ui8Size = uint8_t( ui8OperandSize + 1 );
+
+		// == Translate-time checks.  The operand bytes are constants of the block, so they must come from memory whose writes are caught.
+		uint8_t ui8Bytes[2] = {};
+		uint32_t ui32FetchSpeeds[2] = {};
+		uint8_t ui8LastSpeeds[2] = { m_ui8FastDiv, m_ui8FastDiv };
+		const uint16_t ui16OpPage = uint16_t( (uint32_t( _ui8Pb ) << 8) | (_ui16Pc >> 8) );
+		for ( uint8_t I = 0; I < ui8OperandSize; ++I ) {
+			const uint16_t ui16Addr = uint16_t( _ui16Pc + 1 + I );
+			if ( !m_baBusA.IsPlainMemory( uint16_t( (uint32_t( _ui8Pb ) << 8) | (ui16Addr >> 8) ) ) ) { return false; }
+			ui8Bytes[I] = m_baBusA.DebugRead( ui16Addr, _ui8Pb );
+			for ( uint8_t J = 0; J < 2; ++J ) {
+				ui8LastSpeeds[J] = m_baBusA.Speed( ui16Addr, _ui8Pb, J );
+				ui32FetchSpeeds[J] += ui8LastSpeeds[J];
+			}
+		}
+		const uint16_t ui16Operand = uint16_t( ui8Bytes[0] | (ui8Bytes[1] << 8) );
+		// A 16-bit access whose high byte is on the next page (or bank) is left to the cycle functions.
+		if ( nmMode == LSN_NM_ABSOLUTE && bWide && uint8_t( ui16Operand ) == 0xFF ) { return false; }
+		// Operand bytes are consecutive, so each page after the opcode's is new.
+		uint16_t ui16LastPage = ui16OpPage;
+		for ( uint8_t I = 0; I < ui8OperandSize; ++I ) {
+			const uint16_t ui16Page = uint16_t( (uint32_t( _ui8Pb ) << 8) | (uint16_t( _ui16Pc + 1 + I ) >> 8) );
+			if ( ui16Page != ui16LastPage ) {
+				m_umJitPages[ui16Page].push_back( _ui64Key );
+				m_baBusA.WatchPage( ui16Page );
+				ui16LastPage = ui16Page;
+			}
+		}
+
+		const CBusA::LSN_JIT_VIEW jvBus = m_baBusA.JitView();
+		const J::LSN_MEM mStatus = J::Mem( J::LSN_R_BX, aOff( &m_fsState.rRegs.ui8Status ) );
+		const J::LSN_MEM mReg = J::Mem( J::LSN_R_BX, i32Reg );
+		const J::LSN_MEM mBlockCycles = J::Mem( J::LSN_R_BX, aOff( &m_ui64BlockCycles ) );
+		const int32_t i32HotMemory = int32_t( offsetof( CBusA::LSN_HOT_ACCESSOR, uiMemory ) );
+		const int32_t i32HotSpeeds = int32_t( offsetof( CBusA::LSN_HOT_ACCESSOR, ui8Speeds ) );
+		const int32_t i32HotFlags = int32_t( offsetof( CBusA::LSN_HOT_ACCESSOR, ui8Flags ) );
+		uint32_t ui32Cycles = nmMode == LSN_NM_IMPLIED ? 1 : (ui8OperandSize + (bData ? (bWide ? 2 : 1) : 0));
+
+		// == Guards.  Nothing has been changed yet when any of these go to _lSlow.
+		// The window checked by CanRunFast() (before the block and by BlockFetch()) covers the whole instruction, and plain memory never
+		//	moves the next event, so there is no deadline to check.
+		if ( noOp == LSN_NO_ADC || noOp == LSN_NO_SBC ) {
+			m_jJit.TestImm( J::LSN_S_8, mStatus, D() );
+			m_jJit.Jcc( J::LSN_C_NE, _lSlow );
+		}
+		// With a data access: R8 = its LSN_HOT_ACCESSOR, and mHost its host address (R10 plus the low byte).
+		J::LSN_MEM mHost = J::Mem( J::LSN_R_R10 );
+		if ( nmMode == LSN_NM_ABSOLUTE ) {
+			m_jJit.Load( J::LSN_R_AX, J::LSN_S_8, J::Mem( J::LSN_R_BX, aOff( &m_fsState.rRegs.ui8Db ) ) );
+			m_jJit.MovImm( J::LSN_R_R8, reinterpret_cast<uint64_t>(jvBus.ppaBanks) );
+			m_jJit.Load( J::LSN_R_R8, J::LSN_S_64, J::Mem( J::LSN_R_R8, 0, J::LSN_R_AX, 8 ) );
+			m_jJit.AluImm( J::LSN_ALU_ADD, J::LSN_S_64, J::LSN_R_R8, int32_t( (ui16Operand >> 8) * sizeof( CBusA::LSN_HOT_ACCESSOR ) ) );
+			mHost.i32Disp = uint8_t( ui16Operand );
+		}
+		else if ( nmMode == LSN_NM_DIRECT ) {
+			// ECX = D + dp in bank 0.  In emulation mode that is also DH:dp when D.l is 0.
+			m_jJit.Load( J::LSN_R_CX, J::LSN_S_16, J::Mem( J::LSN_R_BX, aOff( &m_fsState.rRegs.ui16D ) ) );
+			m_jJit.AluImm( J::LSN_ALU_ADD, J::LSN_S_32, J::LSN_R_CX, ui8Bytes[0] );
+			m_jJit.AluImm( J::LSN_ALU_AND, J::LSN_S_32, J::LSN_R_CX, 0xFFFF );
+			if ( bWide ) {
+				m_jJit.AluImm( J::LSN_ALU_CMP, J::LSN_S_8, J::LSN_R_CX, 0xFF );
+				m_jJit.Jcc( J::LSN_C_E, _lSlow );
+			}
+			m_jJit.MovImm( J::LSN_R_R8, reinterpret_cast<uint64_t>(jvBus.ppaBanks) );
+			m_jJit.Load( J::LSN_R_R8, J::LSN_S_64, J::Mem( J::LSN_R_R8 ) );
+			m_jJit.Mov( J::LSN_S_32, J::LSN_R_AX, J::LSN_R_CX );
+			m_jJit.AluImm( J::LSN_ALU_AND, J::LSN_S_32, J::LSN_R_AX, 0xFF00 );
+			static_assert( sizeof( CBusA::LSN_HOT_ACCESSOR ) == 16, "The page of a direct-page address is scaled by shifting." );
+			m_jJit.Shift( J::LSN_SH_SHR, J::LSN_S_32, J::LSN_R_AX, 4 );
+			m_jJit.Alu( J::LSN_ALU_ADD, J::LSN_S_64, J::LSN_R_R8, J::LSN_R_AX );
+			m_jJit.Mov( J::LSN_S_32, J::LSN_R_AX, J::LSN_R_CX );
+			m_jJit.AluImm( J::LSN_ALU_AND, J::LSN_S_32, J::LSN_R_AX, 0xFF );
+			mHost.rIndex = J::LSN_R_AX;
+		}
+		if ( bData ) {
+			m_jJit.Load( J::LSN_R_R10, J::LSN_S_64, J::Mem( J::LSN_R_R8, i32HotMemory ) );
+			if ( bRead ) {
+				// The same choice as CBusA::Read(): the bus's memory, then a direct pointer.
+				const J::Label lMemory = m_jJit.NewLabel();
+				const J::Label lHost = m_jJit.NewLabel();
+				m_jJit.TestImm( J::LSN_S_8, J::Mem( J::LSN_R_R8, i32HotFlags ), CMemoryMap::LSN_AF_MEMORY_READ );
+				m_jJit.Jcc( J::LSN_C_NE, lMemory );
+				m_jJit.TestImm( J::LSN_S_8, J::Mem( J::LSN_R_R8, i32HotFlags ), CMemoryMap::LSN_AF_DIRECT_READ );
+				m_jJit.Jcc( J::LSN_C_E, _lSlow );
+				m_jJit.Jmp( lHost );
+				m_jJit.Bind( lMemory );
+				m_jJit.MovImm( J::LSN_R_R11, reinterpret_cast<uint64_t>(jvBus.ppui8Memory) );
+				m_jJit.AluLoad( J::LSN_ALU_ADD, J::LSN_S_64, J::LSN_R_R10, J::Mem( J::LSN_R_R11 ) );
+				m_jJit.Bind( lHost );
+			}
+			else {
+				// Only the bus's memory, and only if the write would not have to be reported (a watched page, such as one holding code).
+				m_jJit.TestImm( J::LSN_S_8, J::Mem( J::LSN_R_R8, i32HotFlags ), CMemoryMap::LSN_AF_MEMORY_WRITE );
+				m_jJit.Jcc( J::LSN_C_E, _lSlow );
+				m_jJit.Mov( J::LSN_S_64, J::LSN_R_R11, J::LSN_R_R10 );
+				m_jJit.Shift( J::LSN_SH_SHR, J::LSN_S_64, J::LSN_R_R11, 8 );
+				m_jJit.AluImm( J::LSN_ALU_AND, J::LSN_S_32, J::LSN_R_R11, 0xFFFF );
+				m_jJit.MovImm( J::LSN_R_R9, reinterpret_cast<uint64_t>(jvBus.pui8WatchedPages) );
+				m_jJit.AluStoreImm( J::LSN_ALU_CMP, J::LSN_S_8, J::Mem( J::LSN_R_R9, 0, J::LSN_R_R11 ), 0 );
+				m_jJit.Jcc( J::LSN_C_NE, _lSlow );
+				m_jJit.MovImm( J::LSN_R_R11, reinterpret_cast<uint64_t>(jvBus.ppui8Memory) );
+				m_jJit.AluLoad( J::LSN_ALU_ADD, J::LSN_S_64, J::LSN_R_R10, J::Mem( J::LSN_R_R11 ) );
+			}
+		}
+
+		// == Timing.  R9 = the master-clock ticks of the whole instruction, EDX = the speed of the last cycle.
+		const bool bMemSel = bData || ui32FetchSpeeds[0] != ui32FetchSpeeds[1] || ui8LastSpeeds[0] != ui8LastSpeeds[1];
+		if ( bMemSel ) {
+			m_jJit.MovImm( J::LSN_R_R11, reinterpret_cast<uint64_t>(jvBus.pui8MemSel) );
+			m_jJit.Load( J::LSN_R_R11, J::LSN_S_8, J::Mem( J::LSN_R_R11 ) );
+		}
+		// Program fetches: the sum for MEMSEL = 0, plus MEMSEL times the difference.
+		auto aSelect = [&]( J::LSN_REG _rDst, uint32_t _ui32Speed0, uint32_t _ui32Speed1 ) {
+			if ( _ui32Speed0 == _ui32Speed1 ) {
+				m_jJit.MovImm( _rDst, _ui32Speed0 );
+				return;
+			}
+			m_jJit.Mov( J::LSN_S_32, _rDst, J::LSN_R_R11 );
+			m_jJit.Imul( _rDst, int32_t( _ui32Speed1 - _ui32Speed0 ) );
+			m_jJit.AluImm( J::LSN_ALU_ADD, J::LSN_S_32, _rDst, int32_t( _ui32Speed0 ) );
+		};
+		if ( nmMode == LSN_NM_IMPLIED ) {
+			m_jJit.MovImm( J::LSN_R_R9, m_ui8FastDiv );
+			m_jJit.MovImm( J::LSN_R_DX, m_ui8FastDiv );
+		}
+		else {
+			aSelect( J::LSN_R_R9, ui32FetchSpeeds[0], ui32FetchSpeeds[1] );
+			if ( bData ) {
+				m_jJit.Load( J::LSN_R_DX, J::LSN_S_8, J::Mem( J::LSN_R_R8, i32HotSpeeds, J::LSN_R_R11 ) );
+				for ( uint32_t I = bWide ? 2 : 1; I--; ) {
+					m_jJit.Alu( J::LSN_ALU_ADD, J::LSN_S_32, J::LSN_R_R9, J::LSN_R_DX );
+				}
+			}
+			else {
+				aSelect( J::LSN_R_DX, ui8LastSpeeds[0], ui8LastSpeeds[1] );
+			}
+		}
+
+		// == The addressing mode's own state.
+		if ( nmMode == LSN_NM_ABSOLUTE ) {
+			m_jJit.StoreImm( J::Mem( J::LSN_R_BX, aOff( &m_fsState.ui16Address ) ), J::LSN_S_16, ui16Operand );
+			m_jJit.Load( J::LSN_R_CX, J::LSN_S_8, J::Mem( J::LSN_R_BX, aOff( &m_fsState.rRegs.ui8Db ) ) );
+			m_jJit.Store( J::Mem( J::LSN_R_BX, aOff( &m_fsState.ui8Bank ) ), J::LSN_S_8, J::LSN_R_CX );
+		}
+		else if ( nmMode == LSN_NM_DIRECT ) {
+			m_jJit.Store( J::Mem( J::LSN_R_BX, aOff( &m_fsState.ui16Address ) ), J::LSN_S_16, J::LSN_R_CX );
+			m_jJit.StoreImm( J::Mem( J::LSN_R_BX, aOff( &m_fsState.ui16Pointer ) ), J::LSN_S_16, ui8Bytes[0] );
+			// The idle cycle taken when D.l is not 0.
+			m_jJit.Alu( J::LSN_ALU_XOR, J::LSN_S_32, J::LSN_R_CX, J::LSN_R_CX );
+			m_jJit.AluStoreImm( J::LSN_ALU_CMP, J::LSN_S_8, J::Mem( J::LSN_R_BX, aOff( &m_fsState.rRegs.ui8D[0] ) ), 0 );
+			m_jJit.SetCc( J::LSN_C_NE, J::LSN_R_CX );
+			m_jJit.AluStore( J::LSN_ALU_ADD, J::LSN_S_64, mBlockCycles, J::LSN_R_CX );
+			m_jJit.Imul( J::LSN_R_CX, m_ui8FastDiv );
+			m_jJit.Alu( J::LSN_ALU_ADD, J::LSN_S_32, J::LSN_R_R9, J::LSN_R_CX );
+		}
+		m_jJit.AluStore( J::LSN_ALU_ADD, J::LSN_S_64, J::Mem( J::LSN_R_BX, aOff( &m_ui64MasterCycles ) ), J::LSN_R_R9 );
+		m_jJit.AluStoreImm( J::LSN_ALU_ADD, J::LSN_S_64, mBlockCycles, int32_t( ui32Cycles ) );
+		m_jJit.Store( J::Mem( J::LSN_R_BX, aOff( &m_ui8Speed ) ), J::LSN_S_8, J::LSN_R_DX );
+
+		// == The operand (ECX) and the data bus, which holds the last byte read or written.
+		const J::LSN_MEM mOperand = J::Mem( J::LSN_R_BX, aOff( &m_fsState.ui16Operand ) );
+		J::LSN_MEM mHostHigh = mHost;
+		++mHostHigh.i32Disp;
+		if ( nmMode == LSN_NM_IMMEDIATE ) {
+			m_jJit.StoreImm( mOperand, J::LSN_S_16, ui16Operand );
+			m_jJit.MovImm( J::LSN_R_R8, reinterpret_cast<uint64_t>(jvBus.pui8DataBus) );
+			m_jJit.StoreImm( J::Mem( J::LSN_R_R8 ), J::LSN_S_8, ui8Bytes[ui8OperandSize-1] );
+			m_jJit.MovImm( J::LSN_R_CX, ui16Operand );
+		}
+		else if ( bData && bRead ) {
+			m_jJit.Load( J::LSN_R_CX, sWidth, mHost );
+			m_jJit.Store( mOperand, J::LSN_S_16, J::LSN_R_CX );
+			m_jJit.MovImm( J::LSN_R_R8, reinterpret_cast<uint64_t>(jvBus.pui8DataBus) );
+			if ( bWide ) {
+				m_jJit.Load( J::LSN_R_R11, J::LSN_S_8, mHostHigh );
+				m_jJit.Store( J::Mem( J::LSN_R_R8 ), J::LSN_S_8, J::LSN_R_R11 );
+			}
+			else {
+				m_jJit.Store( J::Mem( J::LSN_R_R8 ), J::LSN_S_8, J::LSN_R_CX );
+			}
+		}
+		else if ( bData ) {
+			// Stores write the whole register to the operand, then as many bytes as the width to memory.
+			if ( i32Reg >= 0 ) { m_jJit.Load( J::LSN_R_CX, J::LSN_S_16, mReg ); }
+			else { m_jJit.Alu( J::LSN_ALU_XOR, J::LSN_S_32, J::LSN_R_CX, J::LSN_R_CX ); }
+			m_jJit.Store( mOperand, J::LSN_S_16, J::LSN_R_CX );
+			m_jJit.Store( mHost, sWidth, J::LSN_R_CX );
+			m_jJit.MovImm( J::LSN_R_R8, reinterpret_cast<uint64_t>(jvBus.pui8DataBus) );
+			if ( bWide ) {
+				m_jJit.Mov( J::LSN_S_32, J::LSN_R_R11, J::LSN_R_CX );
+				m_jJit.Shift( J::LSN_SH_SHR, J::LSN_S_32, J::LSN_R_R11, 8 );
+				m_jJit.Store( J::Mem( J::LSN_R_R8 ), J::LSN_S_8, J::LSN_R_R11 );
+			}
+			else {
+				m_jJit.Store( J::Mem( J::LSN_R_R8 ), J::LSN_S_8, J::LSN_R_CX );
+			}
+			m_jJit.MovImm( J::LSN_R_R8, reinterpret_cast<uint64_t>(jvBus.pui64IdleStable) );
+			m_jJit.StoreImm( J::Mem( J::LSN_R_R8 ), J::LSN_S_64, 0 );
+		}
+
+		// == The operation.  The result is in AX; the new flags are N = CL, Z = DL, C = R8B, V = R9B (each 0 or 1).
+		const J::LSN_MEM mA = J::Mem( J::LSN_R_BX, i32A );
+		uint8_t ui8Flags = 0;
+		switch ( noOp ) {
+			case LSN_NO_LOAD : {
+				m_jJit.Store( mReg, sWidth, J::LSN_R_CX );
+				m_jJit.Test( sWidth, J::LSN_R_CX, J::LSN_R_CX );
+				ui8Flags = N() | Z();
+				break;
+			}
+			case LSN_NO_OR : {}			LSN_FALLTHROUGH
+			case LSN_NO_AND : {}			LSN_FALLTHROUGH
+			case LSN_NO_EOR : {
+				static const J::LSN_ALU aOps[] = { J::LSN_ALU_OR, J::LSN_ALU_AND, J::LSN_ALU_XOR };
+				m_jJit.Load( J::LSN_R_AX, sWidth, mA );
+				m_jJit.Alu( aOps[noOp-LSN_NO_OR], sWidth, J::LSN_R_AX, J::LSN_R_CX );
+				m_jJit.Store( mA, sWidth, J::LSN_R_AX );
+				ui8Flags = N() | Z();
+				break;
+			}
+			case LSN_NO_ADC : {}			LSN_FALLTHROUGH
+			case LSN_NO_SBC : {
+				// SBC is ADC of the complement, which is x86's SBB with the borrow being the inverse of C.
+				m_jJit.Load( J::LSN_R_AX, sWidth, mA );
+				m_jJit.Load( J::LSN_R_DX, J::LSN_S_8, mStatus );
+				m_jJit.Shift( J::LSN_SH_SHR, J::LSN_S_8, J::LSN_R_DX, 1 );
+				if ( noOp == LSN_NO_SBC ) { m_jJit.Cmc(); }
+				m_jJit.Alu( noOp == LSN_NO_SBC ? J::LSN_ALU_SBB : J::LSN_ALU_ADC, sWidth, J::LSN_R_AX, J::LSN_R_CX );
+				m_jJit.Store( mA, sWidth, J::LSN_R_AX );
+				m_jJit.SetCc( noOp == LSN_NO_SBC ? J::LSN_C_AE : J::LSN_C_B, J::LSN_R_R8 );
+				m_jJit.SetCc( J::LSN_C_O, J::LSN_R_R9 );
+				ui8Flags = N() | Z() | C() | V();
+				break;
+			}
+			case LSN_NO_CMP : {
+				m_jJit.Load( J::LSN_R_AX, sWidth, mReg );
+				m_jJit.Alu( J::LSN_ALU_CMP, sWidth, J::LSN_R_AX, J::LSN_R_CX );
+				m_jJit.SetCc( J::LSN_C_AE, J::LSN_R_R8 );
+				ui8Flags = N() | Z() | C();
+				break;
+			}
+			case LSN_NO_BIT : {
+				// Z from A & operand.  From memory, N and V are bits 7 and 6 of the operand's top byte, kept in R11B.
+				m_jJit.Load( J::LSN_R_AX, sWidth, mA );
+				m_jJit.Alu( J::LSN_ALU_AND, sWidth, J::LSN_R_AX, J::LSN_R_CX );
+				m_jJit.SetCc( J::LSN_C_E, J::LSN_R_DX );
+				ui8Flags = Z();
+				if ( bData ) {
+					m_jJit.Mov( J::LSN_S_32, J::LSN_R_R11, J::LSN_R_CX );
+					if ( bWide ) { m_jJit.Shift( J::LSN_SH_SHR, J::LSN_S_32, J::LSN_R_R11, 8 ); }
+					m_jJit.AluImm( J::LSN_ALU_AND, J::LSN_S_32, J::LSN_R_R11, N() | V() );
+				}
+				break;
+			}
+			case LSN_NO_INC : {}			LSN_FALLTHROUGH
+			case LSN_NO_DEC : {
+				m_jJit.Load( J::LSN_R_AX, sWidth, mReg );
+				m_jJit.AluImm( noOp == LSN_NO_INC ? J::LSN_ALU_ADD : J::LSN_ALU_SUB, sWidth, J::LSN_R_AX, 1 );
+				m_jJit.Store( mReg, sWidth, J::LSN_R_AX );
+				ui8Flags = N() | Z();
+				break;
+			}
+			case LSN_NO_ASL : {}			LSN_FALLTHROUGH
+			case LSN_NO_LSR : {
+				m_jJit.Load( J::LSN_R_AX, sWidth, mA );
+				m_jJit.Shift( noOp == LSN_NO_ASL ? J::LSN_SH_SHL : J::LSN_SH_SHR, sWidth, J::LSN_R_AX, 1 );
+				m_jJit.Store( mA, sWidth, J::LSN_R_AX );
+				m_jJit.SetCc( J::LSN_C_B, J::LSN_R_R8 );
+				ui8Flags = N() | Z() | C();
+				break;
+			}
+			case LSN_NO_ROL : {}			LSN_FALLTHROUGH
+			case LSN_NO_ROR : {
+				// RCL/RCR set only C (and O), so N and Z come from testing the result.
+				m_jJit.Load( J::LSN_R_AX, sWidth, mA );
+				m_jJit.Load( J::LSN_R_DX, J::LSN_S_8, mStatus );
+				m_jJit.Shift( J::LSN_SH_SHR, J::LSN_S_8, J::LSN_R_DX, 1 );
+				m_jJit.Shift( noOp == LSN_NO_ROL ? J::LSN_SH_RCL : J::LSN_SH_RCR, sWidth, J::LSN_R_AX, 1 );
+				m_jJit.Store( mA, sWidth, J::LSN_R_AX );
+				m_jJit.SetCc( J::LSN_C_B, J::LSN_R_R8 );
+				m_jJit.Test( sWidth, J::LSN_R_AX, J::LSN_R_AX );
+				ui8Flags = N() | Z() | C();
+				break;
+			}
+			case LSN_NO_TRANSFER : {
+				m_jJit.Load( J::LSN_R_AX, sWidth, J::Mem( J::LSN_R_BX, i32Src ) );
+				m_jJit.Store( mReg, sWidth, J::LSN_R_AX );
+				m_jJit.Test( sWidth, J::LSN_R_AX, J::LSN_R_AX );
+				ui8Flags = N() | Z();
+				break;
+			}
+			case LSN_NO_SET_FLAG : {
+				m_jJit.AluStoreImm( J::LSN_ALU_OR, J::LSN_S_8, mStatus, niInstr.ui8Flag );
+				break;
+			}
+			case LSN_NO_CLEAR_FLAG : {
+				m_jJit.AluStoreImm( J::LSN_ALU_AND, J::LSN_S_8, mStatus, uint8_t( ~niInstr.ui8Flag ) );
+				break;
+			}
+			default : {}
+		}
+		if ( ui8Flags ) {
+			if ( ui8Flags & N() ) { m_jJit.SetCc( J::LSN_C_S, J::LSN_R_CX ); }
+			if ( (ui8Flags & Z()) && noOp != LSN_NO_BIT ) { m_jJit.SetCc( J::LSN_C_E, J::LSN_R_DX ); }
+			const uint8_t ui8Cleared = uint8_t( ui8Flags | ((noOp == LSN_NO_BIT && bData) ? (N() | V()) : 0) );
+			m_jJit.Load( J::LSN_R_AX, J::LSN_S_8, mStatus );
+			m_jJit.AluImm( J::LSN_ALU_AND, J::LSN_S_8, J::LSN_R_AX, uint8_t( ~ui8Cleared ) );
+			if ( ui8Flags & N() ) {
+				m_jJit.Shift( J::LSN_SH_SHL, J::LSN_S_8, J::LSN_R_CX, 7 );
+				m_jJit.Alu( J::LSN_ALU_OR, J::LSN_S_8, J::LSN_R_AX, J::LSN_R_CX );
+			}
+			if ( ui8Flags & Z() ) {
+				m_jJit.Shift( J::LSN_SH_SHL, J::LSN_S_8, J::LSN_R_DX, 1 );
+				m_jJit.Alu( J::LSN_ALU_OR, J::LSN_S_8, J::LSN_R_AX, J::LSN_R_DX );
+			}
+			if ( ui8Flags & C() ) { m_jJit.Alu( J::LSN_ALU_OR, J::LSN_S_8, J::LSN_R_AX, J::LSN_R_R8 ); }
+			if ( ui8Flags & V() ) {
+				m_jJit.Shift( J::LSN_SH_SHL, J::LSN_S_8, J::LSN_R_R9, 6 );
+				m_jJit.Alu( J::LSN_ALU_OR, J::LSN_S_8, J::LSN_R_AX, J::LSN_R_R9 );
+			}
+			if ( noOp == LSN_NO_BIT && bData ) { m_jJit.Alu( J::LSN_ALU_OR, J::LSN_S_8, J::LSN_R_AX, J::LSN_R_R11 ); }
+			m_jJit.Store( mStatus, J::LSN_S_8, J::LSN_R_AX );
+		}
+
+		// == The end of the instruction, as left by BeginInst().
+		m_jJit.StoreImm( J::Mem( J::LSN_R_BX, aOff( &m_fsState.rRegs.ui16Pc ) ), J::LSN_S_16, uint16_t( _ui16Pc + ui8Size ) );
+		m_jJit.StoreImm( J::Mem( J::LSN_R_BX, aOff( &m_fsState.ui16PcModify ) ), J::LSN_S_16, 0 );
+		m_jJit.StoreImm( J::Mem( J::LSN_R_BX, aOff( &m_fsState.ui8FuncIndex ) ), J::LSN_S_8, 0 );
+		m_jJit.StoreImm( J::Mem( J::LSN_R_BX, aOff( &m_fsState.bBoundaryCrossed ) ), J::LSN_S_8, 0 );
+		m_jJit.MovImm( J::LSN_R_AX, reinterpret_cast<uint64_t>(&m_ui16FetchOpcode[0]) );
+		m_jJit.Store( J::Mem( J::LSN_R_BX, aOff( &m_fsState.pui16CurInstruction ) ), J::LSN_S_64, J::LSN_R_AX );
+
+#ifdef LSN_CPU_VERIFY
+		// The accesses in bus order, for VerifyEngine().
+		for ( uint8_t I = 0; I < ui8OperandSize; ++I ) {
+			m_jJit.Call( reinterpret_cast<const void *>(&CRicoh5A22::BlockLogFetch),
+				(uint64_t( ui8Bytes[I] ) << 24) | (uint64_t( _ui8Pb ) << 16) | uint16_t( _ui16Pc + 1 + I ) );
+		}
+		if ( bData ) {
+			m_jJit.Call( reinterpret_cast<const void *>(&CRicoh5A22::BlockLogData),
+				(bWide ? LSN_JLF_WORD : 0) | (nmMode == LSN_NM_DIRECT ? LSN_JLF_BANK0 : 0) | (bRead ? LSN_JLF_READ : 0) );
+		}
+#endif	// #ifdef LSN_CPU_VERIFY
+		return true;
+#else
+		// Native code would have to set m_pfTickFunc, a member-function pointer.
+		static_cast<void>(_sTable); static_cast<void>(_ui8Op); static_cast<void>(_ui8Pb); static_cast<void>(_ui16Pc);
+		static_cast<void>(_ui64Key); static_cast<void>(_lSlow);
+		return false;
+#endif	// #if LSN_CPU_THREADED_DISPATCH
+	}
+
+	/**
+	 * Drops every block holding an opcode on the given page.
+	 * 
+	 * \param _ui16Page The page that was written (the full 24-bit address divided by 256).
+	 **/
+	void CRicoh5A22::JitInvalidatePage( uint16_t _ui16Page ) {
+		auto aPage = m_umJitPages.find( _ui16Page );
+		if ( aPage == m_umJitPages.end() ) { return; }
+		for ( size_t I = 0; I < aPage->second.size(); ++I ) {
+			auto aBlock = m_umJitBlocks.find( aPage->second[I] );
+			if ( aBlock != m_umJitBlocks.end() ) {
+				// The block may be running right now (this is called from inside a bus write), so it is retired rather than freed.
+				aBlock->second->bValid = false;
+				m_vJitRetired.push_back( std::move( aBlock->second ) );
+				m_umJitBlocks.erase( aBlock );
+			}
+		}
+		m_umJitPages.erase( aPage );
+	}
+
+#endif	// #if LSN_CPU_JIT
+
 #ifdef LSN_CPU_VERIFY
+	/**
+	 * Logs a program fetch made by native code, which reads instruction bytes without going through the bus.
+	 * 
+	 * \param _pcThis The CPU.
+	 * \param _ui64Access The 24-bit address, with the value in bits 24-31.
+	 * \return Returns 0.
+	 **/
+	uint32_t CRicoh5A22::BlockLogFetch( CRicoh5A22 * _pcThis, uint64_t _ui64Access ) {
+		_pcThis->m_baBusA.LogDirectAccess( uint32_t( _ui64Access & 0xFFFFFF ), uint8_t( _ui64Access >> 24 ), true );
+		return 0;
+	}
+
+	/**
+	 * Logs the data access made by native code, using the address and operand that it left in m_fsState.
+	 * 
+	 * \param _pcThis The CPU.
+	 * \param _ui64Flags LSN_JIT_LOG_FLAGS describing the access.
+	 * \return Returns 0.
+	 **/
+	uint32_t CRicoh5A22::BlockLogData( CRicoh5A22 * _pcThis, uint64_t _ui64Flags ) {
+		const uint32_t ui32Bank = (_ui64Flags & LSN_JLF_BANK0) ? 0 : (uint32_t( _pcThis->m_fsState.ui8Bank ) << 16);
+		const uint32_t ui32Address = ui32Bank | _pcThis->m_fsState.ui16Address;
+		const bool bRead = (_ui64Flags & LSN_JLF_READ) != 0;
+		_pcThis->m_baBusA.LogDirectAccess( ui32Address, _pcThis->m_fsState.ui8Operand[0], bRead );
+		// Native code never takes a 16-bit access across a page.
+		if ( _ui64Flags & LSN_JLF_WORD ) { _pcThis->m_baBusA.LogDirectAccess( ui32Address + 1, _pcThis->m_fsState.ui8Operand[1], bRead ); }
+		return 0;
+	}
+
 	/**
 	 * Runs a test given a JSON's value representing the test to run.
 	 *
@@ -47,37 +1185,8 @@ namespace lsn {
 		LSN_CPU_VERIFY_OBJ cvoVerifyMe;
 		if ( !GetTest( _jJson, _jvTest, cvoVerifyMe ) ) { return false; }
 
-		// Create the initial state.
-		Reset<true>();
-		m_baBusA.ApplyBasicMapping();				// Set default read/write functions.
-		m_ui64CycleCount = 0;
-		
-		m_fsState.rRegs.ui16A = cvoVerifyMe.cvsStart.cvrRegisters.ui16A;
-		m_fsState.rRegs.ui16S = cvoVerifyMe.cvsStart.cvrRegisters.ui16S;
-		m_fsState.rRegs.ui16X = cvoVerifyMe.cvsStart.cvrRegisters.ui16X;
-		m_fsState.rRegs.ui16Y = cvoVerifyMe.cvsStart.cvrRegisters.ui16Y;
-
-		m_fsState.rRegs.ui16D = cvoVerifyMe.cvsStart.cvrRegisters.ui16D;
-		m_fsState.rRegs.ui8Db = cvoVerifyMe.cvsStart.cvrRegisters.ui8Db;
-		m_fsState.rRegs.ui8Pb = cvoVerifyMe.cvsStart.cvrRegisters.ui8Pb;
-		
-		m_fsState.rRegs.ui8Status = cvoVerifyMe.cvsStart.cvrRegisters.ui8Status;
-		m_fsState.rRegs.ui16Pc = cvoVerifyMe.cvsStart.cvrRegisters.ui16Pc;
-		m_fsState.bEmulationMode = cvoVerifyMe.cvsStart.bEmulationMode;
-
-		uint8_t ui8Speed;
-		{
-			for ( auto I = cvoVerifyMe.cvsStart.vRam.size(); I--; ) {
-				m_baBusA.Write( uint16_t( cvoVerifyMe.cvsStart.vRam[I].ui32Addr ), uint8_t( cvoVerifyMe.cvsStart.vRam[I].ui32Addr >> 16 ), cvoVerifyMe.cvsStart.vRam[I].ui8Value, ui8Speed );
-			}
-		}
-
-		if ( "01 n 2" == cvoVerifyMe.sName ) {
-			volatile int ghg = 0;
-		}
+		SetTestState( cvoVerifyMe );
 		// Tick once for each cycle.
-		m_fsState.ui16Operand = m_baBusA.Read( m_fsState.rRegs.ui16Pc, m_fsState.rRegs.ui8Pb, ui8Speed );
-		m_fsState.ui16PcModify = 1;
 		m_baBusA.ReadWriteLog().clear();
 		/*for ( auto I = cvoVerifyMe.vCycles.size(); I--; ) {
 			Tick();
@@ -93,7 +1202,6 @@ namespace lsn {
 					lsn::DebugA( "\r\nDouble-check polling.\r\n" );
 				}
 			}*/
-			m_bDetectedNmi = true;
 			TickPhi2();
 			/*if ( m_iInstructionSet[m_fsState.ui16OpCode].iInstruction != LSN_I_JAM && m_iInstructionSet[m_fsState.ui16OpCode].iInstruction != LSN_I_BRK &&
 				m_iInstructionSet[m_fsState.ui16OpCode].iInstruction != LSN_I_BPL && m_iInstructionSet[m_fsState.ui16OpCode].iInstruction != LSN_I_BNE && m_iInstructionSet[m_fsState.ui16OpCode].iInstruction != LSN_I_BVC && m_iInstructionSet[m_fsState.ui16OpCode].iInstruction != LSN_I_BVS &&
@@ -111,9 +1219,11 @@ namespace lsn {
 		}
 
 		// Verify.
+		bool bRet = true;
 #define LSN_VURIFFY( REG )																																											\
 	if ( m_fsState.rRegs.REG != cvoVerifyMe.cvsEnd.cvrRegisters.REG ) {																																\
 		lsn::DebugA( cvoVerifyMe.sName.c_str() );																																					\
+		bRet = false;																																												\
 		lsn::DebugA( "\r\nCPU Failure: " # REG "\r\n" );																																			\
 		lsn::DebugA( (std::string( "Expected: ") + std::to_string( cvoVerifyMe.cvsEnd.cvrRegisters.REG ) + std::string( " Got: " ) + std::to_string( m_fsState.rRegs.REG ) ).c_str() );				\
 		lsn::DebugA( "\r\n\r\n" );																																									\
@@ -135,6 +1245,7 @@ namespace lsn {
 
 		if ( m_baBusA.ReadWriteLog().size() > cvoVerifyMe.vCycles.size() ) {
 			lsn::DebugA( cvoVerifyMe.sName.c_str() );
+			bRet = false;
 			lsn::DebugA( "\r\nInternal Error\r\n" );
 			lsn::DebugA( "\r\n\r\n" );
 		}
@@ -144,18 +1255,21 @@ namespace lsn {
 				if ( cvoVerifyMe.vCycles[I].bNoReadOrWrite == false ) {
 					if ( m_baBusA.ReadWriteLog()[J].ui32Address != cvoVerifyMe.vCycles[I].ui32Addr ) {
 						lsn::DebugA( cvoVerifyMe.sName.c_str() );
+						bRet = false;
 						lsn::DebugA( "\r\nCPU Failure: Cycle Address Wrong\r\n" );
 						lsn::DebugA( (std::string( "Expected: ") + std::to_string( cvoVerifyMe.vCycles[I].ui32Addr ) + std::string( " Got: " ) + std::to_string( m_baBusA.ReadWriteLog()[J].ui32Address ) ).c_str() );
 						lsn::DebugA( "\r\n\r\n" );
 					}
 					if ( m_baBusA.ReadWriteLog()[J].ui8Value != cvoVerifyMe.vCycles[I].ui8Value ) {
 						lsn::DebugA( cvoVerifyMe.sName.c_str() );
+						bRet = false;
 						lsn::DebugA( "\r\nCPU Failure: Cycle Value Wrong\r\n" );
 						lsn::DebugA( (std::string( "Expected: ") + std::to_string( cvoVerifyMe.vCycles[I].ui8Value ) + std::string( " Got: " ) + std::to_string( m_baBusA.ReadWriteLog()[J].ui8Value ) ).c_str() );
 						lsn::DebugA( "\r\n\r\n" );
 					}
 					if ( m_baBusA.ReadWriteLog()[J].bRead != (cvoVerifyMe.vCycles[I].sStatus[3] == 'r') ) {
 						lsn::DebugA( cvoVerifyMe.sName.c_str() );
+						bRet = false;
 						lsn::DebugA( "\r\nCPU Failure: Cycle Read/Write Wrong\r\n" );
 						lsn::DebugA( (std::string( "Expected: ") + std::to_string( cvoVerifyMe.vCycles[I].sStatus[3] ) + std::string( " Got: " ) + std::to_string( m_baBusA.ReadWriteLog()[J].bRead ) ).c_str() );
 						lsn::DebugA( "\r\n\r\n" );
@@ -164,12 +1278,14 @@ namespace lsn {
 				
 				if ( ((m_baBusA.ReadWriteLog()[J].ui8S & X()) != 0) != (cvoVerifyMe.vCycles[I].sStatus[6] == 'x') ) {
 					lsn::DebugA( cvoVerifyMe.sName.c_str() );
+					bRet = false;
 					lsn::DebugA( "\r\nCPU Failure: Cycle Status.X Wrong\r\n" );
 					lsn::DebugA( (std::string( "Expected: ") + std::to_string( cvoVerifyMe.vCycles[I].sStatus[6] ) + std::string( " Got: " ) + std::to_string( ((m_baBusA.ReadWriteLog()[J].ui8S & X()) != 0) ) ).c_str() );
 					lsn::DebugA( "\r\n\r\n" );
 				}
 				if ( ((m_baBusA.ReadWriteLog()[J].ui8S & M()) != 0) != (cvoVerifyMe.vCycles[I].sStatus[5] == 'm') ) {
 					lsn::DebugA( cvoVerifyMe.sName.c_str() );
+					bRet = false;
 					lsn::DebugA( "\r\nCPU Failure: Cycle Status.M Wrong\r\n" );
 					lsn::DebugA( (std::string( "Expected: ") + std::to_string( cvoVerifyMe.vCycles[I].sStatus[5] ) + std::string( " Got: " ) + std::to_string( ((m_baBusA.ReadWriteLog()[J].ui8S & M()) != 0) ) ).c_str() );
 					lsn::DebugA( "\r\n\r\n" );
@@ -177,7 +1293,542 @@ namespace lsn {
 				++J;
 			}
 		}
-		return true;
+		bRet = VerifyEngine( cvoVerifyMe, &CRicoh5A22::RunInstructions, "RunInstructions" ) && bRet;
+#if LSN_CPU_JIT
+		bRet = VerifyEngine( cvoVerifyMe, &CRicoh5A22::RunJit, "RunJit" ) && bRet;
+#endif	// #if LSN_CPU_JIT
+		// No generated blocks are registered here (the tests' code is in RAM), so every instruction goes through RunAot()'s own loop.
+		bRet = VerifyEngine( cvoVerifyMe, &CRicoh5A22::RunAot, "RunAot" ) && bRet;
+		return bRet;
+	}
+
+	/**
+	 * Times the micro-cycle dispatch loop over every test in a JSON file.  Each test's initial state is loaded once, untimed, and its cycles
+	 *	are then run _ui32Passes times, restoring the CPU state (but not RAM) before each pass.
+	 * LSN_BD_INDEX_TABLE runs them with Tick()/TickPhi2().  LSN_BD_MEMBER_POINTERS dispatches the same half-cycles through the member-function
+	 *	pointers in m_iInstructionSet, the form the CPU executed before m_ui16InstructionSet; since the cycle functions only maintain
+	 *	m_fsState.pui16CurInstruction, it looks up the matching row whenever that changes.  LSN_BD_INDEX_TABLE_TRACKED does the same lookup
+	 *	but dispatches through the index table, so that the difference from LSN_BD_MEMBER_POINTERS is that of the tables alone.
+	 *
+	 * \param _jJson The JSON file.
+	 * \param _jvRoot The array of tests.
+	 * \param _ui32Passes The number of times to run each test.
+	 * \param _bdDispatch How each half-cycle is dispatched.
+	 * \return Returns the average time per cycle in nanoseconds, or 0.0 if no test could be loaded.
+	 */
+	double CRicoh5A22::BenchJsonTests( lson::CJson &_jJson, const lson::CJsonContainer::LSON_JSON_VALUE &_jvRoot, uint32_t _ui32Passes,
+		LSN_BENCH_DISPATCH _bdDispatch ) {
+		static const PfCycle pfNextInstruction[1] = { &CRicoh5A22::Tick_NextInstructionStd };
+		static const PfCycle pfFetchOpcode[1] = { &CRicoh5A22::Fetch_Opcode_IncPc_Phi2 };
+		// The row of m_iInstructionSet (or the 1-entry tables) matching a row of m_ui16InstructionSet.
+		auto MemberPointerRow = []( const uint16_t * _pui16Row ) -> const PfCycle * {
+			if ( _pui16Row == m_ui16NextInstruction ) { return pfNextInstruction; }
+			if ( _pui16Row == m_ui16FetchOpcode ) { return pfFetchOpcode; }
+			const size_t sOffset = size_t( _pui16Row - &m_ui16InstructionSet[0][0][0] );
+			const size_t sTable = sOffset / (256 * LSN_M_MAX_INSTR_CYCLE_COUNT * 2);
+			const size_t sOp = sOffset / (LSN_M_MAX_INSTR_CYCLE_COUNT * 2) % 256;
+			return m_iInstructionSet[sOp].pfHandler[sTable];
+		};
+		// The same search, landing back on the index table.
+		auto IndexRow = []( const uint16_t * _pui16Row ) -> const uint16_t * {
+			if ( _pui16Row == m_ui16NextInstruction || _pui16Row == m_ui16FetchOpcode ) { return _pui16Row; }
+			const size_t sOffset = size_t( _pui16Row - &m_ui16InstructionSet[0][0][0] );
+			const size_t sTable = sOffset / (256 * LSN_M_MAX_INSTR_CYCLE_COUNT * 2);
+			const size_t sOp = sOffset / (LSN_M_MAX_INSTR_CYCLE_COUNT * 2) % 256;
+			return m_ui16InstructionSet[sTable][sOp];
+		};
+
+		double dTime = 0.0;
+		uint64_t ui64Cycles = 0;
+		for ( size_t I = 0; I < _jvRoot.vArray.size(); ++I ) {
+			LSN_CPU_VERIFY_OBJ cvoTest;
+			if ( !GetTest( _jJson, _jJson.GetContainer()->GetValue( _jvRoot.vArray[I] ), cvoTest ) ) { continue; }
+			SetTestState( cvoTest );
+			m_baBusA.ReadWriteLog().clear();
+			const LSN_FULL_STATE fsStart = m_fsState;
+			// Every cycle is a PHI1 and a PHI2, then the PHI1 that finishes the instruction.
+			const size_t sHalfCycles = cvoTest.vCycles.size() * 2 + 1;
+
+			CTimer tTimer;
+			tTimer.Start();
+			for ( uint32_t P = 0; P < _ui32Passes; ++P ) {
+				m_fsState = fsStart;
+				switch ( _bdDispatch ) {
+					case LSN_BD_INDEX_TABLE : {
+						for ( auto J = cvoTest.vCycles.size(); J--; ) {
+							Tick();
+							TickPhi2();
+						}
+						Tick();
+						break;
+					}
+					case LSN_BD_INDEX_TABLE_TRACKED : {
+						const uint16_t * pui16Cur = nullptr;
+						const uint16_t * pui16Row = nullptr;
+						for ( auto J = sHalfCycles; J--; ) {
+							if ( m_fsState.pui16CurInstruction != pui16Cur ) {
+								pui16Cur = m_fsState.pui16CurInstruction;
+								pui16Row = IndexRow( pui16Cur );
+							}
+							(this->*m_pfHandlers[pui16Row[m_fsState.ui8FuncIndex]])();
+						}
+						break;
+					}
+					case LSN_BD_MEMBER_POINTERS : {
+						const uint16_t * pui16Cur = nullptr;
+						const PfCycle * pfRow = nullptr;
+						for ( auto J = sHalfCycles; J--; ) {
+							if ( m_fsState.pui16CurInstruction != pui16Cur ) {
+								pui16Cur = m_fsState.pui16CurInstruction;
+								pfRow = MemberPointerRow( pui16Cur );
+							}
+							(this->*pfRow[m_fsState.ui8FuncIndex])();
+						}
+						break;
+					}
+				}
+			}
+			tTimer.Stop();
+			dTime += tTimer.ElapsedNanoseconds();
+			ui64Cycles += cvoTest.vCycles.size() * _ui32Passes;
+		}
+		return ui64Cycles ? dTime / double( ui64Cycles ) : 0.0;
+	}
+
+	/**
+	 * Runs a polling loop (LDA ($10,X) / BEQ back to it, then BRA to itself once the polled register reads non-zero) in slices through
+	 *	RunUntilMasterClock() and each fast engine, and checks that the fast engines stop in the same states on the same cycles while
+	 *	skipping most passes of the loop.
+	 *
+	 * \return Returns true if every engine matches RunUntilMasterClock().
+	 */
+	bool CRicoh5A22::RunIdleLoopTest() {
+		std::vector<LSN_IDLE_LOOP_STOP> vMicro, vEngine;
+		const uint64_t ui64MicroReads = RunIdleLoop( &CRicoh5A22::RunUntilMasterClock, vMicro );
+
+		bool bRet = true;
+		auto aFail = [&]( const char * _pcName, const char * _pcWhat ) {
+			lsn::DebugA( (std::string( "Idle Loop Failure (" ) + _pcName + "): " + _pcWhat + "\r\n\r\n").c_str() );
+			bRet = false;
+		};
+		if ( vMicro.empty() || vMicro.back().ui16Pc != 0x8004 ) { aFail( "RunUntilMasterClock", "Polling Loop Not Left" ); }
+
+		auto aCheck = [&]( uint64_t (CRicoh5A22::*_pfEngine)( uint64_t ), const char * _pcName ) {
+			vEngine.clear();
+			const uint64_t ui64Reads = RunIdleLoop( _pfEngine, vEngine );
+			for ( size_t I = 0; I < vMicro.size(); ++I ) {
+				if ( vEngine[I].ui64MasterCycles != vMicro[I].ui64MasterCycles || vEngine[I].ui16Pc != vMicro[I].ui16Pc ||
+					vEngine[I].ui16A != vMicro[I].ui16A || vEngine[I].ui8Status != vMicro[I].ui8Status ) {
+					aFail( _pcName, "Stop Wrong" );
+					break;
+				}
+			}
+#if LSN_CPU_IDLE_LOOPS
+			if ( ui64Reads * LSN_ILT_MIN_SKIP > ui64MicroReads ) { aFail( _pcName, "Polling Loop Not Skipped" ); }
+#else
+			static_cast<void>(ui64Reads);
+#endif	// #if LSN_CPU_IDLE_LOOPS
+		};
+		aCheck( &CRicoh5A22::RunInstructions, "RunInstructions" );
+#if LSN_CPU_JIT
+		aCheck( &CRicoh5A22::RunJit, "RunJit" );
+#endif	// #if LSN_CPU_JIT
+		// LSNAotFixture.cpp was generated from the same loop at $00:8000.
+		if ( !aotfixture::Register( (*this) ) ) { aFail( "RunAot", "LSNAotFixture.cpp Out of Date" ); }
+		else {
+			aCheck( &CRicoh5A22::RunAot, "RunAot" );
+			SetAotBlocks( nullptr, 0, HandlerSignature() );
+		}
+
+		Reset<true>();
+		m_baBusA.ApplyBasicMapping();
+		return bRet;
+	}
+
+	/**
+	 * Runs the program mapped by MapAotFixture() in slices through RunUntilMasterClock() and RunAot(), with the blocks generated from it
+	 *	(LSNAotFixture.cpp) registered, and checks that RunAot() stops in the same states on the same cycles, makes the same bus
+	 *	accesses, and leaves the same RAM while running instructions natively.
+	 *
+	 * \return Returns true if RunAot() matches RunUntilMasterClock().
+	 */
+	bool CRicoh5A22::RunAotTest() {
+		bool bRet = true;
+		auto aFail = [&]( const char * _pcWhat, uint64_t _ui64Slice ) {
+			lsn::DebugA( (std::string( "AOT Failure: " ) + _pcWhat + " (" + std::to_string( _ui64Slice ) + "-cycle slices)\r\n\r\n").c_str() );
+			bRet = false;
+		};
+		// Short slices leave blocks part of the way through, and the long slice runs every block from its start to its end.
+		for ( uint64_t ui64Slice : { uint64_t( LSN_AT_SHORT_SLICE ), uint64_t( LSN_AT_LONG_SLICE ) } ) {
+			LSN_AOT_TEST_RUN atrMicro, atrAot;
+			RunAotProgram( &CRicoh5A22::RunUntilMasterClock, ui64Slice, atrMicro );
+			if ( atrMicro.vRegs.size() == LSN_AT_MAX_SLICES ) { aFail( "Program Not Ended", ui64Slice ); }
+
+			if ( !aotfixture::Register( (*this) ) ) {
+				aFail( "LSNAotFixture.cpp Out of Date", ui64Slice );
+				break;
+			}
+			m_ui64AotNative = 0;
+			RunAotProgram( &CRicoh5A22::RunAot, ui64Slice, atrAot );
+			SetAotBlocks( nullptr, 0, HandlerSignature() );
+			if ( m_ui64AotNative < (ui64Slice == LSN_AT_LONG_SLICE ? LSN_AT_MIN_NATIVE : 1) ) { aFail( "Too Little Run Natively", ui64Slice ); }
+
+			if ( atrAot.vRegs.size() != atrMicro.vRegs.size() ) { aFail( "Slice Count Wrong", ui64Slice ); }
+			else {
+				for ( size_t I = 0; I < atrMicro.vRegs.size(); ++I ) {
+					const LSN_REGISTERS & rMicro = atrMicro.vRegs[I];
+					const LSN_REGISTERS & rAot = atrAot.vRegs[I];
+					if ( atrAot.vMasterCycles[I] != atrMicro.vMasterCycles[I] || rAot.ui16A != rMicro.ui16A || rAot.ui16X != rMicro.ui16X ||
+						rAot.ui16Y != rMicro.ui16Y || rAot.ui16S != rMicro.ui16S || rAot.ui16D != rMicro.ui16D || rAot.ui8Db != rMicro.ui8Db ||
+						rAot.ui8Pb != rMicro.ui8Pb || rAot.ui8Status != rMicro.ui8Status || rAot.ui16Pc != rMicro.ui16Pc ) {
+						aFail( "Stop Wrong", ui64Slice );
+						break;
+					}
+				}
+			}
+			if ( atrAot.vLog.size() != atrMicro.vLog.size() ) { aFail( "Access Count Wrong", ui64Slice ); }
+			else {
+				for ( size_t I = 0; I < atrMicro.vLog.size(); ++I ) {
+					if ( atrAot.vLog[I].ui32Address != atrMicro.vLog[I].ui32Address || atrAot.vLog[I].ui8Value != atrMicro.vLog[I].ui8Value ||
+						atrAot.vLog[I].bRead != atrMicro.vLog[I].bRead ) {
+						aFail( "Access Wrong", ui64Slice );
+						break;
+					}
+				}
+			}
+			if ( atrAot.vRam != atrMicro.vRam ) { aFail( "RAM Wrong", ui64Slice ); }
+		}
+
+		Reset<true>();
+		m_baBusA.ApplyBasicMapping();
+		return bRet;
+	}
+
+	/**
+	 * Times an engine on a loop of plain-memory loads, adds, stores, and compares (the kind of code RunJit() emits natively).  The loop
+	 *	writes RAM every pass, so it is never skipped as a polling loop.
+	 *
+	 * \param _pfEngine The engine to time.
+	 * \param _ui64MasterCycles The number of master cycles to run.
+	 * \return Returns the average time per CPU cycle in nanoseconds.
+	 */
+	double CRicoh5A22::BenchEngine( uint64_t (CRicoh5A22::*_pfEngine)( uint64_t ), uint64_t _ui64MasterCycles ) {
+		// $00:8000 LDX #$00 / LDA $0200 / ADC $10 / STA $0200 / STA $12 / INX / CPX #$40 / BNE $8002 / BRA $8000.
+		LSN_CPU_VERIFY_OBJ cvoLoop {};
+		cvoLoop.cvsStart.cvrRegisters.ui16Pc = 0x8000;
+		cvoLoop.cvsStart.cvrRegisters.ui16S = 0x01FF;
+		cvoLoop.cvsStart.cvrRegisters.ui8Status = M() | X() | I();
+		cvoLoop.cvsStart.bEmulationMode = true;
+		cvoLoop.cvsStart.vRam = { { 0x8000, 0xA2 }, { 0x8001, 0x00 }, { 0x8002, 0xAD }, { 0x8003, 0x00 }, { 0x8004, 0x02 }, { 0x8005, 0x65 },
+			{ 0x8006, 0x10 }, { 0x8007, 0x8D }, { 0x8008, 0x00 }, { 0x8009, 0x02 }, { 0x800A, 0x85 }, { 0x800B, 0x12 }, { 0x800C, 0xE8 },
+			{ 0x800D, 0xE0 }, { 0x800E, 0x40 }, { 0x800F, 0xD0 }, { 0x8010, 0xF1 }, { 0x8011, 0x80 }, { 0x8012, 0xED },
+			{ 0x0010, 0x03 } };
+		SetTestState( cvoLoop );
+		Tick();
+		TickPhi2();
+		m_ui64MasterCycles += m_ui8Speed;
+
+		const uint64_t ui64Stop = m_ui64MasterCycles + _ui64MasterCycles;
+		uint64_t ui64Cycles = 0;
+		CTimer tTimer;
+		tTimer.Start();
+		while ( m_ui64MasterCycles < ui64Stop ) { ui64Cycles += (this->*_pfEngine)( ui64Stop ); }
+		tTimer.Stop();
+
+		Reset<true>();
+		m_baBusA.ApplyBasicMapping();
+		return ui64Cycles ? tTimer.ElapsedNanoseconds() / double( ui64Cycles ) : 0.0;
+	}
+
+	/**
+	 * Maps the program run by RunAotTest() into $00:8000-$8FFF as read-only memory, the way a cartridge maps its ROM.  $8000 holds
+	 *	the polling loop run by RunIdleLoopTest(), and $8010 a program that runs the same loads, stores, ALU operations, flag operations, and
+	 *	transfers in emulation mode and under each native M/X setting, then ends in a branch to itself.
+	 *
+	 * \param _baBus The bus to which to map the program.
+	 */
+	void CRicoh5A22::MapAotFixture( CBusA &_baBus ) {
+		static std::vector<uint8_t> vImage = []() {
+			std::vector<uint8_t> vRom( 0x1000, 0xDB );
+			auto aPut = [&]( uint16_t _ui16Addr, const std::vector<uint8_t> &_vBytes ) {
+				std::copy( _vBytes.begin(), _vBytes.end(), vRom.begin() + (_ui16Addr - 0x8000) );
+			};
+			// The body run in emulation mode and under each setting of M and X, ending with RTS.  D is 0 in the first two and 1 in the
+			//	others.
+			auto aBody = [&]( uint16_t _ui16Addr, bool _bM16, bool _bX16 ) {
+				std::vector<uint8_t> vCode;
+				auto aOp = [&]( std::initializer_list<uint8_t> _ilBytes ) { vCode.insert( vCode.end(), _ilBytes ); };
+				auto aImm = [&]( uint8_t _ui8Op, uint16_t _ui16Imm, bool _bWide ) {
+					aOp( { _ui8Op, uint8_t( _ui16Imm ) } );
+					if ( _bWide ) { aOp( { uint8_t( _ui16Imm >> 8 ) } ); }
+				};
+				// Operands in RAM: LDA #/STA $20, LDA #/STA $0300, LDX #/STX $22, LDY #/STY $0302, STZ $24, STZ $0304.
+				aImm( 0xA9, 0xA55A, _bM16 );		aOp( { 0x85, 0x20 } );
+				aImm( 0xA9, 0x3CC3, _bM16 );		aOp( { 0x8D, 0x00, 0x03 } );
+				aImm( 0xA2, 0x7F81, _bX16 );		aOp( { 0x86, 0x22 } );
+				aImm( 0xA0, 0x807F, _bX16 );		aOp( { 0x8C, 0x02, 0x03 } );
+				aOp( { 0x64, 0x24, 0x9C, 0x04, 0x03 } );
+				// CLC / ADC #, ADC $20, ADC $0300 / SEC / SBC #, SBC $22, SBC $0302 / STA $26.
+				aOp( { 0x18 } );
+				aImm( 0x69, 0x70F0, _bM16 );		aOp( { 0x65, 0x20, 0x6D, 0x00, 0x03 } );
+				aOp( { 0x38 } );
+				aImm( 0xE9, 0x8011, _bM16 );		aOp( { 0xE5, 0x22, 0xED, 0x02, 0x03, 0x85, 0x26 } );
+				// ORA #, ORA $20 / AND #, AND $0300 / EOR #, EOR $22 / STA $0306.
+				aImm( 0x09, 0x000F, _bM16 );		aOp( { 0x05, 0x20 } );
+				aImm( 0x29, 0xF3F3, _bM16 );		aOp( { 0x2D, 0x00, 0x03 } );
+				aImm( 0x49, 0xFFFF, _bM16 );		aOp( { 0x45, 0x22, 0x8D, 0x06, 0x03 } );
+				// CMP #, CMP $20, CMP $0300 / CPX #, CPX $22, CPX $0300 / CPY #, CPY $0302, CPY $20 / BIT #, BIT $20, BIT $0300.
+				aImm( 0xC9, 0x0010, _bM16 );		aOp( { 0xC5, 0x20, 0xCD, 0x00, 0x03 } );
+				aImm( 0xE0, 0x7F81, _bX16 );		aOp( { 0xE4, 0x22, 0xEC, 0x00, 0x03 } );
+				aImm( 0xC0, 0x0080, _bX16 );		aOp( { 0xCC, 0x02, 0x03, 0xC4, 0x20 } );
+				aImm( 0x89, 0x4040, _bM16 );		aOp( { 0x24, 0x20, 0x2C, 0x00, 0x03 } );
+				// INC A, DEC A, INX, INY, DEX, DEY / ASL A, ROL A, LSR A, ROR A, CLV / TAX, TAY, TXA, TYA, TXY, TYX / STA $28.
+				aOp( { 0x1A, 0x3A, 0xE8, 0xC8, 0xCA, 0x88 } );
+				aOp( { 0x0A, 0x2A, 0x4A, 0x6A, 0xB8 } );
+				aOp( { 0xAA, 0xA8, 0x8A, 0x98, 0x9B, 0xBB, 0x85, 0x28 } );
+				// LDA $20, LDX $0300, LDY $22, LDA $0302, LDX $24, LDY $0304 / STA $2A, STX $0308, STY $2C, STA $030A, NOP.
+				aOp( { 0xA5, 0x20, 0xAE, 0x00, 0x03, 0xA4, 0x22, 0xAD, 0x02, 0x03, 0xA6, 0x24, 0xAC, 0x04, 0x03 } );
+				aOp( { 0x85, 0x2A, 0x8E, 0x08, 0x03, 0x84, 0x2C, 0x8D, 0x0A, 0x03, 0xEA } );
+				// Left to the cycle functions: decimal ADC and SBC (SED / ADC #, SBC $20 / CLD), 16-bit accesses that end on $FF (LDA $FE with
+				//	D = 1, LDA $03FF), and STA to ROM.  LDA $8F80 reads the ROM natively.
+				aOp( { 0xF8 } );
+				aImm( 0x69, 0x1919, _bM16 );		aOp( { 0xE5, 0x20, 0xD8 } );
+				aOp( { 0xA5, 0xFE, 0xAD, 0xFF, 0x03, 0xAD, 0x80, 0x8F, 0x8D, 0x80, 0x8F, 0x60 } );
+				aPut( _ui16Addr, vCode );
+			};
+
+			// $8000: LDA ($10,X) / BEQ $8000 / BRA $8004.
+			aPut( 0x8000, { 0xA1, 0x10, 0xF0, 0xFC, 0x80, 0xFE } );
+			// $8010: JSR $8100 / CLC / XCE / JSR $8200 / REP #$30 / LDA #$0001 / TCD / JSR $8300 / SEP #$20 / JSR $8400 / REP #$20 / SEP #$10 /
+			//	JSR $8500 / BRA $802D.
+			aPut( 0x8010, { 0x20, 0x00, 0x81, 0x18, 0xFB, 0x20, 0x00, 0x82, 0xC2, 0x30, 0xA9, 0x01, 0x00, 0x5B, 0x20, 0x00, 0x83, 0xE2, 0x20,
+				0x20, 0x00, 0x84, 0xC2, 0x20, 0xE2, 0x10, 0x20, 0x00, 0x85, 0x80, 0xFE } );
+			aBody( 0x8100, false, false );
+			aBody( 0x8200, false, false );
+			aBody( 0x8300, true, true );
+			aBody( 0x8400, false, true );
+			aBody( 0x8500, true, false );
+			aPut( 0x8F80, { 0xC3, 0x5A } );
+			return vRom;
+		}();
+
+		for ( uint16_t I = 0; I < 0x10; ++I ) {
+			_baBus.SetAccessor( uint16_t( 0x0080 + I ), &CMemoryMap::OpenBusRead, nullptr, &CMemoryMap::NullWrite, nullptr,
+				nullptr, &CMemoryMap::NullWrite );
+			_baBus.SetDirectAccess( uint16_t( 0x0080 + I ), vImage.data() + I * 0x100, true, false );
+		}
+	}
+
+	/**
+	 * Gets the entry points of the program mapped by MapAotFixture(), from which CAotCompiler generates LSNAotFixture.cpp.
+	 *
+	 * \return Returns the entry points, as (table << 24) | PB:PC.
+	 */
+	std::vector<uint64_t> CRicoh5A22::AotFixtureEntries() {
+		// The polling loop, the program, and the code after XCE, which ends a block without a known successor.
+		return { (uint64_t( LSN_IT_EMULATION ) << 24) | 0x008000, (uint64_t( LSN_IT_EMULATION ) << 24) | 0x008010,
+			(uint64_t( LSN_IT_M8_X8 ) << 24) | 0x008015 };
+	}
+
+	/**
+	 * Loads a test's initial state: registers, RAM, and the operand that the first cycle expects to have been read.
+	 *
+	 * \param _cvoTest The test whose initial state is to be loaded.
+	 */
+	void CRicoh5A22::SetTestState( const LSN_CPU_VERIFY_OBJ &_cvoTest ) {
+		Reset<true>();
+		m_baBusA.ApplyBasicMapping();				// Set default read/write functions.
+		m_ui64CycleCount = 0;
+		
+		m_fsState.rRegs.ui16A = _cvoTest.cvsStart.cvrRegisters.ui16A;
+		m_fsState.rRegs.ui16S = _cvoTest.cvsStart.cvrRegisters.ui16S;
+		m_fsState.rRegs.ui16X = _cvoTest.cvsStart.cvrRegisters.ui16X;
+		m_fsState.rRegs.ui16Y = _cvoTest.cvsStart.cvrRegisters.ui16Y;
+
+		m_fsState.rRegs.ui16D = _cvoTest.cvsStart.cvrRegisters.ui16D;
+		m_fsState.rRegs.ui8Db = _cvoTest.cvsStart.cvrRegisters.ui8Db;
+		m_fsState.rRegs.ui8Pb = _cvoTest.cvsStart.cvrRegisters.ui8Pb;
+		
+		m_fsState.rRegs.ui8Status = _cvoTest.cvsStart.cvrRegisters.ui8Status;
+		m_fsState.rRegs.ui16Pc = _cvoTest.cvsStart.cvrRegisters.ui16Pc;
+		m_fsState.bEmulationMode = _cvoTest.cvsStart.bEmulationMode;
+		SelectInstrTable();
+		UpdateInterruptPending();
+
+		uint8_t ui8Speed;
+		{
+			for ( auto I = _cvoTest.cvsStart.vRam.size(); I--; ) {
+				m_baBusA.Write( uint16_t( _cvoTest.cvsStart.vRam[I].ui32Addr ), uint8_t( _cvoTest.cvsStart.vRam[I].ui32Addr >> 16 ), _cvoTest.cvsStart.vRam[I].ui8Value, ui8Speed );
+			}
+		}
+
+		m_fsState.ui16Operand = m_baBusA.Read( m_fsState.rRegs.ui16Pc, m_fsState.rRegs.ui8Pb, ui8Speed );
+		m_fsState.ui16PcModify = 1;
+	}
+
+	/**
+	 * Runs a test through one of the instruction-granular engines and checks that it makes the same bus accesses, takes the same number of
+	 *	cycles and master-clock ticks, and leaves the same registers as the micro-cycle core.  The engines run whole instructions and end
+	 *	with the next opcode fetch, so both runs go one cycle past the end of the test.
+	 *
+	 * \param _cvoTest The test to run.
+	 * \param _pfEngine The engine to check.
+	 * \param _pcName The engine's name, for reporting failures.
+	 * \return Returns true if the engine matches the micro-cycle core.
+	 */
+	bool CRicoh5A22::VerifyEngine( const LSN_CPU_VERIFY_OBJ &_cvoTest, uint64_t (CRicoh5A22::*_pfEngine)( uint64_t ), const char * _pcName ) {
+		// The micro-cycle core.
+		SetTestState( _cvoTest );
+		m_baBusA.ReadWriteLog().clear();
+		m_baBusA.SetLogEveryAccess( true );
+		const uint64_t ui64MicroStart = m_ui64MasterCycles;
+		for ( auto I = _cvoTest.vCycles.size() + 1; I--; ) {
+			Tick();
+			TickPhi2();
+			m_ui64MasterCycles += m_ui8Speed;
+		}
+		const std::vector<CBusA::LSN_READ_WRITE_LOG> vMicroLog = m_baBusA.ReadWriteLog();
+		const LSN_REGISTERS rMicroRegs = m_fsState.rRegs;
+		const uint64_t ui64MicroTicks = m_ui64MasterCycles - ui64MicroStart;
+
+		// The engine, from the same state.  It starts on an instruction boundary, right after the opcode fetch.
+		SetTestState( _cvoTest );
+		m_baBusA.ReadWriteLog().clear();
+		const uint64_t ui64EngineStart = m_ui64MasterCycles;
+		Tick();
+		TickPhi2();
+		m_ui64MasterCycles += m_ui8Speed;
+		const uint64_t ui64Cycles = (this->*_pfEngine)( m_ui64MasterCycles + 1 ) + 1;
+		m_baBusA.SetLogEveryAccess( false );
+
+		bool bRet = true;
+		auto aFail = [&]( const char * _pcWhat ) {
+			lsn::DebugA( _cvoTest.sName.c_str() );
+			lsn::DebugA( (std::string( "\r\nEngine Failure (" ) + _pcName + "): " + _pcWhat + "\r\n\r\n").c_str() );
+			bRet = false;
+		};
+		if ( ui64Cycles != _cvoTest.vCycles.size() + 1 ) { aFail( "Cycle Count Wrong" ); }
+		if ( m_ui64MasterCycles - ui64EngineStart != ui64MicroTicks ) { aFail( "Master Clock Wrong" ); }
+		if ( m_fsState.rRegs.ui16A != rMicroRegs.ui16A || m_fsState.rRegs.ui16X != rMicroRegs.ui16X || m_fsState.rRegs.ui16Y != rMicroRegs.ui16Y ||
+			m_fsState.rRegs.ui16S != rMicroRegs.ui16S || m_fsState.rRegs.ui16D != rMicroRegs.ui16D || m_fsState.rRegs.ui8Db != rMicroRegs.ui8Db ||
+			m_fsState.rRegs.ui8Pb != rMicroRegs.ui8Pb || m_fsState.rRegs.ui8Status != rMicroRegs.ui8Status || m_fsState.rRegs.ui16Pc != rMicroRegs.ui16Pc ) {
+			aFail( "Registers Wrong" );
+		}
+		if ( m_baBusA.ReadWriteLog().size() != vMicroLog.size() ) { aFail( "Access Count Wrong" ); }
+		else {
+			for ( size_t I = 0; I < vMicroLog.size(); ++I ) {
+				if ( m_baBusA.ReadWriteLog()[I].ui32Address != vMicroLog[I].ui32Address || m_baBusA.ReadWriteLog()[I].ui8Value != vMicroLog[I].ui8Value ||
+					m_baBusA.ReadWriteLog()[I].bRead != vMicroLog[I].bRead ) {
+					aFail( "Access Wrong" );
+					break;
+				}
+			}
+		}
+		return bRet;
+	}
+
+	/**
+	 * Runs RunIdleLoopTest()'s polling loop through an engine, stopping at the first instruction boundary at or after the end of each slice.
+	 *
+	 * \param _pfEngine The engine to run.
+	 * \param _vStops Filled with where each slice stopped.
+	 * \return Returns the number of times the polled register was read.
+	 */
+	uint64_t CRicoh5A22::RunIdleLoop( uint64_t (CRicoh5A22::*_pfEngine)( uint64_t ), std::vector<LSN_IDLE_LOOP_STOP> &_vStops ) {
+		// $00:8000 LDA ($10,X) / BEQ $8000 / BRA $8004, with ($10) pointing at the register at $7E:2100.
+		LSN_CPU_VERIFY_OBJ cvoLoop {};
+		cvoLoop.cvsStart.cvrRegisters.ui16Pc = 0x8000;
+		cvoLoop.cvsStart.cvrRegisters.ui16S = 0x01FF;
+		cvoLoop.cvsStart.cvrRegisters.ui8Status = M() | X() | I();
+		cvoLoop.cvsStart.cvrRegisters.ui8Db = 0x7E;
+		cvoLoop.cvsStart.bEmulationMode = true;
+		cvoLoop.cvsStart.vRam = { { 0x8000, 0xA1 }, { 0x8001, 0x10 }, { 0x8002, 0xF0 }, { 0x8003, 0xFC }, { 0x8004, 0x80 }, { 0x8005, 0xFE },
+			{ 0x0010, 0x00 }, { 0x0011, 0x21 } };
+		SetTestState( cvoLoop );
+		LSN_IDLE_LOOP_PORT ilpPort = { this, 0 };
+		m_baBusA.SetAccessor( 0x7E21, &CRicoh5A22::IdleLoopPortRead, &ilpPort, &CMemoryMap::NullWrite, nullptr,
+			nullptr, &CMemoryMap::NullWrite );
+		Tick();
+		TickPhi2();
+		m_ui64MasterCycles += m_ui8Speed;
+
+		uint64_t ui64Stop = m_ui64MasterCycles;
+		for ( uint64_t I = 0; I < LSN_ILT_SLICES; ++I ) {
+			ui64Stop += 1000 + (I * 7919) % 9000;
+			while ( m_ui64MasterCycles < ui64Stop ) { (this->*_pfEngine)( ui64Stop ); }
+			// RunUntilMasterClock() stops on the first cycle boundary instead.
+			while ( m_fsState.ui8FuncIndex != 1 ) { RunCycles( 1 ); }
+			_vStops.push_back( { m_ui64MasterCycles, m_fsState.rRegs.ui16Pc, m_fsState.rRegs.ui16A, m_fsState.rRegs.ui8Status } );
+		}
+		m_baBusA.ApplyBasicMapping();
+		return ilpPort.ui64Reads;
+	}
+
+	/**
+	 * Runs RunAotTest()'s program through an engine until it ends, stopping at the first instruction boundary at or after the end of
+	 *	each slice.
+	 *
+	 * \param _pfEngine The engine to run.
+	 * \param _ui64Slice The shortest slice, in master cycles.
+	 * \param _atrRun Filled with what the program did.
+	 */
+	void CRicoh5A22::RunAotProgram( uint64_t (CRicoh5A22::*_pfEngine)( uint64_t ), uint64_t _ui64Slice, LSN_AOT_TEST_RUN &_atrRun ) {
+		// $00:8010 in emulation mode, with the RAM it uses cleared.
+		LSN_CPU_VERIFY_OBJ cvoProgram {};
+		cvoProgram.cvsStart.cvrRegisters.ui16Pc = 0x8010;
+		cvoProgram.cvsStart.cvrRegisters.ui16S = 0x01FF;
+		cvoProgram.cvsStart.cvrRegisters.ui8Status = M() | X() | I();
+		cvoProgram.cvsStart.bEmulationMode = true;
+		for ( uint32_t I = 0; I < 0x400; ++I ) { cvoProgram.cvsStart.vRam.push_back( { I, 0x00 } ); }
+		SetTestState( cvoProgram );
+		MapAotFixture( m_baBusA );
+		// SetTestState() read the opcode from RAM.
+		uint8_t ui8Speed;
+		m_fsState.ui16Operand = m_baBusA.Read( m_fsState.rRegs.ui16Pc, m_fsState.rRegs.ui8Pb, ui8Speed );
+		m_baBusA.ReadWriteLog().clear();
+		m_baBusA.SetLogEveryAccess( true );
+		Tick();
+		TickPhi2();
+		m_ui64MasterCycles += m_ui8Speed;
+
+		uint64_t ui64Stop = m_ui64MasterCycles;
+		// Each slice ends on an instruction boundary, so the program has ended once PC is on its last branch.
+		for ( uint64_t I = 0; I < LSN_AT_MAX_SLICES && m_fsState.rRegs.ui16Pc != LSN_AT_END; ++I ) {
+			ui64Stop += _ui64Slice + (I * 7919) % 1500;
+			while ( m_ui64MasterCycles < ui64Stop ) { (this->*_pfEngine)( ui64Stop ); }
+			// RunUntilMasterClock() stops on the first cycle boundary instead.
+			while ( m_fsState.ui8FuncIndex != 1 ) { RunCycles( 1 ); }
+			_atrRun.vMasterCycles.push_back( m_ui64MasterCycles );
+			_atrRun.vRegs.push_back( m_fsState.rRegs );
+		}
+		m_baBusA.SetLogEveryAccess( false );
+		_atrRun.vLog = m_baBusA.ReadWriteLog();
+		// The branch to itself is an idle loop, which the fast engines skip without its accesses.
+		for ( size_t I = 0; I < _atrRun.vLog.size(); ++I ) {
+			if ( _atrRun.vLog[I].bRead && _atrRun.vLog[I].ui32Address == LSN_AT_END ) {
+				_atrRun.vLog.resize( I + 1 );
+				break;
+			}
+		}
+		for ( uint16_t I = 0; I < 0x400; ++I ) { _atrRun.vRam.push_back( m_baBusA.DebugRead( I, 0 ) ); }
+		m_baBusA.ApplyBasicMapping();
+	}
+
+	/**
+	 * Reads the register polled by RunIdleLoopTest(): 0 until LSN_ILT_READY, which the bus is told, and 1 from then on.
+	 *
+	 * \param _rfpParms The access parameters; pvParm0 points to the LSN_IDLE_LOOP_PORT.
+	 * \param _ui8Ret Holds the value read on return.
+	 * \param _ui8OpenMask Unused.
+	 */
+	void LSN_FASTCALL CRicoh5A22::IdleLoopPortRead( const CMemoryMap::LSN_ACCESSFUNCPARMS &_rfpParms, uint8_t &_ui8Ret, uint8_t &/*_ui8OpenMask*/ ) {
+		LSN_IDLE_LOOP_PORT * pilpPort = static_cast<LSN_IDLE_LOOP_PORT *>(_rfpParms.pvParm0);
+		++pilpPort->ui64Reads;
+		if ( pilpPort->pcCpu->m_ui64MasterCycles < LSN_ILT_READY ) {
+			_ui8Ret = 0;
+			pilpPort->pcCpu->m_baBusA.SetReadStableUntil( LSN_ILT_READY );
+		}
+		else { _ui8Ret = 1; }
 	}
 #endif	// #ifdef LSN_CPU_VERIFY
 
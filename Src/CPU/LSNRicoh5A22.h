@@ -13,9 +13,17 @@
 #include "../Bus/LSNBusA.h"
 #include "../Foundation/LSNBits.h"
 #include "../System/LSNTickable.h"
+#include "LSNJitX64.h"
 #include "LSNRicoh5A22Base.h"
 
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <initializer_list>
+#include <unordered_map>
+
 #ifdef LSN_CPU_VERIFY
+#include "../Utilities/LSNTimer.h"
 #include <LSONJson.h>
 #endif	// #ifdef LSN_CPU_VERIFY
 
@@ -27,25 +35,55 @@
 #define LSN_INSTR_START_PHI2_WRITE0_BUSA( ADDR, VAL, SPEED )			m_baBusA.WriteBank0( uint16_t( ADDR ), uint8_t( VAL ), (SPEED) )
 #define LSN_INSTR_END_PHI2
 
+/**
+ * When 1, every PHI1/PHI2 is dispatched with a single indirect call straight through the instruction table (m_fsState.pui16CurInstruction), and the
+ *	"between instructions" state is itself a 1-entry table (m_ui16NextInstruction) rather than a separate tick function.  When 0, each half-cycle goes
+ *	through m_pfTickFunc first and then into the instruction table (2 dependent indirect calls).  Bus traces are identical either way.
+ */
+#ifndef LSN_CPU_THREADED_DISPATCH
+#define LSN_CPU_THREADED_DISPATCH										1
+#endif	// #ifndef LSN_CPU_THREADED_DISPATCH
+
+/**
+ * When 1, RunJit() is available.  It translates hot blocks of instructions from plain-memory pages into x86-64 code (native for simple
+ *	plain-memory operations, calls to the same cycle functions otherwise), so bus traces and cycle counts are identical to the other engines.
+ *	Always 0 where x86-64 code cannot be emitted.
+ */
+#ifndef LSN_CPU_JIT
+#define LSN_CPU_JIT														LSN_JIT_X64_SUPPORTED
+#endif	// #ifndef LSN_CPU_JIT
+#if !LSN_JIT_X64_SUPPORTED
+#undef LSN_CPU_JIT
+#define LSN_CPU_JIT														0
+#endif	// #if !LSN_JIT_X64_SUPPORTED
+
+/**
+ * When 1, RunInstructions(), RunJit(), and RunAot() recognize polling loops (a short backward jump back to a state identical to the last
+ *	pass, with no writes and only reads that Bus A reports as unchanging) and skip whole passes up to the next event, exactly as though each
+ *	pass had been run.
+ */
+#ifndef LSN_CPU_IDLE_LOOPS
+#define LSN_CPU_IDLE_LOOPS												1
+#endif	// #ifndef LSN_CPU_IDLE_LOOPS
+
 #define LSN_NEXT_FUNCTION_BY( AMT )										m_fsState.ui8FuncIndex += AMT
 #define LSN_NEXT_FUNCTION												LSN_NEXT_FUNCTION_BY( 1 )
+#if LSN_CPU_THREADED_DISPATCH
+#define LSN_FINISH_INST( CHECK_INTERRUPTS )								/*if constexpr ( CHECK_INTERRUPTS ) { LSN_CHECK_INTERRUPTS; }*/ m_fsState.pui16CurInstruction = m_ui16NextInstruction; m_fsState.ui8FuncIndex = 0
+#else
 #define LSN_FINISH_INST( CHECK_INTERRUPTS )								/*if constexpr ( CHECK_INTERRUPTS ) { LSN_CHECK_INTERRUPTS; }*/ m_pfTickFunc = m_pfTickFuncCopy = &CRicoh5A22::Tick_NextInstructionStd
+#endif	// #if LSN_CPU_THREADED_DISPATCH
 
 #define LSN_PUSH( VAL, SPEED )											LSN_INSTR_START_PHI2_WRITE0_BUSA( m_fsState.bEmulationMode ? (0x100 | uint8_t( m_fsState.rRegs.ui8S[0] + _i8SOff )) : (m_fsState.rRegs.ui16S + _i8SOff), (VAL), (SPEED) ); m_fsState.ui16SModify = uint16_t( -1L + _i8SOff )
-#define LSN_POP( RESULT, SPEED )										LSN_INSTR_START_PHI2_READ0_BUSA( m_fsState.bEmulationMode ? (0x100 | uint8_t( m_fsState.rRegs.ui8S[0] + _i8SOff )) : (m_fsState.rRegs.ui16S + _i8SOff), (RESULT), (SPEED) ); m_fsState.ui16SModify = uint16_t( 1 + _i8SOff )
+#define LSN_POP( RESULT, SPEED )										LSN_INSTR_START_PHI2_READ0_BUSA( m_fsState.bEmulationMode ? (0x100 | uint8_t( m_fsState.rRegs.ui8S[0] + _i8SOff )) : (m_fsState.rRegs.ui16S + _i8SOff), (RESULT), (SPEED) ); m_fsState.ui16SModify = uint16_t( _i8SOff )
 
 #define LSN_UPDATE_PC													if ( m_fsState.bAllowWritingToPc ) { m_fsState.rRegs.ui16Pc += m_fsState.ui16PcModify; } m_fsState.ui16PcModify = 0
-#define LSN_UPDATE_S													m_fsState.rRegs.ui16S += m_fsState.ui16SModify; m_fsState.ui16SModify = 0
+#define LSN_UPDATE_S													m_fsState.rRegs.ui16S += m_fsState.ui16SModify; m_fsState.ui16SModify = 0; if ( m_fsState.bEmulationMode ) { m_fsState.rRegs.ui8S[1] = 0x01; }
 
 #define LSN_R															CRicoh5A22::LSN_CT_READ
 #define LSN_W															CRicoh5A22::LSN_CT_WRITE
 #define LSN_N															CRicoh5A22::LSN_CT_NULL
 
-#define LSN_TO_A														true
-#define LSN_TO_P														false
-#define LSN_FROM_A														true
-#define LSN_FROM_P														false
-
 
 namespace lsn {
 
@@ -56,11 +94,11 @@ namespace lsn {
 	 * Class CRicoh5A22
 	 * \brief A Ricoh 5A22 processor.
 	 *
-	 * Description: A Ricoh 5A22 processor.
+	 * Description: A Ricoh 5A22 processor.  The bus divisors are compile-time constants shared by NTSC and PAL (see CRicoh5A22Base), so
+	 *	one core serves both regions.  It starts on the NTSC master clock; a PAL system calls SetMasterClock( LSN_CS_PAL_MASTER,
+	 *	LSN_CS_PAL_MASTER_DIVISOR ) after construction.
 	 */
-	/*template <uint64_t _ui64MasterClock = LSN_CS_NTSC_MASTER, uint64_t _ui64MasterDivisor = LSN_CS_NTSC_MASTER_DIVISOR,
-		uint8_t _ui8Fast = LSN_CS_NTSC_CPU_DIVISOR_FAST, uint8_t _ui8SLow = LSN_CS_NTSC_CPU_DIVISOR_SLOW, uint8_t _ui8XSLow = LSN_CS_NTSC_CPU_DIVISOR_XSLOW>*/
-	class CRicoh5A22 : public CRicoh5A22Base, CTickable {
+	class CRicoh5A22 : public CRicoh5A22Base, public CTickable {
 		typedef CRicoh5A22Base											Parent;
 	public :
 		// == Various constructors.
@@ -107,6 +145,83 @@ namespace lsn {
 			LSN_CT_WRITE												= 2,																			/**< A write cycle. */
 		};
 
+		/** Events that can interrupt a RunCycles()/RunUntilMasterClock() batch. */
+		enum LSN_EVENTS : uint8_t {
+			LSN_EV_IRQ,																																		/**< An IRQ line change (H/V timer, cartridge, etc.). */
+			LSN_EV_NMI,																																		/**< An NMI (the start of vertical blank). */
+			LSN_EV_DMA,																																		/**< The start of a general DMA transfer. */
+			LSN_EV_HDMA,																																	/**< HDMA initialization at the start of a frame or an HDMA transfer at the start of horizontal blank. */
+			LSN_EV_RDY,																																		/**< RDY being pulled low or released. */
+
+			LSN_EV_TOTAL
+		};
+
+		/** Why the clock is stopped. */
+		enum LSN_HALT : uint8_t {
+			LSN_H_NONE,																																		/**< Running. */
+			LSN_H_WAI,																																		/**< Stopped by WAI until an NMI, IRQ (even if masked by I), or reset. */
+			LSN_H_STP,																																		/**< Stopped by STP until a reset. */
+		};
+
+		/** The instruction-table variants.  Native-mode indices are ((P >> 4) & 3), so the M and X status flags select the table directly. */
+		enum LSN_INSTR_TABLES : uint8_t {
+			LSN_IT_M16_X16,																																	/**< Native mode, 16-bit A, 16-bit X/Y. */
+			LSN_IT_M16_X8,																																	/**< Native mode, 16-bit A, 8-bit X/Y. */
+			LSN_IT_M8_X16,																																	/**< Native mode, 8-bit A, 16-bit X/Y. */
+			LSN_IT_M8_X8,																																	/**< Native mode, 8-bit A, 8-bit X/Y. */
+			LSN_IT_EMULATION,																																/**< Emulation mode (always 8-bit A, X, and Y). */
+
+			LSN_IT_TOTAL
+		};
+
+		/** The operations that RunJit() and CAotCompiler run natively rather than through the cycle functions.  See NativeInstr(). */
+		enum LSN_NATIVE_OPS : uint8_t {
+			LSN_NO_LOAD,																																	/**< LDA, LDX, LDY. */
+			LSN_NO_STORE,																																	/**< STA, STX, STY, STZ. */
+			LSN_NO_OR,																																		/**< ORA. */
+			LSN_NO_AND,																																		/**< AND. */
+			LSN_NO_EOR,																																		/**< EOR. */
+			LSN_NO_ADC,																																		/**< ADC (binary mode only). */
+			LSN_NO_SBC,																																		/**< SBC (binary mode only). */
+			LSN_NO_CMP,																																		/**< CMP, CPX, CPY. */
+			LSN_NO_BIT,																																		/**< BIT. */
+			LSN_NO_INC,																																		/**< INC A, INX, INY. */
+			LSN_NO_DEC,																																		/**< DEC A, DEX, DEY. */
+			LSN_NO_ASL,																																		/**< ASL A. */
+			LSN_NO_LSR,																																		/**< LSR A. */
+			LSN_NO_ROL,																																		/**< ROL A. */
+			LSN_NO_ROR,																																		/**< ROR A. */
+			LSN_NO_TRANSFER,																																/**< TAX, TAY, TXA, TYA, TXY, TYX. */
+			LSN_NO_SET_FLAG,																																/**< SEC, SED. */
+			LSN_NO_CLEAR_FLAG,																																/**< CLC, CLD, CLV. */
+			LSN_NO_NOP,																																		/**< NOP. */
+		};
+
+		/** The addressing modes of the instructions run natively. */
+		enum LSN_NATIVE_MODES : uint8_t {
+			LSN_NM_IMPLIED,																																	/**< No operand; 1 idle cycle. */
+			LSN_NM_IMMEDIATE,																																/**< The operand follows the opcode. */
+			LSN_NM_ABSOLUTE,																																/**< DB:abs. */
+			LSN_NM_DIRECT,																																	/**< 00:(D + dp), with an idle cycle if D.l is not 0. */
+		};
+
+		/** The registers used by the instructions run natively. */
+		enum LSN_NATIVE_REGS : uint8_t {
+			LSN_NR_A,																																		/**< A. */
+			LSN_NR_X,																																		/**< X. */
+			LSN_NR_Y,																																		/**< Y. */
+			LSN_NR_ZERO,																																	/**< No register (STZ stores 0). */
+		};
+
+#ifdef LSN_CPU_VERIFY
+		/** How BenchJsonTests() dispatches each half-cycle. */
+		enum LSN_BENCH_DISPATCH : uint8_t {
+			LSN_BD_INDEX_TABLE,																																/**< Through m_ui16InstructionSet and m_pfHandlers, as Tick() does. */
+			LSN_BD_INDEX_TABLE_TRACKED,																														/**< As LSN_BD_INDEX_TABLE, but with LSN_BD_MEMBER_POINTERS's per-instruction row lookup. */
+			LSN_BD_MEMBER_POINTERS,																															/**< Straight through m_iInstructionSet's member-function pointers (16 bytes each on the Itanium ABI). */
+		};
+#endif	// #ifdef LSN_CPU_VERIFY
+
 
 		// == Types.
 		/** The processor registers. */
@@ -150,17 +265,39 @@ namespace lsn {
 		 *	branching etc.
 		 * pfHandler points to an array of functions that can handle all possible cycles for a given instruction, and we use a subtractive process for eliminating optional cycles
 		 *	rather than using the additive approach most commonly found in emulators.
+		 * pfHandler is the authoring form only.  At start-up BuildCompactTables() converts it to m_ui16InstructionSet (2-byte indices into m_pfHandlers),
+		 *	which is what the CPU actually executes.
+		 * There is one cycle list per LSN_INSTR_TABLES variant, each already specialized for the accumulator/index widths of that variant, so no
+		 *	cycle function ever has to check the M or X flags.
 		 */
 		struct LSN_INSTR {
-			PfCycle														pfHandler[2][LSN_M_MAX_INSTR_CYCLE_COUNT*2];									/**< Indexed by LSN_CPU_CONTEXT::ui8FuncIdx, these functions handle each cycle of the instruction. */
+			PfCycle														pfHandler[LSN_IT_TOTAL][LSN_M_MAX_INSTR_CYCLE_COUNT*2];							/**< Indexed by LSN_INSTR_TABLES and then LSN_CPU_CONTEXT::ui8FuncIdx, these functions handle each cycle of the instruction. */
 			uint8_t														ui8TotalCyclesN;																/**< Total non-optional non-overlapping cycles in the instruction. Used only for debugging, disassembling, etc. */
 			uint8_t														ui8TotalCyclesE;																/**< Total non-optional non-overlapping cycles in the instruction. Used only for debugging, disassembling, etc. */
 			LSN_ADDRESSING_MODES										amAddrMode;																		/**< Addressing mode. Used only for debugging, disassembling, etc. */
-			uint8_t														ui8SizeN;																		/**< Size in bytes of the instruction (native). Used only for debugging, disassembling, etc. */
-			uint8_t														ui8SizeE;																		/**< Size in bytes of the instruction (emulation mode). Used only for debugging, disassembling, etc. */
+			uint8_t														ui8Size[LSN_IT_TOTAL];															/**< Size in bytes in each LSN_INSTR_TABLES variant (immediates follow M or X). Used by RunJit() and CAotCompiler to find the next instruction. */
 			LSN_INSTRUCTIONS											iInstruction;																	/**< The instruction. */
 		};
 
+		/** A statically recompiled block, as emitted by CAotCompiler. */
+		struct LSN_AOT_BLOCK {
+			uint32_t													ui32Addr;																		/**< The PB:PC of the block's first instruction. */
+			uint8_t														ui8Table;																		/**< The LSN_INSTR_TABLES value the block was compiled for. */
+			uint8_t														ui8Op;																			/**< The block's first opcode. */
+			void (*														pfBlock)( CRicoh5A22 * _pcThis );												/**< The generated code, entered right after the first opcode has been fetched. */
+		};
+
+		/** An instruction that can run natively, as decoded by NativeInstr(). */
+		struct LSN_NATIVE_INSTR {
+			LSN_NATIVE_OPS												noOp;																			/**< The operation. */
+			LSN_NATIVE_MODES											nmMode;																			/**< The addressing mode. */
+			LSN_NATIVE_REGS												nrReg;																			/**< The register loaded, stored, compared, or changed (the destination of a transfer). */
+			LSN_NATIVE_REGS												nrSrc;																			/**< The source of a transfer. */
+			uint8_t														ui8Flag;																		/**< The status flag set or cleared by LSN_NO_SET_FLAG and LSN_NO_CLEAR_FLAG. */
+			uint8_t														ui8OperandSize;																	/**< The number of operand bytes after the opcode. */
+			bool														bWide;																			/**< The operation is 16-bit (by M, or by X for LSN_NR_X and LSN_NR_Y). */
+		};
+
 
 		// == Functions.
 		/**
@@ -170,13 +307,19 @@ namespace lsn {
 		 */
 		template <bool _bToKnown = true>
 		void															Reset() {
+#if !LSN_CPU_THREADED_DISPATCH
 			m_pfTickFunc = m_pfTickFuncCopy = &CRicoh5A22::Tick_NextInstructionStd;
+#endif	// #if !LSN_CPU_THREADED_DISPATCH
 			m_fsState.bBoundaryCrossed = false;
 			m_fsState.ui16PcModify = 0;
 			m_fsState.ui16SModify = 0;
 			m_fsState.ui16OpCode = 0;
 			m_fsState.bEmulationMode = true;
+			SelectInstrTable();
 			m_fsStateBackup.bCopiedState = false;
+			m_ui8Halt = LSN_H_NONE;
+			m_bHaltedPhi1 = false;
+			ForgetIdleLoop();
 			
 #ifdef LSN_CPU_VERIFY
 			m_fsState.bAllowWritingToPc = true;
@@ -186,7 +329,12 @@ namespace lsn {
 			m_bIsReset = m_bBrkIsReset = true;
 #endif	// #ifdef LSN_CPU_VERIFY
 
-			m_fsState.pfCurInstruction = m_iInstructionSet[m_fsState.ui16OpCode].pfHandler[m_fsState.bEmulationMode];
+#if LSN_CPU_THREADED_DISPATCH
+			m_fsState.pui16CurInstruction = m_ui16NextInstruction;
+			m_fsState.ui8FuncIndex = 0;
+#else
+			m_fsState.pui16CurInstruction = m_fsState.pui16InstrTable[m_fsState.ui16OpCode];
+#endif	// #if LSN_CPU_THREADED_DISPATCH
 
 			//if ( m_pmbMapper ) { m_pmbMapper->Reset(); }
 
@@ -210,11 +358,42 @@ namespace lsn {
 				m_bHandleIrq = false;
 				m_bRdyLow = false;
 				//m_ui8RdyOffCnt = 0;
+				m_ui64MasterCycles = 0;
+				for ( size_t I = 0; I < LSN_EV_TOTAL; ++I ) {
+					m_ui64EventDeadlines[I] = UINT64_MAX;
+				}
+				m_ui64NextEvent = UINT64_MAX;
+				m_bIrqLine = false;
 
 				/*std::memset( m_ui8Inputs, 0, sizeof( m_ui8Inputs ) );
 				std::memset( m_ui8InputsState, 0, sizeof( m_ui8InputsState ) );
 				std::memset( m_ui8InputsPoll, 0, sizeof( m_ui8InputsPoll ) );*/
 			}
+			UpdateInterruptPending();
+		}
+
+		/**
+		 * Gets the registers.
+		 *
+		 * \return Returns the registers.
+		 **/
+		inline const LSN_REGISTERS &									Registers() const { return m_fsState.rRegs; }
+
+		/**
+		 * Loads the registers and leaves the CPU between instructions, so that the next cycle fetches the opcode at PB:PC.  Used to load
+		 *	states and to start code at a given address without going through the reset vector.
+		 *
+		 * \param _rRegs The registers to load.
+		 * \param _bEmulationMode The emulation flag (E).
+		 **/
+		void															SetRegisters( const LSN_REGISTERS &_rRegs, bool _bEmulationMode ) {
+			Reset<false>();
+			m_fsState.rRegs = _rRegs;
+			m_fsState.bEmulationMode = _bEmulationMode;
+			m_fsState.bAllowWritingToPc = true;
+			m_bIsReset = m_bBrkIsReset = false;
+			SelectInstrTable();
+			UpdateInterruptPending();
 		}
 
 		/**
@@ -222,448 +401,2686 @@ namespace lsn {
 		 **/
 		void															SetIsReset() {
 			m_bIsReset = m_bBrkIsReset = true;
+			UpdateInterruptPending();
 		}
 
 		/**
-		 * Performs a single PHI1 update.
-		 */
-		void															Tick();
+		 * Signals an NMI (a falling edge on the NMI line).  It is taken at the next instruction boundary.
+		 **/
+		inline void														SignalNmi() {
+			m_bNmiStatusLine = true;
+			m_bDetectedNmi = true;
+			m_bHandleNmi = true;
+			UpdateInterruptPending();
+		}
 
 		/**
-		 * Performs a single PHI2 update.
+		 * Sets the level of the IRQ line.  While it is asserted, an IRQ is taken at each instruction boundary at which the I flag is clear.
+		 * 
+		 * \param _bAsserted If true, the line is asserted (low).
 		 **/
-		void															TickPhi2();
-
-		/** Fetches the next opcode and begins the next instruction. */
-		inline void														Tick_NextInstructionStd();
-
-		/** Performs a cycle inside an instruction. */
-		inline void														Tick_InstructionCycleStd();
+		inline void														SetIrqLine( bool _bAsserted ) {
+			m_bIrqLine = _bAsserted;
+			UpdateInterruptPending();
+		}
 
-#ifdef LSN_CPU_VERIFY
 		/**
-		 * Runs a test given a JSON's value representing the test to run.
-		 *
-		 * \param _jJson The JSON file.
-		 * \param _jvTest The test to run.
-		 * \return Returns true if te test succeeds, false otherwise.
-		 */
-		bool															RunJsonTest( lson::CJson &_jJson, const lson::CJsonContainer::LSON_JSON_VALUE &_jvTest );
-#endif	// #ifdef LSN_CPU_VERIFY
-
-	protected :
-		// == Types.
-		/** The full state structure for instructions. */
-		LSN_ALIGN_STRUCT( 64 )
-		struct LSN_FULL_STATE {
-			const PfCycle *												pfCurInstruction = nullptr;															/**< The current instruction being executed. */
-			LSN_REGISTERS												rRegs;																				/**< Registers. */
-
-			LSN_VECTORS													vBrkVector = LSN_V_BRK;																/**< The vector to use inside BRK and whether to push B with status. */
-			union {
-				uint8_t													ui8Operand[2];																		/**< The operand. */
-				uint16_t												ui16Operand;																		/**< The operand. */
-			};
-			union {
-				uint8_t													ui8Address[2];																		/**< An address loaded into memory before transfer to a register such as PC. */
-				uint16_t												ui16Address;																		/**< An address loaded into memory before transfer to a register such as PC. */
-			};
-			union {
-				uint8_t													ui8Pointer[2];																		/**< An address loaded into memory for indirect access. */
-				uint16_t												ui16Pointer;																		/**< An address loaded into memory for indirect access. */
-			};
-			uint16_t													ui16OpCode = 0;																		/**< The current opcode. */
-			uint16_t													ui16PcModify = 0;																	/**< The amount by which to modify PC during the next Phi1. */
-			uint16_t													ui16SModify = 0;																	/**< The amount by which to modify S during the next Phi1. */
-			uint8_t														ui8FuncIndex = 0;																	/**< The function index. */
-			uint8_t														ui8Bank = 0;																		/**< Holds the bank for long reads/writes. */
-		
-			bool														bIsReadCycle = true;																/**< Is the current cycle a read? */
-			bool														bBoundaryCrossed = false;															/**< Did we cross a page boundary? */
-			bool														bPushB = false;																		/**< Push the B flag with the status byte? */
-			bool														bAllowWritingToPc = true;															/**< Allow writing to PC? */
-			bool														bTakeJump;																			/**< Determines if a branch is taken. */
-		
-			bool														bEmulationMode = true;																/**< Emulation Mode flag. */
-
-			bool														bCopiedState = false;																/**< If m_bRdyLow triggers a state copy, this is set in PHI1 after the copy and used in PHI2 to know that a copy was made and to abord PHI2 as soon as the read address has been finalized. */
-		} LSN_ALIGN_STRUCT_END( 64 );
-
-
-		// == Members.
-		PfTicks															m_pfTickFunc = nullptr;																/**< The current tick function (called by Tick()). */
-		PfTicks															m_pfTickFuncCopy = nullptr;															/**< A copy of the current tick, used to restore the intended original tick when control flow is changed by DMA transfers. */
-		CBusA &															m_baBusA;																			/**< Bus A. */
-		
-		LSN_FULL_STATE													m_fsState;																			/**< Everything a standard instruction-cycle function can modify.  Backed up at the start of the first DMA read cycle and restored at the end after the read address for that cycle has been calculated. */
-		LSN_FULL_STATE													m_fsStateBackup;																	/**< The backup of the state for the cycle that first gets interrupted by DMA and is then executed at the end of DMA. */
-		static LSN_INSTR												m_iInstructionSet[256];																/**< The instruction set. */
-
-		bool															m_bNmiStatusLine = false;															/**< The status line for NMI. */
-		bool															m_bLastNmiStatusLine = false;														/**< THe last status line for NMI. */
-		bool															m_bDetectedNmi = false;																/**< The edge detector for the PHI2 part of the cycle. */
-		bool															m_bHandleNmi = false;																/**< Once an NMI edge is detected, this is set to indicate that it needs to be handled on the PHI1 of the next cycle. */
-		bool															m_bHandleIrq = false;																/**< Once the IRQ status line is detected as having triggered, this tells us to handle an IRQ on the next instruction. */
-		bool															m_bIsReset = true;																	/**< Are we resetting? */
-		bool															m_bBrkIsReset = true;																/**< Shadows m_bIsReset, but m_bIsReset gets unset in the middle of BRK, while this lasts the whole BRK. */
-
-		bool															m_bRdyLow = false;																	/**< When RDY is pulled low, reads inside opcodes abort the CPU cycle. */
-
-
-#ifdef LSN_CPU_VERIFY
-		// == Types.
-		struct LSN_CPU_VERIFY_RAM {
-			uint32_t													ui32Addr;
-			uint8_t														ui8Value;
-		};
-
-		struct LSN_CPU_VERIFY_STATE {
-			LSN_REGISTERS												cvrRegisters;
-			std::vector<LSN_CPU_VERIFY_RAM>								vRam;
-			bool														bEmulationMode;
-		};
-
-		struct LSN_CPU_VERIFY_CYCLE {
-			uint32_t													ui32Addr;
-			uint8_t														ui8Value;
-			std::string													sStatus;
-			bool														bNoReadOrWrite;
-		};
+		 * Gets the level of the IRQ line.
+		 * 
+		 * \return Returns true if the IRQ line is asserted.
+		 **/
+		inline bool														IrqLine() const { return m_bIrqLine; }
 
-		struct LSN_CPU_VERIFY_OBJ {
-			std::string													sName;
-			LSN_CPU_VERIFY_STATE										cvsStart;
-			LSN_CPU_VERIFY_STATE										cvsEnd;
-			std::vector<LSN_CPU_VERIFY_CYCLE>							vCycles;
-		};
+		/**
+		 * Gets the reason the CPU's clock is stopped, if it is.
+		 * 
+		 * \return Returns LSN_H_WAI or LSN_H_STP after WAI or STP until the CPU wakes, otherwise LSN_H_NONE.
+		 **/
+		inline LSN_HALT													Halted() const { return LSN_HALT( m_ui8Halt ); }
 
+		/**
+		 * Selects the instruction table matching the current emulation mode and M/X status flags.  Must be called any time any of these
+		 *	change (REP, SEP, PLP, RTI, XCE, or loading a state), and is the only place those flags are checked to decide operand widths.
+		 **/
+		inline void														SelectInstrTable() {
+			m_fsState.pui16InstrTable = m_ui16InstructionSet[m_fsState.bEmulationMode ? LSN_IT_EMULATION : ((m_fsState.rRegs.ui8Status >> 4) & 0x3)];
+		}
 
-		// == Functions.
 		/**
-		 * Given a JSON object and the value for the test to run, this loads the test and fills a LSN_CPU_VERIFY structure.
-		 *
-		 * \param _jJson The JSON file.
-		 * \param _jvTest The test to run.
-		 * \param _cvoTest The test structure to fill out.
-		 * \return Returns true if the JSON data was successfully extracted and the test created.
+		 * Performs a single PHI1 update.
 		 */
-		bool															GetTest( lson::CJson &_jJson, const lson::CJsonContainer::LSON_JSON_VALUE &_jvTest, LSN_CPU_VERIFY_OBJ &_cvoTest );
+		inline void														Tick();
 
 		/**
-		 * Fills out a LSN_CPU_VERIFY_STATE structure given a JSON "initial" or "final" member.
-		 *
-		 * \param _jJson The JSON file.
-		 * \param _jvState The bject member representing the state to load.
-		 * \param _cvsState The state structure to fill.
-		 * \return Returns true if the state was loaded.
-		 */
-		bool															LoadState( lson::CJson &_jJson, const lson::CJsonContainer::LSON_JSON_VALUE &_jvState, LSN_CPU_VERIFY_STATE &_cvsState );
-#endif	// #ifdef LSN_CPU_VERIFY
+		 * Performs a single PHI2 update.
+		 **/
+		inline void														TickPhi2();
 
+		/**
+		 * Runs up to _ui64Cycles full CPU cycles inside the CPU, stopping early only when the master clock reaches the next registered event deadline.
+		 *	Each cycle advances the master clock by its bus-speed divisor and increments the CPU cycle count.
+		 * 
+		 * \param _ui64Cycles The maximum number of CPU cycles to run.
+		 * \return Returns the number of CPU cycles actually run.
+		 **/
+		uint64_t														RunCycles( uint64_t _ui64Cycles );
 
-		// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
-		// CYCLES
-		// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
 		/**
-		 * Adds X to m_fsState.ui16Pointer and D, stores to m_fsState.ui16Address.
+		 * Runs full CPU cycles until the master clock reaches _ui64MasterClock or the next registered event deadline, whichever comes first.
+		 *	The last cycle may end past the target, since cycles are never split.
 		 * 
-		 * \tparam _bTo If LSN_TO_A, the value is taken from m_fsState.ui16Pointer and stored to m_fsState.ui16Address, otherwise it is taken from m_fsState.ui16Address and stored to m_fsState.ui16Pointer.
+		 * \param _ui64MasterClock The master-clock value at which to stop.
+		 * \return Returns the number of CPU cycles actually run.
 		 **/
-		template <bool _bTo = LSN_TO_A>	
-		void															Add_X_D_PtrOrAddr_To_AddrOrPtr_IncPc();
+		uint64_t														RunUntilMasterClock( uint64_t _ui64MasterClock );
 
-		/** Final touches to BRK (copies m_fsState.ui16Address to m_fsState.rRegs.ui16Pc) and first cycle of the next instruction. */
-		void															Brk_BeginInst();
+		/**
+		 * The fast (instruction-granular) engine.  Runs whole instructions until the master clock reaches _ui64MasterClock or the next registered
+		 *	event deadline.  Each instruction runs from its first to its last cycle with only a deadline check after each cycle, with the master
+		 *	clock still advanced by each cycle's bus-speed divisor.  Whenever an event deadline (or pending IRQ/NMI/reset, or RDY) falls within the
+		 *	worst-case length of the next instruction, that instruction is instead run by the micro-cycle core, which stops exactly at the deadline.
+		 *	Both engines share m_fsState, so calls to RunInstructions(), RunCycles(), and RunUntilMasterClock() can be freely mixed.
+		 * Deadlines (including those registered by an instruction's own bus accesses) stop the CPU on the same cycle as RunUntilMasterClock()
+		 *	would, but _ui64MasterClock can be overshot by up to one instruction.
+		 * 
+		 * \param _ui64MasterClock The master-clock value at which to stop.
+		 * \return Returns the number of CPU cycles actually run.
+		 **/
+		uint64_t														RunInstructions( uint64_t _ui64MasterClock );
 
+#if LSN_CPU_JIT
 		/**
-		 * Copies from the vector to PC.h.
+		 * The recompiling engine.  Behaves exactly like RunInstructions(), except that once an instruction address on a plain-memory page has
+		 *	been reached LSN_M_JIT_HOT_COUNT times, the block of instructions starting there is translated into x86-64 code and run from then on.
+		 *	Simple loads, stores, ALU operations, and flag/register instructions whose data lives on plain-memory pages are emitted as native
+		 *	x86-64; the rest call the instruction table's cycle functions directly (and skip runs of idle half-cycles in one call, as
+		 *	RunInstructions() does).  Either way every bus access happens in the same order and with the same speed as in the interpreter.
+		 *	Blocks are dropped as soon as a page holding any of their opcodes is written or remapped.
+		 * Falls back to RunInstructions() if executable memory cannot be allocated.
 		 * 
-		 * \tparam _bEndInstr Marks the end of an instruction.  If true, LSN_FINISH_INST() is called.
+		 * \param _ui64MasterClock The master-clock value at which to stop.
+		 * \return Returns the number of CPU cycles actually run.
 		 **/
-		template <bool _bEndInstr = false>
-		void															CopyVectorToPc_H_Phi2();
-			
-		/** Copies from the vector to PC.l. **/
-		void															CopyVectorToPc_L_Phi2();
+		uint64_t														RunJit( uint64_t _ui64MasterClock );
 
-		/** Fetches the current opcode and increments PC. **/
-		void															Fetch_Opcode_IncPc_Phi2();
+		/**
+		 * Discards every translated block.  Must not be called from inside a bus access.
+		 **/
+		void															FlushJit();
+#endif	// #if LSN_CPU_JIT
 
 		/**
-		 * Fetches the operand and increments PC.
+		 * Statically recompiled (ahead-of-time) engine.  Behaves exactly like RunInstructions(), except that whenever the current instruction
+		 *	starts one of the blocks registered with SetAotBlocks(), that block's generated code is run instead.  The instructions that
+		 *	NativeInstr() decodes are compiled into the blocks as C++, with operands read from ROM at generation time; the rest call the
+		 *	cycle functions.
 		 * 
-		 * \tparam _bEndInstr If true, this is the end of the instruction and steps should be taken to prepare for the next instruction.
+		 * \param _ui64MasterClock The master-clock value at which to stop.
+		 * \return Returns the number of CPU cycles actually run.
 		 **/
-		template <bool _bEndInstr = false>
-		void															Fetch_Operand_IncPc_Phi2();
+		uint64_t														RunAot( uint64_t _ui64MasterClock );
 
 		/**
-		 * Fetches the operand and increments PC.
+		 * Registers the blocks generated by CAotCompiler for use by RunAot().  Replaces any previously registered blocks.
 		 * 
-		 * \tparam _bTo If LSN_TO_A, the value is stored to m_fsState.ui16Address, otherwise it is stored to m_fsState.ui16Pointer.
-		 * \tparam _bEndInstr If true, this is the end of the instruction and steps should be taken to prepare for the next instruction.
+		 * \param _pabBlocks The blocks.  Must remain valid for as long as they are registered.
+		 * \param _sTotal The number of blocks in _pabBlocks.
+		 * \param _ui64Signature The HandlerSignature() of the CPU core that generated the blocks.
+		 * \return Returns false (and registers nothing) if _ui64Signature does not match this CPU core, in which case the generated code
+		 *	must be regenerated.
 		 **/
-		template <bool _bTo = LSN_TO_A, bool _bEndInstr = false>
-		void															Fetch_PtrOrAddr_IncPc_Phi2();
+		bool															SetAotBlocks( const LSN_AOT_BLOCK * _pabBlocks, size_t _sTotal, uint64_t _ui64Signature );
 
 		/**
-		 * Fixes the high bit of m_fsState.ui16Address or m_fsState.ui16Pointer.
+		 * Gets a signature of the compact instruction tables.  Generated code refers to cycle functions by their indices in m_pfHandlers, so it
+		 *	can only be run by a CPU core with the same signature.
 		 * 
-		 * \tparam _bTo If LSN_TO_A, the value is taken from m_fsState.ui16Pointer and stored to m_fsState.ui16Address, otherwise it is taken from m_fsState.ui16Address and stored to m_fsState.ui16Pointer.
+		 * \return Returns a hash of m_ui16InstructionSet.
 		 **/
-		template <bool _bTo = LSN_TO_A>	
-		void															Fix_PtrOrAddr_From_AddrOrPtr_High();
+		static uint64_t													HandlerSignature();
 
 		/**
-		 * Generic null operation.
+		 * Gets an instruction's cycle functions, as indices for BlockPhi1() and BlockPhi2().
 		 * 
-		 * \tparam _ctReadWriteNull The cycle read/write/neither type.
-		 * \tparam _bIncPc If true, PC is updated.
-		 * \tparam _bAdjS If true, S is updated.
-		 * \tparam _bBeginInstr If true, BeginInst() is called.
+		 * \param _sTable The instruction table (an LSN_INSTR_TABLES value).
+		 * \param _ui8Op The opcode.
+		 * \return Returns the cycle list of the instruction.  Index 0 is always the opcode fetch.
 		 **/
-		template <CRicoh5A22::LSN_CYCLE_TYPE _ctReadWriteNull = CRicoh5A22::LSN_CT_NULL, bool _bIncPc = false, bool _bAdjS = false, bool _bBeginInstr = false>
-		void															Null();
+		static inline const uint16_t *									InstrCycles( size_t _sTable, uint8_t _ui8Op ) { return m_ui16InstructionSet[_sTable][_ui8Op]; }
 
 		/**
-		 * Generic null operation on PHI2.  Sets the bus access speed to Fast.
+		 * Gets the number of entries an instruction uses in its cycle list, or 0 if it is not implemented.
+		 * 
+		 * \param _sTable The instruction table (an LSN_INSTR_TABLES value).
+		 * \param _ui8Op The opcode.
+		 * \return Returns the length of the cycle list, always ending with the PHI1 that calls BeginInst().
 		 **/
-		void															Null_Phi2();
+		static size_t													InstrCycleLen( size_t _sTable, uint8_t _ui8Op );
 
 		/**
-		 * Generic null operation for BRK that can be either a read or write, depending on RESET.
+		 * Gets an instruction's metadata.
 		 * 
-		 * \tparam _bIncPc If true, PC is updated.
-		 * \tparam _bAdjS If true, S is updated.
-		 * \tparam _bBeginInstr If true, BeginInst() is called.
+		 * \param _ui8Op The opcode.
+		 * \return Returns the instruction's entry in m_iInstructionSet.
 		 **/
-		template <bool _bIncPc = false, bool _bAdjS = false, bool _bBeginInstr = false>
-		void															Null_RorW();
+		static inline const LSN_INSTR &									InstrInfo( uint8_t _ui8Op ) { return m_iInstructionSet[_ui8Op]; }
 
 		/**
-		 * Performs ORA with m_ui8Operand[0].
+		 * Determines whether an instruction ends a straight-line run of code: it transfers control somewhere other than the next
+		 *	instruction, may repeat itself, stops the clock, or changes the instruction table (E, M, or X).
 		 * 
-		 * \tparam _bIncPc If true, PC is updated.
+		 * \param _iInstruction The instruction.
+		 * \return Returns true if translated code must not assume that the next instruction in memory runs next.
 		 **/
-		template <bool _bIncPc = false>
-		void															Ora();
+		static bool														EndsBlock( LSN_INSTRUCTIONS _iInstruction );
 
 		/**
-		 * Pushes PB.
+		 * Decodes an instruction that RunJit() and CAotCompiler can run natively: the simple loads, stores, ALU operations, flag operations,
+		 *	and transfers with no operand or with an immediate, absolute, or direct-page operand.
 		 * 
-		 * \tparam _i8SOff The offset from S to which to write the pushed value.
+		 * \param _sTable The instruction table (an LSN_INSTR_TABLES value).
+		 * \param _ui8Op The opcode.
+		 * \param _niInstr Filled with the decoded instruction.
+		 * \return Returns true if the instruction can run natively.
 		 **/
-		template <int8_t _i8SOff>
-		void															PushPb_Phi2();
+		static bool														NativeInstr( size_t _sTable, uint8_t _ui8Op, LSN_NATIVE_INSTR &_niInstr );
 
 		/**
-		 * Pushes PCh with the given S offset.
+		 * A block generated by CAotCompiler.  Each generated file specializes this for its own blocks, so that the generated code reaches the
+		 *	CPU's state the way its cycle functions do.
 		 * 
-		 * \tparam _i8SOff The offset from S to which to write the pushed value.
+		 * \tparam _tTag A type declared by the generated file, keeping its blocks apart from those of other files.
+		 * \tparam _ui64Key The block's (table << 24) | PB:PC.
+		 * \param _pcThis The CPU.
 		 **/
-		template <int8_t _i8SOff = 0>
-		void															Push_Pc_H_Phi2();
+		template <typename _tTag, uint64_t _ui64Key>
+		static void														AotBlock( CRicoh5A22 * _pcThis );
 
 		/**
-		 * Pushes PCl with the given S offset.
+		 * Runs a PHI1 cycle function.  Used by translated and generated blocks.
 		 * 
-		 * \tparam _i8SOff The offset from S to which to write the pushed value.
+		 * \param _pcThis The CPU.
+		 * \param _ui64Handler The index of the function in m_pfHandlers.
+		 * \return Returns the resulting m_fsState.ui8FuncIndex.
 		 **/
-		template <int8_t _i8SOff = 0>
-		void															Push_Pc_L_Phi2();
+		static uint32_t													BlockPhi1( CRicoh5A22 * _pcThis, uint64_t _ui64Handler );
 
 		/**
-		 * Pushes Status with or without B/X to the given S offset.
+		 * Runs a PHI2 cycle function and accounts for the cycle.  Used by translated and generated blocks.
 		 * 
-		 * \tparam _i8SOff The offset from S to which to write the pushed value.
+		 * \param _pcThis The CPU.
+		 * \param _ui64Handler The index of the function in m_pfHandlers.
+		 * \return Returns the resulting m_fsState.ui8FuncIndex, or UINT32_MAX once the next event deadline has been reached.
 		 **/
-		template <int8_t _i8SOff = 0>
-		void															Push_S_Phi2();
+		static uint32_t													BlockPhi2( CRicoh5A22 * _pcThis, uint64_t _ui64Handler );
 
 		/**
-		 * Reads from m_fsState.ui16Address and Bank and stores the result in m_ui8Operand[1].
+		 * Runs a run of idle half-cycles through RunFusedIdle() and accounts for its cycles.  Used by translated blocks.
 		 * 
-		 * \tparam _bFrom If LSN_FROM_A, the final address is calculated using m_fsState.ui16Address, otherwise it is determined using m_fsState.ui16Pointer.
+		 * \param _pcThis The CPU.
+		 * \param _ui64Fused The run's m_ui8FusedIdle entry.
+		 * \return Returns the resulting m_fsState.ui8FuncIndex, or UINT32_MAX if the run would reach the next event deadline, in which case
+		 *	only the current cycle is finished.
 		 **/
-		template <bool _bFrom = LSN_FROM_A>
-		void															Read_PtrOrAddr_And_Bank_To_OperandHigh_Phi2();
+		static uint32_t													BlockFusedIdle( CRicoh5A22 * _pcThis, uint64_t _ui64Fused );
 
 		/**
-		 * Reads from m_fsState.ui16Address and Bank and stores the result in m_ui8Operand[0].
+		 * Used by translated and generated blocks when a PHI1 did not go where expected: runs the matching PHI2 through the instruction table
+		 *	so that the block exits on a cycle boundary.
 		 * 
-		 * \tparam _bFrom If LSN_FROM_A, the final address is calculated using m_fsState.ui16Address, otherwise it is determined using m_fsState.ui16Pointer.
+		 * \param _pcThis The CPU.
+		 * \return Returns 0.
 		 **/
-		template <bool _bFrom = LSN_FROM_A>
-		void															Read_PtrOrAddr_And_Bank_To_OperandLow_SkipIfM_Phi2();
+		static uint32_t													BlockFinishCycle( CRicoh5A22 * _pcThis );
 
 		/**
-		 * Reads from m_fsState.ui16Address or m_fsState.ui16Pointer and stores the high byte in m_ui8Pointer[1] or m_ui8Address[1].
+		 * Used by translated and generated blocks at the end of each instruction to fetch the next opcode and decide whether to keep going.
 		 * 
-		 * \tparam _bTo If LSN_TO_A, the value is taken from m_fsState.ui16Pointer and stored to m_fsState.ui16Address, otherwise it is taken from m_fsState.ui16Address and stored to m_fsState.ui16Pointer.
+		 * \param _pcThis The CPU.
+		 * \param _ui64Valid The address of a bool that must still be true for the block to continue, or 0.
+		 * \param _ui64Expected (table << 32) | (opcode << 24) | PB:PC of the next instruction in the block, or UINT64_MAX if the block ends here.
+		 * \return Returns non-zero if the next instruction in the block can be run.
 		 **/
-		template <bool _bTo = LSN_TO_A>
-		void															ReadBank0_PtrOrAddr_To_AddrOrPtr_High_Phi2();
+		static uint32_t													BlockFetch( CRicoh5A22 * _pcThis, uint64_t _ui64Valid, uint64_t _ui64Expected );
 
 		/**
-		 * Reads from m_fsState.ui16Address or m_fsState.ui16Pointer and stores the low byte in m_ui8Pointer[0] or m_ui8Address[0].
+		 * Registers the master-clock time of an event.  RunCycles() and RunUntilMasterClock() return at the first cycle boundary at or after the earliest
+		 *	registered deadline so that the caller can service the event.
 		 * 
-		 * \tparam _bTo If LSN_TO_A, the value is taken from m_fsState.ui16Pointer and stored to m_fsState.ui16Address, otherwise it is taken from m_fsState.ui16Address and stored to m_fsState.ui16Pointer.
+		 * \param _eEvent The event whose deadline is to be set.
+		 * \param _ui64MasterClock The master-clock value at which the event occurs.
 		 **/
-		template <bool _bTo = LSN_TO_A>
-		void															ReadBank0_PtrOrAddr_To_AddrOrPtr_Low_Phi2();
+		inline void														SetEventDeadline( LSN_EVENTS _eEvent, uint64_t _ui64MasterClock );
 
 		/**
-		 * Selects the BRK vector etc.
+		 * Removes the deadline for an event.
 		 * 
-		 * \tparam _bAdjS If true, S is updated.
+		 * \param _eEvent The event whose deadline is to be removed.
 		 **/
-		template <bool _bAdjS>
-		void															SelectBrkVectors();
+		inline void														ClearEventDeadline( LSN_EVENTS _eEvent ) { SetEventDeadline( _eEvent, UINT64_MAX ); }
 
-		/** Sets I and X. */
-		void															SetBrkFlags();
+		/**
+		 * Gets the earliest registered event deadline.
+		 * 
+		 * \return Returns the master-clock value of the earliest registered event, or UINT64_MAX if there are none.
+		 **/
+		inline uint64_t													NextEventDeadline() const { return m_ui64NextEvent; }
 
-		/** Skips the next instruction if the M status flag is set. */
-		void															SkipIfM_Phi2();
+		/**
+		 * Gets the registered deadline of an event.
+		 * 
+		 * \param _eEvent The event whose deadline is to be returned.
+		 * \return Returns the master-clock value of the event, or UINT64_MAX if it is not registered.
+		 **/
+		inline uint64_t													EventDeadline( LSN_EVENTS _eEvent ) const { return m_ui64EventDeadlines[_eEvent]; }
 
-		/** Skips the next instruction if the low byte of D is 0. */
-		void															SkipOnDL_Phi2();
+		/**
+		 * Gets the number of master-clock ticks consumed by the CPU so far.
+		 * 
+		 * \return Returns the current master-clock position of the CPU.
+		 **/
+		inline uint64_t													GetMasterCycles() const { return m_ui64MasterCycles; }
 
+		/**
+		 * Halts the CPU between cycles for a number of master-clock ticks, as DMA and HDMA do.  The CPU then waits for its own clock to
+		 *	line up again, so the halt is rounded up to a whole number of CPU cycles at the speed of the last cycle.
+		 * 
+		 * \param _ui64MasterCycles The number of master-clock ticks for which the CPU is halted.
+		 * \return Returns the number of master-clock ticks actually added, including the realignment.
+		 **/
+		inline uint64_t													Stall( uint64_t _ui64MasterCycles ) {
+			const uint64_t ui64Total = (_ui64MasterCycles + m_ui8Speed - 1) / m_ui8Speed * m_ui8Speed;
+			m_ui64MasterCycles += ui64Total;
+			return ui64Total;
+		}
 
 		/**
-		 * Prepares to enter a new instruction.
+		 * Performs the given number of full cycles (PHI1 followed by PHI2) in a single loop.  Equivalent to calling Tick() and TickPhi2()
+		 *	_ui64Cycles times, but without leaving the CPU between half-cycles.
+		 * 
+		 * \param _ui64Cycles The number of full cycles to perform.
+		 **/
+		void															TickCycles( uint64_t _ui64Cycles );
+
+		/** Fetches the next opcode and begins the next instruction. */
+		inline void														Tick_NextInstructionStd();
+
+		/** Performs a cycle inside an instruction. */
+		inline void														Tick_InstructionCycleStd();
+
+#ifdef LSN_CPU_VERIFY
+		/**
+		 * Runs a test given a JSON's value representing the test to run.
 		 *
-		 * \tparam _bIncPc If true, PC is updated.
-		 * \tparam _bAdjS If true, S is updated.
-		 * \tparam _bCheckStartOfFunction If true, the LSN_INSTR_START_PHI1( true ) macro call is embedded.
+		 * \param _jJson The JSON file.
+		 * \param _jvTest The test to run.
+		 * \return Returns true if te test succeeds, false otherwise.
 		 */
-		template <bool _bIncPc = false, bool _bAdjS = false, bool _bCheckStartOfFunction = true>
-		inline void														BeginInst();
-	};
+		bool															RunJsonTest( lson::CJson &_jJson, const lson::CJsonContainer::LSON_JSON_VALUE &_jvTest );
 
+		/**
+		 * Times the micro-cycle dispatch loop over every test in a JSON file.
+		 *
+		 * \param _jJson The JSON file.
+		 * \param _jvRoot The array of tests.
+		 * \param _ui32Passes The number of times to run each test.
+		 * \param _bdDispatch How each half-cycle is dispatched.
+		 * \return Returns the average time per cycle in nanoseconds, or 0.0 if no test could be loaded.
+		 */
+		double															BenchJsonTests( lson::CJson &_jJson, const lson::CJsonContainer::LSON_JSON_VALUE &_jvRoot, uint32_t _ui32Passes,
+			LSN_BENCH_DISPATCH _bdDispatch = LSN_BD_INDEX_TABLE );
 
-	// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
-	// DEFINITIONS
-	// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
-	// == Fuctions.
-	/** Fetches the next opcode and begins the next instruction. */
-	inline void CRicoh5A22::Tick_NextInstructionStd() {
-		BeginInst();
-	}
+		/**
+		 * Runs a polling loop (LDA ($10,X) / BEQ back to it, then BRA to itself once the polled register reads non-zero) in slices through
+		 *	RunUntilMasterClock() and each fast engine, and checks that the fast engines stop in the same states on the same cycles while
+		 *	skipping most passes of the loop.
+		 *
+		 * \return Returns true if every engine matches RunUntilMasterClock().
+		 */
+		bool															RunIdleLoopTest();
 
-	/** Performs a cycle inside an instruction. */
-	inline void CRicoh5A22::Tick_InstructionCycleStd() {
-		//(this->*m_iInstructionSet[m_fsState.ui16OpCode].pfHandler[m_fsState.bEmulationMode][m_fsState.ui8FuncIndex])();
-		(this->*m_fsState.pfCurInstruction[m_fsState.ui8FuncIndex])();
+		/**
+		 * Times an engine on a loop of plain-memory loads, adds, stores, and compares (the kind of code RunJit() emits natively).
+		 *
+		 * \param _pfEngine The engine to time.
+		 * \param _ui64MasterCycles The number of master cycles to run.
+		 * \return Returns the average time per CPU cycle in nanoseconds.
+		 */
+		double															BenchEngine( uint64_t (CRicoh5A22::*_pfEngine)( uint64_t ), uint64_t _ui64MasterCycles );
+
+		/**
+		 * Runs the program mapped by MapAotFixture() in slices through RunUntilMasterClock() and RunAot(), with the blocks generated from it
+		 *	(LSNAotFixture.cpp) registered, and checks that RunAot() stops in the same states on the same cycles, makes the same bus
+		 *	accesses, and leaves the same RAM while running most of the program natively.
+		 *
+		 * \return Returns true if RunAot() matches RunUntilMasterClock().
+		 */
+		bool															RunAotTest();
+
+		/**
+		 * Maps the program run by RunAotTest() into $00:8000-$8FFF as read-only memory, the way a cartridge maps its ROM.  $8000 holds
+		 *	the polling loop run by RunIdleLoopTest(), and $8010 a program that runs the same loads, stores, ALU operations, flag operations, and
+		 *	transfers in emulation mode and under each native M/X setting, then ends in a branch to itself.
+		 *
+		 * \param _baBus The bus to which to map the program.
+		 */
+		static void														MapAotFixture( CBusA &_baBus );
+
+		/**
+		 * Gets the entry points of the program mapped by MapAotFixture(), from which CAotCompiler generates LSNAotFixture.cpp.
+		 *
+		 * \return Returns the entry points, as (table << 24) | PB:PC.
+		 */
+		static std::vector<uint64_t>									AotFixtureEntries();
+#endif	// #ifdef LSN_CPU_VERIFY
+
+	protected :
+		// == Enumerations.
+		/** Table sizes. */
+		enum LSN_TABLE_SIZES {
+			LSN_M_MAX_HANDLERS											= 1024,																				/**< The maximum number of unique cycle functions (m_pfHandlers). */
+			LSN_M_DECODE_CACHE_SIZE										= 0x4000,																			/**< The number of entries in the decoded-instruction cache (a power of 2 no smaller than 256). */
+			LSN_M_JIT_ARENA_SIZE										= 16 * 1024 * 1024,																	/**< The size of the executable arena used by RunJit(). */
+			LSN_M_JIT_ARENA_RESERVE										= 64 * 1024,																		/**< When fewer than this many bytes of the arena are left, every block is flushed. */
+			LSN_M_JIT_MAX_BLOCK_INSTR									= 32,																				/**< The maximum number of instructions in a translated block. */
+#ifdef LSN_CPU_VERIFY
+			LSN_M_JIT_HOT_COUNT											= 1,																				/**< The number of times an address must be reached before it is translated.  RunJsonTest() runs each instruction once. */
+#else
+			LSN_M_JIT_HOT_COUNT											= 16,																				/**< The number of times an address must be reached before it is translated. */
+#endif	// #ifdef LSN_CPU_VERIFY
+			LSN_M_IDLE_LOOP_SPAN										= 32,																				/**< The longest backward jump, in bytes, considered as the end of a polling loop. */
+		};
+
+		/** Entries in m_ui8FusedIdle. */
+		enum LSN_FUSED_IDLE {
+			LSN_FI_HALVES_MASK											= 0x1F,																				/**< The number of consecutive idle half-cycles starting at this index, or 0 if the half-cycle does work. */
+			LSN_FI_UPDATE_PC											= 0x20,																				/**< One of the fused half-cycles applies LSN_UPDATE_PC. */
+			LSN_FI_UPDATE_S												= 0x40,																				/**< One of the fused half-cycles applies LSN_UPDATE_S. */
+		};
+
+		/** Describes the data access logged by BlockLogData(). */
+		enum LSN_JIT_LOG_FLAGS : uint8_t {
+			LSN_JLF_WORD												= 0x01,																				/**< 2 bytes (low byte first) rather than 1. */
+			LSN_JLF_BANK0												= 0x02,																				/**< The address is in bank 0 rather than in m_fsState.ui8Bank. */
+			LSN_JLF_READ												= 0x04,																				/**< A read rather than a write. */
+		};
+
+		/** Where a cycle function stores the byte it reads. */
+		enum LSN_READ_TARGET : uint8_t {
+			LSN_RT_OPERAND_LOW											= 0,																				/**< m_fsState.ui16Operand, zero-extended. */
+			LSN_RT_OPERAND_HIGH											= 1,																				/**< m_fsState.ui8Operand[1]. */
+			LSN_RT_ADDRESS_LOW											= 2,																				/**< m_fsState.ui16Address, zero-extended. */
+			LSN_RT_ADDRESS_HIGH											= 3,																				/**< m_fsState.ui8Address[1]. */
+			LSN_RT_POINTER_LOW											= 4,																				/**< m_fsState.ui16Pointer, zero-extended. */
+			LSN_RT_POINTER_HIGH											= 5,																				/**< m_fsState.ui8Pointer[1]. */
+			LSN_RT_BANK													= 6,																				/**< m_fsState.ui8Bank. */
+		};
+
+		/** The registers and temporaries that cycle functions can write, push, transfer, or index with. */
+		enum LSN_REGISTER_SOURCE : uint8_t {
+			LSN_RS_A													= 0,																				/**< A. */
+			LSN_RS_X													= 1,																				/**< X. */
+			LSN_RS_Y													= 2,																				/**< Y. */
+			LSN_RS_S													= 3,																				/**< S. */
+			LSN_RS_D													= 4,																				/**< D. */
+			LSN_RS_DB													= 5,																				/**< DB. */
+			LSN_RS_PB													= 6,																				/**< PB. */
+			LSN_RS_P													= 7,																				/**< P. */
+			LSN_RS_PC													= 8,																				/**< PC. */
+			LSN_RS_ZERO													= 9,																				/**< The constant 0 (STZ). */
+			LSN_RS_OPERAND												= 10,																				/**< m_fsState.ui16Operand. */
+			LSN_RS_ADDRESS												= 11,																				/**< m_fsState.ui16Address. */
+			LSN_RS_NONE													= 12,																				/**< Nothing (no index). */
+		};
+
+		/** How an instruction built by AddrMode_Access() uses its effective address. */
+		enum LSN_ACCESS_TYPE : uint8_t {
+			LSN_AT_READ													= 0,																				/**< Reads the operand and ends with the operation. */
+			LSN_AT_WRITE												= 1,																				/**< Writes m_fsState.ui16Operand, copied from a register by the first cycle. */
+			LSN_AT_RMW													= 2,																				/**< Reads the operand, modifies it, and writes it back. */
+		};
+
+		/** The width of an instruction's operand. */
+		enum LSN_OPERAND_WIDTH : uint8_t {
+			LSN_OW_8													= 0,																				/**< Always 8 bits. */
+			LSN_OW_16													= 1,																				/**< Always 16 bits. */
+			LSN_OW_M													= 2,																				/**< 8 bits if M is set (the accumulator and memory). */
+			LSN_OW_X													= 3,																				/**< 8 bits if X is set (the index registers). */
+		};
+
+
+		// == Types.
+		/** The full state structure for instructions. */
+		LSN_ALIGN_STRUCT( 64 )
+		struct LSN_FULL_STATE {
+			const uint16_t *											pui16CurInstruction = nullptr;														/**< The current instruction being executed, as indices into m_pfHandlers. */
+			const uint16_t (*											pui16InstrTable)[LSN_M_MAX_INSTR_CYCLE_COUNT*2] = nullptr;							/**< The active instruction table (one of m_ui16InstructionSet[LSN_INSTR_TABLES]), selected by SelectInstrTable(). */
+			LSN_REGISTERS												rRegs;																				/**< Registers. */
+
+			LSN_VECTORS													vBrkVector = LSN_V_BRK;																/**< The vector to use inside BRK and whether to push B with status. */
+			union {
+				uint8_t													ui8Operand[2];																		/**< The operand. */
+				uint16_t												ui16Operand;																		/**< The operand. */
+			};
+			union {
+				uint8_t													ui8Address[2];																		/**< An address loaded into memory before transfer to a register such as PC. */
+				uint16_t												ui16Address;																		/**< An address loaded into memory before transfer to a register such as PC. */
+			};
+			union {
+				uint8_t													ui8Pointer[2];																		/**< An address loaded into memory for indirect access. */
+				uint16_t												ui16Pointer;																		/**< An address loaded into memory for indirect access. */
+			};
+			uint16_t													ui16OpCode = 0;																		/**< The current opcode. */
+			uint16_t													ui16PcModify = 0;																	/**< The amount by which to modify PC during the next Phi1. */
+			uint16_t													ui16SModify = 0;																	/**< The amount by which to modify S during the next Phi1. */
+			uint8_t														ui8FuncIndex = 0;																	/**< The function index. */
+			uint8_t														ui8Bank = 0;																		/**< Holds the bank for long reads/writes. */
+		
+			bool														bIsReadCycle = true;																/**< Is the current cycle a read? */
+			bool														bBoundaryCrossed = false;															/**< Did we cross a page boundary? */
+			bool														bPushB = false;																		/**< Push the B flag with the status byte? */
+			bool														bAllowWritingToPc = true;															/**< Allow writing to PC? */
+			bool														bTakeJump;																			/**< Determines if a branch is taken. */
+		
+			bool														bEmulationMode = true;																/**< Emulation Mode flag. */
+
+			bool														bCopiedState = false;																/**< If m_bRdyLow triggers a state copy, this is set in PHI1 after the copy and used in PHI2 to know that a copy was made and to abord PHI2 as soon as the read address has been finalized. */
+		} LSN_ALIGN_STRUCT_END( 64 );
+
+#if LSN_CPU_JIT
+		/** A block of instructions for RunJit(). */
+		struct LSN_JIT_BLOCK {
+			CJitX64::PfFunc												pfCode = nullptr;																	/**< The translated code, or nullptr if the block is not hot yet or could not be translated. */
+			uint32_t													ui32Hits = 0;																		/**< The number of times the block's address has been reached. */
+			uint8_t														ui8Op = 0;																			/**< The first opcode of the block. */
+			bool														bValid = true;																		/**< Cleared when any page holding one of the block's opcodes is written. */
+			bool														bUntranslatable = false;															/**< Set if translation failed, so it is not tried again. */
+		};
+#endif	// #if LSN_CPU_JIT
+
+		/** A decoded-instruction cache entry. */
+		struct LSN_DECODED_INSTR {
+			uint32_t													ui32Addr = UINT32_MAX;																/**< The 24-bit PB:PC of the instruction, or UINT32_MAX if the entry is unused. */
+			uint8_t														ui8Op = 0;																			/**< The opcode at ui32Addr. */
+		};
+
+
+		// == Members.
+		PfTicks															m_pfTickFunc = nullptr;																/**< The current tick function (called by Tick()). */
+		PfTicks															m_pfTickFuncCopy = nullptr;															/**< A copy of the current tick, used to restore the intended original tick when control flow is changed by DMA transfers. */
+		CBusA &															m_baBusA;																			/**< Bus A. */
+		
+		LSN_FULL_STATE													m_fsState;																			/**< Everything a standard instruction-cycle function can modify.  Backed up at the start of the first DMA read cycle and restored at the end after the read address for that cycle has been calculated. */
+		LSN_FULL_STATE													m_fsStateBackup;																	/**< The backup of the state for the cycle that first gets interrupted by DMA and is then executed at the end of DMA. */
+		static const std::array<LSN_INSTR, 256>							m_iInstructionSet;																	/**< The instruction set, generated at compile time by GenerateInstructionSet(). */
+		static PfCycle													m_pfHandlers[LSN_M_MAX_HANDLERS];													/**< Every unique cycle function used by m_iInstructionSet, each stored once. Index 0 is nullptr. */
+		static uint16_t													m_ui16InstructionSet[LSN_IT_TOTAL][256][LSN_M_MAX_INSTR_CYCLE_COUNT*2];				/**< m_iInstructionSet[].pfHandler as indices into m_pfHandlers, one table per LSN_INSTR_TABLES.  This is what the CPU executes. */
+		static uint8_t													m_ui8FusedIdle[LSN_IT_TOTAL][256][LSN_M_MAX_INSTR_CYCLE_COUNT*2];					/**< Parallel to m_ui16InstructionSet: LSN_FUSED_IDLE runs of bus-idle half-cycles that StepInstructionFast() and translated blocks skip in one step. */
+		static uint16_t													m_ui16NextInstruction[1];															/**< The "instruction" that runs between instructions: its only PHI1 function is Tick_NextInstructionStd(). */
+		static uint16_t													m_ui16FetchOpcode[1];																/**< Every instruction starts with Fetch_Opcode_IncPc_Phi2(); BeginInst() points m_fsState.pui16CurInstruction here until the opcode is known. */
+		static size_t													m_sTotalHandlers;																	/**< The number of used entries in m_pfHandlers. */
+		static const bool												m_bCompactTablesBuilt;																/**< Forces BuildCompactTables() to run during static initialization. */
+
+		bool															m_bNmiStatusLine = false;															/**< The status line for NMI. */
+		bool															m_bLastNmiStatusLine = false;														/**< THe last status line for NMI. */
+		bool															m_bDetectedNmi = false;																/**< The edge detector for the PHI2 part of the cycle. */
+		bool															m_bHandleNmi = false;																/**< Once an NMI edge is detected, this is set to indicate that it needs to be handled on the PHI1 of the next cycle. */
+		bool															m_bHandleIrq = false;																/**< Once the IRQ status line is detected as having triggered, this tells us to handle an IRQ on the next instruction. */
+		bool															m_bIsReset = true;																	/**< Are we resetting? */
+		bool															m_bBrkIsReset = true;																/**< Shadows m_bIsReset, but m_bIsReset gets unset in the middle of BRK, while this lasts the whole BRK. */
+		bool															m_bIrqLine = false;																	/**< The level of the IRQ line (true when asserted). */
+		bool															m_bInterruptPending = true;															/**< m_bHandleNmi || (m_bIrqLine && !I) || m_bIsReset: the only flag polled at instruction boundaries. */
+
+		bool															m_bRdyLow = false;																	/**< When RDY is pulled low, reads inside opcodes abort the CPU cycle. */
+		uint8_t															m_ui8Halt = LSN_H_NONE;																/**< An LSN_HALT: set by WAI and STP, cleared when the CPU wakes. */
+		bool															m_bHaltedPhi1 = false;																/**< While halted, set by each idle PHI2 so that the PHI1 after it (dispatched to the same function) does nothing. */
+
+		uint64_t														m_ui64MasterCycles = 0;																/**< The master-clock ticks consumed by the CPU (the sum of each cycle's divisor). */
+		uint64_t														m_ui64EventDeadlines[LSN_EV_TOTAL] = { UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX };	/**< The master-clock time of each registered event. */
+		uint64_t														m_ui64NextEvent = UINT64_MAX;														/**< The earliest value in m_ui64EventDeadlines. */
+		LSN_DECODED_INSTR												m_diDecodeCache[LSN_M_DECODE_CACHE_SIZE];											/**< Opcodes already fetched from plain-memory pages, indexed by PB:PC.  Used only by RunInstructions() and RunJit(). */
+#if LSN_CPU_JIT
+		CJitX64															m_jJit;																				/**< The x86-64 emitter and its executable arena. */
+		std::unordered_map<uint64_t, std::unique_ptr<LSN_JIT_BLOCK>>	m_umJitBlocks;																		/**< Blocks keyed by (table << 24) | PB:PC. */
+		std::unordered_map<uint16_t, std::vector<uint64_t>>				m_umJitPages;																		/**< The keys of the blocks holding opcodes on each page. */
+		std::vector<std::unique_ptr<LSN_JIT_BLOCK>>						m_vJitRetired;																		/**< Invalidated blocks, kept alive until RunJit() is between blocks. */
+#endif	// #if LSN_CPU_JIT
+		std::unordered_map<uint64_t, const LSN_AOT_BLOCK *>				m_umAotBlocks;																		/**< The blocks registered with SetAotBlocks(), keyed by (table << 24) | PB:PC. */
+		uint64_t														m_ui64BlockLimit = 0;																/**< The _ui64MasterClock passed to RunJit()/RunAot(). */
+		uint64_t														m_ui64BlockCycles = 0;																/**< The cycles run by translated or generated blocks during the current RunJit()/RunAot(). */
+#ifdef LSN_CPU_VERIFY
+		uint64_t														m_ui64AotNative = 0;																/**< The instructions run natively by generated blocks.  Checked by RunAotTest(). */
+#endif	// #ifdef LSN_CPU_VERIFY
+#if LSN_CPU_IDLE_LOOPS
+		LSN_FULL_STATE													m_fsIdleLoop;																		/**< m_fsState at the start of the last pass of the candidate polling loop. */
+		uint64_t														m_ui64IdleLoopTime = 0;																/**< m_ui64MasterCycles at the start of the last pass. */
+		uint64_t														m_ui64IdleLoopCycles = 0;															/**< The cycles run by the current Run*() call at the start of the last pass. */
+		uint32_t														m_ui32IdleLoop = UINT32_MAX;														/**< The PB:PC of the candidate polling loop, or UINT32_MAX. */
+#endif	// #if LSN_CPU_IDLE_LOOPS
+
+
+		// == Functions.
+		/**
+		 * Creates an instruction with no cycle functions.  Add them with SetCycles() or AddCycles().
+		 * 
+		 * \param _ui8CyclesN Total cycles in native mode.
+		 * \param _ui8CyclesE Total cycles in emulation mode.
+		 * \param _amAddrMode The addressing mode.
+		 * \param _ui8SizeN The size of the instruction in native mode.
+		 * \param _ui8SizeE The size of the instruction in emulation mode.
+		 * \param _iInstruction The instruction.
+		 * \return Returns the fully constructed instruction.
+		 **/
+		static constexpr LSN_INSTR										MakeInstr( uint8_t _ui8CyclesN, uint8_t _ui8CyclesE, LSN_ADDRESSING_MODES _amAddrMode, uint8_t _ui8SizeN, uint8_t _ui8SizeE, LSN_INSTRUCTIONS _iInstruction );
+
+		/**
+		 * Sets the cycle functions of an instruction for the given table variants.
+		 * 
+		 * \param _iInstr The instruction to modify.
+		 * \param _ilTables The table variants to which to assign the cycle functions.
+		 * \param _ilCycles The cycle functions, in order.
+		 **/
+		static constexpr void											SetCycles( LSN_INSTR &_iInstr, std::initializer_list<LSN_INSTR_TABLES> _ilTables, std::initializer_list<PfCycle> _ilCycles );
+
+		/**
+		 * Appends cycle functions to one table variant of an instruction.
+		 * 
+		 * \param _iInstr The instruction to modify.
+		 * \param _sTable The table variant (an LSN_INSTR_TABLES value).
+		 * \param _sIdx The index at which to start.
+		 * \param _ilCycles The cycle functions, in order.
+		 * \return Returns the index after the last added function.
+		 **/
+		static constexpr size_t											AddCycles( LSN_INSTR &_iInstr, size_t _sTable, size_t _sIdx, std::initializer_list<PfCycle> _ilCycles );
+
+		/**
+		 * Determines whether an operand is 8 bits wide in a table variant.
+		 * 
+		 * \param _owWidth The width of the operand.
+		 * \param _sTable The table variant (an LSN_INSTR_TABLES value).
+		 * \return Returns true if the operand is 8 bits wide.
+		 **/
+		static constexpr bool											Is8Bit( LSN_OPERAND_WIDTH _owWidth, size_t _sTable );
+
+		/**
+		 * Creates BRK or COP.
+		 * 
+		 * \param _bCop If true, COP is created.
+		 * \return Returns the instruction.
+		 **/
+		static constexpr LSN_INSTR										Inst_Brk( bool _bCop );
+
+		/**
+		 * Creates BRL.
+		 * 
+		 * \return Returns BRL.
+		 **/
+		static constexpr LSN_INSTR										Inst_Brl();
+
+		/**
+		 * Creates the instruction used for any opcode that GenerateInstruction() does not decode.  Every opcode is decoded, so it is never
+		 *	reached; it stops the clock exactly like STP rather than leaving an empty table entry.
+		 * 
+		 * \return Returns the instruction.
+		 **/
+		static constexpr LSN_INSTR										Inst_Jam();
+
+		/**
+		 * Creates JMP or JML.
+		 * 
+		 * \param _iInstruction LSN_I_JMP or LSN_I_JML.
+		 * \param _amAddrMode LSN_AM_ABSOLUTE, LSN_AM_ABSOLUTE_LONG, LSN_AM_INDIRECT, LSN_AM_ABSOLUTE_INDEXED_INDIRECT, or
+		 *	LSN_AM_ABSOLUTE_INDIRECT_LONG.
+		 * \return Returns the instruction.
+		 **/
+		static constexpr LSN_INSTR										Inst_Jmp( LSN_INSTRUCTIONS _iInstruction, LSN_ADDRESSING_MODES _amAddrMode );
+
+		/**
+		 * Creates JSR or JSL.
+		 * 
+		 * \param _amAddrMode LSN_AM_ABSOLUTE or LSN_AM_ABSOLUTE_INDEXED_INDIRECT for JSR, LSN_AM_ABSOLUTE_LONG for JSL.
+		 * \return Returns the instruction.
+		 **/
+		static constexpr LSN_INSTR										Inst_Jsr( LSN_ADDRESSING_MODES _amAddrMode );
+
+		/**
+		 * Creates MVN or MVP.  Each pass moves 1 byte and, until A wraps, moves PC back to the opcode so that the instruction runs again.
+		 * 
+		 * \param _bMvn If true, MVN is created, otherwise MVP.
+		 * \return Returns the instruction.
+		 **/
+		static constexpr LSN_INSTR										Inst_Move( bool _bMvn );
+
+		/**
+		 * Creates PEA, PEI, or PER.
+		 * 
+		 * \param _iInstruction LSN_I_PEA, LSN_I_PEI, or LSN_I_PER.
+		 * \return Returns the instruction.
+		 **/
+		static constexpr LSN_INSTR										Inst_PushEffective( LSN_INSTRUCTIONS _iInstruction );
+
+		/**
+		 * Creates REP or SEP.
+		 * 
+		 * \param _pfOp The operation (Rep() or Sep()), called on the PHI1 of the next instruction's first cycle with the mask in m_fsState.ui16Operand.
+		 * \param _iInstruction The instruction.
+		 * \return Returns the instruction.
+		 **/
+		static constexpr LSN_INSTR										Inst_RepSep( PfCycle _pfOp, LSN_INSTRUCTIONS _iInstruction );
+
+		/**
+		 * Creates RTI, RTL, or RTS.
+		 * 
+		 * \param _iInstruction LSN_I_RTI, LSN_I_RTL, or LSN_I_RTS.
+		 * \return Returns the instruction.
+		 **/
+		static constexpr LSN_INSTR										Inst_Return( LSN_INSTRUCTIONS _iInstruction );
+
+		/**
+		 * Creates STP.
+		 * 
+		 * \return Returns STP.
+		 **/
+		static constexpr LSN_INSTR										Inst_Stp();
+
+		/**
+		 * Creates WAI.
+		 * 
+		 * \return Returns WAI.
+		 **/
+		static constexpr LSN_INSTR										Inst_Wai();
+
+		/**
+		 * Creates WDM (a 2-byte no-op).
+		 * 
+		 * \return Returns WDM.
+		 **/
+		static constexpr LSN_INSTR										Inst_Wdm();
+
+		/**
+		 * Creates XBA.
+		 * 
+		 * \return Returns XBA.
+		 **/
+		static constexpr LSN_INSTR										Inst_Xba();
+
+		/**
+		 * Creates an instruction that reads, writes, or modifies memory through any of the data addressing modes.  The addressing cycles are
+		 *	shared by every instruction using the mode; only the operation differs.
+		 * 
+		 * \param _amAddrMode The addressing mode.
+		 * \param _atAccess The type of access.
+		 * \param _owWidth The width of the operand.
+		 * \param _pfOp8 The 8-bit operation.  For reads, it ends the instruction with the value read in m_fsState.ui16Operand.  For
+		 *	read-modify-writes, it modifies m_fsState.ui16Operand.  For writes, it is the first PHI1, which copies the register to
+		 *	m_fsState.ui16Operand (Copy_To_Operand_IncPc()).
+		 * \param _pfOp16 The 16-bit operation.
+		 * \param _iInstruction The instruction.
+		 * \return Returns the instruction.
+		 **/
+		static constexpr LSN_INSTR										AddrMode_Access( LSN_ADDRESSING_MODES _amAddrMode, LSN_ACCESS_TYPE _atAccess, LSN_OPERAND_WIDTH _owWidth, PfCycle _pfOp8, PfCycle _pfOp16, LSN_INSTRUCTIONS _iInstruction );
+
+		/**
+		 * Creates an instruction using the Immediate addressing mode.  The operand is 2 bytes in the table variants in which it is 16 bits.
+		 * 
+		 * \param _pfOp8 The 8-bit operation, called on the PHI1 of the next instruction's first cycle with the operand in m_fsState.ui16Operand.
+		 * \param _pfOp16 The 16-bit operation.
+		 * \param _owWidth The width of the operand.
+		 * \param _iInstruction The instruction.
+		 * \return Returns the instruction.
+		 **/
+		static constexpr LSN_INSTR										AddrMode_Immediate( PfCycle _pfOp8, PfCycle _pfOp16, LSN_OPERAND_WIDTH _owWidth, LSN_INSTRUCTIONS _iInstruction );
+
+		/**
+		 * Creates a 2-cycle instruction using the Implied addressing mode.
+		 * 
+		 * \param _pfOp The operation, called on the PHI1 of the next instruction's first cycle.
+		 * \param _iInstruction The instruction.
+		 * \return Returns the instruction.
+		 **/
+		static constexpr LSN_INSTR										AddrMode_Implied( PfCycle _pfOp, LSN_INSTRUCTIONS _iInstruction );
+
+		/**
+		 * Creates a 2-cycle instruction using the Implied addressing mode whose operation depends on the width of a register.
+		 * 
+		 * \param _pfOp8 The 8-bit operation, called on the PHI1 of the next instruction's first cycle.
+		 * \param _pfOp16 The 16-bit operation.
+		 * \param _owWidth The width of the register.
+		 * \param _iInstruction The instruction.
+		 * \return Returns the instruction.
+		 **/
+		static constexpr LSN_INSTR										AddrMode_Implied( PfCycle _pfOp8, PfCycle _pfOp16, LSN_OPERAND_WIDTH _owWidth, LSN_INSTRUCTIONS _iInstruction );
+
+		/**
+		 * Creates a pull (PLA, PLB, PLD, PLP, PLX, or PLY).
+		 * 
+		 * \param _pfOp8 The 8-bit operation, called on the PHI1 of the next instruction's first cycle with the value pulled in
+		 *	m_fsState.ui16Operand.  It must update S.
+		 * \param _pfOp16 The 16-bit operation.
+		 * \param _owWidth The width of the register.
+		 * \param _bNative If true, the stack is not wrapped inside page 1 in emulation mode (PLB and PLD).
+		 * \param _iInstruction The instruction.
+		 * \return Returns the instruction.
+		 **/
+		static constexpr LSN_INSTR										AddrMode_Pull( PfCycle _pfOp8, PfCycle _pfOp16, LSN_OPERAND_WIDTH _owWidth, bool _bNative, LSN_INSTRUCTIONS _iInstruction );
+
+		/**
+		 * Creates a push (PHA, PHB, PHD, PHK, PHP, PHX, or PHY).
+		 * 
+		 * \param _pfCopy The Copy_To_Operand_IncPc() specialization that copies the register to m_fsState.ui16Operand.
+		 * \param _owWidth The width of the register.
+		 * \param _bNative If true, the stack is not wrapped inside page 1 in emulation mode (PHD).
+		 * \param _iInstruction The instruction.
+		 * \return Returns the instruction.
+		 **/
+		static constexpr LSN_INSTR										AddrMode_Push( PfCycle _pfCopy, LSN_OPERAND_WIDTH _owWidth, bool _bNative, LSN_INSTRUCTIONS _iInstruction );
+
+		/**
+		 * Creates a branch instruction using the Relative addressing mode.  A taken branch adds a cycle, and in emulation mode crossing
+		 *	a page adds another.  Cycles are removed by Branch_Phi2(), so the untaken branch skips both.
+		 * 
+		 * \param _pfBranch The Branch_Phi2() specialization that reads the offset and decides the branch.
+		 * \param _iInstruction The instruction.
+		 * \return Returns the instruction.
+		 **/
+		static constexpr LSN_INSTR										AddrMode_Relative( PfCycle _pfBranch, LSN_INSTRUCTIONS _iInstruction );
+
+		/**
+		 * Generates a single instruction given its opcode.  Opcodes are decoded the way the 65C816 lays them out (aaabbbcc), so that every
+		 *	instruction sharing an addressing mode gets the exact same cycle functions, differing only in the operation.
+		 * 
+		 * \param _ui8Op The opcode.
+		 * \return Returns the instruction for the given opcode.
+		 **/
+		static constexpr LSN_INSTR										GenerateInstruction( uint8_t _ui8Op );
+
+		/**
+		 * Generates the full instruction set.
+		 * 
+		 * \return Returns all 256 instructions.
+		 **/
+		static constexpr std::array<LSN_INSTR, 256>						GenerateInstructionSet();
+
+		/**
+		 * Adds or subtracts with carry into A, handling decimal mode, and updates N, V, Z, and C.
+		 * 
+		 * \tparam _tType uint8_t to operate on the low byte of A, uint16_t to operate on all of A.
+		 * \tparam _bSubtract If true, SBC is performed, otherwise ADC.
+		 * \param _tVal The operand.
+		 **/
+		template <typename _tType, bool _bSubtract>
+		inline void														AddWithCarry( _tType _tVal );
+
+		/**
+		 * Compares a register with m_fsState.ui16Operand (CMP, CPX, CPY) and updates N, Z, and C.
+		 * 
+		 * \tparam _b8Bit If true, only the low bytes are compared.
+		 * \param _ui16Reg The register.
+		 **/
+		template <bool _b8Bit>
+		void															Compare( uint16_t _ui16Reg );
+
+		/**
+		 * Gets the bank-0 address of an offset into the direct page.  In emulation mode with DL = 0 the offset wraps inside the page,
+		 *	otherwise it is added to D and wraps at 16 bits.
+		 * 
+		 * \param _ui16Offset The offset, including any index.
+		 * \return Returns the address.
+		 **/
+		uint16_t														DirectAddress( uint16_t _ui16Offset ) const;
+
+		/**
+		 * Forms DB:m_fsState.ui16Address plus an index in m_fsState.ui8Bank and m_fsState.ui16Address and moves to the next cycle, skipping
+		 *	the index cycle if requested and indexing does not cross a page.
+		 * 
+		 * \tparam _ui8Index The LSN_REGISTER_SOURCE index register, or LSN_RS_NONE.
+		 * \tparam _bSkipNoCross If true, the next cycle is skipped unless indexing crosses a page.
+		 **/
+		template <uint8_t _ui8Index, bool _bSkipNoCross>
+		void															IndexAddress();
+
+		/**
+		 * Gets a writable register or temporary.
+		 * 
+		 * \tparam _ui8Reg LSN_RS_A, LSN_RS_X, LSN_RS_Y, LSN_RS_S, LSN_RS_D, or LSN_RS_OPERAND.
+		 * \return Returns a reference to the register.
+		 **/
+		template <uint8_t _ui8Reg>
+		uint16_t &														Register();
+
+		/**
+		 * Gets the value of a register or temporary, zero-extended.
+		 * 
+		 * \tparam _ui8Src The LSN_REGISTER_SOURCE.
+		 * \return Returns the value, or 0 for LSN_RS_ZERO and LSN_RS_NONE.
+		 **/
+		template <uint8_t _ui8Src>
+		uint16_t														RegisterValue() const;
+
+		/**
+		 * Updates N and Z from a result.
+		 * 
+		 * \tparam _b8Bit If true, the result is 8 bits.
+		 * \param _ui16Val The result.
+		 **/
+		template <bool _b8Bit>
+		void															SetNz( uint16_t _ui16Val );
+
+		/**
+		 * Stores a byte read from the bus.
+		 * 
+		 * \tparam _ui8Target The LSN_READ_TARGET.  LOW targets are zero-extended.
+		 * \param _ui8Val The byte.
+		 **/
+		template <uint8_t _ui8Target>
+		void															StoreRead( uint8_t _ui8Val );
+
+		/**
+		 * Builds m_pfHandlers and m_ui16InstructionSet from m_iInstructionSet.  Each member-function pointer is 16 bytes on the Itanium ABI (and
+		 *	at least 8 with MSVC), so m_iInstructionSet itself is far too large to keep hot in the cache.  The CPU instead executes from
+		 *	m_ui16InstructionSet, which stores 2-byte indices into the deduplicated m_pfHandlers.
+		 * 
+		 * \return Returns true.
+		 **/
+		static bool														BuildCompactTables();
+
+		/**
+		 * Builds m_ui8FusedIdle from m_ui16InstructionSet.  A half-cycle is idle if its function only advances ui8FuncIndex, optionally
+		 *	applying LSN_UPDATE_PC/LSN_UPDATE_S (the Null() family on PHI1 and Null_Phi2() on PHI2), and each index records how many idle
+		 *	half-cycles start there.
+		 **/
+		static void														BuildFusedIdle();
+
+		/**
+		 * Gets the index of a cycle function in m_pfHandlers, adding it if it is not already there.
+		 * 
+		 * \param _pfFunc The function to find or add.
+		 * \return Returns the index of _pfFunc inside m_pfHandlers.
+		 **/
+		static uint16_t													HandlerIndex( PfCycle _pfFunc );
+
+		/**
+		 * Called by Bus A when a page from which instructions were decoded is written or remapped.  Removes that page's entries from m_diDecodeCache
+		 *	and drops the translated blocks holding opcodes from it.
+		 * 
+		 * \param _pvParm The CRicoh5A22 object.
+		 * \param _ui16Page The page that was written (the full 24-bit address divided by 256).
+		 **/
+		static void LSN_FASTCALL										PageWritten( void * _pvParm, uint16_t _ui16Page );
+
+		/**
+		 * Gets the index of the active instruction table.
+		 * 
+		 * \return Returns the LSN_INSTR_TABLES value matching m_fsState.pui16InstrTable.
+		 **/
+		inline size_t													InstrTableIndex() const { return size_t( m_fsState.pui16InstrTable - m_ui16InstructionSet[0] ) / 256; }
+
+		/**
+		 * Determines whether the next instruction can be run without per-cycle checks: the CPU must be at an instruction boundary with no
+		 *	event deadline inside the worst-case length of an instruction, and with no pending IRQ, NMI, reset, or RDY.
+		 * 
+		 * \param _ui64Window The worst-case length of an instruction in master-clock ticks.
+		 * \return Returns true if the next instruction can be run in one go.
+		 **/
+		inline bool														CanRunFast( uint64_t _ui64Window ) const;
+
+		/**
+		 * Recomputes m_bInterruptPending.  Must be called whenever m_bHandleNmi, m_bIrqLine, m_bIsReset, m_ui8Halt, or the I flag changes.
+		 *	A masked IRQ does not count, so a game that leaves the line asserted under SEI keeps the fast paths.  A halted CPU counts as
+		 *	pending so that the boundary checks send it to Fetch_Opcode_IncPc_Phi2(), which idles instead of fetching.
+		 **/
+		inline void														UpdateInterruptPending() {
+			m_bInterruptPending = m_bHandleNmi || (m_bIrqLine && !(m_fsState.rRegs.ui8Status & I())) || m_bIsReset || m_ui8Halt != LSN_H_NONE;
+		}
+
+		/**
+		 * Writes the status register.  M and X always read as 1 in emulation mode, and setting X clears the high bytes of X and Y.  Every
+		 *	write to P that can change M, X, or I goes through here, so that the instruction table follows the new widths and
+		 *	m_bInterruptPending follows the new mask.
+		 * 
+		 * \param _ui8Status The new value of P.
+		 **/
+		inline void														SetStatus( uint8_t _ui8Status ) {
+			if ( m_fsState.bEmulationMode ) { _ui8Status |= M() | X(); }
+			m_fsState.rRegs.ui8Status = _ui8Status;
+			if ( _ui8Status & X() ) {
+				m_fsState.rRegs.ui8X[1] = 0;
+				m_fsState.rRegs.ui8Y[1] = 0;
+			}
+			SelectInstrTable();
+			UpdateInterruptPending();
+		}
+
+		/**
+		 * Decides at an instruction boundary whether an interrupt is taken instead of the next opcode.  Only called when
+		 *	m_bInterruptPending is set.  The IRQ line is level-sensitive, so it is sampled against the I flag here each time.
+		 * 
+		 * \return Returns true if a reset, NMI, or IRQ is to be taken.
+		 **/
+		inline bool														PollInterrupts() {
+			m_bHandleIrq = m_bIrqLine && !(m_fsState.rRegs.ui8Status & I());
+			return m_bHandleNmi || m_bHandleIrq || m_bIsReset;
+		}
+
+		/**
+		 * Runs cycles up to the next instruction boundary, stopping exactly at the next event deadline.
+		 * 
+		 * \param _ui64Run Incremented by the number of cycles run.
+		 **/
+		inline void														StepInstructionMicro( uint64_t &_ui64Run );
+
+		/**
+		 * Runs the rest of the current instruction and the next opcode fetch, checking only for the next event deadline.  CanRunFast() must be
+		 *	true.  If a deadline is reached (including one registered by the instruction's own bus accesses), stops on that cycle boundary
+		 *	instead, leaving the rest of the instruction to StepInstructionMicro().
+		 * 
+		 * \param _ui64Run Incremented by the number of cycles run.
+		 **/
+		inline void														StepInstructionFast( uint64_t &_ui64Run );
+
+		/**
+		 * Performs a run of idle half-cycles in one step: advances ui8FuncIndex past them, applies any PC/S update, and accounts for the
+		 *	cycles they complete (each completed by Null_Phi2(), so at Fast speed).  Does nothing if the run would reach the next event deadline.
+		 * 
+		 * \param _ui8Fused The run's m_ui8FusedIdle entry.
+		 * \param _ui64Run Incremented by the number of cycles completed.
+		 * \return Returns false if the run would reach the next event deadline, in which case its half-cycles must be run one at a time.
+		 **/
+		inline bool														RunFusedIdle( uint8_t _ui8Fused, uint64_t &_ui64Run );
+
+		/**
+		 * Determines whether a CPU stopped by WAI or STP wakes on its next cycle.
+		 * 
+		 * \return Returns true on reset, or after WAI if an NMI or IRQ is pending.  IRQ wakes WAI even while I is set.
+		 **/
+		inline bool														HaltWakes() const {
+			return m_bIsReset || (m_ui8Halt == LSN_H_WAI && (m_bHandleNmi || m_bIrqLine));
+		}
+
+		/**
+		 * Called by Fetch_Opcode_IncPc_Phi2() in place of the fetch while halted.  The halted CPU sits at index 0, where both the PHI1 and the
+		 *	PHI2 of each cycle land in Fetch_Opcode_IncPc_Phi2().  Each PHI2 either idles at Fast speed or wakes the CPU and lets the fetch run.
+		 * 
+		 * \return Returns true if the half-cycle was spent idling, false if the CPU woke and the fetch is to be performed.
+		 **/
+		inline bool														HaltedCycle();
+
+		/**
+		 * Runs a halted CPU.  Between wake-ups nothing but time can change, so once the CPU is idling every cycle up to the next event
+		 *	deadline (or _ui64MasterClock) is accounted for in one step.  Otherwise (on the way in or out of the halt) one cycle is run.
+		 * 
+		 * \param _ui64MasterClock The master-clock value at which to stop.
+		 * \param _ui64Run Incremented by the number of cycles run.
+		 **/
+		inline void														RunHalted( uint64_t _ui64MasterClock, uint64_t &_ui64Run );
+
+		/**
+		 * Gets the 24-bit address of the next instruction.  At an instruction boundary this is the address of the opcode just fetched.
+		 * 
+		 * \return Returns PB:PC.
+		 **/
+		inline uint32_t													ProgramAddress() const { return (uint32_t( m_fsState.rRegs.ui8Pb ) << 16) | m_fsState.rRegs.ui16Pc; }
+
+		/**
+		 * Called after each instruction or block run by the fast path.  On a short backward jump, the state is compared with that of the
+		 *	last time the same address was reached this way.  If it matches, and Bus A saw no writes and only reads that do not change before
+		 *	some master cycle, every pass up to that cycle (or the next event deadline, or _ui64MasterClock) would repeat the last one
+		 *	exactly, so they are accounted for without being run.  Each such jump starts a new pass.
+		 * 
+		 * \param _ui32From The PB:PC at which the instruction or block started.
+		 * \param _ui64MasterClock The master-clock value at which to stop.
+		 * \param _ui64Run The cycles run so far by the current call (excluding m_ui64BlockCycles), incremented by the cycles skipped.
+		 **/
+		inline void														CheckIdleLoop( uint32_t _ui32From, uint64_t _ui64MasterClock, uint64_t &_ui64Run );
+
+		/**
+		 * Compares the state of 2 passes of a polling loop at an instruction boundary: the registers, the mode, and everything the fetch left
+		 *	for the next instruction.  Per-cycle scratch (bTakeJump, bIsReadCycle, etc.) and the struct's padding are not compared; the
+		 *	operand, address, and pointer are, since an instruction may use them before reloading them.
+		 * 
+		 * \param _fsA The first state.
+		 * \param _fsB The second state.
+		 * \return Returns true if running on from either state would give the same results.
+		 **/
+		static inline bool												SameLoopState( const LSN_FULL_STATE &_fsA, const LSN_FULL_STATE &_fsB ) {
+			return _fsA.rRegs.ui16A == _fsB.rRegs.ui16A && _fsA.rRegs.ui16X == _fsB.rRegs.ui16X && _fsA.rRegs.ui16Y == _fsB.rRegs.ui16Y &&
+				_fsA.rRegs.ui16Pc == _fsB.rRegs.ui16Pc && _fsA.rRegs.ui16S == _fsB.rRegs.ui16S && _fsA.rRegs.ui8Status == _fsB.rRegs.ui8Status &&
+				_fsA.rRegs.ui16D == _fsB.rRegs.ui16D && _fsA.rRegs.ui8Db == _fsB.rRegs.ui8Db && _fsA.rRegs.ui8Pb == _fsB.rRegs.ui8Pb &&
+				_fsA.bEmulationMode == _fsB.bEmulationMode &&
+				_fsA.pui16CurInstruction == _fsB.pui16CurInstruction && _fsA.pui16InstrTable == _fsB.pui16InstrTable &&
+				_fsA.ui16OpCode == _fsB.ui16OpCode && _fsA.ui16PcModify == _fsB.ui16PcModify && _fsA.ui16SModify == _fsB.ui16SModify &&
+				_fsA.ui8FuncIndex == _fsB.ui8FuncIndex && _fsA.ui8Bank == _fsB.ui8Bank &&
+				_fsA.ui16Operand == _fsB.ui16Operand && _fsA.ui16Address == _fsB.ui16Address && _fsA.ui16Pointer == _fsB.ui16Pointer &&
+				_fsA.vBrkVector == _fsB.vBrkVector && _fsA.bPushB == _fsB.bPushB && _fsA.bAllowWritingToPc == _fsB.bAllowWritingToPc;
+		}
+
+		/**
+		 * Drops the candidate polling loop, so that CheckIdleLoop() has to see 2 more passes before skipping any.  Called whenever
+		 *	anything other than the fast path runs.
+		 **/
+		inline void														ForgetIdleLoop() {
+#if LSN_CPU_IDLE_LOOPS
+			m_ui32IdleLoop = UINT32_MAX;
+#endif	// #if LSN_CPU_IDLE_LOOPS
+		}
+
+#if LSN_CPU_JIT
+		/**
+		 * Gets the translated block starting at the current instruction, counting the hit and translating the block once it is hot.
+		 * 
+		 * \return Returns the block to run, or nullptr if the instruction is to be interpreted.
+		 **/
+		LSN_JIT_BLOCK *													JitBlock();
+
+		/**
+		 * Translates the block of instructions that starts at the current instruction.
+		 * 
+		 * \param _ui64Key The key of the block ((table << 24) | PB:PC).
+		 * \param _pjbBlock The block being translated, whose bValid is passed to BlockFetch() so that it can stop once the block is invalidated.
+		 * \return Returns the translated code, or nullptr if nothing could be translated.
+		 **/
+		CJitX64::PfFunc													JitTranslate( uint64_t _ui64Key, LSN_JIT_BLOCK * _pjbBlock );
+
+		/**
+		 * Emits an instruction as native x86-64 code, if it is one of the simple loads, stores, ALU operations, flag operations, or transfers
+		 *	that can run without the cycle functions.  The native code picks up right after the opcode fetch and leaves the CPU exactly as
+		 *	the cycle functions would at the end of the instruction.  Before any side effect it checks that each data access lands in plain
+		 *	memory (and that stores do not hit a watched page) and that ADC/SBC are in binary mode, and jumps to _lSlow otherwise.
+		 * 
+		 * \param _sTable The instruction table (an LSN_INSTR_TABLES value).
+		 * \param _ui8Op The opcode.
+		 * \param _ui8Pb The bank of the instruction.
+		 * \param _ui16Pc The address of the opcode.
+		 * \param _ui64Key The key of the block, registered with each extra page holding the instruction's operand.
+		 * \param _lSlow The label of the instruction's cycle-by-cycle translation.
+		 * \return Returns true if native code was emitted, in which case it falls through when done.
+		 **/
+		bool															JitNative( size_t _sTable, uint8_t _ui8Op, uint8_t _ui8Pb, uint16_t _ui16Pc, uint64_t _ui64Key, CJitX64::Label _lSlow );
+
+		/**
+		 * Drops every block holding an opcode on the given page.
+		 * 
+		 * \param _ui16Page The page that was written (the full 24-bit address divided by 256).
+		 **/
+		void															JitInvalidatePage( uint16_t _ui16Page );
+#endif	// #if LSN_CPU_JIT
+
+		/**
+		 * Leaves the CPU as BeginInst() does, at the end of an instruction run natively by a generated block.
+		 * 
+		 * \param _ui16Pc The address of the next instruction.
+		 **/
+		inline void														AotEndInstr( uint16_t _ui16Pc );
+
+#ifdef LSN_CPU_VERIFY
+		/**
+		 * Logs a program fetch made by native code, which reads instruction bytes without going through the bus.
+		 * 
+		 * \param _pcThis The CPU.
+		 * \param _ui64Access The 24-bit address, with the value in bits 24-31.
+		 * \return Returns 0.
+		 **/
+		static uint32_t													BlockLogFetch( CRicoh5A22 * _pcThis, uint64_t _ui64Access );
+
+		/**
+		 * Logs the data access made by native code, using the address and operand that it left in m_fsState.
+		 * 
+		 * \param _pcThis The CPU.
+		 * \param _ui64Flags LSN_JIT_LOG_FLAGS describing the access.
+		 * \return Returns 0.
+		 **/
+		static uint32_t													BlockLogData( CRicoh5A22 * _pcThis, uint64_t _ui64Flags );
+#endif	// #ifdef LSN_CPU_VERIFY
+
+
+#ifdef LSN_CPU_VERIFY
+		// == Types.
+		struct LSN_CPU_VERIFY_RAM {
+			uint32_t													ui32Addr;
+			uint8_t														ui8Value;
+		};
+
+		struct LSN_CPU_VERIFY_STATE {
+			LSN_REGISTERS												cvrRegisters;
+			std::vector<LSN_CPU_VERIFY_RAM>								vRam;
+			bool														bEmulationMode;
+		};
+
+		struct LSN_CPU_VERIFY_CYCLE {
+			uint32_t													ui32Addr;
+			uint8_t														ui8Value;
+			std::string													sStatus;
+			bool														bNoReadOrWrite;
+		};
+
+		struct LSN_CPU_VERIFY_OBJ {
+			std::string													sName;
+			LSN_CPU_VERIFY_STATE										cvsStart;
+			LSN_CPU_VERIFY_STATE										cvsEnd;
+			std::vector<LSN_CPU_VERIFY_CYCLE>							vCycles;
+		};
+
+		/** The register polled by RunIdleLoopTest(). */
+		struct LSN_IDLE_LOOP_PORT {
+			CRicoh5A22 *												pcCpu;																				/**< The CPU, for its master clock and bus. */
+			uint64_t													ui64Reads;																			/**< The number of times the register was read. */
+		};
+
+		/** Where a slice of RunIdleLoopTest() stopped. */
+		struct LSN_IDLE_LOOP_STOP {
+			uint64_t													ui64MasterCycles;																	/**< The master cycle. */
+			uint16_t													ui16Pc;																				/**< PC. */
+			uint16_t													ui16A;																				/**< A. */
+			uint8_t														ui8Status;																			/**< P. */
+		};
+
+		/** What RunAotTest()'s program did under one engine. */
+		struct LSN_AOT_TEST_RUN {
+			std::vector<uint64_t>										vMasterCycles;																		/**< The master cycle at the end of each slice. */
+			std::vector<LSN_REGISTERS>									vRegs;																				/**< The registers at the end of each slice. */
+			std::vector<CBusA::LSN_READ_WRITE_LOG>						vLog;																				/**< Every bus access. */
+			std::vector<uint8_t>										vRam;																				/**< $00:0000-$03FF once the program has ended. */
+		};
+
+
+		// == Enumerations.
+		/** RunIdleLoopTest() parameters. */
+		enum LSN_IDLE_LOOP_TEST : uint64_t {
+			LSN_ILT_READY												= 500009,																			/**< The master cycle from which the polled register reads 1. */
+			LSN_ILT_SLICES												= 200,																				/**< The number of slices in which the loop is run. */
+			LSN_ILT_MIN_SKIP											= 10,																				/**< The fast engines must read the register at most 1/this as often as RunUntilMasterClock(). */
+		};
+
+		/** RunAotTest() parameters. */
+		enum LSN_AOT_TEST : uint64_t {
+			LSN_AT_MAX_SLICES											= 1000,																				/**< The most slices in which the program is run before it must have ended. */
+			LSN_AT_END													= 0x802D,																			/**< The branch to itself at which the program ends (STP does not stop the clock in verify builds). */
+			LSN_AT_SHORT_SLICE											= 200,																				/**< The shortest of the short slices, in master cycles. */
+			LSN_AT_LONG_SLICE											= 100000,																			/**< A slice long enough for the whole program. */
+			LSN_AT_MIN_NATIVE											= 300,																				/**< The fewest instructions the long slice must run natively. */
+		};
+
+
+		// == Functions.
+		/**
+		 * Given a JSON object and the value for the test to run, this loads the test and fills a LSN_CPU_VERIFY structure.
+		 *
+		 * \param _jJson The JSON file.
+		 * \param _jvTest The test to run.
+		 * \param _cvoTest The test structure to fill out.
+		 * \return Returns true if the JSON data was successfully extracted and the test created.
+		 */
+		bool															GetTest( lson::CJson &_jJson, const lson::CJsonContainer::LSON_JSON_VALUE &_jvTest, LSN_CPU_VERIFY_OBJ &_cvoTest );
+
+		/**
+		 * Fills out a LSN_CPU_VERIFY_STATE structure given a JSON "initial" or "final" member.
+		 *
+		 * \param _jJson The JSON file.
+		 * \param _jvState The bject member representing the state to load.
+		 * \param _cvsState The state structure to fill.
+		 * \return Returns true if the state was loaded.
+		 */
+		bool															LoadState( lson::CJson &_jJson, const lson::CJsonContainer::LSON_JSON_VALUE &_jvState, LSN_CPU_VERIFY_STATE &_cvsState );
+
+		/**
+		 * Loads a test's initial state: registers, RAM, and the operand that the first cycle expects to have been read.
+		 *
+		 * \param _cvoTest The test whose initial state is to be loaded.
+		 */
+		void															SetTestState( const LSN_CPU_VERIFY_OBJ &_cvoTest );
+
+		/**
+		 * Runs a test through one of the instruction-granular engines and checks that it makes the same bus accesses, takes the same number of
+		 *	cycles and master-clock ticks, and leaves the same registers as the micro-cycle core.
+		 *
+		 * \param _cvoTest The test to run.
+		 * \param _pfEngine The engine to check.
+		 * \param _pcName The engine's name, for reporting failures.
+		 * \return Returns true if the engine matches the micro-cycle core.
+		 */
+		bool															VerifyEngine( const LSN_CPU_VERIFY_OBJ &_cvoTest, uint64_t (CRicoh5A22::*_pfEngine)( uint64_t ), const char * _pcName );
+
+		/**
+		 * Runs RunIdleLoopTest()'s polling loop through an engine, stopping at the first instruction boundary at or after the end of each slice.
+		 *
+		 * \param _pfEngine The engine to run.
+		 * \param _vStops Filled with where each slice stopped.
+		 * \return Returns the number of times the polled register was read.
+		 */
+		uint64_t														RunIdleLoop( uint64_t (CRicoh5A22::*_pfEngine)( uint64_t ), std::vector<LSN_IDLE_LOOP_STOP> &_vStops );
+
+		/**
+		 * Runs RunAotTest()'s program through an engine until it ends, stopping at the first instruction boundary at or after the end of
+		 *	each slice.
+		 *
+		 * \param _pfEngine The engine to run.
+		 * \param _ui64Slice The shortest slice, in master cycles.
+		 * \param _atrRun Filled with what the program did.
+		 */
+		void															RunAotProgram( uint64_t (CRicoh5A22::*_pfEngine)( uint64_t ), uint64_t _ui64Slice, LSN_AOT_TEST_RUN &_atrRun );
+
+		/**
+		 * Reads the register polled by RunIdleLoopTest(): 0 until LSN_ILT_READY, which the bus is told, and 1 from then on.
+		 *
+		 * \param _rfpParms The access parameters; pvParm0 points to the LSN_IDLE_LOOP_PORT.
+		 * \param _ui8Ret Holds the value read on return.
+		 * \param _ui8OpenMask Unused.
+		 */
+		static void LSN_FASTCALL										IdleLoopPortRead( const CMemoryMap::LSN_ACCESSFUNCPARMS &_rfpParms, uint8_t &_ui8Ret, uint8_t &_ui8OpenMask );
+#endif	// #ifdef LSN_CPU_VERIFY
+
+
+		// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+		// CYCLES
+		// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+		/**
+		 * Performs ADC with m_fsState.ui16Operand.
+		 * 
+		 * \tparam _b8Bit If true, the accumulator is 8 bits (M is set).
+		 * \tparam _bIncPc If true, PC is updated.
+		 **/
+		template <bool _b8Bit, bool _bIncPc = false>
+		void															Adc();
+
+		/**
+		 * Adds an index to m_fsState.ui8Bank:m_fsState.ui16Address (or DB:m_fsState.ui16Address), carrying into the bank.
+		 * 
+		 * \tparam _ui8Index The LSN_REGISTER_SOURCE index register (LSN_RS_X or LSN_RS_Y).
+		 * \tparam _bDataBank If true, the bank is taken from DB, otherwise from m_fsState.ui8Bank.
+		 * \tparam _bIncPc If true, PC is updated.
+		 **/
+		template <uint8_t _ui8Index, bool _bDataBank, bool _bIncPc>
+		void															Add_Index_To_Address();
+
+		/**
+		 * Adds an index register to m_fsState.ui16Pointer and updates PC.
+		 * 
+		 * \tparam _ui8Index The LSN_REGISTER_SOURCE index register (LSN_RS_X or LSN_RS_Y).
+		 **/
+		template <uint8_t _ui8Index>
+		void															Add_Index_To_Pointer();
+
+		/**
+		 * Updates PC and adds it to m_fsState.ui16Operand (PER).
+		 **/
+		void															Add_Pc_To_Operand_IncPc();
+
+		/**
+		 * Performs AND with m_fsState.ui16Operand.
+		 * 
+		 * \tparam _b8Bit If true, the accumulator is 8 bits (M is set).
+		 * \tparam _bIncPc If true, PC is updated.
+		 **/
+		template <bool _b8Bit, bool _bIncPc = false>
+		void															And();
+
+		/**
+		 * Performs ASL on a register or on m_fsState.ui16Operand.  A register ends the instruction and m_fsState.ui16Operand moves on to the
+		 *	write-back.
+		 * 
+		 * \tparam _ui8Reg The LSN_REGISTER_SOURCE to shift (LSN_RS_A or LSN_RS_OPERAND).
+		 * \tparam _b8Bit If true, the value is 8 bits.
+		 **/
+		template <uint8_t _ui8Reg, bool _b8Bit>
+		void															Asl();
+
+		/**
+		 * Performs BIT with m_fsState.ui16Operand.
+		 * 
+		 * \tparam _b8Bit If true, the accumulator is 8 bits (M is set).
+		 * \tparam _bIncPc If true, PC is updated.
+		 * \tparam _bImmediate If true, only Z is updated (BIT #).
+		 **/
+		template <bool _b8Bit, bool _bIncPc = false, bool _bImmediate = false>
+		void															Bit();
+
+		/**
+		 * Reads the branch offset and decides whether to branch.  A taken branch adds the offset to PC (applied by the PHI1 that ends the
+		 *	instruction) and keeps 1 idle cycle, or 2 in emulation mode if the branch crosses a page.  An untaken branch skips both.
+		 * 
+		 * \tparam _ui8Flag The status flag to test, or 0 to always branch.
+		 * \tparam _bSet The state of the flag on which to branch.
+		 **/
+		template <uint8_t _ui8Flag, bool _bSet>
+		void															Branch_Phi2();
+
+		/** Final touches to BRK (copies m_fsState.ui16Address to m_fsState.rRegs.ui16Pc) and first cycle of the next instruction. */
+		void															Brk_BeginInst();
+
+		/**
+		 * Adds m_fsState.ui16Address to PC (BRL) and first cycle of the next instruction.
+		 **/
+		void															Brl();
+
+		/**
+		 * Performs CMP with m_fsState.ui16Operand.
+		 * 
+		 * \tparam _b8Bit If true, the accumulator is 8 bits (M is set).
+		 * \tparam _bIncPc If true, PC is updated.
+		 **/
+		template <bool _b8Bit, bool _bIncPc = false>
+		void															Cmp();
+
+		/**
+		 * Updates PC and copies a register to m_fsState.ui16Operand, from where stores and pushes write it.
+		 * 
+		 * \tparam _ui8Src The LSN_REGISTER_SOURCE to copy.
+		 **/
+		template <uint8_t _ui8Src>
+		void															Copy_To_Operand_IncPc();
+
+		/**
+		 * Copies from the vector to PC.h.
+		 * 
+		 * \tparam _bEndInstr Marks the end of an instruction.  If true, LSN_FINISH_INST() is called.
+		 **/
+		template <bool _bEndInstr = false>
+		void															CopyVectorToPc_H_Phi2();
+			
+		/** Copies from the vector to PC.l. **/
+		void															CopyVectorToPc_L_Phi2();
+
+		/**
+		 * Performs CPX with m_fsState.ui16Operand.
+		 * 
+		 * \tparam _b8Bit If true, X is 8 bits (X is set).
+		 * \tparam _bIncPc If true, PC is updated.
+		 **/
+		template <bool _b8Bit, bool _bIncPc = false>
+		void															Cpx();
+
+		/**
+		 * Performs CPY with m_fsState.ui16Operand.
+		 * 
+		 * \tparam _b8Bit If true, Y is 8 bits (X is set).
+		 * \tparam _bIncPc If true, PC is updated.
+		 **/
+		template <bool _b8Bit, bool _bIncPc = false>
+		void															Cpy();
+
+		/**
+		 * Performs DEC, DEX, or DEY.  A register ends the instruction and m_fsState.ui16Operand moves on to the write-back.
+		 * 
+		 * \tparam _ui8Reg The LSN_REGISTER_SOURCE to decrement.
+		 * \tparam _b8Bit If true, the value is 8 bits.
+		 **/
+		template <uint8_t _ui8Reg, bool _b8Bit>
+		void															Dec();
+
+		/**
+		 * Updates PC and stores the direct-page address of m_fsState.ui16Pointer plus an index to m_fsState.ui16Address.  In emulation mode
+		 *	with DL = 0, the index wraps inside the direct page.
+		 * 
+		 * \tparam _ui8Index The LSN_REGISTER_SOURCE index register, or LSN_RS_NONE.
+		 **/
+		template <uint8_t _ui8Index>
+		void															Direct_To_Address();
+
+		/**
+		 * Performs EOR with m_fsState.ui16Operand.
+		 * 
+		 * \tparam _b8Bit If true, the accumulator is 8 bits (M is set).
+		 * \tparam _bIncPc If true, PC is updated.
+		 **/
+		template <bool _b8Bit, bool _bIncPc = false>
+		void															Eor();
+
+		/**
+		 * Fetches the high byte of an absolute address, increments PC, and forms DB:address plus an index in m_fsState.ui8Bank and
+		 *	m_fsState.ui16Address.  Optionally skips the next cycle if indexing does not cross a page.
+		 * 
+		 * \tparam _ui8Index The LSN_REGISTER_SOURCE index register, or LSN_RS_NONE.
+		 * \tparam _bSkipNoCross If true, the next cycle is skipped unless indexing crosses a page (reads with 8-bit X and Y).
+		 **/
+		template <uint8_t _ui8Index = LSN_RS_NONE, bool _bSkipNoCross = false>
+		void															Fetch_AddressHigh_Phi2();
+
+		/** Fetches the current opcode and increments PC. **/
+		void															Fetch_Opcode_IncPc_Phi2();
+
+		/**
+		 * Fetches the current opcode from m_diDecodeCache and increments PC, falling back to Fetch_Opcode_IncPc_Phi2() (and filling the cache)
+		 *	on a miss.  Used by RunInstructions() in place of Fetch_Opcode_IncPc_Phi2().  An interrupt or halt raised by the instruction that
+		 *	just ran (through its own bus accesses) goes straight to Fetch_Opcode_IncPc_Phi2(), uncached.
+		 **/
+		void															Fetch_Opcode_IncPc_Cached_Phi2();
+
+		/**
+		 * Fetches the byte at PB:PC and increments PC.
+		 * 
+		 * \tparam _ui8Target The LSN_READ_TARGET in which to store the byte.
+		 * \tparam _bSkipOnDl If true, the next cycle is skipped if the low byte of D is 0 (the direct-page penalty cycle).
+		 **/
+		template <uint8_t _ui8Target, bool _bSkipOnDl = false>
+		void															Fetch_Phi2();
+
+		/**
+		 * Stops the clock (the last cycle of WAI and STP).  From the next opcode fetch, the CPU idles until it wakes.
+		 * 
+		 * \tparam _ui8Halt The LSN_HALT reason.
+		 **/
+		template <uint8_t _ui8Halt>
+		void															Halt_Phi2();
+
+		/**
+		 * Performs INC, INX, or INY.  A register ends the instruction and m_fsState.ui16Operand moves on to the write-back.
+		 * 
+		 * \tparam _ui8Reg The LSN_REGISTER_SOURCE to increment.
+		 * \tparam _b8Bit If true, the value is 8 bits.
+		 **/
+		template <uint8_t _ui8Reg, bool _b8Bit>
+		void															Inc();
+
+		/**
+		 * Copies m_fsState.ui8Bank:m_fsState.ui16Address to PB:PC and first cycle of the next instruction.
+		 * 
+		 * \tparam _bAdjS If true, S is updated.
+		 **/
+		template <bool _bAdjS = false>
+		void															Jml();
+
+		/**
+		 * Copies m_fsState.ui16Address to PC and first cycle of the next instruction.
+		 * 
+		 * \tparam _bAdjS If true, S is updated.
+		 **/
+		template <bool _bAdjS = false>
+		void															Jmp();
+
+		/**
+		 * Performs LDA with m_fsState.ui16Operand.
+		 * 
+		 * \tparam _b8Bit If true, the accumulator is 8 bits (M is set).
+		 * \tparam _bIncPc If true, PC is updated.
+		 * \tparam _bAdjS If true, S is updated (PLA).
+		 **/
+		template <bool _b8Bit, bool _bIncPc = false, bool _bAdjS = false>
+		void															Lda();
+
+		/**
+		 * Performs LDX with m_fsState.ui16Operand.
+		 * 
+		 * \tparam _b8Bit If true, X is 8 bits (X is set).
+		 * \tparam _bIncPc If true, PC is updated.
+		 * \tparam _bAdjS If true, S is updated (PLX).
+		 **/
+		template <bool _b8Bit, bool _bIncPc = false, bool _bAdjS = false>
+		void															Ldx();
+
+		/**
+		 * Performs LDY with m_fsState.ui16Operand.
+		 * 
+		 * \tparam _b8Bit If true, Y is 8 bits (X is set).
+		 * \tparam _bIncPc If true, PC is updated.
+		 * \tparam _bAdjS If true, S is updated (PLY).
+		 **/
+		template <bool _b8Bit, bool _bIncPc = false, bool _bAdjS = false>
+		void															Ldy();
+
+		/**
+		 * Performs LSR on a register or on m_fsState.ui16Operand.  A register ends the instruction and m_fsState.ui16Operand moves on to the
+		 *	write-back.
+		 * 
+		 * \tparam _ui8Reg The LSN_REGISTER_SOURCE to shift (LSN_RS_A or LSN_RS_OPERAND).
+		 * \tparam _b8Bit If true, the value is 8 bits.
+		 **/
+		template <uint8_t _ui8Reg, bool _b8Bit>
+		void															Lsr();
+
+		/**
+		 * Steps X and Y, decrements A, and moves PC back to the MVN/MVP opcode until A wraps.
+		 * 
+		 * \tparam _b8Bit If true, X and Y are 8 bits (X is set).
+		 * \tparam _i8Dir 1 for MVN, -1 for MVP.
+		 **/
+		template <bool _b8Bit, int8_t _i8Dir>
+		void															Move();
+
+		/**
+		 * Points m_fsState.ui8Bank:m_fsState.ui16Address at DB:Y for the write of MVN/MVP.
+		 **/
+		void															Move_Destination();
+
+		/**
+		 * Updates PC, copies the destination bank in m_fsState.ui8Bank to DB, and points m_fsState.ui8Bank:m_fsState.ui16Address at the
+		 *	source bank:X for the read of MVN/MVP.
+		 **/
+		void															Move_Source();
+
+		/**
+		 * Generic null operation.
+		 * 
+		 * \tparam _ctReadWriteNull The cycle read/write/neither type.
+		 * \tparam _bIncPc If true, PC is updated.
+		 * \tparam _bAdjS If true, S is updated.
+		 * \tparam _bBeginInstr If true, BeginInst() is called.
+		 **/
+		template <CRicoh5A22::LSN_CYCLE_TYPE _ctReadWriteNull = CRicoh5A22::LSN_CT_NULL, bool _bIncPc = false, bool _bAdjS = false, bool _bBeginInstr = false>
+		void															Null();
+
+		/**
+		 * Generic null operation on PHI2.  Sets the bus access speed to Fast.
+		 **/
+		void															Null_Phi2();
+
+		/**
+		 * Generic null operation for BRK that can be either a read or write, depending on RESET.
+		 * 
+		 * \tparam _bIncPc If true, PC is updated.
+		 * \tparam _bAdjS If true, S is updated.
+		 * \tparam _bBeginInstr If true, BeginInst() is called.
+		 **/
+		template <bool _bIncPc = false, bool _bAdjS = false, bool _bBeginInstr = false>
+		void															Null_RorW();
+
+		/**
+		 * Performs ORA with m_ui8Operand[0].
+		 * 
+		 * \tparam _b8Bit If true, the accumulator is 8 bits (M is set).
+		 * \tparam _bIncPc If true, PC is updated.
+		 **/
+		template <bool _b8Bit, bool _bIncPc = false>
+		void															Ora();
+
+		/**
+		 * Copies the value pulled by PLB to DB and first cycle of the next instruction.
+		 **/
+		void															Plb();
+
+		/**
+		 * Copies the value pulled by PLD to D and first cycle of the next instruction.
+		 **/
+		void															Pld();
+
+		/** Copies the value pulled by PLP to the status register and first cycle of the next instruction. */
+		void															Plp();
+
+		/**
+		 * Pulls a byte from S plus an offset.
+		 * 
+		 * \tparam _ui8Target The LSN_READ_TARGET in which to store the byte.
+		 * \tparam _i8SOff The offset from S from which to read.
+		 * \tparam _bNative If true, the address is not wrapped inside page 1 in emulation mode (PLB, PLD, RTL).
+		 **/
+		template <uint8_t _ui8Target, int8_t _i8SOff, bool _bNative = false>
+		void															Pull_Phi2();
+
+		/**
+		 * Pushes a byte of a register to S plus an offset.
+		 * 
+		 * \tparam _ui8Src The LSN_REGISTER_SOURCE to push (LSN_RS_OPERAND, LSN_RS_PC, or LSN_RS_PB).
+		 * \tparam _bHigh If true, the high byte is pushed.
+		 * \tparam _i8SOff The offset from S to which to write.
+		 * \tparam _bNative If true, the address is not wrapped inside page 1 in emulation mode (PHD, PEA, PEI, PER, JSL, JSR (a,X)).
+		 **/
+		template <uint8_t _ui8Src, bool _bHigh, int8_t _i8SOff, bool _bNative = false>
+		void															Push_Phi2();
+
+		/**
+		 * Pushes PB.
+		 * 
+		 * \tparam _i8SOff The offset from S to which to write the pushed value.
+		 **/
+		template <int8_t _i8SOff>
+		void															PushPb_Phi2();
+
+		/**
+		 * Pushes PCh with the given S offset.
+		 * 
+		 * \tparam _i8SOff The offset from S to which to write the pushed value.
+		 **/
+		template <int8_t _i8SOff = 0>
+		void															Push_Pc_H_Phi2();
+
+		/**
+		 * Pushes PCl with the given S offset.
+		 * 
+		 * \tparam _i8SOff The offset from S to which to write the pushed value.
+		 **/
+		template <int8_t _i8SOff = 0>
+		void															Push_Pc_L_Phi2();
+
+		/**
+		 * Pushes Status with or without B/X to the given S offset.
+		 * 
+		 * \tparam _i8SOff The offset from S to which to write the pushed value.
+		 **/
+		template <int8_t _i8SOff = 0>
+		void															Push_S_Phi2();
+
+		/**
+		 * Reads from m_fsState.ui16Pointer plus an offset in bank 0, wrapping at 16 bits.
+		 * 
+		 * \tparam _ui8Target The LSN_READ_TARGET in which to store the byte.
+		 * \tparam _ui8Off The offset from m_fsState.ui16Pointer.
+		 **/
+		template <uint8_t _ui8Target, uint8_t _ui8Off>
+		void															Read_Bank0_Phi2();
+
+		/**
+		 * Reads a byte of the operand from m_fsState.ui8Bank:m_fsState.ui16Address.
+		 * 
+		 * \tparam _bHigh If true, the byte at the address plus 1 is stored in m_fsState.ui8Operand[1], otherwise the byte at the address is
+		 *	stored to m_fsState.ui16Operand.
+		 * \tparam _bBank0 If true, the address is in bank 0 and wraps at 16 bits (direct page and stack), otherwise it carries into the bank.
+		 **/
+		template <bool _bHigh, bool _bBank0>
+		void															Read_Data_Phi2();
+
+		/**
+		 * Reads the high byte of an address from the direct page at m_fsState.ui16Pointer + 1 and forms DB:address plus an index in
+		 *	m_fsState.ui8Bank and m_fsState.ui16Address.  Optionally skips the next cycle if indexing does not cross a page.
+		 * 
+		 * \tparam _ui8Index The LSN_REGISTER_SOURCE index register, or LSN_RS_NONE.
+		 * \tparam _bSkipNoCross If true, the next cycle is skipped unless indexing crosses a page (reads with 8-bit X and Y).
+		 **/
+		template <uint8_t _ui8Index, bool _bSkipNoCross>
+		void															Read_Direct_AddressHigh_Phi2();
+
+		/**
+		 * Reads from the direct page at m_fsState.ui16Pointer plus an offset.
+		 * 
+		 * \tparam _ui8Target The LSN_READ_TARGET in which to store the byte.
+		 * \tparam _ui8Off The offset from m_fsState.ui16Pointer.
+		 * \tparam _bNative If true, the address never wraps inside the direct page ([dp], [dp],Y, and PEI).
+		 **/
+		template <uint8_t _ui8Target, uint8_t _ui8Off, bool _bNative = false>
+		void															Read_Direct_Phi2();
+
+		/**
+		 * Reads from m_fsState.ui16Pointer plus an offset in the program bank, wrapping at 16 bits.
+		 * 
+		 * \tparam _ui8Target The LSN_READ_TARGET in which to store the byte.
+		 * \tparam _ui8Off The offset from m_fsState.ui16Pointer.
+		 **/
+		template <uint8_t _ui8Target, uint8_t _ui8Off>
+		void															Read_Program_Phi2();
+
+		/**
+		 * Reads from S plus m_fsState.ui16Pointer plus an offset in bank 0.
+		 * 
+		 * \tparam _ui8Target The LSN_READ_TARGET in which to store the byte.
+		 * \tparam _ui8Off The offset from S + m_fsState.ui16Pointer.
+		 **/
+		template <uint8_t _ui8Target, uint8_t _ui8Off>
+		void															Read_Stack_Phi2();
+
+		/** Performs REP with m_fsState.ui16Operand and first cycle of the next instruction. */
+		void															Rep();
+
+		/**
+		 * Performs ROL on a register or on m_fsState.ui16Operand.  A register ends the instruction and m_fsState.ui16Operand moves on to the
+		 *	write-back.
+		 * 
+		 * \tparam _ui8Reg The LSN_REGISTER_SOURCE to rotate (LSN_RS_A or LSN_RS_OPERAND).
+		 * \tparam _b8Bit If true, the value is 8 bits.
+		 **/
+		template <uint8_t _ui8Reg, bool _b8Bit>
+		void															Rol();
+
+		/**
+		 * Performs ROR on a register or on m_fsState.ui16Operand.  A register ends the instruction and m_fsState.ui16Operand moves on to the
+		 *	write-back.
+		 * 
+		 * \tparam _ui8Reg The LSN_REGISTER_SOURCE to rotate (LSN_RS_A or LSN_RS_OPERAND).
+		 * \tparam _b8Bit If true, the value is 8 bits.
+		 **/
+		template <uint8_t _ui8Reg, bool _b8Bit>
+		void															Ror();
+
+		/**
+		 * Copies m_fsState.ui8Bank:m_fsState.ui16Address + 1 to PB:PC (RTL) and first cycle of the next instruction.
+		 **/
+		void															Rtl();
+
+		/**
+		 * Copies m_fsState.ui16Address + 1 to PC (RTS) and first cycle of the next instruction.
+		 **/
+		void															Rts();
+
+		/**
+		 * Performs SBC with m_fsState.ui16Operand.
+		 * 
+		 * \tparam _b8Bit If true, the accumulator is 8 bits (M is set).
+		 * \tparam _bIncPc If true, PC is updated.
+		 **/
+		template <bool _b8Bit, bool _bIncPc = false>
+		void															Sbc();
+
+		/**
+		 * Selects the BRK vector etc.
+		 * 
+		 * \tparam _bAdjS If true, S is updated.
+		 * \tparam _bCop If true, the instruction is COP rather than BRK.
+		 **/
+		template <bool _bAdjS, bool _bCop = false>
+		void															SelectBrkVectors();
+
+		/** Performs SEP with m_fsState.ui16Operand and first cycle of the next instruction. */
+		void															Sep();
+
+		/** Sets I and X. */
+		void															SetBrkFlags();
+
+		/**
+		 * Sets or clears a status flag (CLC, SEC, CLI, SEI, CLD, SED, CLV) and first cycle of the next instruction.
+		 * 
+		 * \tparam _ui8Flag The status flag.
+		 * \tparam _bSet If true, the flag is set, otherwise it is cleared.
+		 **/
+		template <uint8_t _ui8Flag, bool _bSet>
+		void															SetFlag();
+
+		/**
+		 * Copies the value pulled by RTI to the status register.
+		 **/
+		void															SetStatusFromOperand();
+
+		/**
+		 * Updates PC and stores S + m_fsState.ui16Pointer to m_fsState.ui16Address (stack relative).
+		 **/
+		void															Stack_To_Address();
+
+		/**
+		 * Copies one register to another and first cycle of the next instruction.  N and Z are updated unless the destination is S, which
+		 *	stays in page 1 in emulation mode.
+		 * 
+		 * \tparam _ui8Src The LSN_REGISTER_SOURCE to copy.
+		 * \tparam _ui8Dst The LSN_REGISTER_SOURCE to which to copy.
+		 * \tparam _b8Bit If true, only the low byte of the destination is written.
+		 **/
+		template <uint8_t _ui8Src, uint8_t _ui8Dst, bool _b8Bit>
+		void															Transfer();
+
+		/**
+		 * Performs TRB on m_fsState.ui16Operand.
+		 * 
+		 * \tparam _b8Bit If true, the accumulator is 8 bits (M is set).
+		 **/
+		template <bool _b8Bit>
+		void															Trb();
+
+		/**
+		 * Performs TSB on m_fsState.ui16Operand.
+		 * 
+		 * \tparam _b8Bit If true, the accumulator is 8 bits (M is set).
+		 **/
+		template <bool _b8Bit>
+		void															Tsb();
+
+		/**
+		 * Writes a byte of m_fsState.ui16Operand to m_fsState.ui8Bank:m_fsState.ui16Address.
+		 * 
+		 * \tparam _bHigh If true, the high byte is written to the address plus 1, otherwise the low byte is written to the address.
+		 * \tparam _bBank0 If true, the address is in bank 0 and wraps at 16 bits (direct page and stack), otherwise it carries into the bank.
+		 **/
+		template <bool _bHigh, bool _bBank0>
+		void															Write_Data_Phi2();
+
+		/**
+		 * Exchanges the bytes of A and first cycle of the next instruction.
+		 **/
+		void															Xba();
+
+		/** Exchanges C with the emulation bit and first cycle of the next instruction. */
+		void															Xce();
+
+
+		/**
+		 * Prepares to enter a new instruction.
+		 *
+		 * \tparam _bIncPc If true, PC is updated.
+		 * \tparam _bAdjS If true, S is updated.
+		 * \tparam _bCheckStartOfFunction If true, the LSN_INSTR_START_PHI1( true ) macro call is embedded.
+		 */
+		template <bool _bIncPc = false, bool _bAdjS = false, bool _bCheckStartOfFunction = true>
+		inline void														BeginInst();
+	};
+
+
+	// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+	// DEFINITIONS
+	// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+	// == Fuctions.
+	/**
+	 * Performs a single PHI1 update.
+	 */
+	inline void CRicoh5A22::Tick() {
+#if LSN_CPU_THREADED_DISPATCH
+		(this->*m_pfHandlers[m_fsState.pui16CurInstruction[m_fsState.ui8FuncIndex]])();
+#else
+		(this->*m_pfTickFunc)();
+#endif	// #if LSN_CPU_THREADED_DISPATCH
+	}
+
+	/**
+	 * Performs a single PHI2 update.
+	 **/
+	inline void CRicoh5A22::TickPhi2() {
+#if LSN_CPU_THREADED_DISPATCH
+		(this->*m_pfHandlers[m_fsState.pui16CurInstruction[m_fsState.ui8FuncIndex]])();
+#else
+		(this->*m_pfTickFunc)();
+#endif	// #if LSN_CPU_THREADED_DISPATCH
+	}
+
+	/**
+	 * Registers the master-clock time of an event.  RunCycles() and RunUntilMasterClock() return at the first cycle boundary at or after the earliest
+	 *	registered deadline so that the caller can service the event.
+	 * 
+	 * \param _eEvent The event whose deadline is to be set.
+	 * \param _ui64MasterClock The master-clock value at which the event occurs.
+	 **/
+	inline void CRicoh5A22::SetEventDeadline( LSN_EVENTS _eEvent, uint64_t _ui64MasterClock ) {
+		m_ui64EventDeadlines[_eEvent] = _ui64MasterClock;
+		m_ui64NextEvent = m_ui64EventDeadlines[0];
+		for ( size_t I = 1; I < LSN_EV_TOTAL; ++I ) {
+			m_ui64NextEvent = std::min( m_ui64NextEvent, m_ui64EventDeadlines[I] );
+		}
+	}
+
+	/**
+	 * Determines whether the next instruction can be run without per-cycle checks: the CPU must be at an instruction boundary with no
+	 *	event deadline inside the worst-case length of an instruction, and with no pending IRQ, NMI, reset, or RDY.
+	 *
+	 * \param _ui64Window The worst-case length of an instruction in master-clock ticks.
+	 * \return Returns true if the next instruction can be run in one go.
+	 **/
+	inline bool CRicoh5A22::CanRunFast( uint64_t _ui64Window ) const {
+		// Instructions are counted from the cycle that fetches the opcode, so a boundary is the point right after Fetch_Opcode_IncPc_Phi2(),
+		//	which is the only cycle function that leaves ui8FuncIndex at 1.
+		return m_fsState.ui8FuncIndex == 1 && m_ui64MasterCycles + _ui64Window <= m_ui64NextEvent &&
+			!m_bRdyLow && !m_bInterruptPending;
+	}
+
+	/**
+	 * Runs cycles up to the next instruction boundary, stopping exactly at the next event deadline.
+	 *
+	 * \param _ui64Run Incremented by the number of cycles run.
+	 **/
+	inline void CRicoh5A22::StepInstructionMicro( uint64_t &_ui64Run ) {
+		do {
+			Tick();
+			TickPhi2();
+			m_ui64MasterCycles += m_ui8Speed;
+			++_ui64Run;
+		} while ( m_fsState.ui8FuncIndex != 1 && m_ui64MasterCycles < m_ui64NextEvent && m_ui8Halt == LSN_H_NONE );
+	}
+
+	/**
+	 * Runs the rest of the current instruction and the next opcode fetch, checking only for the next event deadline.  CanRunFast() must be
+	 *	true.  If a deadline is reached (including one registered by the instruction's own bus accesses), stops on that cycle boundary
+	 *	instead, leaving the rest of the instruction to StepInstructionMicro().
+	 *
+	 * \param _ui64Run Incremented by the number of cycles run.
+	 **/
+	inline void CRicoh5A22::StepInstructionFast( uint64_t &_ui64Run ) {
+		// BeginInst() is the only PHI1 that leaves ui8FuncIndex at 0, and the PHI2 after it is the next opcode fetch, which comes from
+		//	m_diDecodeCache instead of the bus when possible.  Odd indices are PHI1 and even ones PHI2.
+		const uint8_t * pui8Fused = &m_ui8FusedIdle[0][0][0] + (m_fsState.pui16CurInstruction - &m_ui16InstructionSet[0][0][0]);
+		while ( true ) {
+			const uint8_t ui8Fused = pui8Fused[m_fsState.ui8FuncIndex];
+			if ( ui8Fused && RunFusedIdle( ui8Fused, _ui64Run ) ) {
+				// Runs are maximal, so the next half-cycle does real work.
+				continue;
+			}
+			if ( m_fsState.ui8FuncIndex & 1 ) {
+				Tick();
+				if ( m_fsState.ui8FuncIndex == 0 ) { break; }
+			}
+			else {
+				TickPhi2();
+				m_ui64MasterCycles += m_ui8Speed;
+				++_ui64Run;
+				// A write to $420B, $4200, $4207-$420A, etc. can pull the deadline into this instruction.  Stopping here (before the
+				//	fetch) leaves the CPU between cycles, where StepInstructionMicro() picks it up.
+				if LSN_UNLIKELY( m_ui64MasterCycles >= m_ui64NextEvent ) { return; }
+			}
+		}
+		Fetch_Opcode_IncPc_Cached_Phi2();
+		m_ui64MasterCycles += m_ui8Speed;
+		++_ui64Run;
+	}
+
+	/**
+	 * Performs a run of idle half-cycles in one step: advances ui8FuncIndex past them, applies any PC/S update, and accounts for the
+	 *	cycles they complete (each completed by Null_Phi2(), so at Fast speed).  Does nothing if the run would reach the next event deadline.
+	 * 
+	 * \param _ui8Fused The run's m_ui8FusedIdle entry.
+	 * \param _ui64Run Incremented by the number of cycles completed.
+	 * \return Returns false if the run would reach the next event deadline, in which case its half-cycles must be run one at a time.
+	 **/
+	inline bool CRicoh5A22::RunFusedIdle( uint8_t _ui8Fused, uint64_t &_ui64Run ) {
+		const uint8_t ui8Halves = _ui8Fused & LSN_FI_HALVES_MASK;
+		// The number of PHI2's (even indices) in the run.
+		const uint8_t ui8Cycles = uint8_t( (ui8Halves + (~m_fsState.ui8FuncIndex & 1)) >> 1 );
+		if LSN_UNLIKELY( m_ui64MasterCycles + uint64_t( ui8Cycles ) * m_ui8FastDiv >= m_ui64NextEvent ) { return false; }
+		// Once applied, ui16PcModify and ui16SModify are 0, so applying each once covers every half-cycle that asked for it.
+		if ( _ui8Fused & LSN_FI_UPDATE_PC ) {
+			LSN_UPDATE_PC;
+		}
+		if ( _ui8Fused & LSN_FI_UPDATE_S ) {
+			LSN_UPDATE_S;
+		}
+		m_fsState.ui8FuncIndex += ui8Halves;
+		if ( ui8Cycles ) {
+			m_ui8Speed = m_ui8FastDiv;
+			m_ui64MasterCycles += uint64_t( ui8Cycles ) * m_ui8FastDiv;
+			_ui64Run += ui8Cycles;
+		}
+		return true;
+	}
+
+	/**
+	 * Called by Fetch_Opcode_IncPc_Phi2() in place of the fetch while halted.  The halted CPU sits at index 0, where both the PHI1 and the
+	 *	PHI2 of each cycle land in Fetch_Opcode_IncPc_Phi2().  Each PHI2 either idles at Fast speed or wakes the CPU and lets the fetch run.
+	 * 
+	 * \return Returns true if the half-cycle was spent idling, false if the CPU woke and the fetch is to be performed.
+	 **/
+	inline bool CRicoh5A22::HaltedCycle() {
+		if ( m_bHaltedPhi1 ) {
+			m_bHaltedPhi1 = false;
+			return true;
+		}
+		if ( !HaltWakes() ) {
+			m_ui8Speed = m_ui8FastDiv;
+			m_bHaltedPhi1 = true;
+			return true;
+		}
+		m_ui8Halt = LSN_H_NONE;
+		UpdateInterruptPending();
+		return false;
+	}
+
+	/**
+	 * Runs a halted CPU.  Between wake-ups nothing but time can change, so once the CPU is idling every cycle up to the next event
+	 *	deadline (or _ui64MasterClock) is accounted for in one step.  Otherwise (on the way in or out of the halt) one cycle is run.
+	 * 
+	 * \param _ui64MasterClock The master-clock value at which to stop.
+	 * \param _ui64Run Incremented by the number of cycles run.
+	 **/
+	inline void CRicoh5A22::RunHalted( uint64_t _ui64MasterClock, uint64_t &_ui64Run ) {
+		if ( m_bHaltedPhi1 && !HaltWakes() ) {
+			// The same cycles RunUntilMasterClock() would run: Fast ones, up to the first boundary at or past the limit.
+			const uint64_t ui64Limit = std::min( _ui64MasterClock, m_ui64NextEvent );
+			const uint64_t ui64Cycles = (ui64Limit - m_ui64MasterCycles + m_ui8FastDiv - 1) / m_ui8FastDiv;
+			m_ui64MasterCycles += ui64Cycles * m_ui8FastDiv;
+			_ui64Run += ui64Cycles;
+			return;
+		}
+		Tick();
+		TickPhi2();
+		m_ui64MasterCycles += m_ui8Speed;
+		++_ui64Run;
+	}
+
+	/**
+	 * Called after each instruction or block run by the fast path.  On a short backward jump, the state is compared with that of the
+	 *	last time the same address was reached this way.  If it matches, and Bus A saw no writes and only reads that do not change before
+	 *	some master cycle, every pass up to that cycle (or the next event deadline, or _ui64MasterClock) would repeat the last one
+	 *	exactly, so they are accounted for without being run.  Each such jump starts a new pass.
+	 * 
+	 * \param _ui32From The PB:PC at which the instruction or block started.
+	 * \param _ui64MasterClock The master-clock value at which to stop.
+	 * \param _ui64Run The cycles run so far by the current call (excluding m_ui64BlockCycles), incremented by the cycles skipped.
+	 **/
+	inline void CRicoh5A22::CheckIdleLoop( uint32_t _ui32From, uint64_t _ui64MasterClock, uint64_t &_ui64Run ) {
+#if LSN_CPU_IDLE_LOOPS
+		const uint32_t ui32To = ProgramAddress();
+		if LSN_LIKELY( ui32To > _ui32From || _ui32From - ui32To > LSN_M_IDLE_LOOP_SPAN || m_fsState.ui8FuncIndex != 1 ) { return; }
+
+		if ( ui32To == m_ui32IdleLoop && SameLoopState( m_fsState, m_fsIdleLoop ) ) {
+			// The pass that just ended made the same accesses with the same results as every pass before ui64Limit will, and takes as long.
+			const uint64_t ui64Limit = std::min( std::min( _ui64MasterClock, m_ui64NextEvent ), m_baBusA.IdleStable() );
+			const uint64_t ui64Period = m_ui64MasterCycles - m_ui64IdleLoopTime;
+			if ( ui64Period && ui64Limit > m_ui64MasterCycles ) {
+				const uint64_t ui64Passes = (ui64Limit - m_ui64MasterCycles) / ui64Period;
+				const uint64_t ui64PassCycles = _ui64Run + m_ui64BlockCycles - m_ui64IdleLoopCycles;
+				m_ui64MasterCycles += ui64Passes * ui64Period;
+				_ui64Run += ui64Passes * ui64PassCycles;
+			}
+		}
+
+		m_ui32IdleLoop = ui32To;
+		m_fsIdleLoop = m_fsState;
+		m_ui64IdleLoopTime = m_ui64MasterCycles;
+		m_ui64IdleLoopCycles = _ui64Run + m_ui64BlockCycles;
+		m_baBusA.BeginIdleWatch();
+#else
+		static_cast<void>(_ui32From);
+		static_cast<void>(_ui64MasterClock);
+		static_cast<void>(_ui64Run);
+#endif	// #if LSN_CPU_IDLE_LOOPS
+	}
+
+	/** Fetches the next opcode and begins the next instruction. */
+	inline void CRicoh5A22::Tick_NextInstructionStd() {
+		BeginInst();
+	}
+
+	/** Performs a cycle inside an instruction. */
+	inline void CRicoh5A22::Tick_InstructionCycleStd() {
+		//(this->*m_iInstructionSet[m_fsState.ui16OpCode].pfHandler[m_fsState.bEmulationMode][m_fsState.ui8FuncIndex])();
+		(this->*m_pfHandlers[m_fsState.pui16CurInstruction[m_fsState.ui8FuncIndex]])();
+	}
+
+	/**
+	 * Adds or subtracts with carry into A, handling decimal mode, and updates N, V, Z, and C.
+	 * 
+	 * \tparam _tType uint8_t to operate on the low byte of A, uint16_t to operate on all of A.
+	 * \tparam _bSubtract If true, SBC is performed, otherwise ADC.
+	 * \param _tVal The operand.
+	 **/
+	template <typename _tType, bool _bSubtract>
+	inline void CRicoh5A22::AddWithCarry( _tType _tVal ) {
+		constexpr int32_t i32Bits = sizeof( _tType ) * 8;
+		constexpr int32_t i32Sign = 1 << (i32Bits - 1);
+		const int32_t i32A = (i32Bits == 8) ? m_fsState.rRegs.ui8A[0] : m_fsState.rRegs.ui16A;
+		const int32_t i32Data = _bSubtract ? _tType( ~_tVal ) : _tVal;
+		int32_t i32Carry = (m_fsState.rRegs.ui8Status & C()) ? 1 : 0;
+		int32_t i32Result;
+		if ( !(m_fsState.rRegs.ui8Status & D()) ) {
+			i32Result = i32A + i32Data + i32Carry;
+		}
+		else {
+			// Decimal mode is performed a digit at a time; the adjustment of the top digit happens after V is calculated.
+			i32Result = 0;
+			for ( int32_t I = 0; I < i32Bits; I += 4 ) {
+				const int32_t i32Mask = 0xF << I;
+				i32Result = (i32A & i32Mask) + (i32Data & i32Mask) + (i32Carry << I) + (i32Result & ((1 << I) - 1));
+				if ( I + 4 < i32Bits ) {
+					if constexpr ( _bSubtract ) {
+						if ( i32Result < (0x10 << I) ) { i32Result -= 0x6 << I; }
+					}
+					else {
+						if ( i32Result >= (0xA << I) ) { i32Result += 0x6 << I; }
+					}
+					i32Carry = i32Result >= (0x10 << I) ? 1 : 0;
+				}
+			}
+		}
+		SetBit<V()>( m_fsState.rRegs.ui8Status, (~(i32A ^ i32Data) & (i32A ^ i32Result) & i32Sign) != 0 );
+		if ( m_fsState.rRegs.ui8Status & D() ) {
+			constexpr int32_t i32Top = i32Bits - 4;
+			if constexpr ( _bSubtract ) {
+				if ( i32Result < (0x10 << i32Top) ) { i32Result -= 0x6 << i32Top; }
+			}
+			else {
+				if ( i32Result >= (0xA << i32Top) ) { i32Result += 0x6 << i32Top; }
+			}
+		}
+		SetBit<C()>( m_fsState.rRegs.ui8Status, i32Result >= (1 << i32Bits) );
+		SetBit<N()>( m_fsState.rRegs.ui8Status, (i32Result & i32Sign) != 0 );
+		SetBit<Z()>( m_fsState.rRegs.ui8Status, _tType( i32Result ) == 0 );
+		if constexpr ( i32Bits == 8 ) {
+			m_fsState.rRegs.ui8A[0] = uint8_t( i32Result );
+		}
+		else {
+			m_fsState.rRegs.ui16A = uint16_t( i32Result );
+		}
+	}
+
+	/**
+	 * Compares a register with m_fsState.ui16Operand (CMP, CPX, CPY) and updates N, Z, and C.
+	 * 
+	 * \tparam _b8Bit If true, only the low bytes are compared.
+	 * \param _ui16Reg The register.
+	 **/
+	template <bool _b8Bit>
+	inline void CRicoh5A22::Compare( uint16_t _ui16Reg ) {
+		if constexpr ( _b8Bit ) {
+			const uint8_t ui8Result = uint8_t( _ui16Reg - m_fsState.ui8Operand[0] );
+			SetBit<C()>( m_fsState.rRegs.ui8Status, uint8_t( _ui16Reg ) >= m_fsState.ui8Operand[0] );
+			SetNz<true>( ui8Result );
+		}
+		else {
+			const uint16_t ui16Result = uint16_t( _ui16Reg - m_fsState.ui16Operand );
+			SetBit<C()>( m_fsState.rRegs.ui8Status, _ui16Reg >= m_fsState.ui16Operand );
+			SetNz<false>( ui16Result );
+		}
+	}
+
+	/**
+	 * Gets the bank-0 address of an offset into the direct page.  In emulation mode with DL = 0 the offset wraps inside the page,
+	 *	otherwise it is added to D and wraps at 16 bits.
+	 * 
+	 * \param _ui16Offset The offset, including any index.
+	 * \return Returns the address.
+	 **/
+	inline uint16_t CRicoh5A22::DirectAddress( uint16_t _ui16Offset ) const {
+		if ( m_fsState.bEmulationMode && !m_fsState.rRegs.ui8D[0] ) {
+			return uint16_t( (m_fsState.rRegs.ui16D & 0xFF00) | (_ui16Offset & 0xFF) );
+		}
+		return uint16_t( m_fsState.rRegs.ui16D + _ui16Offset );
+	}
+
+	/**
+	 * Forms DB:m_fsState.ui16Address plus an index in m_fsState.ui8Bank and m_fsState.ui16Address and moves to the next cycle, skipping
+	 *	the index cycle if requested and indexing does not cross a page.
+	 * 
+	 * \tparam _ui8Index The LSN_REGISTER_SOURCE index register, or LSN_RS_NONE.
+	 * \tparam _bSkipNoCross If true, the next cycle is skipped unless indexing crosses a page.
+	 **/
+	template <uint8_t _ui8Index, bool _bSkipNoCross>
+	inline void CRicoh5A22::IndexAddress() {
+		const uint16_t ui16Base = m_fsState.ui16Address;
+		const uint32_t ui32Addr = ((uint32_t( m_fsState.rRegs.ui8Db ) << 16) | ui16Base) + RegisterValue<_ui8Index>();
+		m_fsState.ui8Bank = uint8_t( ui32Addr >> 16 );
+		m_fsState.ui16Address = uint16_t( ui32Addr );
+
+		LSN_NEXT_FUNCTION;
+		if constexpr ( _bSkipNoCross ) {
+			if ( !((ui16Base ^ m_fsState.ui16Address) & 0xFF00) ) {
+				LSN_NEXT_FUNCTION_BY( 2 );
+			}
+		}
+	}
+
+	/**
+	 * Gets a writable register or temporary.
+	 * 
+	 * \tparam _ui8Reg LSN_RS_A, LSN_RS_X, LSN_RS_Y, LSN_RS_S, LSN_RS_D, or LSN_RS_OPERAND.
+	 * \return Returns a reference to the register.
+	 **/
+	template <uint8_t _ui8Reg>
+	inline uint16_t & CRicoh5A22::Register() {
+		if constexpr ( _ui8Reg == LSN_RS_A ) { return m_fsState.rRegs.ui16A; }
+		else if constexpr ( _ui8Reg == LSN_RS_X ) { return m_fsState.rRegs.ui16X; }
+		else if constexpr ( _ui8Reg == LSN_RS_Y ) { return m_fsState.rRegs.ui16Y; }
+		else if constexpr ( _ui8Reg == LSN_RS_S ) { return m_fsState.rRegs.ui16S; }
+		else if constexpr ( _ui8Reg == LSN_RS_D ) { return m_fsState.rRegs.ui16D; }
+		else {
+			static_assert( _ui8Reg == LSN_RS_OPERAND, "Not a writable register." );
+			return m_fsState.ui16Operand;
+		}
+	}
+
+	/**
+	 * Gets the value of a register or temporary, zero-extended.
+	 * 
+	 * \tparam _ui8Src The LSN_REGISTER_SOURCE.
+	 * \return Returns the value, or 0 for LSN_RS_ZERO and LSN_RS_NONE.
+	 **/
+	template <uint8_t _ui8Src>
+	inline uint16_t CRicoh5A22::RegisterValue() const {
+		if constexpr ( _ui8Src == LSN_RS_DB ) { return m_fsState.rRegs.ui8Db; }
+		else if constexpr ( _ui8Src == LSN_RS_PB ) { return m_fsState.rRegs.ui8Pb; }
+		else if constexpr ( _ui8Src == LSN_RS_P ) { return m_fsState.rRegs.ui8Status; }
+		else if constexpr ( _ui8Src == LSN_RS_PC ) { return m_fsState.rRegs.ui16Pc; }
+		else if constexpr ( _ui8Src == LSN_RS_ADDRESS ) { return m_fsState.ui16Address; }
+		else if constexpr ( _ui8Src == LSN_RS_ZERO || _ui8Src == LSN_RS_NONE ) { return 0; }
+		else { return const_cast<CRicoh5A22 *>( this )->Register<_ui8Src>(); }
+	}
+
+	/**
+	 * Updates N and Z from a result.
+	 * 
+	 * \tparam _b8Bit If true, the result is 8 bits.
+	 * \param _ui16Val The result.
+	 **/
+	template <bool _b8Bit>
+	inline void CRicoh5A22::SetNz( uint16_t _ui16Val ) {
+		if constexpr ( _b8Bit ) {
+			SetBit<N()>( m_fsState.rRegs.ui8Status, _ui16Val & 0x80 );
+			SetBit<Z()>( m_fsState.rRegs.ui8Status, !uint8_t( _ui16Val ) );
+		}
+		else {
+			SetBit<N()>( m_fsState.rRegs.ui8Status, _ui16Val & 0x8000 );
+			SetBit<Z()>( m_fsState.rRegs.ui8Status, !_ui16Val );
+		}
+	}
+
+	/**
+	 * Stores a byte read from the bus.
+	 * 
+	 * \tparam _ui8Target The LSN_READ_TARGET.  LOW targets are zero-extended.
+	 * \param _ui8Val The byte.
+	 **/
+	template <uint8_t _ui8Target>
+	inline void CRicoh5A22::StoreRead( uint8_t _ui8Val ) {
+		if constexpr ( _ui8Target == LSN_RT_OPERAND_LOW ) { m_fsState.ui16Operand = _ui8Val; }
+		else if constexpr ( _ui8Target == LSN_RT_OPERAND_HIGH ) { m_fsState.ui8Operand[1] = _ui8Val; }
+		else if constexpr ( _ui8Target == LSN_RT_ADDRESS_LOW ) { m_fsState.ui16Address = _ui8Val; }
+		else if constexpr ( _ui8Target == LSN_RT_ADDRESS_HIGH ) { m_fsState.ui8Address[1] = _ui8Val; }
+		else if constexpr ( _ui8Target == LSN_RT_POINTER_LOW ) { m_fsState.ui16Pointer = _ui8Val; }
+		else if constexpr ( _ui8Target == LSN_RT_POINTER_HIGH ) { m_fsState.ui8Pointer[1] = _ui8Val; }
+		else { m_fsState.ui8Bank = _ui8Val; }
+	}
+
+	/**
+	 * Performs ADC with m_fsState.ui16Operand.
+	 * 
+	 * \tparam _b8Bit If true, the accumulator is 8 bits (M is set).
+	 * \tparam _bIncPc If true, PC is updated.
+	 **/
+	template <bool _b8Bit, bool _bIncPc>
+	inline void CRicoh5A22::Adc() {
+		LSN_INSTR_START_PHI1( false );
+
+		if constexpr ( _b8Bit ) {
+			AddWithCarry<uint8_t, false>( m_fsState.ui8Operand[0] );
+		}
+		else {
+			AddWithCarry<uint16_t, false>( m_fsState.ui16Operand );
+		}
+
+		BeginInst<_bIncPc, false, false>();
+	}
+
+	/**
+	 * Adds an index to m_fsState.ui8Bank:m_fsState.ui16Address (or DB:m_fsState.ui16Address), carrying into the bank.
+	 * 
+	 * \tparam _ui8Index The LSN_REGISTER_SOURCE index register (LSN_RS_X or LSN_RS_Y).
+	 * \tparam _bDataBank If true, the bank is taken from DB, otherwise from m_fsState.ui8Bank.
+	 * \tparam _bIncPc If true, PC is updated.
+	 **/
+	template <uint8_t _ui8Index, bool _bDataBank, bool _bIncPc>
+	inline void CRicoh5A22::Add_Index_To_Address() {
+		LSN_INSTR_START_PHI1( false );
+
+		if constexpr ( _bIncPc ) {
+			LSN_UPDATE_PC;
+		}
+		const uint32_t ui32Addr = ((uint32_t( _bDataBank ? m_fsState.rRegs.ui8Db : m_fsState.ui8Bank ) << 16) | m_fsState.ui16Address) + RegisterValue<_ui8Index>();
+		m_fsState.ui8Bank = uint8_t( ui32Addr >> 16 );
+		m_fsState.ui16Address = uint16_t( ui32Addr );
+
+		LSN_NEXT_FUNCTION;
+
+		LSN_INSTR_END_PHI1;
+	}
+
+	/**
+	 * Adds an index register to m_fsState.ui16Pointer and updates PC.
+	 * 
+	 * \tparam _ui8Index The LSN_REGISTER_SOURCE index register (LSN_RS_X or LSN_RS_Y).
+	 **/
+	template <uint8_t _ui8Index>
+	inline void CRicoh5A22::Add_Index_To_Pointer() {
+		LSN_INSTR_START_PHI1( false );
+
+		LSN_UPDATE_PC;
+		m_fsState.ui16Pointer = uint16_t( m_fsState.ui16Pointer + RegisterValue<_ui8Index>() );
+
+		LSN_NEXT_FUNCTION;
+
+		LSN_INSTR_END_PHI1;
+	}
+
+	/**
+	 * Updates PC and adds it to m_fsState.ui16Operand (PER).
+	 **/
+	inline void CRicoh5A22::Add_Pc_To_Operand_IncPc() {
+		LSN_INSTR_START_PHI1( false );
+
+		LSN_UPDATE_PC;
+		m_fsState.ui16Operand = uint16_t( m_fsState.ui16Operand + m_fsState.rRegs.ui16Pc );
+
+		LSN_NEXT_FUNCTION;
+
+		LSN_INSTR_END_PHI1;
+	}
+
+	/**
+	 * Performs AND with m_fsState.ui16Operand.
+	 * 
+	 * \tparam _b8Bit If true, the accumulator is 8 bits (M is set).
+	 * \tparam _bIncPc If true, PC is updated.
+	 **/
+	template <bool _b8Bit, bool _bIncPc>
+	inline void CRicoh5A22::And() {
+		LSN_INSTR_START_PHI1( false );
+
+		if constexpr ( _b8Bit ) {
+			m_fsState.rRegs.ui8A[0] &= m_fsState.ui8Operand[0];
+			SetBit<N()>( m_fsState.rRegs.ui8Status, m_fsState.rRegs.ui8A[0] & 0x80 );
+			SetBit<Z()>( m_fsState.rRegs.ui8Status, !m_fsState.rRegs.ui8A[0] );
+		}
+		else {
+			m_fsState.rRegs.ui16A &= m_fsState.ui16Operand;
+			SetBit<N()>( m_fsState.rRegs.ui8Status, m_fsState.rRegs.ui8A[1] & 0x80 );
+			SetBit<Z()>( m_fsState.rRegs.ui8Status, !m_fsState.rRegs.ui16A );
+		}
+
+		BeginInst<_bIncPc, false, false>();
+	}
+
+	/**
+	 * Performs ASL on a register or on m_fsState.ui16Operand.  A register ends the instruction and m_fsState.ui16Operand moves on to the
+	 *	write-back.
+	 * 
+	 * \tparam _ui8Reg The LSN_REGISTER_SOURCE to shift (LSN_RS_A or LSN_RS_OPERAND).
+	 * \tparam _b8Bit If true, the value is 8 bits.
+	 **/
+	template <uint8_t _ui8Reg, bool _b8Bit>
+	inline void CRicoh5A22::Asl() {
+		LSN_INSTR_START_PHI1( false );
+
+		uint16_t & ui16Val = Register<_ui8Reg>();
+		if constexpr ( _b8Bit ) {
+			SetBit<C()>( m_fsState.rRegs.ui8Status, ui16Val & 0x80 );
+			const uint8_t ui8Result = uint8_t( ui16Val << 1 );
+			ui16Val = uint16_t( (ui16Val & 0xFF00) | ui8Result );
+			SetNz<true>( ui8Result );
+		}
+		else {
+			SetBit<C()>( m_fsState.rRegs.ui8Status, ui16Val & 0x8000 );
+			const uint16_t ui16Result = uint16_t( ui16Val << 1 );
+			ui16Val = ui16Result;
+			SetNz<false>( ui16Result );
+		}
+
+		if constexpr ( _ui8Reg == LSN_RS_OPERAND ) {
+			LSN_NEXT_FUNCTION;
+
+			LSN_INSTR_END_PHI1;
+		}
+		else {
+			BeginInst<false, false, false>();
+		}
+	}
+
+	/**
+	 * Performs BIT with m_fsState.ui16Operand.
+	 * 
+	 * \tparam _b8Bit If true, the accumulator is 8 bits (M is set).
+	 * \tparam _bIncPc If true, PC is updated.
+	 * \tparam _bImmediate If true, only Z is updated (BIT #).
+	 **/
+	template <bool _b8Bit, bool _bIncPc, bool _bImmediate>
+	inline void CRicoh5A22::Bit() {
+		LSN_INSTR_START_PHI1( false );
+
+		if constexpr ( _b8Bit ) {
+			SetBit<Z()>( m_fsState.rRegs.ui8Status, !(m_fsState.rRegs.ui8A[0] & m_fsState.ui8Operand[0]) );
+			if constexpr ( !_bImmediate ) {
+				SetBit<N()>( m_fsState.rRegs.ui8Status, m_fsState.ui8Operand[0] & 0x80 );
+				SetBit<V()>( m_fsState.rRegs.ui8Status, m_fsState.ui8Operand[0] & 0x40 );
+			}
+		}
+		else {
+			SetBit<Z()>( m_fsState.rRegs.ui8Status, !(m_fsState.rRegs.ui16A & m_fsState.ui16Operand) );
+			if constexpr ( !_bImmediate ) {
+				SetBit<N()>( m_fsState.rRegs.ui8Status, m_fsState.ui8Operand[1] & 0x80 );
+				SetBit<V()>( m_fsState.rRegs.ui8Status, m_fsState.ui8Operand[1] & 0x40 );
+			}
+		}
+
+		BeginInst<_bIncPc, false, false>();
+	}
+
+	/**
+	 * Reads the branch offset and decides whether to branch.  A taken branch adds the offset to PC (applied by the PHI1 that ends the
+	 *	instruction) and keeps 1 idle cycle, or 2 in emulation mode if the branch crosses a page.  An untaken branch skips both.
+	 * 
+	 * \tparam _ui8Flag The status flag to test, or 0 to always branch.
+	 * \tparam _bSet The state of the flag on which to branch.
+	 **/
+	template <uint8_t _ui8Flag, bool _bSet>
+	inline void CRicoh5A22::Branch_Phi2() {
+		uint8_t ui8Speed;
+		uint8_t ui8Op;
+		LSN_INSTR_START_PHI2_READ_BUSA( m_fsState.rRegs.ui16Pc, m_fsState.rRegs.ui8Pb, ui8Op, ui8Speed );
+		m_fsState.ui16Operand = ui8Op;
+		m_ui8Speed = ui8Speed;
+
+		if ( ((m_fsState.rRegs.ui8Status & _ui8Flag) != 0) == _bSet ) {
+			// PC still points at the offset, so the next instruction starts 1 byte later.
+			const uint16_t ui16Next = uint16_t( m_fsState.rRegs.ui16Pc + 1 );
+			m_fsState.ui16PcModify = uint16_t( 1 + int8_t( ui8Op ) );
+			if ( m_fsState.bEmulationMode && ((ui16Next ^ uint16_t( ui16Next + int8_t( ui8Op ) )) & 0xFF00) ) {
+				LSN_NEXT_FUNCTION;
+			}
+			else {
+				LSN_NEXT_FUNCTION_BY( 3 );
+			}
+		}
+		else {
+			m_fsState.ui16PcModify = 1;
+			LSN_NEXT_FUNCTION_BY( 5 );
+		}
+
+		LSN_INSTR_END_PHI2;
+	}
+
+	/** Final touches to BRK (copies m_fsState.ui16Address to m_fsState.rRegs.ui16Pc) and first cycle of the next instruction. */
+	inline void CRicoh5A22::Brk_BeginInst() {
+		LSN_INSTR_START_PHI1( true );
+		
+		m_bBrkIsReset = false;
+		m_fsState.rRegs.ui16Pc = m_fsState.ui16Address;
+		m_fsState.rRegs.ui8Pb = 0;
+
+		BeginInst<false, false, false>();
+	}
+
+	/**
+	 * Adds m_fsState.ui16Address to PC (BRL) and first cycle of the next instruction.
+	 **/
+	inline void CRicoh5A22::Brl() {
+		LSN_INSTR_START_PHI1( true );
+
+		// PC already points past the instruction.
+		m_fsState.rRegs.ui16Pc = uint16_t( m_fsState.rRegs.ui16Pc + m_fsState.ui16Address );
+
+		BeginInst<false, false, false>();
+	}
+
+	/**
+	 * Performs CMP with m_fsState.ui16Operand.
+	 * 
+	 * \tparam _b8Bit If true, the accumulator is 8 bits (M is set).
+	 * \tparam _bIncPc If true, PC is updated.
+	 **/
+	template <bool _b8Bit, bool _bIncPc>
+	inline void CRicoh5A22::Cmp() {
+		LSN_INSTR_START_PHI1( false );
+
+		Compare<_b8Bit>( m_fsState.rRegs.ui16A );
+
+		BeginInst<_bIncPc, false, false>();
+	}
+
+	/**
+	 * Updates PC and copies a register to m_fsState.ui16Operand, from where stores and pushes write it.
+	 * 
+	 * \tparam _ui8Src The LSN_REGISTER_SOURCE to copy.
+	 **/
+	template <uint8_t _ui8Src>
+	inline void CRicoh5A22::Copy_To_Operand_IncPc() {
+		LSN_INSTR_START_PHI1( true );
+
+		LSN_UPDATE_PC;
+		m_fsState.ui16Operand = RegisterValue<_ui8Src>();
+
+		LSN_NEXT_FUNCTION;
+
+		LSN_INSTR_END_PHI1;
+	}
+
+	/**
+	 * Copies from the vector to PC.h.
+	 * 
+	 * \tparam _bEndInstr Marks the end of an instruction.  If true, LSN_FINISH_INST() is called.
+	 **/
+	template <bool _bEndInstr>
+	inline void CRicoh5A22::CopyVectorToPc_H_Phi2() {
+		uint8_t ui8Speed;
+		uint8_t ui8Op;
+		LSN_INSTR_START_PHI2_READ0_BUSA( m_fsState.vBrkVector + 1, ui8Op, ui8Speed );
+		m_fsState.ui8Address[1] = ui8Op;
+		m_ui8Speed = ui8Speed;
+
+		if constexpr ( _bEndInstr ) {
+			LSN_FINISH_INST( true );
+		}
+		else {
+			LSN_NEXT_FUNCTION;
+		}
+
+		LSN_INSTR_END_PHI2;
+	}
+			
+
+	/** Copies from the vector to PC.l. **/
+	inline void CRicoh5A22::CopyVectorToPc_L_Phi2() {
+		uint8_t ui8Speed;
+		uint8_t ui8Op;
+		LSN_INSTR_START_PHI2_READ0_BUSA( m_fsState.vBrkVector, ui8Op, ui8Speed );
+		m_fsState.ui8Address[0] = ui8Op;
+		m_ui8Speed = ui8Speed;
+
+		LSN_NEXT_FUNCTION;
+
+		LSN_INSTR_END_PHI2;
+	}
+
+	/**
+	 * Performs CPX with m_fsState.ui16Operand.
+	 * 
+	 * \tparam _b8Bit If true, X is 8 bits (X is set).
+	 * \tparam _bIncPc If true, PC is updated.
+	 **/
+	template <bool _b8Bit, bool _bIncPc>
+	inline void CRicoh5A22::Cpx() {
+		LSN_INSTR_START_PHI1( false );
+
+		Compare<_b8Bit>( m_fsState.rRegs.ui16X );
+
+		BeginInst<_bIncPc, false, false>();
+	}
+
+	/**
+	 * Performs CPY with m_fsState.ui16Operand.
+	 * 
+	 * \tparam _b8Bit If true, Y is 8 bits (X is set).
+	 * \tparam _bIncPc If true, PC is updated.
+	 **/
+	template <bool _b8Bit, bool _bIncPc>
+	inline void CRicoh5A22::Cpy() {
+		LSN_INSTR_START_PHI1( false );
+
+		Compare<_b8Bit>( m_fsState.rRegs.ui16Y );
+
+		BeginInst<_bIncPc, false, false>();
 	}
 
 	/**
-	 * Adds X to m_fsState.ui16Pointer and D, stores to m_fsState.ui16Address.
+	 * Performs DEC, DEX, or DEY.  A register ends the instruction and m_fsState.ui16Operand moves on to the write-back.
 	 * 
-	 * \tparam _bTo If LSN_TO_A, the value is taken from m_fsState.ui16Pointer and stored to m_fsState.ui16Address, otherwise it is taken from m_fsState.ui16Address and stored to m_fsState.ui16Pointer.
+	 * \tparam _ui8Reg The LSN_REGISTER_SOURCE to decrement.
+	 * \tparam _b8Bit If true, the value is 8 bits.
 	 **/
-	template <bool _bTo>	
-	void CRicoh5A22::Add_X_D_PtrOrAddr_To_AddrOrPtr_IncPc() {
+	template <uint8_t _ui8Reg, bool _b8Bit>
+	inline void CRicoh5A22::Dec() {
 		LSN_INSTR_START_PHI1( false );
 
-		LSN_UPDATE_PC;
-
-		if constexpr ( _bTo == LSN_TO_A ) {
-			m_fsState.ui16Pointer = m_fsState.ui16Pointer + m_fsState.rRegs.ui16X + m_fsState.rRegs.ui16D;
-			if ( m_fsState.bEmulationMode ) {
-				m_fsState.ui8Address[0] = m_fsState.ui8Pointer[0];	//uint8_t( m_fsState.ui16Pointer + m_fsState.rRegs.ui16X + m_fsState.rRegs.ui16D );
-				m_fsState.ui8Address[1] = uint8_t( m_fsState.rRegs.ui8D[1] );
-			}
-			else {
-				m_fsState.ui16Address = m_fsState.ui16Pointer;	//m_fsState.ui16Pointer + m_fsState.rRegs.ui16X + m_fsState.rRegs.ui16D;
-			}
+		uint16_t & ui16Val = Register<_ui8Reg>();
+		if constexpr ( _b8Bit ) {
+			const uint8_t ui8Result = uint8_t( ui16Val - 1 );
+			ui16Val = uint16_t( (ui16Val & 0xFF00) | ui8Result );
+			SetNz<true>( ui8Result );
 		}
 		else {
-			m_fsState.ui16Address = m_fsState.ui16Address + m_fsState.rRegs.ui16X + m_fsState.rRegs.ui16D;
-			if ( m_fsState.bEmulationMode ) {
-				m_fsState.ui8Pointer[0] = m_fsState.ui8Address[0];	//uint8_t( m_fsState.ui16Address + m_fsState.rRegs.ui16X + m_fsState.rRegs.ui16D );
-				m_fsState.ui8Pointer[1] = uint8_t( m_fsState.rRegs.ui8D[1] );
-			}
-			else {
-				m_fsState.ui16Pointer = m_fsState.ui16Address;	//m_fsState.ui16Address + m_fsState.rRegs.ui16X + m_fsState.rRegs.ui16D;
-			}
+			const uint16_t ui16Result = uint16_t( ui16Val - 1 );
+			ui16Val = ui16Result;
+			SetNz<false>( ui16Result );
 		}
 
-		LSN_NEXT_FUNCTION;
+		if constexpr ( _ui8Reg == LSN_RS_OPERAND ) {
+			LSN_NEXT_FUNCTION;
 
-		LSN_INSTR_END_PHI1;
+			LSN_INSTR_END_PHI1;
+		}
+		else {
+			BeginInst<false, false, false>();
+		}
 	}
 
-	/** Final touches to BRK (copies m_fsState.ui16Address to m_fsState.rRegs.ui16Pc) and first cycle of the next instruction. */
-	inline void CRicoh5A22::Brk_BeginInst() {
-		LSN_INSTR_START_PHI1( true );
-		
-		m_bBrkIsReset = false;
-		m_fsState.rRegs.ui16Pc = m_fsState.ui16Address;
-		m_fsState.rRegs.ui8Pb = 0;
+	/**
+	 * Updates PC and stores the direct-page address of m_fsState.ui16Pointer plus an index to m_fsState.ui16Address.  In emulation mode
+	 *	with DL = 0, the index wraps inside the direct page.
+	 * 
+	 * \tparam _ui8Index The LSN_REGISTER_SOURCE index register, or LSN_RS_NONE.
+	 **/
+	template <uint8_t _ui8Index>
+	inline void CRicoh5A22::Direct_To_Address() {
+		LSN_INSTR_START_PHI1( false );
 
-		BeginInst<false, false, false>();
+		LSN_UPDATE_PC;
+		m_fsState.ui16Address = DirectAddress( uint16_t( m_fsState.ui16Pointer + RegisterValue<_ui8Index>() ) );
+
+		LSN_NEXT_FUNCTION;
+
+		LSN_INSTR_END_PHI1;
 	}
 
 	/**
-	 * Copies from the vector to PC.h.
+	 * Performs EOR with m_fsState.ui16Operand.
 	 * 
-	 * \tparam _bEndInstr Marks the end of an instruction.  If true, LSN_FINISH_INST() is called.
+	 * \tparam _b8Bit If true, the accumulator is 8 bits (M is set).
+	 * \tparam _bIncPc If true, PC is updated.
 	 **/
-	template <bool _bEndInstr>
-	inline void CRicoh5A22::CopyVectorToPc_H_Phi2() {
-		uint8_t ui8Speed;
-		uint8_t ui8Op;
-		LSN_INSTR_START_PHI2_READ0_BUSA( m_fsState.vBrkVector + 1, ui8Op, ui8Speed );
-		m_fsState.ui8Address[1] = ui8Op;
-		m_ui8Speed = ui8Speed;
+	template <bool _b8Bit, bool _bIncPc>
+	inline void CRicoh5A22::Eor() {
+		LSN_INSTR_START_PHI1( false );
 
-		if constexpr ( _bEndInstr ) {
-			LSN_FINISH_INST( true );
+		if constexpr ( _b8Bit ) {
+			m_fsState.rRegs.ui8A[0] ^= m_fsState.ui8Operand[0];
+			SetBit<N()>( m_fsState.rRegs.ui8Status, m_fsState.rRegs.ui8A[0] & 0x80 );
+			SetBit<Z()>( m_fsState.rRegs.ui8Status, !m_fsState.rRegs.ui8A[0] );
 		}
 		else {
-			LSN_NEXT_FUNCTION;
+			m_fsState.rRegs.ui16A ^= m_fsState.ui16Operand;
+			SetBit<N()>( m_fsState.rRegs.ui8Status, m_fsState.rRegs.ui8A[1] & 0x80 );
+			SetBit<Z()>( m_fsState.rRegs.ui8Status, !m_fsState.rRegs.ui16A );
 		}
 
-		LSN_INSTR_END_PHI2;
+		BeginInst<_bIncPc, false, false>();
 	}
-			
-	/** Copies from the vector to PC.l. **/
-	inline void CRicoh5A22::CopyVectorToPc_L_Phi2() {
-		uint8_t ui8Speed;
-		uint8_t ui8Op;
-		LSN_INSTR_START_PHI2_READ0_BUSA( m_fsState.vBrkVector, ui8Op, ui8Speed );
-		m_fsState.ui8Address[0] = ui8Op;
-		m_ui8Speed = ui8Speed;
 
-		LSN_NEXT_FUNCTION;
+	/**
+	 * Fetches the high byte of an absolute address, increments PC, and forms DB:address plus an index in m_fsState.ui8Bank and
+	 *	m_fsState.ui16Address.  Optionally skips the next cycle if indexing does not cross a page.
+	 * 
+	 * \tparam _ui8Index The LSN_REGISTER_SOURCE index register, or LSN_RS_NONE.
+	 * \tparam _bSkipNoCross If true, the next cycle is skipped unless indexing crosses a page (reads with 8-bit X and Y).
+	 **/
+	template <uint8_t _ui8Index, bool _bSkipNoCross>
+	inline void CRicoh5A22::Fetch_AddressHigh_Phi2() {
+		LSN_INSTR_START_PHI2_READ_BUSA( m_fsState.rRegs.ui16Pc, m_fsState.rRegs.ui8Pb, m_fsState.ui8Address[1], m_ui8Speed );
+		m_fsState.ui16PcModify = 1;
+
+		IndexAddress<_ui8Index, _bSkipNoCross>();
 
 		LSN_INSTR_END_PHI2;
 	}
 
 	/** Fetches the current opcode and increments PC. **/
 	inline void CRicoh5A22::Fetch_Opcode_IncPc_Phi2() {
+#ifndef LSN_CPU_VERIFY
+		if LSN_UNLIKELY( m_ui8Halt != LSN_H_NONE && HaltedCycle() ) { return; }
+#endif	// #ifndef LSN_CPU_VERIFY
 		uint8_t ui8Speed;
 		uint8_t ui8Op;
 		LSN_INSTR_START_PHI2_READ_BUSA( m_fsState.rRegs.ui16Pc, m_fsState.rRegs.ui8Pb, ui8Op, ui8Speed );
 		m_ui8Speed = ui8Speed;
 
-#ifdef LSN_CPU_VERIFY
-		m_fsState.ui16PcModify = 1;
-#else
-		if ( m_bHandleNmi || m_bHandleIrq || m_bIsReset ) {
+		// The JSON tests never raise an interrupt, but the verify build's own checks do.
+		if LSN_UNLIKELY( m_bInterruptPending && PollInterrupts() ) {
 			ui8Op = 0;
 			m_fsState.bPushB = false;
 			m_fsState.ui16PcModify = 0;
 			m_fsState.bAllowWritingToPc = false;
 		}
 		else {
+#ifndef LSN_CPU_VERIFY
 			m_fsState.bPushB = true;
+#endif	// #ifndef LSN_CPU_VERIFY
 			m_fsState.ui16PcModify = 1;
 		}
-#endif	// #ifdef LSN_CPU_VERIFY
 		m_fsState.ui16OpCode = ui8Op;
-		m_fsState.pfCurInstruction = m_iInstructionSet[m_fsState.ui16OpCode].pfHandler[m_fsState.bEmulationMode];
+		m_fsState.pui16CurInstruction = m_fsState.pui16InstrTable[m_fsState.ui16OpCode];
 
 #if 0
 		char szBUffer[256];
@@ -680,73 +3097,306 @@ namespace lsn {
 	}
 
 	/**
-	 * Fetches the operand and increments PC.
+	 * Fetches the current opcode from m_diDecodeCache and increments PC, falling back to Fetch_Opcode_IncPc_Phi2() (and filling the cache)
+	 *	on a miss.  Used by RunInstructions() in place of Fetch_Opcode_IncPc_Phi2().  An interrupt or halt raised by the instruction that
+	 *	just ran (through its own bus accesses) goes straight to Fetch_Opcode_IncPc_Phi2(), uncached.
+	 **/
+	inline void CRicoh5A22::Fetch_Opcode_IncPc_Cached_Phi2() {
+		if LSN_UNLIKELY( m_bInterruptPending ) {
+			Fetch_Opcode_IncPc_Phi2();
+			return;
+		}
+		const uint32_t ui32Addr = (uint32_t( m_fsState.rRegs.ui8Pb ) << 16) | m_fsState.rRegs.ui16Pc;
+		LSN_DECODED_INSTR & diEntry = m_diDecodeCache[ui32Addr&(LSN_M_DECODE_CACHE_SIZE-1)];
+		if LSN_LIKELY( diEntry.ui32Addr == ui32Addr ) {
+			// Plain memory: the read has no side effects beyond the data bus and its timing.
+			m_baBusA.DataBus() = diEntry.ui8Op;
+			m_ui8Speed = m_baBusA.Speed( m_fsState.rRegs.ui16Pc, m_fsState.rRegs.ui8Pb );
+#ifndef LSN_CPU_VERIFY
+			m_fsState.bPushB = true;
+#endif	// #ifndef LSN_CPU_VERIFY
+			m_fsState.ui16PcModify = 1;
+			m_fsState.ui16OpCode = diEntry.ui8Op;
+			m_fsState.pui16CurInstruction = m_fsState.pui16InstrTable[m_fsState.ui16OpCode];
+			LSN_NEXT_FUNCTION;
+			return;
+		}
+
+		Fetch_Opcode_IncPc_Phi2();
+		const uint16_t ui16Page = uint16_t( ui32Addr >> 8 );
+		if ( m_baBusA.IsPlainMemory( ui16Page ) ) {
+			diEntry.ui32Addr = ui32Addr;
+			diEntry.ui8Op = uint8_t( m_fsState.ui16OpCode );
+			m_baBusA.WatchPage( ui16Page );
+		}
+	}
+
+	/**
+	 * Fetches the byte at PB:PC and increments PC.
 	 * 
-	 * \tparam _bEndInstr If true, this is the end of the instruction and steps should be taken to prepare for the next instruction.
+	 * \tparam _ui8Target The LSN_READ_TARGET in which to store the byte.
+	 * \tparam _bSkipOnDl If true, the next cycle is skipped if the low byte of D is 0 (the direct-page penalty cycle).
 	 **/
-	template <bool _bEndInstr>
-	inline void CRicoh5A22::Fetch_Operand_IncPc_Phi2() {
+	template <uint8_t _ui8Target, bool _bSkipOnDl>
+	inline void CRicoh5A22::Fetch_Phi2() {
 		uint8_t ui8Speed;
-		uint8_t ui8Op;
-		LSN_INSTR_START_PHI2_READ_BUSA( m_fsState.rRegs.ui16Pc, m_fsState.rRegs.ui8Pb, ui8Op, ui8Speed );
-		m_fsState.ui16Operand = ui8Op;
+		uint8_t ui8Val;
+		LSN_INSTR_START_PHI2_READ_BUSA( m_fsState.rRegs.ui16Pc, m_fsState.rRegs.ui8Pb, ui8Val, ui8Speed );
+		StoreRead<_ui8Target>( ui8Val );
 		m_fsState.ui16PcModify = 1;
 		m_ui8Speed = ui8Speed;
 
-		if constexpr ( _bEndInstr ) {
-			LSN_FINISH_INST( true );
+		LSN_NEXT_FUNCTION;
+		if constexpr ( _bSkipOnDl ) {
+			if ( !m_fsState.rRegs.ui8D[0] ) {
+				LSN_NEXT_FUNCTION_BY( 2 );
+			}
+		}
+
+		LSN_INSTR_END_PHI2;
+	}
+
+	/**
+	 * Stops the clock (the last cycle of WAI and STP).  From the next opcode fetch, the CPU idles until it wakes.
+	 * 
+	 * \tparam _ui8Halt The LSN_HALT reason.
+	 **/
+	template <uint8_t _ui8Halt>
+	inline void CRicoh5A22::Halt_Phi2() {
+		m_ui8Speed = m_ui8FastDiv;
+#ifndef LSN_CPU_VERIFY
+		m_ui8Halt = _ui8Halt;
+		m_bHaltedPhi1 = false;
+		UpdateInterruptPending();
+#endif	// #ifndef LSN_CPU_VERIFY
+
+		LSN_NEXT_FUNCTION;
+
+		LSN_INSTR_END_PHI2;
+	}
+
+	/**
+	 * Performs INC, INX, or INY.  A register ends the instruction and m_fsState.ui16Operand moves on to the write-back.
+	 * 
+	 * \tparam _ui8Reg The LSN_REGISTER_SOURCE to increment.
+	 * \tparam _b8Bit If true, the value is 8 bits.
+	 **/
+	template <uint8_t _ui8Reg, bool _b8Bit>
+	inline void CRicoh5A22::Inc() {
+		LSN_INSTR_START_PHI1( false );
+
+		uint16_t & ui16Val = Register<_ui8Reg>();
+		if constexpr ( _b8Bit ) {
+			const uint8_t ui8Result = uint8_t( ui16Val + 1 );
+			ui16Val = uint16_t( (ui16Val & 0xFF00) | ui8Result );
+			SetNz<true>( ui8Result );
 		}
 		else {
+			const uint16_t ui16Result = uint16_t( ui16Val + 1 );
+			ui16Val = ui16Result;
+			SetNz<false>( ui16Result );
+		}
+
+		if constexpr ( _ui8Reg == LSN_RS_OPERAND ) {
 			LSN_NEXT_FUNCTION;
+
+			LSN_INSTR_END_PHI1;
+		}
+		else {
+			BeginInst<false, false, false>();
 		}
+	}
 
-		LSN_INSTR_END_PHI2;
+	/**
+	 * Copies m_fsState.ui8Bank:m_fsState.ui16Address to PB:PC and first cycle of the next instruction.
+	 * 
+	 * \tparam _bAdjS If true, S is updated.
+	 **/
+	template <bool _bAdjS>
+	inline void CRicoh5A22::Jml() {
+		LSN_INSTR_START_PHI1( true );
+
+		m_fsState.rRegs.ui16Pc = m_fsState.ui16Address;
+		m_fsState.rRegs.ui8Pb = m_fsState.ui8Bank;
+		m_fsState.ui16PcModify = 0;
+
+		BeginInst<false, _bAdjS, false>();
+	}
+
+	/**
+	 * Copies m_fsState.ui16Address to PC and first cycle of the next instruction.
+	 * 
+	 * \tparam _bAdjS If true, S is updated.
+	 **/
+	template <bool _bAdjS>
+	inline void CRicoh5A22::Jmp() {
+		LSN_INSTR_START_PHI1( true );
+
+		m_fsState.rRegs.ui16Pc = m_fsState.ui16Address;
+		m_fsState.ui16PcModify = 0;
+
+		BeginInst<false, _bAdjS, false>();
 	}
 
 	/**
-	 * Fetches the operand and increments PC.
+	 * Performs LDA with m_fsState.ui16Operand.
 	 * 
-	 * \tparam _bTo If LSN_TO_A, the value is stored to m_fsState.ui16Address, otherwise it is stored to m_fsState.ui16Pointer.
-	 * \tparam _bEndInstr If true, this is the end of the instruction and steps should be taken to prepare for the next instruction.
+	 * \tparam _b8Bit If true, the accumulator is 8 bits (M is set).
+	 * \tparam _bIncPc If true, PC is updated.
+	 * \tparam _bAdjS If true, S is updated (PLA).
 	 **/
-	template <bool _bTo, bool _bEndInstr>
-	void CRicoh5A22::Fetch_PtrOrAddr_IncPc_Phi2() {
-		uint8_t ui8Speed;
-		uint8_t ui8Op;
-		LSN_INSTR_START_PHI2_READ_BUSA( m_fsState.rRegs.ui16Pc, m_fsState.rRegs.ui8Pb, ui8Op, ui8Speed );
-		if constexpr ( _bTo == LSN_TO_A ) {
-			m_fsState.ui16Address = ui8Op;
+	template <bool _b8Bit, bool _bIncPc, bool _bAdjS>
+	inline void CRicoh5A22::Lda() {
+		LSN_INSTR_START_PHI1( false );
+
+		if constexpr ( _b8Bit ) {
+			m_fsState.rRegs.ui8A[0] = m_fsState.ui8Operand[0];
+			SetBit<N()>( m_fsState.rRegs.ui8Status, m_fsState.rRegs.ui8A[0] & 0x80 );
+			SetBit<Z()>( m_fsState.rRegs.ui8Status, !m_fsState.rRegs.ui8A[0] );
 		}
 		else {
-			m_fsState.ui16Pointer = ui8Op;
+			m_fsState.rRegs.ui16A = m_fsState.ui16Operand;
+			SetBit<N()>( m_fsState.rRegs.ui8Status, m_fsState.rRegs.ui8A[1] & 0x80 );
+			SetBit<Z()>( m_fsState.rRegs.ui8Status, !m_fsState.rRegs.ui16A );
 		}
-		m_fsState.ui16PcModify = 1;
-		m_ui8Speed = ui8Speed;
 
-		if constexpr ( _bEndInstr ) {
-			LSN_FINISH_INST( true );
+		BeginInst<_bIncPc, _bAdjS, false>();
+	}
+
+	/**
+	 * Performs LDX with m_fsState.ui16Operand.
+	 * 
+	 * \tparam _b8Bit If true, X is 8 bits (X is set).
+	 * \tparam _bIncPc If true, PC is updated.
+	 * \tparam _bAdjS If true, S is updated (PLX).
+	 **/
+	template <bool _b8Bit, bool _bIncPc, bool _bAdjS>
+	inline void CRicoh5A22::Ldx() {
+		LSN_INSTR_START_PHI1( false );
+
+		if constexpr ( _b8Bit ) {
+			m_fsState.rRegs.ui8X[0] = m_fsState.ui8Operand[0];
+			SetNz<true>( m_fsState.ui8Operand[0] );
 		}
 		else {
-			LSN_NEXT_FUNCTION;
+			m_fsState.rRegs.ui16X = m_fsState.ui16Operand;
+			SetNz<false>( m_fsState.ui16Operand );
 		}
 
-		LSN_INSTR_END_PHI2;
+		BeginInst<_bIncPc, _bAdjS, false>();
+	}
+
+	/**
+	 * Performs LDY with m_fsState.ui16Operand.
+	 * 
+	 * \tparam _b8Bit If true, Y is 8 bits (X is set).
+	 * \tparam _bIncPc If true, PC is updated.
+	 * \tparam _bAdjS If true, S is updated (PLY).
+	 **/
+	template <bool _b8Bit, bool _bIncPc, bool _bAdjS>
+	inline void CRicoh5A22::Ldy() {
+		LSN_INSTR_START_PHI1( false );
+
+		if constexpr ( _b8Bit ) {
+			m_fsState.rRegs.ui8Y[0] = m_fsState.ui8Operand[0];
+			SetNz<true>( m_fsState.ui8Operand[0] );
+		}
+		else {
+			m_fsState.rRegs.ui16Y = m_fsState.ui16Operand;
+			SetNz<false>( m_fsState.ui16Operand );
+		}
+
+		BeginInst<_bIncPc, _bAdjS, false>();
+	}
+
+	/**
+	 * Performs LSR on a register or on m_fsState.ui16Operand.  A register ends the instruction and m_fsState.ui16Operand moves on to the
+	 *	write-back.
+	 * 
+	 * \tparam _ui8Reg The LSN_REGISTER_SOURCE to shift (LSN_RS_A or LSN_RS_OPERAND).
+	 * \tparam _b8Bit If true, the value is 8 bits.
+	 **/
+	template <uint8_t _ui8Reg, bool _b8Bit>
+	inline void CRicoh5A22::Lsr() {
+		LSN_INSTR_START_PHI1( false );
+
+		uint16_t & ui16Val = Register<_ui8Reg>();
+		if constexpr ( _b8Bit ) {
+			SetBit<C()>( m_fsState.rRegs.ui8Status, ui16Val & 0x01 );
+			const uint8_t ui8Result = uint8_t( uint8_t( ui16Val ) >> 1 );
+			ui16Val = uint16_t( (ui16Val & 0xFF00) | ui8Result );
+			SetNz<true>( ui8Result );
+		}
+		else {
+			SetBit<C()>( m_fsState.rRegs.ui8Status, ui16Val & 0x0001 );
+			const uint16_t ui16Result = uint16_t( ui16Val >> 1 );
+			ui16Val = ui16Result;
+			SetNz<false>( ui16Result );
+		}
+
+		if constexpr ( _ui8Reg == LSN_RS_OPERAND ) {
+			LSN_NEXT_FUNCTION;
+
+			LSN_INSTR_END_PHI1;
+		}
+		else {
+			BeginInst<false, false, false>();
+		}
 	}
 
 	/**
-	 * Fixes the high bit of m_fsState.ui16Address or m_fsState.ui16Pointer.
+	 * Steps X and Y, decrements A, and moves PC back to the MVN/MVP opcode until A wraps.
 	 * 
-	 * \tparam _bTo If LSN_TO_A, the value is taken from m_fsState.ui16Pointer and stored to m_fsState.ui16Address, otherwise it is taken from m_fsState.ui16Address and stored to m_fsState.ui16Pointer.
+	 * \tparam _b8Bit If true, X and Y are 8 bits (X is set).
+	 * \tparam _i8Dir 1 for MVN, -1 for MVP.
 	 **/
-	template <bool _bTo>	
-	inline void CRicoh5A22::Fix_PtrOrAddr_From_AddrOrPtr_High() {
+	template <bool _b8Bit, int8_t _i8Dir>
+	inline void CRicoh5A22::Move() {
 		LSN_INSTR_START_PHI1( false );
-		if constexpr ( _bTo ) {
-			m_fsState.ui8Address[1] = m_fsState.ui8Pointer[1];//uint8_t( (m_fsState.ui16Pointer + m_fsState.rRegs.ui16X + m_fsState.rRegs.ui16D) >> 8 );
+
+		if constexpr ( _b8Bit ) {
+			m_fsState.rRegs.ui8X[0] = uint8_t( m_fsState.rRegs.ui8X[0] + _i8Dir );
+			m_fsState.rRegs.ui8Y[0] = uint8_t( m_fsState.rRegs.ui8Y[0] + _i8Dir );
 		}
 		else {
-			m_fsState.ui8Pointer[1] = m_fsState.ui8Address[1];//uint8_t( (m_fsState.ui8Address + m_fsState.rRegs.ui16X + m_fsState.rRegs.ui16D) >> 8 );
+			m_fsState.rRegs.ui16X = uint16_t( m_fsState.rRegs.ui16X + _i8Dir );
+			m_fsState.rRegs.ui16Y = uint16_t( m_fsState.rRegs.ui16Y + _i8Dir );
 		}
+		// A counts down through all 16 bits regardless of M.  Until it wraps, the instruction runs again.
+		if ( m_fsState.rRegs.ui16A-- != 0 ) {
+			m_fsState.rRegs.ui16Pc = uint16_t( m_fsState.rRegs.ui16Pc - 3 );
+		}
+
+		LSN_NEXT_FUNCTION;
+
+		LSN_INSTR_END_PHI1;
+	}
+
+	/**
+	 * Points m_fsState.ui8Bank:m_fsState.ui16Address at DB:Y for the write of MVN/MVP.
+	 **/
+	inline void CRicoh5A22::Move_Destination() {
+		LSN_INSTR_START_PHI1( false );
+
+		m_fsState.ui8Bank = m_fsState.rRegs.ui8Db;
+		m_fsState.ui16Address = m_fsState.rRegs.ui16Y;
+
+		LSN_NEXT_FUNCTION;
+
+		LSN_INSTR_END_PHI1;
+	}
+
+	/**
+	 * Updates PC, copies the destination bank in m_fsState.ui8Bank to DB, and points m_fsState.ui8Bank:m_fsState.ui16Address at the
+	 *	source bank:X for the read of MVN/MVP.
+	 **/
+	inline void CRicoh5A22::Move_Source() {
+		LSN_INSTR_START_PHI1( true );
+
+		LSN_UPDATE_PC;
+		m_fsState.rRegs.ui8Db = m_fsState.ui8Bank;
+		m_fsState.ui8Bank = m_fsState.ui8Pointer[0];
+		m_fsState.ui16Address = m_fsState.rRegs.ui16X;
 
 		LSN_NEXT_FUNCTION;
 
@@ -813,41 +3463,126 @@ namespace lsn {
 				LSN_INSTR_START_PHI1( false );
 			}
 
-			if constexpr ( _bIncPc ) {
-				LSN_UPDATE_PC;
-			}
-			if constexpr ( _bAdjS ) {
-				LSN_UPDATE_S;
-			}
+			if constexpr ( _bIncPc ) {
+				LSN_UPDATE_PC;
+			}
+			if constexpr ( _bAdjS ) {
+				LSN_UPDATE_S;
+			}
+
+			LSN_NEXT_FUNCTION;
+
+			LSN_INSTR_END_PHI1;
+		}
+	}
+
+	/**
+	 * Performs ORA with m_ui8Operand[0].
+	 * 
+	 * \tparam _b8Bit If true, the accumulator is 8 bits (M is set).
+	 * \tparam _bIncPc If true, PC is updated.
+	 **/
+	template <bool _b8Bit, bool _bIncPc>
+	inline void CRicoh5A22::Ora() {
+		LSN_INSTR_START_PHI1( false );
+
+		if constexpr ( _b8Bit ) {
+			m_fsState.rRegs.ui8A[0] |= m_fsState.ui8Operand[0];
+			SetBit<N()>( m_fsState.rRegs.ui8Status, m_fsState.rRegs.ui8A[0] & 0x80 );
+			SetBit<Z()>( m_fsState.rRegs.ui8Status, !m_fsState.rRegs.ui8A[0] );
+		}
+		else {
+			m_fsState.rRegs.ui16A |= m_fsState.ui16Operand;
+			SetBit<N()>( m_fsState.rRegs.ui8Status, m_fsState.rRegs.ui8A[1] & 0x80 );
+			SetBit<Z()>( m_fsState.rRegs.ui8Status, !m_fsState.rRegs.ui16A );
+		}
+
+		BeginInst<_bIncPc, false, false>();
+	}
+
+	/**
+	 * Copies the value pulled by PLB to DB and first cycle of the next instruction.
+	 **/
+	inline void CRicoh5A22::Plb() {
+		LSN_INSTR_START_PHI1( true );
+
+		m_fsState.rRegs.ui8Db = m_fsState.ui8Operand[0];
+		SetNz<true>( m_fsState.ui8Operand[0] );
+
+		BeginInst<false, true, false>();
+	}
+
+	/**
+	 * Copies the value pulled by PLD to D and first cycle of the next instruction.
+	 **/
+	inline void CRicoh5A22::Pld() {
+		LSN_INSTR_START_PHI1( true );
+
+		m_fsState.rRegs.ui16D = m_fsState.ui16Operand;
+		SetNz<false>( m_fsState.ui16Operand );
 
-			LSN_NEXT_FUNCTION;
+		BeginInst<false, true, false>();
+	}
 
-			LSN_INSTR_END_PHI1;
-		}
+	/** Copies the value pulled by PLP to the status register and first cycle of the next instruction. */
+	inline void CRicoh5A22::Plp() {
+		LSN_INSTR_START_PHI1( true );
+
+		SetStatus( m_fsState.ui8Operand[0] );
+
+		BeginInst<false, true, false>();
 	}
 
 	/**
-	 * Performs ORA with m_ui8Operand[0].
+	 * Pulls a byte from S plus an offset.
 	 * 
-	 * \tparam _bIncPc If true, PC is updated.
+	 * \tparam _ui8Target The LSN_READ_TARGET in which to store the byte.
+	 * \tparam _i8SOff The offset from S from which to read.
+	 * \tparam _bNative If true, the address is not wrapped inside page 1 in emulation mode (PLB, PLD, RTL).
 	 **/
-	template <bool _bIncPc>
-	inline void CRicoh5A22::Ora() {
-		LSN_INSTR_START_PHI1( false );
-		
+	template <uint8_t _ui8Target, int8_t _i8SOff, bool _bNative>
+	inline void CRicoh5A22::Pull_Phi2() {
+		uint8_t ui8Speed;
+		uint8_t ui8Val;
+		if constexpr ( _bNative ) {
+			LSN_INSTR_START_PHI2_READ0_BUSA( m_fsState.rRegs.ui16S + _i8SOff, ui8Val, ui8Speed );
+			m_fsState.ui16SModify = uint16_t( _i8SOff );
+		}
+		else {
+			LSN_POP( ui8Val, ui8Speed );
+		}
+		StoreRead<_ui8Target>( ui8Val );
+		m_ui8Speed = ui8Speed;
 
-		m_fsState.rRegs.ui16A |= m_fsState.ui16Operand;
+		LSN_NEXT_FUNCTION;
 
-		if ( (m_fsState.rRegs.ui8Status & M()) ) {
-			SetBit<N()>( m_fsState.rRegs.ui8Status, m_fsState.rRegs.ui8A[0] & 0x80 );
-			SetBit<Z()>( m_fsState.rRegs.ui8Status, !m_fsState.rRegs.ui8A[0] );
+		LSN_INSTR_END_PHI2;
+	}
+
+	/**
+	 * Pushes a byte of a register to S plus an offset.
+	 * 
+	 * \tparam _ui8Src The LSN_REGISTER_SOURCE to push (LSN_RS_OPERAND, LSN_RS_PC, or LSN_RS_PB).
+	 * \tparam _bHigh If true, the high byte is pushed.
+	 * \tparam _i8SOff The offset from S to which to write.
+	 * \tparam _bNative If true, the address is not wrapped inside page 1 in emulation mode (PHD, PEA, PEI, PER, JSL, JSR (a,X)).
+	 **/
+	template <uint8_t _ui8Src, bool _bHigh, int8_t _i8SOff, bool _bNative>
+	inline void CRicoh5A22::Push_Phi2() {
+		uint8_t ui8Speed;
+		const uint8_t ui8Val = uint8_t( RegisterValue<_ui8Src>() >> (_bHigh ? 8 : 0) );
+		if constexpr ( _bNative ) {
+			LSN_INSTR_START_PHI2_WRITE0_BUSA( m_fsState.rRegs.ui16S + _i8SOff, ui8Val, ui8Speed );
+			m_fsState.ui16SModify = uint16_t( -1L + _i8SOff );
 		}
 		else {
-			SetBit<N()>( m_fsState.rRegs.ui8Status, m_fsState.rRegs.ui8A[1] & 0x80 );
-			SetBit<Z()>( m_fsState.rRegs.ui8Status, !m_fsState.rRegs.ui16A );
+			LSN_PUSH( ui8Val, ui8Speed );
 		}
+		m_ui8Speed = ui8Speed;
 
-		BeginInst<_bIncPc, false, false>();
+		LSN_NEXT_FUNCTION;
+
+		LSN_INSTR_END_PHI2;
 	}
 
 	/**
@@ -939,18 +3674,44 @@ namespace lsn {
 	}
 
 	/**
-	 * Reads from m_fsState.ui16Address and Bank and stores the result in m_ui8Operand[1].
+	 * Reads from m_fsState.ui16Pointer plus an offset in bank 0, wrapping at 16 bits.
+	 * 
+	 * \tparam _ui8Target The LSN_READ_TARGET in which to store the byte.
+	 * \tparam _ui8Off The offset from m_fsState.ui16Pointer.
+	 **/
+	template <uint8_t _ui8Target, uint8_t _ui8Off>
+	inline void CRicoh5A22::Read_Bank0_Phi2() {
+		uint8_t ui8Speed;
+		uint8_t ui8Val;
+		LSN_INSTR_START_PHI2_READ0_BUSA( m_fsState.ui16Pointer + _ui8Off, ui8Val, ui8Speed );
+		StoreRead<_ui8Target>( ui8Val );
+		m_ui8Speed = ui8Speed;
+
+		LSN_NEXT_FUNCTION;
+
+		LSN_INSTR_END_PHI2;
+	}
+
+	/**
+	 * Reads a byte of the operand from m_fsState.ui8Bank:m_fsState.ui16Address.
 	 * 
-	 * \tparam _bFrom If LSN_FROM_A, the final address is calculated using m_fsState.ui16Address, otherwise it is determined using m_fsState.ui16Pointer.
+	 * \tparam _bHigh If true, the byte at the address plus 1 is stored in m_fsState.ui8Operand[1], otherwise the byte at the address is
+	 *	stored to m_fsState.ui16Operand.
+	 * \tparam _bBank0 If true, the address is in bank 0 and wraps at 16 bits (direct page and stack), otherwise it carries into the bank.
 	 **/
-	template <bool _bFrom>
-	inline void CRicoh5A22::Read_PtrOrAddr_And_Bank_To_OperandHigh_Phi2() {
-		if constexpr ( _bFrom == LSN_FROM_A ) {
-			LSN_INSTR_START_PHI2_READ_BUSA( m_fsState.ui16Address + 1, m_fsState.rRegs.ui8Db, m_fsState.ui8Operand[1], m_ui8Speed );
+	template <bool _bHigh, bool _bBank0>
+	inline void CRicoh5A22::Read_Data_Phi2() {
+		uint8_t ui8Speed;
+		uint8_t ui8Val;
+		if constexpr ( _bBank0 ) {
+			LSN_INSTR_START_PHI2_READ0_BUSA( m_fsState.ui16Address + _bHigh, ui8Val, ui8Speed );
 		}
 		else {
-			LSN_INSTR_START_PHI2_READ_BUSA( m_fsState.ui16Pointer + 1, m_fsState.rRegs.ui8Db, m_fsState.ui8Operand[1], m_ui8Speed );
+			const uint32_t ui32Addr = ((uint32_t( m_fsState.ui8Bank ) << 16) | m_fsState.ui16Address) + _bHigh;
+			LSN_INSTR_START_PHI2_READ_BUSA( ui32Addr, ui32Addr >> 16, ui8Val, ui8Speed );
 		}
+		StoreRead<_bHigh ? LSN_RT_OPERAND_HIGH : LSN_RT_OPERAND_LOW>( ui8Val );
+		m_ui8Speed = ui8Speed;
 
 		LSN_NEXT_FUNCTION;
 
@@ -958,75 +3719,213 @@ namespace lsn {
 	}
 
 	/**
-	 * Reads from m_fsState.ui16Address and Bank and stores the result in m_ui8Operand[0].
+	 * Reads the high byte of an address from the direct page at m_fsState.ui16Pointer + 1 and forms DB:address plus an index in
+	 *	m_fsState.ui8Bank and m_fsState.ui16Address.  Optionally skips the next cycle if indexing does not cross a page.
+	 * 
+	 * \tparam _ui8Index The LSN_REGISTER_SOURCE index register, or LSN_RS_NONE.
+	 * \tparam _bSkipNoCross If true, the next cycle is skipped unless indexing crosses a page (reads with 8-bit X and Y).
+	 **/
+	template <uint8_t _ui8Index, bool _bSkipNoCross>
+	inline void CRicoh5A22::Read_Direct_AddressHigh_Phi2() {
+		LSN_INSTR_START_PHI2_READ0_BUSA( DirectAddress( uint16_t( m_fsState.ui16Pointer + 1 ) ), m_fsState.ui8Address[1], m_ui8Speed );
+
+		IndexAddress<_ui8Index, _bSkipNoCross>();
+
+		LSN_INSTR_END_PHI2;
+	}
+
+	/**
+	 * Reads from the direct page at m_fsState.ui16Pointer plus an offset.
 	 * 
-	 * \tparam _bFrom If LSN_FROM_A, the final address is calculated using m_fsState.ui16Address, otherwise it is determined using m_fsState.ui16Pointer.
+	 * \tparam _ui8Target The LSN_READ_TARGET in which to store the byte.
+	 * \tparam _ui8Off The offset from m_fsState.ui16Pointer.
+	 * \tparam _bNative If true, the address never wraps inside the direct page ([dp], [dp],Y, and PEI).
 	 **/
-	template <bool _bFrom>
-	inline void CRicoh5A22::Read_PtrOrAddr_And_Bank_To_OperandLow_SkipIfM_Phi2() {
-		if constexpr ( _bFrom == LSN_FROM_A ) {
-			LSN_INSTR_START_PHI2_READ_BUSA( m_fsState.ui16Address, m_fsState.rRegs.ui8Db, m_fsState.ui16Operand, m_ui8Speed );
+	template <uint8_t _ui8Target, uint8_t _ui8Off, bool _bNative>
+	inline void CRicoh5A22::Read_Direct_Phi2() {
+		uint8_t ui8Speed;
+		uint8_t ui8Val;
+		if constexpr ( _bNative ) {
+			LSN_INSTR_START_PHI2_READ0_BUSA( m_fsState.rRegs.ui16D + m_fsState.ui16Pointer + _ui8Off, ui8Val, ui8Speed );
 		}
 		else {
-			LSN_INSTR_START_PHI2_READ_BUSA( m_fsState.ui16Pointer, m_fsState.rRegs.ui8Db, m_fsState.ui16Operand, m_ui8Speed );
+			LSN_INSTR_START_PHI2_READ0_BUSA( DirectAddress( uint16_t( m_fsState.ui16Pointer + _ui8Off ) ), ui8Val, ui8Speed );
 		}
+		StoreRead<_ui8Target>( ui8Val );
+		m_ui8Speed = ui8Speed;
 
 		LSN_NEXT_FUNCTION;
 
-		if ( (m_fsState.rRegs.ui8Status & M()) ) {
-			LSN_NEXT_FUNCTION_BY( 2 );
-		}
+		LSN_INSTR_END_PHI2;
+	}
+
+	/**
+	 * Reads from m_fsState.ui16Pointer plus an offset in the program bank, wrapping at 16 bits.
+	 * 
+	 * \tparam _ui8Target The LSN_READ_TARGET in which to store the byte.
+	 * \tparam _ui8Off The offset from m_fsState.ui16Pointer.
+	 **/
+	template <uint8_t _ui8Target, uint8_t _ui8Off>
+	inline void CRicoh5A22::Read_Program_Phi2() {
+		uint8_t ui8Speed;
+		uint8_t ui8Val;
+		LSN_INSTR_START_PHI2_READ_BUSA( m_fsState.ui16Pointer + _ui8Off, m_fsState.rRegs.ui8Pb, ui8Val, ui8Speed );
+		StoreRead<_ui8Target>( ui8Val );
+		m_ui8Speed = ui8Speed;
+
+		LSN_NEXT_FUNCTION;
+
+		LSN_INSTR_END_PHI2;
+	}
+
+	/**
+	 * Reads from S plus m_fsState.ui16Pointer plus an offset in bank 0.
+	 * 
+	 * \tparam _ui8Target The LSN_READ_TARGET in which to store the byte.
+	 * \tparam _ui8Off The offset from S + m_fsState.ui16Pointer.
+	 **/
+	template <uint8_t _ui8Target, uint8_t _ui8Off>
+	inline void CRicoh5A22::Read_Stack_Phi2() {
+		uint8_t ui8Speed;
+		uint8_t ui8Val;
+		LSN_INSTR_START_PHI2_READ0_BUSA( m_fsState.rRegs.ui16S + m_fsState.ui16Pointer + _ui8Off, ui8Val, ui8Speed );
+		StoreRead<_ui8Target>( ui8Val );
+		m_ui8Speed = ui8Speed;
+
+		LSN_NEXT_FUNCTION;
 
 		LSN_INSTR_END_PHI2;
 	}
 
+	/** Performs REP with m_fsState.ui16Operand and first cycle of the next instruction. */
+	inline void CRicoh5A22::Rep() {
+		LSN_INSTR_START_PHI1( true );
+
+		SetStatus( uint8_t( m_fsState.rRegs.ui8Status & ~m_fsState.ui8Operand[0] ) );
+
+		BeginInst<false, false, false>();
+	}
+
 	/**
-	 * Reads from m_fsState.ui16Address or m_fsState.ui16Pointer and stores the high byte in m_ui8Pointer[1] or m_ui8Address[1].
+	 * Performs ROL on a register or on m_fsState.ui16Operand.  A register ends the instruction and m_fsState.ui16Operand moves on to the
+	 *	write-back.
 	 * 
-	 * \tparam _bTo If LSN_TO_A, the value is taken from m_fsState.ui16Pointer and stored to m_fsState.ui16Address, otherwise it is taken from m_fsState.ui16Address and stored to m_fsState.ui16Pointer.
+	 * \tparam _ui8Reg The LSN_REGISTER_SOURCE to rotate (LSN_RS_A or LSN_RS_OPERAND).
+	 * \tparam _b8Bit If true, the value is 8 bits.
 	 **/
-	template <bool _bTo>	
-	inline void CRicoh5A22::ReadBank0_PtrOrAddr_To_AddrOrPtr_High_Phi2() {
-		if constexpr( _bTo == LSN_TO_A ) {
-			LSN_INSTR_START_PHI2_READ0_BUSA( m_fsState.ui16Pointer + 1, m_fsState.ui8Address[1], m_ui8Speed );
+	template <uint8_t _ui8Reg, bool _b8Bit>
+	inline void CRicoh5A22::Rol() {
+		LSN_INSTR_START_PHI1( false );
+
+		uint16_t & ui16Val = Register<_ui8Reg>();
+		if constexpr ( _b8Bit ) {
+			const uint8_t ui8Result = uint8_t( (ui16Val << 1) | (m_fsState.rRegs.ui8Status & C()) );
+			SetBit<C()>( m_fsState.rRegs.ui8Status, ui16Val & 0x80 );
+			ui16Val = uint16_t( (ui16Val & 0xFF00) | ui8Result );
+			SetNz<true>( ui8Result );
 		}
 		else {
-			LSN_INSTR_START_PHI2_READ0_BUSA( m_fsState.ui16Address + 1, m_fsState.ui8Pointer[1], m_ui8Speed );
+			const uint16_t ui16Result = uint16_t( (ui16Val << 1) | (m_fsState.rRegs.ui8Status & C()) );
+			SetBit<C()>( m_fsState.rRegs.ui8Status, ui16Val & 0x8000 );
+			ui16Val = ui16Result;
+			SetNz<false>( ui16Result );
 		}
-		
-		LSN_NEXT_FUNCTION;
 
-		LSN_INSTR_END_PHI2;
+		if constexpr ( _ui8Reg == LSN_RS_OPERAND ) {
+			LSN_NEXT_FUNCTION;
+
+			LSN_INSTR_END_PHI1;
+		}
+		else {
+			BeginInst<false, false, false>();
+		}
 	}
 
 	/**
-	 * Reads from m_fsState.ui16Address or m_fsState.ui16Pointer and stores the low byte in m_fsState.ui8Pointer[0] or m_fsState.ui8Address[0].
+	 * Performs ROR on a register or on m_fsState.ui16Operand.  A register ends the instruction and m_fsState.ui16Operand moves on to the
+	 *	write-back.
 	 * 
-	 * \tparam _bTo If LSN_TO_A, the value is taken from m_fsState.ui16Pointer and stored to m_fsState.ui16Address, otherwise it is taken from m_fsState.ui16Address and stored to m_fsState.ui16Pointer.
+	 * \tparam _ui8Reg The LSN_REGISTER_SOURCE to rotate (LSN_RS_A or LSN_RS_OPERAND).
+	 * \tparam _b8Bit If true, the value is 8 bits.
 	 **/
-	template <bool _bTo>	
-	inline void CRicoh5A22::ReadBank0_PtrOrAddr_To_AddrOrPtr_Low_Phi2() {
-		uint8_t ui8Tmp;
-		if constexpr( _bTo == LSN_TO_A ) {
-			LSN_INSTR_START_PHI2_READ0_BUSA( m_fsState.ui16Pointer, ui8Tmp, m_ui8Speed );
-			m_fsState.ui16Address = ui8Tmp;
+	template <uint8_t _ui8Reg, bool _b8Bit>
+	inline void CRicoh5A22::Ror() {
+		LSN_INSTR_START_PHI1( false );
+
+		uint16_t & ui16Val = Register<_ui8Reg>();
+		if constexpr ( _b8Bit ) {
+			const uint8_t ui8Result = uint8_t( (uint8_t( ui16Val ) >> 1) | ((m_fsState.rRegs.ui8Status & C()) << 7) );
+			SetBit<C()>( m_fsState.rRegs.ui8Status, ui16Val & 0x01 );
+			ui16Val = uint16_t( (ui16Val & 0xFF00) | ui8Result );
+			SetNz<true>( ui8Result );
 		}
 		else {
-			LSN_INSTR_START_PHI2_READ0_BUSA( m_fsState.ui16Address, ui8Tmp, m_ui8Speed );
-			m_fsState.ui16Pointer = ui8Tmp;
+			const uint16_t ui16Result = uint16_t( (ui16Val >> 1) | ((m_fsState.rRegs.ui8Status & C()) << 15) );
+			SetBit<C()>( m_fsState.rRegs.ui8Status, ui16Val & 0x0001 );
+			ui16Val = ui16Result;
+			SetNz<false>( ui16Result );
 		}
-		
-		LSN_NEXT_FUNCTION;
 
-		LSN_INSTR_END_PHI2;
+		if constexpr ( _ui8Reg == LSN_RS_OPERAND ) {
+			LSN_NEXT_FUNCTION;
+
+			LSN_INSTR_END_PHI1;
+		}
+		else {
+			BeginInst<false, false, false>();
+		}
+	}
+
+	/**
+	 * Copies m_fsState.ui8Bank:m_fsState.ui16Address + 1 to PB:PC (RTL) and first cycle of the next instruction.
+	 **/
+	inline void CRicoh5A22::Rtl() {
+		LSN_INSTR_START_PHI1( true );
+
+		m_fsState.rRegs.ui16Pc = uint16_t( m_fsState.ui16Address + 1 );
+		m_fsState.rRegs.ui8Pb = m_fsState.ui8Bank;
+
+		BeginInst<false, true, false>();
+	}
+
+	/**
+	 * Copies m_fsState.ui16Address + 1 to PC (RTS) and first cycle of the next instruction.
+	 **/
+	inline void CRicoh5A22::Rts() {
+		LSN_INSTR_START_PHI1( true );
+
+		m_fsState.rRegs.ui16Pc = uint16_t( m_fsState.ui16Address + 1 );
+
+		BeginInst<false, true, false>();
+	}
+
+	/**
+	 * Performs SBC with m_fsState.ui16Operand.
+	 * 
+	 * \tparam _b8Bit If true, the accumulator is 8 bits (M is set).
+	 * \tparam _bIncPc If true, PC is updated.
+	 **/
+	template <bool _b8Bit, bool _bIncPc>
+	inline void CRicoh5A22::Sbc() {
+		LSN_INSTR_START_PHI1( false );
+
+		if constexpr ( _b8Bit ) {
+			AddWithCarry<uint8_t, true>( m_fsState.ui8Operand[0] );
+		}
+		else {
+			AddWithCarry<uint16_t, true>( m_fsState.ui16Operand );
+		}
+
+		BeginInst<_bIncPc, false, false>();
 	}
 
 	/**
 	 * Selects the BRK vector etc.
 	 * 
 	 * \tparam _bAdjS If true, S is updated.
+	 * \tparam _bCop If true, the instruction is COP rather than BRK.
 	 **/
-	template <bool _bAdjS>
+	template <bool _bAdjS, bool _bCop>
 	inline void CRicoh5A22::SelectBrkVectors() {
 		if constexpr ( _bAdjS ) {
 			LSN_INSTR_START_PHI1( true );
@@ -1036,11 +3935,6 @@ namespace lsn {
 			LSN_INSTR_START_PHI1( false );
 		}
 
-#ifdef LSN_CPU_VERIFY
-		m_fsState.vBrkVector = m_fsState.bEmulationMode ? LSN_V_IRQ_BRK_E : LSN_V_BRK;
-		m_fsState.bPushB = m_fsState.bEmulationMode;
-#else
-
 		// Select vector to use.
 		if ( m_bIsReset ) {
 			m_fsState.vBrkVector = m_fsState.bEmulationMode ? LSN_V_RESET_E : LSN_V_RESET_E;
@@ -1053,7 +3947,14 @@ namespace lsn {
 			m_fsState.vBrkVector = m_fsState.bEmulationMode ? LSN_V_IRQ_BRK_E : LSN_V_IRQ;
 		}
 		else {
-			m_fsState.vBrkVector = m_fsState.bEmulationMode ? LSN_V_IRQ_BRK_E : LSN_V_BRK;
+			if constexpr ( _bCop ) {
+				m_fsState.vBrkVector = m_fsState.bEmulationMode ? LSN_V_COP_E : LSN_V_COP;
+			}
+			else {
+				m_fsState.vBrkVector = m_fsState.bEmulationMode ? LSN_V_IRQ_BRK_E : LSN_V_BRK;
+			}
+			// Bit 4 is B only in emulation mode.  In native mode it is X and is pushed as it is.
+			m_fsState.bPushB = m_fsState.bEmulationMode;
 		}
 
 		if LSN_LIKELY( !m_bRdyLow ) {
@@ -1063,13 +3964,22 @@ namespace lsn {
 			}
 			m_bHandleIrq = false;
 		}
-#endif	// #ifdef LSN_CPU_VERIFY
+		UpdateInterruptPending();
 
 		LSN_NEXT_FUNCTION;
 
 		LSN_INSTR_END_PHI1;
 	}
 
+	/** Performs SEP with m_fsState.ui16Operand and first cycle of the next instruction. */
+	inline void CRicoh5A22::Sep() {
+		LSN_INSTR_START_PHI1( true );
+
+		SetStatus( uint8_t( m_fsState.rRegs.ui8Status | m_fsState.ui8Operand[0] ) );
+
+		BeginInst<false, false, false>();
+	}
+
 	/**
 	 * Prepares to enter a new instruction.
 	 *
@@ -1092,12 +4002,36 @@ namespace lsn {
 		}
 		// Enter normal instruction context.
 		m_fsState.ui8FuncIndex = 0;
+#if LSN_CPU_THREADED_DISPATCH
+		m_fsState.pui16CurInstruction = m_ui16FetchOpcode;
+#else
 		m_pfTickFunc = m_pfTickFuncCopy = &CRicoh5A22::Tick_InstructionCycleStd;
+#endif	// #if LSN_CPU_THREADED_DISPATCH
 		m_fsState.bBoundaryCrossed = false;
 		//m_ui8RdyOffCnt = 0;
 		LSN_INSTR_END_PHI1;
 	}
 
+	/**
+	 * Leaves the CPU as BeginInst() does, at the end of an instruction run natively by a generated block.
+	 * 
+	 * \param _ui16Pc The address of the next instruction.
+	 **/
+	inline void CRicoh5A22::AotEndInstr( uint16_t _ui16Pc ) {
+		m_fsState.rRegs.ui16Pc = _ui16Pc;
+		m_fsState.ui16PcModify = 0;
+		m_fsState.ui8FuncIndex = 0;
+#if LSN_CPU_THREADED_DISPATCH
+		m_fsState.pui16CurInstruction = m_ui16FetchOpcode;
+#else
+		m_pfTickFunc = m_pfTickFuncCopy = &CRicoh5A22::Tick_InstructionCycleStd;
+#endif	// #if LSN_CPU_THREADED_DISPATCH
+		m_fsState.bBoundaryCrossed = false;
+#ifdef LSN_CPU_VERIFY
+		++m_ui64AotNative;
+#endif	// #ifdef LSN_CPU_VERIFY
+	}
+
 	/** Sets I and X. */
 	inline void CRicoh5A22::SetBrkFlags() {
 		LSN_INSTR_START_PHI1( true );
@@ -1106,6 +4040,7 @@ namespace lsn {
 		//SetBit<X(), false>( m_fsState.rRegs.ui8Status );
 		SetBit<I(), true>( m_fsState.rRegs.ui8Status );
 		SetBit<D(), false>( m_fsState.rRegs.ui8Status );
+		UpdateInterruptPending();
 		m_fsState.bAllowWritingToPc = true;
 
 		LSN_NEXT_FUNCTION;
@@ -1113,32 +4048,176 @@ namespace lsn {
 		LSN_INSTR_END_PHI1;
 	}
 
-	/** Skips the next instruction if the M status flag is set. */
-	inline void CRicoh5A22::SkipIfM_Phi2() {
+	/**
+	 * Sets or clears a status flag (CLC, SEC, CLI, SEI, CLD, SED, CLV) and first cycle of the next instruction.
+	 * 
+	 * \tparam _ui8Flag The status flag.
+	 * \tparam _bSet If true, the flag is set, otherwise it is cleared.
+	 **/
+	template <uint8_t _ui8Flag, bool _bSet>
+	inline void CRicoh5A22::SetFlag() {
+		LSN_INSTR_START_PHI1( true );
+
+		SetBit<_ui8Flag, _bSet>( m_fsState.rRegs.ui8Status );
+		if constexpr ( _ui8Flag == I() ) { UpdateInterruptPending(); }
+
+		BeginInst<false, false, false>();
+	}
+
+	/**
+	 * Copies the value pulled by RTI to the status register.
+	 **/
+	inline void CRicoh5A22::SetStatusFromOperand() {
+		LSN_INSTR_START_PHI1( true );
+
+		SetStatus( m_fsState.ui8Operand[0] );
+
 		LSN_NEXT_FUNCTION;
 
-		m_ui8Speed = m_ui8FastDiv;
+		LSN_INSTR_END_PHI1;
+	}
+
+	/**
+	 * Updates PC and stores S + m_fsState.ui16Pointer to m_fsState.ui16Address (stack relative).
+	 **/
+	inline void CRicoh5A22::Stack_To_Address() {
+		LSN_INSTR_START_PHI1( false );
+
+		LSN_UPDATE_PC;
+		m_fsState.ui16Address = uint16_t( m_fsState.rRegs.ui16S + m_fsState.ui16Pointer );
+
+		LSN_NEXT_FUNCTION;
+
+		LSN_INSTR_END_PHI1;
+	}
+
+	/**
+	 * Copies one register to another and first cycle of the next instruction.  N and Z are updated unless the destination is S, which
+	 *	stays in page 1 in emulation mode.
+	 * 
+	 * \tparam _ui8Src The LSN_REGISTER_SOURCE to copy.
+	 * \tparam _ui8Dst The LSN_REGISTER_SOURCE to which to copy.
+	 * \tparam _b8Bit If true, only the low byte of the destination is written.
+	 **/
+	template <uint8_t _ui8Src, uint8_t _ui8Dst, bool _b8Bit>
+	inline void CRicoh5A22::Transfer() {
+		LSN_INSTR_START_PHI1( true );
 
-		if ( (m_fsState.rRegs.ui8Status & M()) ) {
-			LSN_NEXT_FUNCTION_BY( 2 );
+		const uint16_t ui16Val = RegisterValue<_ui8Src>();
+		if constexpr ( _ui8Dst == LSN_RS_S ) {
+			m_fsState.rRegs.ui16S = ui16Val;
+			if ( m_fsState.bEmulationMode ) { m_fsState.rRegs.ui8S[1] = 0x01; }
+		}
+		else if constexpr ( _b8Bit ) {
+			uint16_t & ui16Dst = Register<_ui8Dst>();
+			ui16Dst = uint16_t( (ui16Dst & 0xFF00) | uint8_t( ui16Val ) );
+			SetNz<true>( uint8_t( ui16Val ) );
+		}
+		else {
+			Register<_ui8Dst>() = ui16Val;
+			SetNz<false>( ui16Val );
 		}
 
-		LSN_INSTR_END_PHI2;
+		BeginInst<false, false, false>();
 	}
 
-	/** Skips the next instruction if the low byte of D is 0. */
-	inline void CRicoh5A22::SkipOnDL_Phi2() {
+	/**
+	 * Performs TRB on m_fsState.ui16Operand.
+	 * 
+	 * \tparam _b8Bit If true, the accumulator is 8 bits (M is set).
+	 **/
+	template <bool _b8Bit>
+	inline void CRicoh5A22::Trb() {
+		LSN_INSTR_START_PHI1( false );
+
+		if constexpr ( _b8Bit ) {
+			SetBit<Z()>( m_fsState.rRegs.ui8Status, !(m_fsState.rRegs.ui8A[0] & m_fsState.ui8Operand[0]) );
+			m_fsState.ui8Operand[0] &= ~m_fsState.rRegs.ui8A[0];
+		}
+		else {
+			SetBit<Z()>( m_fsState.rRegs.ui8Status, !(m_fsState.rRegs.ui16A & m_fsState.ui16Operand) );
+			m_fsState.ui16Operand &= ~m_fsState.rRegs.ui16A;
+		}
+
 		LSN_NEXT_FUNCTION;
 
-		m_ui8Speed = m_ui8FastDiv;
+		LSN_INSTR_END_PHI1;
+	}
+
+	/**
+	 * Performs TSB on m_fsState.ui16Operand.
+	 * 
+	 * \tparam _b8Bit If true, the accumulator is 8 bits (M is set).
+	 **/
+	template <bool _b8Bit>
+	inline void CRicoh5A22::Tsb() {
+		LSN_INSTR_START_PHI1( false );
+
+		if constexpr ( _b8Bit ) {
+			SetBit<Z()>( m_fsState.rRegs.ui8Status, !(m_fsState.rRegs.ui8A[0] & m_fsState.ui8Operand[0]) );
+			m_fsState.ui8Operand[0] |= m_fsState.rRegs.ui8A[0];
+		}
+		else {
+			SetBit<Z()>( m_fsState.rRegs.ui8Status, !(m_fsState.rRegs.ui16A & m_fsState.ui16Operand) );
+			m_fsState.ui16Operand |= m_fsState.rRegs.ui16A;
+		}
+
+		LSN_NEXT_FUNCTION;
+
+		LSN_INSTR_END_PHI1;
+	}
 
-		if ( !(m_fsState.rRegs.ui16D & 0xFF) ) {
-			LSN_NEXT_FUNCTION_BY( 2 );
+	/**
+	 * Writes a byte of m_fsState.ui16Operand to m_fsState.ui8Bank:m_fsState.ui16Address.
+	 * 
+	 * \tparam _bHigh If true, the high byte is written to the address plus 1, otherwise the low byte is written to the address.
+	 * \tparam _bBank0 If true, the address is in bank 0 and wraps at 16 bits (direct page and stack), otherwise it carries into the bank.
+	 **/
+	template <bool _bHigh, bool _bBank0>
+	inline void CRicoh5A22::Write_Data_Phi2() {
+		uint8_t ui8Speed;
+		if constexpr ( _bBank0 ) {
+			LSN_INSTR_START_PHI2_WRITE0_BUSA( m_fsState.ui16Address + _bHigh, m_fsState.ui8Operand[_bHigh], ui8Speed );
 		}
+		else {
+			const uint32_t ui32Addr = ((uint32_t( m_fsState.ui8Bank ) << 16) | m_fsState.ui16Address) + _bHigh;
+			LSN_INSTR_START_PHI2_WRITE_BUSA( ui32Addr, ui32Addr >> 16, m_fsState.ui8Operand[_bHigh], ui8Speed );
+		}
+		m_ui8Speed = ui8Speed;
+
+		LSN_NEXT_FUNCTION;
 
 		LSN_INSTR_END_PHI2;
 	}
 
+	/**
+	 * Exchanges the bytes of A and first cycle of the next instruction.
+	 **/
+	inline void CRicoh5A22::Xba() {
+		LSN_INSTR_START_PHI1( true );
+
+		m_fsState.rRegs.ui16A = uint16_t( (m_fsState.rRegs.ui16A >> 8) | (m_fsState.rRegs.ui16A << 8) );
+		SetNz<true>( m_fsState.rRegs.ui8A[0] );
+
+		BeginInst<false, false, false>();
+	}
+
+	/** Exchanges C with the emulation bit and first cycle of the next instruction. */
+	inline void CRicoh5A22::Xce() {
+		LSN_INSTR_START_PHI1( true );
+
+		const bool bCarry = (m_fsState.rRegs.ui8Status & C()) != 0;
+		SetBit<C()>( m_fsState.rRegs.ui8Status, m_fsState.bEmulationMode );
+		m_fsState.bEmulationMode = bCarry;
+		if ( bCarry ) {
+			// Emulation mode keeps the stack in page 1.
+			m_fsState.rRegs.ui8S[1] = 0x01;
+		}
+		SetStatus( m_fsState.rRegs.ui8Status );
+
+		BeginInst<false, false, false>();
+	}
+
 #pragma warning( pop )
 
 }	// namespace lsn
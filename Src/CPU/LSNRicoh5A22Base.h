@@ -37,6 +37,7 @@ namespace lsn {
 			LSN_AM_ZERO_PAGE_Y,																/**< Zero-page-Y = 3 extra cycles. */
 			LSN_AM_DIRECT_PAGE,																/**< Direct page, up to 2 extra cycles. */
 			LSN_AM_DIRECT_PAGE_INDEXED_X,													/**< Direct page indexed X. */
+			LSN_AM_DIRECT_PAGE_INDEXED_Y,													/**< Direct page indexed Y. */
 			LSN_AM_DIRECT_PAGE_INDIRECT,													/**< Direct page indirect. */
 			LSN_AM_DIRECT_PAGE_INDIRECT_LONG,												/**< Direct page, up to 2 extra cycles. */
 			LSN_AM_DIRECT_PAGE_INDIRECT_INDEXED_Y,											/**< DP Indirect Indexed, Y. */
@@ -52,6 +53,12 @@ namespace lsn {
 			LSN_AM_INDIRECT_X,																/**< Indirect X addressing = 5 extra cycles. */
 			LSN_AM_INDIRECT_Y,																/**< Indirect Y addressing = 4 extra cycles + optional cycle. */
 			LSN_AM_INDIRECT,																/**< Absolute indirect addressing (JMP) = 4 extra cycles. */
+			LSN_AM_ABSOLUTE_LONG_X,															/**< Absolute long indexed X. */
+			LSN_AM_ABSOLUTE_INDEXED_INDIRECT,												/**< Absolute indexed indirect (JMP/JSR (a,X)). */
+			LSN_AM_ABSOLUTE_INDIRECT_LONG,													/**< Absolute indirect long (JML [a]). */
+			LSN_AM_RELATIVE_LONG,															/**< Relative long (BRL). */
+			LSN_AM_BLOCK_MOVE,																/**< Block move (MVN/MVP). */
+			LSN_AM_STACK,																	/**< Stack (pushes, pulls, and returns). */
 		};
 
 		/** Instructions. Numbers specified because these are used in look-up tables. */
@@ -66,7 +73,9 @@ namespace lsn {
 			LSN_I_BMI,																		/**< Branch on minus (negative set). */
 			LSN_I_BNE,																		/**< Branch on not equal (zero clear). */
 			LSN_I_BPL,																		/**< Branch on plus (negative clear). */
+			LSN_I_BRA,																		/**< Branch always. */
 			LSN_I_BRK,																		/**< Break/interrupt. */
+			LSN_I_BRL,																		/**< Branch always long. */
 			LSN_I_BVC,																		/**< Branch on overflow clear. */
 			LSN_I_BVS,																		/**< Branch on overflow set. */
 			LSN_I_CLC,																		/**< Clear carry. */
@@ -86,39 +95,68 @@ namespace lsn {
 			LSN_I_INC,																		/**< Increment. */
 			LSN_I_INX,																		/**< Increment X. */
 			LSN_I_INY,																		/**< Increment Y. */
+			LSN_I_JML,																		/**< Jump long. */
 			LSN_I_JMP,																		/**< Jump. */
+			LSN_I_JSL,																		/**< Jump subroutine long. */
 			LSN_I_JSR,																		/**< Jump subroutine. */
 			LSN_I_LDA,																		/**< Load accumulator. */
 			LSN_I_LDX,																		/**< Load X. */
 			LSN_I_LDY,																		/**< Load Y. */
 			LSN_I_LSR,																		/**< Logical shift right. */
+			LSN_I_MVN,																		/**< Block move, incrementing. */
+			LSN_I_MVP,																		/**< Block move, decrementing. */
 			LSN_I_NOP,																		/**< No operation. */
 			LSN_I_ORA,																		/**< OR with accumulator. */
+			LSN_I_PEA,																		/**< Push effective absolute address. */
+			LSN_I_PEI,																		/**< Push effective indirect address. */
+			LSN_I_PER,																		/**< Push effective PC-relative address. */
 			LSN_I_PHA,																		/**< Push accumulator. */
+			LSN_I_PHB,																		/**< Push data bank register. */
 			LSN_I_PHD,																		/**< Push direct page register. */
+			LSN_I_PHK,																		/**< Push program bank register. */
 			LSN_I_PHP,																		/**< Push processor status (SR). */
+			LSN_I_PHX,																		/**< Push X. */
+			LSN_I_PHY,																		/**< Push Y. */
 			LSN_I_PLA,																		/**< Pull accumulator. */
+			LSN_I_PLB,																		/**< Pull data bank register. */
+			LSN_I_PLD,																		/**< Pull direct page register. */
 			LSN_I_PLP,																		/**< Pull processor status (SR). */
+			LSN_I_PLX,																		/**< Pull X. */
+			LSN_I_PLY,																		/**< Pull Y. */
+			LSN_I_REP,																		/**< Reset status bits. */
 			LSN_I_ROL,																		/**< Rotate left. */
 			LSN_I_ROR,																		/**< Rotate right. */
 			LSN_I_RTI,																		/**< Return from interrupt. */
+			LSN_I_RTL,																		/**< Return from subroutine long. */
 			LSN_I_RTS,																		/**< Return from subroutine. */
 			LSN_I_SBC,																		/**< Subtract with carry. */
 			LSN_I_SEC,																		/**< Set carry. */
 			LSN_I_SED,																		/**< Set decimal. */
 			LSN_I_SEI,																		/**< Set interrupt-disable. */
+			LSN_I_SEP,																		/**< Set status bits. */
 			LSN_I_STA,																		/**< Store accumulator. */
+			LSN_I_STP,																		/**< Stop the clock until reset. */
 			LSN_I_STX,																		/**< Store X. */
 			LSN_I_STY,																		/**< Store Y. */
+			LSN_I_STZ,																		/**< Store zero. */
 			LSN_I_TAX,																		/**< Transfer accumulator to X. */
 			LSN_I_TAY,																		/**< Transfer accumulator to Y. */
+			LSN_I_TCD,																		/**< Transfer 16 bit A to D. */
 			LSN_I_TCS,																		/**< Transfer 16 bit A to S. */
+			LSN_I_TDC,																		/**< Transfer D to 16 bit A. */
 			LSN_I_TRB,																		/**< Test and reset memory bits against accumulator. */
 			LSN_I_TSB,																		/**< Test and set memory bits against accumulator. */
+			LSN_I_TSC,																		/**< Transfer S to 16 bit A. */
 			LSN_I_TSX,																		/**< Transfer stack pointer to X. */
 			LSN_I_TXA,																		/**< Transfer X to accumulator. */
 			LSN_I_TXS,																		/**< Transfer X to stack pointer. */
+			LSN_I_TXY,																		/**< Transfer X to Y. */
 			LSN_I_TYA,																		/**< Transfer Y to accumulator. */
+			LSN_I_TYX,																		/**< Transfer Y to X. */
+			LSN_I_WAI,																		/**< Wait for an interrupt. */
+			LSN_I_WDM,																		/**< Reserved (2-byte no operation). */
+			LSN_I_XBA,																		/**< Exchange the bytes of A. */
+			LSN_I_XCE,																		/**< Exchange carry and emulation bits. */
 
 			LSN_I_ALR,																		/**< Illegal. Performs A & OP; LSR. */
 			LSN_I_ASR,																		/**< Same as LSN_I_ALR. */
@@ -163,19 +201,6 @@ namespace lsn {
 		 */
 		inline uint64_t						GetCycleCount() const { return m_ui64CycleCount; }
 
-		/**
-		 * Sets the clock divisors for bus access.
-		 * 
-		 * \param _ui8Fast The fast divisor (typically 6 or LSN_CS_*_CPU_DIVISOR_FAST).
-		 * \param _ui8Slow The slow divisor (typically 8 or LSN_CS_*_CPU_DIVISOR_SLOW).
-		 * \param _ui8XSlow The extra-slow divisor (typically 12 or LSN_CS_*_CPU_DIVISOR_XSLOW).
-		 **/
-		inline void							SetBusDivisors( uint8_t _ui8Fast, uint8_t _ui8Slow, uint8_t _ui8XSlow ) {
-			m_ui8FastDiv = _ui8Fast;
-			m_ui8SlowDiv = _ui8Slow;
-			m_ui8XSlowDiv = _ui8XSlow;
-		}
-
 		/**
 		 * Signals an IRQ to be handled before the next instruction.
 		 */
@@ -191,9 +216,17 @@ namespace lsn {
 
 		// == Members.
 		uint64_t							m_ui64CycleCount = 0ULL;						/**< The total CPU cycles that have ticked. */
-		uint8_t								m_ui8FastDiv = LSN_CS_NTSC_CPU_DIVISOR_FAST;	/**< The fast divisor. */
-		uint8_t								m_ui8SlowDiv = LSN_CS_NTSC_CPU_DIVISOR_SLOW;	/**< The slow divisor. */
-		uint8_t								m_ui8XSlowDiv = LSN_CS_NTSC_CPU_DIVISOR_XSLOW;	/**< The extra-slow divisor. */
+		/*
+		 * The bus divisors are compile-time constants, so every multiplication and division by them in the cycle loops folds into an
+		 *	immediate.  NTSC and PAL share them (only the master clock differs, and that is set at run time through
+		 *	CTickable::SetMasterClock()), so a single core serves both regions.
+		 */
+		static constexpr uint8_t			m_ui8FastDiv = LSN_CS_NTSC_CPU_DIVISOR_FAST;	/**< The fast divisor. */
+		static constexpr uint8_t			m_ui8SlowDiv = LSN_CS_NTSC_CPU_DIVISOR_SLOW;	/**< The slow divisor. */
+		static constexpr uint8_t			m_ui8XSlowDiv = LSN_CS_NTSC_CPU_DIVISOR_XSLOW;	/**< The extra-slow divisor. */
+
+		static_assert( LSN_CS_PAL_CPU_DIVISOR_FAST == LSN_CS_NTSC_CPU_DIVISOR_FAST && LSN_CS_PAL_CPU_DIVISOR_SLOW == LSN_CS_NTSC_CPU_DIVISOR_SLOW &&
+			LSN_CS_PAL_CPU_DIVISOR_XSLOW == LSN_CS_NTSC_CPU_DIVISOR_XSLOW, "A region with its own bus divisors needs its own core." );
 	};
 
 }	// namespace lsn
@@ -0,0 +1,366 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: A cartridge.  Detects the ROM's header and builds the memory map (LoROM, HiROM, or ExHiROM) that Bus A uses to reach it.
+ */
+
+
+#include "LSNCartridge.h"
+#include "../Bus/LSNBusB.h"
+#include "../CPU/LSNCpuIo.h"
+#include "../CPU/LSNDma.h"
+
+#include <algorithm>
+
+
+namespace lsn {
+
+	// == Functions.
+	/**
+	 * Loads a ROM image.  A 512-byte copier header is skipped if present.  The image is not copied and must outlive the cartridge's
+	 *	memory map.
+	 *
+	 * \param _pui8Rom The ROM image.
+	 * \param _sSize The size of the ROM image in bytes.
+	 * \return Returns LSN_E_SUCCESS, LSN_E_FILE_TOO_SMALL if the image is too small to contain a header, LSN_E_FILE_TOO_LARGE if it
+	 *	is too large for any mapper, LSN_E_BAD_FILE_FORMAT if no header could be found, or LSN_E_OUT_OF_MEMORY.
+	 **/
+	LSN_ERRORS CCartridge::LoadRom( const uint8_t * _pui8Rom, size_t _sSize ) {
+		Reset();
+		return LoadImage( _pui8Rom, _sSize );
+	}
+
+	/**
+	 * Loads a ROM file by mapping it into memory read-only.  Nothing is copied: the memory map's ROM pages point straight into the
+	 *	file mapping, which the cartridge keeps open until Reset() or the next load.
+	 *
+	 * \param _pFile Path to the ROM file.
+	 * \param _bPrefault If true, the whole file is made resident now instead of on first access.
+	 * \return Returns LSN_E_SUCCESS, an error from opening or mapping the file, or an error from LoadRom().
+	 **/
+	LSN_ERRORS CCartridge::LoadRom( const std::filesystem::path &_pFile, bool _bPrefault ) {
+		Reset();
+		LSN_ERRORS eErr = m_fmFile.OpenReadOnly( _pFile );
+		if ( eErr != LSN_E_SUCCESS ) { return eErr; }
+		eErr = m_fmFile.MapWholeFile( _bPrefault );
+		if ( eErr == LSN_E_SUCCESS ) {
+			eErr = LoadImage( m_fmFile.MappedData(), size_t( m_fmFile.Size() ) );
+		}
+		if ( eErr != LSN_E_SUCCESS ) { Reset(); }
+		return eErr;
+	}
+
+	/**
+	 * Unloads the ROM and closes its file mapping.  Buses still holding the old memory map must be given a new one first.
+	 **/
+	void CCartridge::Reset() {
+		m_pmmMap.reset();
+		m_fmFile.Close();
+		m_pui8Rom = nullptr;
+		m_ui32RomSize = 0;
+		m_ui32SramSize = 0;
+		m_hHeader = {};
+		m_mMapper = LSN_M_NONE;
+	}
+
+	/**
+	 * Detects the header in a ROM image and builds its memory map.
+	 *
+	 * \param _pui8Rom The ROM image.
+	 * \param _sSize The size of the ROM image in bytes.
+	 * \return Returns the same errors as LoadRom().
+	 **/
+	LSN_ERRORS CCartridge::LoadImage( const uint8_t * _pui8Rom, size_t _sSize ) {
+		if ( (_sSize & 0x3FF) == 0x200 ) {
+			// Copier header.
+			_pui8Rom += 0x200;
+			_sSize -= 0x200;
+		}
+		if ( !_pui8Rom || _sSize < 0x8000 ) { return LSN_E_FILE_TOO_SMALL; }
+		if ( _sSize > 0x800000 ) { return LSN_E_FILE_TOO_LARGE; }
+
+		static const struct {
+			uint32_t								ui32Offset;
+			uint8_t									ui8Mode;
+			LSN_MAPPER								mMapper;
+		} sCandidates[] = {
+			{ 0x007FC0, 0x00, LSN_M_LOROM },
+			{ 0x00FFC0, 0x01, LSN_M_HIROM },
+			{ 0x40FFC0, 0x05, LSN_M_EXHIROM },
+		};
+		int32_t i32Best = LSN_HS_NONE;
+		size_t sBest = 0;
+		for ( size_t I = 0; I < std::size( sCandidates ); ++I ) {
+			int32_t i32Score = ScoreHeader( _pui8Rom, uint32_t( _sSize ), sCandidates[I].ui32Offset, sCandidates[I].ui8Mode );
+			// Ties go to the earlier (smaller) mapper.
+			if ( i32Score > i32Best ) {
+				i32Best = i32Score;
+				sBest = I;
+			}
+		}
+		if ( i32Best < LSN_HS_MIN ) { return LSN_E_BAD_FILE_FORMAT; }
+
+		m_pui8Rom = _pui8Rom;
+		m_ui32RomSize = uint32_t( _sSize );
+		m_mMapper = sCandidates[sBest].mMapper;
+		ReadHeader( sCandidates[sBest].ui32Offset );
+		// At most 256 kibibytes fit in the HiROM SRAM window.
+		m_ui32SramSize = m_hHeader.ui8SramSize ? (1024U << std::min<uint8_t>( m_hHeader.ui8SramSize, 8 )) : 0;
+
+		try {
+			auto pmmMap = std::make_shared<CMemoryMap>();
+			BuildMap( (*pmmMap) );
+			m_pmmMap = std::move( pmmMap );
+		}
+		catch ( ... ) {
+			m_pui8Rom = nullptr;
+			m_ui32RomSize = 0;
+			m_mMapper = LSN_M_NONE;
+			return LSN_E_OUT_OF_MEMORY;
+		}
+		return LSN_E_SUCCESS;
+	}
+
+	/**
+	 * Mirrors an offset into a memory of a given size the way cartridge boards decode it: the largest power of 2 not above the size
+	 *	maps directly, and the remainder repeats to fill the next power of 2.  A 3-mebibyte ROM therefore reads as 2 + 1 + 1.
+	 *
+	 * \param _ui32Offset The offset to mirror.
+	 * \param _ui32Size The size of the memory.  Must not be 0.
+	 * \return Returns the offset within the memory that _ui32Offset reaches.
+	 **/
+	uint32_t CCartridge::Mirror( uint32_t _ui32Offset, uint32_t _ui32Size ) {
+		assert( _ui32Size );
+		uint32_t ui32Base = 0;
+		uint32_t ui32Mask = 1U << 24;
+		while ( _ui32Offset >= _ui32Size ) {
+			while ( !(_ui32Offset & ui32Mask) ) { ui32Mask >>= 1; }
+			_ui32Offset -= ui32Mask;
+			if ( _ui32Size > ui32Mask ) {
+				_ui32Size -= ui32Mask;
+				ui32Base += ui32Mask;
+			}
+			ui32Mask >>= 1;
+		}
+		return ui32Base + _ui32Offset;
+	}
+
+	/**
+	 * Scores how likely it is that a header is at a given offset in the ROM.
+	 *
+	 * \param _pui8Rom The ROM image.
+	 * \param _ui32Size The size of the ROM image.
+	 * \param _ui32Offset The offset of the header ($7FC0, $FFC0, or $40FFC0).
+	 * \param _ui8Mode The low nibble of the map mode expected at that offset.
+	 * \return Returns the score (negative for a header that is more unlikely than likely), or LSN_HS_NONE if no header fits there.
+	 **/
+	int32_t CCartridge::ScoreHeader( const uint8_t * _pui8Rom, uint32_t _ui32Size, uint32_t _ui32Offset, uint8_t _ui8Mode ) {
+		if ( uint64_t( _ui32Offset ) + 0x40 > _ui32Size ) { return LSN_HS_NONE; }
+		const uint8_t * pui8Header = _pui8Rom + _ui32Offset;
+		int32_t i32Score = 0;
+
+		// The map mode matches the location ($20/$30, $21/$31, or $25/$35).
+		if ( (pui8Header[0x15] & 0xEF) == (0x20 | _ui8Mode) ) { i32Score += 2; }
+		// The checksum and its complement agree.
+		uint16_t ui16Complement = uint16_t( pui8Header[0x1C] | (pui8Header[0x1D] << 8) );
+		uint16_t ui16Checksum = uint16_t( pui8Header[0x1E] | (pui8Header[0x1F] << 8) );
+		if ( uint16_t( ui16Complement + ui16Checksum ) == 0xFFFF ) { i32Score += 4; }
+		// The reset vector points into ROM.
+		uint16_t ui16Reset = uint16_t( pui8Header[0x3C] | (pui8Header[0x3D] << 8) );
+		i32Score += (ui16Reset >= 0x8000) ? 1 : -4;
+		// The title is printable.
+		bool bPrintable = true;
+		for ( uint32_t I = 0; I < 21; ++I ) {
+			if ( pui8Header[I] < 0x20 || pui8Header[I] > 0x7E ) {
+				bPrintable = false;
+				break;
+			}
+		}
+		if ( bPrintable ) { ++i32Score; }
+		// The sizes are sane.
+		if ( pui8Header[0x17] >= 0x07 && pui8Header[0x17] <= 0x0D ) { ++i32Score; }
+		if ( pui8Header[0x18] <= 0x08 ) { ++i32Score; }
+		return i32Score;
+	}
+
+	/**
+	 * Reads the header at a given offset into m_hHeader.
+	 *
+	 * \param _ui32Offset The offset of the header.
+	 **/
+	void CCartridge::ReadHeader( uint32_t _ui32Offset ) {
+		const uint8_t * pui8Header = m_pui8Rom + _ui32Offset;
+		for ( uint32_t I = 0; I < 21; ++I ) {
+			m_hHeader.szTitle[I] = char( pui8Header[I] );
+		}
+		m_hHeader.szTitle[21] = '\0';
+		m_hHeader.ui8MapMode = pui8Header[0x15];
+		m_hHeader.ui8CartType = pui8Header[0x16];
+		m_hHeader.ui8RomSize = pui8Header[0x17];
+		m_hHeader.ui8SramSize = pui8Header[0x18];
+		m_hHeader.ui8Region = pui8Header[0x19];
+		m_hHeader.ui8DevId = pui8Header[0x1A];
+		m_hHeader.ui8Version = pui8Header[0x1B];
+		m_hHeader.ui16Complement = uint16_t( pui8Header[0x1C] | (pui8Header[0x1D] << 8) );
+		m_hHeader.ui16Checksum = uint16_t( pui8Header[0x1E] | (pui8Header[0x1F] << 8) );
+		m_hHeader.ui16ResetVector = uint16_t( pui8Header[0x3C] | (pui8Header[0x3D] << 8) );
+	}
+
+	/**
+	 * Gets the ROM offset that an address reaches, before mirroring.
+	 *
+	 * \param _ui8Bank The bank.
+	 * \param _ui16Address The address within the bank.
+	 * \param _ui32Offset Holds the ROM offset on return.
+	 * \return Returns true if the address is in ROM.
+	 **/
+	bool CCartridge::RomOffset( uint8_t _ui8Bank, uint16_t _ui16Address, uint32_t &_ui32Offset ) const {
+		const uint8_t ui8Bank = _ui8Bank & 0x7F;
+		if ( _ui8Bank == 0x7E || _ui8Bank == 0x7F ) { return false; }
+		switch ( m_mMapper ) {
+			case LSN_M_LOROM : {
+				// $00-$7D/$80-$FF:$8000-$FFFF, mirrored into $40-$6F/$C0-$EF:$0000-$7FFF.
+				if ( _ui16Address < 0x8000 && (ui8Bank < 0x40 || ui8Bank >= 0x70) ) { return false; }
+				_ui32Offset = (uint32_t( ui8Bank ) << 15) | (_ui16Address & 0x7FFF);
+				return true;
+			}
+			case LSN_M_HIROM : {
+				// $40-$7D/$C0-$FF:$0000-$FFFF, mirrored into $00-$3F/$80-$BF:$8000-$FFFF.
+				if ( _ui16Address < 0x8000 && ui8Bank < 0x40 ) { return false; }
+				_ui32Offset = (uint32_t( ui8Bank & 0x3F ) << 16) | _ui16Address;
+				return true;
+			}
+			case LSN_M_EXHIROM : {
+				// $C0-$FF:$0000-$FFFF is the first 4 mebibytes and $40-$7D:$0000-$FFFF the rest, each mirrored into the $8000-$FFFF
+				//	halves of the banks 64 below it.
+				if ( _ui16Address < 0x8000 && ui8Bank < 0x40 ) { return false; }
+				_ui32Offset = (uint32_t( ui8Bank & 0x3F ) << 16) | _ui16Address;
+				if ( _ui8Bank < 0x80 ) { _ui32Offset += 0x400000; }
+				return true;
+			}
+			default : { return false; }
+		}
+	}
+
+	/**
+	 * Gets the SRAM offset that an address reaches, before mirroring.
+	 *
+	 * \param _ui8Bank The bank.
+	 * \param _ui16Address The address within the bank.
+	 * \param _ui32Offset Holds the SRAM offset on return.
+	 * \return Returns true if the address is in SRAM.
+	 **/
+	bool CCartridge::SramOffset( uint8_t _ui8Bank, uint16_t _ui16Address, uint32_t &_ui32Offset ) const {
+		if ( !m_ui32SramSize ) { return false; }
+		const uint8_t ui8Bank = _ui8Bank & 0x7F;
+		switch ( m_mMapper ) {
+			case LSN_M_LOROM : {
+				// $70-$7D/$F0-$FF:$0000-$7FFF.
+				if ( _ui16Address >= 0x8000 || ui8Bank < 0x70 || _ui8Bank == 0x7E || _ui8Bank == 0x7F ) { return false; }
+				_ui32Offset = (uint32_t( ui8Bank - 0x70 ) << 15) | _ui16Address;
+				return true;
+			}
+			case LSN_M_HIROM : {}	LSN_FALLTHROUGH
+			case LSN_M_EXHIROM : {
+				// $20-$3F/$A0-$BF:$6000-$7FFF.
+				if ( _ui16Address < 0x6000 || _ui16Address >= 0x8000 || ui8Bank < 0x20 || ui8Bank >= 0x40 ) { return false; }
+				_ui32Offset = (uint32_t( ui8Bank - 0x20 ) << 13) | (_ui16Address - 0x6000);
+				return true;
+			}
+			default : { return false; }
+		}
+	}
+
+	/**
+	 * Gets the address in bus memory that holds a given SRAM offset: the first address at which the SRAM offset appears.
+	 *
+	 * \param _ui32Offset The SRAM offset, already mirrored.
+	 * \return Returns the full 24-bit address that holds the SRAM byte.
+	 **/
+	uint32_t CCartridge::SramAddress( uint32_t _ui32Offset ) const {
+		if ( m_mMapper == LSN_M_LOROM ) {
+			return 0x700000 + ((_ui32Offset >> 15) << 16) + (_ui32Offset & 0x7FFF);
+		}
+		return 0x206000 + ((_ui32Offset >> 13) << 16) + (_ui32Offset & 0x1FFF);
+	}
+
+	/**
+	 * Fills a memory map for the loaded ROM.
+	 *
+	 * \param _mmMap The memory map to fill.
+	 **/
+	void CCartridge::BuildMap( CMemoryMap &_mmMap ) {
+		for ( uint32_t ui32Bank = 0; ui32Bank < 0x100; ++ui32Bank ) {
+			const uint8_t ui8Bank = uint8_t( ui32Bank );
+			// $7E-$7F (WRAM) keep the basic mapping.
+			if ( ui8Bank == 0x7E || ui8Bank == 0x7F ) { continue; }
+			for ( uint32_t ui32Page = 0; ui32Page < 0x100; ++ui32Page ) {
+				const uint16_t ui16Chunk = uint16_t( (ui32Bank << 8) | ui32Page );
+				const uint16_t ui16Address = uint16_t( ui32Page << 8 );
+				if ( (ui8Bank & 0x7F) < 0x40 && ui16Address < 0x6000 ) {
+					if ( ui16Address < 0x2000 ) {
+						// The first 8 kibibytes of WRAM.
+						_mmMap.SetMemoryMirror( ui16Chunk, 0x7E0000 | ui16Address );
+					}
+					else if ( ui16Address != 0x2100 && ui16Address != 0x4000 && (ui16Address < 0x4200 || ui16Address >= 0x4400) ) {
+						// $2000-$20FF, $2200-$3FFF, $4100-$41FF, and $4400-$5FFF: nothing answers.
+						_mmMap.SetAccessor( ui16Chunk, &CMemoryMap::OpenBusRead, nullptr, &CMemoryMap::NullWrite, nullptr,
+							nullptr, &CMemoryMap::NullWrite );
+					}
+					// $2100-$21FF (Bus B) and $4200-$43FF (CPU I/O and DMA) are mapped below, and $4000-$40FF holds the joypad serial
+					//	ports ($4016/$4017), which belong to the I/O side rather than the cartridge.
+					continue;
+				}
+
+				uint32_t ui32Offset;
+				if ( RomOffset( ui8Bank, ui16Address, ui32Offset ) ) {
+					ui32Offset = Mirror( ui32Offset, m_ui32RomSize );
+					_mmMap.SetAccessor( ui16Chunk, &CCartridge::RomRead, this, &CMemoryMap::NullWrite, nullptr,
+						&CCartridge::RomDebugRead, &CMemoryMap::NullWrite );
+					if ( ui32Offset + 0x100 <= m_ui32RomSize ) {
+						_mmMap.SetDirectAccess( ui16Chunk, const_cast<uint8_t *>(m_pui8Rom + ui32Offset), true, false );
+					}
+				}
+				else if ( SramOffset( ui8Bank, ui16Address, ui32Offset ) ) {
+					_mmMap.SetMemoryMirror( ui16Chunk, SramAddress( Mirror( ui32Offset, m_ui32SramSize ) ) );
+				}
+				else {
+					_mmMap.SetAccessor( ui16Chunk, &CMemoryMap::OpenBusRead, nullptr, &CMemoryMap::NullWrite, nullptr,
+						nullptr, &CMemoryMap::NullWrite );
+				}
+			}
+		}
+		CBusB::ApplyMapping( _mmMap );
+		CCpuIo::ApplyMapping( _mmMap );
+		CDma::ApplyMapping( _mmMap );
+	}
+
+	/**
+	 * Reads from a ROM page that is only partly inside the ROM (the last page of a ROM whose size is not a multiple of 256).
+	 *
+	 * \param _rfpParms The read parameters.  pvParm0 points to the CCartridge.
+	 * \param _ui8Ret Holds the read value on return.
+	 * \param _ui8OpenMask Unused.
+	 **/
+	void LSN_FASTCALL CCartridge::RomRead( const CMemoryMap::LSN_ACCESSFUNCPARMS &_rfpParms, uint8_t &_ui8Ret, uint8_t &_ui8OpenMask ) {
+		static_cast<void>(_ui8OpenMask);
+		RomDebugRead( _rfpParms, _ui8Ret );
+	}
+
+	/**
+	 * Debug-reads from a ROM page that is only partly inside the ROM.
+	 *
+	 * \param _rfpParms The read parameters.  pvParm0 points to the CCartridge.
+	 * \param _ui8Ret Holds the read value on return.
+	 **/
+	void LSN_FASTCALL CCartridge::RomDebugRead( const CMemoryMap::LSN_ACCESSFUNCPARMS &_rfpParms, uint8_t &_ui8Ret ) {
+		const CCartridge * pcThis = static_cast<const CCartridge *>(_rfpParms.pvParm0);
+		uint32_t ui32Offset;
+		if ( pcThis->RomOffset( _rfpParms.ui8Bank, _rfpParms.ui16Address, ui32Offset ) ) {
+			_ui8Ret = pcThis->m_pui8Rom[Mirror( ui32Offset, pcThis->m_ui32RomSize )];
+		}
+	}
+
+}	// namespace lsn
@@ -0,0 +1,249 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: A cartridge.  Detects the ROM's header and builds the memory map (LoROM, HiROM, or ExHiROM) that Bus A uses to reach it.
+ */
+
+#pragma once
+
+#include "../LSNBirdSNES.h"
+#include "../Bus/LSNMemoryMap.h"
+#include "../Files/LSNFileMap.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+
+
+namespace lsn {
+
+	/**
+	 * Class CCartridge
+	 * \brief A cartridge.
+	 *
+	 * Description: A cartridge.  Detects the ROM's header and builds the memory map (LoROM, HiROM, or ExHiROM) that Bus A uses to reach it.
+	 *	Every mirror is resolved while the map is built: ROM pages get direct pointers into the ROM image (already mirrored to fit its size)
+	 *	and WRAM/SRAM pages get the offset of the bus memory they alias, so no access ever masks its address at run time.
+	 * The ROM image is not copied.  A ROM loaded from a file is mapped read-only straight from the file, so startup does no reading and
+	 *	every emulator process running the same game shares the same physical pages.  The image must stay valid (and the cartridge must
+	 *	stay alive) for as long as any bus uses MemoryMap().
+	 */
+	class CCartridge {
+	public :
+		// == Enumerations.
+		/** Memory mappers. */
+		enum LSN_MAPPER : uint8_t {
+			LSN_M_NONE,																		/**< No ROM is loaded. */
+			LSN_M_LOROM,																	/**< Mode $20/$30: 32 kibibytes of ROM in the upper half of each bank. */
+			LSN_M_HIROM,																	/**< Mode $21/$31: 64 kibibytes of ROM per bank. */
+			LSN_M_EXHIROM,																	/**< Mode $25/$35: HiROM extended to 8 mebibytes. */
+		};
+
+
+		// == Types.
+		/** The internal header found at $7FC0 (LoROM), $FFC0 (HiROM), or $40FFC0 (ExHiROM) in the ROM. */
+		struct LSN_HEADER {
+			char									szTitle[22];						/**< The game title (21 characters in the ROM), nul-terminated. */
+			uint8_t									ui8MapMode;							/**< The map mode ($20, $21, $25, etc., with $10 set for FastROM). */
+			uint8_t									ui8CartType;						/**< The cartridge type (ROM only, ROM+RAM, coprocessors, etc.) */
+			uint8_t									ui8RomSize;							/**< The ROM size as 1 << N kibibytes. */
+			uint8_t									ui8SramSize;						/**< The SRAM size as 1 << N kibibytes, or 0 for none. */
+			uint8_t									ui8Region;							/**< The destination code. */
+			uint8_t									ui8DevId;							/**< The developer ID. */
+			uint8_t									ui8Version;							/**< The ROM version. */
+			uint16_t								ui16Complement;						/**< The checksum complement. */
+			uint16_t								ui16Checksum;						/**< The checksum. */
+			uint16_t								ui16ResetVector;					/**< The emulation-mode reset vector. */
+		};
+
+
+		// == Functions.
+		/**
+		 * Loads a ROM image.  A 512-byte copier header is skipped if present.  The image is not copied and must outlive the cartridge's
+		 *	memory map.
+		 *
+		 * \param _pui8Rom The ROM image.
+		 * \param _sSize The size of the ROM image in bytes.
+		 * \return Returns LSN_E_SUCCESS, LSN_E_FILE_TOO_SMALL if the image is too small to contain a header, LSN_E_FILE_TOO_LARGE if it
+		 *	is too large for any mapper, LSN_E_BAD_FILE_FORMAT if no header could be found, or LSN_E_OUT_OF_MEMORY.
+		 **/
+		LSN_ERRORS									LoadRom( const uint8_t * _pui8Rom, size_t _sSize );
+
+		/**
+		 * Loads a ROM file by mapping it into memory read-only.  Nothing is copied: the memory map's ROM pages point straight into the
+		 *	file mapping, which the cartridge keeps open until Reset() or the next load.
+		 *
+		 * \param _pFile Path to the ROM file.
+		 * \param _bPrefault If true, the whole file is made resident now instead of on first access.
+		 * \return Returns LSN_E_SUCCESS, an error from opening or mapping the file, or an error from LoadRom().
+		 **/
+		LSN_ERRORS									LoadRom( const std::filesystem::path &_pFile, bool _bPrefault = false );
+
+		/**
+		 * Unloads the ROM and closes its file mapping.  Buses still holding the old memory map must be given a new one first.
+		 **/
+		void										Reset();
+
+		/**
+		 * Gets the memory map for the loaded ROM, to be passed to CBusA::SetMemoryMap().
+		 *
+		 * \return Returns the memory map, or nullptr if no ROM is loaded.
+		 **/
+		inline std::shared_ptr<const CMemoryMap>	MemoryMap() const { return m_pmmMap; }
+
+		/**
+		 * Gets the mapper.
+		 *
+		 * \return Returns the mapper detected by LoadRom().
+		 **/
+		inline LSN_MAPPER							Mapper() const { return m_mMapper; }
+
+		/**
+		 * Gets the ROM's header.
+		 *
+		 * \return Returns the header detected by LoadRom().
+		 **/
+		inline const LSN_HEADER &					Header() const { return m_hHeader; }
+
+		/**
+		 * Determines whether the ROM's header asks for FastROM timing (map mode $30/$31/$35).
+		 *
+		 * \return Returns true if the ROM is FastROM.
+		 **/
+		inline bool									IsFastRom() const { return (m_hHeader.ui8MapMode & 0x10) != 0; }
+
+		/**
+		 * Gets the ROM image (without any copier header).
+		 *
+		 * \return Returns a pointer to the ROM image, or nullptr if no ROM is loaded.
+		 **/
+		inline const uint8_t *						Rom() const { return m_pui8Rom; }
+
+		/**
+		 * Gets the size of the ROM image (without any copier header).
+		 *
+		 * \return Returns the size of the ROM in bytes.
+		 **/
+		inline uint32_t								RomSize() const { return m_ui32RomSize; }
+
+		/**
+		 * Gets the size of the cartridge's SRAM.
+		 *
+		 * \return Returns the size of the SRAM in bytes.
+		 **/
+		inline uint32_t								SramSize() const { return m_ui32SramSize; }
+
+		/**
+		 * Mirrors an offset into a memory of a given size the way cartridge boards decode it: the largest power of 2 not above the size
+		 *	maps directly, and the remainder repeats to fill the next power of 2.  A 3-mebibyte ROM therefore reads as 2 + 1 + 1.
+		 *
+		 * \param _ui32Offset The offset to mirror.
+		 * \param _ui32Size The size of the memory.  Must not be 0.
+		 * \return Returns the offset within the memory that _ui32Offset reaches.
+		 **/
+		static uint32_t								Mirror( uint32_t _ui32Offset, uint32_t _ui32Size );
+
+
+	protected :
+		// == Enumerations.
+		/** Header detection. */
+		enum LSN_HEADER_SCORES : int32_t {
+			LSN_HS_NONE										= INT32_MIN,						/**< Returned by ScoreHeader() when no header fits at the offset. */
+			LSN_HS_MIN										= 4,								/**< The lowest score accepted as a header: a reset vector into ROM plus a valid checksum, or the matching map mode and another sane field. */
+		};
+
+
+		// == Members.
+		std::shared_ptr<const CMemoryMap>			m_pmmMap;							/**< The memory map built by LoadRom(). */
+		CFileMap									m_fmFile;							/**< The mapped ROM file, if the ROM came from a file. */
+		const uint8_t *								m_pui8Rom = nullptr;				/**< The ROM image (not owned). */
+		uint32_t									m_ui32RomSize = 0;					/**< The size of the ROM image. */
+		uint32_t									m_ui32SramSize = 0;					/**< The size of the SRAM. */
+		LSN_HEADER									m_hHeader = {};						/**< The ROM's header. */
+		LSN_MAPPER									m_mMapper = LSN_M_NONE;				/**< The ROM's mapper. */
+
+
+		// == Functions.
+		/**
+		 * Detects the header in a ROM image and builds its memory map.
+		 *
+		 * \param _pui8Rom The ROM image.
+		 * \param _sSize The size of the ROM image in bytes.
+		 * \return Returns the same errors as LoadRom().
+		 **/
+		LSN_ERRORS									LoadImage( const uint8_t * _pui8Rom, size_t _sSize );
+
+		/**
+		 * Scores how likely it is that a header is at a given offset in the ROM.
+		 *
+		 * \param _pui8Rom The ROM image.
+		 * \param _ui32Size The size of the ROM image.
+		 * \param _ui32Offset The offset of the header ($7FC0, $FFC0, or $40FFC0).
+		 * \param _ui8Mode The low nibble of the map mode expected at that offset.
+		 * \return Returns the score (negative for a header that is more unlikely than likely), or LSN_HS_NONE if no header fits there.
+		 **/
+		static int32_t								ScoreHeader( const uint8_t * _pui8Rom, uint32_t _ui32Size, uint32_t _ui32Offset, uint8_t _ui8Mode );
+
+		/**
+		 * Reads the header at a given offset into m_hHeader.
+		 *
+		 * \param _ui32Offset The offset of the header.
+		 **/
+		void										ReadHeader( uint32_t _ui32Offset );
+
+		/**
+		 * Gets the ROM offset that an address reaches, before mirroring.
+		 *
+		 * \param _ui8Bank The bank.
+		 * \param _ui16Address The address within the bank.
+		 * \param _ui32Offset Holds the ROM offset on return.
+		 * \return Returns true if the address is in ROM.
+		 **/
+		bool										RomOffset( uint8_t _ui8Bank, uint16_t _ui16Address, uint32_t &_ui32Offset ) const;
+
+		/**
+		 * Gets the SRAM offset that an address reaches, before mirroring.
+		 *
+		 * \param _ui8Bank The bank.
+		 * \param _ui16Address The address within the bank.
+		 * \param _ui32Offset Holds the SRAM offset on return.
+		 * \return Returns true if the address is in SRAM.
+		 **/
+		bool										SramOffset( uint8_t _ui8Bank, uint16_t _ui16Address, uint32_t &_ui32Offset ) const;
+
+		/**
+		 * Gets the address in bus memory that holds a given SRAM offset: the first address at which the SRAM offset appears.
+		 *
+		 * \param _ui32Offset The SRAM offset, already mirrored.
+		 * \return Returns the full 24-bit address that holds the SRAM byte.
+		 **/
+		uint32_t									SramAddress( uint32_t _ui32Offset ) const;
+
+		/**
+		 * Fills a memory map for the loaded ROM.
+		 *
+		 * \param _mmMap The memory map to fill.
+		 **/
+		void										BuildMap( CMemoryMap &_mmMap );
+
+		/**
+		 * Reads from a ROM page that is only partly inside the ROM (the last page of a ROM whose size is not a multiple of 256).
+		 *
+		 * \param _rfpParms The read parameters.  pvParm0 points to the CCartridge.
+		 * \param _ui8Ret Holds the read value on return.
+		 * \param _ui8OpenMask Unused.
+		 **/
+		static void LSN_FASTCALL					RomRead( const CMemoryMap::LSN_ACCESSFUNCPARMS &_rfpParms, uint8_t &_ui8Ret, uint8_t &_ui8OpenMask );
+
+		/**
+		 * Debug-reads from a ROM page that is only partly inside the ROM.
+		 *
+		 * \param _rfpParms The read parameters.  pvParm0 points to the CCartridge.
+		 * \param _ui8Ret Holds the read value on return.
+		 **/
+		static void LSN_FASTCALL					RomDebugRead( const CMemoryMap::LSN_ACCESSFUNCPARMS &_rfpParms, uint8_t &_ui8Ret );
+	};
+
+}	// namespace lsn
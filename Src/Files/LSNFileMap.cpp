@@ -94,6 +94,64 @@ namespace lsn {
 		return CreateFileMap();
 	}
 
+	/**
+	 * Opens a file for reading only.  Other processes may read the file (and share its mapped pages) at the same time.
+	 *
+	 * \param _pFile Path to the file to open.
+	 * \return Returns an error code indicating the result of the operation.
+	 */
+	LSN_ERRORS CFileMap::OpenReadOnly( const std::filesystem::path &_pFile ) {
+		Close();
+		try {
+			m_hFile = ::CreateFileW( _pFile.native().c_str(),
+				GENERIC_READ,
+				FILE_SHARE_READ,
+				NULL,
+				OPEN_EXISTING,
+				FILE_ATTRIBUTE_NORMAL,
+				NULL );
+
+			if ( m_hFile == FileMap_Null ) {
+				auto aCode = CErrors::GetLastError_To_Native();
+				Close();
+				return aCode;
+			}
+			m_bWritable = false;
+		}
+		catch ( ... ) { return LSN_E_OUT_OF_MEMORY; }		// _pFile.native() fails if out of memory.
+		return CreateFileMap();
+	}
+
+	/**
+	 * Maps the whole file into memory for reading.  The pages are backed by the file itself (nothing is copied) and are shared with
+	 *	every other process mapping the same file.  The OS is told the whole file will be needed soon, and with _bPrefault every page
+	 *	is faulted in before returning, so that later accesses never stall on the disk.
+	 *
+	 * \param _bPrefault If true, every page is made resident before returning.
+	 * \return Returns an error code indicating the result of the operation.
+	 */
+	LSN_ERRORS CFileMap::MapWholeFile( bool _bPrefault ) {
+		if ( m_hMap == FileMap_Null ) { return LSN_E_FILE_NOT_OPENED; }
+		if ( Size() > std::numeric_limits<uint32_t>::max() ) { return LSN_E_FILE_TOO_LARGE; }
+		if ( m_pbMapBuffer ) {
+			if ( m_ui64MapStart == 0 && m_ui32MapSize == Size() ) { return LSN_E_SUCCESS; }
+			::UnmapViewOfFile( m_pbMapBuffer );
+			m_pbMapBuffer = nullptr;
+			m_ui64MapStart = std::numeric_limits<uint64_t>::max();
+			m_ui32MapSize = 0;
+		}
+		m_pbMapBuffer = static_cast<uint8_t *>(::MapViewOfFile( m_hMap,
+			m_bWritable ? FILE_MAP_WRITE : FILE_MAP_READ,
+			0,
+			0,
+			0 ));
+		if ( !m_pbMapBuffer ) { return CErrors::GetLastError_To_Native(); }
+		m_ui64MapStart = 0;
+		m_ui32MapSize = static_cast<uint32_t>(Size());
+		if ( _bPrefault ) { Prefault(); }
+		return LSN_E_SUCCESS;
+	}
+
 	/**
 	 * Closes the opened file.
 	 */
@@ -220,6 +278,56 @@ namespace lsn {
 		return CreateFileMap();
 	}
 
+	/**
+	 * Opens a file for reading only.  Other processes may read the file (and share its mapped pages) at the same time.
+	 *
+	 * \param _pFile Path to the file to open.
+	 * \return Returns an error code indicating the result of the operation.
+	 */
+	LSN_ERRORS CFileMap::OpenReadOnly( const std::filesystem::path &_pFile ) {
+		// Open() is already read-only here.
+		return Open( _pFile );
+	}
+
+	/**
+	 * Maps the whole file into memory for reading.  The pages are backed by the file itself (nothing is copied) and are shared with
+	 *	every other process mapping the same file.  The OS is told the whole file will be needed soon, and with _bPrefault every page
+	 *	is faulted in before returning, so that later accesses never stall on the disk.
+	 *
+	 * \param _bPrefault If true, every page is made resident before returning.
+	 * \return Returns an error code indicating the result of the operation.
+	 */
+	LSN_ERRORS CFileMap::MapWholeFile( bool _bPrefault ) {
+		if ( m_hMap == FileMap_Null ) { return LSN_E_FILE_NOT_OPENED; }
+		if ( Size() > std::numeric_limits<uint32_t>::max() ) { return LSN_E_FILE_TOO_LARGE; }
+		if ( m_pbMapBuffer ) {
+			if ( m_ui64MapStart == 0 && m_ui32MapSize == Size() ) { return LSN_E_SUCCESS; }
+			::munmap( m_pbMapBuffer, static_cast<size_t>(m_ui32MapSize) );
+			m_pbMapBuffer = nullptr;
+			m_ui64MapStart = std::numeric_limits<uint64_t>::max();
+			m_ui32MapSize = 0;
+		}
+		int iFlags = MAP_SHARED;
+#ifdef MAP_POPULATE
+		if ( _bPrefault ) { iFlags |= MAP_POPULATE; }
+#endif	// #ifdef MAP_POPULATE
+		void * pvMap = ::mmap( nullptr, static_cast<size_t>(Size()),
+			m_bWritable ? (PROT_READ | PROT_WRITE) : PROT_READ,
+			iFlags,
+			m_hMap,
+			0 );
+		if ( pvMap == MAP_FAILED ) { return CErrors::ErrNo_T_To_Native( errno ); }
+		m_pbMapBuffer = static_cast<uint8_t *>(pvMap);
+		m_ui64MapStart = 0;
+		m_ui32MapSize = static_cast<uint32_t>(Size());
+		// Reads jump all over the file, so have the whole thing read ahead rather than faulting it in 1 page at a time.
+		::madvise( pvMap, static_cast<size_t>(m_ui32MapSize), MADV_WILLNEED );
+#ifndef MAP_POPULATE
+		if ( _bPrefault ) { Prefault(); }
+#endif	// #ifndef MAP_POPULATE
+		return LSN_E_SUCCESS;
+	}
+
 	/**
 	 * Closes the opened file.
 	 */
@@ -280,4 +388,15 @@ namespace lsn {
 
 #endif	// #ifdef _WIN32
 
+	/**
+	 * Touches every page of the mapped bytes so that they are resident.
+	 **/
+	void CFileMap::Prefault() const {
+		volatile uint8_t ui8Sink = 0;
+		for ( uint32_t I = 0; I < m_ui32MapSize; I += 4096 ) {
+			ui8Sink = m_pbMapBuffer[I];
+		}
+		static_cast<void>(ui8Sink);
+	}
+
 }	// namespace lsn
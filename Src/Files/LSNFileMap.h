@@ -56,6 +56,31 @@ namespace lsn {
 		 */
 		virtual LSN_ERRORS									Create( const std::filesystem::path &_pFile );
 
+		/**
+		 * Opens a file for reading only.  Other processes may read the file (and share its mapped pages) at the same time.
+		 *
+		 * \param _pFile Path to the file to open.
+		 * \return Returns an error code indicating the result of the operation.
+		 */
+		LSN_ERRORS											OpenReadOnly( const std::filesystem::path &_pFile );
+
+		/**
+		 * Maps the whole file into memory for reading.  The pages are backed by the file itself (nothing is copied) and are shared with
+		 *	every other process mapping the same file.  The OS is told the whole file will be needed soon, and with _bPrefault every page
+		 *	is faulted in before returning, so that later accesses never stall on the disk.
+		 *
+		 * \param _bPrefault If true, every page is made resident before returning.
+		 * \return Returns an error code indicating the result of the operation.
+		 */
+		LSN_ERRORS											MapWholeFile( bool _bPrefault = false );
+
+		/**
+		 * Gets the mapped bytes.  After MapWholeFile(), this is the whole file.
+		 *
+		 * \return Returns a pointer to the mapped bytes, or nullptr if nothing is mapped.
+		 **/
+		inline const uint8_t *								MappedData() const { return m_pbMapBuffer; }
+
 		/**
 		 * Closes the opened file.
 		 */
@@ -89,6 +114,11 @@ namespace lsn {
 		 **/
 		LSN_ERRORS											CreateFileMap();
 
+		/**
+		 * Touches every page of the mapped bytes so that they are resident.
+		 **/
+		void												Prefault() const;
+
 	};
 
 }	// namespace lsn
@@ -0,0 +1,133 @@
+#ifdef __linux__
+
+#include "LSNBirdSNES.h"
+
+#ifdef LSN_CPU_VERIFY
+
+#include "Files/LSNStdFile.h"
+#include "Bus/LSNBusA.h"
+#include "CPU/LSNAotCompiler.h"
+#include "CPU/LSNRicoh5A22.h"
+#include "System/LSNScheduler.h"
+#include "System/LSNSystem.h"
+#include "LSONJson.h"
+
+#include <filesystem>
+#include <cstdio>
+#include <vector>
+#include <string>
+#include <memory>
+
+
+int main( int _iArgC, char ** _ppcArgV ) {
+	if ( _iArgC > 2 && std::string( _ppcArgV[1] ) == "--aot-fixture" ) {
+		// Regenerates LSNAotFixture.cpp, which must be done whenever the CPU core changes.
+		if ( lsn::CAotCompiler::SaveFixture( _ppcArgV[2] ) != lsn::LSN_E_SUCCESS ) {
+			lsn::DebugA( "AOT FIXTURE FAIL\n" );
+			return 1;
+		}
+		return 0;
+	}
+	std::unique_ptr<lsn::CBusA> pbBus = std::make_unique<lsn::CBusA>();
+	pbBus->ApplyBasicMapping();
+	std::unique_ptr<lsn::CRicoh5A22> pcCpu = std::make_unique<lsn::CRicoh5A22>( (*pbBus.get()) );
+	std::vector<uint8_t> vRam( 0x1000000 );
+	pbBus->SetMemory( vRam.data() );
+	{
+		// Bus access timing, before any test has watched pages or filled the log.
+		char szBench[64];
+		std::snprintf( szBench, std::size( szBench ), "%.3f ns per bus access\n", pbBus->BenchAccesses( 2000 ) );
+		lsn::DebugA( szBench );
+	}
+	if ( !pbBus->RunWideAccessTest() ) {
+		lsn::DebugA( "BUS FAIL\n" );
+	}
+	if ( !pbBus->RunDirtyPageTest() ) {
+		lsn::DebugA( "DIRTY PAGES FAIL\n" );
+	}
+	if ( !pcCpu->RunIdleLoopTest() ) {
+		lsn::DebugA( "IDLE LOOP FAIL\n" );
+	}
+	if ( !pcCpu->RunAotTest() ) {
+		lsn::DebugA( "AOT FAIL\n" );
+	}
+	if ( !lsn::CAotCompiler::RunInstrSizeTest() ) {
+		lsn::DebugA( "INSTR SIZE FAIL\n" );
+	}
+	{
+		// DMA and HDMA, wired to the CPU through CCpuIo.
+		std::unique_ptr<lsn::CSystem> psSystem = std::make_unique<lsn::CSystem>();
+		if ( !psSystem->RunDmaTest() ) {
+			lsn::DebugA( "DMA FAIL\n" );
+		}
+		if ( !psSystem->RunIrqTest() ) {
+			lsn::DebugA( "IRQ FAIL\n" );
+		}
+		if ( !psSystem->RunApuTest() ) {
+			lsn::DebugA( "APU PORTS FAIL\n" );
+		}
+	}
+	if ( !lsn::CScheduler::RunTest() ) {
+		lsn::DebugA( "SCHEDULER FAIL\n" );
+	}
+	{
+		// Engine timing on plain-memory code, which RunJit() emits natively.
+		char szBench[128];
+		std::snprintf( szBench, std::size( szBench ), "%.3f ns per cycle (RunInstructions)\n",
+			pcCpu->BenchEngine( &lsn::CRicoh5A22::RunInstructions, 200000000ULL ) );
+		lsn::DebugA( szBench );
+#if LSN_CPU_JIT
+		std::snprintf( szBench, std::size( szBench ), "%.3f ns per cycle (RunJit)\n",
+			pcCpu->BenchEngine( &lsn::CRicoh5A22::RunJit, 200000000ULL ) );
+		lsn::DebugA( szBench );
+#endif	// #if LSN_CPU_JIT
+	}
+
+	// The SingleStepTests 65816 vectors (00.n.json to FF.e.json), from the first argument or the working directory.  RunJsonTest() also
+	//	checks RunInstructions(), RunJit(), and RunAot() against each test.
+	const std::filesystem::path pTests = _iArgC > 1 ? std::filesystem::path( _ppcArgV[1] ) : std::filesystem::path( "." );
+
+	static const char cChars[2] = { 'n', 'e' };
+
+	uint32_t ui32Failures = 0;
+	for ( uint32_t I = 0x00; I < 0x100; ++I ) {
+		for ( size_t N = 0; N < std::size( cChars ); ++N ) {
+			char szFile[64];
+			std::snprintf( szFile, std::size( szFile ), "%.2X.%c.json", I, cChars[N] );
+
+			const std::filesystem::path pFull = pTests / szFile;
+			lson::CJson jSon;
+			std::vector<uint8_t> vBytes;
+			lsn::CStdFile sfFile;
+			if ( sfFile.Open( pFull ) != lsn::LSN_E_SUCCESS ) { continue; }
+			if ( sfFile.LoadToMemory( vBytes ) != lsn::LSN_E_SUCCESS ) {
+				lsn::DebugA( "JSON FAIL to load File\n" );
+				continue;
+			}
+			vBytes.push_back( 0 );
+
+			if ( !jSon.SetJson( reinterpret_cast<const char *>(vBytes.data()) ) ) {
+				lsn::DebugA( "JSON FAIL\n" );
+				continue;
+			}
+			pcCpu->Reset<true>();
+			pbBus->ApplyBasicMapping();
+
+			const lson::CJsonContainer::LSON_JSON_VALUE & jvRoot = jSon.GetContainer()->GetValue( jSon.GetContainer()->GetRoot() );
+			for ( size_t J = 0; J < jvRoot.vArray.size(); ++J ) {
+				const lson::CJsonContainer::LSON_JSON_VALUE & jvThis = jSon.GetContainer()->GetValue( jvRoot.vArray[J] );
+				if ( !pcCpu->RunJsonTest( jSon, jvThis ) ) { ++ui32Failures; }
+			}
+			lsn::DebugLine( pFull.string() );
+		}
+	}
+
+	char szResult[64];
+	std::snprintf( szResult, std::size( szResult ), "%u failures\n", ui32Failures );
+	lsn::DebugA( szResult );
+	return ui32Failures ? 1 : 0;
+}
+
+#endif	// #ifdef LSN_CPU_VERIFY
+
+#endif	// #ifdef __linux__
@@ -7,7 +7,10 @@
 
 #include "Files/LSNStdFile.h"
 #include "Bus/LSNBusA.h"
+#include "Cpu/LSNAotCompiler.h"
 #include "Cpu/LSNRicoh5A22.h"
+#include "System/LSNScheduler.h"
+#include "System/LSNSystem.h"
 #include "LSONJson.h"
 
 #include <EEExpEval.h>
@@ -31,6 +34,43 @@ int main( int /*_iArgC*/, char ** /*_ppcArgV*/ ) {
 	std::unique_ptr<lsn::CRicoh5A22> pcCpu = std::make_unique<lsn::CRicoh5A22>( (*pbBus.get()) );
 	std::vector<uint8_t> vRam( 0x1000000 );
 	pbBus->SetMemory( vRam.data() );
+	{
+		// Bus access timing, before any test has watched pages or filled the log.
+		char szBench[64];
+		::snprintf( szBench, sizeof( szBench ), "%.3f ns per bus access\n", pbBus->BenchAccesses( 2000 ) );
+		lsn::DebugA( szBench );
+	}
+	if ( !pbBus->RunWideAccessTest() ) {
+		lsn::DebugA( "BUS FAIL\n" );
+	}
+	if ( !pbBus->RunDirtyPageTest() ) {
+		lsn::DebugA( "DIRTY PAGES FAIL\n" );
+	}
+	if ( !pcCpu->RunIdleLoopTest() ) {
+		lsn::DebugA( "IDLE LOOP FAIL\n" );
+	}
+	if ( !pcCpu->RunAotTest() ) {
+		lsn::DebugA( "AOT FAIL\n" );
+	}
+	if ( !lsn::CAotCompiler::RunInstrSizeTest() ) {
+		lsn::DebugA( "INSTR SIZE FAIL\n" );
+	}
+	{
+		// DMA and HDMA, wired to the CPU through CCpuIo.
+		std::unique_ptr<lsn::CSystem> psSystem = std::make_unique<lsn::CSystem>();
+		if ( !psSystem->RunDmaTest() ) {
+			lsn::DebugA( "DMA FAIL\n" );
+		}
+		if ( !psSystem->RunIrqTest() ) {
+			lsn::DebugA( "IRQ FAIL\n" );
+		}
+		if ( !psSystem->RunApuTest() ) {
+			lsn::DebugA( "APU PORTS FAIL\n" );
+		}
+	}
+	if ( !lsn::CScheduler::RunTest() ) {
+		lsn::DebugA( "SCHEDULER FAIL\n" );
+	}
 
 	//const std::filesystem::path pRoot = GetThisPath().remove_filename();
 	//const std::filesystem::path pTests = std::filesystem::path( ".." ) / ".." / "Research" / "65816" / "v1";
@@ -79,6 +119,15 @@ int main( int /*_iArgC*/, char ** /*_ppcArgV*/ ) {
 
 					lsn::DebugA( "JSON NOT FAIL\n" );
 					lsn::DebugLine( sFullUtf8 );
+
+					// Dispatch timing over the same vectors: the index table as the CPU runs it, then with the member-pointer run's
+					//	row lookup, then through the member-function pointers themselves.
+					char szBench[128];
+					::snprintf( szBench, sizeof( szBench ), "%.3f ns per cycle (index table), %.3f (tracked), %.3f (member pointers)\n",
+						pcCpu->BenchJsonTests( jSon, jvRoot, 64, lsn::CRicoh5A22::LSN_BD_INDEX_TABLE ),
+						pcCpu->BenchJsonTests( jSon, jvRoot, 64, lsn::CRicoh5A22::LSN_BD_INDEX_TABLE_TRACKED ),
+						pcCpu->BenchJsonTests( jSon, jvRoot, 64, lsn::CRicoh5A22::LSN_BD_MEMBER_POINTERS ) );
+					lsn::DebugA( szBench );
 				}
 			}
 		}
@@ -8,7 +8,10 @@
 
 
 #include "Bus/LSNBusA.h"
+#include "Cpu/LSNAotCompiler.h"
 #include "Cpu/LSNRicoh5A22.h"
+#include "System/LSNScheduler.h"
+#include "System/LSNSystem.h"
 #include "LSONJson.h"
 int WINAPI wWinMain( _In_ HINSTANCE /*_hInstance*/, _In_opt_ HINSTANCE /*_hPrevInstance*/, _In_ LPWSTR /*_lpCmdLine*/, _In_ int /*_nCmdShow*/ ) {
 	std::unique_ptr<lsn::CBusA> pbBus = std::make_unique<lsn::CBusA>();
@@ -16,6 +19,43 @@ int WINAPI wWinMain( _In_ HINSTANCE /*_hInstance*/, _In_opt_ HINSTANCE /*_hPrevI
 	std::unique_ptr<lsn::CRicoh5A22> pcCpu = std::make_unique<lsn::CRicoh5A22>( (*pbBus.get()) );
 	std::vector<uint8_t> vRam( 0x1000000 );
 	pbBus->SetMemory( vRam.data() );
+	{
+		// Bus access timing, before any test has watched pages or filled the log.
+		char szBench[64];
+		std::snprintf( szBench, std::size( szBench ), "%.3f ns per bus access\r\n", pbBus->BenchAccesses( 2000 ) );
+		::OutputDebugStringA( szBench );
+	}
+	if ( !pbBus->RunWideAccessTest() ) {
+		::OutputDebugStringA( "BUS FAIL\r\n" );
+	}
+	if ( !pbBus->RunDirtyPageTest() ) {
+		::OutputDebugStringA( "DIRTY PAGES FAIL\r\n" );
+	}
+	if ( !pcCpu->RunIdleLoopTest() ) {
+		::OutputDebugStringA( "IDLE LOOP FAIL\r\n" );
+	}
+	if ( !pcCpu->RunAotTest() ) {
+		::OutputDebugStringA( "AOT FAIL\r\n" );
+	}
+	if ( !lsn::CAotCompiler::RunInstrSizeTest() ) {
+		::OutputDebugStringA( "INSTR SIZE FAIL\r\n" );
+	}
+	{
+		// DMA and HDMA, wired to the CPU through CCpuIo.
+		std::unique_ptr<lsn::CSystem> psSystem = std::make_unique<lsn::CSystem>();
+		if ( !psSystem->RunDmaTest() ) {
+			::OutputDebugStringA( "DMA FAIL\r\n" );
+		}
+		if ( !psSystem->RunIrqTest() ) {
+			::OutputDebugStringA( "IRQ FAIL\r\n" );
+		}
+		if ( !psSystem->RunApuTest() ) {
+			::OutputDebugStringA( "APU PORTS FAIL\r\n" );
+		}
+	}
+	if ( !lsn::CScheduler::RunTest() ) {
+		::OutputDebugStringA( "SCHEDULER FAIL\r\n" );
+	}
 
 	auto pRoot = GetThisPath().remove_filename();
 	const std::filesystem::path pTests = std::filesystem::path( ".." ) / ".." / "Research" / "65816" / "v1";
@@ -54,6 +94,15 @@ int WINAPI wWinMain( _In_ HINSTANCE /*_hInstance*/, _In_opt_ HINSTANCE /*_hPrevI
 						::OutputDebugStringA( "JSON NOT FAIL\r\n" );
 						::OutputDebugStringW( wcFile );
 						::OutputDebugStringA( "\r\n" );
+
+						// Dispatch timing over the same vectors: the index table as the CPU runs it, then with the member-pointer run's
+						//	row lookup, then through the member-function pointers themselves.
+						char szBench[128];
+						std::snprintf( szBench, std::size( szBench ), "%.3f ns per cycle (index table), %.3f (tracked), %.3f (member pointers)\r\n",
+							pcCpu->BenchJsonTests( jSon, jvRoot, 64, lsn::CRicoh5A22::LSN_BD_INDEX_TABLE ),
+							pcCpu->BenchJsonTests( jSon, jvRoot, 64, lsn::CRicoh5A22::LSN_BD_INDEX_TABLE_TRACKED ),
+							pcCpu->BenchJsonTests( jSon, jvRoot, 64, lsn::CRicoh5A22::LSN_BD_MEMBER_POINTERS ) );
+						::OutputDebugStringA( szBench );
 					}
 				}
 			}
@@ -0,0 +1,118 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: Orders tickable components (5A22, PPU, SPC700, DSP, timers) against each other on a single integer timeline.
+ */
+
+
+#include "LSNScheduler.h"
+
+#include <cstdio>
+
+
+namespace lsn {
+
+#ifdef LSN_CPU_VERIFY
+	/**
+	 * Checks the timeline: a clock whose master cycle is a fraction of a timeline unit (the reduced ratio), RunFor() remainders carried
+	 *	across the rescale caused by adding a component, and RunUntil() giving up on a component that never advances while allowing
+	 *	one that stops in place to handle an event.
+	 *
+	 * \return Returns true if every check passes.
+	 */
+	bool CScheduler::RunTest() {
+		/** A component that counts master cycles, optionally stopping in place a number of times first. */
+		struct LSN_TEST_COMPONENT : public CTickable {
+			uint64_t								ui64Cycle = 0;						/**< The master cycle reached. */
+			uint32_t								ui32Calls = 0;						/**< The number of runs. */
+			uint32_t								ui32Stalls = 0;						/**< The number of runs left that stop in place (UINT32_MAX to never advance). */
+
+			static uint64_t LSN_FASTCALL			Run( void * _pvParm, uint64_t _ui64Cycle ) {
+				LSN_TEST_COMPONENT * ptcThis = static_cast<LSN_TEST_COMPONENT *>(_pvParm);
+				++ptcThis->ui32Calls;
+				if ( ptcThis->ui32Stalls ) {
+					if ( ptcThis->ui32Stalls != UINT32_MAX ) { --ptcThis->ui32Stalls; }
+					return ptcThis->ui64Cycle;
+				}
+				ptcThis->ui64Cycle = std::max( ptcThis->ui64Cycle, _ui64Cycle );
+				return ptcThis->ui64Cycle;
+			}
+		};
+		bool bRet = true;
+		auto Check = [&]( bool _bCond, const char * _pcName ) {
+			if ( !_bCond ) {
+				DebugA( "Scheduler: " );
+				DebugA( _pcName );
+				DebugA( "\r\n" );
+				bRet = false;
+			}
+		};
+		size_t sIdA, sIdB;
+
+		// == The reduced ratio.
+		{
+			// 6 / 4 Hz: a master cycle is 2/3 of a second, so the timeline needs 3 units per second and 2 per cycle.
+			LSN_TEST_COMPONENT tcA;
+			tcA.SetMasterClock( 6, 4 );
+			CScheduler sSched;
+			sSched.AddComponent( tcA, &LSN_TEST_COMPONENT::Run, &tcA, sIdA );
+			Check( sSched.UnitsPerSecond() == 3, "wrong units per second for 6 / 4 Hz." );
+			sSched.RunUntil( 10 );
+			Check( tcA.ui64Cycle == 5 && sSched.Cycles( sIdA ) == 5, "10 units are not 5 cycles at 6 / 4 Hz." );
+		}
+
+		// == RunFor() remainders across a rescale.
+		{
+			// Half a second at 1 unit per second is all remainder; adding a 7-Hz clock rescales it by 7.
+			LSN_TEST_COMPONENT tcA, tcB;
+			tcA.SetMasterClock( 1, 1 );
+			tcB.SetMasterClock( 7, 1 );
+			CScheduler sSched;
+			sSched.AddComponent( tcA, &LSN_TEST_COMPONENT::Run, &tcA, sIdA );
+			sSched.RunFor( 1, 2 );
+			Check( tcA.ui64Cycle == 0, "half a second at 1 Hz ran a cycle." );
+			sSched.AddComponent( tcB, &LSN_TEST_COMPONENT::Run, &tcB, sIdB );
+			sSched.RunFor( 1, 2 );
+			Check( sSched.UnitsPerSecond() == 7 && tcA.ui64Cycle == 1 && tcB.ui64Cycle == 7, "the half-second remainder was lost in the rescale." );
+			for ( uint32_t I = 0; I < 998; ++I ) { sSched.RunFor( 1, 2 ); }
+			Check( tcA.ui64Cycle == 500 && tcB.ui64Cycle == 3500, "500 seconds in halves drifted." );
+		}
+		{
+			// 2/3 of a unit is carried at 2 units per second; the rescale by 3 turns it into 2 whole units.
+			LSN_TEST_COMPONENT tcA, tcB;
+			tcA.SetMasterClock( 2, 1 );
+			tcB.SetMasterClock( 3, 1 );
+			CScheduler sSched;
+			sSched.AddComponent( tcA, &LSN_TEST_COMPONENT::Run, &tcA, sIdA );
+			sSched.RunFor( 1, 3 );
+			sSched.AddComponent( tcB, &LSN_TEST_COMPONENT::Run, &tcB, sIdB );
+			sSched.RunFor( 2, 3 );
+			Check( sSched.UnitsPerSecond() == 6 && tcA.ui64Cycle == 2 && tcB.ui64Cycle == 3, "the third-of-a-second remainder was lost in the rescale." );
+		}
+
+		// == The stall guard.
+		{
+			// Stopping in place to handle an event is allowed...
+			LSN_TEST_COMPONENT tcA;
+			tcA.SetMasterClock( 1, 1 );
+			tcA.ui32Stalls = LSN_S_MAX_STALLS - 1;
+			CScheduler sSched;
+			sSched.AddComponent( tcA, &LSN_TEST_COMPONENT::Run, &tcA, sIdA );
+			Check( sSched.RunUntil( 5 ) && tcA.ui64Cycle == 5, "a component that stopped in place was abandoned." );
+		}
+		{
+			// ...but a component that never advances ends the slice instead of hanging it.
+			LSN_TEST_COMPONENT tcA;
+			tcA.SetMasterClock( 1, 1 );
+			tcA.ui32Stalls = UINT32_MAX;
+			CScheduler sSched;
+			sSched.AddComponent( tcA, &LSN_TEST_COMPONENT::Run, &tcA, sIdA );
+			Check( !sSched.RunUntil( 5 ) && tcA.ui32Calls == LSN_S_MAX_STALLS, "a component that never advanced was not abandoned." );
+		}
+		return bRet;
+	}
+#endif	// #ifdef LSN_CPU_VERIFY
+
+}	// namespace lsn
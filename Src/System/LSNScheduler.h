@@ -0,0 +1,273 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: Orders tickable components (5A22, PPU, SPC700, DSP, timers) against each other on a single integer timeline.
+ */
+
+
+#pragma once
+
+#include "../LSNBirdSNES.h"
+#include "LSNTickable.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+
+namespace lsn {
+
+	/**
+	 * Class CScheduler
+	 * \brief Orders tickable components against each other on a single integer timeline.
+	 *
+	 * Description: Orders tickable components (5A22, PPU, SPC700, DSP, timers) against each other on a single integer timeline.  Each
+	 *	component keeps counting in master cycles of its own clock; the timeline's unit is the largest one in which a master cycle of every
+	 *	registered clock is a whole number of units (for NTSC plus the SPC700, 1 / 967,680,000,000 of a second: 45,056 units per 5A22
+	 *	master cycle and 39,375 per SPC700 master cycle), so converting between clocks is exact and never drifts.
+	 * The component furthest behind is always the one run, and it is allowed to run until the earliest next event of any other component
+	 *	(or the end of the time slice), so components that do not interact run in long uninterrupted bursts rather than in lock step.
+	 */
+	class CScheduler {
+	public :
+		// == Types.
+		/**
+		 * Runs a component until its clock reaches at least _ui64Cycle master cycles.  It may stop earlier to service one of its own events,
+		 *	but must either advance or handle the event, since it is called again at once if it is still the furthest behind.
+		 *
+		 * \param _pvParm The parameter passed to AddComponent().
+		 * \param _ui64Cycle The master cycle of the component's own clock at which to stop.
+		 * \return Returns the master cycle the component reached.
+		 **/
+		typedef uint64_t (LSN_FASTCALL *			PfRunUntil)( void * _pvParm, uint64_t _ui64Cycle );
+
+		/** A registered component. */
+		struct LSN_COMPONENT {
+			PfRunUntil								pfRun;								/**< The function that runs the component. */
+			void *									pvParm;								/**< The parameter passed to pfRun. */
+			uint64_t								ui64MasterClock;					/**< The component's master-clock speed. */
+			uint64_t								ui64MasterDiv;						/**< The component's master divisor. */
+			uint64_t								ui64UnitsPerCycle;					/**< Timeline units per master cycle of the component's clock. */
+			uint64_t								ui64Time;							/**< The component's position on the timeline. */
+			uint64_t								ui64NextEvent;						/**< The timeline position of the component's next event, or UINT64_MAX. */
+		};
+
+
+		// == Functions.
+		/**
+		 * Registers a component.  Components are normally all added at power-on; adding one later rescales the timeline, which is exact.
+		 *
+		 * \param _tTickable The component, whose MasterClock() and MasterDivisor() must both be non-zero.
+		 * \param _pfRun The function that runs the component.
+		 * \param _pvParm The parameter passed to _pfRun.
+		 * \param _sId Holds the component's ID on return.
+		 * \param _ui64Cycle The component's current master cycle.
+		 * \return Returns LSN_E_SUCCESS, LSN_E_INVALID_PARAMETER if the component has no clock or _pfRun is nullptr, or LSN_E_OUT_OF_MEMORY.
+		 **/
+		LSN_ERRORS									AddComponent( const CTickable &_tTickable, PfRunUntil _pfRun, void * _pvParm, size_t &_sId,
+			uint64_t _ui64Cycle = 0 ) {
+			if ( !_pfRun || !_tTickable.MasterClock() || !_tTickable.MasterDivisor() ) { return LSN_E_INVALID_PARAMETER; }
+
+			// A master cycle lasts Div / Clock seconds, which is a whole number of units when the units per second are a multiple of
+			//	Clock / gcd( Clock, Div ).
+			const uint64_t ui64Gcd = std::gcd( _tTickable.MasterClock(), _tTickable.MasterDivisor() );
+			const uint64_t ui64Need = _tTickable.MasterClock() / ui64Gcd;
+			const uint64_t ui64Units = m_vComponents.size() ? std::lcm( m_ui64UnitsPerSecond, ui64Need ) : ui64Need;
+			try {
+				m_vComponents.push_back( { _pfRun, _pvParm, _tTickable.MasterClock(), _tTickable.MasterDivisor(), 0, 0, UINT64_MAX } );
+			}
+			catch ( ... ) { return LSN_E_OUT_OF_MEMORY; }
+			if ( m_vComponents.size() > 1 && ui64Units != m_ui64UnitsPerSecond ) {
+				Rescale( ui64Units / m_ui64UnitsPerSecond );
+			}
+			m_ui64UnitsPerSecond = ui64Units;
+
+			LSN_COMPONENT & cComponent = m_vComponents.back();
+			// Only Clock / gcd is guaranteed to divide the units per second, so the reduced ratio has to be used.
+			cComponent.ui64UnitsPerCycle = m_ui64UnitsPerSecond / ui64Need * (cComponent.ui64MasterDiv / ui64Gcd);
+			cComponent.ui64Time = _ui64Cycle * cComponent.ui64UnitsPerCycle;
+			_sId = m_vComponents.size() - 1;
+			return LSN_E_SUCCESS;
+		}
+
+		/**
+		 * Sets a component's next event: the earliest time at which it may affect another component.  Other components are not run past
+		 *	it until this component has caught up to it.
+		 *
+		 * \param _sId The component's ID.
+		 * \param _ui64Cycle The master cycle of the component's own clock at which the event occurs.
+		 **/
+		inline void									SetNextEvent( size_t _sId, uint64_t _ui64Cycle ) {
+			LSN_COMPONENT & cComponent = m_vComponents[_sId];
+			cComponent.ui64NextEvent = (_ui64Cycle >= UINT64_MAX / cComponent.ui64UnitsPerCycle) ? UINT64_MAX : _ui64Cycle * cComponent.ui64UnitsPerCycle;
+		}
+
+		/**
+		 * Removes a component's next event.
+		 *
+		 * \param _sId The component's ID.
+		 **/
+		inline void									ClearNextEvent( size_t _sId ) { m_vComponents[_sId].ui64NextEvent = UINT64_MAX; }
+
+		/**
+		 * Gets a component's position in master cycles of its own clock.
+		 *
+		 * \param _sId The component's ID.
+		 * \return Returns the last master cycle the component reported.
+		 **/
+		inline uint64_t								Cycles( size_t _sId ) const { return m_vComponents[_sId].ui64Time / m_vComponents[_sId].ui64UnitsPerCycle; }
+
+		/**
+		 * Converts a position on the timeline to master cycles of a component's clock, rounding up so that a component run to the result
+		 *	is never behind the given time.
+		 *
+		 * \param _sId The component's ID.
+		 * \param _ui64Time The position on the timeline.
+		 * \return Returns the first master cycle of the component at or after _ui64Time.
+		 **/
+		inline uint64_t								ToCycles( size_t _sId, uint64_t _ui64Time ) const {
+			const uint64_t ui64Units = m_vComponents[_sId].ui64UnitsPerCycle;
+			return _ui64Time / ui64Units + ((_ui64Time % ui64Units) ? 1 : 0);
+		}
+
+		/**
+		 * Gets the position of the component furthest behind: everything before it has been emulated by every component.
+		 *
+		 * \return Returns the earliest component position on the timeline.
+		 **/
+		inline uint64_t								Now() const {
+			uint64_t ui64Now = UINT64_MAX;
+			for ( const auto & cComponent : m_vComponents ) { ui64Now = std::min( ui64Now, cComponent.ui64Time ); }
+			return m_vComponents.size() ? ui64Now : 0;
+		}
+
+		/**
+		 * Gets the number of timeline units in 1 second.
+		 *
+		 * \return Returns the timeline resolution.
+		 **/
+		inline uint64_t								UnitsPerSecond() const { return m_ui64UnitsPerSecond; }
+
+		/**
+		 * Runs every component until it reaches a position on the timeline.  A component may return without advancing (to handle an
+		 *	event), but after LSN_S_MAX_STALLS such runs in a row the slice is abandoned rather than hanging.
+		 *
+		 * \param _ui64Time The position on the timeline to reach.
+		 * \return Returns false if a component stopped advancing before the slice was finished.
+		 **/
+		bool										RunUntil( uint64_t _ui64Time ) {
+			if ( m_vComponents.empty() ) { return true; }
+			m_ui64Target = std::max( m_ui64Target, _ui64Time );
+			uint32_t ui32Stalls = 0;
+			while ( true ) {
+				// The component furthest behind runs; ties go to the first registered.
+				size_t sRun = 0;
+				for ( size_t I = 1; I < m_vComponents.size(); ++I ) {
+					if ( m_vComponents[I].ui64Time < m_vComponents[sRun].ui64Time ) { sRun = I; }
+				}
+				LSN_COMPONENT & cComponent = m_vComponents[sRun];
+				if ( cComponent.ui64Time >= _ui64Time ) { return true; }
+
+				// It can run until another component's next event needs to see it, or to the end of the slice.
+				uint64_t ui64Limit = _ui64Time;
+				for ( size_t I = 0; I < m_vComponents.size(); ++I ) {
+					if ( I != sRun ) { ui64Limit = std::min( ui64Limit, std::max( m_vComponents[I].ui64NextEvent, m_vComponents[I].ui64Time ) ); }
+				}
+				// Always allow at least 1 master cycle so that components at the same time take turns.
+				const uint64_t ui64Stop = std::max( ToCycles( sRun, ui64Limit ), cComponent.ui64Time / cComponent.ui64UnitsPerCycle + 1 );
+				const uint64_t ui64Time = cComponent.pfRun( cComponent.pvParm, ui64Stop ) * cComponent.ui64UnitsPerCycle;
+				assert( ui64Time >= cComponent.ui64Time );
+				if LSN_UNLIKELY( ui64Time <= cComponent.ui64Time ) {
+					// Stopping in place to handle an event is allowed, but a component that never advances would hang the loop.
+					if LSN_UNLIKELY( ++ui32Stalls >= LSN_S_MAX_STALLS ) { return false; }
+				}
+				else {
+					cComponent.ui64Time = ui64Time;
+					ui32Stalls = 0;
+				}
+			}
+		}
+
+		/**
+		 * Runs every component for an amount of real time.  The conversion follows the integer formula in LSN_CLOCK_SPEEDS,
+		 *	ELAPSED_TIME * UNITS_PER_SECOND / ELAPSED_TIME_RESOLUTION, and carries the remainder into the next call so that no time is lost
+		 *	between slices.
+		 *
+		 * \param _ui64Elapsed The elapsed time, in units of 1 / _ui64Resolution seconds.
+		 * \param _ui64Resolution The resolution of _ui64Elapsed (1000000 for microseconds, etc.)
+		 * \return Returns false if a component stopped advancing before the slice was finished (see RunUntil()).
+		 **/
+		bool										RunFor( uint64_t _ui64Elapsed, uint64_t _ui64Resolution ) {
+			assert( _ui64Resolution );
+			if ( _ui64Resolution != m_ui64RemainderResolution ) {
+				m_ui64RemainderResolution = _ui64Resolution;
+				m_ui64Remainder = 0;
+			}
+			// Reduce first: the common resolutions divide the timeline resolution, leaving no remainder at all.
+			const uint64_t ui64Gcd = std::gcd( m_ui64UnitsPerSecond, _ui64Resolution );
+			const uint64_t ui64Units = m_ui64UnitsPerSecond / ui64Gcd;
+			const uint64_t ui64Res = _ui64Resolution / ui64Gcd;
+			const uint64_t ui64Frac = (_ui64Elapsed % ui64Res) * ui64Units + m_ui64Remainder;
+			m_ui64Remainder = ui64Frac % ui64Res;
+			return RunUntil( m_ui64Target + (_ui64Elapsed / ui64Res) * ui64Units + ui64Frac / ui64Res );
+		}
+
+#ifdef LSN_CPU_VERIFY
+		/**
+		 * Checks the timeline: a clock whose master cycle is a fraction of a timeline unit (the reduced ratio), RunFor() remainders carried
+		 *	across the rescale caused by adding a component, and RunUntil() giving up on a component that never advances while allowing
+		 *	one that stops in place to handle an event.
+		 *
+		 * \return Returns true if every check passes.
+		 */
+		static bool									RunTest();
+#endif	// #ifdef LSN_CPU_VERIFY
+
+
+	protected :
+		// == Enumerations.
+		/** Scheduler limits. */
+		enum LSN_SCHEDULER : uint32_t {
+			LSN_S_MAX_STALLS						= 64,								/**< Consecutive runs without progress after which RunUntil() gives up. */
+		};
+
+
+		// == Members.
+		std::vector<LSN_COMPONENT>					m_vComponents;						/**< The registered components. */
+		uint64_t									m_ui64UnitsPerSecond = 1;			/**< The timeline resolution. */
+		uint64_t									m_ui64Target = 0;					/**< The end of the last slice. */
+		uint64_t									m_ui64Remainder = 0;				/**< The fraction of a unit carried between RunFor() calls, in units of 1 / (m_ui64RemainderResolution / gcd( m_ui64UnitsPerSecond, m_ui64RemainderResolution )). */
+		uint64_t									m_ui64RemainderResolution = 0;		/**< The resolution of m_ui64Remainder. */
+
+
+		// == Functions.
+		/**
+		 * Multiplies every timeline position by a factor after the timeline resolution grows.  Must be called before m_ui64UnitsPerSecond
+		 *	is updated.  The RunFor() remainder is converted to the new resolution; any whole units it now holds are added to the target.
+		 *
+		 * \param _ui64Factor The factor.
+		 **/
+		void										Rescale( uint64_t _ui64Factor ) {
+			for ( auto & cComponent : m_vComponents ) {
+				cComponent.ui64UnitsPerCycle *= _ui64Factor;
+				cComponent.ui64Time *= _ui64Factor;
+				if ( cComponent.ui64NextEvent != UINT64_MAX ) { cComponent.ui64NextEvent *= _ui64Factor; }
+			}
+			m_ui64Target *= _ui64Factor;
+			if ( m_ui64RemainderResolution ) {
+				// The remainder is in units of 1 / (Resolution / gcd( UnitsPerSecond, Resolution )) of a timeline unit.  The new denominator
+				//	divides the old one and the scaled fraction is always a multiple of their ratio, so the conversion is exact.
+				const uint64_t ui64OldRes = m_ui64RemainderResolution / std::gcd( m_ui64UnitsPerSecond, m_ui64RemainderResolution );
+				const uint64_t ui64NewRes = m_ui64RemainderResolution / std::gcd( m_ui64UnitsPerSecond * _ui64Factor, m_ui64RemainderResolution );
+				const uint64_t ui64Frac = m_ui64Remainder * _ui64Factor;
+				m_ui64Target += ui64Frac / ui64OldRes;
+				m_ui64Remainder = (ui64Frac % ui64OldRes) / (ui64OldRes / ui64NewRes);
+			}
+		}
+	};
+
+}	// namespace lsn
@@ -0,0 +1,776 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: The parts of the console driven by the CPU's clock, wired together: Bus A, Bus B, the 5A22, its I/O page, DMA/HDMA, and
+ *	the APU ports.
+ */
+
+
+#include "LSNSystem.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+
+namespace lsn {
+
+	CSystem::CSystem( std::shared_ptr<const CMemoryMap> _pmmMap ) :
+		m_vMemory( 0x1000000 ),
+		m_baBusA( _pmmMap ? _pmmMap : IoMap() ),
+		m_rCpu( m_baBusA ),
+		m_dDma( m_rCpu, m_baBusA, m_bbBusB ),
+		m_cioIo( m_rCpu, m_baBusA, m_dDma ),
+		m_apApu( m_rCpu ) {
+		m_baBusA.SetMemory( m_vMemory.data() );
+		SetMemoryMap( m_baBusA.MemoryMap() );
+		Reset();
+	}
+
+	// == Functions.
+	/**
+	 * Resets the CPU, the I/O page, the DMA channels, and the APU ports.  The frame and the APU ports' conversion start at the CPU's
+	 *	(reset) master cycle.
+	 **/
+	void CSystem::Reset() {
+		m_rCpu.Reset<true>();
+		m_dDma.Reset();
+		m_cioIo.Reset();
+		m_apApu.Reset();
+	}
+
+	/**
+	 * Sets the memory map used by Bus A (normally CCartridge::MemoryMap()), attaches Bus B, the I/O page, and the DMA registers
+	 *	to it, and attaches the APU ports to Bus B.  The map must route $2100-$21FF, $4200-$42FF, and $4300-$43FF through CBusB::ApplyMapping(), CCpuIo::ApplyMapping(),
+	 *	and CDma::ApplyMapping().
+	 *
+	 * \param _pmmMap The memory map.
+	 **/
+	void CSystem::SetMemoryMap( std::shared_ptr<const CMemoryMap> _pmmMap ) {
+		m_baBusA.SetMemoryMap( std::move( _pmmMap ) );
+		m_bbBusB.Attach( m_baBusA );
+		m_dDma.Attach();
+		m_cioIo.Attach();
+		m_apApu.Attach( m_bbBusB );
+	}
+
+	/**
+	 * Runs the CPU until its master clock reaches _ui64MasterClock, servicing DMA, HDMA, NMI, and IRQ at each event deadline on
+	 *	the way.  The last instruction (or DMA) may end past the target.
+	 *
+	 * \param _ui64MasterClock The master-clock value at which to stop.
+	 * \return Returns the number of CPU cycles run.
+	 **/
+	uint64_t CSystem::RunUntil( uint64_t _ui64MasterClock ) {
+		uint64_t ui64Cycles = 0;
+		while ( m_rCpu.GetMasterCycles() < _ui64MasterClock ) {
+			if ( m_rCpu.GetMasterCycles() >= m_rCpu.NextEventDeadline() ) {
+				// Service() always moves every deadline it owns past the current cycle.
+				m_cioIo.Service();
+				continue;
+			}
+			ui64Cycles += (m_rCpu.*m_pfEngine)( _ui64MasterClock );
+		}
+		return ui64Cycles;
+	}
+
+	/**
+	 * Builds a memory map with plain memory everywhere except Bus B, the CPU's I/O page, and the DMA registers, for use without a
+	 *	cartridge.
+	 *
+	 * \return Returns the new map.
+	 **/
+	std::shared_ptr<const CMemoryMap> CSystem::IoMap() {
+		std::shared_ptr<CMemoryMap> pmmMap = std::make_shared<CMemoryMap>();
+		CBusB::ApplyMapping( (*pmmMap) );
+		CCpuIo::ApplyMapping( (*pmmMap) );
+		CDma::ApplyMapping( (*pmmMap) );
+		return pmmMap;
+	}
+
+#ifdef LSN_CPU_VERIFY
+	/**
+	 * Checks general DMA and HDMA: the block copy against the byte-by-byte path and against each transfer mode's register pattern,
+	 *	the stall after general DMA from every alignment of the start, a transfer started by the CPU's own write to $420B through
+	 *	each engine, and the lines and stalls of repeated and indirect HDMA tables.  Leaves the system reset.
+	 *
+	 * \return Returns true if every check passes.
+	 */
+	bool CSystem::RunDmaTest() {
+		// The B-bus register offsets of each transfer mode, spelled out rather than taken from CDma.
+		static const uint8_t ui8Patterns[8][4] = {
+			{ 0, 0, 0, 0 }, { 0, 1, 0, 1 }, { 0, 0, 0, 0 }, { 0, 0, 1, 1 },
+			{ 0, 1, 2, 3 }, { 0, 1, 0, 1 }, { 0, 0, 0, 0 }, { 0, 0, 1, 1 },
+		};
+		static const uint8_t ui8Steps[] = { 0, CDma::LSN_DMAP_FIXED, CDma::LSN_DMAP_DECREMENT };
+		static const uint16_t ui16Sizes[] = { 1, 9, 0x1F3 };
+		// The source wraps within its bank on the larger transfers.
+		const uint8_t ui8SrcBank = 0x7E;
+		const uint16_t ui16SrcAddr = 0xFF80;
+		const std::shared_ptr<const CMemoryMap> pmmMap = m_baBusA.MemoryMap();
+
+		LSN_DMA_TEST_PORT dtpPort;
+		dtpPort.prCpu = &m_rCpu;
+		dtpPort.ui32Spans = 0;
+		dtpPort.ui8Next = 0;
+		for ( uint8_t I = 0x18; I <= 0x1B; ++I ) {
+			m_bbBusB.SetRegister( I, &CSystem::DmaTestPortRead, &CSystem::DmaTestPortWrite, nullptr, &dtpPort, &CSystem::DmaTestPortWriteSpan );
+		}
+		for ( uint32_t I = 0; I < 0x10000; ++I ) {
+			m_vMemory[(uint32_t( ui8SrcBank )<<16)|I] = uint8_t( I * 7 + 3 );
+		}
+
+		bool bRet = true;
+		uint8_t ui8Speed;
+		auto SetChannel = [&]( uint8_t _ui8Channel, uint8_t _ui8Params, uint8_t _ui8BReg, uint8_t _ui8Bank, uint16_t _ui16Addr, uint16_t _ui16Count ) {
+			const uint16_t ui16Base = uint16_t( 0x4300 | (_ui8Channel << 4) );
+			m_baBusA.Write( ui16Base | 0x0, 0, _ui8Params, ui8Speed );
+			m_baBusA.Write( ui16Base | 0x1, 0, _ui8BReg, ui8Speed );
+			m_baBusA.Write( ui16Base | 0x2, 0, uint8_t( _ui16Addr ), ui8Speed );
+			m_baBusA.Write( ui16Base | 0x3, 0, uint8_t( _ui16Addr >> 8 ), ui8Speed );
+			m_baBusA.Write( ui16Base | 0x4, 0, _ui8Bank, ui8Speed );
+			m_baBusA.Write( ui16Base | 0x5, 0, uint8_t( _ui16Count ), ui8Speed );
+			m_baBusA.Write( ui16Base | 0x6, 0, uint8_t( _ui16Count >> 8 ), ui8Speed );
+		};
+		// The stall of a general DMA on 1 channel starting at a given master cycle.
+		auto ExpectedStall = [&]( uint64_t _ui64Start, uint32_t _ui32Bytes ) {
+			const uint64_t ui64Raw = ((8 - (_ui64Start & 7)) & 7) + 8 + 8 + 8 * uint64_t( _ui32Bytes );
+			return (ui64Raw + m_rCpu.Divisor() - 1) / m_rCpu.Divisor() * m_rCpu.Divisor();
+		};
+		auto ExpectedHdmaStall = [&]( uint64_t _ui64Raw ) {
+			return (_ui64Raw + m_rCpu.Divisor() - 1) / m_rCpu.Divisor() * m_rCpu.Divisor();
+		};
+
+		// == Block copy vs. byte by byte, A to B, in every mode and step.
+		Reset();
+		for ( uint8_t ui8Mode = 0; ui8Mode < 8; ++ui8Mode ) {
+			for ( size_t S = 0; S < std::size( ui8Steps ); ++S ) {
+				for ( size_t Z = 0; Z < std::size( ui16Sizes ); ++Z ) {
+					std::vector<LSN_DMA_TEST_ACCESS> vAccesses[2];
+					uint16_t ui16EndAddr[2];
+					for ( uint32_t ui32Path = 0; ui32Path < 2; ++ui32Path ) {
+						if ( ui32Path == 1 ) {
+							// A parameter makes the page's reader something other than plain memory, so DMA cannot copy it as a block.
+							m_baBusA.SetAccessor( uint16_t( (ui8SrcBank << 8) | (ui16SrcAddr >> 8) ), &CMemoryMap::StdRead, this,
+								&CMemoryMap::StdWrite, this, &CMemoryMap::StdDebugRead, &CMemoryMap::StdDebugWrite );
+						}
+						dtpPort.vAccesses.clear();
+						dtpPort.ui32Spans = 0;
+						SetChannel( 0, uint8_t( ui8Mode | ui8Steps[S] ), 0x18, ui8SrcBank, ui16SrcAddr, ui16Sizes[Z] );
+						m_baBusA.Write( 0x420B, 0, 0x01, ui8Speed );
+						if ( m_rCpu.NextEventDeadline() != m_rCpu.GetMasterCycles() ) {
+							DebugA( "DMA: writing $420B did not register a deadline.\r\n" );
+							bRet = false;
+						}
+						const uint64_t ui64Start = m_rCpu.GetMasterCycles();
+						const uint64_t ui64Stall = m_dDma.RunDma();
+						if ( ui64Stall != ExpectedStall( ui64Start, ui16Sizes[Z] ) || m_rCpu.GetMasterCycles() != ui64Start + ui64Stall ) {
+							char szBuffer[128];
+							std::snprintf( szBuffer, std::size( szBuffer ), "DMA: mode %u step %.2X size %u: stall %llu from %llu.\r\n",
+								ui8Mode, ui8Steps[S], ui16Sizes[Z], static_cast<unsigned long long>(ui64Stall), static_cast<unsigned long long>(ui64Start) );
+							DebugA( szBuffer );
+							bRet = false;
+						}
+						if ( m_dDma.Channel( 0 ).ui16Count != 0 ) {
+							DebugA( "DMA: the count did not reach 0.\r\n" );
+							bRet = false;
+						}
+						// Decrementing transfers always go byte by byte.
+						const uint32_t ui32Spans = (ui32Path == 0 && !(ui8Steps[S] & CDma::LSN_DMAP_DECREMENT)) ? 1 : 0;
+						if ( dtpPort.ui32Spans != ui32Spans ) {
+							DebugA( ui32Path == 0 ? "DMA: the block copy was not used.\r\n" : "DMA: the block copy was used on a non-memory page.\r\n" );
+							bRet = false;
+						}
+						vAccesses[ui32Path] = dtpPort.vAccesses;
+						ui16EndAddr[ui32Path] = m_dDma.Channel( 0 ).ui16AAddress;
+						SetMemoryMap( pmmMap );
+					}
+
+					// Both paths must match each other (apart from the time stamps, which follow each run's start) and the pattern.
+					const int32_t i32Step = (ui8Steps[S] & CDma::LSN_DMAP_FIXED) ? 0 : ((ui8Steps[S] & CDma::LSN_DMAP_DECREMENT) ? -1 : 1);
+					bool bMatch = vAccesses[0].size() == ui16Sizes[Z] && vAccesses[1].size() == ui16Sizes[Z] && ui16EndAddr[0] == ui16EndAddr[1] &&
+						ui16EndAddr[0] == uint16_t( ui16SrcAddr + i32Step * ui16Sizes[Z] );
+					for ( size_t I = 0; bMatch && I < ui16Sizes[Z]; ++I ) {
+						const uint16_t ui16Addr = uint16_t( ui16SrcAddr + i32Step * int32_t( I ) );
+						const uint8_t ui8Reg = uint8_t( 0x18 + ui8Patterns[ui8Mode][I&3] );
+						const uint8_t ui8Val = m_vMemory[(uint32_t( ui8SrcBank )<<16)|ui16Addr];
+						for ( uint32_t ui32Path = 0; ui32Path < 2; ++ui32Path ) {
+							const LSN_DMA_TEST_ACCESS & dtaThis = vAccesses[ui32Path][I];
+							bMatch = bMatch && !dtaThis.bRead && dtaThis.ui8Reg == ui8Reg && dtaThis.ui8Val == ui8Val;
+						}
+					}
+					if ( !bMatch ) {
+						char szBuffer[128];
+						std::snprintf( szBuffer, std::size( szBuffer ), "DMA: mode %u step %.2X size %u: the transfers differ.\r\n",
+							ui8Mode, ui8Steps[S], ui16Sizes[Z] );
+						DebugA( szBuffer );
+						bRet = false;
+					}
+				}
+			}
+		}
+
+		// == B to A.
+		{
+			dtpPort.vAccesses.clear();
+			dtpPort.ui8Next = 0x40;
+			SetChannel( 1, uint8_t( CDma::LSN_DMAP_B_TO_A | 1 ), 0x18, 0x7F, 0x2000, 9 );
+			m_baBusA.Write( 0x420B, 0, 0x02, ui8Speed );
+			m_dDma.RunDma();
+			bool bMatch = dtpPort.vAccesses.size() == 9 && m_dDma.Channel( 1 ).ui16AAddress == 0x2009;
+			for ( size_t I = 0; bMatch && I < 9; ++I ) {
+				bMatch = dtpPort.vAccesses[I].bRead && dtpPort.vAccesses[I].ui8Reg == uint8_t( 0x18 + (I & 1) ) &&
+					m_vMemory[0x7F2000+I] == uint8_t( 0x40 + I );
+			}
+			if ( !bMatch ) {
+				DebugA( "DMA: B to A failed.\r\n" );
+				bRet = false;
+			}
+		}
+
+		// == The stall from each alignment of the start.
+		{
+			// After a cycle on a fast page the CPU stalls in steps of 6 master cycles, which walk the start through every even
+			//	alignment (every CPU speed is even, so the odd ones cannot occur).
+			Reset();
+			// Programs are written through Bus A so that decodes and blocks the fast engines cached from an earlier test are dropped.
+			uint8_t ui8Nops[0x100];
+			std::memset( ui8Nops, 0xEA, sizeof( ui8Nops ) );
+			m_baBusA.WriteSpan( 0x3000, 0x00, ui8Nops, sizeof( ui8Nops ) );
+			CRicoh5A22::LSN_REGISTERS rRegs;
+			std::memset( &rRegs, 0, sizeof( rRegs ) );
+			rRegs.ui16Pc = 0x3000;
+			rRegs.ui16S = 0x01FF;
+			rRegs.ui8Status = 0x34;
+			m_rCpu.SetRegisters( rRegs, true );
+			m_rCpu.RunCycles( 2 );
+			for ( uint32_t I = 0; I < 8; I += 2 ) {
+				for ( uint32_t J = 0; J < 4 && (m_rCpu.GetMasterCycles() & 7) != I; ++J ) {
+					m_rCpu.Stall( 1 );
+				}
+				SetChannel( 0, 0, 0x18, ui8SrcBank, 0x1000, 9 );
+				m_baBusA.Write( 0x420B, 0, 0x01, ui8Speed );
+				const uint64_t ui64Start = m_rCpu.GetMasterCycles();
+				const uint64_t ui64Stall = m_dDma.RunDma();
+				if ( (ui64Start & 7) != I || ui64Stall != ExpectedStall( ui64Start, 9 ) ) {
+					char szBuffer[128];
+					std::snprintf( szBuffer, std::size( szBuffer ), "DMA: stall %llu from %llu (speed %u).\r\n",
+						static_cast<unsigned long long>(ui64Stall), static_cast<unsigned long long>(ui64Start), m_rCpu.Divisor() );
+					DebugA( szBuffer );
+					bRet = false;
+				}
+			}
+		}
+
+		// == Started by the CPU's own write, through each engine.
+		{
+			static const PfEngine pfEngines[] = {
+				&CRicoh5A22::RunUntilMasterClock,
+				&CRicoh5A22::RunInstructions,
+#if LSN_CPU_JIT
+				&CRicoh5A22::RunJit,
+#endif	// #if LSN_CPU_JIT
+			};
+			std::vector<LSN_DMA_TEST_ACCESS> vReference;
+			for ( size_t E = 0; E < std::size( pfEngines ); ++E ) {
+				Reset();
+				dtpPort.vAccesses.clear();
+				SetChannel( 0, 1, 0x18, ui8SrcBank, ui16SrcAddr, 0x1F3 );
+				SetDmaTestRegisters( 0x01 );
+				SetEngine( pfEngines[E] );
+				RunUntil( 4000 );
+				SetEngine( &CRicoh5A22::RunInstructions );
+				if ( E == 0 ) {
+					vReference = dtpPort.vAccesses;
+					if ( vReference.size() != 0x1F3 || m_dDma.Channel( 0 ).ui16Count != 0 ) {
+						DebugA( "DMA: the CPU's write to $420B did not start the transfer.\r\n" );
+						bRet = false;
+					}
+				}
+				else if ( !(dtpPort.vAccesses == vReference) ) {
+					char szBuffer[128];
+					std::snprintf( szBuffer, std::size( szBuffer ), "DMA: engine %u started the transfer differently.\r\n", uint32_t( E ) );
+					DebugA( szBuffer );
+					bRet = false;
+				}
+			}
+		}
+
+		// == HDMA.
+		// Channel 1: direct, mode 0: 1 line of $AA, 2 idle lines, then $BB and $CC on 2 repeated lines.
+		static const uint8_t ui8Table1[] = { 0x03, 0xAA, 0x82, 0xBB, 0xCC, 0x00 };
+		// Channel 2: indirect, mode 1: 2 repeated lines from $7E:1200, then 1 line from $7E:1210.
+		static const uint8_t ui8Table2[] = { 0x82, 0x00, 0x12, 0x01, 0x10, 0x12, 0x00 };
+		static const uint8_t ui8Data2[] = { 0x11, 0x22, 0x33, 0x44 };
+		static const uint8_t ui8Data2b[] = { 0x55, 0x66 };
+		struct LSN_HDMA_WRITE {
+			uint32_t									ui32Line;
+			uint8_t										ui8Reg;
+			uint8_t										ui8Val;
+		};
+		static const LSN_HDMA_WRITE hwExpected[] = {
+			{ 0, 0x18, 0xAA }, { 0, 0x1A, 0x11 }, { 0, 0x1B, 0x22 },
+			{ 1, 0x1A, 0x33 }, { 1, 0x1B, 0x44 },
+			{ 2, 0x1A, 0x55 }, { 2, 0x1B, 0x66 },
+			{ 3, 0x18, 0xBB },
+			{ 4, 0x18, 0xCC },
+		};
+		// Raw stalls: the frame initialization, then lines 0-5.
+		static const uint64_t ui64HdmaStalls[] = { 50, 58, 74, 82, 34, 42, 0 };
+		std::memcpy( &m_vMemory[0x7E1000], ui8Table1, sizeof( ui8Table1 ) );
+		std::memcpy( &m_vMemory[0x7E1100], ui8Table2, sizeof( ui8Table2 ) );
+		std::memcpy( &m_vMemory[0x7E1200], ui8Data2, sizeof( ui8Data2 ) );
+		std::memcpy( &m_vMemory[0x7E1210], ui8Data2b, sizeof( ui8Data2b ) );
+		auto SetHdmaChannels = [&]() {
+			SetChannel( 1, 0, 0x18, 0x7E, 0x1000, 0 );
+			SetChannel( 2, uint8_t( CDma::LSN_DMAP_INDIRECT | 1 ), 0x1A, 0x7E, 0x1100, 0 );
+			m_baBusA.Write( 0x4327, 0, 0x7E, ui8Speed );
+		};
+		auto CheckHdmaWrites = [&]( const std::vector<LSN_DMA_TEST_ACCESS> &_vAccesses, size_t _sStart, uint64_t _ui64Frame, const char * _pcName ) {
+			bool bMatch = _vAccesses.size() >= _sStart + std::size( hwExpected );
+			for ( size_t I = 0; bMatch && I < std::size( hwExpected ); ++I ) {
+				const LSN_DMA_TEST_ACCESS & dtaThis = _vAccesses[_sStart+I];
+				const uint64_t ui64Line = (dtaThis.ui64Cycle - _ui64Frame) / CCpuIo::LSN_T_MASTER_PER_LINE;
+				bMatch = !dtaThis.bRead && ui64Line == hwExpected[I].ui32Line && dtaThis.ui8Reg == hwExpected[I].ui8Reg &&
+					dtaThis.ui8Val == hwExpected[I].ui8Val;
+			}
+			if ( !bMatch ) {
+				char szBuffer[128];
+				std::snprintf( szBuffer, std::size( szBuffer ), "HDMA: %s: wrong writes.\r\n", _pcName );
+				DebugA( szBuffer );
+			}
+			return bMatch;
+		};
+
+		// Called directly, 1 line at a time.
+		{
+			Reset();
+			dtpPort.vAccesses.clear();
+			SetHdmaChannels();
+			m_dDma.WriteHdmaEn( 0x06 );
+			const uint64_t ui64Frame = m_rCpu.GetMasterCycles();
+			bool bStalls = m_dDma.InitHdma() == ExpectedHdmaStall( ui64HdmaStalls[0] );
+			for ( size_t I = 1; I < std::size( ui64HdmaStalls ); ++I ) {
+				// Each line is stamped with its own line of a frame starting at ui64Frame.
+				const uint64_t ui64Line = ui64Frame + (I - 1) * CCpuIo::LSN_T_MASTER_PER_LINE;
+				m_rCpu.Stall( ui64Line - std::min( ui64Line, m_rCpu.GetMasterCycles() ) );
+				bStalls = bStalls && m_dDma.RunHdma() == ExpectedHdmaStall( ui64HdmaStalls[I] );
+			}
+			if ( !bStalls ) {
+				DebugA( "HDMA: wrong stalls.\r\n" );
+				bRet = false;
+			}
+			bRet = CheckHdmaWrites( dtpPort.vAccesses, 0, ui64Frame, "direct" ) && bRet;
+			if ( dtpPort.vAccesses.size() != std::size( hwExpected ) || m_dDma.HdmaActive() ) {
+				DebugA( "HDMA: the tables did not end.\r\n" );
+				bRet = false;
+			}
+		}
+
+		// Scheduled by CCpuIo and run by RunUntil() around a running CPU, for 2 frames.
+		{
+			Reset();
+			dtpPort.vAccesses.clear();
+			SetHdmaChannels();
+			SetDmaTestRegisters( 0x00 );
+			// Start at the BRA instead of the STA.
+			CRicoh5A22::LSN_REGISTERS rRegs = m_rCpu.Registers();
+			rRegs.ui16Pc = 0x8002;
+			m_rCpu.SetRegisters( rRegs, true );
+			m_baBusA.Write( 0x420C, 0, 0x06, ui8Speed );
+			const uint64_t ui64Frame = m_cioIo.FrameStart( m_rCpu.GetMasterCycles() );
+			RunUntil( ui64Frame + m_cioIo.FrameLength() * 2 );
+			bRet = CheckHdmaWrites( dtpPort.vAccesses, 0, ui64Frame, "frame 0" ) && bRet;
+			bRet = CheckHdmaWrites( dtpPort.vAccesses, std::size( hwExpected ), ui64Frame + m_cioIo.FrameLength(), "frame 1" ) && bRet;
+			if ( dtpPort.vAccesses.size() != std::size( hwExpected ) * 2 ) {
+				DebugA( "HDMA: wrong number of writes over 2 frames.\r\n" );
+				bRet = false;
+			}
+		}
+
+		m_bbBusB.ResetRegisters();
+		m_apApu.Attach( m_bbBusB );
+		SetMemoryMap( pmmMap );
+		Reset();
+		return bRet;
+	}
+
+	/**
+	 * Checks NMI and the H/V-timer IRQ: the deadlines CCpuIo computes from NMITIMEN, HTIME, and VTIME against a cycle-by-cycle
+	 *	search of the beam position, and, through each engine, an IRQ held off by the I flag until CLI while NMI is taken regardless.
+	 *	Leaves the system reset.
+	 *
+	 * \return Returns true if every check passes.
+	 */
+	bool CSystem::RunIrqTest() {
+		struct LSN_TIMER_CASE {
+			uint8_t										ui8NmiTimEn;
+			uint16_t									ui16HTime;
+			uint16_t									ui16VTime;
+		};
+		static const LSN_TIMER_CASE tcCases[] = {
+			{ 0x10, 100, 0 }, { 0x10, 0, 0 }, { 0x10, 339, 0 }, { 0x10, 340, 0 },
+			{ 0x20, 0, 10 }, { 0x20, 0, 261 }, { 0x20, 0, 262 },
+			{ 0x30, 100, 10 }, { 0x30, 339, 200 }, { 0x30, 340, 10 }, { 0x30, 5, 262 },
+			{ 0x80, 0x1FF, 0x1FF }, { 0xB0, 50, 5 },
+		};
+		// Where the registers are written, relative to the start of the frame: the first line, the middle of a line, on line 10's
+		//	H/V match for HTIME 100, in vertical blank, and in the second frame.
+		static const uint64_t ui64Starts[] = { 0, 1000, 10 * CCpuIo::LSN_T_MASTER_PER_LINE + 100 * CCpuIo::LSN_T_MASTER_PER_DOT + CCpuIo::LSN_T_IRQ_DELAY,
+			310000, 362368 };
+		bool bRet = true;
+
+		// == Deadlines.
+		for ( const LSN_TIMER_CASE & tcCase : tcCases ) {
+			for ( uint64_t ui64Start : ui64Starts ) {
+				Reset();
+				const uint64_t ui64Origin = m_rCpu.GetMasterCycles();
+				const uint64_t ui64Frame = m_cioIo.FrameLength();
+				m_rCpu.Stall( ui64Start );
+				const uint64_t ui64Now = m_rCpu.GetMasterCycles();
+				m_cioIo.WriteRegister( 0x07, uint8_t( tcCase.ui16HTime ) );
+				m_cioIo.WriteRegister( 0x08, uint8_t( tcCase.ui16HTime >> 8 ) );
+				m_cioIo.WriteRegister( 0x09, uint8_t( tcCase.ui16VTime ) );
+				m_cioIo.WriteRegister( 0x0A, uint8_t( tcCase.ui16VTime >> 8 ) );
+				m_cioIo.WriteRegister( 0x00, tcCase.ui8NmiTimEn );
+
+				// Walk the beam 1 master cycle at a time.
+				const uint64_t ui64HMatch = uint64_t( tcCase.ui16HTime ) * CCpuIo::LSN_T_MASTER_PER_DOT + CCpuIo::LSN_T_IRQ_DELAY;
+				const uint64_t ui64VLine = uint64_t( tcCase.ui16VTime ) * CCpuIo::LSN_T_MASTER_PER_LINE;
+				const bool bHValid = tcCase.ui16HTime < CCpuIo::LSN_T_DOTS_PER_LINE;
+				const bool bVValid = tcCase.ui16VTime < CCpuIo::LSN_T_NTSC_LINES;
+				uint64_t ui64Irq = UINT64_MAX, ui64Nmi = UINT64_MAX;
+				for ( uint64_t ui64Cycle = ui64Now; ui64Cycle < ui64Now + ui64Frame * 2; ++ui64Cycle ) {
+					const uint64_t ui64Rel = ui64Cycle - ui64Origin;
+					const uint64_t ui64InFrame = ui64Rel % ui64Frame;
+					bool bIrq = false;
+					switch ( tcCase.ui8NmiTimEn & 0x30 ) {
+						case 0x10 : { bIrq = bHValid && ui64Rel >= ui64HMatch && (ui64Rel - ui64HMatch) % CCpuIo::LSN_T_MASTER_PER_LINE == 0; break; }
+						case 0x20 : { bIrq = bVValid && ui64InFrame == ui64VLine + CCpuIo::LSN_T_IRQ_DELAY; break; }
+						case 0x30 : { bIrq = bHValid && bVValid && ui64InFrame == ui64VLine + ui64HMatch; break; }
+					}
+					if ( bIrq && ui64Irq == UINT64_MAX ) { ui64Irq = ui64Cycle; }
+					if ( (tcCase.ui8NmiTimEn & 0x80) && ui64Nmi == UINT64_MAX &&
+						ui64InFrame == uint64_t( CCpuIo::LSN_T_VBLANK_LINE ) * CCpuIo::LSN_T_MASTER_PER_LINE + CCpuIo::LSN_T_NMI_DELAY ) {
+						ui64Nmi = ui64Cycle;
+					}
+				}
+				if ( m_rCpu.EventDeadline( CRicoh5A22::LSN_EV_IRQ ) != ui64Irq || m_rCpu.EventDeadline( CRicoh5A22::LSN_EV_NMI ) != ui64Nmi ) {
+					char szBuffer[160];
+					std::snprintf( szBuffer, std::size( szBuffer ), "IRQ: NMITIMEN %.2X HTIME %u VTIME %u from %llu: IRQ at %llu (expected %llu), NMI at %llu (expected %llu).\r\n",
+						tcCase.ui8NmiTimEn, tcCase.ui16HTime, tcCase.ui16VTime, static_cast<unsigned long long>(ui64Now - ui64Origin),
+						static_cast<unsigned long long>(m_rCpu.EventDeadline( CRicoh5A22::LSN_EV_IRQ )), static_cast<unsigned long long>(ui64Irq),
+						static_cast<unsigned long long>(m_rCpu.EventDeadline( CRicoh5A22::LSN_EV_NMI )), static_cast<unsigned long long>(ui64Nmi) );
+					DebugA( szBuffer );
+					bRet = false;
+				}
+			}
+		}
+
+		// == The I flag, through each engine.
+		{
+			static const PfEngine pfEngines[] = {
+				&CRicoh5A22::RunUntilMasterClock,
+				&CRicoh5A22::RunInstructions,
+#if LSN_CPU_JIT
+				&CRicoh5A22::RunJit,
+#endif	// #if LSN_CPU_JIT
+			};
+			// With I set, adds 1 (through ($20,X)) to A until it wraps to 0, then CLI.  The IRQ handler stores A to $2118 and the NMI
+			//	handler to $2119, so an IRQ taken before CLI stores a non-zero value.
+			static const uint8_t ui8Main[] = { 0x61, 0x20, 0x90, 0xFC, 0x58, 0x80, 0xFE };
+			static const uint8_t ui8Irq[] = { 0x81, 0x10, 0x80, 0xFE };
+			static const uint8_t ui8Nmi[] = { 0x81, 0x12, 0x80, 0xFE };
+			static const uint8_t ui8Pointers[] = { 0x18, 0x21, 0x19, 0x21 };
+			// The longest the handler's store can come after the event: the rest of an instruction, the interrupt sequence, and the
+			//	store, in at most 40 CPU cycles of 8 master cycles.
+			const uint64_t ui64MaxLatency = 40 * 8;
+			LSN_DMA_TEST_PORT dtpPort;
+			dtpPort.prCpu = &m_rCpu;
+			dtpPort.ui32Spans = 0;
+			dtpPort.ui8Next = 0;
+			m_bbBusB.SetRegister( 0x18, &CSystem::DmaTestPortRead, &CSystem::DmaTestPortWrite, nullptr, &dtpPort, &CSystem::DmaTestPortWriteSpan );
+			m_bbBusB.SetRegister( 0x19, &CSystem::DmaTestPortRead, &CSystem::DmaTestPortWrite, nullptr, &dtpPort, &CSystem::DmaTestPortWriteSpan );
+
+			std::vector<LSN_DMA_TEST_ACCESS> vReference;
+			for ( size_t E = 0; E < std::size( pfEngines ); ++E ) {
+				auto Fail = [&]( const char * _pcName ) {
+					char szBuffer[128];
+					std::snprintf( szBuffer, std::size( szBuffer ), "IRQ: engine %u: %s\r\n", uint32_t( E ), _pcName );
+					DebugA( szBuffer );
+					bRet = false;
+				};
+				Reset();
+				dtpPort.vAccesses.clear();
+				m_baBusA.WriteSpan( 0x8000, 0x00, ui8Main, sizeof( ui8Main ) );
+				m_baBusA.WriteSpan( 0x9000, 0x00, ui8Irq, sizeof( ui8Irq ) );
+				m_baBusA.WriteSpan( 0x9100, 0x00, ui8Nmi, sizeof( ui8Nmi ) );
+				std::memcpy( &m_vMemory[0x0010], ui8Pointers, sizeof( ui8Pointers ) );
+				m_vMemory[0x0020] = 0x00;
+				m_vMemory[0x0021] = 0x03;
+				m_vMemory[0x0300] = 0x01;
+				m_vMemory[CRicoh5A22::LSN_V_IRQ_BRK_E] = 0x00;
+				m_vMemory[CRicoh5A22::LSN_V_IRQ_BRK_E+1] = 0x90;
+				m_vMemory[CRicoh5A22::LSN_V_NMI_E] = 0x00;
+				m_vMemory[CRicoh5A22::LSN_V_NMI_E+1] = 0x91;
+				CRicoh5A22::LSN_REGISTERS rRegs;
+				std::memset( &rRegs, 0, sizeof( rRegs ) );
+				rRegs.ui16Pc = 0x8000;
+				rRegs.ui16S = 0x01FF;
+				rRegs.ui8Status = 0x34;
+				m_rCpu.SetRegisters( rRegs, true );
+				SetEngine( pfEngines[E] );
+
+				// The H/V IRQ on line 10 comes in the middle of the loop and is held off by I until CLI.
+				m_cioIo.WriteRegister( 0x07, 100 );
+				m_cioIo.WriteRegister( 0x08, 0 );
+				m_cioIo.WriteRegister( 0x09, 10 );
+				m_cioIo.WriteRegister( 0x0A, 0 );
+				m_cioIo.WriteRegister( 0x00, 0x30 );
+				const uint64_t ui64Irq = m_rCpu.EventDeadline( CRicoh5A22::LSN_EV_IRQ );
+				RunUntil( ui64Irq - 200 );
+				if ( m_rCpu.IrqLine() ) { Fail( "the IRQ line was asserted early." ); }
+				RunUntil( ui64Irq + 500 );
+				if ( !m_rCpu.IrqLine() || !(m_cioIo.DebugReadRegister( 0x11, 0x00 ) & 0x80) ) { Fail( "the IRQ did not assert the line." ); }
+				if ( dtpPort.vAccesses.size() || m_rCpu.Registers().ui16Pc >= 0x8004 ) { Fail( "the loop did not outlast the IRQ with I set." ); }
+
+				// The IRQ handler sets I again, so the line, still asserted, must not re-enter it.
+				RunUntil( ui64Irq + 30000 );
+				if ( dtpPort.vAccesses.size() != 1 || dtpPort.vAccesses[0].ui8Reg != 0x18 || dtpPort.vAccesses[0].ui8Val != 0x00 ||
+					dtpPort.vAccesses[0].ui64Cycle <= ui64Irq + ui64MaxLatency ) {
+					Fail( "the IRQ was not held off by I until CLI." );
+				}
+
+				// NMI is taken in the IRQ handler, with I set.
+				m_cioIo.WriteRegister( 0x00, 0xB0 );
+				const uint64_t ui64Nmi = m_rCpu.EventDeadline( CRicoh5A22::LSN_EV_NMI );
+				RunUntil( ui64Nmi + 4000 );
+				if ( dtpPort.vAccesses.size() != 2 || dtpPort.vAccesses[1].ui8Reg != 0x19 ||
+					dtpPort.vAccesses[1].ui64Cycle < ui64Nmi || dtpPort.vAccesses[1].ui64Cycle > ui64Nmi + ui64MaxLatency ) {
+					Fail( "NMI was not taken on time with I set." );
+				}
+				SetEngine( &CRicoh5A22::RunInstructions );
+
+				if ( E == 0 ) { vReference = dtpPort.vAccesses; }
+				else if ( !(dtpPort.vAccesses == vReference) ) { Fail( "the interrupts were taken on different cycles than by RunUntilMasterClock()." ); }
+			}
+		}
+
+		m_bbBusB.ResetRegisters();
+		m_apApu.Attach( m_bbBusB );
+		Reset();
+		return bRet;
+	}
+
+	/**
+	 * Checks the APU ports: the SPC700 caught up to the exact rational position of each CPU read and write of $2140-$217F through
+	 *	each engine, debug reads that do not catch it up, and the floor of the conversion across many uneven syncs at a 3/7 ratio
+	 *	and at the real clocks.  Leaves the system reset.
+	 *
+	 * \return Returns true if every check passes.
+	 */
+	bool CSystem::RunApuTest() {
+		/** Stands in for the SPC700: records each catch-up and leaves the low and high bytes of its target in ports 0 and 3. */
+		struct LSN_TEST_SPC700 {
+			/** A catch-up. */
+			struct LSN_CATCH_UP {
+				uint64_t								ui64CpuCycle;						/**< The CPU's master cycle at the time of the catch-up. */
+				uint64_t								ui64ApuCycle;						/**< The SPC700 master cycle to reach. */
+
+				bool									operator == ( const LSN_CATCH_UP &_cuOther ) const {
+					return ui64CpuCycle == _cuOther.ui64CpuCycle && ui64ApuCycle == _cuOther.ui64ApuCycle;
+				}
+			};
+			const CRicoh5A22 *							prCpu;								/**< The CPU, for time-stamping catch-ups. */
+			CApuPorts *									papPorts;							/**< The ports. */
+			std::vector<LSN_CATCH_UP>					vCatchUps;							/**< Every catch-up, in order. */
+
+			static void LSN_FASTCALL					CatchUp( void * _pvParm, uint64_t _ui64Cycle ) {
+				LSN_TEST_SPC700 * ptsThis = static_cast<LSN_TEST_SPC700 *>(_pvParm);
+				ptsThis->vCatchUps.push_back( { ptsThis->prCpu->GetMasterCycles(), _ui64Cycle } );
+				ptsThis->papPorts->ApuWrite( 0, uint8_t( _ui64Cycle ) );
+				ptsThis->papPorts->ApuWrite( 3, uint8_t( _ui64Cycle >> 8 ) );
+			}
+		};
+		static const PfEngine pfEngines[] = {
+			&CRicoh5A22::RunUntilMasterClock,
+			&CRicoh5A22::RunInstructions,
+#if LSN_CPU_JIT
+			&CRicoh5A22::RunJit,
+#endif	// #if LSN_CPU_JIT
+		};
+		// LDA $2140, STA $2141, LDA $217F (port 3's last mirror), and STA $0310, all through ($20,X), then BRA to itself.
+		static const uint8_t ui8Program[] = { 0xA1, 0x20, 0x81, 0x22, 0xA1, 0x24, 0x81, 0x26, 0x80, 0xFE };
+		static const uint8_t ui8Pointers[] = { 0x40, 0x21, 0x41, 0x21, 0x7F, 0x21, 0x10, 0x03 };
+		bool bRet = true;
+		LSN_TEST_SPC700 tsSpc;
+		tsSpc.prCpu = &m_rCpu;
+		tsSpc.papPorts = &m_apApu;
+		m_apApu.SetCatchUp( &LSN_TEST_SPC700::CatchUp, &tsSpc );
+
+		// == Catch-ups on port accesses, through each engine.
+		std::vector<LSN_TEST_SPC700::LSN_CATCH_UP> vReference;
+		for ( size_t E = 0; E < std::size( pfEngines ); ++E ) {
+			auto Fail = [&]( const char * _pcName ) {
+				char szBuffer[128];
+				std::snprintf( szBuffer, std::size( szBuffer ), "APU: engine %u: %s\r\n", uint32_t( E ), _pcName );
+				DebugA( szBuffer );
+				bRet = false;
+			};
+			Reset();
+			// 3 SPC700 master cycles for every 7 of the CPU.
+			m_apApu.SetApuClock( m_rCpu.MasterClock() * 3, m_rCpu.MasterDivisor() * 7 );
+			const uint64_t ui64Cpu0 = m_rCpu.GetMasterCycles();
+			const uint64_t ui64Apu0 = m_apApu.ApuCycles();
+			tsSpc.vCatchUps.clear();
+			m_baBusA.WriteSpan( 0x8000, 0x00, ui8Program, sizeof( ui8Program ) );
+			std::memcpy( &m_vMemory[0x0020], ui8Pointers, sizeof( ui8Pointers ) );
+			m_vMemory[0x0310] = 0xFF;
+			CRicoh5A22::LSN_REGISTERS rRegs;
+			std::memset( &rRegs, 0, sizeof( rRegs ) );
+			rRegs.ui16Pc = 0x8000;
+			rRegs.ui16S = 0x01FF;
+			rRegs.ui8Status = 0x34;
+			m_rCpu.SetRegisters( rRegs, true );
+			SetEngine( pfEngines[E] );
+			RunUntil( ui64Cpu0 + 2000 );
+			SetEngine( &CRicoh5A22::RunInstructions );
+
+			if ( tsSpc.vCatchUps.size() != 3 ) { Fail( "the 3 port accesses did not each catch the SPC700 up." ); continue; }
+			for ( size_t I = 0; I < tsSpc.vCatchUps.size(); ++I ) {
+				const LSN_TEST_SPC700::LSN_CATCH_UP & cuThis = tsSpc.vCatchUps[I];
+				if ( cuThis.ui64ApuCycle != ui64Apu0 + (cuThis.ui64CpuCycle - ui64Cpu0) * 3 / 7 ||
+					(I && cuThis.ui64CpuCycle <= tsSpc.vCatchUps[I-1].ui64CpuCycle) ) {
+					Fail( "a catch-up missed the CPU's exact position." );
+				}
+			}
+			if ( m_apApu.ApuRead( 1 ) != uint8_t( tsSpc.vCatchUps[0].ui64ApuCycle ) ) { Fail( "$2140 was read before the SPC700 caught up." ); }
+			if ( m_vMemory[0x0310] != uint8_t( tsSpc.vCatchUps[2].ui64ApuCycle >> 8 ) ) { Fail( "$217F did not read port 3 after the SPC700 caught up." ); }
+
+			// Debug reads leave the SPC700 where it is.
+			m_rCpu.Stall( 1000 );
+			if ( m_bbBusB.DebugRead( 0x40, 0x00 ) != uint8_t( tsSpc.vCatchUps[2].ui64ApuCycle ) || tsSpc.vCatchUps.size() != 3 ) {
+				Fail( "a debug read caught the SPC700 up." );
+			}
+
+			// The SPC700 keeps its position across resets, so compare from the start of each run.
+			for ( LSN_TEST_SPC700::LSN_CATCH_UP & cuThis : tsSpc.vCatchUps ) {
+				cuThis.ui64CpuCycle -= ui64Cpu0;
+				cuThis.ui64ApuCycle -= ui64Apu0;
+			}
+			if ( E == 0 ) { vReference = tsSpc.vCatchUps; }
+			else if ( !(tsSpc.vCatchUps == vReference) ) { Fail( "the SPC700 was caught up on different cycles than by RunUntilMasterClock()." ); }
+		}
+
+		// == The floor of the conversion across uneven syncs, some steps skipped so that the remainder spans gaps.
+		{
+			Reset();
+			m_apApu.SetApuClock( m_rCpu.MasterClock() * 3, m_rCpu.MasterDivisor() * 7 );
+			const uint64_t ui64Cpu0 = m_rCpu.GetMasterCycles();
+			const uint64_t ui64Apu0 = m_apApu.ApuCycles();
+			for ( uint32_t I = 0; I < 1000; ++I ) {
+				m_rCpu.Stall( 1 + I * 37 % 101 );
+				if ( I % 3 == 1 ) { continue; }
+				m_apApu.Sync();
+				if ( m_apApu.ApuCycles() != ui64Apu0 + (m_rCpu.GetMasterCycles() - ui64Cpu0) * 3 / 7 ) {
+					DebugA( "APU: the 3/7 conversion drifted.\r\n" );
+					bRet = false;
+					break;
+				}
+			}
+		}
+		m_apApu.SetCatchUp( nullptr, nullptr );
+		{
+			// MasterClock() CPU master cycles last MasterDivisor() seconds.  The unreduced product fits in 64 bits over that span.
+			//	The reset after a second of running must restart the conversion from the CPU's reset position.
+			m_apApu.SetApuClock( LSN_CS_SPC700_MASTER, LSN_CS_SPC700_MASTER_DIVISOR );
+			m_rCpu.Stall( m_rCpu.MasterClock() / m_rCpu.MasterDivisor() );
+			m_apApu.Sync();
+			Reset();
+			const uint64_t ui64Cpu0 = m_rCpu.GetMasterCycles();
+			const uint64_t ui64Apu0 = m_apApu.ApuCycles();
+			for ( uint32_t I = 0; m_rCpu.GetMasterCycles() - ui64Cpu0 < m_rCpu.MasterClock(); ++I ) {
+				m_rCpu.Stall( 100000 + I * 7919 % 65536 );
+				if ( I % 5 == 2 ) { continue; }
+				m_apApu.Sync();
+				if ( m_apApu.ApuCycles() != ui64Apu0 + (m_rCpu.GetMasterCycles() - ui64Cpu0) * LSN_CS_SPC700_MASTER * m_rCpu.MasterDivisor() /
+					(LSN_CS_SPC700_MASTER_DIVISOR * m_rCpu.MasterClock()) ) {
+					DebugA( "APU: the conversion at the real clocks drifted.\r\n" );
+					bRet = false;
+					break;
+				}
+			}
+		}
+
+		Reset();
+		return bRet;
+	}
+
+	/**
+	 * Loads the registers for RunDmaTest()'s program (STA ($10,X) at $8000, then BRA to itself) in emulation mode.
+	 *
+	 * \param _ui8A The value stored by STA.
+	 **/
+	void CSystem::SetDmaTestRegisters( uint8_t _ui8A ) {
+		static const uint8_t ui8Program[] = { 0x81, 0x10, 0x80, 0xFE };
+		m_baBusA.WriteSpan( 0x8000, 0x00, ui8Program, sizeof( ui8Program ) );
+		m_vMemory[0x10] = 0x0B;
+		m_vMemory[0x11] = 0x42;
+
+		CRicoh5A22::LSN_REGISTERS rRegs;
+		std::memset( &rRegs, 0, sizeof( rRegs ) );
+		rRegs.ui16A = _ui8A;
+		rRegs.ui16Pc = 0x8000;
+		rRegs.ui16S = 0x01FF;
+		rRegs.ui8Status = 0x34;
+		m_rCpu.SetRegisters( rRegs, true );
+	}
+
+	/**
+	 * The Bus B reader for the tests' ports: returns LSN_DMA_TEST_PORT::ui8Next, then increments it.
+	 *
+	 * \param _pvParm0 Points to the LSN_DMA_TEST_PORT.
+	 * \param _ui8Reg The register.
+	 * \param _ui8Ret Holds the read value on return.
+	 * \param _ui8OpenMask Unused; every bit is driven.
+	 **/
+	void LSN_FASTCALL CSystem::DmaTestPortRead( void * _pvParm0, uint8_t _ui8Reg, uint8_t &_ui8Ret, uint8_t &/*_ui8OpenMask*/ ) {
+		LSN_DMA_TEST_PORT * pdtpPort = static_cast<LSN_DMA_TEST_PORT *>(_pvParm0);
+		_ui8Ret = pdtpPort->ui8Next++;
+		pdtpPort->vAccesses.push_back( { pdtpPort->prCpu->GetMasterCycles(), _ui8Reg, _ui8Ret, true } );
+	}
+
+	/**
+	 * The Bus B writer for the tests' ports.
+	 *
+	 * \param _pvParm0 Points to the LSN_DMA_TEST_PORT.
+	 * \param _ui8Reg The register.
+	 * \param _ui8Val The value written.
+	 **/
+	void LSN_FASTCALL CSystem::DmaTestPortWrite( void * _pvParm0, uint8_t _ui8Reg, uint8_t _ui8Val ) {
+		LSN_DMA_TEST_PORT * pdtpPort = static_cast<LSN_DMA_TEST_PORT *>(_pvParm0);
+		pdtpPort->vAccesses.push_back( { pdtpPort->prCpu->GetMasterCycles(), _ui8Reg, _ui8Val, false } );
+	}
+
+	/**
+	 * The Bus B span writer for the tests' ports, recording each byte as DmaTestPortWrite() would.
+	 *
+	 * \param _pvParm0 Points to the LSN_DMA_TEST_PORT.
+	 * \param _ui8Reg The first register of the group.
+	 * \param _pui8Src The bytes written.
+	 * \param _sSize The number of bytes.
+	 * \param _pui8Pattern The offset from _ui8Reg of each register in the group.
+	 * \param _ui8PatternLen The number of entries in _pui8Pattern.
+	 **/
+	void LSN_FASTCALL CSystem::DmaTestPortWriteSpan( void * _pvParm0, uint8_t _ui8Reg, const uint8_t * _pui8Src, size_t _sSize,
+		const uint8_t * _pui8Pattern, uint8_t _ui8PatternLen ) {
+		++static_cast<LSN_DMA_TEST_PORT *>(_pvParm0)->ui32Spans;
+		for ( size_t I = 0; I < _sSize; ++I ) {
+			DmaTestPortWrite( _pvParm0, uint8_t( _ui8Reg + _pui8Pattern[I%_ui8PatternLen] ), _pui8Src[I] );
+		}
+	}
+#endif	// #ifdef LSN_CPU_VERIFY
+
+}	// namespace lsn
@@ -0,0 +1,239 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: The parts of the console driven by the CPU's clock, wired together: Bus A, Bus B, the 5A22, its I/O page, DMA/HDMA, and
+ *	the APU ports.
+ */
+
+#pragma once
+
+#include "../LSNBirdSNES.h"
+#include "../Apu/LSNApuPorts.h"
+#include "../Bus/LSNBusA.h"
+#include "../Bus/LSNBusB.h"
+#include "../Bus/LSNMemoryMap.h"
+#include "../CPU/LSNCpuIo.h"
+#include "../CPU/LSNDma.h"
+#include "../CPU/LSNRicoh5A22.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+
+namespace lsn {
+
+	/**
+	 * Class CSystem
+	 * \brief The parts of the console driven by the CPU's clock, wired together.
+	 *
+	 * Description: The parts of the console driven by the CPU's clock, wired together: Bus A (with its memory), Bus B, the 5A22, its
+	 *	I/O page (CCpuIo), DMA/HDMA (CDma), and the ports to the SPC700 (CApuPorts).  RunUntil() runs the CPU through the selected engine, and every time the CPU stops on an
+	 *	event deadline (general DMA, HDMA, NMI, or IRQ) it calls CCpuIo::Service(), so DMA and HDMA stall the CPU and interrupts are
+	 *	raised on the exact cycles they would be had every cycle been checked.
+	 * The object is large (Bus A's accessor tables, the CPU's caches, and 16 mebibytes of bus memory), so it belongs on the heap.
+	 */
+	class CSystem {
+	public :
+		CSystem( std::shared_ptr<const CMemoryMap> _pmmMap = nullptr );
+
+
+		// == Types.
+		/** A CPU engine: CRicoh5A22::RunUntilMasterClock(), RunInstructions(), RunJit(), or RunAot(). */
+		typedef uint64_t (CRicoh5A22:: *				PfEngine)( uint64_t _ui64MasterClock );
+
+
+		// == Functions.
+		/**
+		 * Resets the CPU, the I/O page, the DMA channels, and the APU ports.  The frame and the APU ports' conversion start at the CPU's
+		 *	(reset) master cycle.
+		 **/
+		void											Reset();
+
+		/**
+		 * Sets the memory map used by Bus A (normally CCartridge::MemoryMap()), attaches Bus B, the I/O page, and the DMA registers
+		 *	to it, and attaches the APU ports to Bus B.  The map must route $2100-$21FF, $4200-$42FF, and $4300-$43FF through CBusB::ApplyMapping(), CCpuIo::ApplyMapping(),
+		 *	and CDma::ApplyMapping().
+		 *
+		 * \param _pmmMap The memory map.
+		 **/
+		void											SetMemoryMap( std::shared_ptr<const CMemoryMap> _pmmMap );
+
+		/**
+		 * Selects the engine with which RunUntil() runs the CPU.  The default is CRicoh5A22::RunInstructions().
+		 *
+		 * \param _pfEngine The engine.
+		 **/
+		inline void										SetEngine( PfEngine _pfEngine ) { m_pfEngine = _pfEngine; }
+
+		/**
+		 * Runs the CPU until its master clock reaches _ui64MasterClock, servicing DMA, HDMA, NMI, and IRQ at each event deadline on
+		 *	the way.  The last instruction (or DMA) may end past the target.
+		 *
+		 * \param _ui64MasterClock The master-clock value at which to stop.
+		 * \return Returns the number of CPU cycles run.
+		 **/
+		uint64_t										RunUntil( uint64_t _ui64MasterClock );
+
+		/**
+		 * Gets the CPU.
+		 *
+		 * \return Returns the CPU.
+		 **/
+		inline CRicoh5A22 &								Cpu() { return m_rCpu; }
+
+		/**
+		 * Gets Bus A.
+		 *
+		 * \return Returns Bus A.
+		 **/
+		inline CBusA &									BusA() { return m_baBusA; }
+
+		/**
+		 * Gets Bus B.
+		 *
+		 * \return Returns Bus B.
+		 **/
+		inline CBusB &									BusB() { return m_bbBusB; }
+
+		/**
+		 * Gets the DMA channels.
+		 *
+		 * \return Returns the DMA channels.
+		 **/
+		inline CDma &									Dma() { return m_dDma; }
+
+		/**
+		 * Gets the CPU's I/O page.
+		 *
+		 * \return Returns the I/O page.
+		 **/
+		inline CCpuIo &									CpuIo() { return m_cioIo; }
+
+		/**
+		 * Gets the ports to the SPC700.
+		 *
+		 * \return Returns the APU ports.
+		 **/
+		inline CApuPorts &								ApuPorts() { return m_apApu; }
+
+		/**
+		 * Builds a memory map with plain memory everywhere except Bus B, the CPU's I/O page, and the DMA registers, for use without a
+		 *	cartridge.
+		 *
+		 * \return Returns the new map.
+		 **/
+		static std::shared_ptr<const CMemoryMap>		IoMap();
+
+#ifdef LSN_CPU_VERIFY
+		/**
+		 * Checks general DMA and HDMA: the block copy against the byte-by-byte path and against each transfer mode's register pattern,
+		 *	the stall after general DMA from every alignment of the start, a transfer started by the CPU's own write to $420B through
+		 *	each engine, and the lines and stalls of repeated and indirect HDMA tables.  Leaves the system reset.
+		 *
+		 * \return Returns true if every check passes.
+		 */
+		bool											RunDmaTest();
+
+		/**
+		 * Checks NMI and the H/V-timer IRQ: the deadlines CCpuIo computes from NMITIMEN, HTIME, and VTIME against a cycle-by-cycle
+		 *	search of the beam position, and, through each engine, an IRQ held off by the I flag until CLI while NMI is taken regardless.
+		 *	Leaves the system reset.
+		 *
+		 * \return Returns true if every check passes.
+		 */
+		bool											RunIrqTest();
+
+		/**
+		 * Checks the APU ports: the SPC700 caught up to the exact rational position of each CPU read and write of $2140-$217F through
+		 *	each engine, debug reads that do not catch it up, and the floor of the conversion across many uneven syncs at a 3/7 ratio
+		 *	and at the real clocks.  Leaves the system reset.
+		 *
+		 * \return Returns true if every check passes.
+		 */
+		bool											RunApuTest();
+#endif	// #ifdef LSN_CPU_VERIFY
+
+
+	protected :
+#ifdef LSN_CPU_VERIFY
+		// == Types.
+		/** An access made to one of the tests' Bus B ports. */
+		struct LSN_DMA_TEST_ACCESS {
+			uint64_t									ui64Cycle;							/**< The CPU's master cycle at the time of the access. */
+			uint8_t										ui8Reg;								/**< The register. */
+			uint8_t										ui8Val;								/**< The value read or written. */
+			bool										bRead;								/**< True for a read. */
+
+			bool										operator == ( const LSN_DMA_TEST_ACCESS &_dtaOther ) const {
+				return ui64Cycle == _dtaOther.ui64Cycle && ui8Reg == _dtaOther.ui8Reg && ui8Val == _dtaOther.ui8Val && bRead == _dtaOther.bRead;
+			}
+		};
+
+		/** The Bus B ports of RunDmaTest() and RunIrqTest(). */
+		struct LSN_DMA_TEST_PORT {
+			const CRicoh5A22 *							prCpu;								/**< The CPU, for time-stamping accesses. */
+			std::vector<LSN_DMA_TEST_ACCESS>			vAccesses;							/**< Every access, in order. */
+			uint32_t									ui32Spans;							/**< The number of calls to DmaTestPortWriteSpan(). */
+			uint8_t										ui8Next;							/**< The value returned by the next read. */
+		};
+#endif	// #ifdef LSN_CPU_VERIFY
+
+
+		// == Members.
+		std::vector<uint8_t>							m_vMemory;							/**< Bus A's memory (the full 24-bit space). */
+		CBusA											m_baBusA;							/**< Bus A. */
+		CBusB											m_bbBusB;							/**< Bus B. */
+		CRicoh5A22										m_rCpu;								/**< The CPU. */
+		CDma											m_dDma;								/**< The DMA channels. */
+		CCpuIo											m_cioIo;							/**< The CPU's I/O page. */
+		CApuPorts										m_apApu;							/**< The ports to the SPC700. */
+		PfEngine										m_pfEngine = &CRicoh5A22::RunInstructions;	/**< The engine used by RunUntil(). */
+
+
+#ifdef LSN_CPU_VERIFY
+		// == Functions.
+		/**
+		 * Loads the registers for RunDmaTest()'s program (STA ($10,X) at $8000, then BRA to itself) in emulation mode.
+		 *
+		 * \param _ui8A The value stored by STA.
+		 **/
+		void											SetDmaTestRegisters( uint8_t _ui8A );
+
+		/**
+		 * The Bus B reader for the tests' ports: returns LSN_DMA_TEST_PORT::ui8Next, then increments it.
+		 *
+		 * \param _pvParm0 Points to the LSN_DMA_TEST_PORT.
+		 * \param _ui8Reg The register.
+		 * \param _ui8Ret Holds the read value on return.
+		 * \param _ui8OpenMask Unused; every bit is driven.
+		 **/
+		static void LSN_FASTCALL						DmaTestPortRead( void * _pvParm0, uint8_t _ui8Reg, uint8_t &_ui8Ret, uint8_t &_ui8OpenMask );
+
+		/**
+		 * The Bus B writer for the tests' ports.
+		 *
+		 * \param _pvParm0 Points to the LSN_DMA_TEST_PORT.
+		 * \param _ui8Reg The register.
+		 * \param _ui8Val The value written.
+		 **/
+		static void LSN_FASTCALL						DmaTestPortWrite( void * _pvParm0, uint8_t _ui8Reg, uint8_t _ui8Val );
+
+		/**
+		 * The Bus B span writer for the tests' ports, recording each byte as DmaTestPortWrite() would.
+		 *
+		 * \param _pvParm0 Points to the LSN_DMA_TEST_PORT.
+		 * \param _ui8Reg The first register of the group.
+		 * \param _pui8Src The bytes written.
+		 * \param _sSize The number of bytes.
+		 * \param _pui8Pattern The offset from _ui8Reg of each register in the group.
+		 * \param _ui8PatternLen The number of entries in _pui8Pattern.
+		 **/
+		static void LSN_FASTCALL						DmaTestPortWriteSpan( void * _pvParm0, uint8_t _ui8Reg, const uint8_t * _pui8Src, size_t _sSize,
+			const uint8_t * _pui8Pattern, uint8_t _ui8PatternLen );
+#endif	// #ifdef LSN_CPU_VERIFY
+	};
+
+}	// namespace lsn
@@ -48,6 +48,18 @@ namespace lsn {
 		 **/
 		inline uint8_t							Divisor() const { return m_ui8Speed; }
 
+		/**
+		 * Sets the master clock that drives the component.  Its frequency is _ui64MasterClock / _ui64MasterDiv Hz, kept as a ratio so that
+		 *	converting between clocks never needs floating-point math (see LSN_CLOCK_SPEEDS).
+		 * 
+		 * \param _ui64MasterClock The master-clock speed (LSN_CS_NTSC_MASTER, LSN_CS_SPC700_MASTER, etc.)
+		 * \param _ui64MasterDiv The master divisor (LSN_CS_NTSC_MASTER_DIVISOR, LSN_CS_SPC700_MASTER_DIVISOR, etc.)
+		 **/
+		inline void								SetMasterClock( uint64_t _ui64MasterClock, uint64_t _ui64MasterDiv ) {
+			m_ui64MasterClock = _ui64MasterClock;
+			m_ui64MasterDiv = _ui64MasterDiv;
+		}
+
 
 	protected :
 		// == Members.